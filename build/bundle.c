@@ -0,0 +1 @@
+unsigned char font_data[] = {0,1,0,0,0,18,1,0,0,4,0,32,68,83,73,71,0,0,0,1,0,4,218,180,0,0,0,8,71,68,69,70,104,73,113,21,0,0,1,44,0,0,3,130,71,80,79,83,248,195,175,225,0,0,4,176,0,0,199,222,71,83,85,66,79,30,253,241,0,0,204,144,0,0,67,88,79,83,47,50,53,60,213,98,0,1,15,232,0,0,0,96,99,109,97,112,170,181,252,197,0,1,16,72,0,0,15,146,99,118,116,32,63,37,25,139,0,4,203,52,0,0,1,36,102,112,103,109,85,40,142,128,0,4,204,88,0,0,13,109,103,97,115,112,0,0,0,16,0,4,203,44,0,0,0,8,103,108,121,102,64,48,164,72,0,1,31,220,0,3,10,140,104,101,97,100,14,163,113,30,0,4,42,104,0,0,0,54,104,104,101,97,7,91,11,41,0,4,42,160,0,0,0,36,104,109,116,120,21,83,176,124,0,4,42,196,0,0,32,240,108,111,99,97,12,35,222,40,0,4,75,180,0,0,32,244,109,97,120,112,9,175,14,209,0,4,108,168,0,0,0,32,110,97,109,101,79,21,35,253,0,4,108,200,0,0,8,25,112,111,115,116,233,163,245,214,0,4,116,228,0,0,86,71,112,114,101,112,241,105,149,6,0,4,217,200,0,0,0,235,0,1,0,0,0,12,0,0,3,16,3,72,0,2,0,128,0,3,0,40,0,1,0,42,0,42,0,1,0,44,0,122,0,1,0,124,0,163,0,1,0,165,0,176,0,1,0,178,0,185,0,1,0,187,0,218,0,1,0,220,1,19,0,1,1,21,1,34,0,1,1,36,1,61,0,1,1,63,1,100,0,1,1,102,1,139,0,1,1,141,1,144,0,1,1,146,1,172,0,1,1,174,1,181,0,1,1,183,1,214,0,1,1,216,1,252,0,1,1,253,1,254,0,2,2,3,2,3,0,2,2,4,2,41,0,1,2,43,2,43,0,1,2,45,2,128,0,1,2,130,2,169,0,1,2,171,2,190,0,1,2,192,2,223,0,1,2,225,2,255,0,1,3,1,3,21,0,1,3,23,3,30,0,1,3,32,3,34,0,1,3,37,3,46,0,1,3,48,3,50,0,1,3,52,3,56,0,1,3,58,3,59,0,1,3,66,3,66,0,1,3,69,3,69,0,1,3,71,3,74,0,1,3,77,3,77,0,1,3,85,3,86,0,1,3,90,3,90,0,1,3,93,3,95,0,1,3,97,3,97,0,1,3,100,3,112,0,1,3,114,3,117,0,1,3,119,3,125,0,1,3,128,3,129,0,1,3,132,3,141,0,1,3,145,3,145,0,1,3,147,3,148,0,1,3,150,3,151,0,1,3,153,3,154,0,1,3,161,3,161,0,1,3,164,3,164,0,1,3,166,3,172,0,1,3,176,3,177,0,1,3,180,3,182,0,1,3,188,3,192,0,1,3,194,3,194,0,1,3,196,3,196,0,1,3,198,3,216,0,1,3,219,3,220,0,1,3,222,3,222,0,1,3,224,3,226,0,1,3,229,3,238,0,1,3,240,3,242,0,1,3,244,3,248,0,1,3,250,3,251,0,1,4,2,4,2,0,1,4,5,4,5,0,1,4,7,4,10,0,1,4,13,4,13,0,1,4,21,4,22,0,1,4,26,4,26,0,1,4,29,4,31,0,1,4,33,4,33,0,1,4,35,4,48,0,1,4,50,4,53,0,1,4,55,4,63,0,1,4,65,4,70,0,1,4,72,4,73,0,1,4,75,4,75,0,1,4,77,4,77,0,1,4,79,4,80,0,1,4,82,4,218,0,1,4,222,4,222,0,1,4,224,4,224,0,1,4,226,4,226,0,1,4,232,4,232,0,1,4,234,4,234,0,1,4,238,4,238,0,1,4,242,4,253,0,1,5,3,5,123,0,1,5,127,5,128,0,1,5,131,5,133,0,1,5,135,5,136,0,1,5,138,5,139,0,1,5,141,5,141,0,1,5,143,5,143,0,1,5,146,5,147,0,1,5,149,5,149,0,1,5,151,5,162,0,1,5,164,6,92,0,1,6,94,6,96,0,1,6,98,6,103,0,1,6,105,6,106,0,1,6,108,6,108,0,1,6,110,6,110,0,1,6,112,6,113,0,1,6,115,6,118,0,1,6,122,6,122,0,1,6,124,6,124,0,1,6,126,6,126,0,1,6,132,6,132,0,1,6,134,6,134,0,1,6,138,6,138,0,1,6,142,6,142,0,1,7,84,7,86,0,1,7,88,7,88,0,1,7,93,7,93,0,1,7,95,7,95,0,1,7,99,7,102,0,1,7,107,7,107,0,1,7,128,7,128,0,1,7,176,7,176,0,1,7,186,7,242,0,3,8,11,8,14,0,3,8,41,8,50,0,3,8,51,8,52,0,1,8,54,8,57,0,1,0,44,0,4,0,12,0,20,0,28,0,36,0,1,0,4,0,1,1,223,0,1,0,4,0,1,1,127,0,1,0,4,0,1,1,115,0,1,0,4,0,1,1,239,0,1,0,4,1,253,1,254,2,2,2,3,0,2,0,9,7,186,7,211,0,2,7,212,7,212,0,3,7,213,7,216,0,1,7,218,7,219,0,1,7,221,7,240,0,2,7,242,7,242,0,2,8,11,8,13,0,2,8,14,8,14,0,1,8,41,8,50,0,2,0,0,0,1,0,0,0,10,1,68,5,36,0,3,68,70,76,84,0,20,99,121,114,108,0,38,108,97,116,110,0,76,0,4,0,0,0,0,255,255,0,4,0,0,0,15,0,30,0,45,0,10,0,1,83,82,66,32,0,24,0,0,255,255,0,4,0,1,0,16,0,31,0,46,0,0,255,255,0,4,0,2,0,17,0,32,0,47,0,70,0,11,65,90,69,32,0,84,67,65,84,32,0,98,67,82,84,32,0,112,69,83,80,32,0,126,71,85,65,32,0,140,75,65,90,32,0,154,77,79,76,32,0,168,78,76,68,32,0,182,82,79,77,32,0,196,84,65,84,32,0,210,84,82,75,32,0,224,0,0,255,255,0,4,0,3,0,18,0,33,0,48,0,0,255,255,0,4,0,4,0,19,0,34,0,49,0,0,255,255,0,4,0,5,0,20,0,35,0,50,0,0,255,255,0,4,0,6,0,21,0,36,0,51,0,0,255,255,0,4,0,7,0,22,0,37,0,52,0,0,255,255,0,4,0,8,0,23,0,38,0,53,0,0,255,255,0,4,0,9,0,24,0,39,0,54,0,0,255,255,0,4,0,10,0,25,0,40,0,55,0,0,255,255,0,4,0,11,0,26,0,41,0,56,0,0,255,255,0,4,0,12,0,27,0,42,0,57,0,0,255,255,0,4,0,13,0,28,0,43,0,58,0,0,255,255,0,4,0,14,0,29,0,44,0,59,0,60,99,112,115,112,1,106,99,112,115,112,1,112,99,112,115,112,1,118,99,112,115,112,1,124,99,112,115,112,1,130,99,112,115,112,1,136,99,112,115,112,1,142,99,112,115,112,1,148,99,112,115,112,1,154,99,112,115,112,1,160,99,112,115,112,1,166,99,112,115,112,1,172,99,112,115,112,1,178,99,112,115,112,1,184,99,112,115,112,1,190,107,101,114,110,1,196,107,101,114,110,1,204,107,101,114,110,1,212,107,101,114,110,1,220,107,101,114,110,1,228,107,101,114,110,1,236,107,101,114,110,1,244,107,101,114,110,1,252,107,101,114,110,2,4,107,101,114,110,2,12,107,101,114,110,2,20,107,101,114,110,2,28,107,101,114,110,2,36,107,101,114,110,2,44,107,101,114,110,2,52,109,97,114,107,2,60,109,97,114,107,2,74,109,97,114,107,2,88,109,97,114,107,2,102,109,97,114,107,2,116,109,97,114,107,2,130,109,97,114,107,2,144,109,97,114,107,2,158,109,97,114,107,2,172,109,97,114,107,2,186,109,97,114,107,2,200,109,97,114,107,2,214,109,97,114,107,2,228,109,97,114,107,2,242,109,97,114,107,3,0,109,107,109,107,3,14,109,107,109,107,3,28,109,107,109,107,3,42,109,107,109,107,3,56,109,107,109,107,3,70,109,107,109,107,3,84,109,107,109,107,3,98,109,107,109,107,3,112,109,107,109,107,3,126,109,107,109,107,3,140,109,107,109,107,3,154,109,107,109,107,3,168,109,107,109,107,3,182,109,107,109,107,3,196,109,107,109,107,3,210,0,0,0,1,0,0,0,0,0,1,0,0,0,0,0,1,0,0,0,0,0,1,0,0,0,0,0,1,0,0,0,0,0,1,0,0,0,0,0,1,0,0,0,0,0,1,0,0,0,0,0,1,0,0,0,0,0,1,0,0,0,0,0,1,0,0,0,0,0,1,0,0,0,0,0,1,0,0,0,0,0,1,0,0,0,0,0,1,0,0,0,0,0,2,0,1,0,2,0,0,0,2,0,1,0,2,0,0,0,2,0,1,0,2,0,0,0,2,0,1,0,2,0,0,0,2,0,1,0,2,0,0,0,2,0,1,0,2,0,0,0,2,0,1,0,2,0,0,0,2,0,1,0,2,0,0,0,2,0,1,0,2,0,0,0,2,0,1,0,2,0,0,0,2,0,1,0,2,0,0,0,2,0,1,0,2,0,0,0,2,0,1,0,2,0,0,0,2,0,1,0,2,0,0,0,2,0,1,0,2,0,0,0,5,0,3,0,4,0,5,0,6,0,7,0,0,0,5,0,3,0,4,0,5,0,6,0,7,0,0,0,5,0,3,0,4,0,5,0,6,0,7,0,0,0,5,0,3,0,4,0,5,0,6,0,7,0,0,0,5,0,3,0,4,0,5,0,6,0,7,0,0,0,5,0,3,0,4,0,5,0,6,0,7,0,0,0,5,0,3,0,4,0,5,0,6,0,7,0,0,0,5,0,3,0,4,0,5,0,6,0,7,0,0,0,5,0,3,0,4,0,5,0,6,0,7,0,0,0,5,0,3,0,4,0,5,0,6,0,7,0,0,0,5,0,3,0,4,0,5,0,6,0,7,0,0,0,5,0,3,0,4,0,5,0,6,0,7,0,0,0,5,0,3,0,4,0,5,0,6,0,7,0,0,0,5,0,3,0,4,0,5,0,6,0,7,0,0,0,5,0,3,0,4,0,5,0,6,0,7,0,0,0,5,0,8,0,9,0,10,0,11,0,12,0,0,0,5,0,8,0,9,0,10,0,11,0,12,0,0,0,5,0,8,0,9,0,10,0,11,0,12,0,0,0,5,0,8,0,9,0,10,0,11,0,12,0,0,0,5,0,8,0,9,0,10,0,11,0,12,0,0,0,5,0,8,0,9,0,10,0,11,0,12,0,0,0,5,0,8,0,9,0,10,0,11,0,12,0,0,0,5,0,8,0,9,0,10,0,11,0,12,0,0,0,5,0,8,0,9,0,10,0,11,0,12,0,0,0,5,0,8,0,9,0,10,0,11,0,12,0,0,0,5,0,8,0,9,0,10,0,11,0,12,0,0,0,5,0,8,0,9,0,10,0,11,0,12,0,0,0,5,0,8,0,9,0,10,0,11,0,12,0,0,0,5,0,8,0,9,0,10,0,11,0,12,0,0,0,5,0,8,0,9,0,10,0,11,0,12,0,13,0,28,0,36,0,46,0,76,0,84,0,92,0,100,0,108,0,116,0,124,0,132,0,140,0,148,0,1,0,0,0,1,0,128,0,2,0,8,0,2,0,130,0,150,0,2,0,8,0,12,0,160,10,54,12,158,13,18,13,64,13,84,16,190,16,238,17,4,20,132,20,168,22,232,0,4,0,0,0,1,22,224,0,4,0,0,0,1,26,30,0,4,0,0,0,1,41,12,0,4,0,0,0,1,76,2,0,5,0,0,0,1,126,90,0,6,1,0,0,1,128,222,0,6,2,0,0,1,129,94,0,6,3,0,0,1,132,184,0,6,2,0,0,1,132,210,0,6,2,0,0,1,135,24,0,1,137,4,0,5,0,10,0,20,0,2,137,16,0,4,0,0,145,78,145,82,0,1,0,2,0,0,255,236,0,2,137,24,0,4,0,0,145,58,145,70,0,1,0,2,0,0,255,236,0,2,137,10,0,4,0,0,145,96,151,154,0,23,0,53,0,0,255,186,0,20,255,246,255,246,255,216,255,231,255,246,255,226,255,214,255,240,255,216,255,156,255,236,255,236,255,236,255,206,255,236,255,226,255,241,255,246,255,236,255,236,255,236,255,236,255,236,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,236,0,0,0,0,0,0,0,0,255,236,0,0,0,0,0,0,0,0,0,0,255,216,0,0,0,0,0,0,0,0,255,246,0,0,255,246,0,0,255,246,0,0,0,0,0,0,255,246,255,236,255,216,255,246,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,244,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,226,255,236,0,0,255,236,0,0,0,0,0,0,0,0,0,0,255,246,0,0,0,0,255,236,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,216,0,0,0,0,255,236,255,216,0,0,0,0,0,0,0,0,0,0,255,226,0,0,0,0,255,226,0,0,255,226,255,226,255,216,255,231,0,0,0,0,255,226,255,236,0,0,255,226,255,236,0,0,255,236,255,236,255,236,255,236,255,216,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,246,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,236,255,236,0,0,255,211,0,0,0,0,0,0,0,0,0,0,255,246,0,0,255,166,0,0,255,213,0,0,0,0,255,206,255,239,255,226,255,246,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,246,0,0,255,236,0,0,255,236,0,0,255,246,0,0,255,236,0,0,255,236,0,0,0,0,0,0,255,246,0,0,0,0,255,236,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,236,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,226,255,246,0,0,255,236,0,0,0,0,0,0,0,0,0,0,255,226,0,0,255,226,0,0,255,236,0,0,0,0,255,236,255,246,255,236,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,226,255,236,0,0,255,216,0,0,255,236,0,0,255,226,0,0,255,216,0,0,255,196,255,236,255,226,0,0,0,0,255,236,255,246,255,236,255,246,255,244,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,216,0,0,0,0,255,216,0,0,255,216,255,156,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,243,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25,0,0,0,0,255,236,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,246,0,0,255,246,0,0,0,0,255,246,0,0,255,246,255,216,0,0,0,0,0,0,255,226,255,246,0,0,255,236,0,0,0,0,0,0,255,236,0,0,255,236,0,0,0,0,0,0,255,246,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,226,0,0,0,0,0,0,255,244,0,0,0,0,255,226,255,238,255,236,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,255,236,255,206,0,0,0,0,0,0,0,0,0,0,255,246,0,0,0,0,0,0,255,236,255,236,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,246,0,0,0,0,0,0,0,0,0,0,0,0,255,186,255,246,0,0,255,211,0,0,0,0,0,0,0,0,0,0,0,10,0,0,255,126,0,0,255,236,0,0,0,0,0,0,255,231,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,246,0,0,0,0,255,236,255,226,255,226,0,0,0,0,255,216,0,0,0,0,255,246,255,186,255,246,0,0,255,226,0,0,255,236,0,0,255,226,0,0,255,236,0,0,0,0,0,0,255,236,0,0,0,0,0,0,0,0,255,236,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,246,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,246,0,0,255,246,0,0,255,236,0,0,0,0,0,0,0,0,0,0,255,236,0,0,255,196,0,0,255,236,0,0,0,0,0,0,0,0,0,0,255,236,0,0,0,0,0,0,255,246,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,236,0,0,255,244,0,0,0,10,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,246,255,186,255,226,0,0,255,196,0,0,255,226,0,0,255,226,0,0,255,206,0,0,255,176,255,226,255,206,0,0,0,0,0,0,255,231,255,216,255,226,0,0,0,0,0,0,0,0,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,226,255,236,0,0,255,226,0,0,255,236,0,0,0,0,0,0,0,0,0,0,255,206,0,0,255,236,0,0,0,0,0,0,255,246,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,216,0,0,255,226,255,226,0,0,0,0,0,0,0,0,0,0,0,30,0,0,255,236,255,226,255,246,255,176,255,216,0,0,255,181,0,0,255,216,0,0,255,214,255,236,255,229,255,216,255,156,255,216,255,176,255,216,255,226,255,173,255,214,255,186,255,216,0,0,255,246,0,0,255,226,0,0,255,246,255,241,255,176,255,196,255,216,255,226,255,196,0,0,0,0,0,0,0,0,0,0,0,0,255,246,0,30,0,0,255,238,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,196,0,0,0,0,255,226,0,0,255,236,0,0,255,236,0,0,255,226,0,0,0,0,0,0,255,246,0,0,0,0,0,0,255,240,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,236,0,0,0,0,0,0,0,0,0,30,255,246,0,30,0,20,255,226,255,226,0,10,255,196,255,216,255,216,255,216,255,216,255,216,255,206,255,226,255,226,255,226,255,226,255,176,255,216,255,196,255,206,255,226,255,216,255,216,255,216,255,226,0,0,0,0,0,0,0,0,255,226,255,246,0,0,0,0,0,0,0,0,0,0,0,0,0,60,255,206,255,236,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,236,0,0,0,0,0,0,255,246,0,0,255,236,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,206,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,216,0,0,0,0,0,0,0,0,0,0,0,0,255,156,0,0,0,0,0,0,0,0,0,0,0,0,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,236,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,216,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,236,0,0,0,0,255,226,0,0,0,0,255,216,0,0,255,216,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,246,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,129,34,0,4,0,0,151,152,153,160,0,12,0,25,0,0,255,226,255,196,255,216,255,206,255,246,255,236,255,241,255,226,255,236,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,226,255,196,255,216,255,206,0,0,0,0,0,0,255,226,255,236,255,241,255,206,255,246,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,50,0,100,0,100,0,100,255,246,0,0,255,238,255,226,0,0,0,0,0,90,255,236,0,30,0,100,0,100,0,100,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,236,0,0,255,226,255,236,255,243,0,0,0,0,0,0,0,0,0,0,255,206,0,0,0,0,0,0,0,0,0,0,255,236,255,246,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,236,255,216,255,216,255,206,0,0,0,0,0,0,0,0,0,0,0,0,255,176,0,0,255,246,0,0,0,0,0,0,0,0,0,0,255,236,255,237,0,0,0,0,0,0,0,0,0,0,255,236,255,196,255,181,255,216,0,0,0,0,0,0,255,216,255,236,0,0,255,196,0,0,0,0,0,0,255,226,0,0,0,0,0,0,255,216,255,240,255,236,255,226,255,236,255,226,0,0,255,226,0,0,255,236,255,216,255,246,255,236,255,246,255,176,0,0,0,0,0,0,0,0,0,0,0,0,255,216,0,0,0,0,0,0,255,236,0,15,0,0,0,0,0,0,0,0,0,0,255,226,255,216,255,196,255,216,0,0,0,0,0,0,255,236,0,0,0,0,0,0,0,0,0,0,0,0,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,236,255,216,0,0,0,0,0,0,0,0,0,0,0,0,255,206,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,236,0,0,0,0,0,0,0,0,0,0,0,0,255,226,255,206,255,229,255,226,255,240,255,226,255,240,255,186,0,0,255,236,0,60,255,236,255,236,0,0,255,226,0,0,255,236,0,0,255,216,0,0,0,0,255,236,0,0,0,0,0,0,0,0,255,226,255,236,255,226,255,236,255,226,255,236,0,0,0,0,0,0,0,40,255,236,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,127,186,0,4,0,0,133,52,157,78,0,2,0,25,0,0,255,206,255,246,255,226,255,226,255,226,255,186,255,226,255,176,255,196,255,196,255,236,255,236,255,236,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,206,0,0,0,0,0,0,255,176,0,0,255,156,0,0,255,176,0,0,255,186,0,0,255,96,255,206,255,246,255,216,255,196,255,196,255,216,255,226,255,216,255,226,255,216,0,2,127,110,0,4,0,0,163,194,163,234,0,3,0,5,0,0,255,242,255,229,255,222,0,0,0,0,0,0,0,0,0,0,255,236,0,0,0,0,0,0,255,229,0,0,0,2,124,100,0,4,0,0,132,134,163,246,0,1,0,2,0,0,255,236,0,2,127,64,0,4,0,0,164,64,165,40,0,11,0,39,0,0,255,236,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,246,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,246,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,106,0,10,255,226,255,201,255,226,255,226,255,206,255,196,0,10,0,20,255,196,255,196,255,216,255,216,255,206,255,216,255,196,255,226,0,20,255,216,255,216,255,186,255,196,255,216,255,216,255,196,255,226,255,226,255,226,0,30,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,106,0,0,255,226,255,186,255,206,255,196,0,0,0,0,0,10,0,0,255,156,0,0,255,206,255,206,0,0,255,206,255,166,0,0,0,0,255,186,0,0,255,166,0,0,255,186,255,186,0,0,255,166,255,216,255,186,0,0,255,186,255,206,255,186,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,236,0,0,255,246,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,236,0,0,0,0,0,0,0,0,0,0,255,216,255,236,255,236,255,216,0,0,0,0,0,0,0,0,255,226,255,236,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,226,255,246,0,0,0,0,0,0,0,0,255,186,0,0,0,0,0,0,0,0,0,0,0,0,255,186,255,186,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,156,0,0,0,0,255,206,255,136,0,0,255,236,255,206,255,236,0,0,255,236,0,0,0,0,0,0,255,206,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,176,0,0,0,0,255,226,255,136,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,196,0,0,0,0,0,0,255,216,0,0,255,236,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,236,0,0,0,0,0,0,0,0,0,2,124,50,0,4,0,0,168,58,168,116,0,4,0,4,0,0,255,176,0,0,0,0,0,0,0,0,255,186,0,0,0,0,0,0,0,0,255,216,0,0,0,0,255,236,0,0,0,2,124,38,0,4,0,0,128,216,168,216,0,1,0,3,0,0,255,215,255,215,0,2,124,24,0,4,0,0,168,222,169,66,0,20,0,22,0,0,255,229,255,239,255,245,255,229,255,242,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,229,0,0,0,0,255,236,0,0,255,242,255,242,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,215,0,0,0,0,0,14,255,229,255,236,255,229,255,219,255,222,255,215,255,215,0,20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,244,255,242,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,242,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,236,0,0,255,236,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,239,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,236,255,242,0,0,0,0,0,0,255,229,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,236,0,0,0,0,255,239,255,236,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,242,255,244,0,0,255,245,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,20,255,229,255,242,255,222,255,229,255,236,255,222,255,229,0,0,0,0,255,242,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,222,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,14,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,229,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,242,255,236,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,242,255,236,255,229,255,242,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,242,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,229,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,242,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,236,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,14,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,120,212,0,4,0,0,166,134,166,180,0,2,0,5,0,0,255,226,255,226,255,216,0,0,0,0,0,0,255,246,0,0,255,246,0,2,120,252,0,4,0,0,167,162,168,60,0,14,0,20,0,0,255,206,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,226,255,236,255,206,0,20,255,236,255,216,255,246,255,224,255,246,255,246,255,246,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,236,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,216,0,0,0,0,255,236,0,0,255,246,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,226,0,0,0,0,0,0,0,0,255,236,0,0,255,226,0,0,0,0,0,0,255,246,255,196,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,236,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,246,0,0,0,0,0,0,0,0,0,0,0,0,255,236,0,0,255,246,255,226,0,0,0,0,255,246,255,246,0,0,255,216,255,246,0,0,0,0,255,236,255,166,255,156,255,226,255,236,0,0,0,0,255,216,0,0,0,0,0,0,0,0,255,236,0,0,255,246,0,0,0,0,0,0,0,0,255,216,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,216,255,246,0,0,255,246,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,246,0,0,255,236,0,0,0,0,0,0,0,0,255,236,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,226,0,0,0,0,255,246,0,0,255,246,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,246,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,246,0,0,0,50,255,236,0,0,0,0,0,0,0,0,0,20,0,0,255,236,0,40,0,20,0,0,0,0,0,0,0,2,114,188,0,4,0,0,122,222,171,112,0,1,0,3,0,0,255,226,255,236,0,1,118,242,119,20,0,3,0,12,1,34,0,69,0,1,1,174,0,1,1,180,0,1,1,174,0,1,1,174,0,1,1,186,0,1,1,174,0,1,1,174,0,1,1,192,0,1,1,198,0,1,1,204,0,1,1,210,0,1,1,216,0,1,1,174,0,1,1,174,0,1,1,222,0,1,1,186,0,1,1,186,0,1,1,186,0,1,1,186,0,1,1,186,0,1,1,186,0,1,1,186,0,1,1,228,0,1,1,234,0,1,1,240,0,1,1,246,0,0,1,138,0,0,1,144,0,0,1,150,0,0,1,156,0,0,1,144,0,0,1,162,0,2,2,104,0,1,1,252,0,1,1,252,0,1,2,2,0,1,1,252,0,1,2,8,0,1,2,14,0,1,2,20,0,1,2,26,0,1,1,252,0,1,1,252,0,1,2,32,0,1,2,38,0,1,2,8,0,1,2,8,0,1,2,8,0,1,2,44,0,1,2,8,0,1,2,8,0,1,2,8,0,1,2,50,0,2,2,104,0,1,2,56,0,1,2,62,0,1,2,68,0,1,1,174,0,0,1,168,0,1,2,74,0,1,2,80,0,1,1,174,0,1,1,228,0,1,1,228,0,1,1,228,0,1,2,86,0,1,2,92,0,1,2,98,0,1,1,174,0,19,1,88,1,94,2,30,1,100,1,106,2,30,1,88,1,94,2,30,1,112,1,118,2,30,1,124,1,130,2,30,1,136,1,142,2,30,1,148,1,154,2,30,1,160,1,172,1,166,1,178,1,184,2,30,1,190,1,196,2,30,1,202,1,208,2,30,1,214,1,220,2,30,1,226,1,232,2,30,1,238,1,244,2,30,1,238,1,250,2,30,2,0,2,6,2,30,2,0,2,12,2,30,1,124,2,18,2,30,1,124,2,24,2,30,0,1,255,60,0,0,0,1,255,57,0,0,0,1,255,55,0,0,0,1,255,42,0,0,0,1,255,58,0,0,0,1,255,97,0,0,0,1,255,57,1,196,0,1,255,56,1,26,0,1,255,58,1,196,0,1,255,56,1,196,0,1,255,86,1,196,0,1,255,43,1,196,0,1,255,46,1,216,0,1,255,51,1,217,0,1,255,51,1,216,0,1,255,56,1,216,0,1,255,90,1,196,0,1,255,78,1,196,0,1,255,175,1,196,0,1,255,57,2,125,0,1,255,58,2,140,0,1,255,58,2,125,0,1,255,69,2,135,0,1,255,75,2,125,0,1,255,58,2,135,0,1,255,57,2,135,0,1,255,56,2,135,0,1,255,58,2,130,0,1,255,140,2,135,0,1,255,74,1,206,0,1,255,63,1,216,0,1,255,164,1,196,0,1,255,64,1,196,0,1,255,57,1,197,0,1,255,51,1,196,0,1,255,50,1,196,0,1,255,60,1,196,0,1,255,23,0,243,0,1,1,15,0,0,0,1,1,41,1,241,0,1,0,248,0,0,0,1,1,4,1,216,0,1,0,243,0,0,0,1,1,2,2,125,0,1,1,27,0,0,0,1,1,47,1,241,0,1,1,104,0,0,0,1,1,105,2,135,0,1,1,67,0,0,0,1,1,67,1,241,0,1,4,58,0,0,0,1,2,206,0,236,0,1,4,58,1,196,0,1,0,237,0,0,0,1,0,237,1,241,0,1,0,226,0,0,0,1,0,226,1,241,0,1,1,165,0,0,0,1,1,165,1,241,0,1,1,145,0,0,0,1,1,145,2,125,0,1,3,105,255,114,0,1,3,109,1,74,0,1,1,78,0,0,0,1,1,110,3,40,0,1,1,111,3,52,0,1,0,244,255,41,0,1,0,255,2,107,0,1,1,7,1,196,0,1,1,47,2,152,0,1,1,47,2,141,0,1,0,0,0,0,0,1,115,248,116,14,0,5,0,12,1,42,0,71,0,2,8,132,0,2,8,138,0,2,8,132,0,2,8,132,0,2,8,144,0,2,8,132,0,2,8,132,0,2,8,150,0,2,8,156,0,2,8,162,0,2,8,168,0,2,8,174,0,2,8,132,0,2,8,132,0,2,8,180,0,2,8,144,0,2,8,144,0,2,8,144,0,2,8,144,0,2,8,144,0,2,8,144,0,2,8,144,0,2,8,186,0,2,8,192,0,2,8,198,0,2,8,204,0,4,9,68,0,0,8,90,0,0,8,96,0,0,8,102,0,0,8,108,0,1,8,126,0,0,8,96,0,0,8,114,0,3,9,62,0,2,8,210,0,2,8,210,0,2,8,216,0,2,8,210,0,2,8,222,0,2,8,228,0,2,8,234,0,2,8,240,0,2,8,210,0,2,8,210,0,2,8,246,0,2,8,252,0,2,8,222,0,2,8,222,0,2,8,222,0,2,9,2,0,2,8,222,0,2,8,222,0,2,8,222,0,2,9,8,0,3,9,62,0,2,9,14,0,2,9,20,0,2,9,26,0,2,8,132,0,0,8,120,0,2,9,32,0,2,9,38,0,2,8,132,0,2,8,186,0,2,8,186,0,2,8,186,0,2,9,44,0,2,9,50,0,2,9,56,0,2,8,132,0,185,8,44,8,50,8,56,13,198,13,198,8,62,13,198,8,68,13,198,13,198,13,198,13,198,8,80,8,74,13,198,13,198,13,198,8,86,8,74,13,198,8,92,8,98,8,104,13,198,13,198,8,92,8,98,8,110,13,198,13,198,8,92,8,98,8,116,13,198,13,198,13,198,13,198,8,122,13,198,13,198,8,128,13,198,8,134,13,198,13,198,13,198,13,198,8,140,13,198,13,198,13,198,13,198,8,140,13,198,13,198,13,198,13,198,8,146,13,198,13,198,13,198,13,198,8,152,13,198,13,198,13,198,13,198,8,158,13,198,13,198,8,164,13,198,8,170,13,198,13,198,8,176,13,198,8,140,8,182,13,198,8,188,8,200,8,206,8,194,8,212,8,218,13,198,8,224,13,198,13,198,8,230,13,198,8,68,13,198,13,198,8,236,13,198,8,248,8,242,13,198,13,198,13,198,8,254,13,198,13,198,13,198,13,198,8,254,13,198,13,198,9,4,13,198,9,10,13,198,13,198,13,198,13,198,9,16,13,198,13,198,9,22,9,28,9,34,13,198,13,198,9,40,13,198,9,46,13,198,13,198,9,52,13,198,9,58,13,198,13,198,9,64,9,70,9,76,13,198,13,198,9,64,9,70,9,82,13,198,13,198,9,88,13,198,9,94,13,198,13,198,13,198,13,198,9,100,13,198,13,198,13,198,13,198,9,106,13,198,13,198,9,112,13,198,8,80,13,198,13,198,9,118,13,198,9,130,9,124,13,198,9,136,13,198,9,142,13,198,13,198,9,148,13,198,9,160,9,154,13,198,9,148,13,198,9,160,9,154,13,198,13,198,13,198,9,166,13,198,13,198,9,64,9,70,9,76,13,198,13,198,13,198,13,198,8,122,13,198,13,198,13,198,13,198,9,166,13,198,13,198,8,44,8,50,8,56,13,198,13,198,8,44,8,50,9,172,13,198,13,198,13,198,13,198,9,178,13,198,13,198,8,92,8,98,8,104,13,198,13,198,9,184,13,198,9,190,13,198,13,198,13,198,13,198,9,196,13,198,13,198,8,128,13,198,9,202,13,198,13,198,13,198,13,198,9,208,13,198,13,198,13,198,13,198,9,214,13,198,13,198,8,188,8,200,9,220,8,194,8,212,13,198,13,198,9,226,13,198,13,198,13,198,13,198,9,232,13,198,13,198,13,198,13,198,9,238,13,198,13,198,13,198,13,198,9,244,13,198,13,198,9,22,9,28,9,250,13,198,13,198,10,0,13,198,10,6,13,198,13,198,10,12,13,198,10,18,13,198,13,198,10,24,13,198,10,30,13,198,13,198,9,112,13,198,8,80,13,198,13,198,10,36,13,198,8,68,13,198,13,198,10,42,10,48,10,54,13,198,13,198,13,198,13,198,10,60,13,198,13,198,13,198,13,198,10,66,13,198,13,198,10,72,10,78,10,84,13,198,13,198,10,72,10,78,10,90,13,198,13,198,10,72,10,78,10,96,13,198,13,198,13,198,13,198,10,102,13,198,13,198,10,108,13,198,10,114,13,198,13,198,13,198,13,198,10,120,13,198,13,198,13,198,13,198,10,126,13,198,13,198,13,198,13,198,10,132,13,198,13,198,13,198,13,198,10,138,13,198,13,198,13,198,13,198,10,144,13,198,13,198,10,150,10,162,10,168,10,156,10,174,10,180,13,198,10,186,13,198,13,198,10,192,13,198,10,198,13,198,13,198,10,204,13,198,10,210,13,198,13,198,10,204,13,198,10,210,13,198,13,198,10,216,13,198,10,222,13,198,13,198,13,198,13,198,10,228,13,198,13,198,10,234,10,240,10,246,13,198,13,198,10,252,13,198,11,2,13,198,13,198,13,198,13,198,11,8,13,198,13,198,11,14,11,20,11,26,13,198,13,198,11,14,11,32,11,38,13,198,13,198,11,44,13,198,11,50,13,198,13,198,11,56,13,198,11,68,11,62,13,198,13,198,13,198,11,74,13,198,13,198,13,198,13,198,11,80,13,198,13,198,13,198,13,198,11,86,13,198,13,198,13,198,13,198,11,92,13,198,13,198,13,198,13,198,11,98,13,198,13,198,10,108,13,198,10,114,13,198,13,198,13,198,13,198,10,138,13,198,13,198,10,192,13,198,10,198,13,198,13,198,13,198,13,198,13,198,11,104,13,198,13,198,13,198,13,198,11,104,13,198,10,216,13,198,10,222,13,198,13,198,13,198,13,198,11,80,13,198,13,198,11,110,13,198,11,122,11,116,13,198,13,198,13,198,10,102,13,198,13,198,10,42,10,48,10,54,13,198,13,198,10,42,10,48,11,128,13,198,13,198,13,198,13,198,11,134,13,198,13,198,10,72,10,78,10,84,13,198,13,198,11,140,11,146,11,152,13,198,13,198,13,198,13,198,11,158,13,198,13,198,10,108,13,198,11,164,13,198,13,198,13,198,13,198,11,170,13,198,13,198,13,198,13,198,11,176,13,198,13,198,10,150,10,162,11,182,10,156,10,174,13,198,13,198,11,86,13,198,13,198,10,204,13,198,11,188,13,198,13,198,10,204,13,198,11,194,13,198,13,198,10,204,13,198,11,200,13,198,13,198,13,198,13,198,11,206,13,198,13,198,13,198,13,198,11,212,13,198,13,198,10,234,10,240,11,218,13,198,13,198,11,224,13,198,11,230,13,198,13,198,11,236,13,198,11,242,13,198,13,198,10,108,13,198,10,114,13,198,13,198,11,248,13,198,10,198,13,198,13,198,11,254,12,4,12,10,13,198,13,198,8,62,13,198,8,68,13,198,13,198,13,198,13,198,12,16,13,198,13,198,13,198,13,198,12,22,13,198,13,198,12,28,12,34,12,40,13,198,13,198,12,28,12,34,12,46,13,198,13,198,12,28,12,34,12,52,13,198,13,198,13,198,13,198,12,58,13,198,13,198,12,64,13,198,12,70,13,198,13,198,13,198,13,198,12,76,13,198,13,198,13,198,13,198,12,76,13,198,13,198,13,198,13,198,12,82,13,198,13,198,13,198,13,198,12,88,13,198,13,198,13,198,13,198,12,94,13,198,13,198,12,100,13,198,12,106,13,198,13,198,12,112,13,198,12,124,12,118,13,198,12,130,8,50,12,142,12,136,12,148,12,154,13,198,12,160,13,198,13,198,9,4,13,198,12,166,13,198,13,198,12,172,13,198,12,184,12,178,13,198,12,190,13,198,12,202,12,196,13,198,12,190,13,198,12,202,12,196,13,198,9,4,13,198,9,10,13,198,13,198,13,198,13,198,12,208,13,198,13,198,12,214,12,220,12,226,13,198,13,198,12,232,13,198,12,238,13,198,13,198,12,244,13,198,12,250,13,198,13,198,13,0,13,6,13,12,13,198,13,198,13,0,13,6,13,18,13,198,13,198,13,24,13,198,13,30,13,198,13,198,13,198,13,198,13,36,13,198,13,198,13,198,13,198,13,42,13,198,13,198,13,48,13,198,13,54,13,198,13,198,13,60,13,198,13,72,13,66,13,198,9,148,13,198,13,78,13,198,13,198,12,190,13,198,12,202,12,196,13,198,12,190,13,198,12,202,12,196,13,198,13,198,13,198,13,84,13,198,13,198,12,112,13,198,12,124,12,118,13,198,13,0,13,6,13,12,13,198,13,198,13,198,13,198,12,58,13,198,13,198,13,198,13,198,13,84,13,198,13,198,11,254,12,4,12,10,13,198,13,198,11,254,12,4,13,90,13,198,13,198,13,96,13,198,13,102,13,198,13,198,12,28,12,34,12,40,13,198,13,198,13,108,13,198,13,114,13,198,13,198,13,198,13,198,13,120,13,198,13,198,12,64,13,198,13,126,13,198,13,198,13,198,13,198,13,132,13,198,13,198,13,198,13,198,13,138,13,198,13,198,12,130,8,50,13,144,12,136,12,148,12,190,13,198,13,150,12,196,13,198,12,190,13,198,13,156,12,196,13,198,12,190,13,198,13,162,12,196,13,198,13,198,13,198,13,168,13,198,13,198,12,214,12,220,13,174,13,198,13,198,10,0,13,198,10,6,13,198,13,198,13,180,13,198,13,186,13,198,13,198,10,24,13,198,10,30,13,198,13,198,13,48,13,198,13,54,13,198,13,198,13,192,13,198,12,166,13,198,13,198,0,1,255,60,0,0,0,1,255,57,0,0,0,1,255,55,0,0,0,1,255,42,0,0,0,1,255,58,0,0,0,1,255,97,0,0,0,1,255,91,0,40,0,1,255,57,1,196,0,1,255,56,1,26,0,1,255,58,1,196,0,1,255,56,1,196,0,1,255,86,1,196,0,1,255,43,1,196,0,1,255,46,1,216,0,1,255,51,1,217,0,1,255,51,1,216,0,1,255,56,1,216,0,1,255,90,1,196,0,1,255,78,1,196,0,1,255,175,1,196,0,1,255,57,2,125,0,1,255,58,2,140,0,1,255,58,2,125,0,1,255,69,2,135,0,1,255,75,2,125,0,1,255,58,2,135,0,1,255,57,2,135,0,1,255,56,2,135,0,1,255,58,2,130,0,1,255,140,2,135,0,1,255,74,1,206,0,1,255,63,1,216,0,1,255,164,1,196,0,1,255,64,1,196,0,1,255,57,1,197,0,1,255,51,1,196,0,1,255,50,1,196,0,1,255,60,1,196,0,1,255,23,0,243,0,1,255,116,1,196,0,1,1,36,0,0,0,1,2,14,0,10,0,1,1,36,2,125,0,1,1,74,0,0,0,1,1,79,2,135,0,1,0,220,1,55,0,1,1,25,2,125,0,1,1,25,2,249,0,1,1,62,0,0,0,1,2,12,0,40,0,1,1,70,2,135,0,1,1,20,3,73,0,1,1,70,3,50,0,1,1,201,2,125,0,1,0,251,0,0,0,1,1,14,2,125,0,1,1,121,2,125,0,1,1,71,3,63,0,1,1,83,2,125,0,1,1,83,2,249,0,1,1,146,0,0,0,1,1,162,2,135,0,1,1,121,0,0,0,1,1,121,1,63,0,1,1,90,0,0,0,1,1,90,1,63,0,1,2,111,0,10,0,1,1,90,2,125,0,1,2,160,2,125,0,1,0,200,0,0,0,1,1,61,2,135,0,1,1,58,0,0,0,1,1,17,0,0,0,1,1,17,1,68,0,1,1,17,2,125,0,1,1,53,2,125,0,1,1,15,0,0,0,1,1,134,2,135,0,1,1,35,2,125,0,1,2,151,0,0,0,1,2,214,0,40,0,1,1,166,2,124,0,1,0,245,0,0,0,1,1,19,2,125,0,1,1,36,255,246,0,1,1,56,2,125,0,1,0,181,0,0,0,1,0,244,0,40,0,1,0,181,2,125,0,1,0,181,3,40,0,1,0,143,0,0,0,1,0,168,2,135,0,1,1,48,2,125,0,1,1,222,2,125,0,1,1,5,0,0,0,1,1,110,0,0,0,1,1,110,1,63,0,1,1,110,2,125,0,1,1,69,0,0,0,1,1,90,2,135,0,1,1,13,0,0,0,1,1,11,0,181,0,1,1,23,2,125,0,1,1,47,2,125,0,1,1,36,3,40,0,1,1,243,2,135,0,1,1,70,0,0,0,1,1,70,2,125,0,1,1,201,3,40,0,1,1,14,3,40,0,1,1,121,2,233,0,1,1,121,3,40,0,1,1,90,3,40,0,1,1,53,2,233,0,1,1,53,3,40,0,1,1,104,3,59,0,1,1,35,3,40,0,1,1,166,3,39,0,1,1,167,0,0,0,1,1,77,2,135,0,1,1,239,0,0,0,1,2,6,2,135,0,1,0,182,0,0,0,1,1,62,2,135,0,1,1,67,255,23,0,1,0,227,0,0,0,1,1,162,0,41,0,1,0,215,1,196,0,1,0,230,1,196,0,1,0,230,2,203,0,1,1,8,0,0,0,1,1,139,0,41,0,1,1,2,1,196,0,1,0,230,2,202,0,1,1,2,2,107,0,1,1,120,1,196,0,1,0,214,0,0,0,1,0,214,1,196,0,1,1,38,1,196,0,1,1,45,1,196,0,1,1,10,2,202,0,1,1,5,1,196,0,1,1,5,2,203,0,1,0,253,0,0,0,1,0,253,0,226,0,1,1,66,0,40,0,1,0,253,1,196,0,1,1,226,1,196,0,1,1,120,0,0,0,1,1,31,1,196,0,1,0,252,0,0,0,1,1,8,1,196,0,1,1,71,0,0,0,1,0,227,1,196,0,1,0,194,0,0,0,1,0,211,1,196,0,1,0,217,1,196,0,1,2,32,0,0,0,1,2,111,0,49,0,1,1,78,1,196,0,1,0,201,0,0,0,1,0,201,1,196,0,1,0,228,1,196,0,1,0,159,0,0,0,1,0,159,0,49,0,1,0,136,1,216,0,1,0,238,0,49,0,1,0,137,2,107,0,1,0,243,0,0,0,1,0,125,1,207,0,1,1,3,0,0,0,1,1,13,0,226,0,1,0,131,2,178,0,1,1,87,1,196,0,1,0,240,1,196,0,1,0,255,1,196,0,1,0,224,1,196,0,1,1,121,1,196,0,1,0,218,0,4,0,1,1,1,0,0,0,1,1,11,0,226,0,1,0,129,2,178,0,1,0,215,2,107,0,1,1,94,1,216,0,1,0,193,0,0,0,1,0,56,1,155,0,1,0,187,1,196,0,1,1,120,2,107,0,1,0,214,2,107,0,1,1,38,2,121,0,1,1,38,2,107,0,1,0,253,2,107,0,1,0,227,2,121,0,1,0,227,2,107,0,1,0,227,2,193,0,1,0,217,2,107,0,1,0,200,1,196,0,1,1,78,2,107,0,1,0,149,0,0,0,1,1,16,1,196,0,1,1,89,0,0,0,1,1,138,1,196,0,1,1,5,255,23,0,1,0,255,0,0,0,1,1,203,0,10,0,1,0,255,1,241,0,1,0,244,1,242,0,1,0,244,2,249,0,1,0,254,0,0,0,1,1,134,0,32,0,1,1,0,1,241,0,1,0,228,2,247,0,1,1,0,2,152,0,1,1,135,1,242,0,1,0,219,0,0,0,1,0,234,1,242,0,1,1,64,1,242,0,1,1,36,2,248,0,1,1,35,1,242,0,1,1,35,2,249,0,1,1,102,0,0,0,1,1,102,1,241,0,1,1,64,0,0,0,1,1,64,0,249,0,1,1,64,1,241,0,1,1,37,0,0,0,1,1,37,0,249,0,1,1,37,1,241,0,1,2,53,1,241,0,1,0,240,0,0,0,1,0,240,1,241,0,1,1,41,1,241,0,1,0,237,0,0,0,1,0,237,0,249,0,1,0,237,1,241,0,1,0,238,0,0,0,1,0,231,0,181,0,1,0,238,1,241,0,1,0,255,1,242,0,1,2,68,0,0,0,1,2,195,0,10,0,1,1,115,1,241,0,1,0,230,0,0,0,1,0,230,1,241,0,1,0,251,255,249,0,1,1,11,1,242,0,1,0,160,0,0,0,1,1,31,0,10,0,1,0,162,1,241,0,1,0,162,2,152,0,1,0,146,0,0,0,1,0,146,1,241,0,1,1,6,1,242,0,1,1,146,1,242,0,1,0,226,0,0,0,1,0,243,1,242,0,1,1,57,0,0,0,1,1,57,0,249,0,1,1,57,1,242,0,1,1,30,1,249,0,1,0,253,1,242,0,1,0,255,2,152,0,1,1,94,0,0,0,1,1,195,1,241,0,1,1,66,0,0,0,1,1,66,2,101,0,1,1,135,2,153,0,1,0,234,2,153,0,1,1,64,2,167,0,1,1,64,2,153,0,1,1,37,2,152,0,1,0,238,2,166,0,1,0,238,2,152,0,1,0,238,2,238,0,1,0,255,2,153,0,1,1,115,2,152,0,1,1,141,0,0,0,1,1,141,1,241,0,1,1,24,255,23,0,1,0,0,0,0,0,1,101,2,102,72,0,5,0,12,1,42,0,71,0,2,21,234,0,2,21,240,0,2,21,234,0,2,21,234,0,2,21,246,0,2,21,234,0,2,21,234,0,2,21,252,0,2,22,2,0,2,22,8,0,2,22,14,0,2,22,20,0,2,21,234,0,2,21,234,0,2,22,26,0,2,21,246,0,2,21,246,0,2,21,246,0,2,21,246,0,2,21,246,0,2,21,246,0,2,21,246,0,2,22,32,0,2,22,38,0,2,22,44,0,2,22,50,0,4,22,170,0,0,21,192,0,0,21,198,0,0,21,204,0,0,21,210,0,1,21,228,0,0,21,198,0,0,21,216,0,3,22,164,0,2,22,56,0,2,22,56,0,2,22,62,0,2,22,56,0,2,22,68,0,2,22,74,0,2,22,80,0,2,22,86,0,2,22,56,0,2,22,56,0,2,22,92,0,2,22,98,0,2,22,68,0,2,22,68,0,2,22,68,0,2,22,104,0,2,22,68,0,2,22,68,0,2,22,68,0,2,22,110,0,3,22,164,0,2,22,116,0,2,22,122,0,2,22,128,0,2,21,234,0,0,21,222,0,2,22,134,0,2,22,140,0,2,21,234,0,2,22,32,0,2,22,32,0,2,22,32,0,2,22,146,0,2,22,152,0,2,22,158,0,2,21,234,2,16,21,146,21,152,21,158,33,206,33,206,21,164,33,206,21,170,33,206,33,206,33,206,33,206,33,206,21,176,33,206,21,182,21,188,21,194,33,206,33,206,21,200,33,206,21,206,33,206,33,206,21,212,33,206,21,224,21,218,33,206,21,230,33,206,21,236,33,206,33,206,21,242,21,248,21,254,33,206,33,206,22,4,33,206,22,10,33,206,33,206,22,16,33,206,22,22,33,206,33,206,22,28,33,206,22,34,33,206,33,206,22,40,22,52,22,58,22,46,22,64,22,70,33,206,22,76,33,206,33,206,22,82,33,206,22,94,22,88,33,206,33,206,33,206,22,100,33,206,33,206,22,106,33,206,22,112,33,206,33,206,22,118,22,124,22,130,33,206,33,206,22,136,33,206,22,142,33,206,33,206,22,148,22,154,22,160,33,206,33,206,22,166,22,172,22,178,33,206,33,206,22,184,33,206,22,196,22,190,33,206,22,202,22,208,22,214,33,206,33,206,22,220,22,232,22,238,22,226,22,244,33,206,33,206,22,250,33,206,33,206,23,0,33,206,23,6,33,206,33,206,21,242,21,248,23,12,33,206,33,206,33,206,33,206,23,18,33,206,33,206,22,4,33,206,22,10,33,206,33,206,22,148,22,154,23,24,33,206,33,206,22,148,22,154,23,30,33,206,33,206,23,36,23,42,23,48,33,206,33,206,23,54,23,60,23,66,33,206,33,206,23,72,23,78,23,84,33,206,33,206,23,90,23,96,23,102,33,206,33,206,23,108,23,114,23,120,33,206,33,206,23,126,23,132,23,138,33,206,33,206,22,148,22,154,23,144,33,206,33,206,22,148,22,154,23,150,33,206,33,206,21,146,21,152,23,156,33,206,33,206,21,146,21,152,23,162,33,206,33,206,21,146,21,152,21,158,33,206,33,206,22,148,22,154,22,160,33,206,33,206,22,148,22,154,23,30,33,206,33,206,23,36,23,42,23,48,33,206,33,206,23,54,23,60,23,66,33,206,33,206,23,72,23,78,23,84,33,206,33,206,23,90,23,96,23,102,33,206,33,206,23,108,23,114,23,120,33,206,33,206,23,126,23,132,23,138,33,206,33,206,23,168,23,174,23,180,33,206,33,206,23,186,23,192,23,198,33,206,33,206,23,204,23,210,23,216,33,206,33,206,23,222,23,228,23,234,33,206,33,206,23,240,23,246,23,252,33,206,33,206,24,2,24,8,24,14,33,206,33,206,24,20,24,26,24,32,33,206,33,206,22,166,22,172,24,38,33,206,33,206,24,44,33,206,23,180,24,50,33,206,24,56,33,206,23,198,24,62,33,206,24,68,33,206,23,216,24,74,33,206,24,80,33,206,23,234,24,86,33,206,24,92,33,206,23,252,24,98,33,206,24,104,33,206,24,14,24,110,33,206,24,116,33,206,24,128,24,122,33,206,24,134,33,206,24,146,24,140,33,206,24,152,33,206,24,32,24,158,33,206,22,184,33,206,24,38,22,190,33,206,21,212,33,206,21,224,21,218,33,206,24,44,33,206,24,164,24,50,33,206,24,56,33,206,23,198,24,62,33,206,24,68,33,206,23,216,24,74,33,206,24,80,33,206,23,234,24,86,33,206,24,92,33,206,23,252,24,98,33,206,24,104,33,206,24,14,24,110,33,206,24,116,33,206,24,128,24,122,33,206,24,134,33,206,24,146,24,140,33,206,24,170,24,176,23,180,33,206,33,206,24,182,24,188,23,198,33,206,33,206,22,16,24,194,23,216,33,206,33,206,24,200,24,206,23,234,33,206,33,206,24,212,24,218,23,252,33,206,33,206,24,224,22,124,24,14,33,206,33,206,22,4,24,230,24,128,33,206,33,206,24,236,24,242,24,146,33,206,33,206,24,248,24,254,24,32,33,206,33,206,22,202,22,208,24,38,33,206,33,206,21,242,21,248,25,4,33,206,33,206,21,242,21,248,25,10,33,206,33,206,25,16,25,28,25,34,25,22,25,40,24,200,25,52,25,58,25,46,25,64,25,70,25,82,25,88,25,76,25,94,25,100,25,112,25,118,25,106,25,124,25,130,25,142,25,148,25,136,25,154,25,160,25,172,25,178,25,166,25,184,24,224,25,196,25,202,25,190,25,208,22,220,22,232,25,214,22,226,22,244,25,220,33,206,23,198,33,206,33,206,33,206,33,206,25,226,33,206,33,206,33,206,33,206,25,232,33,206,33,206,33,206,33,206,25,238,33,206,33,206,33,206,33,206,25,244,33,206,33,206,33,206,33,206,25,250,33,206,33,206,33,206,33,206,26,0,33,206,33,206,33,206,33,206,26,6,33,206,33,206,33,206,33,206,26,12,33,206,33,206,26,18,33,206,26,24,33,206,33,206,26,30,33,206,26,36,33,206,33,206,26,42,33,206,26,48,33,206,33,206,26,54,33,206,26,60,33,206,33,206,26,66,33,206,26,72,33,206,33,206,26,78,33,206,26,84,33,206,33,206,26,90,33,206,26,96,33,206,33,206,26,102,33,206,26,108,33,206,33,206,26,114,33,206,26,120,33,206,33,206,23,0,33,206,26,126,33,206,33,206,22,136,33,206,22,142,33,206,33,206,26,18,33,206,26,132,33,206,33,206,26,30,33,206,26,36,33,206,33,206,26,42,33,206,26,48,33,206,33,206,26,54,33,206,26,60,33,206,33,206,26,66,33,206,26,72,33,206,33,206,26,78,33,206,26,84,33,206,33,206,26,90,33,206,26,96,33,206,33,206,26,102,33,206,26,108,33,206,33,206,22,148,22,154,26,138,33,206,33,206,26,144,26,150,26,156,33,206,33,206,22,148,22,154,23,30,33,206,33,206,23,36,23,42,23,48,33,206,33,206,23,54,23,60,23,66,33,206,33,206,23,72,23,78,23,84,33,206,33,206,23,90,23,96,23,102,33,206,33,206,23,108,23,114,23,120,33,206,33,206,23,126,23,132,23,138,33,206,33,206,21,212,33,206,26,162,21,218,33,206,24,44,33,206,26,168,24,50,33,206,24,56,33,206,23,198,24,62,33,206,24,68,33,206,23,216,24,74,33,206,24,80,33,206,23,234,24,86,33,206,24,92,33,206,23,252,24,98,33,206,24,104,33,206,24,14,24,110,33,206,24,116,33,206,24,128,24,122,33,206,24,134,33,206,24,146,24,140,33,206,22,136,33,206,26,174,33,206,33,206,26,18,33,206,26,180,33,206,33,206,26,30,33,206,26,36,33,206,33,206,26,42,33,206,26,48,33,206,33,206,26,54,33,206,26,60,33,206,33,206,26,66,33,206,26,72,33,206,33,206,26,78,33,206,26,84,33,206,33,206,26,90,33,206,26,96,33,206,33,206,26,102,33,206,26,108,33,206,33,206,26,186,33,206,26,192,33,206,33,206,33,206,33,206,26,198,33,206,33,206,26,204,33,206,26,210,33,206,33,206,33,206,33,206,26,216,33,206,33,206,33,206,33,206,26,222,33,206,33,206,33,206,33,206,26,228,33,206,33,206,33,206,33,206,26,234,33,206,33,206,26,240,33,206,26,246,33,206,33,206,33,206,33,206,26,216,33,206,33,206,33,206,33,206,26,252,33,206,33,206,33,206,33,206,26,216,33,206,33,206,33,206,33,206,26,234,33,206,33,206,33,206,33,206,27,2,33,206,33,206,33,206,33,206,26,234,33,206,33,206,33,206,33,206,26,222,33,206,33,206,26,240,33,206,26,246,33,206,33,206,26,186,33,206,26,192,33,206,33,206,33,206,33,206,26,198,33,206,33,206,26,204,33,206,26,210,33,206,33,206,26,186,33,206,27,8,33,206,33,206,26,186,33,206,27,14,33,206,33,206,26,186,33,206,27,20,33,206,33,206,26,186,33,206,27,26,33,206,33,206,26,186,33,206,27,32,33,206,33,206,26,186,33,206,27,38,33,206,33,206,26,186,33,206,27,44,33,206,33,206,26,186,33,206,27,50,33,206,33,206,26,186,33,206,27,56,33,206,33,206,26,186,33,206,27,62,33,206,33,206,26,186,33,206,26,192,33,206,33,206,26,186,33,206,27,68,33,206,33,206,26,186,33,206,27,74,33,206,33,206,26,186,33,206,26,192,33,206,33,206,26,186,33,206,27,56,33,206,33,206,26,186,33,206,27,62,33,206,33,206,26,186,33,206,27,8,33,206,33,206,26,186,33,206,27,14,33,206,33,206,26,186,33,206,27,20,33,206,33,206,26,186,33,206,27,26,33,206,33,206,26,186,33,206,27,32,33,206,33,206,26,186,33,206,27,38,33,206,33,206,26,186,33,206,27,44,33,206,33,206,26,186,33,206,27,50,33,206,33,206,26,186,33,206,26,192,33,206,33,206,33,206,33,206,27,80,33,206,33,206,33,206,33,206,27,86,33,206,33,206,33,206,33,206,27,92,33,206,33,206,33,206,33,206,27,98,33,206,33,206,33,206,33,206,27,104,33,206,33,206,33,206,33,206,27,110,33,206,33,206,33,206,33,206,27,116,33,206,33,206,33,206,33,206,27,122,33,206,33,206,26,204,33,206,27,128,33,206,33,206,26,204,33,206,27,134,33,206,33,206,26,204,33,206,27,140,33,206,33,206,26,204,33,206,27,146,33,206,33,206,26,204,33,206,27,152,33,206,33,206,26,204,33,206,27,158,33,206,33,206,26,204,33,206,27,164,33,206,33,206,26,204,33,206,27,170,33,206,33,206,26,204,33,206,27,176,33,206,33,206,26,204,33,206,27,182,33,206,33,206,26,204,33,206,26,210,33,206,33,206,26,204,33,206,26,210,33,206,33,206,26,204,33,206,27,176,33,206,33,206,26,204,33,206,27,182,33,206,33,206,26,204,33,206,27,128,33,206,33,206,26,204,33,206,27,134,33,206,33,206,26,204,33,206,27,140,33,206,33,206,26,204,33,206,27,146,33,206,33,206,26,204,33,206,27,152,33,206,33,206,26,204,33,206,27,158,33,206,33,206,26,204,33,206,27,164,33,206,33,206,26,204,33,206,27,170,33,206,33,206,26,204,33,206,26,210,33,206,33,206,33,206,33,206,27,188,33,206,33,206,33,206,33,206,27,194,33,206,33,206,33,206,33,206,27,200,33,206,33,206,33,206,33,206,27,206,33,206,33,206,33,206,33,206,27,212,33,206,33,206,33,206,33,206,27,218,33,206,33,206,33,206,33,206,27,224,33,206,33,206,33,206,33,206,27,230,33,206,33,206,33,206,33,206,27,236,33,206,33,206,33,206,33,206,27,242,33,206,33,206,33,206,33,206,26,216,33,206,33,206,33,206,33,206,27,248,33,206,33,206,33,206,33,206,27,254,33,206,33,206,33,206,33,206,26,216,33,206,33,206,33,206,33,206,26,216,33,206,33,206,33,206,33,206,26,216,33,206,33,206,33,206,33,206,28,4,33,206,33,206,33,206,33,206,28,10,33,206,33,206,33,206,33,206,28,16,33,206,33,206,33,206,33,206,28,22,33,206,33,206,33,206,33,206,28,28,33,206,33,206,33,206,33,206,28,34,33,206,33,206,33,206,33,206,28,40,33,206,33,206,33,206,33,206,28,46,33,206,33,206,33,206,33,206,28,52,33,206,33,206,33,206,33,206,28,58,33,206,33,206,33,206,33,206,28,64,33,206,33,206,33,206,33,206,28,70,33,206,33,206,33,206,33,206,28,76,33,206,33,206,33,206,33,206,28,82,33,206,33,206,33,206,33,206,28,88,33,206,33,206,33,206,33,206,28,94,33,206,33,206,33,206,33,206,28,100,33,206,33,206,33,206,33,206,28,106,33,206,33,206,33,206,33,206,28,112,33,206,33,206,33,206,33,206,28,118,33,206,33,206,33,206,33,206,26,234,33,206,33,206,33,206,33,206,28,124,33,206,33,206,33,206,33,206,28,130,33,206,33,206,33,206,33,206,26,234,33,206,33,206,33,206,33,206,26,234,33,206,33,206,33,206,33,206,26,234,33,206,33,206,26,240,33,206,28,136,33,206,33,206,26,240,33,206,28,142,33,206,33,206,26,240,33,206,28,148,33,206,33,206,26,240,33,206,28,154,33,206,33,206,26,240,33,206,28,160,33,206,33,206,26,240,33,206,28,166,33,206,33,206,26,240,33,206,28,172,33,206,33,206,26,240,33,206,28,178,33,206,33,206,26,240,33,206,28,184,33,206,33,206,26,240,33,206,28,190,33,206,33,206,26,240,33,206,26,246,33,206,33,206,26,240,33,206,26,246,33,206,33,206,26,240,33,206,28,184,33,206,33,206,26,240,33,206,28,190,33,206,33,206,26,240,33,206,28,136,33,206,33,206,26,240,33,206,28,142,33,206,33,206,26,240,33,206,28,148,33,206,33,206,26,240,33,206,28,154,33,206,33,206,26,240,33,206,28,160,33,206,33,206,26,240,33,206,28,166,33,206,33,206,26,240,33,206,28,172,33,206,33,206,26,240,33,206,28,178,33,206,33,206,26,240,33,206,26,246,33,206,33,206,28,196,28,202,28,208,33,206,33,206,21,164,33,206,21,170,33,206,33,206,28,214,28,220,28,226,33,206,33,206,28,232,33,206,28,238,33,206,33,206,28,244,33,206,29,0,28,250,33,206,29,6,29,12,29,18,33,206,33,206,22,4,33,206,22,10,33,206,33,206,29,24,33,206,29,30,33,206,33,206,29,36,33,206,29,42,33,206,33,206,29,48,21,152,29,60,29,54,29,66,22,70,33,206,29,72,33,206,33,206,29,78,33,206,29,90,29,84,33,206,33,206,33,206,29,96,33,206,33,206,22,106,33,206,22,112,33,206,33,206,29,102,33,206,29,108,33,206,33,206,29,6,29,12,29,18,33,206,33,206,29,6,29,12,29,114,33,206,33,206,29,6,29,12,29,120,33,206,33,206,33,206,33,206,29,96,33,206,33,206,33,206,33,206,29,126,33,206,33,206,33,206,33,206,29,96,33,206,33,206,29,48,21,152,29,60,29,54,29,66,29,102,33,206,29,108,33,206,33,206,28,196,28,202,28,208,33,206,33,206,28,214,28,220,28,226,33,206,33,206,28,244,33,206,29,0,28,250,33,206,29,132,33,206,29,138,33,206,33,206,28,196,28,202,29,144,33,206,33,206,28,196,28,202,29,150,33,206,33,206,28,196,28,202,29,156,33,206,33,206,28,196,28,202,29,162,33,206,33,206,28,196,28,202,29,168,33,206,33,206,28,196,28,202,29,174,33,206,33,206,28,196,28,202,29,180,33,206,33,206,28,196,28,202,29,186,33,206,33,206,28,196,28,202,29,192,33,206,33,206,28,196,28,202,29,198,33,206,33,206,28,196,28,202,28,208,33,206,33,206,28,196,28,202,28,34,33,206,33,206,28,196,28,202,29,204,33,206,33,206,28,196,28,202,28,208,33,206,33,206,28,196,28,202,29,192,33,206,33,206,28,196,28,202,28,208,33,206,33,206,28,196,28,202,29,144,33,206,33,206,28,196,28,202,29,150,33,206,33,206,28,196,28,202,29,156,33,206,33,206,28,196,28,202,29,162,33,206,33,206,28,196,28,202,29,168,33,206,33,206,28,196,28,202,29,174,33,206,33,206,28,196,28,202,29,180,33,206,33,206,28,196,28,202,29,186,33,206,33,206,28,196,28,202,28,208,33,206,33,206,28,214,28,220,29,210,33,206,33,206,28,214,28,220,29,216,33,206,33,206,28,214,28,220,29,222,33,206,33,206,28,214,28,220,29,228,33,206,33,206,28,214,28,220,29,234,33,206,33,206,28,214,28,220,29,240,33,206,33,206,28,214,28,220,29,246,33,206,33,206,28,214,28,220,29,252,33,206,33,206,28,244,33,206,30,2,28,250,33,206,28,244,33,206,30,8,28,250,33,206,28,244,33,206,30,14,28,250,33,206,28,244,33,206,30,20,28,250,33,206,28,244,33,206,30,26,28,250,33,206,28,244,33,206,30,32,28,250,33,206,28,244,33,206,30,38,28,250,33,206,28,244,33,206,30,44,28,250,33,206,28,244,33,206,30,50,28,250,33,206,28,244,33,206,30,56,28,250,33,206,28,244,33,206,29,0,28,250,33,206,28,244,33,206,29,0,28,250,33,206,28,244,33,206,30,50,28,250,33,206,28,244,33,206,29,0,28,250,33,206,28,244,33,206,30,2,28,250,33,206,28,244,33,206,30,8,28,250,33,206,28,244,33,206,30,14,28,250,33,206,28,244,33,206,30,20,28,250,33,206,28,244,33,206,30,26,28,250,33,206,28,244,33,206,30,32,28,250,33,206,28,244,33,206,30,38,28,250,33,206,28,244,33,206,30,44,28,250,33,206,28,244,33,206,29,0,28,250,33,206,29,6,29,12,30,62,33,206,33,206,29,6,29,12,30,68,33,206,33,206,29,6,29,12,30,74,33,206,33,206,29,6,29,12,30,80,33,206,33,206,29,6,29,12,30,86,33,206,33,206,29,6,29,12,30,92,33,206,33,206,29,6,29,12,30,98,33,206,33,206,29,6,29,12,30,104,33,206,33,206,29,6,29,12,30,110,33,206,33,206,29,6,29,12,30,116,33,206,33,206,29,6,29,12,29,120,33,206,33,206,29,6,29,12,30,122,33,206,33,206,29,6,29,12,30,128,33,206,33,206,29,6,29,12,29,120,33,206,33,206,29,6,29,12,29,120,33,206,33,206,29,6,29,12,29,120,33,206,33,206,29,48,21,152,30,134,29,54,29,66,29,48,21,152,30,140,29,54,29,66,29,48,21,152,30,146,29,54,29,66,29,48,21,152,30,152,29,54,29,66,29,48,21,152,30,158,29,54,29,66,29,48,21,152,30,164,29,54,29,66,29,48,21,152,30,170,29,54,29,66,29,48,21,152,30,176,29,54,29,66,30,182,33,206,30,188,33,206,33,206,22,70,33,206,30,194,33,206,33,206,33,206,33,206,30,200,33,206,33,206,33,206,33,206,30,206,33,206,33,206,33,206,33,206,30,212,33,206,33,206,33,206,33,206,30,218,33,206,33,206,33,206,33,206,30,224,33,206,33,206,33,206,33,206,30,230,33,206,33,206,33,206,33,206,30,236,33,206,33,206,33,206,33,206,30,242,33,206,33,206,33,206,33,206,30,248,33,206,33,206,33,206,33,206,30,254,33,206,33,206,33,206,33,206,29,96,33,206,33,206,33,206,33,206,31,4,33,206,33,206,33,206,33,206,31,10,33,206,33,206,33,206,33,206,29,96,33,206,33,206,33,206,33,206,29,96,33,206,33,206,33,206,33,206,29,96,33,206,33,206,29,102,33,206,31,16,33,206,33,206,29,102,33,206,31,22,33,206,33,206,29,102,33,206,31,28,33,206,33,206,29,102,33,206,31,34,33,206,33,206,29,102,33,206,31,40,33,206,33,206,29,102,33,206,31,46,33,206,33,206,29,102,33,206,31,52,33,206,33,206,29,102,33,206,31,58,33,206,33,206,29,102,33,206,31,64,33,206,33,206,29,102,33,206,31,70,33,206,33,206,29,102,33,206,29,108,33,206,33,206,29,102,33,206,29,108,33,206,33,206,29,102,33,206,31,64,33,206,33,206,29,102,33,206,29,108,33,206,33,206,29,102,33,206,31,16,33,206,33,206,29,102,33,206,31,22,33,206,33,206,29,102,33,206,31,28,33,206,33,206,29,102,33,206,31,34,33,206,33,206,29,102,33,206,31,40,33,206,33,206,29,102,33,206,31,46,33,206,33,206,29,102,33,206,31,52,33,206,33,206,29,102,33,206,31,58,33,206,33,206,29,102,33,206,29,108,33,206,33,206,31,76,31,82,31,88,33,206,33,206,31,94,31,100,31,106,33,206,33,206,31,94,31,100,23,30,33,206,33,206,31,112,31,118,23,48,33,206,33,206,31,124,31,130,23,66,33,206,33,206,31,136,31,142,23,84,33,206,33,206,31,148,31,154,23,102,33,206,33,206,31,160,31,166,23,120,33,206,33,206,31,172,31,178,23,138,33,206,33,206,31,184,31,190,31,196,21,218,33,206,31,202,31,208,31,214,24,50,33,206,31,220,31,226,23,198,24,62,33,206,31,232,31,238,23,216,24,74,33,206,31,244,31,250,23,234,24,86,33,206,32,0,32,6,23,252,24,98,33,206,32,12,32,18,24,14,24,110,33,206,32,24,32,30,24,128,24,122,33,206,32,36,32,42,24,146,24,140,33,206,32,48,32,54,32,60,33,206,33,206,32,66,32,72,32,78,33,206,33,206,32,84,32,90,26,36,33,206,33,206,32,12,32,18,26,48,33,206,33,206,31,232,31,238,26,60,33,206,33,206,32,96,32,102,26,72,33,206,33,206,32,108,32,114,26,84,33,206,33,206,32,120,32,126,26,96,33,206,33,206,32,132,32,138,26,108,33,206,33,206,28,196,28,202,28,208,33,206,33,206,28,196,28,202,29,192,33,206,33,206,28,196,28,202,28,208,33,206,33,206,28,196,28,202,29,144,33,206,33,206,28,196,28,202,29,150,33,206,33,206,28,196,28,202,29,156,33,206,33,206,28,196,28,202,29,162,33,206,33,206,28,196,28,202,29,168,33,206,33,206,28,196,28,202,29,174,33,206,33,206,28,196,28,202,29,180,33,206,33,206,28,196,28,202,29,186,33,206,33,206,28,196,28,202,28,208,33,206,33,206,28,244,33,206,29,0,28,250,33,206,28,244,33,206,30,50,28,250,33,206,28,244,33,206,29,0,28,250,33,206,28,244,33,206,30,2,28,250,33,206,28,244,33,206,30,8,28,250,33,206,28,244,33,206,30,14,28,250,33,206,28,244,33,206,30,20,28,250,33,206,28,244,33,206,30,26,28,250,33,206,28,244,33,206,30,32,28,250,33,206,28,244,33,206,30,38,28,250,33,206,28,244,33,206,30,44,28,250,33,206,28,244,33,206,29,0,28,250,33,206,29,102,33,206,29,108,33,206,33,206,29,102,33,206,31,64,33,206,33,206,29,102,33,206,29,108,33,206,33,206,29,102,33,206,31,16,33,206,33,206,29,102,33,206,31,22,33,206,33,206,29,102,33,206,31,28,33,206,33,206,29,102,33,206,31,34,33,206,33,206,29,102,33,206,31,40,33,206,33,206,29,102,33,206,31,46,33,206,33,206,29,102,33,206,31,52,33,206,33,206,29,102,33,206,31,58,33,206,33,206,29,102,33,206,29,108,33,206,33,206,32,144,32,150,32,156,33,206,33,206,32,162,33,206,32,168,33,206,33,206,33,206,33,206,33,206,32,174,33,206,32,180,32,186,32,192,33,206,33,206,32,198,33,206,32,204,33,206,33,206,32,210,33,206,32,222,32,216,33,206,32,228,33,206,32,234,33,206,33,206,32,240,32,246,32,252,33,206,33,206,33,2,33,206,33,8,33,206,33,206,33,14,33,206,33,20,33,206,33,206,33,26,33,206,33,32,33,206,33,206,33,38,33,50,33,56,33,44,33,62,33,68,33,206,33,74,33,206,33,206,33,80,33,206,33,92,33,86,33,206,33,206,33,206,33,98,33,206,33,206,33,104,33,206,33,110,33,206,33,206,32,162,33,116,33,122,33,206,33,206,33,128,33,206,33,134,33,206,33,206,33,140,33,206,33,146,33,206,33,206,33,206,33,206,33,152,33,206,33,206,33,158,33,206,33,164,33,206,33,206,33,206,33,206,33,170,33,206,33,206,33,206,33,206,33,176,33,206,33,206,33,206,33,206,33,182,33,206,33,206,33,206,33,206,33,188,33,206,33,206,33,194,33,206,33,200,33,206,33,206,0,1,255,60,0,0,0,1,255,57,0,0,0,1,255,55,0,0,0,1,255,42,0,0,0,1,255,58,0,0,0,1,255,97,0,0,0,1,255,91,0,40,0,1,255,57,1,196,0,1,255,56,1,26,0,1,255,58,1,196,0,1,255,56,1,196,0,1,255,86,1,196,0,1,255,43,1,196,0,1,255,46,1,216,0,1,255,51,1,217,0,1,255,51,1,216,0,1,255,56,1,216,0,1,255,90,1,196,0,1,255,78,1,196,0,1,255,175,1,196,0,1,255,57,2,125,0,1,255,58,2,140,0,1,255,58,2,125,0,1,255,69,2,135,0,1,255,75,2,125,0,1,255,58,2,135,0,1,255,57,2,135,0,1,255,56,2,135,0,1,255,58,2,130,0,1,255,140,2,135,0,1,255,74,1,206,0,1,255,63,1,216,0,1,255,164,1,196,0,1,255,64,1,196,0,1,255,57,1,197,0,1,255,51,1,196,0,1,255,50,1,196,0,1,255,60,1,196,0,1,255,23,0,243,0,1,255,116,1,196,0,1,1,40,0,0,0,1,2,14,0,10,0,1,1,48,2,135,0,1,1,74,0,0,0,1,1,79,2,135,0,1,0,220,1,55,0,1,1,62,0,0,0,1,2,12,0,40,0,1,1,40,2,125,0,1,1,57,0,0,0,1,1,75,2,135,0,1,1,130,0,0,0,1,1,121,1,63,0,1,1,121,2,125,0,1,1,59,0,0,0,1,1,68,2,135,0,1,0,181,0,0,0,1,0,244,0,40,0,1,0,181,2,125,0,1,1,116,0,0,0,1,1,117,2,135,0,1,1,146,0,0,0,1,1,162,2,135,0,1,1,104,0,0,0,1,1,104,2,125,0,1,1,90,0,0,0,1,1,90,1,63,0,1,2,111,0,10,0,1,1,90,2,125,0,1,2,160,2,125,0,1,0,200,0,0,0,1,1,61,2,135,0,1,1,17,0,0,0,1,1,17,1,68,0,1,1,17,2,125,0,1,1,9,2,125,0,1,1,15,0,0,0,1,1,134,2,135,0,1,1,61,0,0,0,1,1,214,0,40,0,1,1,109,2,135,0,1,1,145,0,0,0,1,1,145,2,125,0,1,1,100,0,0,0,1,2,74,0,10,0,1,1,108,2,135,0,1,1,162,0,0,0,1,2,112,0,40,0,1,1,140,2,125,0,1,1,230,0,0,0,1,1,221,1,63,0,1,1,221,2,125,0,1,1,25,0,0,0,1,1,88,0,40,0,1,1,25,2,125,0,1,1,133,0,0,0,1,1,133,1,63,0,1,2,154,0,10,0,1,1,133,2,125,0,1,2,203,2,125,0,1,1,169,2,125,0,1,1,203,0,0,0,1,1,203,2,125,0,1,0,181,3,36,0,1,1,9,3,36,0,1,0,139,2,160,0,1,0,130,2,160,0,1,1,189,0,0,0,1,2,163,0,10,0,1,0,163,2,166,0,1,1,184,0,0,0,1,2,158,0,10,0,1,0,166,2,166,0,1,1,197,0,0,0,1,2,171,0,10,0,1,0,175,2,165,0,1,1,194,0,0,0,1,2,168,0,10,0,1,0,175,2,159,0,1,1,159,0,0,0,1,2,133,0,10,0,1,0,180,2,230,0,1,1,160,0,0,0,1,2,134,0,10,0,1,0,180,2,239,0,1,0,151,2,164,0,1,0,136,2,163,0,1,1,48,3,50,0,1,1,48,2,243,0,1,1,164,0,0,0,1,2,114,0,40,0,1,0,76,2,160,0,1,1,170,0,0,0,1,2,120,0,40,0,1,0,73,2,160,0,1,2,27,0,0,0,1,2,233,0,40,0,1,0,130,2,166,0,1,2,22,0,0,0,1,2,228,0,40,0,1,0,133,2,166,0,1,2,35,0,0,0,1,2,241,0,40,0,1,0,142,2,165,0,1,2,32,0,0,0,1,2,238,0,40,0,1,0,142,2,159,0,1,1,180,0,0,0,1,2,130,0,40,0,1,0,104,2,164,0,1,0,71,2,163,0,1,1,232,0,0,0,1,1,223,1,63,0,1,1,238,0,0,0,1,1,229,1,63,0,1,2,95,0,0,0,1,2,86,1,63,0,1,2,90,0,0,0,1,2,81,1,63,0,1,2,103,0,0,0,1,2,94,1,63,0,1,2,100,0,0,0,1,2,91,1,63,0,1,2,65,0,0,0,1,2,56,1,63,0,1,0,147,2,230,0,1,2,66,0,0,0,1,2,57,1,63,0,1,0,147,2,239,0,1,1,248,0,0,0,1,1,239,1,63,0,1,1,223,2,125,0,1,1,27,0,0,0,1,1,90,0,40,0,1,1,33,0,0,0,1,1,96,0,40,0,1,1,209,0,40,0,1,1,141,0,0,0,1,1,204,0,40,0,1,1,154,0,0,0,1,1,217,0,40,0,1,1,151,0,0,0,1,1,179,0,40,0,1,1,117,0,0,0,1,1,180,0,40,0,1,1,43,0,0,0,1,1,106,0,40,0,1,0,181,3,40,0,1,0,181,2,233,0,1,1,135,0,0,0,1,1,135,1,63,0,1,2,156,0,10,0,1,0,60,2,160,0,1,2,205,2,125,0,1,1,141,1,63,0,1,2,162,0,10,0,1,0,57,2,160,0,1,2,211,2,125,0,1,1,254,0,0,0,1,1,254,1,63,0,1,3,19,0,10,0,1,0,114,2,166,0,1,3,68,2,125,0,1,1,249,0,0,0,1,1,249,1,63,0,1,3,14,0,10,0,1,0,117,2,166,0,1,3,63,2,125,0,1,2,6,0,0,0,1,2,6,1,63,0,1,3,27,0,10,0,1,0,126,2,165,0,1,3,76,2,125,0,1,2,3,0,0,0,1,2,3,1,63,0,1,3,24,0,10,0,1,0,126,2,159,0,1,3,73,2,125,0,1,1,151,1,63,0,1,2,172,0,10,0,1,0,88,2,164,0,1,2,221,2,125,0,1,0,55,2,163,0,1,1,52,0,0,0,1,0,65,2,160,0,1,0,125,2,166,0,1,0,134,2,159,0,1,0,139,2,239,0,1,0,96,2,164,0,1,0,63,2,163,0,1,1,9,3,40,0,1,1,9,2,233,0,1,1,205,0,0,0,1,0,105,2,160,0,1,1,211,0,0,0,1,0,102,2,160,0,1,2,68,0,0,0,1,0,159,2,166,0,1,2,63,0,0,0,1,0,162,2,166,0,1,2,76,0,0,0,1,0,171,2,165,0,1,2,73,0,0,0,1,0,171,2,159,0,1,2,38,0,0,0,1,0,176,2,230,0,1,2,39,0,0,0,1,0,176,2,239,0,1,1,221,0,0,0,1,0,133,2,164,0,1,0,100,2,163,0,1,1,205,2,125,0,1,3,6,1,196,0,1,1,115,0,0,0,1,2,89,0,10,0,1,3,21,1,196,0,1,3,116,1,196,0,1,3,218,1,196,0,1,3,163,1,196,0,1,3,223,1,196,0,1,1,44,0,0,0,1,1,31,1,196,0,1,0,224,1,196,0,1,0,132,0,0,0,1,1,35,1,196,0,1,0,130,1,196,0,1,0,254,1,196,0,1,0,252,1,196,0,1,0,229,1,196,0,1,1,65,0,0,0,1,1,74,1,196,0,1,0,130,2,117,0,1,0,229,2,107,0,1,1,40,2,196,0,1,1,27,2,196,0,1,1,27,2,202,0,1,1,7,2,202,0,1,1,50,2,201,0,1,1,32,2,195,0,1,1,23,3,10,0,1,1,22,3,19,0,1,1,26,2,218,0,1,1,65,2,200,0,1,1,31,2,150,0,1,1,31,2,121,0,1,0,233,2,196,0,1,0,220,2,196,0,1,0,220,2,202,0,1,0,200,2,202,0,1,0,243,2,201,0,1,0,225,2,195,0,1,0,219,2,218,0,1,1,2,2,200,0,1,1,44,2,196,0,1,1,31,2,196,0,1,1,31,2,202,0,1,1,11,2,202,0,1,1,54,2,201,0,1,1,36,2,195,0,1,1,27,3,10,0,1,1,26,3,19,0,1,1,30,2,218,0,1,1,69,2,200,0,1,0,139,2,196,0,1,0,126,2,196,0,1,0,126,2,202,0,1,0,106,2,202,0,1,0,149,2,201,0,1,0,131,2,195,0,1,0,122,3,10,0,1,0,121,3,19,0,1,0,125,2,218,0,1,0,164,2,200,0,1,0,130,2,150,0,1,0,130,2,121,0,1,1,7,2,196,0,1,0,250,2,196,0,1,0,250,2,202,0,1,0,230,2,202,0,1,1,17,2,201,0,1,0,255,2,195,0,1,0,249,2,218,0,1,1,32,2,200,0,1,1,5,2,196,0,1,0,248,2,196,0,1,0,238,2,196,0,1,0,203,2,196,0,1,0,225,2,202,0,1,0,205,2,202,0,1,0,248,2,201,0,1,0,230,2,195,0,1,0,221,3,10,0,1,0,220,3,19,0,1,0,224,2,218,0,1,1,7,2,200,0,1,0,229,2,150,0,1,0,229,2,121,0,1,1,83,2,196,0,1,1,70,2,196,0,1,1,70,2,202,0,1,1,50,2,202,0,1,1,93,2,201,0,1,1,75,2,195,0,1,1,66,3,10,0,1,1,65,3,19,0,1,1,69,2,218,0,1,1,108,2,200,0,1,0,255,0,0,0,1,1,203,0,10,0,1,0,255,1,241,0,1,0,254,0,0,0,1,1,134,0,32,0,1,0,254,1,241,0,1,0,245,0,0,0,1,0,245,1,241,0,1,1,64,0,0,0,1,1,64,0,249,0,1,1,64,1,241,0,1,0,160,0,0,0,1,1,31,0,10,0,1,0,160,1,241,0,1,1,102,0,0,0,1,1,102,1,241,0,1,1,51,0,0,0,1,1,51,1,241,0,1,1,37,0,0,0,1,1,37,0,249,0,1,1,37,1,241,0,1,2,53,1,241,0,1,0,248,1,241,0,1,0,237,0,0,0,1,0,237,0,249,0,1,0,237,1,241,0,1,0,236,1,241,0,1,1,81,0,0,0,1,1,80,1,241,0,1,0,160,2,162,0,1,0,162,1,241,0,1,0,236,2,152,0,1,1,60,0,0,0,1,1,61,1,249,0,1,1,8,2,241,0,1,0,251,2,241,0,1,0,251,2,247,0,1,0,231,2,247,0,1,1,18,2,246,0,1,1,0,2,240,0,1,0,247,3,55,0,1,0,246,3,64,0,1,0,250,3,7,0,1,1,33,2,245,0,1,0,255,2,166,0,1,1,7,2,241,0,1,0,250,2,241,0,1,0,250,2,247,0,1,0,230,2,247,0,1,1,17,2,246,0,1,0,255,2,240,0,1,0,249,3,7,0,1,1,32,2,245,0,1,1,73,2,241,0,1,1,60,2,241,0,1,1,60,2,247,0,1,1,40,2,247,0,1,1,83,2,246,0,1,1,65,2,240,0,1,1,56,3,55,0,1,1,55,3,64,0,1,1,59,3,7,0,1,1,98,2,245,0,1,0,169,2,241,0,1,0,156,2,241,0,1,0,156,2,247,0,1,0,136,2,247,0,1,0,179,2,246,0,1,0,161,2,240,0,1,0,152,3,55,0,1,0,151,3,64,0,1,0,155,3,7,0,1,0,194,2,245,0,1,0,160,2,195,0,1,0,160,2,166,0,1,1,46,2,241,0,1,1,33,2,241,0,1,1,33,2,247,0,1,1,13,2,247,0,1,1,56,2,246,0,1,1,38,2,240,0,1,1,32,3,7,0,1,1,71,2,245,0,1,0,240,0,0,0,1,0,249,2,241,0,1,0,244,2,241,0,1,0,245,2,241,0,1,0,232,2,241,0,1,0,232,2,247,0,1,0,212,2,247,0,1,0,255,2,246,0,1,0,237,2,240,0,1,0,228,3,55,0,1,0,227,3,64,0,1,0,231,3,7,0,1,1,14,2,245,0,1,0,236,2,195,0,1,0,236,2,166,0,1,1,89,2,241,0,1,1,76,2,241,0,1,1,76,2,247,0,1,1,56,2,247,0,1,1,99,2,246,0,1,1,81,2,240,0,1,1,72,3,55,0,1,1,71,3,64,0,1,1,75,3,7,0,1,1,114,2,245,0,1,2,232,0,0,0,1,3,103,0,10,0,1,2,232,1,241,0,1,3,36,0,0,0,1,3,163,0,10,0,1,3,36,1,241,0,1,3,125,0,0,0,1,3,252,0,10,0,1,3,120,0,0,0,1,3,247,0,10,0,1,3,133,0,0,0,1,4,4,0,10,0,1,3,130,0,0,0,1,4,1,0,10,0,1,3,95,0,0,0,1,3,222,0,10,0,1,3,96,0,0,0,1,3,223,0,10,0,1,3,146,0,0,0,1,4,17,0,10,0,1,3,146,1,241,0,1,3,248,0,0,0,1,4,119,0,10,0,1,3,248,1,241,0,1,3,254,0,0,0,1,4,125,0,10,0,1,4,111,0,0,0,1,4,238,0,10,0,1,4,106,0,0,0,1,4,233,0,10,0,1,4,119,0,0,0,1,4,246,0,10,0,1,4,116,0,0,0,1,4,243,0,10,0,1,4,81,0,0,0,1,4,208,0,10,0,1,4,82,0,0,0,1,4,209,0,10,0,1,3,193,0,0,0,1,4,64,0,10,0,1,3,193,1,241,0,1,3,253,0,0,0,1,4,124,0,10,0,1,3,253,1,241,0,1,4,3,0,0,0,1,4,130,0,10,0,1,4,124,0,0,0,1,4,251,0,10,0,1,4,121,0,0,0,1,4,248,0,10,0,1,4,86,0,0,0,1,4,213,0,10,0,1,4,87,0,0,0,1,4,214,0,10,0,1,0,206,1,82,0,1,1,120,1,89,0,1,0,215,2,253,0,1,0,224,1,82,0,1,0,228,2,253,0,1,0,149,2,27,0,1,0,216,1,82,0,1,1,100,1,108,0,1,0,203,2,249,0,1,0,213,1,82,0,1,0,225,2,253,0,1,1,2,1,82,0,1,0,255,2,38,0,1,0,255,2,249,0,1,0,214,1,82,0,1,0,220,2,253,0,1,0,124,1,82,0,1,0,175,1,108,0,1,0,124,2,249,0,1,0,253,1,82,0,1,0,253,2,253,0,1,1,18,1,82,0,1,1,29,2,253,0,1,0,247,1,82,0,1,0,247,2,249,0,1,0,231,1,82,0,1,0,231,2,38,0,1,1,159,1,89,0,1,0,231,2,249,0,1,1,192,2,249,0,1,0,136,1,82,0,1,0,216,2,253,0,1,0,191,1,82,0,1,0,191,2,28,0,1,0,191,2,249,0,1,0,192,2,249,0,1,0,185,1,82,0,1,1,10,2,253,0,1,1,72,1,108,0,1,1,1,2,253,0,1,1,10,1,82,0,1,1,10,2,249,0,1,0,198,1,82,0,1,0,187,2,129,0,1,0,150,2,129,0,1,0,90,1,82,0,1,0,194,2,129,0,1,0,85,2,129,0,1,0,173,2,129,0,1,0,168,2,129,0,1,0,151,2,129,0,1,0,217,1,82,0,1,0,217,2,129,0,1,0,0,0,0,0,1,66,4,68,56,0,5,0,12,1,42,0,71,0,2,31,34,0,2,31,40,0,2,31,34,0,2,31,34,0,2,31,46,0,2,31,34,0,2,31,34,0,2,31,52,0,2,31,58,0,2,31,64,0,2,31,70,0,2,31,76,0,2,31,34,0,2,31,34,0,2,31,82,0,2,31,46,0,2,31,46,0,2,31,46,0,2,31,46,0,2,31,46,0,2,31,46,0,2,31,46,0,2,31,88,0,2,31,94,0,2,31,100,0,2,31,106,0,4,31,226,0,0,30,248,0,0,30,254,0,0,31,4,0,0,31,10,0,1,31,28,0,0,30,254,0,0,31,16,0,3,31,220,0,2,31,112,0,2,31,112,0,2,31,118,0,2,31,112,0,2,31,124,0,2,31,130,0,2,31,136,0,2,31,142,0,2,31,112,0,2,31,112,0,2,31,148,0,2,31,154,0,2,31,124,0,2,31,124,0,2,31,124,0,2,31,160,0,2,31,124,0,2,31,124,0,2,31,124,0,2,31,166,0,3,31,220,0,2,31,172,0,2,31,178,0,2,31,184,0,2,31,34,0,0,31,22,0,2,31,190,0,2,31,196,0,2,31,34,0,2,31,88,0,2,31,88,0,2,31,88,0,2,31,202,0,2,31,208,0,2,31,214,0,2,31,34,2,252,30,202,30,208,30,214,49,48,49,48,30,202,30,208,30,220,49,48,49,48,30,202,30,208,30,226,49,48,49,48,30,202,30,208,30,232,49,48,49,48,30,238,30,208,30,244,49,48,49,48,30,202,30,208,30,232,49,48,49,48,30,202,30,208,30,250,49,48,49,48,30,202,30,208,31,0,49,48,49,48,30,202,30,208,31,6,49,48,49,48,30,202,30,208,31,12,49,48,49,48,30,202,30,208,31,18,49,48,49,48,31,24,30,208,31,12,49,48,49,48,30,202,30,208,31,30,49,48,49,48,30,202,30,208,31,36,49,48,49,48,30,202,30,208,31,42,49,48,49,48,30,202,30,208,31,48,49,48,49,48,30,202,30,208,31,54,49,48,49,48,31,24,30,208,30,214,49,48,49,48,30,202,30,208,31,60,49,48,49,48,30,202,30,208,31,66,49,48,49,48,30,202,30,208,31,72,49,48,49,48,30,202,30,208,31,78,49,48,49,48,30,202,30,208,30,214,49,48,49,48,30,202,30,208,31,84,49,48,49,48,30,202,30,208,31,90,49,48,49,48,30,202,30,208,31,96,49,48,49,48,49,48,49,48,31,102,49,48,49,48,49,48,49,48,31,108,49,48,49,48,31,114,49,48,31,120,49,48,49,48,31,126,49,48,31,120,49,48,49,48,31,126,49,48,31,132,49,48,49,48,31,126,49,48,31,138,49,48,49,48,31,144,49,48,31,120,49,48,49,48,31,150,49,48,31,156,49,48,49,48,31,126,49,48,31,162,49,48,49,48,31,126,49,48,31,168,49,48,49,48,31,174,49,48,31,186,31,180,49,48,31,192,49,48,31,198,31,180,49,48,31,174,49,48,31,204,31,180,49,48,31,210,49,48,31,186,31,180,49,48,31,216,49,48,31,186,31,180,49,48,31,222,49,48,31,228,31,180,49,48,31,234,31,240,31,246,49,48,49,48,31,234,31,240,31,252,49,48,49,48,31,234,31,240,32,2,49,48,49,48,31,234,31,240,32,8,49,48,49,48,32,14,31,240,32,20,49,48,49,48,31,234,31,240,32,26,49,48,49,48,31,234,31,240,32,32,49,48,49,48,32,38,31,240,32,26,49,48,49,48,31,234,31,240,32,44,49,48,49,48,31,234,31,240,32,50,49,48,49,48,31,234,31,240,32,56,49,48,49,48,31,234,31,240,32,62,49,48,49,48,31,234,31,240,32,68,49,48,49,48,31,234,31,240,32,74,49,48,49,48,32,38,31,240,31,246,49,48,49,48,31,234,31,240,32,80,49,48,49,48,31,234,31,240,32,86,49,48,49,48,31,234,31,240,32,92,49,48,49,48,31,234,31,240,32,98,49,48,49,48,31,234,31,240,32,104,49,48,49,48,31,234,31,240,32,104,49,48,49,48,31,234,31,240,31,246,49,48,49,48,31,234,31,240,32,110,49,48,49,48,32,116,49,48,32,122,49,48,49,48,32,128,49,48,32,134,49,48,49,48,32,128,49,48,32,140,49,48,49,48,32,128,49,48,32,146,49,48,49,48,32,128,49,48,32,152,49,48,49,48,32,158,49,48,32,134,49,48,49,48,32,128,49,48,32,164,49,48,49,48,32,128,49,48,32,170,49,48,49,48,32,176,49,48,32,188,32,182,49,48,32,194,49,48,32,206,32,200,49,48,32,212,49,48,32,188,32,182,49,48,32,176,49,48,32,218,32,182,49,48,32,224,49,48,32,188,32,182,49,48,32,230,32,236,32,242,49,48,49,48,32,248,32,236,32,254,49,48,49,48,32,230,32,236,33,4,49,48,49,48,32,230,32,236,33,10,49,48,49,48,32,230,32,236,33,16,49,48,49,48,32,230,32,236,33,22,49,48,49,48,32,230,32,236,33,28,49,48,49,48,32,230,32,236,33,34,49,48,49,48,32,230,32,236,33,40,49,48,49,48,32,230,32,236,33,46,49,48,49,48,33,52,32,236,32,242,49,48,49,48,32,230,32,236,33,58,49,48,49,48,32,230,32,236,33,64,49,48,49,48,32,230,32,236,33,10,49,48,49,48,32,230,32,236,33,70,49,48,49,48,32,230,32,236,32,242,49,48,49,48,32,230,32,236,32,242,49,48,49,48,33,76,49,48,33,82,49,48,49,48,33,76,49,48,33,88,49,48,49,48,33,94,49,48,33,100,49,48,49,48,33,106,49,48,33,100,49,48,49,48,33,112,49,48,33,118,49,48,49,48,33,124,49,48,33,130,49,48,49,48,33,112,49,48,33,136,49,48,49,48,33,112,49,48,33,118,49,48,49,48,33,142,49,48,33,118,49,48,49,48,33,112,49,48,33,118,49,48,49,48,33,148,49,48,33,118,49,48,49,48,33,154,49,48,33,160,49,48,49,48,33,166,49,48,33,118,49,48,49,48,33,112,49,48,33,118,49,48,49,48,33,172,49,48,33,178,49,48,49,48,33,184,49,48,33,178,49,48,49,48,33,190,49,48,33,196,49,48,49,48,33,202,49,48,33,208,49,48,49,48,33,190,49,48,33,214,49,48,49,48,33,190,49,48,33,220,49,48,49,48,33,226,49,48,33,196,49,48,49,48,33,190,49,48,33,232,49,48,49,48,33,238,49,48,33,196,49,48,49,48,33,244,49,48,33,250,49,48,49,48,34,0,49,48,33,196,49,48,49,48,33,190,49,48,34,6,49,48,49,48,34,12,34,24,34,30,34,18,34,36,34,12,34,24,34,42,34,18,34,36,34,12,34,24,34,48,34,18,34,36,34,12,34,24,34,54,34,18,34,36,34,12,34,24,34,60,34,18,34,36,34,12,34,24,34,66,34,18,34,36,34,72,34,24,34,60,34,18,34,36,34,12,34,24,34,78,34,18,34,36,34,12,34,24,34,84,34,18,34,36,34,12,34,24,34,90,34,18,34,36,34,12,34,24,34,96,34,18,34,36,34,12,34,24,34,102,34,18,34,36,34,12,34,24,34,108,34,18,34,36,34,12,34,24,34,114,34,18,34,36,34,72,34,24,34,30,34,18,34,36,34,12,34,24,34,120,34,18,34,36,34,12,34,24,34,126,34,18,34,36,34,132,49,48,34,138,49,48,49,48,34,132,49,48,34,42,49,48,49,48,34,72,49,48,34,138,49,48,49,48,34,132,49,48,34,120,49,48,49,48,34,132,49,48,34,144,49,48,49,48,34,132,49,48,34,150,49,48,49,48,34,12,34,24,34,156,34,18,34,36,34,12,34,24,34,162,34,18,34,36,34,12,34,24,34,168,34,18,34,36,34,12,34,24,34,174,34,18,34,36,34,12,34,24,34,174,34,18,34,36,34,12,34,24,34,30,34,18,34,36,34,12,34,24,34,180,34,18,34,36,34,12,34,24,34,186,34,18,34,36,34,12,34,24,34,192,34,18,34,36,34,12,34,24,34,198,34,18,34,36,34,12,34,24,34,204,34,18,34,36,34,12,34,24,34,108,34,18,34,36,49,48,49,48,34,210,49,48,49,48,34,216,49,48,34,222,49,48,49,48,34,228,49,48,34,234,49,48,49,48,34,240,49,48,34,246,49,48,49,48,34,240,49,48,34,252,49,48,49,48,34,240,49,48,35,2,49,48,49,48,35,8,49,48,34,246,49,48,49,48,34,240,49,48,35,14,49,48,49,48,35,20,49,48,34,246,49,48,49,48,34,240,49,48,35,26,49,48,49,48,35,32,49,48,34,246,49,48,49,48,35,38,49,48,35,44,49,48,49,48,35,38,49,48,35,50,49,48,49,48,35,38,49,48,35,56,49,48,49,48,35,38,49,48,35,62,49,48,49,48,35,38,49,48,35,68,49,48,49,48,35,74,49,48,35,44,49,48,49,48,35,38,49,48,35,80,49,48,49,48,35,86,49,48,35,44,49,48,49,48,35,38,49,48,35,92,49,48,49,48,35,98,49,48,35,44,49,48,49,48,35,98,49,48,35,92,49,48,49,48,35,104,49,48,35,110,49,48,49,48,35,116,49,48,35,128,35,122,49,48,35,116,49,48,35,128,35,122,49,48,35,116,49,48,35,134,35,122,49,48,35,140,49,48,35,128,35,122,49,48,35,146,49,48,35,128,35,122,49,48,35,152,49,48,35,128,35,122,49,48,35,158,49,48,35,128,35,122,49,48,35,164,35,170,35,176,49,48,35,182,35,164,35,170,35,188,49,48,35,182,35,164,35,170,35,194,49,48,35,182,35,164,35,170,35,200,49,48,35,182,35,164,35,170,35,206,49,48,35,182,35,164,35,170,35,212,49,48,35,182,35,164,35,170,35,218,49,48,35,182,35,164,35,170,35,224,49,48,35,182,35,164,35,170,35,230,49,48,35,182,35,164,35,170,35,224,49,48,35,182,35,164,35,170,35,236,49,48,35,182,35,242,35,170,35,176,49,48,35,182,35,164,35,170,35,248,49,48,35,182,35,164,35,170,35,254,49,48,35,182,49,48,49,48,35,254,49,48,49,48,49,48,49,48,35,188,49,48,49,48,35,242,49,48,35,254,49,48,49,48,49,48,49,48,35,248,49,48,49,48,49,48,49,48,36,4,49,48,49,48,49,48,49,48,35,254,49,48,49,48,35,164,35,170,36,10,49,48,35,182,35,164,35,170,36,16,49,48,35,182,35,164,35,170,36,22,49,48,35,182,35,164,35,170,36,28,49,48,35,182,35,164,35,170,36,34,49,48,35,182,35,164,35,170,35,176,49,48,35,182,35,164,35,170,36,40,49,48,35,182,36,46,49,48,36,52,49,48,49,48,36,58,49,48,36,64,49,48,49,48,36,58,49,48,36,70,49,48,49,48,36,58,49,48,36,76,49,48,49,48,36,58,49,48,36,82,49,48,49,48,36,58,49,48,36,88,49,48,49,48,36,94,49,48,36,100,49,48,49,48,36,106,49,48,36,118,36,112,49,48,36,106,49,48,36,124,36,112,49,48,36,106,49,48,36,130,36,112,49,48,36,106,49,48,36,136,36,112,49,48,36,106,49,48,36,142,36,112,49,48,36,148,49,48,36,118,36,112,49,48,36,106,49,48,36,154,36,112,49,48,36,106,49,48,36,160,36,112,49,48,36,106,49,48,36,166,36,112,49,48,36,106,49,48,36,172,36,112,49,48,36,178,49,48,36,184,49,48,49,48,36,178,49,48,36,190,49,48,49,48,36,178,49,48,36,196,49,48,49,48,36,178,49,48,36,202,49,48,49,48,36,208,49,48,36,184,49,48,49,48,32,248,32,236,36,214,49,48,49,48,36,220,49,48,36,226,49,48,49,48,36,232,49,48,36,238,49,48,49,48,31,174,49,48,31,186,31,180,49,48,36,244,36,250,37,0,49,48,49,48,37,6,49,48,37,12,49,48,49,48,37,18,49,48,37,24,49,48,49,48,31,174,49,48,37,30,49,48,49,48,37,36,49,48,37,42,49,48,49,48,37,48,37,54,37,60,49,48,49,48,37,48,37,54,37,66,49,48,49,48,37,48,37,54,37,72,49,48,49,48,37,48,37,54,37,78,49,48,49,48,37,84,37,54,37,72,49,48,49,48,37,48,37,54,37,78,49,48,49,48,37,48,37,54,37,90,49,48,49,48,37,48,37,54,37,96,49,48,49,48,37,48,37,54,37,102,49,48,49,48,37,48,37,54,37,108,49,48,49,48,37,48,37,54,37,114,49,48,49,48,37,84,37,54,37,108,49,48,49,48,37,48,37,54,37,120,49,48,49,48,37,48,37,54,37,126,49,48,49,48,37,48,37,54,37,132,49,48,49,48,37,48,37,54,37,138,49,48,49,48,37,48,37,54,37,144,49,48,49,48,37,84,37,54,37,60,49,48,49,48,37,48,37,54,37,150,49,48,49,48,37,48,37,54,37,156,49,48,49,48,37,48,37,54,37,162,49,48,49,48,37,48,37,54,37,168,49,48,49,48,37,48,37,54,37,174,49,48,49,48,37,48,37,54,37,180,49,48,49,48,37,48,37,54,37,60,49,48,49,48,49,48,49,48,37,186,49,48,49,48,49,48,49,48,37,192,49,48,49,48,37,198,49,48,37,204,49,48,49,48,37,210,49,48,37,216,49,48,49,48,37,210,49,48,37,222,49,48,49,48,37,210,49,48,37,228,49,48,49,48,37,234,49,48,37,216,49,48,49,48,37,240,49,48,37,246,49,48,49,48,37,210,49,48,37,252,49,48,49,48,37,210,49,48,38,2,49,48,49,48,38,8,49,48,38,20,38,14,49,48,38,8,49,48,38,20,38,14,49,48,38,8,49,48,38,20,38,14,49,48,38,26,49,48,38,20,38,14,49,48,38,32,49,48,38,20,38,14,49,48,38,38,49,48,38,44,38,14,49,48,38,50,38,56,38,62,49,48,49,48,38,50,38,56,38,68,49,48,49,48,38,50,38,56,38,74,49,48,49,48,38,50,38,56,38,80,49,48,49,48,38,86,38,56,38,92,49,48,49,48,38,50,38,56,38,98,49,48,49,48,38,50,38,56,38,104,49,48,49,48,38,110,38,56,38,98,49,48,49,48,38,50,38,56,38,116,49,48,49,48,38,50,38,56,38,122,49,48,49,48,38,50,38,56,38,128,49,48,49,48,38,50,38,56,38,134,49,48,49,48,38,50,38,56,38,140,49,48,49,48,38,50,38,56,38,146,49,48,49,48,38,110,38,56,38,62,49,48,49,48,38,50,38,56,38,152,49,48,49,48,38,50,38,56,38,158,49,48,49,48,38,50,38,56,38,92,49,48,49,48,38,50,38,56,38,164,49,48,49,48,38,50,38,56,38,170,49,48,49,48,38,50,38,56,38,176,49,48,49,48,38,50,38,56,38,62,49,48,49,48,38,182,38,188,38,194,49,48,49,48,38,200,49,48,38,206,49,48,49,48,38,212,49,48,38,218,49,48,49,48,38,212,49,48,38,224,49,48,49,48,38,212,49,48,38,230,49,48,49,48,38,212,49,48,38,236,49,48,49,48,38,212,49,48,38,218,49,48,49,48,38,212,49,48,38,242,49,48,49,48,38,212,49,48,38,248,49,48,49,48,38,254,49,48,39,10,39,4,49,48,39,16,49,48,39,28,39,22,49,48,39,34,49,48,39,10,39,4,49,48,38,254,49,48,39,40,39,4,49,48,39,46,49,48,39,10,39,4,49,48,39,52,39,58,39,64,49,48,49,48,39,52,39,70,39,76,49,48,49,48,39,52,39,70,39,82,49,48,49,48,39,52,39,70,39,88,49,48,49,48,39,52,39,70,39,94,49,48,49,48,39,52,39,70,39,100,49,48,49,48,39,52,39,70,39,106,49,48,49,48,39,52,39,70,39,112,49,48,49,48,39,52,39,70,39,118,49,48,49,48,39,52,39,58,39,64,49,48,49,48,39,124,39,58,39,64,49,48,49,48,39,52,39,70,39,130,49,48,49,48,39,52,39,70,39,136,49,48,49,48,39,52,39,70,39,142,49,48,49,48,39,148,39,58,39,154,49,48,49,48,39,52,39,70,39,160,49,48,49,48,39,52,39,58,39,64,49,48,49,48,39,52,39,70,39,76,49,48,49,48,39,166,49,48,39,172,49,48,49,48,39,178,49,48,39,184,49,48,49,48,39,178,49,48,39,190,49,48,49,48,39,196,49,48,39,202,49,48,49,48,39,208,49,48,39,202,49,48,49,48,39,214,49,48,39,220,49,48,39,226,39,214,49,48,39,232,49,48,39,226,39,214,49,48,39,220,49,48,39,226,39,238,49,48,39,220,49,48,39,226,39,214,49,48,39,220,49,48,39,226,39,244,49,48,39,220,49,48,39,226,39,250,49,48,40,0,49,48,39,226,40,6,49,48,39,220,49,48,39,226,33,76,49,48,40,12,49,48,40,18,40,24,49,48,40,30,49,48,49,48,40,36,49,48,40,30,49,48,49,48,40,42,49,48,40,48,49,48,49,48,40,42,49,48,40,54,49,48,49,48,40,42,49,48,40,60,49,48,49,48,40,66,49,48,40,48,49,48,49,48,40,42,49,48,40,72,49,48,49,48,40,78,49,48,40,48,49,48,49,48,40,84,49,48,40,90,49,48,49,48,40,96,49,48,40,102,49,48,49,48,40,108,49,48,40,48,49,48,49,48,40,42,49,48,40,48,49,48,49,48,40,114,40,126,40,132,40,120,40,138,40,114,40,126,40,144,40,120,40,138,40,114,40,126,40,150,40,120,40,138,40,114,40,126,40,156,40,120,40,138,40,114,40,126,40,162,40,120,40,138,40,114,40,126,40,168,40,120,40,138,40,174,40,126,40,162,40,120,40,138,40,114,40,126,40,180,40,120,40,138,40,114,40,126,40,186,40,120,40,138,40,114,40,126,40,192,40,120,40,138,40,114,40,126,40,198,40,120,40,138,40,114,40,126,40,204,40,120,40,138,40,114,40,126,40,210,40,120,40,138,40,114,40,126,40,216,40,120,40,138,40,222,40,126,40,132,40,120,40,138,40,114,40,126,40,228,40,120,40,138,40,114,40,126,40,234,40,120,40,138,49,48,49,48,40,144,49,48,49,48,40,174,49,48,49,48,49,48,49,48,49,48,49,48,40,228,49,48,49,48,49,48,49,48,40,240,49,48,49,48,40,114,40,126,40,246,40,120,40,138,40,114,40,126,40,252,40,120,40,138,40,114,40,126,41,2,40,120,40,138,40,114,40,126,41,8,40,120,40,138,40,114,40,126,41,14,40,120,40,138,40,114,40,126,40,132,40,120,40,138,40,114,40,126,41,20,40,120,40,138,40,114,40,126,41,26,40,120,40,138,40,114,40,126,40,132,40,120,40,138,40,114,40,126,41,32,40,120,40,138,40,114,40,126,41,38,40,120,40,138,40,114,40,126,40,210,40,120,40,138,49,48,49,48,41,44,49,48,49,48,41,50,49,48,41,56,49,48,49,48,41,62,49,48,41,68,49,48,49,48,41,74,49,48,41,80,49,48,49,48,41,86,49,48,41,92,49,48,49,48,41,86,49,48,41,98,49,48,49,48,41,86,49,48,41,104,49,48,49,48,41,110,49,48,41,92,49,48,49,48,41,86,49,48,41,116,49,48,49,48,41,122,49,48,41,92,49,48,49,48,41,86,49,48,41,128,49,48,49,48,41,134,49,48,41,92,49,48,49,48,41,140,49,48,41,146,49,48,49,48,41,140,49,48,41,152,49,48,49,48,41,140,49,48,41,158,49,48,49,48,41,140,49,48,41,164,49,48,49,48,41,140,49,48,41,170,49,48,49,48,41,176,49,48,41,146,49,48,49,48,41,140,49,48,41,182,49,48,49,48,41,188,49,48,41,146,49,48,49,48,41,140,49,48,41,194,49,48,49,48,41,200,49,48,41,146,49,48,49,48,41,200,49,48,41,194,49,48,49,48,41,206,49,48,41,218,41,212,49,48,41,206,49,48,41,218,41,212,49,48,41,206,49,48,41,218,41,212,49,48,41,224,49,48,41,218,41,212,49,48,41,230,49,48,41,218,41,212,49,48,41,206,49,48,41,236,41,212,49,48,41,242,49,48,41,218,41,212,49,48,41,248,49,48,41,218,41,212,49,48,35,116,41,254,42,4,49,48,49,48,35,116,41,254,42,10,49,48,49,48,35,116,41,254,42,16,49,48,49,48,35,116,41,254,42,22,49,48,49,48,35,116,41,254,42,28,49,48,49,48,35,116,41,254,42,34,49,48,49,48,35,116,41,254,42,40,49,48,49,48,35,116,41,254,42,46,49,48,49,48,35,116,41,254,42,52,49,48,49,48,35,116,41,254,42,46,49,48,49,48,35,116,41,254,42,58,49,48,49,48,39,46,41,254,42,4,49,48,49,48,35,116,41,254,42,64,49,48,49,48,35,116,41,254,42,70,49,48,49,48,42,76,49,48,42,82,49,48,49,48,42,76,49,48,42,10,49,48,49,48,42,88,49,48,42,82,49,48,49,48,42,76,49,48,42,64,49,48,49,48,42,76,49,48,42,94,49,48,49,48,42,76,49,48,42,82,49,48,49,48,35,116,41,254,42,100,49,48,49,48,35,116,41,254,42,106,49,48,49,48,35,116,41,254,42,112,49,48,49,48,35,116,41,254,42,118,49,48,49,48,35,116,41,254,42,124,49,48,49,48,35,116,41,254,42,4,49,48,49,48,35,116,41,254,42,130,49,48,49,48,34,216,49,48,42,136,49,48,49,48,42,142,49,48,42,148,49,48,49,48,42,142,49,48,42,154,49,48,49,48,42,142,49,48,42,160,49,48,49,48,42,142,49,48,42,166,49,48,49,48,42,142,49,48,42,172,49,48,49,48,32,116,49,48,42,178,49,48,49,48,42,184,49,48,42,190,49,48,49,48,42,184,49,48,37,246,49,48,49,48,42,184,49,48,42,196,49,48,49,48,42,184,49,48,42,202,49,48,49,48,42,184,49,48,42,208,49,48,49,48,34,72,49,48,42,190,49,48,49,48,42,184,49,48,42,214,49,48,49,48,42,184,49,48,42,220,49,48,49,48,42,184,49,48,42,226,49,48,49,48,42,184,49,48,42,190,49,48,49,48,42,232,49,48,42,238,49,48,49,48,42,232,49,48,42,244,49,48,49,48,42,232,49,48,42,250,49,48,49,48,42,232,49,48,43,0,49,48,49,48,43,6,49,48,42,238,49,48,49,48,39,52,39,70,39,76,49,48,49,48,38,200,49,48,38,206,49,48,49,48,37,18,39,70,43,12,49,48,49,48,38,200,49,48,38,206,49,48,49,48,31,126,49,48,31,120,49,48,49,48,31,234,49,48,31,186,31,180,49,48,43,18,43,24,43,30,49,48,49,48,33,112,49,48,33,118,49,48,49,48,33,172,49,48,33,178,49,48,49,48,36,46,49,48,36,52,49,48,49,48,36,94,49,48,36,100,49,48,49,48,38,200,49,48,38,206,49,48,49,48,43,36,43,42,43,48,49,48,49,48,43,36,43,42,43,54,49,48,49,48,43,36,43,42,43,60,49,48,49,48,43,36,43,42,43,66,49,48,49,48,43,72,43,42,43,60,49,48,49,48,43,36,43,42,43,78,49,48,49,48,43,36,43,42,43,84,49,48,49,48,43,36,43,42,43,90,49,48,49,48,43,36,43,42,43,96,49,48,49,48,43,36,43,42,43,102,49,48,49,48,43,36,43,42,43,108,49,48,49,48,43,72,43,42,43,102,49,48,49,48,43,36,43,42,43,114,49,48,49,48,43,36,43,42,43,120,49,48,49,48,43,36,43,42,43,126,49,48,49,48,43,36,43,42,43,132,49,48,49,48,43,36,43,42,43,138,49,48,49,48,43,36,43,42,43,48,49,48,49,48,43,36,43,42,43,144,49,48,49,48,43,36,43,42,43,48,49,48,49,48,43,36,43,42,43,60,49,48,49,48,43,150,49,48,43,156,49,48,49,48,43,36,43,42,43,162,49,48,49,48,43,36,43,42,43,48,49,48,49,48,43,36,43,42,43,168,49,48,49,48,43,36,43,42,43,174,49,48,49,48,43,36,43,42,43,180,49,48,49,48,43,186,49,48,43,192,49,48,49,48,43,186,49,48,43,198,49,48,49,48,31,114,49,48,31,120,49,48,49,48,36,94,49,48,43,204,49,48,49,48,36,94,49,48,43,210,49,48,49,48,36,94,49,48,43,216,49,48,49,48,43,222,49,48,43,204,49,48,49,48,43,222,49,48,43,210,49,48,49,48,36,94,49,48,43,228,49,48,49,48,36,94,49,48,43,234,49,48,49,48,43,240,49,48,43,252,43,246,49,48,43,240,49,48,44,2,43,246,49,48,44,8,49,48,43,252,43,246,49,48,44,14,49,48,43,252,43,246,49,48,44,20,49,48,44,26,43,246,49,48,44,32,44,38,44,44,49,48,49,48,44,32,44,38,44,50,49,48,49,48,44,32,44,38,44,56,49,48,49,48,44,32,44,38,44,62,49,48,49,48,44,68,44,38,44,74,49,48,49,48,44,32,44,38,44,80,49,48,49,48,44,32,44,38,44,86,49,48,49,48,44,92,44,38,44,80,49,48,49,48,44,32,44,38,44,98,49,48,49,48,44,32,44,38,44,104,49,48,49,48,44,32,44,38,44,110,49,48,49,48,44,32,44,38,44,116,49,48,49,48,44,32,44,38,44,122,49,48,49,48,44,32,44,38,44,128,49,48,49,48,44,92,44,38,44,44,49,48,49,48,44,32,44,38,44,134,49,48,49,48,44,32,44,38,44,140,49,48,49,48,44,32,44,38,44,74,49,48,49,48,44,32,44,38,44,146,49,48,49,48,44,32,44,38,44,152,49,48,49,48,44,32,44,38,44,158,49,48,49,48,44,32,44,38,44,44,49,48,49,48,44,32,44,38,44,164,49,48,49,48,44,170,49,48,44,176,49,48,49,48,32,116,49,48,32,122,49,48,49,48,44,182,44,188,44,194,49,48,49,48,44,200,49,48,44,212,44,206,44,218,44,224,49,48,44,230,49,48,49,48,44,224,49,48,44,236,49,48,49,48,44,224,49,48,44,242,49,48,49,48,44,224,49,48,44,248,49,48,49,48,44,254,49,48,44,230,49,48,49,48,44,224,49,48,45,4,49,48,49,48,44,224,49,48,45,10,49,48,49,48,45,16,49,48,45,28,45,22,49,48,32,194,49,48,32,206,32,200,49,48,45,34,49,48,45,28,45,22,49,48,45,16,49,48,45,40,45,22,49,48,45,46,49,48,45,28,45,22,49,48,41,86,45,52,45,58,49,48,49,48,43,18,43,24,43,30,49,48,49,48,41,86,45,52,45,64,49,48,49,48,45,70,45,52,45,76,49,48,49,48,41,86,45,52,45,82,49,48,49,48,41,86,45,52,45,88,49,48,49,48,41,86,45,52,45,94,49,48,49,48,41,86,45,52,45,100,49,48,49,48,41,86,45,52,45,106,49,48,49,48,41,86,45,52,45,112,49,48,49,48,41,86,45,52,45,118,49,48,49,48,41,86,45,52,45,58,49,48,49,48,41,86,45,52,45,124,49,48,49,48,41,86,45,52,45,58,49,48,49,48,41,86,45,52,45,130,49,48,49,48,45,136,45,52,45,142,49,48,49,48,41,86,45,52,45,148,49,48,49,48,41,86,45,52,45,58,49,48,49,48,41,86,45,52,45,58,49,48,49,48,45,154,49,48,45,160,49,48,49,48,33,76,49,48,33,82,49,48,49,48,45,154,49,48,45,166,49,48,49,48,33,94,49,48,33,100,49,48,49,48,45,172,49,48,33,100,49,48,49,48,33,94,49,48,33,100,49,48,49,48,45,178,49,48,45,190,45,184,45,196,45,178,49,48,45,202,45,184,45,196,45,178,49,48,45,190,45,184,45,196,45,208,49,48,45,190,45,184,45,196,45,178,49,48,45,190,45,184,45,196,45,214,49,48,45,190,45,184,45,196,45,220,49,48,45,226,45,184,45,196,45,232,49,48,45,190,45,184,45,196,37,198,49,48,45,244,45,238,45,250,46,0,49,48,46,6,49,48,49,48,46,12,49,48,46,6,49,48,49,48,46,18,49,48,46,24,49,48,49,48,46,18,49,48,46,30,49,48,49,48,46,18,49,48,46,36,49,48,49,48,46,42,49,48,46,24,49,48,49,48,46,18,49,48,46,48,49,48,49,48,46,54,49,48,46,24,49,48,49,48,46,60,49,48,46,66,49,48,49,48,46,72,49,48,46,24,49,48,49,48,46,18,49,48,46,78,49,48,49,48,40,42,30,208,46,90,46,84,46,96,40,42,30,208,46,102,46,84,46,96,40,42,30,208,46,108,46,84,46,96,40,42,30,208,46,114,46,84,46,96,40,42,30,208,46,120,46,84,46,96,40,42,30,208,46,126,46,84,46,96,40,78,30,208,46,120,46,84,46,96,40,42,30,208,46,132,46,84,46,96,40,42,30,208,46,138,46,84,46,96,40,42,30,208,46,144,46,84,46,96,40,42,30,208,46,150,46,84,46,96,40,42,30,208,46,156,46,84,46,96,40,42,30,208,46,162,46,84,46,96,40,42,30,208,46,168,46,84,46,96,40,78,30,208,46,90,46,84,46,96,40,42,30,208,46,174,46,84,46,96,40,42,30,208,46,180,46,84,46,96,46,186,49,48,46,192,49,48,49,48,46,186,49,48,46,198,49,48,49,48,32,38,49,48,46,192,49,48,49,48,46,186,49,48,46,204,49,48,49,48,46,186,49,48,46,210,49,48,49,48,46,186,49,48,46,216,49,48,49,48,40,42,30,208,46,222,46,84,46,96,40,42,30,208,46,108,46,84,46,96,40,42,30,208,46,228,46,84,46,96,40,42,30,208,46,234,46,84,46,96,40,42,30,208,46,240,46,84,46,96,40,42,30,208,46,90,46,84,46,96,40,42,30,208,46,90,46,84,46,96,40,42,30,208,46,102,46,84,46,96,40,42,30,208,46,246,46,84,46,96,40,42,30,208,46,252,46,84,46,96,40,42,30,208,47,2,46,84,46,96,40,42,30,208,46,162,46,84,46,96,49,48,49,48,34,210,49,48,49,48,45,178,49,48,47,8,49,48,49,48,34,228,49,48,34,234,49,48,49,48,37,6,49,48,47,14,49,48,49,48,37,6,49,48,47,20,49,48,49,48,37,6,49,48,47,26,49,48,49,48,47,32,49,48,47,14,49,48,49,48,37,6,49,48,47,38,49,48,49,48,47,44,49,48,47,14,49,48,49,48,37,6,49,48,47,50,49,48,49,48,47,56,49,48,47,14,49,48,49,48,47,62,49,48,47,68,49,48,49,48,47,62,49,48,47,74,49,48,49,48,47,62,49,48,47,80,49,48,49,48,47,62,49,48,47,86,49,48,49,48,47,62,49,48,47,92,49,48,49,48,47,98,49,48,47,68,49,48,49,48,47,62,49,48,47,104,49,48,49,48,47,110,49,48,47,68,49,48,49,48,47,62,49,48,47,116,49,48,49,48,47,122,49,48,47,68,49,48,49,48,47,122,49,48,47,116,49,48,49,48,47,128,49,48,47,140,47,134,49,48,47,128,49,48,47,140,47,134,49,48,47,128,49,48,47,146,47,134,49,48,47,152,49,48,47,140,47,134,49,48,47,158,49,48,47,140,47,134,49,48,47,128,49,48,47,164,47,134,49,48,47,170,49,48,47,140,47,134,49,48,47,176,49,48,47,140,47,134,49,48,47,182,47,188,47,194,49,48,47,200,47,182,47,188,47,206,49,48,47,200,47,182,47,188,47,212,49,48,47,200,47,182,47,188,47,218,49,48,47,200,47,182,47,188,47,224,49,48,47,200,47,182,47,188,47,230,49,48,47,200,47,182,47,188,47,236,49,48,47,200,47,182,47,188,47,194,49,48,47,200,47,182,47,188,47,194,49,48,47,200,47,182,47,188,47,194,49,48,47,200,47,182,47,188,47,194,49,48,47,200,47,182,47,188,47,194,49,48,47,200,47,182,47,188,47,242,49,48,47,200,47,182,47,188,35,254,49,48,47,200,49,48,49,48,35,254,49,48,49,48,49,48,49,48,47,248,49,48,49,48,30,238,49,48,35,254,49,48,49,48,49,48,49,48,47,254,49,48,49,48,49,48,49,48,48,4,49,48,49,48,49,48,49,48,35,254,49,48,49,48,47,182,47,188,48,10,49,48,47,200,47,182,47,188,48,16,49,48,47,200,47,182,47,188,48,22,49,48,47,200,47,182,47,188,48,28,49,48,47,200,47,182,47,188,48,34,49,48,47,200,47,182,47,188,47,194,49,48,47,200,47,182,47,188,48,40,49,48,47,200,36,46,49,48,36,52,49,48,49,48,48,46,49,48,48,52,49,48,49,48,48,46,49,48,48,58,49,48,49,48,48,46,49,48,48,64,49,48,49,48,48,46,49,48,48,70,49,48,49,48,48,46,49,48,48,76,49,48,49,48,36,94,49,48,36,100,49,48,49,48,48,82,49,48,48,94,48,88,49,48,48,82,49,48,48,100,48,88,49,48,48,82,49,48,48,106,48,88,49,48,48,82,49,48,48,112,48,88,49,48,48,82,49,48,48,118,48,88,49,48,48,124,49,48,48,94,48,88,49,48,48,82,49,48,48,130,48,88,49,48,48,82,49,48,48,136,48,88,49,48,48,82,49,48,48,142,48,88,49,48,48,82,49,48,48,148,48,88,49,48,35,38,49,48,48,154,49,48,49,48,35,38,49,48,48,160,49,48,49,48,35,38,49,48,48,166,49,48,49,48,35,38,49,48,48,172,49,48,49,48,35,98,49,48,48,154,49,48,49,48,37,48,37,54,48,178,49,48,49,48,39,16,49,48,48,184,49,48,49,48,48,190,49,48,48,202,48,196,49,48,39,166,49,48,39,172,49,48,49,48,48,208,49,48,39,220,49,48,39,226,40,84,49,48,40,90,49,48,49,48,42,142,49,48,48,214,49,48,49,48,32,116,49,48,48,220,49,48,49,48,48,226,49,48,48,232,49,48,49,48,37,48,37,54,48,178,49,48,49,48,37,198,49,48,37,204,49,48,49,48,37,210,49,48,48,238,49,48,49,48,38,8,49,48,38,20,38,14,49,48,38,50,38,56,41,20,49,48,49,48,38,200,49,48,38,206,49,48,49,48,48,244,49,48,48,250,49,48,49,48,48,190,49,48,48,202,48,196,49,48,39,52,39,58,39,64,49,48,49,48,39,166,49,48,39,172,49,48,49,48,39,196,49,48,39,202,49,48,49,48,48,208,49,48,39,220,49,48,39,226,40,24,49,48,49,0,49,48,49,48,40,84,49,48,40,90,49,48,49,48,39,16,49,48,48,184,49,48,49,48,41,50,49,48,49,6,49,48,49,48,41,74,49,48,49,12,49,48,49,48,41,74,49,48,49,18,49,48,49,48,41,206,49,48,49,24,41,212,49,48,35,116,41,254,49,30,49,48,49,48,34,216,49,48,49,36,49,48,49,48,42,142,49,48,48,214,49,48,49,48,32,116,49,48,48,220,49,48,49,48,48,226,49,48,48,232,49,48,49,48,42,232,49,48,49,42,49,48,49,48,0,1,255,60,0,0,0,1,255,57,0,0,0,1,255,55,0,0,0,1,255,42,0,0,0,1,255,58,0,0,0,1,255,97,0,0,0,1,255,91,0,40,0,1,255,57,1,196,0,1,255,56,1,26,0,1,255,58,1,196,0,1,255,56,1,196,0,1,255,86,1,196,0,1,255,43,1,196,0,1,255,46,1,216,0,1,255,51,1,217,0,1,255,51,1,216,0,1,255,56,1,216,0,1,255,90,1,196,0,1,255,78,1,196,0,1,255,175,1,196,0,1,255,57,2,125,0,1,255,58,2,140,0,1,255,58,2,125,0,1,255,69,2,135,0,1,255,75,2,125,0,1,255,58,2,135,0,1,255,57,2,135,0,1,255,56,2,135,0,1,255,58,2,130,0,1,255,140,2,135,0,1,255,74,1,206,0,1,255,63,1,216,0,1,255,164,1,196,0,1,255,64,1,196,0,1,255,57,1,197,0,1,255,51,1,196,0,1,255,50,1,196,0,1,255,60,1,196,0,1,255,23,0,243,0,1,255,116,1,196,0,1,1,36,0,0,0,1,2,14,0,10,0,1,1,36,2,125,0,1,1,70,2,249,0,1,1,41,3,50,0,1,1,46,3,158,0,1,1,34,255,64,0,1,1,36,3,40,0,1,1,46,3,182,0,1,1,44,3,145,0,1,1,42,2,241,0,1,1,42,3,78,0,1,1,40,3,142,0,1,1,24,255,64,0,1,1,39,3,152,0,1,1,49,3,151,0,1,1,46,3,141,0,1,1,5,3,59,0,1,1,42,3,40,0,1,1,1,3,73,0,1,1,35,3,113,0,1,1,36,3,79,0,1,1,42,2,233,0,1,1,42,3,70,0,1,1,51,3,102,0,1,1,44,3,52,0,1,1,243,2,135,0,1,1,197,2,249,0,1,1,74,0,0,0,1,1,79,2,135,0,1,1,58,0,0,0,1,1,131,2,249,0,1,1,103,2,241,0,1,1,84,255,23,0,1,1,67,255,23,0,1,1,79,3,3,0,1,1,85,3,109,0,1,1,103,3,51,0,1,1,82,0,0,0,1,1,85,1,68,0,1,1,91,2,135,0,1,3,248,0,0,0,1,3,227,2,241,0,1,1,75,2,241,0,1,1,80,255,64,0,1,1,82,255,113,0,1,3,145,0,0,0,1,3,171,2,198,0,1,1,62,0,0,0,1,2,12,0,40,0,1,1,70,2,135,0,1,1,82,2,249,0,1,1,71,3,69,0,1,1,54,2,241,0,1,1,71,255,23,0,1,1,70,3,50,0,1,1,54,3,78,0,1,1,65,3,152,0,1,1,41,255,64,0,1,1,64,3,162,0,1,1,74,3,161,0,1,1,71,3,151,0,1,1,39,3,69,0,1,1,54,3,40,0,1,1,54,3,51,0,1,1,13,3,73,0,1,1,60,3,123,0,1,1,70,3,89,0,1,1,54,2,233,0,1,1,70,3,179,0,1,1,55,3,52,0,1,0,182,0,0,0,1,1,62,2,135,0,1,1,78,0,0,0,1,1,117,2,125,0,1,1,117,3,40,0,1,1,117,2,241,0,1,1,123,3,99,0,1,1,60,254,219,0,1,1,117,3,51,0,1,1,117,2,233,0,1,1,121,0,0,0,1,1,121,1,63,0,1,1,121,2,125,0,1,1,120,0,0,0,1,1,112,1,68,0,1,1,115,2,135,0,1,1,121,255,59,0,1,1,121,3,78,0,1,1,119,255,64,0,1,0,181,0,0,0,1,0,244,0,40,0,1,0,181,2,125,0,1,1,248,0,0,0,1,2,17,2,135,0,1,0,181,2,249,0,1,0,181,3,79,0,1,0,181,2,241,0,1,0,181,3,78,0,1,0,150,3,59,0,1,0,181,3,40,0,1,0,181,3,170,0,1,0,181,3,51,0,1,0,179,255,64,0,1,0,131,3,63,0,1,0,171,3,148,0,1,0,181,2,233,0,1,0,143,0,0,0,1,0,168,2,135,0,1,0,174,3,109,0,1,1,116,0,0,0,1,1,117,2,135,0,1,1,98,254,219,0,1,1,31,0,0,0,1,0,190,2,135,0,1,2,138,0,0,0,1,2,163,2,135,0,1,0,190,3,3,0,1,1,30,254,219,0,1,1,29,255,64,0,1,2,238,0,0,0,1,2,120,1,207,0,1,1,31,255,113,0,1,1,146,0,0,0,1,1,162,2,135,0,1,1,144,255,64,0,1,1,104,0,0,0,1,1,104,2,125,0,1,3,94,0,0,0,1,3,119,2,135,0,1,1,143,2,249,0,1,1,115,2,241,0,1,1,96,254,219,0,1,1,104,3,51,0,1,1,102,255,64,0,1,3,194,0,0,0,1,3,76,1,207,0,1,1,104,255,113,0,1,1,117,3,52,0,1,1,90,0,0,0,1,1,90,1,63,0,1,2,111,0,10,0,1,1,90,2,125,0,1,2,160,2,125,0,1,1,114,2,249,0,1,1,69,3,69,0,1,1,85,2,241,0,1,1,86,3,78,0,1,1,89,3,152,0,1,1,89,255,64,0,1,1,88,3,162,0,1,1,98,3,161,0,1,1,95,3,151,0,1,1,59,3,59,0,1,1,86,3,40,0,1,1,90,3,170,0,1,1,90,3,117,0,1,1,45,3,73,0,1,1,84,3,123,0,1,1,59,0,0,0,1,1,68,2,135,0,1,1,68,3,128,0,1,1,86,3,52,0,1,1,141,3,59,0,1,1,90,3,79,0,1,1,86,2,233,0,1,1,90,3,169,0,1,1,72,2,135,0,1,1,92,2,248,0,1,1,88,3,52,0,1,1,90,3,194,0,1,1,90,3,167,0,1,1,252,2,135,0,1,0,200,0,0,0,1,1,61,2,135,0,1,1,167,0,0,0,1,1,77,2,135,0,1,1,50,0,0,0,1,1,40,2,125,0,1,1,40,2,249,0,1,1,40,2,241,0,1,1,50,254,219,0,1,1,9,3,59,0,1,1,48,255,64,0,1,1,40,3,79,0,1,1,50,255,113,0,1,0,245,0,0,0,1,1,19,2,125,0,1,1,19,2,249,0,1,1,19,3,175,0,1,1,6,2,241,0,1,1,19,3,167,0,1,0,254,255,23,0,1,1,19,3,78,0,1,0,227,254,219,0,1,1,19,3,51,0,1,0,243,255,64,0,1,1,70,0,0,0,1,1,70,2,125,0,1,1,17,0,0,0,1,1,17,1,68,0,1,1,17,2,125,0,1,1,20,2,241,0,1,1,13,255,23,0,1,1,5,254,219,0,1,1,15,255,64,0,1,1,17,255,113,0,1,1,85,0,0,0,1,2,101,0,10,0,1,1,85,2,125,0,1,2,149,2,125,0,1,1,119,2,249,0,1,1,77,3,69,0,1,1,91,2,241,0,1,1,91,3,78,0,1,1,54,3,59,0,1,1,91,3,40,0,1,1,87,3,188,0,1,1,87,3,161,0,1,1,88,3,130,0,1,1,87,255,64,0,1,1,50,3,73,0,1,1,92,2,125,0,1,1,82,3,148,0,1,1,136,3,59,0,1,1,85,3,79,0,1,1,91,2,233,0,1,1,85,3,148,0,1,1,91,3,70,0,1,1,85,3,194,0,1,1,56,0,0,0,1,1,90,2,135,0,1,1,239,0,0,0,1,2,6,2,135,0,1,1,238,2,249,0,1,1,210,3,78,0,1,1,210,3,40,0,1,1,169,3,73,0,1,1,15,0,0,0,1,1,134,2,135,0,1,1,13,0,0,0,1,1,11,0,181,0,1,1,23,2,125,0,1,1,57,2,249,0,1,1,29,3,78,0,1,1,29,3,40,0,1,1,23,3,51,0,1,1,7,255,64,0,1,0,244,3,73,0,1,1,28,3,108,0,1,1,23,2,233,0,1,1,40,3,52,0,1,1,57,0,0,0,1,1,75,2,135,0,1,1,64,2,249,0,1,1,36,2,241,0,1,1,36,3,51,0,1,1,55,255,64,0,1,2,17,3,3,0,1,3,7,0,0,0,1,3,37,2,125,0,1,1,79,0,0,0,1,1,100,2,135,0,1,0,183,0,0,0,1,0,246,0,40,0,1,0,183,2,125,0,1,1,29,0,0,0,1,0,188,2,135,0,1,1,151,0,0,0,1,1,167,2,135,0,1,1,116,2,135,0,1,1,40,0,0,0,1,1,159,2,135,0,1,0,229,0,0,0,1,1,164,0,41,0,1,0,217,1,196,0,1,0,248,2,203,0,1,0,220,2,150,0,1,0,236,2,229,0,1,0,204,255,64,0,1,0,236,2,253,0,1,0,234,2,216,0,1,0,219,2,198,0,1,0,218,2,191,0,1,0,210,2,233,0,1,0,209,2,243,0,1,0,219,2,242,0,1,0,216,2,232,0,1,0,204,2,193,0,1,0,217,2,107,0,1,0,191,2,202,0,1,0,208,2,239,0,1,0,217,2,150,0,1,0,218,2,121,0,1,0,218,2,196,0,1,0,225,2,167,0,1,1,94,1,216,0,1,1,126,2,203,0,1,0,252,0,0,0,1,0,215,1,207,0,1,0,248,0,0,0,1,1,4,1,196,0,1,1,18,2,203,0,1,0,245,2,198,0,1,0,232,255,23,0,1,1,1,255,23,0,1,1,4,2,203,0,1,1,10,2,190,0,1,0,244,2,80,0,1,1,8,0,0,0,1,1,120,0,236,0,1,1,134,2,218,0,1,1,6,255,64,0,1,1,8,255,113,0,1,2,235,0,0,0,1,3,5,2,198,0,1,1,5,0,0,0,1,1,136,0,41,0,1,0,255,1,196,0,1,1,16,2,203,0,1,1,0,2,150,0,1,0,243,2,198,0,1,1,14,255,23,0,1,0,255,2,150,0,1,0,242,2,191,0,1,0,233,2,233,0,1,0,230,255,64,0,1,0,232,2,243,0,1,0,242,2,242,0,1,0,239,2,232,0,1,0,242,2,193,0,1,0,241,2,107,0,1,0,242,2,80,0,1,0,215,2,202,0,1,0,245,2,239,0,1,0,242,2,121,0,1,0,255,3,49,0,1,0,255,2,235,0,1,0,193,0,0,0,1,0,56,1,155,0,1,0,187,1,196,0,1,0,157,0,0,0,1,1,9,2,237,0,1,0,244,255,41,0,1,1,7,1,196,0,1,1,1,2,150,0,1,1,7,2,198,0,1,1,13,2,190,0,1,0,255,2,80,0,1,1,7,2,121,0,1,1,1,0,0,0,1,1,11,0,226,0,1,0,129,2,178,0,1,1,3,0,0,0,1,1,13,0,226,0,1,0,131,2,178,0,1,1,1,255,59,0,1,0,135,3,152,0,1,0,255,255,64,0,1,0,159,0,0,0,1,0,159,0,49,0,1,0,136,1,216,0,1,0,238,0,49,0,1,0,137,1,196,0,1,0,137,2,203,0,1,0,138,2,150,0,1,0,140,2,198,0,1,0,143,2,190,0,1,0,124,2,193,0,1,0,137,2,117,0,1,0,137,3,43,0,1,0,138,255,64,0,1,0,105,2,202,0,1,0,126,2,239,0,1,0,137,2,150,0,1,2,13,0,0,0,1,1,151,1,207,0,1,0,142,2,121,0,1,0,243,0,0,0,1,0,125,1,207,0,1,0,125,0,0,0,1,0,125,1,196,0,1,0,125,2,191,0,1,1,26,0,0,0,1,0,119,2,175,0,1,0,248,254,219,0,1,0,130,0,0,0,1,0,146,2,208,0,1,1,11,1,216,0,1,0,154,3,177,0,1,0,111,254,219,0,1,0,128,255,64,0,1,1,231,0,0,0,1,1,113,1,207,0,1,0,130,255,113,0,1,0,159,2,208,0,1,1,24,1,216,0,1,1,182,0,0,0,1,1,179,1,196,0,1,1,180,255,64,0,1,1,37,0,0,0,1,1,54,1,196,0,1,1,62,2,203,0,1,1,33,2,198,0,1,1,9,254,219,0,1,1,54,2,80,0,1,1,35,255,64,0,1,1,35,0,0,0,1,1,52,1,216,0,1,3,23,0,0,0,1,2,161,1,207,0,1,1,37,255,113,0,1,0,249,0,0,0,1,0,249,0,226,0,1,1,62,0,40,0,1,0,249,1,196,0,1,1,222,1,196,0,1,1,25,2,203,0,1,1,8,2,150,0,1,1,10,2,198,0,1,0,251,2,191,0,1,0,248,2,233,0,1,0,245,255,64,0,1,0,247,2,243,0,1,1,1,2,242,0,1,0,254,2,232,0,1,0,236,2,193,0,1,0,250,2,107,0,1,0,249,2,241,0,1,0,249,2,244,0,1,0,246,255,64,0,1,0,224,2,202,0,1,0,253,2,239,0,1,1,8,2,239,0,1,0,249,2,193,0,1,0,249,2,150,0,1,0,251,2,121,0,1,0,249,3,49,0,1,0,249,2,235,0,1,0,255,1,216,0,1,1,29,2,203,0,1,0,249,3,4,0,1,0,249,2,233,0,1,1,149,1,216,0,1,1,124,0,0,0,1,1,35,1,196,0,1,0,217,0,0,0,1,0,217,1,207,0,1,0,149,0,0,0,1,1,16,1,196,0,1,0,160,0,0,0,1,0,222,1,196,0,1,0,173,2,203,0,1,0,225,2,198,0,1,0,148,254,219,0,1,0,209,2,193,0,1,0,158,255,64,0,1,0,222,2,150,0,1,0,160,255,113,0,1,0,201,0,0,0,1,0,201,1,196,0,1,0,241,2,203,0,1,0,201,2,246,0,1,0,212,2,198,0,1,0,201,2,234,0,1,0,187,255,23,0,1,0,201,2,191,0,1,0,189,254,219,0,1,0,201,2,80,0,1,0,199,255,64,0,1,0,195,0,0,0,1,0,167,0,236,0,1,0,164,1,215,0,1,0,172,255,23,0,1,0,164,254,219,0,1,0,164,2,136,0,1,0,193,255,64,0,1,0,195,255,113,0,1,1,224,0,41,0,1,1,15,1,196,0,1,1,30,2,203,0,1,1,16,2,150,0,1,1,18,2,198,0,1,1,0,2,191,0,1,1,2,2,193,0,1,0,255,2,107,0,1,1,16,3,43,0,1,1,16,3,16,0,1,1,17,2,241,0,1,0,229,2,202,0,1,1,5,2,239,0,1,1,20,0,0,0,1,1,20,1,196,0,1,1,14,255,64,0,1,1,19,2,239,0,1,1,15,2,193,0,1,1,15,2,150,0,1,1,0,2,121,0,1,1,15,2,219,0,1,1,0,2,196,0,1,1,15,3,4,0,1,1,14,1,196,0,1,1,89,0,0,0,1,1,138,1,196,0,1,1,128,2,203,0,1,1,98,2,191,0,1,1,97,2,107,0,1,1,71,2,202,0,1,0,199,1,196,0,1,1,67,0,0,0,1,0,223,1,196,0,1,0,230,2,191,0,1,0,229,2,107,0,1,0,223,2,80,0,1,0,203,2,202,0,1,1,1,2,239,0,1,0,223,2,121,0,1,0,210,0,0,0,1,0,245,1,196,0,1,1,9,2,203,0,1,0,236,2,198,0,1,0,235,2,80,0,1,0,208,255,64,0,1,1,151,2,203,0,1,0,139,0,0,0,1,1,36,0,40,0,1,0,187,2,135,0,1,0,255,0,0,0,1,1,203,0,10,0,1,0,255,1,241,0,1,0,255,2,248,0,1,0,255,2,195,0,1,0,255,3,73,0,1,0,253,255,64,0,1,1,0,3,53,0,1,1,0,3,77,0,1,0,254,3,40,0,1,0,255,2,243,0,1,1,5,2,215,0,1,0,255,3,57,0,1,0,255,3,67,0,1,0,255,3,66,0,1,0,255,3,56,0,1,0,242,2,238,0,1,0,255,2,152,0,1,0,227,2,247,0,1,2,177,0,0,0,1,2,177,1,241,0,1,0,255,2,166,0,1,1,5,2,221,0,1,0,254,2,218,0,1,0,255,2,141,0,1,1,94,0,0,0,1,1,195,1,241,0,1,1,195,2,248,0,1,1,41,1,241,0,1,1,41,2,248,0,1,1,41,2,243,0,1,1,24,255,23,0,1,1,47,2,215,0,1,1,41,2,125,0,1,1,42,0,0,0,1,1,42,0,249,0,1,1,42,1,241,0,1,1,42,2,243,0,1,1,40,255,64,0,1,1,42,255,113,0,1,3,73,0,0,0,1,3,73,2,243,0,1,0,254,0,0,0,1,1,134,0,32,0,1,1,0,1,241,0,1,1,0,2,248,0,1,1,23,2,185,0,1,1,0,2,243,0,1,1,7,255,23,0,1,1,0,2,195,0,1,1,6,2,215,0,1,1,7,3,12,0,1,0,252,255,64,0,1,1,0,3,67,0,1,1,0,3,66,0,1,1,0,3,56,0,1,0,243,2,238,0,1,1,0,2,152,0,1,1,0,2,125,0,1,0,228,2,247,0,1,0,246,3,8,0,1,1,0,2,166,0,1,1,0,3,94,0,1,1,0,3,24,0,1,1,0,2,141,0,1,1,66,0,0,0,1,1,66,2,101,0,1,2,94,0,0,0,1,2,221,0,10,0,1,2,96,1,241,0,1,2,174,0,0,0,1,2,155,0,249,0,1,2,155,1,241,0,1,3,100,1,241,0,1,1,27,0,0,0,1,1,47,1,241,0,1,1,47,2,195,0,1,1,47,2,243,0,1,1,40,2,225,0,1,1,24,254,219,0,1,1,47,2,125,0,1,1,47,2,166,0,1,1,64,0,0,0,1,1,64,0,249,0,1,1,64,1,241,0,1,1,64,255,59,0,1,1,63,2,251,0,1,1,62,255,64,0,1,1,31,0,10,0,1,0,162,1,241,0,1,0,162,2,248,0,1,1,209,0,0,0,1,1,209,2,248,0,1,0,165,2,185,0,1,0,162,2,243,0,1,0,168,2,215,0,1,0,149,2,238,0,1,0,162,2,162,0,1,0,162,3,30,0,1,0,162,2,125,0,1,0,134,2,247,0,1,0,162,2,195,0,1,1,251,0,0,0,1,1,251,1,241,0,1,0,162,2,166,0,1,0,146,0,0,0,1,0,146,1,241,0,1,0,153,2,225,0,1,1,19,254,219,0,1,0,240,0,0,0,1,0,221,0,249,0,1,0,221,1,241,0,1,1,166,1,241,0,1,0,221,2,248,0,1,0,245,254,219,0,1,0,238,255,64,0,1,2,76,0,0,0,1,2,76,1,241,0,1,0,240,255,113,0,1,0,233,0,249,0,1,0,233,1,241,0,1,1,178,1,241,0,1,1,102,0,0,0,1,1,102,1,241,0,1,1,100,255,64,0,1,1,51,0,0,0,1,1,51,1,241,0,1,1,51,2,248,0,1,1,51,2,243,0,1,1,46,254,219,0,1,1,51,2,125,0,1,1,49,255,64,0,1,2,248,0,0,0,1,2,248,1,241,0,1,1,51,255,113,0,1,1,51,2,141,0,1,1,37,0,249,0,1,1,37,1,241,0,1,2,53,1,241,0,1,1,37,2,248,0,1,1,37,2,195,0,1,1,37,2,243,0,1,1,43,2,215,0,1,1,37,3,57,0,1,1,37,3,67,0,1,1,37,3,66,0,1,1,37,3,56,0,1,1,24,2,238,0,1,1,37,2,152,0,1,1,37,3,30,0,1,1,37,3,33,0,1,1,9,2,247,0,1,1,27,3,8,0,1,1,43,0,0,0,1,1,43,1,241,0,1,1,43,2,248,0,1,1,15,2,247,0,1,1,33,3,8,0,1,1,43,2,141,0,1,1,37,2,238,0,1,1,37,2,166,0,1,1,37,3,94,0,1,1,37,3,24,0,1,1,37,2,141,0,1,1,37,3,49,0,1,1,37,3,22,0,1,0,240,1,241,0,1,1,12,1,241,0,1,1,12,2,248,0,1,1,12,2,243,0,1,1,11,254,219,0,1,0,255,2,238,0,1,1,27,255,64,0,1,1,12,2,195,0,1,1,29,255,113,0,1,0,230,0,0,0,1,0,230,1,241,0,1,0,230,2,248,0,1,0,230,3,35,0,1,0,230,2,243,0,1,0,230,3,27,0,1,0,216,255,23,0,1,0,251,2,225,0,1,0,208,254,219,0,1,0,230,2,125,0,1,0,228,255,64,0,1,0,237,0,0,0,1,0,237,0,249,0,1,0,237,1,241,0,1,0,237,2,243,0,1,0,236,255,23,0,1,0,228,254,219,0,1,0,237,2,152,0,1,0,235,255,64,0,1,0,237,255,113,0,1,1,32,0,0,0,1,2,5,0,10,0,1,1,32,1,241,0,1,2,43,1,241,0,1,1,32,2,248,0,1,1,28,2,185,0,1,1,32,2,243,0,1,1,38,2,215,0,1,1,19,2,238,0,1,1,32,2,152,0,1,1,4,2,247,0,1,1,65,2,243,0,1,1,16,2,252,0,1,1,30,3,8,0,1,1,32,2,238,0,1,1,32,2,195,0,1,1,32,2,166,0,1,1,32,3,8,0,1,1,38,2,221,0,1,1,32,3,49,0,1,1,141,0,0,0,1,1,141,1,241,0,1,1,141,2,248,0,1,1,147,2,215,0,1,1,141,2,152,0,1,1,113,2,247,0,1,0,238,0,0,0,1,0,231,0,181,0,1,0,238,1,241,0,1,0,238,2,248,0,1,0,244,2,215,0,1,0,238,2,152,0,1,0,238,2,125,0,1,0,236,255,64,0,1,0,210,2,247,0,1,0,228,3,8,0,1,0,238,2,166,0,1,0,238,2,141,0,1,0,245,1,241,0,1,0,245,2,248,0,1,0,245,2,243,0,1,0,245,2,125,0,1,0,235,1,218,0,1,1,7,1,216,0,1,1,9,0,0,0,1,1,21,0,236,0,1,0,128,2,198,0,1,0,140,0,0,0,1,1,138,1,216,0,1,0,199,1,207,0,1,0,239,0,0,0,1,1,11,1,216,0,1,1,4,1,216,0,1,0,245,255,41,0,1,1,8,1,216,0,1,1,179,1,207,0,1,1,35,1,216,0,1,1,16,1,216,0,1,0,152,1,216,0,1,0,134,2,19,0,1,1,15,1,216,0,1,1,14,1,218,0,1,0,245,1,216,0,1,0,0,0,0,0,1,15,88,18,120,0,3,0,12,1,34,0,69,0,1,1,108,0,1,1,114,0,1,1,108,0,1,1,108,0,1,1,120,0,1,1,108,0,1,1,108,0,1,1,126,0,1,1,132,0,1,1,138,0,1,1,144,0,1,1,150,0,1,1,108,0,1,1,108,0,1,1,156,0,1,1,120,0,1,1,120,0,1,1,120,0,1,1,120,0,1,1,120,0,1,1,120,0,1,1,120,0,1,1,162,0,1,1,168,0,1,1,174,0,1,1,180,0,0,1,72,0,0,1,78,0,0,1,84,0,0,1,90,0,0,1,78,0,0,1,96,0,2,2,38,0,1,1,186,0,1,1,186,0,1,1,192,0,1,1,186,0,1,1,198,0,1,1,204,0,1,1,210,0,1,1,216,0,1,1,186,0,1,1,186,0,1,1,222,0,1,1,228,0,1,1,198,0,1,1,198,0,1,1,198,0,1,1,234,0,1,1,198,0,1,1,198,0,1,1,198,0,1,1,240,0,2,2,38,0,1,1,246,0,1,1,252,0,1,2,2,0,1,1,108,0,0,1,102,0,1,2,8,0,1,2,14,0,1,1,108,0,1,1,162,0,1,1,162,0,1,1,162,0,1,2,20,0,1,2,26,0,1,2,32,0,1,1,108,0,3,0,8,0,22,0,36,0,2,1,14,1,20,0,0,1,26,1,32,0,0,0,2,1,24,1,30,0,0,1,36,1,42,0,0,0,2,1,34,1,46,1,40,1,52,1,64,1,58,0,1,255,60,0,0,0,1,255,57,0,0,0,1,255,55,0,0,0,1,255,42,0,0,0,1,255,58,0,0,0,1,255,97,0,0,0,1,255,57,1,196,0,1,255,56,1,26,0,1,255,58,1,196,0,1,255,56,1,196,0,1,255,86,1,196,0,1,255,43,1,196,0,1,255,46,1,216,0,1,255,51,1,217,0,1,255,51,1,216,0,1,255,56,1,216,0,1,255,90,1,196,0,1,255,78,1,196,0,1,255,175,1,196,0,1,255,57,2,125,0,1,255,58,2,140,0,1,255,58,2,125,0,1,255,69,2,135,0,1,255,75,2,125,0,1,255,58,2,135,0,1,255,57,2,135,0,1,255,56,2,135,0,1,255,58,2,130,0,1,255,140,2,135,0,1,255,74,1,206,0,1,255,63,1,216,0,1,255,164,1,196,0,1,255,64,1,196,0,1,255,57,1,197,0,1,255,51,1,196,0,1,255,50,1,196,0,1,255,60,1,196,0,1,255,23,0,243,0,1,0,240,0,0,0,1,0,240,1,196,0,1,2,207,0,0,0,1,2,207,1,196,0,1,0,192,0,0,0,1,0,192,1,196,0,1,2,63,0,0,0,1,2,63,1,196,0,1,0,248,0,0,0,1,0,0,0,0,0,1,0,248,1,196,0,1,2,231,0,0,0,1,0,0,0,0,0,1,2,231,1,196,0,1,15,246,16,8,0,1,0,12,0,42,0,7,0,0,0,46,0,0,0,52,0,0,0,58,0,0,0,64,0,0,0,52,0,0,0,70,0,0,0,76,0,7,0,52,0,58,0,64,0,70,0,76,0,82,0,88,0,1,255,60,0,0,0,1,255,57,0,0,0,1,255,55,0,0,0,1,255,42,0,0,0,1,255,58,0,0,0,1,255,97,0,0,0,1,255,58,255,64,0,1,255,57,255,8,0,1,255,37,254,219,0,1,255,51,255,23,0,1,255,57,255,59,0,1,255,58,255,113,0,1,0,193,255,23,0,1,15,146,15,180,0,1,0,12,0,254,0,60,0,0,1,106,0,0,1,112,0,0,1,106,0,0,1,106,0,0,1,118,0,0,1,106,0,0,1,106,0,0,1,124,0,0,1,130,0,0,1,136,0,0,1,142,0,0,1,148,0,0,1,106,0,0,1,106,0,0,1,154,0,0,1,118,0,0,1,118,0,0,1,118,0,0,1,118,0,0,1,118,0,0,1,118,0,0,1,118,0,0,1,160,0,0,1,166,0,0,1,172,0,0,1,178,0,0,1,184,0,0,1,184,0,0,1,190,0,0,1,184,0,0,1,196,0,0,1,202,0,0,1,208,0,0,1,214,0,0,1,184,0,0,1,184,0,0,1,220,0,0,1,226,0,0,1,196,0,0,1,196,0,0,1,196,0,0,1,232,0,0,1,196,0,0,1,196,0,0,1,196,0,0,1,238,0,0,1,244,0,0,1,250,0,0,2,0,0,0,1,106,0,0,2,6,0,0,2,12,0,0,1,106,0,0,1,160,0,0,1,160,0,0,1,160,0,0,2,18,0,0,2,24,0,0,2,30,0,0,1,106,0,59,1,50,1,56,1,56,1,62,1,68,1,74,1,80,1,86,1,92,1,98,1,104,1,110,1,116,1,122,1,128,1,134,1,140,1,68,1,146,1,152,1,158,1,164,1,170,1,176,1,182,1,188,1,194,1,200,1,206,1,212,1,218,1,224,1,230,1,236,1,242,1,248,1,254,2,4,2,10,2,16,2,22,1,134,2,28,2,28,1,230,2,34,2,40,2,46,2,52,2,52,2,58,2,64,2,70,2,76,2,82,2,46,2,88,2,40,2,94,0,1,255,57,1,196,0,1,255,56,1,26,0,1,255,58,1,196,0,1,255,56,1,196,0,1,255,86,1,196,0,1,255,43,1,196,0,1,255,46,1,216,0,1,255,51,1,217,0,1,255,51,1,216,0,1,255,56,1,216,0,1,255,90,1,196,0,1,255,78,1,196,0,1,255,175,1,196,0,1,255,57,2,125,0,1,255,58,2,140,0,1,255,58,2,125,0,1,255,69,2,135,0,1,255,75,2,125,0,1,255,58,2,135,0,1,255,57,2,135,0,1,255,56,2,135,0,1,255,58,2,130,0,1,255,140,2,135,0,1,255,74,1,206,0,1,255,63,1,216,0,1,255,164,1,196,0,1,255,64,1,196,0,1,255,57,1,197,0,1,255,51,1,196,0,1,255,50,1,196,0,1,255,60,1,196,0,1,255,57,2,107,0,1,255,57,3,43,0,1,255,57,3,16,0,1,255,58,2,241,0,1,255,57,2,80,0,1,255,57,2,244,0,1,255,28,2,202,0,1,255,86,2,203,0,1,255,43,2,193,0,1,255,57,2,191,0,1,255,57,2,198,0,1,255,57,2,150,0,1,255,57,2,196,0,1,255,58,2,96,0,1,255,58,2,233,0,1,255,58,3,4,0,1,255,58,2,121,0,1,255,58,2,235,0,1,255,58,3,49,0,1,255,46,2,239,0,1,255,77,2,193,0,1,255,78,2,150,0,1,255,175,2,139,0,1,255,57,3,40,0,1,255,57,3,170,0,1,255,58,3,185,0,1,255,57,3,51,0,1,255,58,3,117,0,1,255,19,3,73,0,1,255,75,2,249,0,1,255,109,3,69,0,1,255,57,3,78,0,1,255,57,2,241,0,1,255,57,3,50,0,1,255,57,3,70,0,1,255,58,3,52,0,1,255,58,3,167,0,1,255,58,3,194,0,1,255,58,3,175,0,1,255,58,3,169,0,1,255,74,2,127,0,1,0,200,2,121,0,1,0,170,2,202,0,1,0,228,2,203,0,1,0,199,2,150,0,1,0,199,2,198,0,1,0,199,2,191,0,1,0,199,2,107,0,1,0,199,2,80,0,1,0,149,2,193,0,1,0,199,2,196,0,1,12,140,12,140,0,1,0,12,0,18,0,1,0,0,0,10,0,1,0,10,0,1,255,116,1,196,0,1,255,116,1,196,0,1,12,14,12,112,0,1,0,12,0,254,0,60,0,0,1,28,0,0,1,34,0,0,1,28,0,0,1,28,0,0,1,40,0,0,1,28,0,0,1,28,0,0,1,46,0,0,1,52,0,0,1,58,0,0,1,64,0,0,1,70,0,0,1,28,0,0,1,28,0,0,1,76,0,0,1,40,0,0,1,40,0,0,1,40,0,0,1,40,0,0,1,40,0,0,1,40,0,0,1,40,0,0,1,82,0,0,1,88,0,0,1,94,0,0,1,100,0,0,1,106,0,0,1,106,0,0,1,112,0,0,1,106,0,0,1,118,0,0,1,124,0,0,1,130,0,0,1,136,0,0,1,106,0,0,1,106,0,0,1,142,0,0,1,148,0,0,1,118,0,0,1,118,0,0,1,118,0,0,1,154,0,0,1,118,0,0,1,118,0,0,1,118,0,0,1,160,0,0,1,166,0,0,1,172,0,0,1,178,0,0,1,28,0,0,1,184,0,0,1,190,0,0,1,28,0,0,1,82,0,0,1,82,0,0,1,82,0,0,1,196,0,0,1,202,0,0,1,208,0,0,1,28,0,20,0,228,0,234,0,240,0,246,0,252,1,2,1,8,1,14,1,20,1,26,1,32,1,38,1,44,1,50,1,50,1,56,1,56,1,62,1,68,1,74,0,1,255,57,1,196,0,1,255,56,1,26,0,1,255,58,1,196,0,1,255,56,1,196,0,1,255,86,1,196,0,1,255,43,1,196,0,1,255,46,1,216,0,1,255,51,1,217,0,1,255,51,1,216,0,1,255,56,1,216,0,1,255,90,1,196,0,1,255,78,1,196,0,1,255,175,1,196,0,1,255,57,2,125,0,1,255,58,2,140,0,1,255,58,2,125,0,1,255,69,2,135,0,1,255,75,2,125,0,1,255,58,2,135,0,1,255,57,2,135,0,1,255,56,2,135,0,1,255,58,2,130,0,1,255,140,2,135,0,1,255,74,1,206,0,1,255,63,1,216,0,1,255,164,1,196,0,1,255,64,1,196,0,1,255,57,1,197,0,1,255,51,1,196,0,1,255,50,1,196,0,1,255,60,1,196,0,1,255,164,2,196,0,1,0,207,2,196,0,1,0,209,2,196,0,1,0,79,2,196,0,1,0,195,2,196,0,1,0,200,2,196,0,1,0,222,2,202,0,1,0,202,2,202,0,1,0,219,2,202,0,1,0,245,2,201,0,1,0,235,2,201,0,1,0,227,2,195,0,1,0,230,2,195,0,1,0,218,3,10,0,1,0,217,3,19,0,1,0,197,2,218,0,1,0,232,2,200,0,1,0,221,2,202,0,1,9,192,10,62,0,1,0,12,0,254,0,60,0,0,1,4,0,0,1,10,0,0,1,4,0,0,1,4,0,0,1,16,0,0,1,4,0,0,1,4,0,0,1,22,0,0,1,28,0,0,1,34,0,0,1,40,0,0,1,46,0,0,1,4,0,0,1,4,0,0,1,52,0,0,1,16,0,0,1,16,0,0,1,16,0,0,1,16,0,0,1,16,0,0,1,16,0,0,1,16,0,0,1,58,0,0,1,64,0,0,1,70,0,0,1,76,0,0,1,82,0,0,1,82,0,0,1,88,0,0,1,82,0,0,1,94,0,0,1,100,0,0,1,106,0,0,1,112,0,0,1,82,0,0,1,82,0,0,1,118,0,0,1,124,0,0,1,94,0,0,1,94,0,0,1,94,0,0,1,130,0,0,1,94,0,0,1,94,0,0,1,94,0,0,1,136,0,0,1,142,0,0,1,148,0,0,1,154,0,0,1,4,0,0,1,160,0,0,1,166,0,0,1,4,0,0,1,58,0,0,1,58,0,0,1,58,0,0,1,172,0,0,1,178,0,0,1,184,0,0,1,4,0,8,0,204,0,204,0,210,0,216,0,222,0,228,0,234,0,240,0,1,255,57,1,196,0,1,255,56,1,26,0,1,255,58,1,196,0,1,255,56,1,196,0,1,255,86,1,196,0,1,255,43,1,196,0,1,255,46,1,216,0,1,255,51,1,217,0,1,255,51,1,216,0,1,255,56,1,216,0,1,255,90,1,196,0,1,255,78,1,196,0,1,255,175,1,196,0,1,255,57,2,125,0,1,255,58,2,140,0,1,255,58,2,125,0,1,255,69,2,135,0,1,255,75,2,125,0,1,255,58,2,135,0,1,255,57,2,135,0,1,255,56,2,135,0,1,255,58,2,130,0,1,255,140,2,135,0,1,255,74,1,206,0,1,255,63,1,216,0,1,255,164,1,196,0,1,255,64,1,196,0,1,255,57,1,197,0,1,255,51,1,196,0,1,255,50,1,196,0,1,255,60,1,196,0,1,255,57,3,28,0,1,255,57,3,52,0,1,255,55,3,15,0,1,255,51,3,12,0,1,255,50,3,22,0,1,255,60,3,21,0,1,255,57,3,11,0,2,0,3,0,3,0,253,0,0,3,30,3,124,0,251,4,61,4,217,1,90,0,1,0,12,7,12,7,13,7,17,7,18,7,25,7,26,7,56,7,61,7,213,7,215,7,216,7,217,0,1,0,1,0,2,0,2,0,71,0,3,0,122,0,0,0,124,0,185,0,120,0,187,0,246,0,182,1,40,1,40,0,242,1,92,1,92,0,243,1,96,1,96,0,244,1,98,1,98,0,245,1,108,1,108,0,246,1,119,1,120,0,247,1,236,1,240,0,249,2,4,2,72,0,254,2,75,2,110,1,67,2,112,2,190,1,103,2,192,2,249,1,182,3,30,3,30,1,240,3,32,3,32,1,241,3,37,3,56,1,242,3,58,3,59,2,6,3,61,3,61,2,8,3,63,3,63,2,9,3,66,3,66,2,10,3,69,3,74,2,11,3,76,3,77,2,17,3,80,3,82,2,19,3,85,3,89,2,22,3,92,3,96,2,27,3,98,3,98,2,32,3,100,3,117,2,33,3,119,3,124,2,51,3,169,3,169,2,57,3,173,3,173,2,58,3,222,3,222,2,59,3,224,3,224,2,60,3,229,3,248,2,61,3,250,3,251,2,81,3,253,3,253,2,83,3,255,3,255,2,84,4,5,4,10,2,85,4,12,4,13,2,91,4,16,4,18,2,93,4,21,4,25,2,96,4,28,4,32,2,101,4,34,4,53,2,106,4,55,4,57,2,126,4,59,4,59,2,129,4,61,4,62,2,130,4,64,4,80,2,132,4,82,4,83,2,149,4,85,4,90,2,151,4,92,4,93,2,157,4,95,4,171,2,159,5,127,5,128,2,236,5,130,5,147,2,238,5,149,5,150,3,0,5,152,5,158,3,2,5,160,5,162,3,9,5,165,5,208,3,12,5,210,6,6,3,56,6,30,6,68,3,109,6,70,6,80,3,148,7,7,7,7,3,159,7,21,7,22,3,160,7,57,7,60,3,162,7,186,7,186,3,166,7,191,7,191,3,167,7,193,7,195,3,168,7,197,7,200,3,171,7,205,7,205,3,175,7,242,7,242,3,176,8,9,8,9,3,177,8,43,8,44,3,178,0,2,0,42,0,254,1,33,0,0,1,41,1,75,0,36,1,77,1,78,0,71,1,80,1,83,0,73,1,85,1,85,0,77,1,87,1,90,0,78,1,93,1,95,0,82,1,99,1,101,0,85,1,111,1,118,0,88,1,121,1,139,0,96,1,146,1,160,0,115,1,162,1,172,0,130,1,174,1,181,0,141,1,191,1,235,0,149,1,253,1,253,0,194,2,3,2,3,0,195,3,125,3,126,0,196,3,131,3,135,0,198,3,137,3,148,0,203,3,150,3,158,0,215,3,161,3,161,0,224,3,164,3,168,0,225,3,170,3,172,0,230,3,175,3,177,0,233,3,180,3,180,0,236,3,182,3,185,0,237,3,187,3,194,0,241,3,196,3,203,0,249,3,205,3,212,1,1,3,214,3,214,1,9,3,216,3,216,1,10,3,220,3,221,1,11,4,224,4,224,1,13,4,229,4,229,1,14,4,232,4,232,1,15,4,234,4,234,1,16,4,239,4,239,1,17,4,249,4,249,1,18,4,253,4,253,1,19,5,0,5,0,1,20,5,36,5,58,1,21,5,75,5,84,1,44,0,1,0,18,7,9,7,10,7,12,7,13,7,17,7,18,7,25,7,26,7,42,7,43,7,46,7,56,7,61,7,76,7,213,7,215,7,216,7,217,0,1,0,8,3,17,3,18,3,24,6,124,6,129,6,132,6,134,6,139,0,1,0,44,3,31,3,33,3,34,3,35,3,36,3,57,3,60,3,62,3,64,3,65,3,67,3,68,3,75,3,78,3,79,3,83,3,84,3,90,3,91,3,97,3,99,3,118,3,225,3,226,3,227,3,228,3,249,3,252,3,254,4,3,4,4,4,11,4,14,4,15,4,19,4,20,4,26,4,27,4,33,4,54,4,63,4,81,5,129,5,148,0,1,0,16,3,127,3,128,3,129,3,130,3,136,3,149,3,159,3,160,3,162,3,163,3,178,3,181,3,186,3,204,3,213,3,219,0,1,0,2,4,0,4,1,0,1,0,28,6,94,6,96,6,97,6,98,6,101,6,103,6,104,6,107,6,108,6,110,6,111,6,112,6,113,6,114,6,115,6,116,6,117,6,118,6,120,6,122,6,123,6,128,6,130,6,133,6,136,6,137,6,140,6,142,0,2,0,12,4,84,4,84,0,0,4,91,4,91,0,1,4,172,4,217,0,2,4,226,4,226,0,48,4,243,4,245,0,49,5,59,5,74,0,52,5,151,5,151,0,68,5,159,5,159,0,69,5,209,5,209,0,70,6,7,6,29,0,71,6,69,6,69,0,94,6,81,6,92,0,95,0,2,0,12,4,218,4,218,0,0,4,220,4,223,0,1,4,227,4,228,0,5,4,230,4,231,0,7,4,233,4,233,0,9,4,236,4,238,0,10,4,240,4,242,0,13,4,246,4,248,0,16,4,250,4,252,0,19,5,1,5,35,0,22,5,85,5,123,0,57,5,125,5,126,0,96,0,2,0,5,7,186,7,211,0,0,7,213,7,216,0,26,7,218,7,242,0,30,8,11,8,14,0,55,8,41,8,50,0,59,0,1,0,19,7,84,7,85,7,86,7,88,7,93,7,95,7,99,7,100,7,101,7,102,7,107,7,128,7,176,8,51,8,52,8,54,8,55,8,56,8,57,0,2,0,3,7,186,7,242,0,0,8,11,8,14,0,57,8,41,8,50,0,61,0,2,0,50,3,30,3,30,0,0,3,32,3,34,0,1,3,37,3,46,0,4,3,48,3,50,0,14,3,52,3,56,0,17,3,58,3,59,0,22,3,66,3,66,0,24,3,69,3,69,0,25,3,71,3,74,0,26,3,77,3,77,0,30,3,85,3,86,0,31,3,90,3,90,0,33,3,93,3,95,0,34,3,97,3,97,0,37,3,100,3,112,0,38,3,114,3,117,0,51,3,119,3,125,0,55,3,128,3,129,0,62,3,132,3,141,0,64,3,145,3,145,0,74,3,147,3,148,0,75,3,150,3,151,0,77,3,153,3,154,0,79,3,161,3,161,0,81,3,164,3,164,0,82,3,166,3,172,0,83,3,176,3,177,0,90,3,180,3,182,0,92,3,188,3,192,0,95,3,194,3,194,0,100,3,196,3,196,0,101,3,198,3,216,0,102,3,219,3,220,0,121,3,222,3,222,0,123,3,224,3,226,0,124,3,229,3,238,0,127,3,240,3,242,0,137,3,244,3,248,0,140,3,250,3,251,0,145,4,2,4,2,0,147,4,5,4,5,0,148,4,7,4,10,0,149,4,13,4,13,0,153,4,21,4,22,0,154,4,26,4,26,0,156,4,29,4,31,0,157,4,33,4,33,0,160,4,35,4,48,0,161,4,50,4,53,0,175,4,55,4,60,0,179,0,2,0,39,4,61,4,63,0,0,4,65,4,70,0,3,4,72,4,73,0,9,4,75,4,75,0,11,4,77,4,77,0,12,4,79,4,80,0,13,4,82,4,218,0,15,4,222,4,222,0,152,4,224,4,224,0,153,4,226,4,226,0,154,4,232,4,232,0,155,4,234,4,234,0,156,4,238,4,238,0,157,4,242,4,253,0,158,5,3,5,123,0,170,5,127,5,128,1,35,5,131,5,133,1,37,5,135,5,136,1,40,5,138,5,139,1,42,5,141,5,141,1,44,5,143,5,143,1,45,5,146,5,147,1,46,5,149,5,149,1,48,5,151,5,162,1,49,5,164,6,92,1,61,6,94,6,96,1,246,6,98,6,103,1,249,6,105,6,106,1,255,6,108,6,108,2,1,6,110,6,110,2,2,6,112,6,113,2,3,6,115,6,118,2,5,6,122,6,122,2,9,6,124,6,124,2,10,6,126,6,126,2,11,6,132,6,132,2,12,6,134,6,134,2,13,6,138,6,138,2,14,6,142,6,142,2,15,0,2,0,26,0,3,0,40,0,0,0,42,0,42,0,38,0,44,0,122,0,39,0,124,0,163,0,118,0,165,0,176,0,158,0,178,0,185,0,170,0,187,0,218,0,178,0,220,1,19,0,210,1,21,1,34,1,10,1,36,1,61,1,24,1,63,1,100,1,50,1,102,1,139,1,88,1,141,1,144,1,126,1,146,1,172,1,130,1,174,1,181,1,157,1,183,1,214,1,165,1,216,1,252,1,197,2,4,2,41,1,234,2,43,2,43,2,16,2,45,2,128,2,17,2,130,2,169,2,101,2,171,2,190,2,141,2,192,2,223,2,161,2,225,2,255,2,193,3,1,3,21,2,224,3,23,3,29,2,245,0,1,0,3,1,253,1,254,2,3,0,1,0,7,7,213,7,214,7,215,7,216,7,218,7,219,8,14,0,1,0,7,7,213,7,214,7,215,7,216,7,218,7,219,8,0,0,2,0,5,7,186,7,211,0,0,7,221,7,240,0,26,7,242,7,242,0,46,8,11,8,13,0,47,8,41,8,50,0,50,0,2,0,9,7,186,7,195,0,0,7,197,7,211,0,10,7,221,7,240,0,25,7,242,7,242,0,45,7,245,7,246,0,46,7,250,7,250,0,48,7,253,7,255,0,49,8,1,8,6,0,52,8,8,8,8,0,58,0,1,0,1,7,212,0,2,0,4,8,12,8,12,0,0,8,17,8,32,0,1,8,36,8,37,0,17,8,40,8,40,0,19,0,2,0,1,8,43,8,50,0,0,0,2,0,0,0,1,0,2,0,1,0,1,0,2,0,7,7,12,7,13,0,1,7,17,7,18,0,1,7,25,7,26,0,1,7,56,7,56,0,1,7,61,7,61,0,1,7,213,7,213,0,1,7,215,7,217,0,1,0,2,1,9,0,29,0,30,0,3,0,31,0,31,0,1,0,32,0,38,0,2,0,39,0,39,0,10,0,40,0,40,0,19,0,41,0,45,0,10,0,46,0,46,0,22,0,47,0,69,0,3,0,70,0,70,0,4,0,71,0,77,0,5,0,78,0,83,0,6,0,84,0,84,0,7,0,85,0,99,0,6,0,100,0,101,0,7,0,102,0,103,0,17,0,104,0,104,0,8,0,105,0,105,0,7,0,106,0,110,0,8,0,111,0,111,0,21,0,112,0,113,0,8,0,114,0,115,0,9,0,116,0,116,0,6,0,117,0,117,0,7,0,118,0,122,0,6,0,124,0,124,0,21,0,125,0,126,0,6,0,127,0,161,0,10,0,162,0,162,0,3,0,163,0,164,0,11,0,165,0,165,0,10,0,166,0,173,0,12,0,174,0,176,0,13,0,177,0,177,0,20,0,178,0,185,0,13,0,187,0,187,0,10,0,188,0,194,0,14,0,195,0,222,0,15,0,223,0,228,0,16,0,229,0,229,0,17,0,230,0,239,0,18,0,240,0,244,0,19,0,245,0,245,0,7,0,246,0,246,0,13,1,40,1,40,0,22,1,92,1,92,0,21,1,96,1,96,0,21,1,98,1,98,0,21,1,108,1,108,0,21,1,119,1,120,0,21,1,236,1,240,0,22,2,25,2,25,0,13,2,31,2,32,0,3,2,33,2,33,0,1,2,34,2,40,0,2,2,41,2,46,0,10,2,47,2,47,0,19,2,48,2,70,0,3,2,71,2,71,0,10,2,72,2,72,0,4,2,75,2,81,0,5,2,82,2,89,0,6,2,90,2,90,0,7,2,91,2,101,0,6,2,102,2,102,0,7,2,103,2,105,0,6,2,106,2,108,0,7,2,109,2,110,0,17,2,112,2,117,0,8,2,118,2,118,0,7,2,119,2,120,0,8,2,121,2,122,0,9,2,123,2,128,0,6,2,129,2,130,0,7,2,131,2,132,0,6,2,133,2,167,0,10,2,168,2,168,0,3,2,169,2,170,0,11,2,171,2,171,0,10,2,172,2,179,0,12,2,180,2,190,0,13,2,192,2,199,0,14,2,200,2,227,0,15,2,228,2,233,0,16,2,234,2,234,0,17,2,235,2,244,0,18,2,245,2,249,0,19,3,32,3,32,0,1,3,37,3,39,0,3,3,40,3,40,0,17,3,41,3,41,0,1,3,42,3,44,0,6,3,45,3,46,0,17,3,47,3,47,0,6,3,48,3,48,0,9,3,49,3,49,0,6,3,50,3,50,0,10,3,51,3,51,0,6,3,52,3,52,0,11,3,53,3,53,0,2,3,54,3,54,0,14,3,55,3,56,0,16,3,58,3,58,0,17,3,59,3,59,0,6,3,61,3,61,0,6,3,63,3,63,0,6,3,66,3,66,0,6,3,69,3,69,0,13,3,70,3,70,0,2,3,71,3,71,0,10,3,72,3,73,0,6,3,74,3,74,0,7,3,76,3,76,0,10,3,77,3,77,0,6,3,80,3,80,0,17,3,81,3,81,0,10,3,82,3,82,0,16,3,85,3,85,0,17,3,86,3,86,0,1,3,87,3,89,0,17,3,92,3,92,0,6,3,93,3,93,0,2,3,94,3,95,0,18,3,96,3,96,0,17,3,98,3,98,0,6,3,100,3,100,0,6,3,101,3,101,0,17,3,102,3,102,0,6,3,105,3,106,0,3,3,107,3,107,0,10,3,108,3,108,0,17,3,109,3,109,0,1,3,110,3,111,0,6,3,112,3,113,0,10,3,114,3,116,0,16,3,117,3,117,0,6,3,119,3,119,0,6,3,120,3,120,0,10,3,121,3,121,0,16,3,122,3,122,0,4,3,123,3,123,0,1,3,124,3,124,0,2,3,169,3,169,0,21,3,173,3,173,0,21,3,224,3,224,0,1,3,229,3,231,0,3,3,232,3,232,0,17,3,233,3,233,0,1,3,234,3,236,0,6,3,237,3,238,0,17,3,239,3,239,0,6,3,240,3,240,0,9,3,241,3,241,0,6,3,242,3,242,0,10,3,243,3,243,0,6,3,244,3,244,0,11,3,245,3,245,0,2,3,246,3,246,0,14,3,247,3,248,0,18,3,250,3,250,0,17,3,251,3,251,0,6,3,253,3,253,0,6,3,255,3,255,0,6,4,5,4,5,0,13,4,6,4,6,0,2,4,7,4,7,0,10,4,8,4,9,0,6,4,10,4,10,0,7,4,12,4,12,0,10,4,13,4,13,0,6,4,16,4,16,0,17,4,17,4,17,0,10,4,18,4,18,0,16,4,21,4,21,0,17,4,22,4,22,0,1,4,23,4,25,0,17,4,28,4,28,0,6,4,29,4,29,0,2,4,30,4,31,0,18,4,32,4,32,0,17,4,34,4,36,0,6,4,37,4,37,0,17,4,38,4,38,0,6,4,41,4,42,0,3,4,43,4,43,0,10,4,44,4,44,0,17,4,45,4,45,0,1,4,46,4,47,0,6,4,48,4,49,0,10,4,50,4,52,0,18,4,53,4,53,0,6,4,55,4,55,0,6,4,56,4,56,0,10,4,57,4,57,0,16,4,59,4,59,0,1,4,62,4,62,0,1,4,65,4,65,0,3,4,66,4,66,0,19,4,67,4,67,0,6,4,68,4,68,0,10,4,69,4,69,0,6,4,70,4,70,0,17,4,72,4,72,0,9,4,73,4,73,0,6,4,74,4,74,0,3,4,75,4,75,0,10,4,76,4,76,0,6,4,77,4,77,0,11,4,78,4,78,0,3,4,79,4,79,0,14,4,80,4,80,0,18,4,82,4,82,0,17,4,83,4,83,0,18,4,86,4,86,0,3,4,87,4,88,0,6,4,89,4,89,0,10,4,90,4,90,0,18,4,92,4,92,0,6,4,93,4,93,0,18,4,116,4,123,0,3,4,124,4,154,0,6,4,155,4,162,0,10,4,163,4,163,0,11,4,164,4,171,0,18,5,128,5,128,0,1,5,131,5,131,0,3,5,132,5,132,0,19,5,133,5,133,0,6,5,134,5,134,0,10,5,135,5,135,0,6,5,136,5,136,0,17,5,138,5,138,0,9,5,139,5,139,0,6,5,140,5,140,0,3,5,141,5,141,0,10,5,142,5,142,0,6,5,143,5,143,0,11,5,144,5,145,0,3,5,146,5,146,0,14,5,147,5,147,0,18,5,149,5,149,0,17,5,150,5,150,0,18,5,152,5,154,0,6,5,155,5,157,0,18,5,158,5,158,0,10,5,161,5,161,0,3,5,162,5,162,0,6,5,190,5,197,0,3,5,198,5,208,0,6,5,210,5,236,0,6,5,237,5,244,0,10,5,245,5,246,0,11,5,247,6,6,0,18,6,30,6,56,0,6,6,70,6,80,0,6,7,7,7,7,0,20,7,21,7,22,0,20,7,57,7,60,0,20,7,186,7,186,0,20,7,191,7,191,0,20,7,193,7,195,0,20,7,197,7,200,0,20,7,205,7,205,0,20,7,242,7,242,0,20,8,9,8,9,0,20,8,43,8,44,0,20,0,2,1,152,0,2,0,2,0,52,0,3,0,30,0,33,0,31,0,31,0,36,0,32,0,38,0,4,0,39,0,42,0,36,0,44,0,70,0,36,0,71,0,77,0,4,0,78,0,99,0,36,0,100,0,101,0,3,0,102,0,113,0,36,0,114,0,115,0,41,0,116,0,126,0,36,0,127,0,162,0,4,0,163,0,164,0,36,0,165,0,165,0,4,0,166,0,173,0,36,0,174,0,176,0,42,0,177,0,177,0,12,0,178,0,185,0,42,0,186,0,186,0,36,0,187,0,187,0,4,0,188,0,194,0,6,0,195,0,222,0,7,0,223,0,228,0,9,0,229,0,229,0,10,0,230,0,239,0,11,0,245,0,245,0,36,0,246,0,246,0,42,0,254,1,25,0,29,1,26,1,26,0,15,1,27,1,64,0,19,1,65,1,65,0,31,1,66,1,72,0,32,1,73,1,77,0,15,1,78,1,78,0,17,1,80,1,83,0,17,1,85,1,85,0,17,1,87,1,90,0,17,1,92,1,95,0,17,1,96,1,98,0,39,1,99,1,100,0,15,1,101,1,101,0,17,1,102,1,110,0,15,1,111,1,122,0,17,1,123,1,158,0,19,1,159,1,159,0,21,1,160,1,160,0,15,1,161,1,161,0,19,1,162,1,169,0,17,1,170,1,172,0,34,1,174,1,181,0,34,1,182,1,182,0,31,1,191,1,218,0,23,1,219,1,224,0,25,1,225,1,225,0,35,1,226,1,235,0,25,1,236,1,240,0,28,1,242,1,242,0,31,1,244,1,244,0,31,1,252,1,252,0,31,1,253,1,254,0,19,1,255,2,1,0,31,2,2,2,2,0,34,2,3,2,3,0,6,2,4,2,24,0,33,2,25,2,25,0,42,2,26,2,32,0,33,2,33,2,33,0,36,2,34,2,40,0,4,2,41,2,43,0,36,2,45,2,70,0,36,2,71,2,71,0,4,2,72,2,72,0,36,2,75,2,81,0,4,2,82,2,105,0,36,2,106,2,108,0,3,2,109,2,120,0,36,2,121,2,122,0,41,2,123,2,132,0,36,2,133,2,168,0,4,2,169,2,170,0,36,2,171,2,171,0,4,2,172,2,179,0,36,2,180,2,190,0,42,2,191,2,191,0,36,2,192,2,199,0,6,2,200,2,227,0,7,2,228,2,233,0,9,2,234,2,234,0,10,2,235,2,244,0,11,3,30,3,30,0,33,3,31,3,35,0,36,3,36,3,36,0,2,3,37,3,39,0,36,3,40,3,40,0,10,3,41,3,41,0,37,3,42,3,46,0,36,3,47,3,47,0,2,3,48,3,48,0,41,3,49,3,49,0,36,3,50,3,50,0,4,3,51,3,52,0,36,3,53,3,53,0,4,3,54,3,54,0,6,3,55,3,56,0,8,3,57,3,57,0,5,3,58,3,58,0,10,3,59,3,59,0,1,3,60,3,64,0,36,3,65,3,65,0,6,3,66,3,66,0,36,3,67,3,67,0,2,3,68,3,68,0,36,3,69,3,69,0,42,3,70,3,70,0,4,3,71,3,71,0,37,3,72,3,73,0,36,3,74,3,74,0,3,3,75,3,75,0,6,3,76,3,76,0,36,3,77,3,77,0,26,3,78,3,79,0,6,3,80,3,80,0,10,3,81,3,81,0,4,3,82,3,82,0,9,3,84,3,84,0,36,3,85,3,85,0,10,3,86,3,86,0,37,3,87,3,88,0,36,3,89,3,89,0,6,3,90,3,92,0,36,3,94,3,95,0,11,3,96,3,96,0,10,3,97,3,98,0,1,3,100,3,100,0,36,3,101,3,101,0,10,3,102,3,102,0,1,3,103,3,105,0,33,3,106,3,106,0,36,3,107,3,107,0,4,3,108,3,108,0,10,3,109,3,109,0,37,3,110,3,111,0,36,3,112,3,113,0,4,3,114,3,116,0,8,3,117,3,117,0,1,3,118,3,119,0,36,3,120,3,120,0,4,3,121,3,121,0,9,3,122,3,122,0,36,3,124,3,124,0,4,3,125,3,125,0,29,3,126,3,126,0,4,3,127,3,130,0,17,3,131,3,131,0,43,3,132,3,134,0,19,3,135,3,135,0,35,3,137,3,141,0,17,3,142,3,142,0,44,3,143,3,144,0,17,3,145,3,145,0,19,3,146,3,146,0,17,3,147,3,147,0,21,3,148,3,148,0,19,3,149,3,149,0,47,3,150,3,151,0,25,3,152,3,152,0,19,3,153,3,153,0,35,3,154,3,154,0,23,3,155,3,159,0,17,3,160,3,160,0,47,3,161,3,161,0,17,3,162,3,162,0,44,3,163,3,163,0,17,3,164,3,164,0,34,3,165,3,165,0,19,3,166,3,166,0,45,3,167,3,168,0,17,3,169,3,169,0,39,3,170,3,170,0,15,3,171,3,171,0,17,3,172,3,172,0,35,3,174,3,174,0,47,3,175,3,175,0,35,3,176,3,176,0,19,3,177,3,177,0,25,3,178,3,178,0,46,3,179,3,179,0,17,3,180,3,180,0,35,3,182,3,183,0,17,3,184,3,184,0,47,3,185,3,187,0,17,3,188,3,188,0,19,3,189,3,190,0,25,3,191,3,191,0,35,3,192,3,193,0,23,3,194,3,194,0,15,3,196,3,196,0,35,3,197,3,197,0,23,3,198,3,200,0,29,3,201,3,202,0,19,3,203,3,203,0,35,3,205,3,206,0,17,3,207,3,208,0,19,3,209,3,211,0,25,3,212,3,212,0,23,3,213,3,214,0,17,3,215,3,215,0,19,3,216,3,216,0,25,3,220,3,221,0,19,3,222,3,222,0,33,3,224,3,227,0,36,3,228,3,228,0,2,3,229,3,231,0,36,3,232,3,232,0,10,3,233,3,233,0,37,3,234,3,238,0,36,3,239,3,239,0,2,3,240,3,240,0,41,3,241,3,241,0,36,3,242,3,242,0,4,3,243,3,244,0,36,3,245,3,245,0,4,3,246,3,246,0,6,3,247,3,248,0,11,3,249,3,249,0,5,3,250,3,250,0,10,3,251,3,251,0,1,3,252,3,255,0,36,4,3,4,3,0,2,4,4,4,4,0,36,4,5,4,5,0,42,4,6,4,6,0,4,4,7,4,7,0,37,4,8,4,9,0,36,4,10,4,10,0,3,4,11,4,11,0,6,4,12,4,12,0,36,4,13,4,13,0,26,4,14,4,15,0,6,4,16,4,16,0,10,4,17,4,17,0,4,4,18,4,18,0,9,4,20,4,20,0,36,4,21,4,21,0,10,4,22,4,22,0,37,4,23,4,24,0,36,4,25,4,25,0,6,4,26,4,28,0,36,4,30,4,31,0,11,4,32,4,32,0,10,4,33,4,34,0,1,4,35,4,36,0,36,4,37,4,37,0,10,4,38,4,38,0,1,4,39,4,41,0,33,4,42,4,42,0,36,4,43,4,43,0,4,4,44,4,44,0,10,4,45,4,45,0,37,4,46,4,47,0,36,4,48,4,49,0,4,4,50,4,52,0,11,4,53,4,53,0,1,4,54,4,55,0,36,4,56,4,56,0,4,4,57,4,57,0,9,4,59,4,59,0,37,4,61,4,61,0,33,4,62,4,63,0,36,4,64,4,64,0,33,4,65,4,65,0,36,4,67,4,67,0,36,4,68,4,68,0,4,4,69,4,70,0,36,4,71,4,71,0,33,4,72,4,72,0,41,4,73,4,73,0,36,4,74,4,74,0,38,4,75,4,75,0,4,4,76,4,77,0,36,4,78,4,78,0,10,4,79,4,79,0,6,4,80,4,80,0,11,4,81,4,81,0,5,4,82,4,82,0,10,4,83,4,83,0,11,4,84,4,84,0,40,4,89,4,89,0,4,4,91,4,91,0,40,4,92,4,92,0,36,4,93,4,93,0,11,4,105,4,107,0,33,4,116,4,133,0,12,4,134,4,134,0,36,4,143,4,152,0,12,4,153,4,154,0,36,4,164,4,171,0,11,4,172,4,181,0,48,4,182,4,182,0,40,4,183,4,190,0,48,4,191,4,191,0,33,4,200,4,200,0,36,4,201,4,208,0,12,4,209,4,209,0,40,4,210,4,217,0,48,4,218,4,218,0,49,4,219,4,219,0,15,4,220,4,220,0,14,4,221,4,221,0,19,4,222,4,222,0,30,4,224,4,224,0,17,4,226,4,226,0,50,4,227,4,227,0,17,4,229,4,229,0,21,4,230,4,230,0,18,4,232,4,232,0,19,4,233,4,233,0,22,4,234,4,234,0,51,4,235,4,236,0,19,4,237,4,237,0,22,4,238,4,238,0,24,4,239,4,239,0,19,4,240,4,240,0,13,4,241,4,241,0,24,4,242,4,242,0,20,4,243,4,245,0,50,4,246,4,248,0,24,4,249,4,249,0,19,4,250,4,250,0,20,4,251,4,251,0,49,4,252,4,252,0,30,4,253,4,253,0,17,5,0,5,0,0,19,5,1,5,1,0,22,5,2,5,2,0,17,5,3,5,27,0,49,5,28,5,35,0,30,5,36,5,58,0,17,5,59,5,74,0,50,5,75,5,82,0,19,5,83,5,84,0,51,5,85,5,100,0,24,5,101,5,123,0,20,5,125,5,125,0,14,5,127,5,127,0,33,5,128,5,129,0,36,5,130,5,130,0,33,5,131,5,131,0,36,5,133,5,133,0,36,5,134,5,134,0,4,5,135,5,136,0,36,5,137,5,137,0,33,5,138,5,138,0,41,5,139,5,139,0,36,5,140,5,140,0,38,5,141,5,141,0,4,5,142,5,143,0,36,5,144,5,145,0,10,5,146,5,146,0,6,5,147,5,147,0,11,5,148,5,148,0,5,5,149,5,149,0,10,5,150,5,150,0,11,5,151,5,151,0,40,5,152,5,154,0,36,5,155,5,157,0,11,5,158,5,158,0,4,5,159,5,159,0,40,5,160,5,160,0,33,5,161,5,162,0,36,5,165,5,189,0,33,5,190,5,236,0,36,5,237,5,244,0,4,5,245,5,246,0,36,5,247,6,6,0,11,6,7,6,29,0,40,6,30,6,30,0,33,6,39,6,39,0,36,6,48,6,48,0,40,6,49,6,56,0,48,6,57,6,68,0,33,6,69,6,80,0,36,6,81,6,92,0,40,7,7,7,7,0,12,7,9,7,10,0,16,7,12,7,13,0,27,7,17,7,18,0,27,7,21,7,22,0,12,7,25,7,26,0,27,7,42,7,43,0,16,7,46,7,46,0,16,7,56,7,56,0,27,7,57,7,60,0,12,7,61,7,61,0,27,7,76,7,76,0,16,7,186,7,186,0,12,7,191,7,191,0,12,7,193,7,195,0,12,7,197,7,200,0,12,7,205,7,205,0,12,7,213,7,213,0,27,7,215,7,217,0,27,7,242,7,242,0,12,8,9,8,9,0,12,8,43,8,44,0,12,8,51,8,52,0,4,8,56,8,57,0,4,0,2,0,86,0,254,1,23,0,5,1,24,1,25,0,1,1,26,1,26,0,6,1,41,1,63,0,1,1,64,1,64,0,6,1,65,1,65,0,2,1,66,1,72,0,3,1,73,1,75,0,5,1,77,1,77,0,5,1,78,1,78,0,4,1,80,1,83,0,4,1,85,1,85,0,4,1,87,1,90,0,4,1,93,1,95,0,4,1,99,1,101,0,11,1,111,1,118,0,5,1,121,1,122,0,5,1,123,1,139,0,6,1,146,1,157,0,6,1,158,1,158,0,1,1,159,1,160,0,6,1,162,1,169,0,7,1,170,1,172,0,8,1,174,1,181,0,8,1,191,1,218,0,9,1,219,1,224,0,10,1,225,1,225,0,11,1,226,1,235,0,10,1,253,1,253,0,5,2,3,2,3,0,5,3,125,3,125,0,5,3,126,3,126,0,6,3,131,3,131,0,9,3,132,3,134,0,1,3,135,3,135,0,11,3,137,3,139,0,9,3,140,3,141,0,11,3,142,3,144,0,9,3,145,3,145,0,6,3,146,3,146,0,9,3,147,3,147,0,6,3,150,3,151,0,10,3,152,3,152,0,6,3,153,3,153,0,11,3,154,3,158,0,9,3,161,3,161,0,9,3,164,3,164,0,8,3,166,3,166,0,6,3,167,3,168,0,9,3,170,3,170,0,5,3,171,3,171,0,6,3,172,3,172,0,9,3,175,3,175,0,11,3,176,3,176,0,6,3,177,3,177,0,10,3,180,3,180,0,11,3,182,3,184,0,11,3,185,3,185,0,9,3,187,3,187,0,9,3,189,3,190,0,10,3,191,3,191,0,11,3,192,3,193,0,9,3,194,3,194,0,5,3,196,3,196,0,11,3,197,3,197,0,9,3,198,3,199,0,5,3,200,3,201,0,1,3,202,3,202,0,6,3,203,3,203,0,11,3,205,3,206,0,9,3,207,3,208,0,6,3,209,3,211,0,10,3,212,3,212,0,9,3,214,3,214,0,9,3,216,3,216,0,10,3,221,3,221,0,6,4,224,4,224,0,5,4,229,4,229,0,9,4,232,4,232,0,6,4,234,4,234,0,6,4,239,4,239,0,6,4,249,4,249,0,6,4,253,4,253,0,5,5,0,5,0,0,6,5,36,5,58,0,5,5,75,5,84,0,6,0,2,1,3,0,3,0,30,0,10,0,31,0,31,0,1,0,39,0,42,0,1,0,44,0,70,0,1,0,78,0,99,0,1,0,100,0,101,0,19,0,102,0,113,0,1,0,114,0,115,0,17,0,116,0,126,0,1,0,163,0,164,0,1,0,166,0,173,0,1,0,174,0,176,0,13,0,177,0,177,0,11,0,178,0,185,0,13,0,186,0,186,0,1,0,188,0,194,0,2,0,195,0,222,0,14,0,223,0,228,0,3,0,229,0,229,0,15,0,230,0,239,0,4,0,240,0,244,0,16,0,245,0,245,0,1,0,246,0,246,0,13,0,254,1,25,0,5,1,27,1,64,0,7,1,65,1,65,0,18,1,66,1,72,0,12,1,123,1,158,0,7,1,161,1,161,0,7,1,182,1,182,0,18,1,219,1,224,0,20,1,225,1,225,0,9,1,226,1,235,0,20,1,242,1,242,0,18,1,244,1,244,0,18,1,252,1,252,0,18,1,253,1,254,0,7,1,255,2,1,0,18,2,3,2,3,0,2,2,4,2,24,0,10,2,25,2,25,0,13,2,26,2,32,0,10,2,33,2,33,0,1,2,41,2,43,0,1,2,45,2,70,0,1,2,72,2,72,0,1,2,82,2,105,0,1,2,106,2,108,0,19,2,109,2,120,0,1,2,121,2,122,0,17,2,123,2,132,0,1,2,169,2,170,0,1,2,172,2,179,0,1,2,180,2,190,0,13,2,191,2,191,0,1,2,192,2,199,0,2,2,200,2,227,0,14,2,228,2,233,0,3,2,234,2,234,0,15,2,235,2,244,0,4,2,245,2,249,0,16,3,30,3,30,0,10,3,31,3,35,0,1,3,37,3,39,0,1,3,40,3,40,0,15,3,42,3,46,0,1,3,48,3,48,0,17,3,49,3,49,0,1,3,51,3,52,0,1,3,54,3,54,0,2,3,58,3,58,0,15,3,59,3,59,0,21,3,60,3,64,0,1,3,65,3,65,0,2,3,66,3,66,0,1,3,68,3,68,0,1,3,69,3,69,0,13,3,72,3,73,0,1,3,74,3,74,0,19,3,75,3,75,0,2,3,76,3,76,0,1,3,77,3,77,0,22,3,78,3,79,0,2,3,80,3,80,0,15,3,82,3,82,0,3,3,84,3,84,0,1,3,85,3,85,0,15,3,87,3,88,0,1,3,89,3,89,0,2,3,90,3,92,0,1,3,94,3,95,0,4,3,96,3,96,0,15,3,97,3,98,0,21,3,100,3,100,0,1,3,101,3,101,0,15,3,102,3,102,0,21,3,103,3,105,0,10,3,106,3,106,0,1,3,108,3,108,0,15,3,110,3,111,0,1,3,117,3,117,0,21,3,118,3,119,0,1,3,121,3,121,0,3,3,122,3,122,0,1,3,125,3,125,0,5,3,132,3,134,0,7,3,135,3,135,0,9,3,145,3,145,0,7,3,148,3,148,0,7,3,150,3,151,0,20,3,152,3,152,0,7,3,153,3,153,0,9,3,165,3,165,0,7,3,172,3,172,0,9,3,175,3,175,0,9,3,176,3,176,0,7,3,177,3,177,0,20,3,180,3,180,0,9,3,188,3,188,0,7,3,189,3,190,0,20,3,191,3,191,0,9,3,196,3,196,0,9,3,198,3,200,0,5,3,201,3,202,0,7,3,203,3,203,0,9,3,207,3,208,0,7,3,209,3,211,0,20,3,215,3,215,0,7,3,216,3,216,0,20,3,220,3,221,0,7,3,222,3,222,0,10,3,224,3,227,0,1,3,229,3,231,0,1,3,232,3,232,0,15,3,234,3,238,0,1,3,240,3,240,0,17,3,241,3,241,0,1,3,243,3,244,0,1,3,246,3,246,0,2,3,247,3,248,0,4,3,250,3,250,0,15,3,251,3,251,0,21,3,252,3,255,0,1,4,4,4,4,0,1,4,5,4,5,0,13,4,8,4,9,0,1,4,10,4,10,0,19,4,11,4,11,0,2,4,12,4,12,0,1,4,13,4,13,0,22,4,14,4,15,0,2,4,16,4,16,0,15,4,18,4,18,0,3,4,20,4,20,0,1,4,21,4,21,0,15,4,23,4,24,0,1,4,25,4,25,0,2,4,26,4,28,0,1,4,30,4,31,0,4,4,32,4,32,0,15,4,33,4,34,0,21,4,35,4,36,0,1,4,37,4,37,0,15,4,38,4,38,0,21,4,39,4,41,0,10,4,42,4,42,0,1,4,44,4,44,0,15,4,46,4,47,0,1,4,50,4,52,0,4,4,53,4,53,0,21,4,54,4,55,0,1,4,57,4,57,0,3,4,61,4,61,0,10,4,62,4,63,0,1,4,64,4,64,0,10,4,65,4,65,0,1,4,66,4,66,0,16,4,67,4,67,0,1,4,69,4,70,0,1,4,71,4,71,0,10,4,72,4,72,0,17,4,73,4,73,0,1,4,76,4,77,0,1,4,78,4,78,0,15,4,79,4,79,0,2,4,80,4,80,0,4,4,82,4,82,0,15,4,83,4,83,0,4,4,92,4,92,0,1,4,93,4,93,0,4,4,105,4,107,0,10,4,116,4,133,0,11,4,134,4,134,0,1,4,143,4,152,0,11,4,153,4,154,0,1,4,164,4,171,0,4,4,191,4,191,0,10,4,200,4,200,0,1,4,201,4,208,0,11,4,220,4,220,0,24,4,221,4,221,0,7,4,232,4,232,0,7,4,235,4,236,0,7,4,239,4,239,0,7,4,240,4,240,0,23,4,249,4,249,0,7,5,0,5,0,0,7,5,75,5,82,0,7,5,125,5,125,0,24,5,127,5,127,0,10,5,128,5,129,0,1,5,130,5,130,0,10,5,131,5,131,0,1,5,132,5,132,0,16,5,133,5,133,0,1,5,135,5,136,0,1,5,137,5,137,0,10,5,138,5,138,0,17,5,139,5,139,0,1,5,142,5,143,0,1,5,144,5,145,0,15,5,146,5,146,0,2,5,147,5,147,0,4,5,149,5,149,0,15,5,150,5,150,0,4,5,152,5,154,0,1,5,155,5,157,0,4,5,160,5,160,0,10,5,161,5,162,0,1,5,165,5,189,0,10,5,190,5,236,0,1,5,245,5,246,0,1,5,247,6,6,0,4,6,30,6,30,0,10,6,39,6,39,0,1,6,57,6,68,0,10,6,69,6,80,0,1,7,7,7,7,0,11,7,9,7,10,0,6,7,12,7,13,0,8,7,17,7,18,0,8,7,21,7,22,0,11,7,25,7,26,0,8,7,42,7,43,0,6,7,46,7,46,0,6,7,56,7,56,0,8,7,57,7,60,0,11,7,61,7,61,0,8,7,76,7,76,0,6,7,186,7,186,0,11,7,191,7,191,0,11,7,193,7,195,0,11,7,197,7,200,0,11,7,205,7,205,0,11,7,213,7,213,0,8,7,215,7,217,0,8,7,242,7,242,0,11,8,9,8,9,0,11,8,43,8,44,0,11,0,2,1,38,0,2,0,2,0,11,0,3,0,30,0,1,0,31,0,31,0,3,0,32,0,38,0,15,0,39,0,42,0,3,0,44,0,70,0,3,0,71,0,77,0,15,0,78,0,99,0,3,0,100,0,101,0,4,0,102,0,113,0,3,0,114,0,115,0,5,0,116,0,126,0,3,0,127,0,162,0,15,0,163,0,164,0,3,0,165,0,165,0,15,0,166,0,173,0,3,0,177,0,177,0,18,0,186,0,186,0,3,0,187,0,187,0,15,0,188,0,194,0,6,0,195,0,222,0,7,0,223,0,228,0,8,0,229,0,229,0,9,0,230,0,239,0,10,0,245,0,245,0,3,1,26,1,26,0,20,1,27,1,64,0,22,1,73,1,77,0,20,1,99,1,100,0,20,1,102,1,110,0,20,1,123,1,158,0,22,1,159,1,159,0,23,1,160,1,160,0,20,1,161,1,161,0,22,1,191,1,218,0,24,1,219,1,224,0,12,1,225,1,225,0,13,1,226,1,235,0,12,1,253,1,254,0,22,2,3,2,3,0,6,2,4,2,24,0,1,2,26,2,32,0,1,2,33,2,33,0,3,2,34,2,40,0,15,2,41,2,43,0,3,2,45,2,70,0,3,2,71,2,71,0,15,2,72,2,72,0,3,2,75,2,81,0,15,2,82,2,105,0,3,2,106,2,108,0,4,2,109,2,120,0,3,2,121,2,122,0,5,2,123,2,132,0,3,2,133,2,168,0,15,2,169,2,170,0,3,2,171,2,171,0,15,2,172,2,179,0,3,2,191,2,191,0,3,2,192,2,199,0,6,2,200,2,227,0,7,2,228,2,233,0,8,2,234,2,234,0,9,2,235,2,244,0,10,3,30,3,30,0,1,3,31,3,35,0,3,3,37,3,39,0,3,3,40,3,40,0,9,3,42,3,46,0,3,3,48,3,48,0,5,3,49,3,49,0,3,3,50,3,50,0,15,3,51,3,52,0,3,3,53,3,53,0,15,3,54,3,54,0,6,3,57,3,57,0,17,3,58,3,58,0,9,3,59,3,59,0,14,3,60,3,64,0,3,3,65,3,65,0,6,3,66,3,66,0,3,3,68,3,68,0,3,3,70,3,70,0,15,3,72,3,73,0,3,3,74,3,74,0,4,3,75,3,75,0,6,3,76,3,76,0,3,3,78,3,79,0,6,3,80,3,80,0,9,3,81,3,81,0,15,3,82,3,82,0,8,3,84,3,84,0,3,3,85,3,85,0,9,3,87,3,88,0,3,3,89,3,89,0,6,3,90,3,92,0,3,3,94,3,95,0,10,3,96,3,96,0,9,3,97,3,98,0,14,3,100,3,100,0,3,3,101,3,101,0,9,3,102,3,102,0,14,3,103,3,105,0,1,3,106,3,106,0,3,3,107,3,107,0,15,3,108,3,108,0,9,3,110,3,111,0,3,3,112,3,113,0,15,3,117,3,117,0,14,3,118,3,119,0,3,3,120,3,120,0,15,3,121,3,121,0,8,3,122,3,122,0,3,3,124,3,124,0,15,3,126,3,126,0,15,3,132,3,134,0,22,3,135,3,135,0,13,3,145,3,145,0,22,3,147,3,147,0,23,3,148,3,148,0,22,3,150,3,151,0,12,3,152,3,152,0,22,3,153,3,153,0,13,3,154,3,154,0,24,3,165,3,165,0,22,3,170,3,170,0,20,3,172,3,172,0,13,3,175,3,175,0,13,3,176,3,176,0,22,3,177,3,177,0,12,3,180,3,180,0,13,3,188,3,188,0,22,3,189,3,190,0,12,3,191,3,191,0,13,3,192,3,193,0,24,3,194,3,194,0,20,3,196,3,196,0,13,3,197,3,197,0,24,3,201,3,202,0,22,3,203,3,203,0,13,3,207,3,208,0,22,3,209,3,211,0,12,3,212,3,212,0,24,3,215,3,215,0,22,3,216,3,216,0,12,3,220,3,221,0,22,3,222,3,222,0,1,3,224,3,227,0,3,3,229,3,231,0,3,3,232,3,232,0,9,3,234,3,238,0,3,3,240,3,240,0,5,3,241,3,241,0,3,3,242,3,242,0,15,3,243,3,244,0,3,3,245,3,245,0,15,3,246,3,246,0,6,3,247,3,248,0,10,3,249,3,249,0,17,3,250,3,250,0,9,3,251,3,251,0,14,3,252,3,255,0,3,4,4,4,4,0,3,4,6,4,6,0,15,4,8,4,9,0,3,4,10,4,10,0,4,4,11,4,11,0,6,4,12,4,12,0,3,4,14,4,15,0,6,4,16,4,16,0,9,4,17,4,17,0,15,4,18,4,18,0,8,4,20,4,20,0,3,4,21,4,21,0,9,4,23,4,24,0,3,4,25,4,25,0,6,4,26,4,28,0,3,4,30,4,31,0,10,4,32,4,32,0,9,4,33,4,34,0,14,4,35,4,36,0,3,4,37,4,37,0,9,4,38,4,38,0,14,4,39,4,41,0,1,4,42,4,42,0,3,4,43,4,43,0,15,4,44,4,44,0,9,4,46,4,47,0,3,4,48,4,49,0,15,4,50,4,52,0,10,4,53,4,53,0,14,4,54,4,55,0,3,4,56,4,56,0,15,4,57,4,57,0,8,4,61,4,61,0,1,4,62,4,63,0,3,4,64,4,64,0,1,4,65,4,65,0,3,4,67,4,67,0,3,4,68,4,68,0,15,4,69,4,70,0,3,4,71,4,71,0,1,4,72,4,72,0,5,4,73,4,73,0,3,4,75,4,75,0,15,4,76,4,77,0,3,4,78,4,78,0,9,4,79,4,79,0,6,4,80,4,80,0,10,4,81,4,81,0,17,4,82,4,82,0,9,4,83,4,83,0,10,4,84,4,84,0,16,4,86,4,88,0,2,4,89,4,89,0,15,4,91,4,91,0,16,4,92,4,92,0,3,4,93,4,93,0,10,4,105,4,107,0,1,4,116,4,133,0,18,4,134,4,134,0,3,4,135,4,142,0,2,4,143,4,152,0,18,4,153,4,154,0,3,4,163,4,163,0,2,4,164,4,171,0,10,4,182,4,182,0,16,4,191,4,191,0,1,4,200,4,200,0,3,4,201,4,208,0,18,4,209,4,209,0,16,4,219,4,219,0,20,4,220,4,220,0,19,4,221,4,221,0,22,4,229,4,229,0,23,4,230,4,230,0,21,4,232,4,232,0,22,4,235,4,236,0,22,4,239,4,239,0,22,4,249,4,249,0,22,5,0,5,0,0,22,5,75,5,82,0,22,5,125,5,125,0,19,5,127,5,127,0,1,5,128,5,129,0,3,5,130,5,130,0,1,5,131,5,131,0,3,5,133,5,133,0,3,5,134,5,134,0,15,5,135,5,136,0,3,5,137,5,137,0,1,5,138,5,138,0,5,5,139,5,139,0,3,5,141,5,141,0,15,5,142,5,143,0,3,5,144,5,145,0,9,5,146,5,146,0,6,5,147,5,147,0,10,5,148,5,148,0,17,5,149,5,149,0,9,5,150,5,150,0,10,5,151,5,151,0,16,5,152,5,154,0,3,5,155,5,157,0,10,5,158,5,158,0,15,5,159,5,159,0,16,5,160,5,160,0,1,5,161,5,162,0,3,5,165,5,189,0,1,5,190,5,236,0,3,5,237,5,244,0,15,5,245,5,246,0,3,5,247,6,6,0,10,6,7,6,29,0,16,6,30,6,30,0,1,6,39,6,39,0,3,6,40,6,47,0,2,6,48,6,48,0,16,6,57,6,68,0,1,6,69,6,80,0,3,6,81,6,92,0,16,7,7,7,7,0,18,7,21,7,22,0,18,7,57,7,60,0,18,7,186,7,186,0,18,7,191,7,191,0,18,7,193,7,195,0,18,7,197,7,200,0,18,7,205,7,205,0,18,7,242,7,242,0,18,8,9,8,9,0,18,8,43,8,44,0,18,8,51,8,52,0,15,8,56,8,57,0,15,0,2,0,6,3,18,3,18,0,1,3,24,3,24,0,2,6,129,6,129,0,2,6,132,6,132,0,1,6,134,6,134,0,1,6,139,6,139,0,1,0,1,6,95,0,26,0,1,0,1,0,0,0,1,0,0,0,1,0,0,0,1,0,1,0,0,0,0,0,1,0,0,0,0,0,1,0,1,0,0,0,2,0,3,0,0,0,0,0,3,0,0,0,0,0,0,0,4,0,2,0,15,0,177,0,177,0,1,4,116,4,133,0,1,4,143,4,152,0,1,4,201,4,208,0,1,7,7,7,7,0,1,7,21,7,22,0,1,7,57,7,60,0,1,7,186,7,186,0,1,7,191,7,191,0,1,7,193,7,195,0,1,7,197,7,200,0,1,7,205,7,205,0,1,7,242,7,242,0,1,8,9,8,9,0,1,8,43,8,44,0,1,0,2,0,38,3,33,3,34,0,3,3,35,3,35,0,4,3,36,3,36,0,1,3,57,3,57,0,6,3,60,3,60,0,1,3,62,3,62,0,1,3,64,3,65,0,8,3,67,3,68,0,8,3,75,3,75,0,9,3,78,3,78,0,2,3,79,3,79,0,10,3,83,3,83,0,3,3,84,3,84,0,5,3,90,3,90,0,1,3,91,3,91,0,3,3,97,3,97,0,1,3,99,3,99,0,7,3,118,3,118,0,3,3,225,3,226,0,3,3,227,3,227,0,4,3,228,3,228,0,1,3,249,3,249,0,6,3,252,3,252,0,1,3,254,3,254,0,1,4,3,4,4,0,8,4,11,4,11,0,9,4,14,4,14,0,2,4,15,4,15,0,10,4,19,4,19,0,3,4,20,4,20,0,5,4,26,4,26,0,1,4,27,4,27,0,3,4,33,4,33,0,1,4,54,4,54,0,3,4,63,4,63,0,3,4,81,4,81,0,6,5,129,5,129,0,3,5,148,5,148,0,6,0,2,1,20,0,3,0,30,0,4,0,32,0,38,0,6,0,71,0,77,0,6,0,127,0,162,0,6,0,165,0,165,0,6,0,177,0,177,0,38,0,187,0,187,0,6,0,188,0,194,0,2,0,223,0,228,0,9,0,229,0,229,0,35,0,230,0,239,0,10,0,254,1,25,0,11,1,27,1,64,0,22,1,66,1,72,0,17,1,78,1,78,0,20,1,80,1,83,0,20,1,85,1,85,0,20,1,87,1,90,0,20,1,92,1,95,0,20,1,101,1,101,0,20,1,111,1,122,0,20,1,123,1,158,0,22,1,159,1,159,0,24,1,161,1,161,0,22,1,162,1,169,0,20,1,191,1,218,0,27,1,219,1,224,0,32,1,225,1,225,0,29,1,226,1,235,0,32,1,253,1,254,0,22,2,3,2,3,0,2,2,4,2,24,0,4,2,26,2,32,0,4,2,34,2,40,0,6,2,71,2,71,0,6,2,75,2,81,0,6,2,133,2,168,0,6,2,171,2,171,0,6,2,192,2,199,0,2,2,228,2,233,0,9,2,234,2,234,0,35,2,235,2,244,0,10,3,30,3,30,0,4,3,36,3,36,0,3,3,40,3,40,0,35,3,47,3,47,0,3,3,50,3,50,0,6,3,53,3,53,0,6,3,54,3,54,0,2,3,55,3,56,0,37,3,57,3,57,0,8,3,58,3,58,0,35,3,59,3,59,0,34,3,65,3,65,0,2,3,67,3,67,0,3,3,70,3,70,0,6,3,75,3,75,0,2,3,77,3,77,0,5,3,78,3,79,0,2,3,80,3,80,0,35,3,81,3,81,0,6,3,82,3,82,0,9,3,85,3,85,0,35,3,89,3,89,0,2,3,94,3,95,0,10,3,96,3,96,0,35,3,97,3,98,0,34,3,101,3,101,0,35,3,102,3,102,0,34,3,103,3,105,0,4,3,107,3,107,0,6,3,108,3,108,0,35,3,112,3,113,0,6,3,114,3,116,0,37,3,117,3,117,0,34,3,120,3,120,0,6,3,121,3,121,0,9,3,124,3,124,0,6,3,125,3,125,0,11,3,126,3,126,0,6,3,127,3,130,0,20,3,131,3,131,0,14,3,132,3,134,0,22,3,135,3,135,0,29,3,136,3,136,0,33,3,137,3,141,0,20,3,142,3,142,0,15,3,143,3,144,0,20,3,145,3,145,0,22,3,146,3,146,0,20,3,147,3,147,0,24,3,148,3,148,0,22,3,149,3,149,0,31,3,150,3,151,0,32,3,152,3,152,0,22,3,153,3,153,0,29,3,154,3,154,0,27,3,155,3,159,0,20,3,160,3,160,0,31,3,161,3,161,0,20,3,162,3,162,0,15,3,163,3,163,0,20,3,165,3,165,0,22,3,167,3,168,0,20,3,171,3,171,0,20,3,172,3,172,0,29,3,174,3,174,0,31,3,175,3,175,0,29,3,176,3,176,0,22,3,177,3,177,0,32,3,179,3,179,0,20,3,180,3,180,0,29,3,181,3,181,0,33,3,182,3,183,0,20,3,184,3,184,0,31,3,185,3,187,0,20,3,188,3,188,0,22,3,189,3,190,0,32,3,191,3,191,0,29,3,192,3,193,0,27,3,196,3,196,0,29,3,197,3,197,0,27,3,198,3,200,0,11,3,201,3,202,0,22,3,203,3,203,0,29,3,204,3,204,0,33,3,205,3,206,0,20,3,207,3,208,0,22,3,209,3,211,0,32,3,212,3,212,0,27,3,213,3,214,0,20,3,215,3,215,0,22,3,216,3,216,0,32,3,219,3,219,0,33,3,220,3,221,0,22,3,222,3,222,0,4,3,228,3,228,0,3,3,232,3,232,0,35,3,239,3,239,0,3,3,242,3,242,0,6,3,245,3,245,0,6,3,246,3,246,0,2,3,247,3,248,0,10,3,249,3,249,0,8,3,250,3,250,0,35,3,251,3,251,0,34,4,3,4,3,0,3,4,6,4,6,0,6,4,11,4,11,0,2,4,13,4,13,0,5,4,14,4,15,0,2,4,16,4,16,0,35,4,17,4,17,0,6,4,18,4,18,0,9,4,21,4,21,0,35,4,25,4,25,0,2,4,30,4,31,0,10,4,32,4,32,0,35,4,33,4,34,0,34,4,37,4,37,0,35,4,38,4,38,0,34,4,39,4,41,0,4,4,43,4,43,0,6,4,44,4,44,0,35,4,48,4,49,0,6,4,50,4,52,0,10,4,53,4,53,0,34,4,56,4,56,0,6,4,57,4,57,0,9,4,61,4,61,0,4,4,64,4,64,0,4,4,68,4,68,0,6,4,71,4,71,0,4,4,74,4,74,0,36,4,75,4,75,0,6,4,78,4,78,0,35,4,79,4,79,0,2,4,80,4,80,0,10,4,81,4,81,0,8,4,82,4,82,0,35,4,83,4,83,0,10,4,84,4,84,0,7,4,89,4,89,0,6,4,91,4,91,0,7,4,93,4,93,0,10,4,105,4,107,0,4,4,116,4,133,0,38,4,143,4,152,0,38,4,164,4,171,0,10,4,182,4,182,0,7,4,191,4,191,0,4,4,201,4,208,0,38,4,209,4,209,0,7,4,218,4,218,0,12,4,220,4,220,0,18,4,221,4,221,0,22,4,222,4,222,0,16,4,224,4,224,0,20,4,227,4,227,0,20,4,228,4,228,0,19,4,229,4,229,0,24,4,230,4,230,0,21,4,231,4,231,0,30,4,232,4,232,0,22,4,233,4,233,0,25,4,234,4,234,0,26,4,235,4,236,0,22,4,237,4,237,0,25,4,238,4,238,0,28,4,239,4,239,0,22,4,240,4,240,0,13,4,241,4,241,0,28,4,242,4,242,0,23,4,246,4,248,0,28,4,249,4,249,0,22,4,250,4,250,0,23,4,251,4,251,0,12,4,252,4,252,0,16,4,253,4,253,0,20,5,0,5,0,0,22,5,1,5,1,0,25,5,2,5,2,0,20,5,3,5,27,0,12,5,28,5,35,0,16,5,36,5,58,0,20,5,75,5,82,0,22,5,83,5,84,0,26,5,85,5,100,0,28,5,101,5,123,0,23,5,125,5,125,0,18,5,126,5,126,0,19,5,127,5,127,0,4,5,130,5,130,0,4,5,134,5,134,0,6,5,137,5,137,0,4,5,140,5,140,0,36,5,141,5,141,0,6,5,144,5,145,0,35,5,146,5,146,0,2,5,147,5,147,0,10,5,148,5,148,0,8,5,149,5,149,0,35,5,150,5,150,0,10,5,151,5,151,0,7,5,155,5,157,0,10,5,158,5,158,0,6,5,159,5,159,0,7,5,160,5,160,0,4,5,165,5,189,0,4,5,237,5,244,0,6,5,247,6,6,0,10,6,7,6,29,0,7,6,30,6,30,0,4,6,48,6,48,0,7,6,57,6,68,0,4,6,81,6,92,0,7,7,7,7,7,0,38,7,12,7,13,0,1,7,17,7,18,0,1,7,21,7,22,0,38,7,25,7,26,0,1,7,56,7,56,0,1,7,57,7,60,0,38,7,61,7,61,0,1,7,186,7,186,0,38,7,191,7,191,0,38,7,193,7,195,0,38,7,197,7,200,0,38,7,205,7,205,0,38,7,213,7,213,0,1,7,215,7,217,0,1,7,242,7,242,0,38,8,9,8,9,0,38,8,43,8,44,0,38,8,51,8,52,0,6,8,56,8,57,0,6,0,2,0,9,3,127,3,127,0,3,3,136,3,136,0,3,3,149,3,149,0,2,3,159,3,160,0,1,3,162,3,163,0,1,3,181,3,181,0,3,3,186,3,186,0,2,3,204,3,204,0,3,3,219,3,219,0,3,0,2,0,24,0,177,0,177,0,2,3,77,3,77,0,3,4,13,4,13,0,3,4,116,4,133,0,2,4,143,4,152,0,2,4,201,4,208,0,2,7,7,7,7,0,2,7,12,7,13,0,1,7,17,7,18,0,1,7,21,7,22,0,2,7,25,7,26,0,1,7,56,7,56,0,1,7,57,7,60,0,2,7,61,7,61,0,1,7,186,7,186,0,2,7,191,7,191,0,2,7,193,7,195,0,2,7,197,7,200,0,2,7,205,7,205,0,2,7,213,7,213,0,1,7,215,7,217,0,1,7,242,7,242,0,2,8,9,8,9,0,2,8,43,8,44,0,2,0,2,0,4,3,223,3,223,0,1,4,0,4,0,0,1,4,1,4,1,0,2,4,2,4,2,0,1,0,1,6,96,0,47,0,2,0,0,0,1,0,0,0,0,0,3,0,0,0,8,0,0,0,0,0,0,0,1,0,3,0,0,0,5,0,1,0,7,0,9,0,6,0,8,0,9,0,4,0,10,0,0,0,13,0,0,0,12,0,19,0,0,0,0,0,0,0,0,0,14,0,0,0,15,0,0,0,0,0,17,0,0,0,0,0,18,0,17,0,0,0,0,0,11,0,0,0,16,0,2,0,32,3,18,3,18,0,17,3,19,3,19,0,5,6,94,6,94,0,8,6,97,6,97,0,8,6,101,6,101,0,6,6,104,6,104,0,8,6,107,6,107,0,13,6,108,6,108,0,6,6,111,6,111,0,3,6,112,6,112,0,2,6,113,6,113,0,4,6,114,6,114,0,1,6,115,6,115,0,3,6,116,6,116,0,4,6,117,6,117,0,9,6,118,6,118,0,10,6,120,6,120,0,18,6,121,6,121,0,17,6,122,6,122,0,7,6,125,6,125,0,21,6,126,6,126,0,14,6,128,6,128,0,16,6,129,6,129,0,5,6,130,6,130,0,19,6,131,6,131,0,12,6,132,6,132,0,17,6,133,6,133,0,20,6,135,6,136,0,17,6,137,6,137,0,20,6,139,6,139,0,17,6,140,6,140,0,15,6,142,6,142,0,11,0,2,0,7,4,191,4,217,0,1,4,226,4,226,0,1,4,243,4,245,0,1,5,59,5,74,0,1,5,209,5,209,0,1,6,69,6,69,0,1,6,81,6,81,0,1,0,2,0,45,0,177,0,177,0,3,0,188,0,194,0,1,0,230,0,239,0,2,2,3,2,3,0,1,2,192,2,199,0,1,2,235,2,244,0,2,3,54,3,54,0,1,3,65,3,65,0,1,3,75,3,75,0,1,3,78,3,79,0,1,3,89,3,89,0,1,3,94,3,95,0,2,3,246,3,246,0,1,3,247,3,248,0,2,4,11,4,11,0,1,4,14,4,15,0,1,4,25,4,25,0,1,4,30,4,31,0,2,4,50,4,52,0,2,4,79,4,79,0,1,4,80,4,80,0,2,4,83,4,83,0,2,4,93,4,93,0,2,4,116,4,133,0,3,4,143,4,152,0,3,4,164,4,171,0,2,4,201,4,208,0,3,4,220,4,220,0,4,5,125,5,125,0,4,5,146,5,146,0,1,5,147,5,147,0,2,5,150,5,150,0,2,5,155,5,157,0,2,5,247,6,6,0,2,7,7,7,7,0,3,7,21,7,22,0,3,7,57,7,60,0,3,7,186,7,186,0,3,7,191,7,191,0,3,7,193,7,195,0,3,7,197,7,200,0,3,7,205,7,205,0,3,7,242,7,242,0,3,8,9,8,9,0,3,8,43,8,44,0,3,0,2,0,25,4,220,4,220,0,4,4,221,4,221,0,2,4,222,4,222,0,3,4,223,4,223,0,13,4,227,4,227,0,5,4,228,4,228,0,6,4,230,4,230,0,7,4,231,4,231,0,12,4,233,4,233,0,9,4,236,4,236,0,10,4,237,4,237,0,9,4,238,4,238,0,11,4,240,4,240,0,1,4,241,4,241,0,11,4,242,4,242,0,8,4,246,4,248,0,11,4,250,4,250,0,8,4,252,4,252,0,3,5,1,5,1,0,9,5,2,5,2,0,5,5,28,5,35,0,3,5,85,5,100,0,11,5,101,5,123,0,8,5,125,5,125,0,4,5,126,5,126,0,6,0,2,0,232,0,3,0,30,0,2,0,31,0,31,0,19,0,39,0,42,0,19,0,44,0,70,0,19,0,78,0,99,0,19,0,102,0,113,0,19,0,116,0,126,0,19,0,163,0,164,0,19,0,166,0,173,0,19,0,177,0,177,0,16,0,186,0,186,0,19,0,229,0,229,0,12,0,230,0,239,0,1,0,245,0,245,0,19,1,27,1,64,0,8,1,78,1,78,0,7,1,80,1,83,0,7,1,85,1,85,0,7,1,87,1,90,0,7,1,92,1,95,0,7,1,101,1,101,0,7,1,111,1,122,0,7,1,123,1,158,0,8,1,161,1,161,0,8,1,162,1,169,0,7,1,253,1,254,0,8,2,4,2,24,0,2,2,26,2,32,0,2,2,33,2,33,0,19,2,41,2,43,0,19,2,45,2,70,0,19,2,72,2,72,0,19,2,82,2,105,0,19,2,109,2,120,0,19,2,123,2,132,0,19,2,169,2,170,0,19,2,172,2,179,0,19,2,191,2,191,0,19,2,234,2,234,0,12,2,235,2,244,0,1,3,30,3,30,0,2,3,31,3,35,0,19,3,37,3,39,0,19,3,40,3,40,0,12,3,42,3,46,0,19,3,49,3,49,0,19,3,51,3,52,0,19,3,58,3,58,0,12,3,59,3,59,0,15,3,60,3,64,0,19,3,66,3,66,0,19,3,68,3,68,0,19,3,72,3,73,0,19,3,76,3,76,0,19,3,80,3,80,0,12,3,84,3,84,0,19,3,85,3,85,0,12,3,87,3,88,0,19,3,90,3,92,0,19,3,94,3,95,0,1,3,96,3,96,0,12,3,97,3,98,0,15,3,100,3,100,0,19,3,101,3,101,0,12,3,102,3,102,0,15,3,103,3,105,0,2,3,106,3,106,0,19,3,108,3,108,0,12,3,110,3,111,0,19,3,117,3,117,0,15,3,118,3,119,0,19,3,122,3,122,0,19,3,127,3,130,0,7,3,132,3,134,0,8,3,137,3,141,0,7,3,143,3,144,0,7,3,145,3,145,0,8,3,146,3,146,0,7,3,148,3,148,0,8,3,152,3,152,0,8,3,155,3,159,0,7,3,161,3,161,0,7,3,163,3,163,0,7,3,165,3,165,0,8,3,167,3,168,0,7,3,171,3,171,0,7,3,176,3,176,0,8,3,179,3,179,0,7,3,182,3,183,0,7,3,185,3,187,0,7,3,188,3,188,0,8,3,201,3,202,0,8,3,205,3,206,0,7,3,207,3,208,0,8,3,213,3,214,0,7,3,215,3,215,0,8,3,220,3,221,0,8,3,222,3,222,0,2,3,224,3,227,0,19,3,229,3,231,0,19,3,232,3,232,0,12,3,234,3,238,0,19,3,241,3,241,0,19,3,243,3,244,0,19,3,247,3,248,0,1,3,250,3,250,0,12,3,251,3,251,0,15,3,252,3,255,0,19,4,4,4,4,0,19,4,8,4,9,0,19,4,12,4,12,0,19,4,16,4,16,0,12,4,20,4,20,0,19,4,21,4,21,0,12,4,23,4,24,0,19,4,26,4,28,0,19,4,30,4,31,0,1,4,32,4,32,0,12,4,33,4,34,0,15,4,35,4,36,0,19,4,37,4,37,0,12,4,38,4,38,0,15,4,39,4,41,0,2,4,42,4,42,0,19,4,44,4,44,0,12,4,46,4,47,0,19,4,50,4,52,0,1,4,53,4,53,0,15,4,54,4,55,0,19,4,61,4,61,0,2,4,62,4,63,0,19,4,64,4,64,0,2,4,65,4,65,0,19,4,67,4,67,0,19,4,69,4,70,0,19,4,71,4,71,0,2,4,73,4,73,0,19,4,76,4,77,0,19,4,78,4,78,0,12,4,80,4,80,0,1,4,82,4,82,0,12,4,83,4,83,0,1,4,92,4,92,0,19,4,93,4,93,0,1,4,105,4,107,0,2,4,116,4,133,0,16,4,134,4,134,0,19,4,143,4,152,0,16,4,153,4,154,0,19,4,164,4,171,0,1,4,191,4,191,0,2,4,200,4,200,0,19,4,201,4,208,0,16,4,218,4,218,0,3,4,220,4,220,0,14,4,221,4,221,0,8,4,222,4,222,0,5,4,224,4,224,0,7,4,225,4,225,0,18,4,227,4,227,0,7,4,228,4,228,0,6,4,230,4,230,0,17,4,232,4,232,0,8,4,233,4,233,0,10,4,235,4,236,0,8,4,237,4,237,0,10,4,238,4,238,0,11,4,239,4,239,0,8,4,240,4,240,0,4,4,241,4,241,0,11,4,242,4,242,0,9,4,246,4,248,0,11,4,249,4,249,0,8,4,250,4,250,0,9,4,251,4,251,0,3,4,252,4,252,0,5,4,253,4,253,0,7,4,255,4,255,0,18,5,0,5,0,0,8,5,1,5,1,0,10,5,2,5,2,0,7,5,3,5,27,0,3,5,28,5,35,0,5,5,36,5,58,0,7,5,75,5,82,0,8,5,85,5,100,0,11,5,101,5,123,0,9,5,125,5,125,0,14,5,126,5,126,0,6,5,127,5,127,0,2,5,128,5,129,0,19,5,130,5,130,0,2,5,131,5,131,0,19,5,133,5,133,0,19,5,135,5,136,0,19,5,137,5,137,0,2,5,139,5,139,0,19,5,142,5,143,0,19,5,144,5,145,0,12,5,147,5,147,0,1,5,149,5,149,0,12,5,150,5,150,0,1,5,152,5,154,0,19,5,155,5,157,0,1,5,160,5,160,0,2,5,161,5,162,0,19,5,165,5,189,0,2,5,190,5,236,0,19,5,245,5,246,0,19,5,247,6,6,0,1,6,30,6,30,0,2,6,39,6,39,0,19,6,57,6,68,0,2,6,69,6,80,0,19,7,7,7,7,0,16,7,12,7,13,0,13,7,17,7,18,0,13,7,21,7,22,0,16,7,25,7,26,0,13,7,56,7,56,0,13,7,57,7,60,0,16,7,61,7,61,0,13,7,186,7,186,0,16,7,191,7,191,0,16,7,193,7,195,0,16,7,197,7,200,0,16,7,205,7,205,0,16,7,213,7,213,0,13,7,215,7,217,0,13,7,242,7,242,0,16,8,9,8,9,0,16,8,43,8,44,0,16,0,2,0,8,4,86,4,88,0,1,4,135,4,142,0,1,4,163,4,163,0,1,6,40,6,47,0,1,7,9,7,10,0,2,7,42,7,43,0,2,7,46,7,46,0,2,7,76,7,76,0,2,0,0,0,1,0,0,0,10,3,178,21,156,0,3,68,70,76,84,0,20,99,121,114,108,0,76,108,97,116,110,0,220,0,4,0,0,0,0,255,255,0,23,0,0,0,15,0,30,0,45,0,60,0,75,0,90,0,105,0,120,0,149,0,164,0,179,0,194,0,209,0,224,0,239,0,254,1,13,1,28,1,43,1,58,1,73,1,88,0,22,0,3,66,83,72,32,0,74,67,72,85,32,0,82,83,82,66,32,0,90,0,0,255,255,0,23,0,1,0,16,0,31,0,46,0,61,0,76,0,91,0,106,0,121,0,150,0,165,0,180,0,195,0,210,0,225,0,240,0,255,1,14,1,29,1,44,1,59,1,74,1,89,0,0,255,255,0,1,0,135,0,0,255,255,0,1,0,136,0,0,255,255,0,24,0,2,0,17,0,32,0,47,0,62,0,77,0,92,0,107,0,122,0,137,0,151,0,166,0,181,0,196,0,211,0,226,0,241,1,0,1,15,1,30,1,45,1,60,1,75,1,90,0,70,0,11,65,90,69,32,0,122,67,65,84,32,0,176,67,82,84,32,0,230,69,83,80,32,1,28,71,85,65,32,1,82,75,65,90,32,1,136,77,79,76,32,1,190,78,76,68,32,1,244,82,79,77,32,2,42,84,65,84,32,2,96,84,82,75,32,2,150,0,0,255,255,0,23,0,3,0,18,0,33,0,48,0,63,0,78,0,93,0,108,0,123,0,152,0,167,0,182,0,197,0,212,0,227,0,242,1,1,1,16,1,31,1,46,1,61,1,76,1,91,0,0,255,255,0,24,0,4,0,19,0,34,0,49,0,64,0,79,0,94,0,109,0,124,0,138,0,153,0,168,0,183,0,198,0,213,0,228,0,243,1,2,1,17,1,32,1,47,1,62,1,77,1,92,0,0,255,255,0,24,0,5,0,20,0,35,0,50,0,65,0,80,0,95,0,110,0,125,0,139,0,154,0,169,0,184,0,199,0,214,0,229,0,244,1,3,1,18,1,33,1,48,1,63,1,78,1,93,0,0,255,255,0,24,0,6,0,21,0,36,0,51,0,66,0,81,0,96,0,111,0,126,0,140,0,155,0,170,0,185,0,200,0,215,0,230,0,245,1,4,1,19,1,34,1,49,1,64,1,79,1,94,0,0,255,255,0,24,0,7,0,22,0,37,0,52,0,67,0,82,0,97,0,112,0,127,0,141,0,156,0,171,0,186,0,201,0,216,0,231,0,246,1,5,1,20,1,35,1,50,1,65,1,80,1,95,0,0,255,255,0,24,0,8,0,23,0,38,0,53,0,68,0,83,0,98,0,113,0,128,0,142,0,157,0,172,0,187,0,202,0,217,0,232,0,247,1,6,1,21,1,36,1,51,1,66,1,81,1,96,0,0,255,255,0,24,0,9,0,24,0,39,0,54,0,69,0,84,0,99,0,114,0,129,0,143,0,158,0,173,0,188,0,203,0,218,0,233,0,248,1,7,1,22,1,37,1,52,1,67,1,82,1,97,0,0,255,255,0,24,0,10,0,25,0,40,0,55,0,70,0,85,0,100,0,115,0,130,0,144,0,159,0,174,0,189,0,204,0,219,0,234,0,249,1,8,1,23,1,38,1,53,1,68,1,83,1,98,0,0,255,255,0,24,0,11,0,26,0,41,0,56,0,71,0,86,0,101,0,116,0,131,0,145,0,160,0,175,0,190,0,205,0,220,0,235,0,250,1,9,1,24,1,39,1,54,1,69,1,84,1,99,0,0,255,255,0,24,0,12,0,27,0,42,0,57,0,72,0,87,0,102,0,117,0,132,0,146,0,161,0,176,0,191,0,206,0,221,0,236,0,251,1,10,1,25,1,40,1,55,1,70,1,85,1,100,0,0,255,255,0,24,0,13,0,28,0,43,0,58,0,73,0,88,0,103,0,118,0,133,0,147,0,162,0,177,0,192,0,207,0,222,0,237,0,252,1,11,1,26,1,41,1,56,1,71,1,86,1,101,0,0,255,255,0,24,0,14,0,29,0,44,0,59,0,74,0,89,0,104,0,119,0,134,0,148,0,163,0,178,0,193,0,208,0,223,0,238,0,253,1,12,1,27,1,42,1,57,1,72,1,87,1,102,1,103,97,97,108,116,8,108,97,97,108,116,8,116,97,97,108,116,8,124,97,97,108,116,8,132,97,97,108,116,8,140,97,97,108,116,8,148,97,97,108,116,8,156,97,97,108,116,8,164,97,97,108,116,8,172,97,97,108,116,8,180,97,97,108,116,8,188,97,97,108,116,8,196,97,97,108,116,8,204,97,97,108,116,8,212,97,97,108,116,8,220,99,50,115,99,8,228,99,50,115,99,8,234,99,50,115,99,8,240,99,50,115,99,8,246,99,50,115,99,8,252,99,50,115,99,9,2,99,50,115,99,9,8,99,50,115,99,9,14,99,50,115,99,9,20,99,50,115,99,9,26,99,50,115,99,9,32,99,50,115,99,9,38,99,50,115,99,9,44,99,50,115,99,9,50,99,50,115,99,9,56,99,97,115,101,9,62,99,97,115,101,9,68,99,97,115,101,9,74,99,97,115,101,9,80,99,97,115,101,9,86,99,97,115,101,9,92,99,97,115,101,9,98,99,97,115,101,9,104,99,97,115,101,9,110,99,97,115,101,9,116,99,97,115,101,9,122,99,97,115,101,9,128,99,97,115,101,9,134,99,97,115,101,9,140,99,97,115,101,9,146,99,99,109,112,9,152,99,99,109,112,9,164,99,99,109,112,9,176,99,99,109,112,9,188,99,99,109,112,9,204,99,99,109,112,9,216,99,99,109,112,9,228,99,99,109,112,9,240,99,99,109,112,9,252,99,99,109,112,10,8,99,99,109,112,10,20,99,99,109,112,10,32,99,99,109,112,10,44,99,99,109,112,10,56,99,99,109,112,10,68,100,108,105,103,10,80,100,108,105,103,10,86,100,108,105,103,10,92,100,108,105,103,10,98,100,108,105,103,10,104,100,108,105,103,10,110,100,108,105,103,10,116,100,108,105,103,10,122,100,108,105,103,10,128,100,108,105,103,10,134,100,108,105,103,10,140,100,108,105,103,10,146,100,108,105,103,10,152,100,108,105,103,10,158,100,108,105,103,10,164,100,110,111,109,10,170,100,110,111,109,10,176,100,110,111,109,10,182,100,110,111,109,10,188,100,110,111,109,10,194,100,110,111,109,10,200,100,110,111,109,10,206,100,110,111,109,10,212,100,110,111,109,10,218,100,110,111,109,10,224,100,110,111,109,10,230,100,110,111,109,10,236,100,110,111,109,10,242,100,110,111,109,10,248,100,110,111,109,10,254,102,114,97,99,11,4,102,114,97,99,11,14,102,114,97,99,11,24,102,114,97,99,11,34,102,114,97,99,11,44,102,114,97,99,11,54,102,114,97,99,11,64,102,114,97,99,11,74,102,114,97,99,11,84,102,114,97,99,11,94,102,114,97,99,11,104,102,114,97,99,11,114,102,114,97,99,11,124,102,114,97,99,11,134,102,114,97,99,11,144,108,105,103,97,11,154,108,105,103,97,11,164,108,105,103,97,11,174,108,105,103,97,11,184,108,105,103,97,11,194,108,105,103,97,11,204,108,105,103,97,11,214,108,105,103,97,11,224,108,105,103,97,11,236,108,105,103,97,11,246,108,105,103,97,12,0,108,105,103,97,12,10,108,105,103,97,12,20,108,105,103,97,12,30,108,105,103,97,12,40,108,110,117,109,12,50,108,110,117,109,12,56,108,110,117,109,12,62,108,110,117,109,12,68,108,110,117,109,12,74,108,110,117,109,12,80,108,110,117,109,12,86,108,110,117,109,12,92,108,110,117,109,12,98,108,110,117,109,12,104,108,110,117,109,12,110,108,110,117,109,12,116,108,110,117,109,12,122,108,110,117,109,12,128,108,110,117,109,12,134,108,111,99,108,12,140,108,111,99,108,12,146,108,111,99,108,12,152,108,111,99,108,12,158,108,111,99,108,12,164,108,111,99,108,12,170,108,111,99,108,12,176,108,111,99,108,12,182,108,111,99,108,12,188,108,111,99,108,12,194,108,111,99,108,12,200,108,111,99,108,12,206,108,111,99,108,12,212,108,111,99,108,12,218,110,117,109,114,12,224,110,117,109,114,12,230,110,117,109,114,12,236,110,117,109,114,12,242,110,117,109,114,12,248,110,117,109,114,12,254,110,117,109,114,13,4,110,117,109,114,13,10,110,117,109,114,13,16,110,117,109,114,13,22,110,117,109,114,13,28,110,117,109,114,13,34,110,117,109,114,13,40,110,117,109,114,13,46,110,117,109,114,13,52,111,110,117,109,13,58,111,110,117,109,13,64,111,110,117,109,13,70,111,110,117,109,13,76,111,110,117,109,13,82,111,110,117,109,13,88,111,110,117,109,13,94,111,110,117,109,13,100,111,110,117,109,13,106,111,110,117,109,13,112,111,110,117,109,13,118,111,110,117,109,13,124,111,110,117,109,13,130,111,110,117,109,13,136,111,110,117,109,13,142,111,114,100,110,13,148,111,114,100,110,13,156,111,114,100,110,13,164,111,114,100,110,13,172,111,114,100,110,13,180,111,114,100,110,13,188,111,114,100,110,13,196,111,114,100,110,13,204,111,114,100,110,13,212,111,114,100,110,13,220,111,114,100,110,13,228,111,114,100,110,13,236,111,114,100,110,13,244,111,114,100,110,13,252,111,114,100,110,14,4,112,110,117,109,14,12,112,110,117,109,14,18,112,110,117,109,14,24,112,110,117,109,14,30,112,110,117,109,14,36,112,110,117,109,14,42,112,110,117,109,14,48,112,110,117,109,14,54,112,110,117,109,14,60,112,110,117,109,14,66,112,110,117,109,14,72,112,110,117,109,14,78,112,110,117,109,14,84,112,110,117,109,14,90,112,110,117,109,14,96,115,105,110,102,14,102,115,105,110,102,14,108,115,105,110,102,14,114,115,105,110,102,14,120,115,105,110,102,14,126,115,105,110,102,14,132,115,105,110,102,14,138,115,105,110,102,14,144,115,105,110,102,14,150,115,105,110,102,14,156,115,105,110,102,14,162,115,105,110,102,14,168,115,105,110,102,14,174,115,105,110,102,14,180,115,105,110,102,14,186,115,109,99,112,14,192,115,109,99,112,14,198,115,109,99,112,14,204,115,109,99,112,14,210,115,109,99,112,14,216,115,109,99,112,14,222,115,109,99,112,14,228,115,109,99,112,14,234,115,109,99,112,14,240,115,109,99,112,14,246,115,109,99,112,14,252,115,109,99,112,15,2,115,109,99,112,15,8,115,109,99,112,15,14,115,109,99,112,15,20,115,115,48,49,15,26,115,115,48,49,15,32,115,115,48,49,15,38,115,115,48,49,15,44,115,115,48,49,15,50,115,115,48,49,15,56,115,115,48,49,15,62,115,115,48,49,15,68,115,115,48,49,15,74,115,115,48,49,15,80,115,115,48,49,15,86,115,115,48,49,15,92,115,115,48,49,15,98,115,115,48,49,15,104,115,115,48,49,15,110,115,115,48,50,15,116,115,115,48,50,15,122,115,115,48,50,15,128,115,115,48,50,15,134,115,115,48,50,15,140,115,115,48,50,15,146,115,115,48,50,15,152,115,115,48,50,15,158,115,115,48,50,15,164,115,115,48,50,15,170,115,115,48,50,15,176,115,115,48,50,15,182,115,115,48,50,15,188,115,115,48,50,15,194,115,115,48,50,15,200,115,115,48,51,15,206,115,115,48,51,15,212,115,115,48,51,15,218,115,115,48,51,15,224,115,115,48,51,15,230,115,115,48,51,15,236,115,115,48,51,15,242,115,115,48,51,15,248,115,115,48,51,15,254,115,115,48,51,16,4,115,115,48,51,16,10,115,115,48,51,16,16,115,115,48,51,16,22,115,115,48,51,16,28,115,115,48,51,16,34,115,115,48,52,16,40,115,115,48,52,16,46,115,115,48,52,16,52,115,115,48,52,16,58,115,115,48,52,16,64,115,115,48,52,16,70,115,115,48,52,16,76,115,115,48,52,16,82,115,115,48,52,16,88,115,115,48,52,16,94,115,115,48,52,16,100,115,115,48,52,16,106,115,115,48,52,16,112,115,115,48,52,16,118,115,115,48,52,16,124,115,115,48,53,16,130,115,115,48,53,16,136,115,115,48,53,16,142,115,115,48,53,16,148,115,115,48,53,16,154,115,115,48,53,16,160,115,115,48,53,16,166,115,115,48,53,16,172,115,115,48,53,16,178,115,115,48,53,16,184,115,115,48,53,16,190,115,115,48,53,16,196,115,115,48,53,16,202,115,115,48,53,16,208,115,115,48,53,16,214,115,117,98,115,16,220,115,117,98,115,16,226,115,117,98,115,16,232,115,117,98,115,16,238,115,117,98,115,16,244,115,117,98,115,16,250,115,117,98,115,17,0,115,117,98,115,17,6,115,117,98,115,17,12,115,117,98,115,17,18,115,117,98,115,17,24,115,117,98,115,17,30,115,117,98,115,17,36,115,117,98,115,17,42,115,117,98,115,17,48,115,117,112,115,17,54,115,117,112,115,17,60,115,117,112,115,17,66,115,117,112,115,17,72,115,117,112,115,17,78,115,117,112,115,17,84,115,117,112,115,17,90,115,117,112,115,17,96,115,117,112,115,17,102,115,117,112,115,17,108,115,117,112,115,17,114,115,117,112,115,17,120,115,117,112,115,17,126,115,117,112,115,17,132,115,117,112,115,17,138,116,110,117,109,17,144,116,110,117,109,17,150,116,110,117,109,17,156,116,110,117,109,17,162,116,110,117,109,17,168,116,110,117,109,17,174,116,110,117,109,17,180,116,110,117,109,17,186,116,110,117,109,17,192,116,110,117,109,17,198,116,110,117,109,17,204,116,110,117,109,17,210,116,110,117,109,17,216,116,110,117,109,17,222,116,110,117,109,17,228,0,0,0,2,0,0,0,1,0,0,0,2,0,0,0,1,0,0,0,2,0,0,0,1,0,0,0,2,0,0,0,1,0,0,0,2,0,0,0,1,0,0,0,2,0,0,0,1,0,0,0,2,0,0,0,1,0,0,0,2,0,0,0,1,0,0,0,2,0,0,0,1,0,0,0,2,0,0,0,1,0,0,0,2,0,0,0,1,0,0,0,2,0,0,0,1,0,0,0,2,0,0,0,1,0,0,0,2,0,0,0,1,0,0,0,2,0,0,0,1,0,0,0,1,0,47,0,0,0,1,0,47,0,0,0,1,0,47,0,0,0,1,0,47,0,0,0,1,0,47,0,0,0,1,0,47,0,0,0,1,0,47,0,0,0,1,0,47,0,0,0,1,0,47,0,0,0,1,0,47,0,0,0,1,0,47,0,0,0,1,0,47,0,0,0,1,0,47,0,0,0,1,0,47,0,0,0,1,0,47,0,0,0,1,0,37,0,0,0,1,0,37,0,0,0,1,0,37,0,0,0,1,0,37,0,0,0,1,0,37,0,0,0,1,0,37,0,0,0,1,0,37,0,0,0,1,0,37,0,0,0,1,0,37,0,0,0,1,0,37,0,0,0,1,0,37,0,0,0,1,0,37,0,0,0,1,0,37,0,0,0,1,0,37,0,0,0,1,0,37,0,0,0,4,0,2,0,3,0,4,0,5,0,0,0,4,0,2,0,3,0,4,0,5,0,0,0,4,0,2,0,3,0,4,0,5,0,0,0,6,0,2,0,3,0,4,0,5,0,6,0,7,0,0,0,4,0,2,0,3,0,4,0,5,0,0,0,4,0,2,0,3,0,4,0,5,0,0,0,4,0,2,0,3,0,4,0,5,0,0,0,4,0,2,0,3,0,4,0,5,0,0,0,4,0,2,0,3,0,4,0,5,0,0,0,4,0,2,0,3,0,4,0,5,0,0,0,4,0,2,0,3,0,4,0,5,0,0,0,4,0,2,0,3,0,4,0,5,0,0,0,4,0,2,0,3,0,4,0,5,0,0,0,4,0,2,0,3,0,4,0,5,0,0,0,4,0,2,0,3,0,4,0,5,0,0,0,1,0,38,0,0,0,1,0,38,0,0,0,1,0,38,0,0,0,1,0,38,0,0,0,1,0,38,0,0,0,1,0,38,0,0,0,1,0,38,0,0,0,1,0,38,0,0,0,1,0,38,0,0,0,1,0,38,0,0,0,1,0,38,0,0,0,1,0,38,0,0,0,1,0,38,0,0,0,1,0,38,0,0,0,1,0,38,0,0,0,1,0,26,0,0,0,1,0,26,0,0,0,1,0,26,0,0,0,1,0,26,0,0,0,1,0,26,0,0,0,1,0,26,0,0,0,1,0,26,0,0,0,1,0,26,0,0,0,1,0,26,0,0,0,1,0,26,0,0,0,1,0,26,0,0,0,1,0,26,0,0,0,1,0,26,0,0,0,1,0,26,0,0,0,1,0,26,0,0,0,3,0,27,0,28,0,29,0,0,0,3,0,27,0,28,0,29,0,0,0,3,0,27,0,28,0,29,0,0,0,3,0,27,0,28,0,29,0,0,0,3,0,27,0,28,0,29,0,0,0,3,0,27,0,28,0,29,0,0,0,3,0,27,0,28,0,29,0,0,0,3,0,27,0,28,0,29,0,0,0,3,0,27,0,28,0,29,0,0,0,3,0,27,0,28,0,29,0,0,0,3,0,27,0,28,0,29,0,0,0,3,0,27,0,28,0,29,0,0,0,3,0,27,0,28,0,29,0,0,0,3,0,27,0,28,0,29,0,0,0,3,0,27,0,28,0,29,0,0,0,3,0,39,0,40,0,41,0,0,0,3,0,39,0,40,0,41,0,0,0,3,0,39,0,40,0,41,0,0,0,3,0,39,0,40,0,41,0,0,0,3,0,39,0,40,0,41,0,0,0,3,0,39,0,40,0,41,0,0,0,3,0,39,0,40,0,41,0,0,0,4,0,39,0,40,0,41,0,42,0,0,0,3,0,39,0,40,0,41,0,0,0,3,0,39,0,40,0,41,0,0,0,3,0,39,0,40,0,41,0,0,0,3,0,39,0,40,0,41,0,0,0,3,0,39,0,40,0,41,0,0,0,3,0,39,0,40,0,41,0,0,0,3,0,39,0,40,0,41,0,0,0,1,0,32,0,0,0,1,0,32,0,0,0,1,0,32,0,0,0,1,0,32,0,0,0,1,0,32,0,0,0,1,0,32,0,0,0,1,0,32,0,0,0,1,0,32,0,0,0,1,0,32,0,0,0,1,0,32,0,0,0,1,0,32,0,0,0,1,0,32,0,0,0,1,0,32,0,0,0,1,0,32,0,0,0,1,0,32,0,0,0,1,0,20,0,0,0,1,0,21,0,0,0,1,0,19,0,0,0,1,0,16,0,0,0,1,0,9,0,0,0,1,0,15,0,0,0,1,0,18,0,0,0,1,0,17,0,0,0,1,0,12,0,0,0,1,0,11,0,0,0,1,0,8,0,0,0,1,0,10,0,0,0,1,0,13,0,0,0,1,0,14,0,0,0,1,0,25,0,0,0,1,0,25,0,0,0,1,0,25,0,0,0,1,0,25,0,0,0,1,0,25,0,0,0,1,0,25,0,0,0,1,0,25,0,0,0,1,0,25,0,0,0,1,0,25,0,0,0,1,0,25,0,0,0,1,0,25,0,0,0,1,0,25,0,0,0,1,0,25,0,0,0,1,0,25,0,0,0,1,0,25,0,0,0,1,0,35,0,0,0,1,0,35,0,0,0,1,0,35,0,0,0,1,0,35,0,0,0,1,0,35,0,0,0,1,0,35,0,0,0,1,0,35,0,0,0,1,0,35,0,0,0,1,0,35,0,0,0,1,0,35,0,0,0,1,0,35,0,0,0,1,0,35,0,0,0,1,0,35,0,0,0,1,0,35,0,0,0,1,0,35,0,0,0,2,0,30,0,31,0,0,0,2,0,30,0,31,0,0,0,2,0,30,0,31,0,0,0,2,0,30,0,31,0,0,0,2,0,30,0,31,0,0,0,2,0,30,0,31,0,0,0,2,0,30,0,31,0,0,0,2,0,30,0,31,0,0,0,2,0,30,0,31,0,0,0,2,0,30,0,31,0,0,0,2,0,30,0,31,0,0,0,2,0,30,0,31,0,0,0,2,0,30,0,31,0,0,0,2,0,30,0,31,0,0,0,2,0,30,0,31,0,0,0,1,0,33,0,0,0,1,0,33,0,0,0,1,0,33,0,0,0,1,0,33,0,0,0,1,0,33,0,0,0,1,0,33,0,0,0,1,0,33,0,0,0,1,0,33,0,0,0,1,0,33,0,0,0,1,0,33,0,0,0,1,0,33,0,0,0,1,0,33,0,0,0,1,0,33,0,0,0,1,0,33,0,0,0,1,0,33,0,0,0,1,0,23,0,0,0,1,0,23,0,0,0,1,0,23,0,0,0,1,0,23,0,0,0,1,0,23,0,0,0,1,0,23,0,0,0,1,0,23,0,0,0,1,0,23,0,0,0,1,0,23,0,0,0,1,0,23,0,0,0,1,0,23,0,0,0,1,0,23,0,0,0,1,0,23,0,0,0,1,0,23,0,0,0,1,0,23,0,0,0,1,0,36,0,0,0,1,0,36,0,0,0,1,0,36,0,0,0,1,0,36,0,0,0,1,0,36,0,0,0,1,0,36,0,0,0,1,0,36,0,0,0,1,0,36,0,0,0,1,0,36,0,0,0,1,0,36,0,0,0,1,0,36,0,0,0,1,0,36,0,0,0,1,0,36,0,0,0,1,0,36,0,0,0,1,0,36,19,200,0,1,0,43,19,194,0,1,0,43,19,188,0,1,0,43,19,182,0,1,0,43,19,176,0,1,0,43,19,170,0,1,0,43,19,164,0,1,0,43,19,158,0,1,0,43,19,152,0,1,0,43,19,146,0,1,0,43,19,140,0,1,0,43,19,134,0,1,0,43,19,128,0,1,0,43,19,122,0,1,0,43,19,116,0,1,0,43,19,162,0,1,0,44,19,156,0,1,0,44,19,150,0,1,0,44,19,144,0,1,0,44,19,138,0,1,0,44,19,132,0,1,0,44,19,126,0,1,0,44,19,120,0,1,0,44,19,114,0,1,0,44,19,108,0,1,0,44,19,102,0,1,0,44,19,96,0,1,0,44,19,90,0,1,0,44,19,84,0,1,0,44,19,78,0,1,0,44,19,128,0,1,0,45,19,122,0,1,0,45,19,116,0,1,0,45,19,110,0,1,0,45,19,104,0,1,0,45,19,98,0,1,0,45,19,92,0,1,0,45,19,86,0,1,0,45,19,80,0,1,0,45,19,74,0,1,0,45,19,68,0,1,0,45,19,62,0,1,0,45,19,56,0,1,0,45,19,50,0,1,0,45,19,44,0,1,0,45,19,60,0,1,0,46,19,54,0,1,0,46,19,48,0,1,0,46,19,42,0,1,0,46,19,36,0,1,0,46,19,30,0,1,0,46,19,24,0,1,0,46,19,18,0,1,0,46,19,12,0,1,0,46,19,6,0,1,0,46,19,0,0,1,0,46,18,250,0,1,0,46,18,244,0,1,0,46,18,238,0,1,0,46,18,232,0,1,0,46,0,0,0,1,0,48,0,0,0,1,0,48,0,0,0,1,0,48,0,0,0,1,0,48,0,0,0,1,0,48,0,0,0,1,0,48,0,0,0,1,0,48,0,0,0,1,0,48,0,0,0,1,0,48,0,0,0,1,0,48,0,0,0,1,0,48,0,0,0,1,0,48,0,0,0,1,0,48,0,0,0,1,0,48,0,0,0,1,0,48,0,0,0,1,0,22,0,0,0,1,0,22,0,0,0,1,0,22,0,0,0,1,0,22,0,0,0,1,0,22,0,0,0,1,0,22,0,0,0,1,0,22,0,0,0,1,0,22,0,0,0,1,0,22,0,0,0,1,0,22,0,0,0,1,0,22,0,0,0,1,0,22,0,0,0,1,0,22,0,0,0,1,0,22,0,0,0,1,0,22,0,0,0,1,0,24,0,0,0,1,0,24,0,0,0,1,0,24,0,0,0,1,0,24,0,0,0,1,0,24,0,0,0,1,0,24,0,0,0,1,0,24,0,0,0,1,0,24,0,0,0,1,0,24,0,0,0,1,0,24,0,0,0,1,0,24,0,0,0,1,0,24,0,0,0,1,0,24,0,0,0,1,0,24,0,0,0,1,0,24,0,0,0,1,0,34,0,0,0,1,0,34,0,0,0,1,0,34,0,0,0,1,0,34,0,0,0,1,0,34,0,0,0,1,0,34,0,0,0,1,0,34,0,0,0,1,0,34,0,0,0,1,0,34,0,0,0,1,0,34,0,0,0,1,0,34,0,0,0,1,0,34,0,0,0,1,0,34,0,0,0,1,0,34,0,0,0,1,0,34,0,57,0,116,0,124,0,132,0,146,0,156,0,164,0,172,0,180,0,188,0,196,0,206,0,214,0,222,0,230,0,238,0,246,0,254,1,6,1,16,1,26,1,34,1,42,1,50,1,58,1,66,1,74,1,82,1,90,1,98,1,106,1,116,1,126,1,134,1,142,1,150,1,158,1,166,1,174,1,182,1,190,1,198,1,210,1,218,1,254,2,6,2,14,2,22,2,30,2,38,2,46,2,54,2,62,2,70,2,78,2,86,2,94,2,102,0,1,0,0,0,1,21,216,0,3,0,0,0,1,29,80,0,6,0,0,0,4,1,234,1,252,2,16,2,34,0,6,0,0,0,2,2,38,2,56,0,4,0,0,0,1,2,64,0,4,0,0,0,1,2,238,0,4,0,0,0,1,3,156,0,4,0,0,0,1,3,226,0,4,0,0,0,1,4,40,0,6,0,0,0,2,4,62,4,82,0,1,0,0,0,1,4,92,0,1,0,0,0,1,4,98,0,1,0,0,0,1,4,104,0,1,0,0,0,1,4,102,0,1,0,0,0,1,4,100,0,1,0,0,0,1,4,98,0,1,0,0,0,1,4,96,0,6,0,0,0,2,4,94,4,112,0,6,0,0,0,2,4,120,4,138,0,1,0,0,0,1,4,146,0,1,0,0,0,1,4,144,0,1,0,0,0,1,4,150,0,1,0,0,0,1,4,152,0,1,0,0,0,1,4,150,0,1,0,0,0,1,4,148,0,1,0,0,0,1,5,60,0,1,0,0,0,1,5,58,0,1,0,0,0,1,5,56,0,1,0,0,0,1,5,54,0,6,0,0,0,2,5,52,5,70,0,6,0,0,0,2,5,78,5,96,0,4,0,0,0,1,5,104,0,1,0,0,0,1,5,116,0,1,0,0,0,1,5,114,0,1,0,0,0,1,5,152,0,1,0,0,0,1,5,190,0,1,0,0,0,1,5,228,0,1,0,0,0,1,9,228,0,4,0,0,0,1,10,126,0,4,0,0,0,1,10,192,0,6,0,0,0,3,12,166,12,184,12,202,0,4,0,0,0,1,12,208,0,6,0,0,0,15,12,234,13,8,13,40,13,74,13,110,13,148,13,188,13,230,14,10,14,48,14,88,14,130,14,174,14,220,15,12,0,1,0,0,0,1,14,254,0,1,0,0,0,1,15,42,0,4,0,0,0,1,15,90,0,4,0,0,0,1,15,104,0,1,0,0,0,1,15,226,0,1,0,0,0,1,19,162,0,1,0,0,0,1,33,122,0,4,0,0,0,1,33,186,0,1,0,0,0,1,33,208,0,1,0,0,0,1,33,210,0,1,0,0,0,1,33,212,0,1,0,0,0,1,33,214,0,1,0,0,0,1,33,246,0,1,0,0,0,1,33,244,0,3,0,0,0,1,34,30,0,1,34,38,0,1,0,0,0,49,0,3,0,0,0,1,34,12,0,2,34,60,34,20,0,1,0,0,0,49,0,3,0,1,34,62,0,1,34,62,0,0,0,1,0,0,0,49,0,3,0,1,34,110,0,1,34,44,0,0,0,1,0,0,0,49,0,3,0,0,0,1,34,26,0,1,34,114,0,1,0,0,0,49,0,3,0,1,34,96,0,1,34,8,0,0,0,1,0,0,0,49,0,1,34,142,0,8,0,22,0,56,0,66,0,92,0,110,0,128,0,138,0,164,0,4,0,10,0,16,0,22,0,28,7,187,0,2,7,193,7,188,0,2,7,194,7,189,0,2,7,198,7,190,0,2,7,205,0,1,0,4,7,192,0,2,7,205,0,3,0,8,0,14,0,20,7,202,0,2,7,186,7,203,0,2,7,194,7,204,0,2,7,205,0,2,0,6,0,12,7,206,0,2,7,193,7,207,0,2,7,194,0,2,0,6,0,12,7,222,0,2,7,227,7,223,0,2,7,237,0,1,0,4,7,225,0,2,7,237,0,3,0,8,0,14,0,20,7,234,0,2,7,221,7,235,0,2,7,227,7,236,0,2,7,237,0,2,0,6,0,12,7,238,0,2,7,226,7,239,0,2,7,227,0,1,33,216,0,8,0,22,0,56,0,66,0,92,0,110,0,128,0,138,0,164,0,4,0,10,0,16,0,22,0,28,7,187,0,2,7,193,7,188,0,2,7,194,7,189,0,2,7,198,7,190,0,2,7,205,0,1,0,4,7,192,0,2,7,205,0,3,0,8,0,14,0,20,7,202,0,2,7,186,7,203,0,2,7,194,7,204,0,2,7,205,0,2,0,6,0,12,7,206,0,2,7,193,7,207,0,2,7,194,0,2,0,6,0,12,7,222,0,2,7,227,7,223,0,2,7,237,0,1,0,4,7,225,0,2,7,237,0,3,0,8,0,14,0,20,7,234,0,2,7,221,7,235,0,2,7,227,7,236,0,2,7,237,0,2,0,6,0,12,7,238,0,2,7,226,7,239,0,2,7,227,0,1,33,54,0,2,0,10,0,44,0,4,0,10,0,16,0,22,0,28,8,48,0,2,7,193,8,47,0,2,7,194,8,50,0,2,7,201,8,49,0,2,7,208,0,4,0,10,0,16,0,22,0,28,8,44,0,2,7,193,8,43,0,2,7,194,8,46,0,2,7,201,8,45,0,2,7,208,0,1,32,232,0,2,0,10,0,44,0,4,0,10,0,16,0,22,0,28,8,48,0,2,7,193,8,47,0,2,7,194,8,50,0,2,7,201,8,49,0,2,7,208,0,4,0,10,0,16,0,22,0,28,8,44,0,2,7,193,8,43,0,2,7,194,8,46,0,2,7,201,8,45,0,2,7,208,0,1,32,162,0,2,0,10,0,20,0,1,0,4,0,245,0,2,0,100,0,1,0,4,1,243,0,2,1,96,0,3,0,0,0,2,32,140,32,146,0,1,32,140,0,1,0,0,0,50,0,3,0,0,0,2,32,132,32,126,0,1,32,132,0,1,0,0,0,50,0,2,32,118,0,4,0,182,0,192,1,178,1,187,0,2,32,104,0,4,0,182,0,192,1,178,1,187,0,1,32,102,0,9,0,1,32,96,0,9,0,1,32,90,0,9,0,1,32,84,0,9,0,1,32,78,0,9,0,3,0,0,0,1,32,78,0,1,32,86,0,1,0,0,0,51,0,3,0,0,0,1,32,60,0,1,32,96,0,1,0,0,0,52,0,3,0,0,0,1,32,42,0,1,32,50,0,1,0,0,0,53,0,3,0,0,0,1,32,24,0,1,32,60,0,1,0,0,0,54,0,1,32,94,0,95,0,2,32,94,0,4,3,122,3,123,3,218,3,219,0,2,32,92,0,2,3,124,3,220,0,1,32,90,0,53,0,1,32,84,0,20,0,2,32,88,0,85,3,4,3,5,3,6,3,7,3,8,3,9,3,10,3,11,3,12,3,13,3,14,3,15,3,16,3,17,3,18,3,19,3,20,3,21,3,22,3,23,3,24,3,25,3,26,3,27,3,28,3,29,6,94,6,95,6,96,6,97,6,98,6,99,6,100,6,101,6,102,6,103,6,104,6,105,6,106,6,107,6,108,6,109,6,110,6,111,6,112,6,113,6,114,6,115,6,116,6,117,6,118,6,119,6,120,6,121,6,122,6,123,6,124,6,125,6,126,6,127,6,128,6,129,6,130,6,131,6,132,6,133,6,134,6,135,6,136,6,137,6,138,6,139,6,140,6,141,6,142,6,233,6,234,6,235,6,236,6,237,6,238,6,239,6,240,6,241,6,242,0,1,31,158,0,80,0,1,31,152,0,70,0,1,32,48,255,229,0,1,31,140,0,80,0,3,0,1,32,42,0,1,32,48,0,0,0,1,0,0,0,54,0,3,0,1,32,40,0,1,32,30,0,0,0,1,0,0,0,54,0,3,0,1,31,98,0,1,32,32,0,0,0,1,0,0,0,54,0,3,0,1,31,80,0,1,32,22,0,0,0,1,0,0,0,54,0,1,32,12,0,1,0,8,0,1,0,4,7,176,0,3,1,123,7,18,0,1,31,42,0,10,0,2,31,248,0,20,6,153,6,154,6,155,6,156,6,157,6,158,6,159,6,160,6,161,6,162,6,143,6,144,6,145,6,146,6,147,6,148,6,149,6,150,6,151,6,152,0,2,31,212,0,20,6,183,6,184,6,185,6,186,6,187,6,188,6,189,6,190,6,191,6,192,6,173,6,174,6,175,6,176,6,177,6,178,6,179,6,180,6,181,6,182,0,2,31,176,0,20,6,143,6,144,6,145,6,146,6,147,6,148,6,149,6,150,6,151,6,152,6,183,6,184,6,185,6,186,6,187,6,188,6,189,6,190,6,191,6,192,0,2,31,146,2,1,2,4,2,5,2,6,2,7,2,8,2,9,2,10,2,11,2,12,2,13,2,14,2,15,2,16,2,17,2,18,2,19,2,20,2,21,2,22,2,23,2,24,2,26,2,27,2,28,2,29,2,30,2,31,2,32,2,33,2,34,2,35,2,36,2,37,2,38,2,39,2,40,2,41,2,42,2,43,2,44,2,45,2,46,2,47,2,48,2,49,2,50,2,51,2,52,2,53,2,54,2,55,2,56,2,57,2,58,2,59,2,60,2,61,2,62,2,63,2,64,2,65,2,66,2,67,2,68,2,69,2,70,2,71,2,72,2,75,2,76,2,77,2,78,2,79,2,80,2,81,2,82,2,83,2,84,2,85,2,86,2,87,2,88,2,89,2,91,2,92,2,93,2,94,2,95,2,96,2,97,2,98,2,99,2,100,2,101,2,102,2,103,2,104,2,105,2,106,2,107,2,108,2,109,2,110,2,111,2,112,2,113,2,114,2,115,2,116,2,117,2,118,2,119,2,120,2,121,2,122,2,123,2,124,2,125,2,126,2,127,2,128,2,129,2,130,2,131,2,132,2,133,2,134,2,135,2,136,2,137,2,138,2,139,2,140,2,141,2,142,2,143,2,144,2,145,2,146,2,147,2,148,2,149,2,150,2,151,2,152,2,153,2,154,2,155,2,156,2,157,2,158,2,159,2,160,2,161,2,162,2,163,2,164,2,165,2,166,2,167,2,168,2,169,2,170,2,171,2,172,2,173,2,174,2,175,2,176,2,177,2,178,2,179,2,180,2,181,2,182,2,183,2,184,2,185,2,186,2,187,2,188,2,189,2,190,2,191,2,192,2,193,2,194,2,195,2,196,2,197,2,198,2,199,2,200,2,201,2,202,2,203,2,204,2,205,2,206,2,207,2,208,2,209,2,210,2,211,2,212,2,213,2,214,2,215,2,216,2,217,2,218,2,219,2,220,2,221,2,222,2,223,2,224,2,225,2,226,2,227,2,228,2,229,2,230,2,231,2,232,2,233,2,234,2,235,2,236,2,237,2,238,2,239,2,240,2,241,2,242,2,243,2,244,2,245,2,246,2,247,2,248,2,249,2,90,2,73,2,74,3,222,3,223,3,224,3,225,3,226,3,227,3,228,3,229,3,230,3,231,3,232,3,233,3,234,3,235,3,236,3,237,3,238,3,239,3,240,3,241,3,242,3,243,3,244,3,245,3,246,3,247,3,248,3,249,3,250,3,251,3,252,3,253,3,254,3,255,4,0,4,1,4,2,4,3,4,4,4,5,4,6,4,7,4,8,4,9,4,10,4,11,4,12,4,13,4,14,4,15,4,16,4,17,4,18,4,19,4,20,4,21,4,22,4,23,4,24,4,25,4,26,4,27,4,28,4,29,4,30,4,31,4,32,4,33,4,34,4,35,4,36,4,37,4,38,4,39,4,40,4,41,4,42,4,43,4,44,4,45,4,46,4,47,4,48,4,49,4,50,4,51,4,52,4,53,4,54,4,55,4,56,4,57,4,58,4,59,4,60,3,223,5,127,5,128,5,129,5,130,5,131,5,132,5,133,5,134,5,135,5,136,5,137,5,138,5,139,5,140,5,141,5,142,5,143,5,144,5,145,5,146,5,147,5,148,5,149,5,150,5,151,5,152,5,153,5,154,5,155,5,156,5,157,5,158,5,159,5,160,5,161,5,162,5,164,5,165,5,166,5,167,5,168,5,169,5,170,5,171,5,172,5,173,5,174,5,175,5,176,5,177,5,178,5,179,5,180,5,181,5,182,5,183,5,184,5,185,5,186,5,187,5,188,5,189,5,190,5,191,5,192,5,193,5,194,5,195,5,196,5,197,5,198,5,199,5,200,5,201,5,202,5,203,5,204,5,205,5,206,5,207,5,208,5,209,5,210,5,211,5,212,5,213,5,214,5,215,5,216,5,217,5,218,5,219,5,220,5,221,5,222,5,223,5,224,5,225,5,226,5,227,5,228,5,229,5,230,5,231,5,232,5,233,5,234,5,235,5,236,5,237,5,238,5,239,5,240,5,241,5,242,5,243,5,244,5,245,5,246,5,247,5,248,5,249,5,250,5,251,5,252,5,253,5,254,5,255,6,0,6,1,6,2,6,3,6,4,6,5,6,6,6,7,6,8,6,9,6,10,6,11,6,12,6,13,6,14,6,15,6,16,6,17,6,18,6,19,6,20,6,21,6,22,6,23,6,24,6,25,6,26,6,27,6,28,6,29,5,163,7,66,7,67,7,68,7,69,7,70,7,75,7,71,7,72,7,73,7,74,7,183,8,56,8,57,0,2,27,220,0,78,6,153,6,154,6,155,6,156,6,157,6,158,6,159,6,160,6,161,6,162,6,153,6,154,6,155,6,156,6,157,6,158,6,159,6,160,6,161,6,162,6,153,6,154,6,155,6,156,6,157,6,158,6,159,6,160,6,161,6,162,7,27,7,28,7,29,7,30,7,37,7,38,7,39,7,40,7,41,7,49,7,50,7,51,7,62,7,63,7,64,7,65,7,182,7,221,7,222,7,223,7,224,7,225,7,226,7,227,7,228,7,229,7,230,7,231,7,232,7,233,7,234,7,235,7,236,7,237,7,238,7,239,7,240,7,241,8,18,8,21,8,40,8,24,8,26,8,28,8,30,8,32,8,39,8,42,0,1,27,212,0,5,0,16,0,34,0,44,0,54,0,64,0,2,0,6,0,12,1,253,0,2,1,73,1,254,0,2,1,183,0,1,0,4,1,255,0,2,1,96,0,1,0,4,2,2,0,2,1,183,0,1,0,4,5,125,0,2,4,220,0,1,0,4,5,126,0,2,4,228,0,1,27,152,0,8,0,22,0,32,0,42,0,52,0,174,1,40,1,66,1,116,0,1,0,4,2,3,0,2,1,73,0,1,0,4,5,125,0,2,4,220,0,1,0,4,5,126,0,2,4,228,0,15,0,32,0,38,0,44,0,50,0,56,0,62,0,68,0,74,0,80,0,86,0,92,0,98,0,104,0,110,0,116,0,69,0,2,0,47,8,52,0,2,0,71,0,99,0,2,0,83,0,221,0,2,0,195,0,239,0,2,0,230,1,63,0,2,1,41,8,55,0,2,1,66,1,95,0,2,1,78,1,217,0,2,1,191,1,235,0,2,1,226,2,70,0,2,2,48,8,57,0,2,2,75,2,105,0,2,2,87,2,226,0,2,2,200,2,244,0,2,2,235,0,15,0,32,0,38,0,44,0,50,0,56,0,62,0,68,0,74,0,80,0,86,0,92,0,98,0,104,0,110,0,116,0,69,0,2,0,47,8,52,0,2,0,71,0,99,0,2,0,83,0,221,0,2,0,195,0,239,0,2,0,230,1,63,0,2,1,41,8,55,0,2,1,66,1,95,0,2,1,78,1,217,0,2,1,191,1,235,0,2,1,226,2,70,0,2,2,48,8,57,0,2,2,75,2,105,0,2,2,87,2,226,0,2,2,200,2,244,0,2,2,235,0,3,0,8,0,14,0,20,0,231,0,2,0,230,1,227,0,2,1,226,2,236,0,2,2,235,0,6,0,14,0,20,0,26,0,32,0,38,0,44,0,90,0,2,0,83,0,138,0,2,0,127,1,85,0,2,1,78,1,134,0,2,1,123,2,95,0,2,2,87,2,144,0,2,2,133,0,15,0,32,0,38,0,44,0,50,0,56,0,62,0,68,0,74,0,80,0,86,0,92,0,98,0,104,0,110,0,116,0,69,0,2,0,47,8,52,0,2,0,71,0,99,0,2,0,83,0,221,0,2,0,195,0,239,0,2,0,230,1,63,0,2,1,41,8,55,0,2,1,66,1,95,0,2,1,78,1,217,0,2,1,191,1,235,0,2,1,226,2,70,0,2,2,48,8,57,0,2,2,75,2,105,0,2,2,87,2,226,0,2,2,200,2,244,0,2,2,235,0,3,0,0,0,1,25,190,0,1,25,190,0,1,0,0,0,54,0,3,0,0,0,1,25,172,0,1,25,178,0,1,0,0,0,55,0,3,0,0,0,1,25,154,0,1,25,196,0,1,0,0,0,56,0,1,25,136,0,1,0,8,0,3,0,8,0,14,0,20,2,0,0,2,1,78,1,255,0,2,1,96,2,1,0,2,1,102,0,3,0,6,25,204,25,194,25,184,25,174,25,164,25,154,0,1,25,210,0,1,26,0,0,1,0,0,0,56,0,3,0,6,25,174,25,164,25,154,25,144,25,134,25,124,0,1,25,180,0,2,25,180,25,226,0,1,0,0,0,56,0,3,0,6,25,142,25,132,25,122,25,112,25,102,25,92,0,1,25,148,0,3,25,148,25,148,25,194,0,1,0,0,0,56,0,3,0,6,25,108,25,98,25,88,25,78,25,68,25,58,0,1,25,114,0,4,25,114,25,114,25,114,25,160,0,1,0,0,0,56,0,3,0,6,25,72,25,62,25,52,25,42,25,32,25,22,0,1,25,78,0,5,25,78,25,78,25,78,25,78,25,124,0,1,0,0,0,56,0,3,0,6,25,34,25,24,25,14,25,4,24,250,24,240,0,1,25,40,0,6,25,40,25,40,25,40,25,40,25,40,25,86,0,1,0,0,0,56,0,3,0,6,24,250,24,240,24,230,24,220,24,210,24,200,0,1,25,0,0,7,25,0,25,0,25,0,25,0,25,0,25,0,25,46,0,1,0,0,0,56,0,3,0,9,24,208,24,198,24,188,25,70,25,60,25,50,25,40,25,30,25,20,0,1,24,214,0,1,25,4,0,1,0,0,0,56,0,3,0,9,24,172,24,162,24,152,25,34,25,24,25,14,25,4,24,250,24,240,0,1,24,178,0,2,24,178,24,224,0,1,0,0,0,56,0,3,0,9,24,134,24,124,24,114,24,252,24,242,24,232,24,222,24,212,24,202,0,1,24,140,0,3,24,140,24,140,24,186,0,1,0,0,0,56,0,3,0,9,24,94,24,84,24,74,24,212,24,202,24,192,24,182,24,172,24,162,0,1,24,100,0,4,24,100,24,100,24,100,24,146,0,1,0,0,0,56,0,3,0,9,24,52,24,42,24,32,24,170,24,160,24,150,24,140,24,130,24,120,0,1,24,58,0,5,24,58,24,58,24,58,24,58,24,104,0,1,0,0,0,56,0,3,0,9,24,8,23,254,23,244,24,126,24,116,24,106,24,96,24,86,24,76,0,1,24,14,0,6,24,14,24,14,24,14,24,14,24,14,24,60,0,1,0,0,0,56,0,3,0,9,23,218,23,208,23,198,24,80,24,70,24,60,24,50,24,40,24,30,0,1,23,224,0,7,23,224,23,224,23,224,23,224,23,224,23,224,24,14,0,1,0,0,0,56,0,3,0,1,24,42,0,1,23,176,0,0,0,1,0,0,0,56,0,0,1,0,0,2,23,154,0,21,0,247,0,248,0,249,0,250,0,251,0,252,0,253,1,245,1,246,1,247,1,248,1,249,1,250,1,251,1,245,1,246,1,247,1,248,1,249,1,250,1,251,0,0,1,1,0,2,23,240,0,23,7,146,7,147,7,148,7,150,7,151,7,152,7,153,7,154,7,155,7,156,7,157,7,158,7,159,7,160,7,137,7,138,7,139,7,140,7,141,7,142,7,143,7,144,7,145,0,0,1,2,0,1,23,234,0,1,0,8,0,1,0,4,8,53,0,2,1,183,0,0,1,3,0,1,23,218,0,5,0,16,0,54,0,72,0,84,0,112,0,4,0,10,0,18,0,26,0,32,7,138,0,3,7,177,7,117,7,144,0,3,7,177,7,118,7,139,0,2,7,117,7,137,0,2,7,177,0,2,0,6,0,12,7,154,0,2,7,117,7,153,0,2,7,177,0,1,0,4,7,140,0,3,7,177,7,46,0,3,0,8,0,16,0,22,7,142,0,3,7,177,7,46,7,143,0,2,7,46,7,156,0,2,7,115,0,2,0,6,0,12,7,141,0,2,7,46,7,155,0,2,7,115,0,2,23,102,1,225,2,4,2,5,2,6,2,7,2,8,2,9,2,10,2,11,2,12,2,13,2,14,2,15,2,16,2,17,2,18,2,19,2,20,2,21,2,22,2,23,2,24,2,26,2,27,2,28,2,29,2,30,2,31,2,32,2,33,2,34,2,35,2,36,2,37,2,38,2,39,2,40,2,41,2,47,2,42,2,43,2,44,2,45,2,46,2,47,2,48,2,49,2,50,2,51,2,52,2,53,2,54,2,55,2,56,2,57,2,58,2,59,2,60,2,61,2,62,2,63,2,64,2,65,2,66,2,67,2,68,2,69,2,70,2,72,2,75,2,76,2,77,2,78,2,79,2,80,2,81,2,82,2,83,2,84,2,85,2,86,2,87,2,102,2,89,2,91,2,92,2,93,2,94,2,95,2,96,2,97,2,98,2,99,2,100,2,101,2,103,2,104,2,105,2,106,2,108,2,109,2,110,2,112,2,118,2,113,2,114,2,115,2,116,2,117,2,118,2,119,2,120,2,121,2,122,2,123,2,130,2,124,2,125,2,126,2,127,2,128,2,129,2,130,2,131,2,132,2,133,2,134,2,135,2,136,2,137,2,138,2,139,2,140,2,141,2,142,2,143,2,144,2,145,2,146,2,147,2,148,2,149,2,150,2,151,2,152,2,153,2,154,2,155,2,156,2,157,2,158,2,159,2,160,2,161,2,162,2,163,2,164,2,165,2,166,2,167,2,168,2,169,2,170,2,171,2,172,2,173,2,174,2,175,2,176,2,177,2,178,2,179,2,180,2,181,2,182,2,183,2,184,2,185,2,186,2,187,2,188,2,189,2,190,2,191,2,71,2,192,2,193,2,194,2,195,2,196,2,198,2,199,2,200,2,201,2,202,2,203,2,204,2,205,2,206,2,207,2,208,2,209,2,210,2,211,2,212,2,213,2,214,2,215,2,216,2,217,2,218,2,219,2,220,2,221,2,222,2,223,2,224,2,225,2,226,2,227,2,228,2,229,2,230,2,231,2,232,2,233,2,234,2,235,2,236,2,237,2,238,2,239,2,240,2,241,2,242,2,243,2,244,2,245,2,246,2,247,2,248,2,249,2,90,2,25,3,222,3,223,3,224,3,225,3,226,3,227,3,228,3,229,3,230,3,231,3,232,3,233,3,234,3,235,3,236,3,237,3,238,3,239,3,240,3,241,3,242,3,243,3,244,3,245,3,246,3,247,3,248,3,249,3,250,3,251,3,252,3,253,3,254,3,255,4,0,4,1,4,2,4,3,4,4,4,5,4,6,4,7,4,8,4,9,4,10,4,11,4,12,4,13,4,14,4,15,4,16,4,17,4,18,4,19,4,20,4,21,4,22,4,23,4,24,4,25,4,26,4,27,4,28,4,29,4,30,4,31,4,32,4,33,4,34,4,35,4,36,4,37,4,38,4,39,4,40,4,41,4,42,4,43,4,44,4,45,4,46,4,47,4,48,4,49,4,50,4,51,4,52,4,53,4,54,4,55,4,56,4,57,4,58,4,59,4,60,5,127,5,128,5,129,5,130,5,131,5,132,5,133,5,134,5,135,5,136,5,137,5,138,5,139,5,140,5,141,5,142,5,143,5,145,5,146,5,147,5,148,5,149,5,150,5,151,5,160,5,161,5,162,5,152,5,158,5,155,5,159,5,153,5,156,5,164,5,165,5,166,5,167,5,168,5,169,5,170,5,171,5,172,5,173,5,174,5,176,5,177,5,178,5,181,5,182,5,183,5,184,5,185,5,186,5,187,5,188,5,190,5,191,5,192,5,193,5,194,5,195,5,196,5,197,5,198,5,199,5,200,5,201,5,202,5,203,5,204,5,205,5,206,5,207,5,209,5,212,5,213,5,214,5,215,5,216,5,217,5,218,5,219,5,221,5,222,5,223,5,224,5,225,5,226,5,227,5,228,5,229,5,230,5,232,5,233,5,237,5,238,5,239,5,240,5,241,5,242,5,243,5,244,5,246,5,248,5,250,5,252,5,254,5,255,6,0,6,2,6,3,6,7,6,8,6,9,6,10,6,11,6,12,6,13,6,14,6,15,6,16,6,18,6,21,6,22,6,23,6,24,6,25,6,26,6,27,6,28,7,66,7,67,7,68,7,69,7,70,7,75,7,71,7,72,7,73,7,74,7,183,8,56,8,57,0,2,19,216,0,63,4,191,4,192,4,193,4,194,4,195,4,196,4,197,4,198,4,199,4,200,4,201,4,202,4,203,4,204,4,205,4,206,4,207,4,208,4,209,4,210,4,211,4,212,4,213,4,214,4,215,4,216,4,217,6,57,6,58,6,59,6,60,6,61,6,62,6,63,6,64,6,65,6,66,6,67,6,68,6,69,6,70,6,71,6,72,6,73,6,74,6,75,6,76,6,77,6,78,6,79,6,80,6,81,6,82,6,83,6,84,6,85,6,86,6,87,6,88,6,89,6,90,6,91,6,92,0,2,19,124,3,189,2,5,2,6,2,7,2,8,2,9,2,10,2,11,2,12,2,13,2,14,2,15,2,16,2,17,2,18,2,19,2,20,2,21,2,22,2,23,2,24,2,26,2,27,2,28,2,29,2,30,2,31,2,32,2,33,2,35,2,36,2,37,2,38,2,39,2,40,2,47,2,42,2,43,2,44,2,45,2,46,2,47,2,48,2,49,2,50,2,51,2,52,2,53,2,54,2,55,2,56,2,57,2,58,2,59,2,60,2,61,2,62,2,63,2,64,2,65,2,66,2,67,2,68,2,69,2,70,2,72,2,75,2,76,2,77,2,78,2,79,2,80,2,81,2,82,2,83,2,84,2,85,2,86,2,102,2,89,2,91,2,92,2,93,2,94,2,95,2,96,2,97,2,98,2,99,2,100,2,101,2,103,2,104,2,105,2,106,2,108,2,109,2,110,2,118,2,113,2,114,2,115,2,116,2,117,2,118,2,119,2,120,2,122,2,123,2,130,2,124,2,125,2,126,2,127,2,128,2,129,2,130,2,131,2,132,2,134,2,135,2,136,2,137,2,138,2,139,2,140,2,141,2,142,2,143,2,144,2,145,2,146,2,147,2,148,2,149,2,150,2,151,2,152,2,153,2,154,2,155,2,156,2,157,2,158,2,159,2,160,2,161,2,162,2,163,2,164,2,165,2,166,2,167,2,168,2,169,2,170,2,171,2,172,2,173,2,174,2,175,2,176,2,177,2,178,2,179,2,180,2,181,2,182,2,183,2,184,2,186,2,187,2,188,2,189,2,190,2,191,2,71,2,192,2,193,2,194,2,196,2,198,2,199,2,200,2,201,2,202,2,203,2,204,2,205,2,206,2,207,2,208,2,209,2,210,2,211,2,212,2,213,2,214,2,215,2,216,2,217,2,218,2,219,2,220,2,221,2,222,2,223,2,224,2,225,2,226,2,227,2,229,2,230,2,231,2,232,2,233,2,235,2,236,2,237,2,238,2,239,2,240,2,241,2,242,2,243,2,244,2,245,2,246,2,247,2,248,2,249,2,90,2,25,2,5,2,6,2,7,2,8,2,9,2,10,2,11,2,12,2,13,2,14,2,15,2,16,2,17,2,18,2,19,2,20,2,21,2,22,2,23,2,24,2,26,2,27,2,28,2,29,2,30,2,31,2,32,2,35,2,36,2,37,2,38,2,39,2,40,2,42,2,43,2,44,2,45,2,46,2,47,2,49,2,50,2,51,2,52,2,53,2,54,2,55,2,56,2,57,2,58,2,59,2,60,2,61,2,62,2,63,2,64,2,65,2,66,2,67,2,68,2,69,2,70,2,71,2,76,2,77,2,78,2,79,2,80,2,81,2,83,2,84,2,85,2,86,2,88,2,89,2,91,2,92,2,93,2,94,2,95,2,96,2,97,2,98,2,99,2,100,2,101,2,102,2,103,2,104,2,105,2,107,2,108,2,110,2,111,2,113,2,114,2,115,2,116,2,117,2,118,2,119,2,120,2,122,2,124,2,125,2,126,2,127,2,128,2,129,2,130,2,131,2,132,2,134,2,135,2,136,2,137,2,138,2,139,2,140,2,141,2,142,2,143,2,144,2,145,2,146,2,147,2,148,2,149,2,150,2,151,2,152,2,153,2,154,2,155,2,156,2,157,2,158,2,159,2,160,2,161,2,162,2,163,2,164,2,165,2,166,2,167,2,168,2,170,2,173,2,174,2,175,2,176,2,177,2,178,2,179,2,181,2,182,2,183,2,184,2,186,2,187,2,188,2,189,2,190,2,191,2,193,2,194,2,196,2,197,2,198,2,199,2,201,2,202,2,203,2,204,2,205,2,206,2,207,2,208,2,209,2,210,2,211,2,212,2,213,2,214,2,215,2,216,2,217,2,218,2,219,2,220,2,221,2,222,2,223,2,224,2,225,2,226,2,227,2,230,2,231,2,232,2,233,2,236,2,237,2,238,2,239,2,240,2,241,2,242,2,243,2,244,2,246,2,247,2,248,2,249,2,90,2,73,2,74,1,245,1,246,1,247,1,248,1,249,1,250,1,251,3,222,3,223,3,224,3,225,3,226,3,227,3,228,3,229,3,230,3,231,3,232,3,233,3,234,3,235,3,236,3,237,3,238,3,239,3,240,3,241,3,242,3,243,3,244,3,245,3,246,3,247,3,248,3,249,3,250,3,251,3,252,3,253,3,254,3,255,4,0,4,1,4,2,4,3,4,4,4,5,4,6,4,7,4,8,4,9,4,10,4,11,4,12,4,13,4,14,4,15,4,16,4,17,4,18,4,20,4,21,4,23,4,24,4,25,4,26,4,27,4,28,4,30,4,31,4,32,4,33,4,34,4,35,4,36,4,37,4,38,4,39,4,40,4,41,4,42,4,43,4,44,4,45,4,46,4,47,4,48,4,49,4,50,4,51,4,52,4,53,4,54,4,55,4,56,4,57,4,58,4,59,4,60,3,222,3,224,3,225,3,226,3,227,3,228,3,229,3,230,3,231,3,232,3,233,3,234,3,235,3,236,3,237,3,238,3,239,3,240,3,241,3,242,3,243,3,244,3,245,3,246,3,247,3,248,3,249,3,250,3,251,3,252,3,253,3,254,3,255,4,0,4,1,4,2,4,3,4,4,4,5,4,6,4,7,4,8,4,9,4,10,4,11,4,12,4,13,4,14,4,15,4,16,4,17,4,18,4,20,4,21,4,23,4,24,4,25,4,26,4,27,4,28,4,30,4,31,4,32,4,33,4,34,4,35,4,36,4,37,4,38,4,39,4,40,4,41,4,42,4,43,4,44,4,45,4,46,4,47,4,48,4,49,4,50,4,51,4,52,4,53,4,54,4,55,4,56,4,57,4,58,4,59,4,60,3,223,5,160,5,161,5,162,5,152,5,158,5,155,5,159,5,153,5,156,5,164,5,165,5,166,5,167,5,168,5,169,5,170,5,171,5,172,5,173,5,174,5,176,5,177,5,190,5,191,5,192,5,193,5,194,5,195,5,196,5,197,5,198,5,199,5,200,5,201,5,202,5,203,5,204,5,205,5,206,5,207,5,221,5,222,5,223,5,224,5,225,5,226,5,227,5,228,5,229,5,230,5,232,5,233,5,237,5,238,5,239,5,240,5,241,5,242,5,243,5,244,5,246,5,248,5,250,5,252,5,254,5,255,6,0,6,2,6,3,6,7,6,8,6,9,6,10,6,11,6,12,6,13,6,14,6,15,6,16,5,152,5,153,5,154,5,155,5,156,5,157,5,158,5,159,5,160,5,161,5,162,5,164,5,165,5,166,5,167,5,168,5,169,5,170,5,171,5,172,5,173,5,174,5,175,5,176,5,177,5,178,5,179,5,180,5,181,5,182,5,183,5,184,5,185,5,186,5,187,5,188,5,189,5,190,5,191,5,192,5,193,5,194,5,195,5,196,5,197,5,198,5,199,5,200,5,201,5,202,5,203,5,204,5,205,5,206,5,207,5,208,5,209,5,210,5,211,5,212,5,213,5,214,5,215,5,216,5,217,5,218,5,219,5,220,5,221,5,222,5,223,5,224,5,225,5,226,5,227,5,228,5,229,5,230,5,231,5,232,5,233,5,234,5,235,5,236,5,237,5,238,5,239,5,240,5,241,5,242,5,243,5,244,5,245,5,246,5,247,5,248,5,249,5,250,5,251,5,252,5,253,5,254,5,255,6,0,6,1,6,2,6,3,6,4,6,5,6,6,6,7,6,8,6,9,6,10,6,11,6,12,6,13,6,14,6,15,6,16,6,17,6,18,6,19,6,20,6,21,6,22,6,23,6,24,6,25,6,26,6,27,6,28,6,29,5,163,6,57,6,58,6,59,6,60,6,61,6,62,6,63,6,64,6,65,6,66,6,67,6,68,6,69,6,70,6,71,6,72,6,73,6,74,6,75,6,76,6,77,6,78,6,79,6,80,6,81,6,82,6,83,6,84,6,85,6,86,6,87,6,88,6,89,6,90,6,91,6,92,6,213,6,214,6,215,6,216,6,217,6,218,6,219,6,220,6,221,6,222,7,27,7,28,7,29,7,66,7,67,7,68,7,69,7,70,7,37,7,38,7,39,7,40,7,41,7,49,7,50,7,51,7,62,7,63,7,64,7,65,7,71,7,72,7,73,7,182,7,183,7,221,7,222,7,223,7,224,7,225,7,226,7,227,7,228,7,229,7,230,7,231,7,232,7,233,7,234,7,235,7,236,7,237,7,238,7,239,7,240,7,241,8,18,8,21,8,40,8,24,8,26,8,28,8,30,8,32,8,39,8,42,8,56,8,57,0,1,14,22,0,165,1,80,1,86,1,92,1,98,1,104,1,110,1,116,1,122,1,128,1,134,1,140,1,146,1,156,1,164,1,174,1,184,1,192,1,200,1,208,1,216,1,230,1,240,1,248,2,2,2,12,2,20,2,28,2,34,2,40,2,46,2,52,2,58,2,64,2,70,2,76,2,84,2,90,2,98,2,104,2,110,2,116,2,122,2,128,2,134,2,140,2,146,2,152,2,158,2,164,2,170,2,176,2,182,2,188,2,194,2,200,2,206,2,212,2,218,2,224,2,230,2,236,2,242,2,248,2,254,3,4,3,10,3,16,3,22,3,28,3,34,3,40,3,46,3,52,3,58,3,64,3,70,3,76,3,82,3,88,3,94,3,100,3,106,3,112,3,118,3,124,3,130,3,136,3,142,3,148,3,154,3,160,3,166,3,172,3,178,3,184,3,190,3,196,3,202,3,208,3,214,3,220,3,226,3,232,3,238,3,244,3,250,4,0,4,6,4,12,4,18,4,24,4,30,4,36,4,42,4,48,4,54,4,60,4,66,4,72,4,78,4,84,4,90,4,96,4,112,4,130,4,148,4,166,4,184,4,202,4,220,4,238,5,0,5,18,5,24,5,30,5,36,5,42,5,48,5,54,5,60,5,66,5,72,5,78,5,84,5,90,5,96,5,102,5,108,5,114,5,120,5,126,5,132,5,138,5,144,5,150,5,156,5,162,5,168,5,174,5,180,5,186,5,192,5,198,5,206,5,212,0,2,2,250,2,4,0,2,0,247,2,34,0,2,0,248,2,41,0,2,0,249,2,87,0,2,0,250,2,112,0,2,0,251,2,121,0,2,2,251,2,133,0,2,0,182,2,185,0,2,0,192,2,195,0,2,0,252,2,228,0,2,0,253,2,234,0,4,3,4,2,250,2,4,7,146,0,3,3,5,2,33,7,147,0,4,3,6,2,34,1,245,7,148,0,4,3,7,2,41,1,246,7,150,0,3,3,8,2,48,7,151,0,3,3,9,2,72,7,152,0,3,3,10,2,75,7,153,0,3,3,11,2,82,7,154,0,6,1,79,1,87,3,12,2,87,1,247,7,155,0,4,1,97,3,13,2,106,7,156,0,3,3,14,2,109,7,157,0,4,3,15,2,112,1,248,7,158,0,4,3,16,2,121,1,249,7,159,0,3,3,17,2,123,7,160,0,3,3,18,2,251,2,133,0,2,3,19,2,169,0,2,3,20,2,171,0,2,3,21,2,172,0,2,3,22,2,180,0,2,1,178,2,185,0,2,3,23,2,192,0,2,1,187,2,195,0,2,3,24,2,200,0,3,3,25,2,228,1,250,0,2,3,26,2,229,0,3,3,27,2,234,1,251,0,2,3,28,2,235,0,2,3,29,2,245,0,2,3,122,4,19,0,2,3,123,4,22,0,2,3,124,4,29,0,2,3,221,3,223,0,2,3,218,4,19,0,2,3,219,4,22,0,2,3,220,4,29,0,2,6,94,5,127,0,2,6,95,5,128,0,2,6,96,5,129,0,2,6,97,5,130,0,2,6,98,5,131,0,2,6,99,5,132,0,2,6,100,5,133,0,2,6,101,5,134,0,2,6,102,5,135,0,2,6,103,5,136,0,2,6,104,5,137,0,2,6,105,5,138,0,2,6,106,5,139,0,2,6,107,5,140,0,2,6,108,5,141,0,2,6,109,5,142,0,2,6,110,5,143,0,2,6,111,5,145,0,2,6,112,5,146,0,2,6,113,5,147,0,2,6,114,5,148,0,2,6,115,5,149,0,2,6,116,5,150,0,2,6,117,5,151,0,2,5,178,4,191,0,2,5,181,4,192,0,2,5,182,4,193,0,2,5,183,4,194,0,2,5,184,4,195,0,2,5,185,4,196,0,2,5,186,4,197,0,2,5,187,4,198,0,2,5,188,4,199,0,2,5,209,4,200,0,2,5,212,4,201,0,2,5,213,4,202,0,2,5,214,4,203,0,2,5,215,4,204,0,2,5,216,4,205,0,2,5,217,4,206,0,2,5,218,4,207,0,2,5,219,4,208,0,2,6,18,4,209,0,2,6,21,4,210,0,2,6,22,4,211,0,2,6,23,4,212,0,2,6,24,4,213,0,2,6,25,4,214,0,2,6,26,4,215,0,2,6,27,4,216,0,2,6,28,4,217,0,2,6,118,5,127,0,2,6,119,5,128,0,2,6,120,5,129,0,2,6,121,5,130,0,2,6,122,5,131,0,2,6,123,5,132,0,2,6,124,5,133,0,2,6,125,5,134,0,2,6,126,5,135,0,2,6,127,5,136,0,2,6,128,5,137,0,2,6,129,5,138,0,2,6,130,5,139,0,2,6,131,5,140,0,2,6,132,5,141,0,2,6,133,5,142,0,2,6,134,5,143,0,2,6,135,5,144,0,2,6,136,5,145,0,2,6,137,5,146,0,2,6,138,5,147,0,2,6,139,5,148,0,2,6,140,5,149,0,2,6,141,5,150,0,2,6,142,5,151,0,7,6,196,6,163,6,233,6,223,6,213,6,153,6,183,0,8,6,197,6,164,6,234,6,224,6,214,6,154,6,184,7,137,0,8,6,198,6,165,6,235,6,225,6,215,6,155,6,185,7,138,0,8,6,199,6,166,6,236,6,226,6,216,6,156,6,186,7,139,0,8,6,200,6,167,6,237,6,227,6,217,6,157,6,187,7,140,0,8,6,201,6,168,6,238,6,228,6,218,6,158,6,188,7,141,0,8,6,202,6,169,6,239,6,229,6,219,6,159,6,189,7,142,0,8,6,203,6,170,6,240,6,230,6,220,6,160,6,190,7,143,0,8,6,204,6,171,6,241,6,231,6,221,6,161,6,191,7,144,0,8,6,205,6,172,6,242,6,232,6,222,6,162,6,192,7,145,0,2,6,173,6,143,0,2,6,174,6,144,0,2,6,175,6,145,0,2,6,176,6,146,0,2,6,177,6,147,0,2,6,178,6,148,0,2,6,179,6,149,0,2,6,180,6,150,0,2,6,181,6,151,0,2,6,182,6,152,0,2,6,153,6,183,0,2,6,154,6,184,0,2,6,155,6,185,0,2,6,156,6,186,0,2,6,157,6,187,0,2,6,158,6,188,0,2,6,159,6,189,0,2,6,160,6,190,0,2,6,161,6,191,0,2,6,162,6,192,0,2,6,143,6,153,0,2,6,144,6,154,0,2,6,145,6,155,0,2,6,146,6,156,0,2,6,147,6,157,0,2,6,148,6,158,0,2,6,149,6,159,0,2,6,150,6,160,0,2,6,151,6,161,0,2,6,152,6,162,0,3,0,177,1,173,7,75,0,2,6,253,7,30,0,3,0,177,1,173,7,74,0,2,9,112,0,33,1,79,1,97,7,221,7,222,7,223,7,224,7,225,7,226,7,227,7,228,7,229,7,230,7,231,7,232,7,233,7,234,7,235,7,236,7,237,7,238,7,239,7,240,7,241,8,18,8,21,8,40,8,24,8,26,8,28,8,30,8,32,8,39,8,42,0,1,9,110,0,2,0,10,0,20,0,1,0,4,0,109,0,2,7,9,0,1,0,4,1,106,0,2,7,9,0,2,1,164,0,2,0,177,0,177,0,2,1,154,0,2,1,173,1,173,0,2,1,144,0,2,0,177,0,177,0,2,9,58,0,17,2,250,2,251,2,250,1,242,2,251,6,213,6,214,6,215,6,216,6,217,6,218,6,219,6,220,6,221,6,222,1,173,1,173,0,1,3,214,0,179,0,2,9,50,0,22,0,247,0,248,0,249,0,250,0,251,0,252,0,253,1,245,1,246,1,252,1,247,1,248,1,249,1,250,1,251,1,245,1,246,1,247,1,248,1,249,1,250,1,251,0,1,0,2,1,78,1,96,0,1,0,18,7,186,7,191,7,193,7,194,7,195,7,197,7,198,7,199,7,200,7,201,7,205,7,208,7,209,7,210,7,211,8,11,8,12,8,13,0,2,0,3,7,212,7,214,0,0,7,216,7,220,0,3,8,14,8,14,0,8,0,1,0,31,7,186,7,188,7,190,7,191,7,192,7,193,7,194,7,195,7,197,7,198,7,199,7,200,7,201,7,202,7,203,7,204,7,205,7,206,7,207,7,209,7,220,8,17,8,20,8,22,8,23,8,25,8,27,8,29,8,31,8,38,8,41,0,2,0,3,0,3,0,253,0,0,3,30,3,124,0,251,4,61,4,217,1,90,0,2,0,10,7,221,7,241,0,0,8,18,8,18,0,21,8,21,8,21,0,22,8,24,8,24,0,23,8,26,8,26,0,24,8,28,8,28,0,25,8,30,8,30,0,26,8,32,8,32,0,27,8,39,8,40,0,28,8,42,8,42,0,30,0,1,0,8,7,186,7,191,7,201,7,205,7,221,7,224,7,233,7,237,0,1,0,2,7,197,7,199,0,1,0,2,0,85,1,80,0,1,0,1,1,102,0,1,0,1,7,9,0,1,0,1,0,104,0,1,0,4,0,180,0,191,1,176,1,186,0,1,0,1,1,78,0,1,0,2,7,22,7,60,0,1,0,12,0,3,0,28,0,47,0,69,0,83,0,99,0,127,0,158,0,195,0,221,0,230,0,239,0,1,0,24,0,254,1,23,1,41,1,63,1,78,1,95,1,123,1,154,1,191,1,217,1,226,1,235,2,4,2,30,2,48,2,70,2,87,2,105,2,133,2,164,2,200,2,226,2,235,2,244,0,1,0,1,3,126,0,1,0,4,3,83,3,86,3,178,3,181,0,1,0,2,3,93,3,188,0,2,0,1,6,143,6,152,0,0,0,2,0,24,0,254,0,254,0,0,1,26,1,27,0,1,1,34,1,34,0,3,1,41,1,41,0,4,1,65,1,66,0,5,1,73,1,73,0,7,1,78,1,78,0,8,1,96,1,96,0,9,1,99,1,99,0,10,1,102,1,102,0,11,1,111,1,111,0,12,1,113,1,113,0,13,1,123,1,123,0,14,1,159,1,159,0,15,1,161,1,162,0,16,1,170,1,170,0,18,1,183,1,183,0,19,1,191,1,191,0,20,1,219,1,220,0,21,1,225,1,226,0,23,1,236,1,236,0,25,4,61,4,84,0,26,4,218,4,242,0,50,6,143,6,152,0,75,0,1,0,1,7,24,0,1,0,1,6,253,0,2,0,1,6,223,6,232,0,0,0,2,0,1,6,213,6,222,0,0,0,1,0,2,0,3,0,254,0,1,0,2,0,127,1,123,0,1,0,1,0,116,0,2,0,1,6,173,6,192,0,0,0,2,0,1,6,143,6,162,0,0,0,2,0,2,6,153,6,162,0,0,6,173,6,182,0,10,0,2,0,13,0,254,1,172,0,0,1,174,1,240,0,175,1,243,1,243,0,242,2,0,2,1,0,243,3,125,3,216,0,245,3,218,3,221,1,81,4,218,4,254,1,85,5,3,5,124,1,122,7,14,7,15,1,244,7,19,7,22,1,246,7,57,7,60,1,250,7,163,7,163,1,254,8,54,8,55,1,255,0,2,0,25,6,143,6,152,0,0,6,173,6,192,0,10,7,8,7,10,0,30,7,24,7,24,0,33,7,31,7,34,0,34,7,36,7,36,0,38,7,42,7,43,0,39,7,46,7,46,0,41,7,52,7,55,0,42,7,162,7,162,0,46,7,186,7,186,0,47,7,188,7,188,0,48,7,190,7,195,0,49,7,197,7,207,0,55,7,209,7,209,0,66,7,220,7,220,0,67,8,17,8,17,0,68,8,20,8,20,0,69,8,22,8,23,0,70,8,25,8,25,0,72,8,27,8,27,0,73,8,29,8,29,0,74,8,31,8,31,0,75,8,38,8,38,0,76,8,41,8,41,0,77,0,1,0,5,1,27,1,65,1,170,4,220,4,228,0,1,0,8,0,188,4,220,4,228,7,123,7,201,7,253,8,2,8,9,0,1,0,1,1,65,0,1,0,16,1,26,1,73,1,75,1,76,1,77,1,99,1,100,1,102,1,103,1,104,1,105,1,106,1,107,1,108,1,109,1,160,0,2,0,1,1,183,1,190,0,0,0,1,0,3,0,174,1,170,2,180,0,1,0,3,0,83,1,78,2,87,0,1,0,3,0,71,1,66,2,75,0,1,0,3,0,104,1,102,2,112,0,1,0,3,0,127,1,123,2,133,0,1,0,1,0,2,0,1,0,21,0,32,0,39,0,83,0,104,0,114,0,223,0,229,1,27,1,34,1,78,1,102,1,111,1,219,1,225,2,34,2,41,2,87,2,112,2,121,2,228,2,234,0,2,0,2,0,2,0,2,0,0,7,7,7,83,0,1,0,1,0,3,0,32,1,27,2,34,0,1,0,3,0,3,0,254,2,4,0,1,0,3,0,163,1,159,2,169,0,1,0,3,0,85,1,80,2,89,0,1,0,3,0,188,1,183,2,192,0,1,0,3,0,195,1,191,2,200,0,2,0,2,0,247,0,253,0,0,1,245,1,251,0,7,0,1,0,23,0,254,1,26,1,27,1,34,1,41,1,65,1,66,1,73,1,78,1,96,1,99,1,102,1,111,1,113,6,144,6,145,6,146,6,147,6,148,6,149,6,150,6,151,6,152,0,1,0,1,1,73,0,1,0,5,7,46,7,115,7,117,7,118,7,177,0,2,0,9,0,3,0,176,0,0,0,178,0,246,0,174,3,30,3,124,0,243,4,61,4,190,1,82,7,14,7,15,1,212,7,19,7,22,1,214,7,57,7,60,1,218,7,163,7,163,1,222,8,54,8,55,1,223,0,2,0,6,4,107,4,115,0,0,4,134,4,142,0,9,4,182,4,190,0,18,5,178,5,189,0,27,5,209,5,220,0,39,6,18,6,29,0,51,0,2,0,89,0,4,0,31,0,0,0,33,0,38,0,28,0,40,0,82,0,34,0,84,0,103,0,77,0,105,0,113,0,97,0,115,0,126,0,106,0,128,0,176,0,118,0,178,0,179,0,167,0,181,0,190,0,169,0,192,0,222,0,179,0,224,0,228,0,210,0,230,0,246,0,215,0,255,1,25,0,232,1,28,1,33,1,3,1,35,1,40,1,9,1,42,1,64,1,15,1,67,1,72,1,38,1,74,1,77,1,44,1,79,1,95,1,48,1,97,1,98,1,65,1,100,1,101,1,67,1,103,1,110,1,69,1,112,1,112,1,77,1,114,1,122,1,78,1,124,1,158,1,87,1,160,1,160,1,122,1,163,1,169,1,123,1,171,1,172,1,130,1,174,1,175,1,132,1,177,1,182,1,134,1,184,1,185,1,140,1,187,1,190,1,142,1,192,1,218,1,146,1,221,1,224,1,173,1,227,1,235,1,177,1,237,1,240,1,186,1,243,1,243,1,190,2,0,2,1,1,191,2,34,2,34,1,193,2,41,2,41,1,194,2,87,2,87,1,195,2,112,2,112,1,196,2,121,2,121,1,197,2,228,2,228,1,198,2,234,2,234,1,199,3,30,3,82,1,200,3,84,3,85,1,253,3,87,3,92,1,255,3,94,3,125,2,5,3,127,3,177,2,37,3,179,3,180,2,88,3,182,3,187,2,90,3,189,3,216,2,96,3,218,3,221,2,124,4,85,4,106,2,128,4,116,4,133,2,150,4,143,4,181,2,168,4,243,4,254,2,207,5,3,5,124,2,219,5,178,5,189,3,85,5,209,5,220,3,97,6,18,6,29,3,109,6,223,6,232,3,121,7,8,7,10,3,131,7,14,7,15,3,134,7,19,7,21,3,136,7,31,7,34,3,139,7,36,7,36,3,143,7,42,7,43,3,144,7,46,7,46,3,146,7,52,7,55,3,147,7,57,7,59,3,151,7,162,7,163,3,154,7,186,7,186,3,156,7,188,7,188,3,157,7,190,7,195,3,158,7,197,7,207,3,164,7,209,7,209,3,175,7,220,7,220,3,176,8,17,8,17,3,177,8,20,8,20,3,178,8,22,8,23,3,179,8,25,8,25,3,181,8,27,8,27,3,182,8,29,8,29,3,183,8,31,8,31,3,184,8,38,8,38,3,185,8,41,8,41,3,186,8,54,8,55,3,187,0,2,0,51,0,3,0,3,0,0,0,32,0,32,0,1,0,39,0,39,0,2,0,83,0,83,0,3,0,104,0,104,0,4,0,114,0,114,0,5,0,127,0,127,0,6,0,180,0,180,0,7,0,191,0,191,0,8,0,223,0,223,0,9,0,229,0,229,0,10,0,254,0,254,0,11,1,26,1,27,0,12,1,34,1,34,0,14,1,41,1,41,0,15,1,65,1,66,0,16,1,73,1,73,0,18,1,78,1,78,0,19,1,96,1,96,0,20,1,99,1,99,0,21,1,102,1,102,0,22,1,111,1,111,0,23,1,113,1,113,0,24,1,123,1,123,0,25,1,159,1,159,0,26,1,161,1,162,0,27,1,170,1,170,0,29,1,176,1,176,0,30,1,183,1,183,0,31,1,186,1,186,0,32,1,191,1,191,0,33,1,219,1,220,0,34,1,225,1,226,0,36,1,236,1,236,0,38,3,83,3,83,0,39,3,86,3,86,0,40,3,93,3,93,0,41,3,126,3,126,0,42,3,178,3,178,0,43,3,181,3,181,0,44,3,188,3,188,0,45,4,61,4,84,0,46,4,107,4,115,0,70,4,134,4,142,0,79,4,182,4,190,0,88,4,218,4,242,0,97,6,143,6,162,0,122,6,173,6,192,0,142,7,22,7,22,0,162,7,24,7,24,0,163,7,60,7,60,0,164,0,1,0,33,1,78,1,96,7,186,7,188,7,190,7,191,7,192,7,193,7,194,7,195,7,197,7,198,7,199,7,200,7,201,7,202,7,203,7,204,7,205,7,206,7,207,7,209,7,220,8,17,8,20,8,22,8,23,8,25,8,27,8,29,8,31,8,38,8,41,0,1,0,2,0,104,1,102,0,1,0,17,0,3,0,127,0,254,1,65,1,123,6,223,6,224,6,225,6,226,6,227,6,228,6,229,6,230,6,231,6,232,7,22,7,60,0,1,0,22,0,32,0,39,0,83,0,104,0,114,0,223,0,229,1,27,1,34,1,65,1,78,1,102,1,111,1,219,1,225,2,34,2,41,2,87,2,112,2,121,2,228,2,234,0,4,2,38,1,144,0,5,0,0,2,138,2,88,0,0,0,75,2,138,2,88,0,0,1,94,0,55,1,15,0,0,0,0,5,0,0,0,0,0,0,0,96,0,2,143,0,0,0,3,0,0,0,0,0,0,0,0,72,84,32,32,0,192,0,0,251,2,3,248,254,167,0,0,4,99,1,89,32,0,1,159,0,0,0,0,1,196,2,124,0,0,0,32,0,8,0,0,0,3,0,0,0,3,0,0,2,20,0,1,0,0,0,0,0,28,0,3,0,1,0,0,2,20,0,6,1,248,0,0,0,9,0,247,0,2,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,7,14,7,21,7,16,7,88,7,135,7,163,7,22,7,35,7,36,7,7,7,111,7,12,7,46,7,18,7,24,6,143,6,144,6,145,6,146,6,147,6,148,6,149,6,150,6,151,6,152,7,11,7,23,7,118,7,115,7,117,7,19,7,162,0,3,0,31,0,32,0,39,0,47,0,70,0,71,0,78,0,83,0,100,0,102,0,104,0,114,0,116,0,127,0,163,0,165,0,166,0,174,0,188,0,195,0,223,0,224,0,229,0,230,0,240,7,33,7,8,7,34,7,177,7,26,8,4,0,254,1,26,1,27,1,34,1,41,1,65,1,66,1,73,1,78,1,96,1,99,1,102,1,111,1,113,1,123,1,159,1,161,1,162,1,170,1,183,1,191,1,219,1,220,1,225,1,226,1,236,7,31,7,170,7,32,7,123,0,0,0,19,0,26,0,35,0,48,0,126,0,138,0,201,0,255,1,16,1,7,1,14,1,23,1,21,1,30,1,42,1,56,1,46,1,53,1,80,1,89,1,83,1,85,1,122,1,124,1,138,1,127,1,134,1,154,1,192,1,203,1,195,1,197,7,172,7,169,7,85,7,104,7,165,7,10,7,164,1,182,7,167,7,166,7,168,7,253,8,2,7,116,0,29,0,156,7,125,7,121,7,120,7,119,7,108,7,134,7,133,7,131,7,130,4,233,7,127,2,250,2,251,4,84,1,24,1,152,7,20,7,15,7,124,7,132,7,91,7,122,7,129,7,52,7,53,7,13,7,81,0,21,0,28,0,158,0,162,1,158,7,43,7,42,7,57,7,58,7,59,7,60,7,114,7,149,1,229,0,233,6,253,7,90,7,54,7,55,2,0,2,1,7,174,7,9,7,61,7,56,7,136,0,12,0,52,0,4,0,59,0,62,0,85,0,88,0,90,0,94,0,128,0,131,0,0,0,142,0,196,0,199,0,207,1,79,8,1,8,9,8,6,7,254,8,3,8,8,8,0,8,5,8,7,7,255,0,4,13,126,0,0,1,108,1,0,0,7,0,108,0,0,0,13,0,47,0,126,1,72,1,126,1,143,1,146,1,161,1,176,1,220,1,231,1,235,2,27,2,45,2,51,2,55,2,89,2,176,2,178,2,185,2,188,2,191,2,204,2,221,2,227,3,4,3,12,3,15,3,18,3,27,3,36,3,40,3,46,3,49,3,53,3,69,3,117,3,122,3,126,3,138,3,140,3,144,3,161,3,176,3,207,3,209,3,215,3,240,4,15,4,21,4,26,4,47,4,53,4,58,4,95,4,99,4,107,4,117,4,157,4,165,4,171,4,179,4,187,4,194,4,204,4,217,4,223,4,233,4,249,5,29,5,37,30,9,30,15,30,23,30,29,30,33,30,37,30,43,30,47,30,55,30,59,30,73,30,83,30,91,30,105,30,111,30,123,30,133,30,143,30,147,30,151,30,158,30,249,31,7,31,15,31,21,31,29,31,39,31,47,31,55,31,63,31,69,31,77,31,87,31,89,31,91,31,93,31,95,31,103,31,125,31,135,31,143,31,151,31,159,31,167,31,180,31,196,31,207,31,211,31,219,31,223,31,239,31,244,31,254,32,11,32,16,32,21,32,26,32,30,32,34,32,38,32,48,32,51,32,58,32,68,32,112,32,121,32,127,32,137,32,161,32,164,32,167,32,169,32,174,32,178,32,181,32,186,32,189,33,19,33,22,33,34,33,38,33,46,33,84,33,94,33,153,34,2,34,6,34,15,34,18,34,21,34,26,34,30,34,43,34,72,34,96,34,101,37,161,37,179,37,183,37,189,37,193,37,199,37,202,37,252,38,171,43,27,43,36,167,140,251,2,255,255,0,0,0,0,0,13,0,32,0,48,0,160,1,74,1,143,1,146,1,160,1,175,1,196,1,230,1,234,1,250,2,42,2,48,2,55,2,89,2,176,2,178,2,183,2,187,2,190,2,198,2,216,2,225,3,0,3,6,3,15,3,17,3,27,3,35,3,38,3,46,3,49,3,53,3,66,3,116,3,122,3,126,3,132,3,140,3,142,3,145,3,163,3,177,3,209,3,213,3,240,4,0,4,16,4,22,4,27,4,48,4,54,4,59,4,98,4,106,4,114,4,144,4,160,4,170,4,174,4,182,4,192,4,203,4,207,4,220,4,226,4,238,5,26,5,36,30,8,30,12,30,20,30,28,30,32,30,36,30,42,30,46,30,54,30,58,30,66,30,76,30,90,30,94,30,108,30,120,30,128,30,142,30,146,30,151,30,158,30,160,31,0,31,8,31,16,31,24,31,32,31,40,31,48,31,56,31,64,31,72,31,80,31,89,31,91,31,93,31,95,31,96,31,104,31,128,31,136,31,144,31,152,31,160,31,168,31,182,31,198,31,208,31,214,31,221,31,224,31,242,31,246,32,7,32,16,32,18,32,24,32,28,32,32,32,36,32,48,32,50,32,57,32,68,32,112,32,116,32,127,32,128,32,161,32,163,32,166,32,169,32,171,32,177,32,180,32,184,32,188,33,19,33,22,33,34,33,38,33,46,33,83,33,91,33,144,34,2,34,5,34,15,34,17,34,21,34,25,34,30,34,43,34,72,34,96,34,100,37,160,37,178,37,182,37,188,37,192,37,198,37,202,37,252,38,171,43,27,43,36,167,139,251,1,255,255,8,59,255,244,0,0,0,0,0,0,0,0,255,44,5,201,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,42,254,231,0,76,0,75,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,194,4,193,4,185,4,178,4,177,4,172,4,170,4,167,4,201,4,68,2,227,3,207,0,0,0,205,0,0,0,172,0,0,0,0,1,46,0,0,1,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,227,37,226,28,0,0,230,3,229,87,230,12,229,92,230,4,229,84,230,11,229,87,230,11,229,83,230,5,229,75,229,74,229,73,229,72,230,5,0,0,229,147,228,228,229,162,228,239,229,211,0,0,0,0,0,0,229,118,0,0,0,0,0,0,0,0,0,0,0,0,231,31,0,0,231,35,0,0,0,0,0,0,231,88,231,130,230,253,230,185,230,121,230,121,226,128,230,68,230,181,0,0,230,189,230,194,0,0,0,0,0,0,0,0,0,0,230,154,230,154,230,134,230,90,230,129,229,172,229,168,0,0,229,131,0,0,229,115,0,0,229,89,0,0,229,95,229,84,229,50,229,20,0,0,225,246,0,0,0,0,0,0,0,0,225,205,225,203,225,156,224,246,220,152,220,142,0,0,0,0,0,1,0,0,0,0,1,104,1,134,2,34,3,114,0,0,0,0,3,214,3,216,3,218,4,10,4,12,4,14,4,80,4,86,0,0,0,0,0,0,0,0,4,84,4,88,4,90,4,92,4,104,4,114,4,118,4,126,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,114,0,0,4,124,0,0,4,126,4,152,0,0,4,210,0,0,4,212,4,242,4,252,5,4,5,44,5,54,5,62,5,134,5,136,5,138,5,144,5,170,5,180,5,182,5,192,5,202,5,206,5,208,5,228,5,234,5,248,6,14,6,20,6,22,6,24,6,30,6,36,6,38,6,40,6,42,6,44,6,46,6,48,6,50,6,64,6,78,6,80,6,102,6,108,6,114,6,124,6,126,0,0,0,0,6,124,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,7,14,0,0,0,0,0,0,0,0,0,0,7,46,7,70,7,98,0,0,7,114,7,124,7,128,7,158,7,162,7,178,0,0,7,184,0,0,7,188,7,192,7,196,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,7,182,0,0,0,0,7,180,7,186,7,188,7,190,7,194,0,0,0,0,0,0,0,0,0,0,0,0,0,0,7,182,0,0,7,198,0,0,7,198,0,0,7,198,0,0,0,0,0,0,0,0,7,192,0,0,7,192,7,194,7,196,7,198,0,0,0,0,0,0,0,0,0,0,0,0,7,188,7,190,0,0,0,2,7,14,7,21,7,16,7,88,7,135,7,163,7,22,7,35,7,36,7,7,7,111,7,12,7,46,7,18,7,24,6,143,6,144,6,145,6,146,6,147,6,148,6,149,6,150,6,151,6,152,7,11,7,23,7,118,7,115,7,117,7,19,7,162,0,3,0,31,0,32,0,39,0,47,0,70,0,71,0,78,0,83,0,100,0,102,0,104,0,114,0,116,0,127,0,163,0,165,0,166,0,174,0,188,0,195,0,223,0,224,0,229,0,230,0,240,7,33,7,8,7,34,7,177,7,26,8,4,0,254,1,26,1,27,1,34,1,41,1,65,1,66,1,73,1,78,1,96,1,99,1,102,1,111,1,113,1,123,1,159,1,161,1,162,1,170,1,183,1,191,1,219,1,220,1,225,1,226,1,236,7,31,7,170,7,32,7,123,7,81,7,15,7,85,7,104,7,87,7,108,7,171,7,165,8,2,7,166,2,250,7,52,7,124,7,48,7,167,8,6,7,169,7,121,6,235,6,236,7,253,7,134,7,164,7,9,8,0,6,234,2,251,7,53,7,1,6,254,7,2,7,20,0,21,0,4,0,12,0,28,0,19,0,26,0,29,0,35,0,62,0,48,0,52,0,59,0,94,0,85,0,88,0,90,0,41,0,126,0,142,0,128,0,131,0,158,0,138,7,113,0,156,0,207,0,196,0,199,0,201,0,231,0,164,1,182,1,16,0,255,1,7,1,23,1,14,1,21,1,24,1,30,1,56,1,42,1,46,1,53,1,89,1,80,1,83,1,85,1,35,1,122,1,138,1,124,1,127,1,154,1,134,7,114,1,152,1,203,1,192,1,195,1,197,1,227,1,160,1,229,0,24,1,19,0,5,1,0,0,25,1,20,0,33,1,28,0,37,1,32,0,38,1,33,0,34,1,29,0,42,1,36,0,43,1,37,0,65,1,59,0,49,1,43,0,60,1,54,0,68,1,62,0,50,1,44,0,74,1,69,0,72,1,67,0,76,1,71,0,75,1,70,0,81,1,76,0,79,1,74,0,99,1,95,0,97,1,93,0,86,1,81,0,98,1,94,0,92,1,79,0,84,1,92,0,101,1,98,0,103,1,100,1,101,0,106,1,103,0,108,1,105,0,107,1,104,0,109,1,106,0,113,1,110,0,118,1,114,0,120,1,116,0,119,1,115,0,123,1,119,0,152,1,148,0,129,1,125,0,150,1,146,0,162,1,158,0,167,1,163,0,169,1,165,0,168,1,164,0,175,1,171,0,181,1,177,0,180,1,176,0,178,1,174,0,191,1,186,0,190,1,185,0,189,1,184,0,221,1,217,0,217,1,213,0,197,1,193,0,220,1,216,0,215,1,211,0,219,1,215,0,226,1,222,0,232,1,228,0,233,0,241,1,237,0,243,1,239,0,242,1,238,0,144,1,140,0,209,1,205,0,40,0,46,1,40,0,105,0,111,1,108,0,117,0,124,1,120,0,11,1,6,0,87,1,82,0,130,1,126,0,198,1,194,0,205,1,201,0,202,1,198,0,203,1,199,0,204,1,200,0,73,1,68,0,155,1,151,0,27,1,22,0,30,1,25,0,157,1,153,0,18,1,13,0,23,1,18,0,58,1,52,0,64,1,58,0,89,1,84,0,96,1,91,0,137,1,133,0,151,1,147,0,170,1,166,0,172,1,168,0,200,1,196,0,216,1,212,0,182,1,178,0,192,1,187,0,139,1,135,0,161,1,157,0,140,1,136,0,238,1,234,3,1,3,3,7,247,7,244,7,243,7,249,7,248,8,1,7,255,7,252,7,245,7,250,7,246,7,251,7,254,8,3,8,8,8,7,8,9,8,5,2,254,3,0,3,2,7,193,7,194,7,197,7,201,7,205,7,199,7,191,7,186,7,208,7,200,7,195,7,198,8,15,8,16,4,85,7,76,4,86,4,87,4,88,4,90,4,91,4,245,4,78,4,79,4,80,4,81,4,82,4,83,4,84,4,92,4,93,4,251,4,252,4,253,4,243,4,248,4,218,4,219,4,220,4,221,4,222,4,223,4,224,4,225,4,226,4,227,4,228,4,229,4,230,4,231,4,232,4,233,4,234,4,235,4,236,4,237,4,238,4,239,4,240,4,241,4,242,4,244,4,247,4,249,4,246,4,250,4,94,5,0,5,1,4,254,3,38,3,39,3,78,3,34,3,70,3,69,3,72,3,73,3,74,3,67,3,68,3,75,3,46,3,44,3,56,3,63,3,30,3,31,3,32,3,33,3,36,3,37,3,40,3,41,3,42,3,43,3,45,3,47,3,48,3,49,3,50,3,51,3,52,3,53,3,54,3,55,3,57,3,58,3,60,3,59,3,61,3,62,3,65,3,66,3,64,3,71,3,76,3,77,3,125,3,126,3,127,3,128,3,131,3,132,3,135,3,136,3,137,3,138,3,140,3,142,3,143,3,144,3,145,3,146,3,147,3,148,3,149,3,150,3,152,3,153,3,155,3,154,3,156,3,157,3,160,3,161,3,159,3,166,3,171,3,172,3,133,3,134,3,173,3,129,3,165,3,164,3,167,3,168,3,169,3,162,3,163,3,170,3,141,3,139,3,151,3,158,3,79,3,174,3,80,3,175,3,81,3,176,3,82,3,177,3,35,3,130,3,83,3,178,3,84,3,179,3,85,3,180,3,86,3,181,3,87,3,182,3,88,3,183,3,89,3,184,3,90,3,185,3,91,3,186,3,93,3,188,3,94,3,189,3,95,3,190,3,96,3,191,3,97,3,192,3,98,3,193,3,99,3,194,3,100,3,101,3,196,3,102,3,197,3,195,3,103,3,198,3,104,3,199,3,105,3,200,3,106,3,201,3,107,3,202,3,108,3,203,3,109,3,204,3,110,3,205,3,111,3,206,3,112,3,207,3,113,3,208,3,114,3,209,3,115,3,210,3,116,3,211,3,117,3,212,3,118,3,213,3,119,3,214,3,120,3,215,3,121,3,216,3,92,3,187,0,36,1,31,0,44,1,38,0,45,1,39,0,67,1,61,0,66,1,60,0,51,1,45,0,77,1,72,0,82,1,77,0,80,1,75,0,91,1,86,0,110,1,107,0,112,1,109,0,115,1,112,0,121,1,117,0,122,1,118,0,125,1,121,0,159,1,155,0,160,1,156,0,154,1,150,0,153,1,149,0,171,1,167,0,173,1,169,0,183,1,179,0,184,1,180,0,176,1,172,0,179,1,175,0,185,1,181,0,193,1,189,0,194,1,190,0,222,1,218,0,218,1,214,0,228,1,224,0,225,1,221,0,227,1,223,0,234,1,230,0,244,1,240,0,20,1,15,0,22,1,17,0,13,1,8,0,15,1,10,0,16,1,11,0,17,1,12,0,14,1,9,0,6,1,1,0,8,1,3,0,9,1,4,0,10,1,5,0,7,1,2,0,61,1,55,0,63,1,57,0,69,1,63,0,53,1,47,0,55,1,49,0,56,1,50,0,57,1,51,0,54,1,48,0,95,1,90,0,93,1,88,0,141,1,137,0,143,1,139,0,132,1,128,0,134,1,130,0,135,1,131,0,136,1,132,0,133,1,129,0,145,1,141,0,147,1,143,0,148,1,144,0,149,1,145,0,146,1,142,0,206,1,202,0,208,1,204,0,210,1,206,0,212,1,208,0,213,1,209,0,214,1,210,0,211,1,207,0,236,1,232,0,235,1,231,0,237,1,233,0,239,1,235,4,172,4,173,4,174,4,175,4,176,4,177,4,178,4,179,5,11,5,12,5,34,5,35,5,44,5,45,5,67,5,68,5,81,5,82,5,93,5,94,5,109,5,110,4,183,4,184,4,185,4,186,4,187,4,188,4,189,4,190,5,14,5,15,5,17,5,16,5,18,5,13,5,27,4,105,4,106,4,103,4,104,4,107,8,19,5,124,8,17,8,38,8,35,5,48,5,47,5,49,5,46,5,58,4,122,4,123,4,132,4,133,4,134,8,22,8,25,8,29,5,69,5,74,4,153,4,154,4,151,4,152,8,23,8,27,8,31,5,96,5,97,5,98,5,99,5,83,5,84,5,95,5,100,4,170,4,171,4,168,4,169,4,163,8,33,8,34,8,36,5,113,5,112,5,114,5,111,5,123,4,161,4,162,4,180,4,181,4,182,8,37,8,20,7,78,7,80,7,82,7,79,7,83,7,44,7,43,7,42,7,45,7,57,7,58,7,56,7,172,7,174,7,10,7,17,7,25,7,13,7,92,7,96,7,89,7,90,7,95,7,106,7,101,7,93,7,94,7,84,7,105,7,103,7,97,7,98,7,102,7,143,7,137,7,139,7,141,7,145,7,146,7,144,7,138,7,140,7,142,7,126,7,129,7,131,7,112,7,109,7,132,7,120,7,119,7,153,7,157,7,154,7,158,7,155,7,159,7,156,7,160,0,177,1,173,2,0,2,1,0,0,0,1,255,239,255,147,2,145,2,53,0,11,0,6,179,8,2,1,48,43,37,1,7,1,1,39,1,1,55,1,1,23,1,80,1,65,16,254,191,254,191,16,1,65,254,191,16,1,65,1,65,16,228,254,191,16,1,65,254,191,16,1,65,1,65,16,254,191,1,65,16,0,0,2,255,241,255,246,2,82,2,137,0,48,0,54,0,48,64,45,52,51,32,3,4,72,48,1,2,71,5,1,4,0,0,1,4,0,101,0,1,1,2,95,3,1,2,2,99,2,76,50,49,49,54,50,54,46,42,67,38,55,6,12,23,43,5,55,54,54,53,52,39,39,38,35,34,7,7,6,21,20,22,51,51,23,7,38,38,35,34,6,7,55,54,54,55,19,55,51,30,2,23,22,22,23,23,7,34,38,35,34,6,7,3,50,55,3,35,3,1,73,4,51,38,9,33,24,80,48,61,37,9,28,32,57,2,6,12,86,41,37,63,10,8,28,34,16,195,63,8,6,49,71,33,12,40,44,2,7,12,63,31,48,89,12,59,36,57,79,7,95,3,39,4,16,18,20,28,109,1,8,104,27,12,22,19,4,43,1,6,2,1,47,3,33,41,1,255,17,24,174,238,100,37,30,4,4,41,3,8,2,1,27,5,1,6,254,245,0,0,0,255,255,255,241,255,246,2,82,3,73,0,34,0,3,0,0,0,3,7,227,1,251,0,0,255,255,255,241,255,246,2,82,3,50,0,34,0,3,0,0,0,3,7,231,1,240,0,0,255,255,255,241,255,246,2,82,3,158,0,34,0,3,0,0,1,7,8,43,1,245,0,130,0,8,177,2,2,176,130,176,51,43,0,0,255,255,255,241,255,64,2,82,3,40,0,34,0,3,0,0,0,35,7,213,1,232,0,0,1,7,7,231,1,235,255,246,0,9,177,3,1,184,255,246,176,51,43,0,255,255,255,241,255,246,2,82,3,158,0,34,0,3,0,0,1,7,8,44,1,245,0,130,0,8,177,2,2,176,130,176,51,43,0,0,255,255,255,241,255,246,2,82,3,182,0,34,0,3,0,0,1,7,8,45,1,245,0,130,0,8,177,2,2,176,130,176,51,43,0,0,255,255,255,241,255,246,2,82,3,145,0,34,0,3,0,0,1,7,8,46,1,245,0,130,0,8,177,2,2,176,130,176,51,43,0,0,255,255,255,241,255,246,2,82,3,70,0,34,0,3,0,0,0,3,7,230,1,241,0,0,255,255,255,241,255,246,2,82,3,78,0,34,0,3,0,0,0,3,7,229,1,241,0,0,255,255,255,241,255,246,2,82,3,138,0,34,0,3,0,0,1,7,8,47,1,245,0,130,0,8,177,2,2,176,130,176,51,43,0,0,255,255,255,241,255,64,2,82,3,78,0,34,0,3,0,0,0,35,7,229,1,241,0,0,0,3,7,213,1,222,0,0,255,255,255,241,255,246,2,82,3,131,0,34,0,3,0,0,1,7,8,48,1,245,0,130,0,8,177,2,2,176,130,176,51,43,0,0,255,255,255,241,255,246,2,82,3,151,0,34,0,3,0,0,1,7,8,49,1,245,0,130,0,8,177,2,2,176,130,176,51,43,0,0,255,255,255,241,255,246,2,82,3,141,0,34,0,3,0,0,1,7,8,50,1,245,0,130,0,8,177,2,2,176,130,176,51,43,0,0,255,255,255,241,255,246,2,82,3,59,0,34,0,3,0,0,1,7,7,240,1,152,255,246,0,9,177,2,2,184,255,246,176,51,43,0,255,255,255,241,255,246,2,82,3,40,0,34,0,3,0,0,0,3,7,221,1,241,0,0,255,255,255,241,255,64,2,82,2,137,0,34,0,3,0,0,0,3,7,213,1,222,0,0,255,255,255,241,255,246,2,82,3,73,0,34,0,3,0,0,0,3,7,226,1,238,0,0,255,255,255,241,255,246,2,82,3,113,0,34,0,3,0,0,1,7,7,208,1,245,0,130,0,8,177,2,1,176,130,176,51,43,0,0,255,255,255,241,255,246,2,82,3,79,0,34,0,3,0,0,1,7,7,210,1,214,0,185,0,8,177,2,1,176,185,176,51,43,0,0,255,255,255,241,255,246,2,82,3,10,0,34,0,3,0,0,0,3,7,237,1,240,0,0,255,255,255,241,255,15,2,82,2,137,0,34,0,3,0,0,0,3,7,217,2,177,0,0,255,255,255,241,255,246,2,82,3,70,0,34,0,3,0,0,0,3,7,232,1,241,0,0,255,255,255,241,255,246,2,82,3,174,0,34,0,3,0,0,0,47,7,232,1,238,0,61,57,170,1,15,7,227,1,214,0,185,57,153,0,16,177,2,2,176,61,176,51,43,177,4,1,176,185,176,51,43,0,0,255,255,255,241,255,246,2,82,3,52,0,34,0,3,0,0,0,3,7,233,1,242,0,0,0,2,255,246,255,246,3,16,2,137,0,88,0,93,0,157,64,36,34,1,2,3,58,1,8,2,62,59,47,3,9,8,74,65,7,3,0,5,88,1,1,0,5,74,41,1,3,72,87,86,22,3,1,71,75,176,23,80,88,64,45,0,8,2,9,2,8,112,0,9,5,2,9,5,124,0,5,0,2,5,0,124,4,1,2,2,3,93,0,3,3,98,75,6,1,0,0,1,95,7,1,1,1,99,1,76,27,64,46,0,8,2,9,2,8,9,126,0,9,5,2,9,5,124,0,5,0,2,5,0,124,4,1,2,2,3,93,0,3,3,98,75,6,1,0,0,1,95,7,1,1,1,99,1,76,89,64,14,93,92,22,89,36,24,45,84,41,50,45,10,12,29,43,36,54,54,53,52,38,39,39,15,2,6,21,20,51,51,7,38,38,35,34,6,7,39,62,2,55,19,38,35,34,6,35,39,55,51,22,51,50,54,55,23,14,2,7,7,52,54,53,52,38,38,35,34,6,6,7,23,55,55,23,15,2,23,22,22,51,50,54,54,55,55,23,6,6,7,7,39,38,35,35,34,6,7,39,55,19,39,35,7,55,1,86,40,16,6,1,18,99,91,71,16,55,57,5,13,85,40,20,40,8,7,3,19,28,13,247,4,21,10,20,4,2,7,23,81,55,120,133,45,3,1,9,10,3,48,2,19,62,76,33,27,9,1,31,118,92,4,13,86,109,28,6,37,41,77,66,27,8,44,3,3,18,6,5,50,114,105,34,48,88,12,2,2,66,30,9,118,84,39,10,19,19,18,41,7,123,8,10,138,31,15,34,47,1,6,3,1,35,3,23,40,24,1,201,16,2,4,44,3,5,7,6,6,45,74,41,4,5,25,13,35,27,9,4,12,15,228,11,13,5,53,3,9,169,38,30,16,48,58,5,5,14,101,53,6,1,6,8,2,7,39,1,29,218,229,5,0,0,0,255,255,255,246,255,246,3,16,3,73,0,34,0,29,0,0,0,3,7,227,2,122,0,0,0,3,0,58,255,244,2,30,2,129,0,38,0,53,0,64,0,135,64,18,14,1,0,1,51,1,5,0,27,1,9,5,3,74,2,1,3,71,75,176,10,80,88,64,35,11,7,2,5,0,9,8,5,9,101,6,1,0,0,1,95,2,1,1,1,98,75,0,8,8,3,95,10,4,2,3,3,105,3,76,27,64,39,11,7,2,5,0,9,8,5,9,101,6,1,0,0,1,95,2,1,1,1,98,75,10,1,4,4,99,75,0,8,8,3,95,0,3,3,105,3,76,89,64,27,39,39,0,0,64,63,58,56,39,53,39,53,49,47,41,40,0,38,0,37,43,17,69,41,12,12,24,43,50,6,7,55,54,54,53,19,52,38,35,34,6,35,39,55,22,22,51,50,54,55,50,22,21,20,6,7,22,22,21,20,6,6,35,34,39,38,35,18,22,23,20,54,54,53,52,38,35,34,6,7,6,7,7,20,22,51,50,54,53,52,38,39,7,141,72,11,6,46,32,1,15,22,10,20,4,2,7,12,66,33,34,71,13,95,102,61,55,73,82,65,108,62,27,35,57,16,62,71,23,52,42,86,90,10,7,1,6,3,6,52,62,60,69,68,67,104,10,2,46,9,35,42,1,164,32,22,2,4,44,1,2,3,1,79,73,50,80,24,16,80,56,51,89,53,5,5,1,94,6,1,3,27,57,48,64,62,9,14,96,128,240,38,32,67,57,54,69,12,2,0,1,0,40,255,244,2,65,2,137,0,42,0,48,64,45,12,1,1,0,34,17,2,2,1,2,74,0,1,1,0,95,0,0,0,98,75,0,2,2,3,95,4,1,3,3,105,3,76,0,0,0,42,0,41,38,45,38,5,12,23,43,22,38,38,53,52,54,54,51,50,22,22,23,23,14,2,7,7,54,54,53,52,35,34,6,6,21,20,22,22,51,50,54,55,55,6,6,7,7,20,6,6,35,249,136,73,90,159,100,37,77,53,7,4,2,9,11,3,48,1,2,147,66,100,54,57,104,68,68,83,19,48,3,20,4,6,61,91,53,12,76,139,94,100,161,91,11,11,2,6,6,46,74,41,4,5,27,17,93,64,117,79,87,132,73,77,81,4,15,103,45,9,1,21,18,255,255,0,40,255,244,2,65,3,73,0,34,0,32,0,0,0,3,7,227,2,56,0,0,255,255,0,40,255,244,2,65,3,70,0,34,0,32,0,0,0,3,7,230,2,46,0,0,255,255,0,40,255,23,2,65,2,137,0,34,0,32,0,0,0,3,7,216,2,33,0,0,255,255,0,40,255,23,2,65,3,83,0,34,0,32,0,0,0,35,7,216,2,16,0,0,1,7,7,227,2,4,0,10,0,8,177,2,1,176,10,176,51,43,0,0,255,255,0,40,255,244,2,65,3,109,0,34,0,32,0,0,1,7,7,197,2,28,0,174,0,8,177,1,1,176,174,176,51,43,0,0,255,255,0,40,255,244,2,65,3,51,0,34,0,32,0,0,0,3,7,224,2,46,0,0,0,2,0,58,255,244,2,151,2,129,0,32,0,47,0,59,64,56,17,1,1,2,35,1,4,1,2,74,5,1,3,71,6,5,2,1,1,2,93,0,2,2,98,75,0,0,0,99,75,0,4,4,3,95,0,3,3,105,3,76,33,33,33,47,33,46,40,22,101,41,33,7,12,25,43,4,38,35,34,6,7,55,54,54,53,19,52,38,35,34,6,35,39,55,22,22,51,50,54,55,50,22,22,21,20,6,6,35,2,6,7,2,21,20,22,22,51,50,54,53,52,38,35,1,46,97,32,31,73,11,6,46,32,1,15,22,10,20,4,2,7,11,62,32,43,92,17,96,150,83,92,158,96,73,14,1,15,21,53,52,108,124,159,148,10,10,10,2,46,9,35,42,1,164,32,22,2,4,44,1,2,3,1,75,136,88,98,162,94,2,92,9,13,254,127,54,38,38,16,149,130,132,142,0,255,255,0,58,255,244,4,203,3,70,0,34,0,39,0,0,0,35,0,240,2,191,0,0,0,3,7,230,4,170,0,0,0,2,0,9,255,244,2,158,2,129,0,38,0,57,0,78,64,75,23,1,3,4,56,1,2,3,40,13,2,1,2,3,74,5,1,5,71,10,9,2,2,6,1,1,7,2,1,101,8,1,3,3,4,93,0,4,4,98,75,0,0,0,99,75,0,7,7,5,95,0,5,5,105,5,76,39,39,39,57,39,57,36,36,19,22,101,35,18,24,33,11,12,29,43,4,38,35,34,6,7,55,62,2,53,53,35,39,55,51,55,52,38,35,34,6,35,39,55,22,22,51,50,54,55,50,22,22,21,20,6,6,35,19,23,7,35,7,20,22,22,51,50,54,53,52,38,35,34,6,7,7,1,53,97,32,31,73,11,6,37,31,10,133,7,7,133,1,15,22,10,20,4,2,7,11,62,32,43,92,17,95,150,84,92,158,96,73,5,6,170,5,22,53,51,108,124,159,148,21,14,1,9,10,10,10,2,46,7,20,45,51,147,7,32,197,32,22,2,4,44,1,2,3,1,77,136,86,98,162,94,1,99,7,32,173,37,39,16,149,130,132,142,9,13,227,0,0,0,255,255,0,58,255,244,2,151,3,70,0,34,0,39,0,0,0,3,7,230,2,18,0,0,0,2,0,9,255,244,2,158,2,129,0,38,0,57,0,78,64,75,23,1,3,4,56,1,2,3,40,13,2,1,2,3,74,5,1,5,71,10,9,2,2,6,1,1,7,2,1,101,8,1,3,3,4,93,0,4,4,98,75,0,0,0,99,75,0,7,7,5,95,0,5,5,105,5,76,39,39,39,57,39,57,36,36,19,22,101,35,18,24,33,11,12,29,43,4,38,35,34,6,7,55,62,2,53,53,35,39,55,51,55,52,38,35,34,6,35,39,55,22,22,51,50,54,55,50,22,22,21,20,6,6,35,19,23,7,35,7,20,22,22,51,50,54,53,52,38,35,34,6,7,7,1,53,97,32,31,73,11,6,37,31,10,133,7,7,133,1,15,22,10,20,4,2,7,11,62,32,43,92,17,95,150,84,92,158,96,73,5,6,170,5,22,53,51,108,124,159,148,21,14,1,9,10,10,10,2,46,7,20,45,51,147,7,32,197,32,22,2,4,44,1,2,3,1,77,136,86,98,162,94,1,99,7,32,173,37,39,16,149,130,132,142,9,13,227,0,0,0,255,255,0,58,255,64,2,151,2,129,0,34,0,39,0,0,0,3,7,213,2,22,0,0,255,255,0,58,255,93,2,151,2,129,0,34,0,39,0,0,0,3,7,219,2,24,0,0,255,255,0,58,255,244,4,95,2,198,0,34,0,39,0,0,0,35,1,236,2,191,0,0,0,3,7,198,4,114,0,0,0,1,0,58,255,246,2,20,2,137,0,56,0,66,64,63,41,40,27,26,4,4,1,56,46,2,6,5,2,74,24,23,2,2,72,7,1,0,71,0,4,0,5,6,4,5,101,3,1,1,1,2,93,0,2,2,98,75,0,6,6,0,93,0,0,0,102,0,76,37,51,36,41,66,40,51,7,12,27,43,37,6,7,7,38,35,34,7,55,54,54,53,19,52,38,35,7,39,55,22,51,50,54,55,23,6,7,7,55,52,38,38,35,34,6,6,7,7,23,50,55,23,7,38,35,34,7,7,20,22,22,51,50,54,54,55,55,2,20,17,10,5,210,93,74,65,6,45,33,1,15,22,34,2,7,102,37,119,132,49,3,18,5,48,2,18,60,75,35,26,8,1,8,103,39,83,4,14,111,29,33,44,4,10,31,38,84,71,30,8,44,167,81,87,6,7,10,46,6,35,43,1,164,32,22,2,4,44,3,5,7,6,79,87,4,43,35,27,9,4,15,20,194,1,11,5,59,3,7,191,29,23,8,16,48,58,5,0,0,0,255,255,0,58,255,246,2,20,3,73,0,34,0,47,0,0,0,3,7,227,2,7,0,0,255,255,0,58,255,246,2,20,3,69,0,34,0,47,0,0,1,7,7,199,2,14,0,175,0,8,177,1,1,176,175,176,51,43,0,0,255,255,0,58,255,246,2,20,3,70,0,34,0,47,0,0,0,3,7,230,1,253,0,0,255,255,0,58,255,23,2,20,3,50,0,34,0,47,0,0,0,35,7,216,2,20,0,0,0,3,7,231,2,13,0,0,255,255,0,58,255,246,2,20,3,78,0,34,0,47,0,0,0,3,7,229,1,253,0,0,255,255,0,58,255,246,2,20,3,148,0,34,0,47,0,0,1,7,8,47,2,14,0,140,0,8,177,1,2,176,140,176,51,43,0,0,255,255,0,58,255,64,2,20,3,78,0,34,0,47,0,0,0,35,7,229,1,253,0,0,0,3,7,213,1,239,0,0,255,255,0,58,255,246,2,20,3,141,0,34,0,47,0,0,1,7,8,48,2,14,0,140,0,8,177,1,2,176,140,176,51,43,0,0,255,255,0,58,255,246,2,20,3,161,0,34,0,47,0,0,1,7,8,49,2,14,0,140,0,8,177,1,2,176,140,176,51,43,0,0,255,255,0,58,255,246,2,20,3,151,0,34,0,47,0,0,1,7,8,50,2,14,0,140,0,8,177,1,2,176,140,176,51,43,0,0,255,255,0,58,255,246,2,20,3,69,0,34,0,47,0,0,0,3,7,240,1,186,0,0,255,255,0,58,255,246,2,20,3,40,0,34,0,47,0,0,0,3,7,221,1,253,0,0,255,255,0,58,255,246,2,20,3,51,0,34,0,47,0,0,0,3,7,224,1,253,0,0,255,255,0,58,255,64,2,20,2,137,0,34,0,47,0,0,0,3,7,213,1,239,0,0,255,255,0,58,255,246,2,20,3,73,0,34,0,47,0,0,0,3,7,226,1,250,0,0,255,255,0,58,255,246,2,20,3,123,0,34,0,47,0,0,1,7,7,208,2,14,0,140,0,8,177,1,1,176,140,176,51,43,0,0,255,255,0,58,255,246,2,20,3,89,0,34,0,47,0,0,1,7,7,210,1,248,0,195,0,8,177,1,1,176,195,176,51,43,0,0,255,255,0,58,255,246,2,20,3,10,0,34,0,47,0,0,0,3,7,237,1,252,0,0,255,255,0,58,255,246,2,20,3,189,0,34,0,47,0,0,0,39,7,205,2,12,0,150,1,7,7,227,1,228,0,116,0,16,177,1,1,176,150,176,51,43,177,2,1,176,116,176,51,43,0,0,255,255,0,58,255,246,2,20,3,189,0,34,0,47,0,0,0,39,7,205,2,12,0,150,1,7,7,226,2,59,0,116,0,16,177,1,1,176,150,176,51,43,177,2,1,176,116,176,51,43,0,0,255,255,0,58,255,15,2,20,2,137,0,34,0,47,0,0,0,3,7,217,2,111,0,0,255,255,0,58,255,246,2,20,3,52,0,34,0,47,0,0,0,3,7,233,1,253,0,0,0,1,0,58,255,244,1,244,2,137,0,61,0,71,64,68,11,1,0,1,40,39,23,3,3,0,46,1,5,4,54,1,6,5,4,74,17,1,1,72,61,1,6,71,0,3,0,4,5,3,4,103,2,1,0,0,1,95,0,1,1,98,75,0,5,5,6,93,0,6,6,99,6,76,67,52,53,36,45,53,38,7,12,27,43,55,54,54,53,19,52,38,35,34,6,35,39,55,22,22,51,50,55,23,14,2,7,7,52,54,53,52,38,38,35,34,6,6,7,7,23,50,54,55,23,7,38,38,35,34,7,7,20,22,51,50,54,51,23,7,38,38,35,34,6,7,64,46,32,1,15,22,10,20,4,2,7,13,79,47,197,84,3,1,9,10,3,48,2,17,52,65,35,26,8,1,8,103,19,74,12,4,14,13,71,39,37,40,4,18,26,20,43,8,2,9,16,87,46,31,72,11,34,9,35,42,1,164,32,22,2,4,44,1,2,12,6,6,44,78,41,4,5,28,13,35,27,9,4,15,20,211,1,9,2,5,60,1,2,7,166,41,27,3,4,47,1,3,10,2,0,0,0,1,0,40,255,244,2,80,2,137,0,58,0,61,64,58,12,1,1,0,17,1,4,1,48,1,3,4,3,74,0,4,0,3,2,4,3,103,0,1,1,0,95,0,0,0,98,75,0,2,2,5,95,6,1,5,5,105,5,76,0,0,0,58,0,57,51,38,37,46,38,7,12,25,43,22,38,38,53,52,54,54,51,50,22,22,23,23,14,2,7,7,54,54,53,52,38,35,34,6,21,20,22,22,51,50,54,54,53,53,52,38,35,35,39,55,22,22,51,50,54,55,23,6,6,21,20,23,7,20,6,6,35,244,132,72,88,160,103,37,86,62,9,4,2,10,11,3,47,1,2,71,80,114,127,56,104,68,36,60,41,21,34,69,2,9,12,78,37,27,52,7,4,18,13,7,6,71,103,56,12,76,139,94,103,160,89,11,11,2,6,6,46,74,41,4,5,29,20,46,42,137,124,87,132,72,17,20,1,122,34,20,4,50,1,3,4,1,22,15,65,74,58,30,9,1,25,20,255,255,0,40,255,244,2,80,3,40,0,34,0,71,0,0,1,7,7,231,2,60,255,246,0,9,177,1,1,184,255,246,176,51,43,0,255,255,0,40,255,244,2,80,3,70,0,34,0,71,0,0,0,3,7,230,2,60,0,0,255,255,0,40,255,244,2,80,3,99,0,34,0,71,0,0,1,7,7,197,2,66,0,164,0,8,177,1,1,176,164,176,51,43,0,0,255,255,0,40,254,219,2,80,2,137,0,34,0,71,0,0,0,3,7,215,2,23,0,0,255,255,0,40,255,244,2,80,3,51,0,34,0,71,0,0,0,3,7,224,2,60,0,0,255,255,0,40,255,244,2,80,3,10,0,34,0,71,0,0,0,3,7,237,2,59,0,0,0,1,0,58,255,244,2,185,2,134,0,81,0,74,64,71,31,25,2,2,0,73,67,50,3,5,9,2,74,38,16,2,1,72,0,2,0,9,5,2,9,101,3,1,0,0,1,95,4,1,1,1,98,75,10,8,2,5,5,6,95,11,7,2,6,6,99,6,76,79,76,72,70,66,63,17,49,19,42,52,36,39,82,38,12,12,29,43,55,54,54,53,19,52,38,35,7,39,55,50,23,22,51,50,55,7,14,2,7,7,23,50,55,55,52,38,35,34,7,39,55,22,22,51,50,55,7,6,6,7,6,2,21,20,22,51,50,55,23,7,34,39,38,35,7,55,62,2,53,53,39,6,6,7,7,20,22,51,50,55,23,7,38,38,35,34,6,7,64,46,32,1,15,22,34,2,7,13,7,60,31,42,65,4,30,25,9,2,6,168,63,85,1,15,22,14,20,2,7,11,58,29,48,72,4,37,26,1,6,8,18,26,12,33,2,9,14,8,66,35,115,9,33,31,12,152,25,90,51,4,18,26,12,33,2,9,9,50,26,46,105,1,34,9,35,42,1,164,32,22,2,4,44,1,2,9,45,5,14,33,38,162,1,10,182,32,22,2,4,44,1,2,9,45,5,23,29,113,254,253,66,37,25,3,4,46,1,2,2,45,1,16,44,46,151,1,1,5,5,179,41,27,3,4,46,1,2,8,4,0,0,0,0,2,0,42,255,244,2,195,2,134,0,90,0,97,0,111,64,108,74,1,8,9,89,45,2,7,8,97,1,17,7,30,24,7,3,0,4,4,74,81,60,2,10,72,14,11,2,8,16,18,15,3,7,17,8,7,101,0,17,0,4,0,17,4,101,12,1,9,9,10,95,13,1,10,10,98,75,5,3,2,0,0,1,95,6,2,2,1,1,99,1,76,0,0,96,94,93,91,0,90,0,90,88,87,80,77,73,71,68,66,59,54,52,50,18,23,52,36,52,17,49,19,36,19,12,29,43,1,6,21,20,22,51,50,55,23,7,34,39,38,35,7,55,62,2,53,53,39,6,6,7,7,20,22,51,50,55,23,7,38,38,35,34,6,7,55,54,54,53,19,35,39,55,51,53,52,38,35,7,39,55,50,23,22,51,50,55,7,14,2,7,7,51,55,53,52,38,35,34,7,39,55,22,22,51,50,55,7,6,6,7,6,21,55,23,7,7,35,35,7,23,50,55,2,102,10,18,26,12,33,2,9,14,8,66,35,115,9,33,31,12,152,25,90,51,4,18,26,12,33,2,9,9,50,26,46,105,1,6,46,32,1,90,9,7,92,15,22,34,2,7,13,7,60,31,42,65,4,30,25,9,2,1,174,138,15,22,14,20,2,7,11,58,29,48,72,4,37,26,1,2,78,13,4,169,160,153,4,168,63,85,1,194,223,121,37,25,3,4,46,1,2,2,45,1,16,44,46,151,1,1,5,5,179,41,27,3,4,46,1,2,8,4,46,9,35,42,1,72,9,39,44,32,22,2,4,44,1,2,9,45,5,14,33,38,16,1,44,32,22,2,4,44,1,2,9,45,5,23,29,30,16,2,13,37,1,100,1,10,0,0,0,255,255,0,58,255,59,2,185,2,134,0,34,0,78,0,0,0,3,7,218,2,64,0,0,255,255,0,58,255,244,2,185,3,78,0,34,0,78,0,0,0,3,7,229,2,64,0,0,255,255,0,58,255,64,2,185,2,134,0,34,0,78,0,0,0,3,7,213,2,61,0,0,0,1,0,56,255,244,1,56,2,134,0,35,0,49,64,46,27,1,3,0,1,74,15,1,1,72,35,1,4,71,0,0,0,1,95,2,1,1,1,98,75,0,3,3,4,95,5,1,4,4,99,4,76,49,19,42,33,18,38,6,12,26,43,55,54,54,53,19,52,38,35,7,39,55,50,23,23,50,55,7,6,6,7,6,6,21,20,22,51,50,55,23,7,34,39,38,35,34,7,62,47,33,1,15,22,42,2,7,16,9,94,45,70,4,41,29,2,6,8,18,26,17,36,2,9,14,8,70,39,49,67,34,9,35,42,1,164,32,22,2,4,44,1,2,9,45,5,23,29,117,255,60,41,27,3,4,46,1,2,12,255,255,0,56,255,112,2,126,2,134,0,34,0,83,0,0,0,3,0,100,1,105,0,0,255,255,0,56,255,244,1,57,3,73,0,34,0,83,0,0,0,3,7,227,1,106,0,0,255,255,0,56,255,244,1,56,3,79,0,34,0,83,0,0,1,7,7,199,1,124,0,185,0,8,177,1,1,176,185,176,51,43,0,0,255,255,0,36,255,244,1,70,3,70,0,34,0,83,0,0,0,3,7,230,1,124,0,0,255,255,0,36,255,244,1,70,3,78,0,34,0,83,0,0,0,3,7,229,1,124,0,0,255,255,255,244,255,244,1,56,3,59,0,34,0,83,0,0,1,7,7,240,1,41,255,246,0,9,177,1,2,184,255,246,176,51,43,0,255,255,0,52,255,244,1,56,3,40,0,34,0,83,0,0,0,3,7,221,1,124,0,0,255,255,0,52,255,244,1,56,3,170,0,34,0,83,0,0,0,3,7,222,1,124,0,0,255,255,0,56,255,244,1,56,3,51,0,34,0,83,0,0,0,3,7,224,1,124,0,0,255,255,0,56,255,64,1,56,2,134,0,34,0,83,0,0,0,3,7,213,1,121,0,0,255,255,0,19,255,244,1,56,3,63,0,34,0,83,0,0,1,7,7,226,1,112,255,246,0,9,177,1,1,184,255,246,176,51,43,0,255,255,0,56,255,244,1,56,3,148,0,34,0,83,0,0,1,7,7,208,1,125,0,165,0,8,177,1,1,176,165,176,51,43,0,0,255,255,0,56,255,244,1,56,3,79,0,34,0,83,0,0,1,7,7,210,1,103,0,185,0,8,177,1,1,176,185,176,51,43,0,0,255,255,0,31,255,244,1,74,3,10,0,34,0,83,0,0,0,3,7,237,1,123,0,0,255,255,0,56,255,15,1,58,2,134,0,34,0,83,0,0,0,3,7,217,1,153,0,0,255,255,0,26,255,244,1,79,3,89,0,34,0,83,0,0,1,7,8,9,255,237,0,165,0,8,177,1,1,176,165,176,51,43,0,0,0,1,0,23,255,112,1,21,2,134,0,29,0,28,64,25,18,1,1,72,29,13,2,0,71,0,0,0,1,93,0,1,1,98,0,76,36,40,2,12,22,43,23,55,62,2,53,19,52,38,35,34,6,7,39,55,51,50,54,55,7,14,2,7,6,6,7,6,6,7,23,3,41,45,19,1,14,23,12,29,6,2,7,108,27,77,12,4,25,22,9,1,4,7,2,1,77,85,111,8,25,55,77,61,1,169,32,21,3,1,4,44,7,2,45,4,10,21,22,93,246,89,102,123,35,0,0,0,255,255,0,23,255,112,1,63,3,109,0,34,0,100,0,0,1,7,7,197,1,117,0,174,0,8,177,1,1,176,174,176,51,43,0,0,0,2,0,57,255,242,2,106,2,134,0,36,0,69,0,151,75,176,29,80,88,64,25,6,1,0,1,68,55,2,2,0,25,1,3,2,61,1,7,3,4,74,49,43,13,3,1,72,27,64,25,6,1,0,1,68,55,2,2,0,25,1,6,2,61,1,7,3,4,74,49,43,13,3,1,72,89,75,176,29,80,88,64,29,4,1,0,0,1,95,5,1,1,1,98,75,6,1,2,2,3,93,0,3,3,99,75,0,7,7,105,7,76,27,64,36,0,6,2,3,2,6,3,126,4,1,0,0,1,95,5,1,1,1,98,75,0,2,2,3,93,0,3,3,99,75,0,7,7,105,7,76,89,64,11,36,26,52,26,53,41,53,33,8,12,28,43,18,38,35,34,6,35,39,55,22,22,51,50,54,55,7,6,6,7,3,6,22,51,50,54,55,23,7,38,38,35,7,55,62,2,53,19,5,54,53,52,39,39,55,22,22,51,50,54,55,23,7,6,6,7,7,23,22,22,51,23,7,6,6,35,34,38,39,39,55,143,15,22,10,20,4,2,7,12,66,33,27,69,11,4,37,28,1,12,1,18,27,15,26,4,2,9,13,72,38,115,10,32,31,12,1,1,23,31,63,2,7,12,75,23,24,59,9,4,7,26,44,45,161,168,36,57,35,4,6,11,65,7,24,58,30,175,1,2,60,22,2,4,44,1,2,7,2,45,6,25,29,254,83,40,28,2,1,4,46,1,2,1,45,3,14,30,29,1,164,25,31,21,26,4,4,43,1,6,3,1,7,41,5,32,47,169,219,47,38,4,34,2,10,45,41,243,14,255,255,0,57,254,219,2,106,2,134,0,34,0,102,0,0,0,3,7,215,2,61,0,0,0,1,0,68,255,246,1,249,2,134,0,46,0,82,64,18,11,1,0,1,35,1,2,0,2,74,18,1,1,72,46,1,3,71,75,176,12,80,88,64,21,0,0,0,1,95,0,1,1,98,75,0,2,2,3,93,0,3,3,99,3,76,27,64,21,0,0,0,1,95,0,1,1,98,75,0,2,2,3,93,0,3,3,102,3,76,89,182,73,45,53,38,4,12,24,43,55,54,54,53,19,52,38,35,34,6,35,39,55,22,22,51,50,54,55,7,14,2,7,6,6,21,20,22,22,51,50,54,54,55,55,23,6,6,7,7,38,38,35,34,6,7,74,39,29,1,15,22,10,20,4,2,7,12,66,34,27,69,11,4,33,25,5,3,6,6,12,33,40,61,57,29,12,44,3,3,19,7,5,29,181,59,47,77,10,36,6,35,43,1,164,32,22,2,4,44,1,2,7,2,45,4,18,24,47,85,218,83,36,31,10,20,58,64,5,5,16,112,62,6,2,7,8,2,255,255,0,68,255,112,3,16,2,134,0,34,0,104,0,0,0,3,0,100,1,251,0,0,255,255,0,68,255,246,1,249,3,83,0,34,0,104,0,0,1,7,7,227,1,115,0,10,0,8,177,1,1,176,10,176,51,43,0,0,0,2,0,68,255,246,1,249,2,134,0,46,0,58,0,84,64,20,53,11,2,0,1,47,35,2,2,0,2,74,18,1,1,72,46,1,3,71,75,176,12,80,88,64,21,0,0,0,1,95,0,1,1,98,75,0,2,2,3,93,0,3,3,99,3,76,27,64,21,0,0,0,1,95,0,1,1,98,75,0,2,2,3,93,0,3,3,102,3,76,89,182,73,45,53,38,4,12,24,43,55,54,54,53,19,52,38,35,34,6,35,39,55,22,22,51,50,54,55,7,14,2,7,6,6,21,20,22,22,51,50,54,54,55,55,23,6,6,7,7,38,38,35,34,6,7,1,54,53,52,38,39,55,23,6,6,7,7,74,39,29,1,15,22,10,20,4,2,7,12,66,34,27,69,11,4,33,25,5,3,6,6,12,33,40,61,57,29,12,44,3,3,19,7,5,29,181,59,47,77,10,1,92,1,6,1,70,7,2,20,13,25,36,6,35,43,1,164,32,22,2,4,44,1,2,7,2,45,4,18,24,47,85,218,83,36,31,10,20,58,64,5,5,16,112,62,6,2,7,8,2,1,155,18,36,56,95,13,14,8,19,129,64,14,255,255,0,68,254,219,1,249,2,134,0,34,0,104,0,0,0,3,7,215,1,249,0,0,255,255,0,68,255,246,1,249,2,134,0,34,0,104,0,0,1,7,7,9,1,64,0,215,0,8,177,1,1,176,215,176,51,43,0,0,255,255,0,68,255,64,1,249,2,134,0,34,0,104,0,0,0,3,7,213,1,227,0,0,255,255,0,68,255,15,2,175,2,200,0,34,0,104,0,0,0,3,1,96,1,251,0,0,255,255,0,68,255,93,1,249,2,134,0,34,0,104,0,0,0,3,7,219,1,229,0,0,0,1,0,61,255,246,1,249,2,134,0,56,0,91,64,26,27,1,1,2,56,45,44,42,41,19,18,16,15,9,3,1,2,74,34,1,2,72,10,1,0,71,75,176,12,80,88,64,21,0,1,1,2,95,0,2,2,98,75,0,3,3,0,93,0,0,0,99,0,76,27,64,21,0,1,1,2,95,0,2,2,98,75,0,3,3,0,93,0,0,0,102,0,76,89,183,52,50,53,46,68,4,12,23,43,37,6,6,7,7,38,38,35,34,6,7,55,54,54,53,53,7,39,39,55,53,52,38,35,34,6,35,39,55,22,22,51,50,54,55,7,14,2,7,6,7,55,23,23,7,6,21,20,22,22,51,50,54,54,55,55,1,249,3,19,7,5,29,181,59,47,77,10,6,39,29,67,9,5,82,15,22,10,20,4,2,7,12,66,34,27,69,11,4,33,25,5,3,6,1,179,8,5,194,3,12,33,40,61,57,29,12,44,187,16,112,62,6,2,7,8,2,46,6,35,43,171,33,3,32,40,207,32,22,2,4,44,1,2,7,2,45,4,18,24,47,86,57,89,5,31,96,115,85,36,31,10,20,58,64,5,0,0,0,0,1,0,46,255,237,3,30,2,131,0,80,0,58,64,55,77,37,2,0,2,63,1,1,0,2,74,47,1,3,72,80,70,15,3,1,71,0,2,2,3,95,4,1,3,3,98,75,5,1,0,0,1,95,6,1,1,1,99,1,76,53,44,89,67,27,51,37,7,12,27,43,19,35,6,2,21,20,51,55,23,7,38,38,35,34,6,7,55,54,54,55,54,18,53,52,38,39,39,55,22,22,51,50,54,55,30,2,23,51,54,18,55,52,23,23,50,54,55,23,7,6,6,21,20,18,23,30,2,51,50,54,51,23,7,38,38,35,34,6,7,55,54,54,53,52,2,39,35,3,7,205,5,6,30,31,41,2,9,11,57,29,25,53,8,5,32,28,4,10,33,41,45,3,8,13,76,20,18,43,7,40,75,48,6,5,14,100,59,27,39,19,76,13,2,5,43,36,18,8,5,10,18,16,9,16,3,2,9,10,55,30,27,67,10,4,31,28,29,5,5,193,24,2,8,66,254,149,16,31,1,4,45,1,3,7,1,46,4,33,40,94,1,63,19,26,26,3,5,35,1,4,3,1,129,221,130,16,37,1,22,179,1,2,1,5,1,4,37,5,25,25,22,254,229,103,41,39,15,2,4,45,1,2,7,1,46,4,24,22,21,1,92,63,253,236,7,0,0,0,255,255,0,46,255,64,3,30,2,131,0,34,0,114,0,0,0,3,7,213,2,86,0,0,0,1,0,54,255,216,2,174,2,133,0,56,0,54,64,51,25,1,3,2,37,3,2,0,3,2,74,50,1,2,72,56,55,17,3,1,71,0,3,3,2,95,4,1,2,2,98,75,0,0,0,1,95,0,1,1,99,1,76,51,41,61,51,39,5,12,25,43,36,38,38,39,35,3,20,22,51,55,23,7,38,38,35,34,6,7,55,54,54,55,19,52,38,39,39,55,22,22,51,50,54,55,30,2,23,51,17,52,35,7,39,55,22,22,51,50,54,55,7,6,6,7,3,7,1,227,165,106,14,5,5,14,17,51,2,9,11,68,27,25,59,9,5,31,30,1,13,37,50,3,8,9,60,17,21,40,6,74,149,100,13,5,33,38,2,9,10,56,29,26,63,10,5,35,32,1,14,29,95,245,151,20,254,85,22,18,1,4,45,1,3,7,1,46,4,29,30,1,181,31,26,5,5,37,1,4,3,1,115,220,142,19,1,149,43,1,4,45,1,3,7,1,46,5,29,29,253,206,14,0,0,0,255,255,0,54,255,112,3,228,2,134,0,34,0,116,0,0,0,3,0,100,2,207,0,0,255,255,0,54,255,216,2,174,3,73,0,34,0,116,0,0,0,3,7,227,2,68,0,0,255,255,0,54,255,216,2,174,3,70,0,34,0,116,0,0,0,3,7,230,2,58,0,0,255,255,0,54,254,219,2,174,2,133,0,34,0,116,0,0,0,3,7,215,2,59,0,0,255,255,0,54,255,216,2,174,3,51,0,34,0,116,0,0,0,3,7,224,2,47,0,0,255,255,0,54,255,64,2,174,2,133,0,34,0,116,0,0,0,3,7,213,2,44,0,0,0,1,0,54,255,102,2,174,2,133,0,62,0,57,64,54,29,1,3,2,41,1,0,3,4,1,1,0,3,74,54,31,2,2,72,62,21,2,1,71,0,3,3,2,95,4,1,2,2,98,75,0,0,0,1,95,0,1,1,99,1,76,51,40,62,51,43,5,12,25,43,5,55,54,54,55,38,2,21,35,3,20,22,51,55,23,7,38,38,35,34,6,7,55,54,54,55,19,52,38,39,39,55,22,22,51,50,54,55,30,2,23,51,17,52,35,7,39,55,22,22,51,50,54,55,7,6,6,7,3,6,6,7,1,168,3,48,53,11,114,227,5,5,14,17,50,3,9,11,72,29,25,54,8,5,35,26,2,12,35,52,3,8,10,49,22,17,46,9,63,149,109,15,5,33,38,2,9,10,56,29,26,63,10,5,36,31,1,9,3,75,85,121,8,22,57,42,176,1,73,2,254,85,22,18,2,4,46,1,3,7,1,46,3,35,48,1,158,29,26,7,5,37,1,4,3,1,99,220,156,21,1,149,43,1,4,45,1,3,7,1,46,4,30,29,254,62,97,112,31,0,0,255,255,0,54,255,15,3,131,2,200,0,34,0,116,0,0,0,3,1,96,2,207,0,0,255,255,0,54,255,93,2,174,2,133,0,34,0,116,0,0,0,3,7,219,2,46,0,0,255,255,0,54,255,216,2,174,3,52,0,34,0,116,0,0,0,3,7,233,2,59,0,0,0,2,0,40,255,244,2,140,2,137,0,15,0,31,0,44,64,41,0,2,2,0,95,0,0,0,98,75,5,1,3,3,1,95,4,1,1,1,105,1,76,16,16,0,0,16,31,16,30,24,22,0,15,0,14,38,6,12,21,43,22,38,38,53,52,54,54,51,50,22,22,21,20,6,6,35,62,2,53,52,38,38,35,34,6,6,21,20,22,22,51,236,126,70,87,151,91,83,128,72,89,153,93,94,98,54,58,103,67,61,95,53,56,101,65,12,78,141,90,98,161,93,78,140,90,98,162,93,51,66,118,76,85,131,74,66,118,76,85,131,74,0,0,0,255,255,0,40,255,244,2,140,3,73,0,34,0,127,0,0,0,3,7,227,2,39,0,0,255,255,0,40,255,244,2,140,3,69,0,34,0,127,0,0,1,7,7,199,2,12,0,175,0,8,177,2,1,176,175,176,51,43,0,0,255,255,0,40,255,244,2,140,3,70,0,34,0,127,0,0,0,3,7,230,2,28,0,0,255,255,0,40,255,244,2,140,3,78,0,34,0,127,0,0,0,3,7,229,2,29,0,0,255,255,0,40,255,244,2,140,3,148,0,34,0,127,0,0,1,7,8,47,2,38,0,140,0,8,177,2,2,176,140,176,51,43,0,0,255,255,0,40,255,64,2,140,3,78,0,34,0,127,0,0,0,35,7,229,2,29,0,0,0,3,7,213,2,31,0,0,255,255,0,40,255,244,2,140,3,141,0,34,0,127,0,0,1,7,8,48,2,38,0,140,0,8,177,2,2,176,140,176,51,43,0,0,255,255,0,40,255,244,2,140,3,161,0,34,0,127,0,0,1,7,8,49,2,38,0,140,0,8,177,2,2,176,140,176,51,43,0,0,255,255,0,40,255,244,2,140,3,151,0,34,0,127,0,0,1,7,8,50,2,38,0,140,0,8,177,2,2,176,140,176,51,43,0,0,255,255,0,40,255,244,2,140,3,59,0,34,0,127,0,0,1,7,7,240,1,206,255,246,0,9,177,2,2,184,255,246,176,51,43,0,255,255,0,40,255,244,2,140,3,40,0,34,0,127,0,0,0,3,7,221,2,29,0,0,255,255,0,40,255,244,2,140,3,120,0,34,0,127,0,0,1,7,7,223,2,32,255,241,0,9,177,2,3,184,255,241,176,51,43,0,255,255,0,40,255,244,2,140,3,117,0,34,0,127,0,0,0,47,7,191,2,21,0,146,60,96,1,7,7,205,2,32,0,252,0,16,177,2,1,176,146,176,51,43,177,3,1,176,252,176,51,43,255,255,0,40,255,64,2,140,2,137,0,34,0,127,0,0,0,3,7,213,2,31,0,0,255,255,0,40,255,244,2,140,3,73,0,34,0,127,0,0,0,3,7,226,2,26,0,0,255,255,0,40,255,244,2,140,3,123,0,34,0,127,0,0,1,7,7,208,2,38,0,140,0,8,177,2,1,176,140,176,51,43,0,0,0,2,0,40,255,244,2,180,3,6,0,35,0,51,0,113,181,18,1,0,2,1,74,75,176,10,80,88,64,35,0,2,0,2,131,0,1,3,3,1,87,5,1,3,3,0,95,0,0,0,98,75,8,1,6,6,4,95,7,1,4,4,105,4,76,27,64,36,0,2,0,2,131,0,1,0,3,6,1,3,103,0,5,5,0,95,0,0,0,98,75,8,1,6,6,4,95,7,1,4,4,105,4,76,89,64,21,36,36,0,0,36,51,36,50,44,42,0,35,0,34,21,39,35,38,9,12,24,43,22,38,38,53,52,54,54,51,50,22,23,22,51,50,54,53,52,38,39,55,54,51,50,22,21,20,6,6,39,22,22,21,20,6,6,35,62,2,53,52,38,38,35,34,6,6,21,20,22,22,51,236,126,70,87,151,91,34,47,31,37,25,31,39,17,15,2,31,27,23,28,38,63,36,46,51,89,153,93,94,98,54,58,103,67,61,95,53,56,101,65,12,78,141,90,98,161,93,10,10,14,26,23,18,38,14,14,26,43,35,34,54,29,1,41,123,75,98,162,93,51,66,118,76,85,131,74,66,118,76,85,131,74,0,0,255,255,0,40,255,244,2,180,3,73,0,34,0,144,0,0,0,3,7,227,2,39,0,0,255,255,0,40,255,64,2,180,3,6,0,34,0,144,0,0,0,3,7,213,2,31,0,0,255,255,0,40,255,244,2,180,3,73,0,34,0,144,0,0,0,3,7,226,2,26,0,0,255,255,0,40,255,244,2,180,3,128,0,34,0,144,0,0,1,7,7,208,2,22,0,145,0,8,177,2,1,176,145,176,51,43,0,0,255,255,0,40,255,244,2,180,3,52,0,34,0,144,0,0,0,3,7,233,2,28,0,0,255,255,0,40,255,244,2,140,3,59,0,34,0,127,0,0,1,7,7,228,2,32,255,246,0,9,177,2,2,184,255,246,176,51,43,0,255,255,0,40,255,244,2,140,3,79,0,34,0,127,0,0,1,7,7,210,2,12,0,185,0,8,177,2,1,176,185,176,51,43,0,0,255,255,0,40,255,244,2,140,3,10,0,34,0,127,0,0,0,3,7,237,2,28,0,0,255,255,0,40,255,244,2,140,3,179,0,34,0,127,0,0,0,39,7,205,2,32,0,140,1,7,7,227,1,248,0,106,0,16,177,2,1,176,140,176,51,43,177,3,1,176,106,176,51,43,0,0,255,255,0,40,255,244,2,140,3,179,0,34,0,127,0,0,0,39,7,205,2,32,0,140,1,7,7,226,2,79,0,106,0,16,177,2,1,176,140,176,51,43,177,3,1,176,106,176,51,43,0,0,255,255,0,40,255,15,2,140,2,137,0,34,0,127,0,0,0,3,7,217,2,71,0,0,0,3,0,40,255,158,2,140,2,196,0,25,0,35,0,45,0,66,64,63,25,21,2,2,1,43,42,29,28,4,3,2,12,8,2,0,3,3,74,24,22,2,1,72,11,9,2,0,71,0,2,2,1,95,0,1,1,98,75,4,1,3,3,0,95,0,0,0,105,0,76,36,36,36,45,36,44,42,43,37,5,12,23,43,0,22,21,20,6,6,35,34,39,7,39,39,55,38,38,53,52,54,54,51,50,23,55,23,23,7,0,22,23,19,38,35,34,6,6,21,0,54,54,53,52,38,39,3,22,51,2,65,75,89,153,93,67,54,60,27,2,59,59,67,87,151,91,58,51,42,29,3,41,254,127,40,37,239,47,60,61,95,53,1,29,98,54,48,44,241,51,67,2,63,142,92,98,162,93,27,113,6,10,113,40,138,88,98,161,93,20,79,7,12,76,254,157,116,40,1,202,29,66,118,76,254,222,66,118,76,77,124,38,254,52,39,255,255,0,40,255,158,2,140,3,72,0,34,0,156,0,0,1,7,7,227,2,17,255,255,0,9,177,3,1,184,255,255,176,51,43,0,255,255,0,40,255,244,2,140,3,52,0,34,0,127,0,0,0,3,7,233,2,30,0,0,255,255,0,40,255,244,2,140,3,194,0,34,0,127,0,0,0,39,7,201,2,32,0,140,1,135,7,227,1,212,0,118,63,233,252,167,3,89,63,233,0,16,177,2,1,176,140,176,51,43,177,3,1,176,118,176,51,43,0,0,255,255,0,40,255,244,2,140,3,167,0,34,0,127,0,0,0,39,7,201,2,32,0,140,1,7,7,186,2,33,1,40,0,17,177,2,1,176,140,176,51,43,177,3,2,184,1,40,176,51,43,0,255,255,0,40,255,244,2,140,3,136,0,34,0,127,0,0,0,39,7,201,2,32,0,115,1,7,7,205,2,32,1,15,0,17,177,2,1,176,115,176,51,43,177,3,1,184,1,15,176,51,43,0,0,2,0,41,255,244,3,134,2,137,0,64,0,81,0,158,64,17,37,36,20,3,3,2,52,42,2,5,4,2,74,14,1,0,72,75,176,27,80,88,64,45,0,3,0,4,5,3,4,103,8,1,2,2,0,95,0,0,0,98,75,8,1,2,2,1,95,0,1,1,98,75,11,9,2,5,5,6,95,10,7,2,6,6,99,6,76,27,64,56,0,3,0,4,5,3,4,103,8,1,2,2,0,95,0,0,0,98,75,8,1,2,2,1,95,0,1,1,98,75,11,9,2,5,5,6,93,0,6,6,99,75,11,9,2,5,5,7,95,10,1,7,7,105,7,76,89,64,24,65,65,0,0,65,81,65,80,74,72,0,64,0,63,89,37,37,36,45,35,38,12,12,27,43,22,38,38,53,52,54,54,51,50,23,22,22,51,50,55,23,14,2,7,7,52,54,53,52,38,38,35,34,6,6,7,7,23,50,54,55,23,7,38,38,35,7,7,20,22,22,51,50,54,54,55,55,23,6,6,7,7,38,38,35,34,7,6,35,62,2,55,19,52,38,38,35,34,6,6,21,20,22,22,51,232,122,69,85,148,89,40,59,10,75,35,203,101,3,1,9,10,3,48,2,19,60,75,35,26,8,1,8,104,22,86,14,4,14,14,81,45,78,3,10,31,38,84,71,30,8,44,3,3,18,6,5,34,212,59,46,105,74,29,96,77,35,1,1,31,77,74,62,96,54,54,98,63,12,78,141,90,98,161,93,7,1,6,14,6,6,45,74,41,4,5,25,13,35,27,9,4,15,20,194,1,9,2,5,59,1,2,7,191,29,23,8,16,48,58,5,5,14,101,53,6,1,7,7,6,52,33,73,62,1,3,51,52,21,66,119,76,85,132,73,0,0,0,2,0,63,255,248,2,16,2,129,0,42,0,54,0,58,64,55,11,1,0,1,54,53,51,3,2,0,35,1,4,3,3,74,0,2,0,3,0,2,3,126,5,1,0,0,1,93,0,1,1,98,75,0,3,3,4,95,0,4,4,99,4,76,38,68,52,37,101,38,6,12,26,43,55,54,54,53,19,52,38,35,34,6,35,39,55,22,22,51,50,54,55,50,22,21,20,6,6,35,35,7,20,22,22,51,50,54,55,23,7,38,38,35,34,6,7,0,54,53,52,38,35,34,6,7,6,7,23,70,44,28,1,15,22,10,20,4,2,7,12,66,33,31,79,16,104,110,65,106,58,84,2,6,17,21,17,31,6,2,9,10,53,29,40,107,2,1,64,61,91,97,18,8,1,9,3,106,38,8,31,43,1,164,32,22,2,4,44,1,2,3,1,92,86,56,101,62,98,48,41,13,2,1,4,46,1,2,6,2,1,50,78,68,77,71,4,10,127,148,15,0,0,0,0,2,0,56,255,244,2,9,2,134,0,49,0,63,0,77,64,74,11,1,0,1,23,1,2,0,60,1,7,6,42,1,5,4,4,74,18,1,1,72,49,1,5,71,0,2,0,6,7,2,6,103,0,7,0,3,4,7,3,101,0,0,0,1,95,0,1,1,98,75,0,4,4,5,95,0,5,5,99,5,76,22,39,52,51,37,56,53,38,8,12,28,43,55,54,54,53,19,52,38,35,34,6,35,39,55,22,22,51,50,54,55,7,6,6,7,7,6,23,51,50,22,21,20,6,6,35,35,21,20,22,51,50,54,55,23,7,38,38,35,34,6,7,36,54,53,52,38,35,34,6,7,6,7,22,22,23,62,47,33,1,15,22,13,25,4,2,7,13,70,36,29,75,11,4,42,28,2,1,2,1,82,103,111,66,109,62,71,18,26,18,30,5,2,9,14,77,40,32,73,11,1,64,61,90,98,17,8,2,6,2,18,62,22,34,9,35,42,1,164,32,22,2,4,44,1,2,7,2,45,5,23,29,20,16,5,84,79,50,89,53,36,41,27,2,1,4,46,1,2,10,2,211,66,56,69,64,3,5,140,97,6,10,1,0,2,0,40,255,40,3,36,2,137,0,32,0,48,0,109,64,10,19,1,0,5,28,1,3,2,2,74,75,176,27,80,88,64,33,0,4,4,1,95,0,1,1,98,75,7,1,5,5,0,95,0,0,0,105,75,0,2,2,3,95,6,1,3,3,103,3,76,27,64,30,0,2,6,1,3,2,3,99,0,4,4,1,95,0,1,1,98,75,7,1,5,5,0,95,0,0,0,105,0,76,89,64,20,33,33,0,0,33,48,33,47,41,39,0,32,0,31,42,38,19,8,12,23,43,4,38,38,39,34,38,38,53,52,54,54,51,50,22,22,21,20,6,6,7,21,22,22,51,50,54,53,23,23,14,2,35,36,54,54,53,52,38,38,35,34,6,6,21,20,22,22,51,2,147,87,132,123,81,126,70,87,151,91,83,128,72,62,112,71,106,141,60,29,51,4,6,6,38,42,9,254,214,98,54,58,103,67,61,95,53,56,101,65,216,30,84,90,78,141,90,98,161,93,78,140,90,82,141,98,20,5,72,60,9,1,3,18,5,33,30,255,66,118,76,85,131,74,66,118,76,85,131,74,0,0,0,2,0,57,255,240,2,91,2,129,0,50,0,62,0,134,64,17,30,1,3,4,61,59,43,3,0,3,49,17,2,7,2,3,74,75,176,27,80,88,64,38,0,0,3,1,3,0,1,126,8,1,3,3,4,95,5,1,4,4,98,75,6,1,1,1,2,95,0,2,2,99,75,9,1,7,7,105,7,76,27,64,45,0,0,3,1,3,0,1,126,0,6,1,2,1,6,2,126,8,1,3,3,4,95,5,1,4,4,98,75,0,1,1,2,95,0,2,2,99,75,9,1,7,7,105,7,76,89,64,18,0,0,57,55,0,50,0,50,24,17,69,41,67,20,19,10,12,27,43,4,38,39,39,35,7,20,22,22,51,23,7,38,38,35,34,6,7,55,62,2,53,19,52,38,35,34,6,35,39,55,22,22,51,50,54,55,50,22,21,20,6,7,23,22,22,51,23,7,7,2,54,54,53,52,35,34,6,7,6,7,23,1,231,57,24,107,83,3,10,28,34,2,9,12,72,39,35,54,9,9,32,32,12,1,15,22,10,20,4,2,7,12,66,33,34,75,14,93,108,77,70,110,29,55,40,4,6,85,191,60,48,183,10,7,1,9,1,103,16,51,44,194,149,38,33,11,4,42,1,2,2,1,45,4,14,31,30,1,164,32,22,2,4,44,1,2,3,1,84,73,60,100,32,174,48,37,4,34,11,1,76,32,66,52,132,9,14,153,93,10,0,0,0,255,255,0,57,255,240,2,91,3,73,0,34,0,166,0,0,0,3,7,227,1,221,0,0,255,255,0,57,255,240,2,91,3,70,0,34,0,166,0,0,0,3,7,230,1,239,0,0,255,255,0,57,254,219,2,91,2,129,0,34,0,166,0,0,0,3,7,215,2,13,0,0,255,255,0,57,255,240,2,91,3,59,0,34,0,166,0,0,1,7,7,240,1,156,255,246,0,9,177,2,2,184,255,246,176,51,43,0,255,255,0,57,255,64,2,91,2,129,0,34,0,166,0,0,0,3,7,213,1,246,0,0,255,255,0,57,255,240,2,91,3,79,0,34,0,166,0,0,1,7,7,210,1,218,0,185,0,8,177,2,1,176,185,176,51,43,0,0,255,255,0,57,255,93,2,91,2,129,0,34,0,166,0,0,0,3,7,219,1,248,0,0,0,1,0,57,255,244,1,210,2,137,0,59,0,53,64,50,33,1,2,1,39,9,8,3,0,2,4,1,3,0,3,74,0,2,2,1,95,0,1,1,98,75,0,0,0,3,95,4,1,3,3,105,3,76,0,0,0,59,0,58,47,45,44,5,12,23,43,22,38,38,53,39,62,2,53,55,20,22,22,51,50,54,53,52,38,38,39,46,2,53,52,54,54,51,50,22,22,23,23,14,2,7,7,39,54,54,53,52,38,35,34,6,21,20,22,23,30,2,21,20,6,6,35,177,70,45,5,1,6,5,45,20,54,56,63,76,41,56,55,52,66,45,61,105,64,40,68,40,5,3,1,8,10,3,39,6,1,2,52,67,55,71,69,67,65,68,52,63,112,72,12,15,18,1,10,6,48,77,43,5,75,72,27,59,51,30,48,34,29,27,45,62,41,52,85,49,11,12,2,6,6,44,78,41,4,5,4,29,19,53,40,55,41,40,59,35,33,43,64,42,56,89,50,0,255,255,0,57,255,244,1,210,3,73,0,34,0,174,0,0,0,3,7,227,1,200,0,0,255,255,0,57,255,244,1,210,3,175,0,34,0,174,0,0,0,35,7,227,1,200,0,0,1,7,7,224,1,218,0,124,0,8,177,2,1,176,124,176,51,43,0,0,0,1,0,50,1,78,0,138,2,150,0,9,0,6,179,9,5,1,48,43,19,54,53,52,39,55,23,6,7,7,50,8,4,76,8,20,29,28,1,80,79,99,67,66,15,9,171,133,15,0,0,0,255,255,0,57,255,244,1,210,3,70,0,34,0,174,0,0,0,3,7,230,1,205,0,0,255,255,0,57,255,244,1,210,3,167,0,34,0,174,0,0,0,35,7,230,1,218,0,0,1,7,7,224,1,218,0,116,0,8,177,2,1,176,116,176,51,43,0,0,255,255,0,57,255,23,1,210,2,137,0,34,0,174,0,0,0,3,7,216,1,203,0,0,255,255,0,57,255,244,1,210,3,78,0,34,0,174,0,0,0,3,7,229,1,218,0,0,255,255,0,57,254,219,1,210,2,137,0,34,0,174,0,0,0,3,7,215,1,190,0,0,255,255,0,57,255,244,1,210,3,51,0,34,0,174,0,0,0,3,7,224,1,218,0,0,255,255,0,57,255,64,1,210,2,137,0,34,0,174,0,0,0,3,7,213,1,185,0,0,255,255,0,57,255,64,1,210,3,51,0,34,0,174,0,0,0,35,7,213,1,185,0,0,0,3,7,224,1,218,0,0,0,1,0,58,255,244,2,206,2,131,0,73,0,168,75,176,10,80,88,64,25,63,55,2,2,6,22,1,1,7,36,8,7,3,0,1,4,1,4,0,4,74,43,1,4,71,27,64,25,63,55,2,2,6,22,1,1,7,36,8,7,3,0,1,4,1,4,0,4,74,43,1,8,71,89,75,176,10,80,88,64,33,0,7,0,1,0,7,1,103,5,1,2,2,6,93,0,6,6,98,75,3,1,0,0,4,95,9,8,2,4,4,99,4,76,27,64,43,0,7,0,1,0,7,1,103,5,1,2,2,6,93,0,6,6,98,75,3,1,0,0,4,95,0,4,4,99,75,3,1,0,0,8,95,9,1,8,8,105,8,76,89,64,17,0,0,0,73,0,72,34,100,41,53,38,36,36,43,10,12,28,43,4,38,38,53,39,54,54,55,55,20,22,22,51,50,54,53,52,38,35,34,6,7,39,55,35,34,6,6,7,3,20,22,51,50,54,55,23,7,38,38,35,34,6,7,55,54,54,53,19,52,38,35,34,6,35,39,55,50,22,51,50,54,55,23,7,23,30,2,21,20,6,6,35,1,193,70,45,5,2,8,2,45,20,54,56,52,67,89,85,24,50,7,18,181,246,35,26,8,1,14,18,26,12,25,4,2,9,12,69,38,31,72,11,6,46,32,1,15,22,10,20,4,2,7,21,111,55,91,241,37,13,176,36,61,97,54,59,103,65,12,15,18,1,10,14,96,54,5,70,68,26,73,57,71,73,6,1,31,252,4,15,20,254,76,41,27,2,1,4,47,1,3,10,2,46,9,35,42,1,164,32,22,2,4,44,3,5,1,20,238,1,2,48,81,50,61,98,56,0,2,0,21,255,244,2,120,2,135,0,25,0,33,0,65,64,62,22,20,2,1,2,11,1,4,1,2,74,0,1,0,4,5,1,4,101,0,2,2,3,95,6,1,3,3,98,75,7,1,5,5,0,95,0,0,0,105,0,76,26,26,0,0,26,33,26,32,30,29,0,25,0,24,35,20,38,8,12,23,43,0,22,22,21,20,6,6,35,34,38,38,39,55,33,46,2,35,34,6,7,39,39,54,54,51,18,54,54,55,5,22,22,51,1,158,138,80,89,154,91,81,124,71,1,11,1,255,2,63,108,68,41,105,44,8,12,81,105,53,55,92,57,6,254,83,17,117,83,2,135,82,144,88,93,158,94,75,136,90,17,76,119,66,24,19,1,31,51,40,253,160,56,102,65,5,101,117,0,0,0,1,0,9,255,252,2,23,2,137,0,38,0,48,64,45,32,19,10,3,3,0,1,74,17,16,13,12,4,1,72,2,1,0,0,1,93,0,1,1,98,75,0,3,3,4,93,0,4,4,99,4,76,67,37,24,24,21,5,12,25,43,55,62,2,53,17,14,2,7,7,54,55,55,23,33,55,23,22,23,7,46,2,39,6,2,21,20,22,51,50,55,23,7,39,39,34,7,133,50,38,12,85,61,22,9,47,12,3,9,83,1,54,85,9,3,12,47,11,22,56,80,6,10,26,31,30,25,3,9,33,114,55,82,39,4,17,45,57,1,180,3,13,45,65,4,95,78,8,11,11,8,82,87,4,66,46,14,4,60,254,208,122,37,31,3,4,46,1,2,4,0,255,255,0,9,255,252,2,23,2,137,0,34,0,188,0,0,1,7,7,220,1,250,0,81,0,8,177,1,1,176,81,176,51,43,0,0,255,255,0,9,255,252,2,23,3,70,0,34,0,188,0,0,0,3,7,230,1,219,0,0,255,255,0,9,255,23,2,23,2,137,0,34,0,188,0,0,0,3,7,216,1,218,0,0,255,255,0,9,254,219,2,23,2,137,0,34,0,188,0,0,0,3,7,215,1,224,0,0,255,255,0,9,255,64,2,23,2,137,0,34,0,188,0,0,0,3,7,213,1,213,0,0,255,255,0,9,255,93,2,23,2,137,0,34,0,188,0,0,0,3,7,219,1,215,0,0,0,1,0,35,255,244,2,136,2,134,0,54,0,53,64,50,38,10,2,0,1,1,74,45,17,2,1,72,3,1,0,0,1,95,4,1,1,1,98,75,0,2,2,5,95,6,1,5,5,105,5,76,0,0,0,54,0,53,53,39,41,53,37,7,12,25,43,22,38,53,17,52,38,35,34,6,35,39,55,22,22,51,50,54,55,7,6,6,7,3,20,22,51,50,54,53,38,38,39,38,38,35,34,6,35,39,55,22,22,51,50,54,55,7,14,2,21,17,20,6,35,222,114,15,22,10,20,4,2,7,12,67,34,27,68,10,4,37,25,2,8,86,81,82,86,1,4,1,2,13,22,12,26,5,2,7,12,67,34,27,61,9,4,30,29,10,130,118,12,115,106,1,75,32,22,2,4,44,1,2,7,2,45,5,23,29,254,218,99,106,87,82,80,205,41,35,19,2,4,44,1,2,7,2,45,4,11,21,21,254,176,105,115,0,0,0,255,255,0,35,255,244,2,136,3,73,0,34,0,195,0,0,0,3,7,227,2,44,0,0,255,255,0,35,255,244,2,136,3,69,0,34,0,195,0,0,1,7,7,199,2,20,0,175,0,8,177,1,1,176,175,176,51,43,0,0,255,255,0,35,255,244,2,136,3,70,0,34,0,195,0,0,0,3,7,230,2,34,0,0,255,255,0,35,255,244,2,136,3,78,0,34,0,195,0,0,0,3,7,229,2,34,0,0,255,255,0,35,255,244,2,136,3,59,0,34,0,195,0,0,1,7,7,240,1,201,255,246,0,9,177,1,2,184,255,246,176,51,43,0,255,255,0,35,255,244,2,136,3,40,0,34,0,195,0,0,0,3,7,221,2,34,0,0,255,255,0,35,255,244,2,136,3,188,0,34,0,195,0,0,1,7,7,188,2,30,0,145,0,8,177,1,3,176,145,176,51,43,0,0,255,255,0,35,255,244,2,136,3,161,0,34,0,195,0,0,1,7,7,189,2,30,0,145,0,8,177,1,3,176,145,176,51,43,0,0,255,255,0,35,255,244,2,136,3,188,0,34,0,195,0,0,1,7,7,187,2,30,0,145,0,8,177,1,3,176,145,176,51,43,0,0,255,255,0,35,255,244,2,136,3,110,0,34,0,195,0,0,1,7,7,190,2,30,0,145,0,8,177,1,3,176,145,176,51,43,0,0,255,255,0,35,255,64,2,136,2,134,0,34,0,195,0,0,0,3,7,213,2,29,0,0,255,255,0,35,255,244,2,136,3,73,0,34,0,195,0,0,0,3,7,226,2,31,0,0,255,255,0,35,255,244,2,136,3,108,0,34,0,195,0,0,1,7,7,208,2,40,0,125,0,8,177,1,1,176,125,176,51,43,0,0,0,1,0,35,255,244,2,168,2,251,0,64,0,105,64,16,48,17,2,1,5,39,10,2,0,1,31,1,2,0,3,74,75,176,23,80,88,64,29,0,5,5,100,75,3,1,0,0,1,95,4,1,1,1,98,75,0,2,2,6,95,7,1,6,6,105,6,76,27,64,29,0,5,1,5,131,3,1,0,0,1,95,4,1,1,1,98,75,0,2,2,6,95,7,1,6,6,105,6,76,89,64,15,0,0,0,64,0,63,38,53,40,41,53,37,8,12,26,43,22,38,53,17,52,38,35,34,6,35,39,55,22,22,51,50,54,55,7,6,6,7,3,20,22,51,50,54,53,38,38,39,46,2,35,34,6,35,39,55,22,22,51,50,53,52,38,39,55,54,51,50,22,21,20,7,14,2,21,17,20,6,35,222,114,15,22,10,20,4,2,7,12,67,34,27,68,10,4,37,25,2,8,86,81,82,86,1,4,1,2,6,14,15,12,26,5,2,7,12,71,41,41,17,15,2,34,22,23,28,52,5,33,15,130,118,12,115,106,1,75,32,22,2,4,44,1,2,7,2,45,5,23,29,254,218,99,106,87,82,80,205,41,25,21,8,2,4,44,1,2,36,13,27,10,14,26,31,27,69,27,2,16,26,21,254,176,105,115,255,255,0,35,255,244,2,168,3,73,0,34,0,209,0,0,0,3,7,227,2,44,0,0,255,255,0,35,255,64,2,168,2,251,0,34,0,209,0,0,0,3,7,213,2,29,0,0,255,255,0,35,255,244,2,168,3,73,0,34,0,209,0,0,0,3,7,226,2,31,0,0,255,255,0,35,255,244,2,168,3,148,0,34,0,209,0,0,1,7,7,208,2,36,0,165,0,8,177,1,1,176,165,176,51,43,0,0,255,255,0,35,255,244,2,168,3,99,0,34,0,209,0,0,1,7,8,9,0,132,0,175,0,8,177,1,1,176,175,176,51,43,0,0,255,255,0,35,255,244,2,136,3,59,0,34,0,195,0,0,1,7,7,228,2,27,255,246,0,9,177,1,2,184,255,246,176,51,43,0,255,255,0,35,255,244,2,136,3,79,0,34,0,195,0,0,1,7,7,210,2,7,0,185,0,8,177,1,1,176,185,176,51,43,0,0,255,255,0,35,255,244,2,136,3,10,0,34,0,195,0,0,0,3,7,237,2,33,0,0,255,255,0,35,255,244,2,136,3,148,0,34,0,195,0,0,0,35,7,237,2,27,0,0,1,7,7,221,2,28,0,108,0,8,177,2,2,176,108,176,51,43,0,0,0,1,0,35,255,15,2,136,2,134,0,76,0,78,64,75,45,18,2,1,2,37,1,3,1,5,1,0,3,72,1,6,0,4,74,52,25,2,2,72,4,1,1,1,2,95,5,1,2,2,98,75,0,3,3,0,95,0,0,0,105,75,0,6,6,7,95,8,1,7,7,109,7,76,0,0,0,76,0,76,68,66,53,38,41,53,37,38,9,12,26,43,4,38,53,52,54,55,6,35,34,38,53,17,52,38,35,34,6,35,39,55,22,22,51,50,54,55,7,6,6,7,3,20,22,51,50,54,53,3,46,2,35,34,6,35,39,55,22,22,51,50,54,55,7,14,2,21,17,20,7,14,2,21,20,22,51,50,54,54,55,23,14,2,7,1,131,60,43,51,42,52,105,114,15,22,10,20,4,2,7,12,67,34,27,68,10,4,37,25,2,8,86,81,82,86,6,2,6,14,15,12,26,5,2,7,12,67,34,27,61,9,4,31,28,10,66,50,50,19,32,26,17,35,22,3,13,4,29,44,23,241,51,43,28,67,52,12,115,106,1,75,32,22,2,4,44,1,2,7,2,45,5,23,29,254,218,99,106,87,82,1,70,25,21,8,2,4,44,1,2,7,2,45,5,11,20,21,254,176,100,66,49,57,42,22,24,30,10,11,2,19,4,23,28,8,255,255,0,35,255,244,2,136,3,70,0,34,0,195,0,0,0,3,7,232,2,34,0,0,255,255,0,35,255,244,2,136,3,99,0,34,0,195,0,0,1,7,8,9,0,132,0,175,0,8,177,1,1,176,175,176,51,43,0,0,255,255,0,35,255,244,2,136,3,194,0,34,0,195,0,0,0,39,7,201,2,27,0,140,1,135,7,227,1,207,0,118,63,233,252,167,3,89,63,233,0,16,177,1,1,176,140,176,51,43,177,2,1,176,118,176,51,43,0,0,0,1,255,247,255,239,2,99,2,136,0,42,0,40,64,37,36,13,2,1,72,42,1,2,71,0,2,0,2,132,5,3,2,0,0,1,95,4,1,1,1,98,0,76,18,67,36,26,66,20,6,12,26,43,54,2,39,38,38,39,39,55,50,22,51,50,54,55,23,7,6,6,21,20,18,23,51,18,53,52,38,35,35,39,55,22,22,51,50,54,55,7,6,6,7,3,7,243,105,53,9,44,39,2,7,13,71,32,33,101,16,3,4,54,35,106,20,9,166,32,37,52,2,6,13,89,41,37,63,10,8,31,24,11,215,64,33,1,84,163,29,27,1,4,43,3,9,2,7,39,4,16,22,20,254,137,68,1,172,32,21,19,4,43,1,6,2,1,47,1,18,29,253,228,22,0,0,1,255,249,255,239,3,163,2,136,0,74,0,49,64,46,62,36,13,3,1,72,74,71,68,44,24,22,6,0,71,6,4,2,3,0,0,1,93,5,3,2,1,1,98,0,76,64,63,61,57,54,52,34,30,28,27,66,20,7,12,22,43,54,2,39,38,38,39,39,55,50,22,51,50,54,55,23,7,6,6,21,20,22,22,23,51,19,39,38,38,39,39,55,50,22,51,50,54,55,23,7,6,6,21,20,18,23,51,54,54,55,18,53,52,38,35,35,39,55,22,22,51,50,54,55,7,6,6,7,3,7,38,38,39,35,3,7,237,101,52,9,44,37,1,6,13,68,32,44,88,13,3,4,51,35,55,59,9,6,141,18,10,42,38,2,7,13,68,32,38,93,14,3,4,52,35,104,20,6,2,5,3,152,32,36,50,2,7,13,86,40,36,60,10,7,30,24,10,210,62,10,73,42,6,142,64,33,1,84,163,29,27,1,4,43,3,9,2,7,39,4,16,21,17,207,208,32,1,128,55,29,26,2,4,43,3,9,2,7,39,4,16,22,21,254,138,68,6,13,9,1,152,29,19,16,4,43,1,6,2,1,47,2,17,29,253,228,22,35,252,137,254,110,22,0,255,255,255,249,255,239,3,163,3,73,0,34,0,224,0,0,0,3,7,227,2,163,0,0,255,255,255,249,255,239,3,163,3,78,0,34,0,224,0,0,0,3,7,229,2,153,0,0,255,255,255,249,255,239,3,163,3,40,0,34,0,224,0,0,0,3,7,221,2,153,0,0,255,255,255,249,255,239,3,163,3,73,0,34,0,224,0,0,0,3,7,226,2,150,0,0,0,1,0,12,255,248,2,139,2,133,0,81,0,58,64,55,69,55,48,28,7,5,0,3,0,1,2,0,2,74,63,57,40,3,3,72,22,16,2,2,71,4,1,3,3,98,75,1,1,0,0,2,95,5,1,2,2,99,2,76,81,76,62,59,77,52,27,17,6,12,24,43,5,55,54,54,53,52,39,39,7,6,6,21,20,22,23,23,7,38,38,35,34,6,7,39,55,54,54,55,55,39,38,38,39,39,55,50,22,51,50,54,55,23,7,6,6,21,20,22,23,55,54,54,53,52,38,39,39,55,22,22,51,50,54,55,23,7,6,6,7,7,23,22,22,23,23,7,38,38,35,34,6,7,1,106,4,41,37,20,109,92,31,20,28,30,2,7,12,75,23,24,65,10,4,7,41,70,51,110,131,25,66,46,2,6,16,86,42,49,76,10,3,3,42,36,55,58,38,43,50,27,31,2,6,12,75,23,24,63,10,4,6,43,48,45,121,146,27,63,47,2,7,13,72,39,35,104,16,1,39,2,16,17,15,29,164,122,41,34,14,13,15,2,4,43,1,6,3,1,7,41,12,63,63,136,196,37,40,6,4,39,3,7,1,7,35,3,17,16,11,91,88,51,56,73,14,13,14,3,4,39,1,6,3,1,7,37,9,39,56,153,213,40,39,4,4,43,1,2,7,1,0,0,0,1,255,237,255,244,2,46,2,133,0,71,0,61,64,58,30,1,3,1,64,1,4,3,2,74,44,38,21,3,0,72,71,1,4,71,0,1,0,3,0,1,3,126,2,1,0,0,98,75,0,3,3,4,95,0,4,4,99,4,76,69,66,61,59,43,40,36,35,19,16,5,12,20,43,55,62,2,53,53,52,38,39,39,46,2,39,39,55,22,22,51,50,54,55,23,7,6,6,21,20,22,22,23,51,55,54,53,52,39,39,55,22,22,51,50,54,55,23,7,14,2,7,6,7,7,6,6,7,21,6,22,51,50,54,55,23,7,38,38,35,34,6,7,150,36,32,10,12,17,90,26,22,40,38,2,6,11,62,37,35,93,14,3,3,45,31,50,53,9,5,114,16,63,2,6,12,76,23,24,59,9,4,6,32,36,27,26,6,4,100,13,7,2,1,19,26,16,28,5,2,9,14,75,38,31,72,11,34,7,22,38,41,44,31,47,35,183,53,37,22,3,4,39,1,2,7,1,7,35,4,15,17,13,116,112,17,212,29,21,26,4,4,39,1,6,3,1,7,37,6,21,39,46,12,6,176,23,58,76,22,39,29,2,1,4,46,1,2,10,2,0,255,255,255,237,255,244,2,46,3,73,0,34,0,230,0,0,0,3,7,227,1,238,0,0,255,255,255,237,255,244,2,46,3,78,0,34,0,230,0,0,0,3,7,229,1,228,0,0,255,255,255,237,255,244,2,46,3,40,0,34,0,230,0,0,0,3,7,221,1,228,0,0,255,255,255,237,255,244,2,46,3,51,0,34,0,230,0,0,0,3,7,224,1,222,0,0,255,255,255,237,255,64,2,46,2,133,0,34,0,230,0,0,0,3,7,213,1,205,0,0,255,255,255,237,255,244,2,46,3,73,0,34,0,230,0,0,0,3,7,226,1,225,0,0,255,255,255,237,255,244,2,46,3,108,0,34,0,230,0,0,1,7,7,208,1,238,0,125,0,8,177,1,1,176,125,176,51,43,0,0,255,255,255,237,255,244,2,46,3,10,0,34,0,230,0,0,0,3,7,237,1,221,0,0,255,255,255,237,255,244,2,46,3,52,0,34,0,230,0,0,0,3,7,233,1,238,0,0,0,1,0,34,255,253,2,12,2,137,0,29,0,50,64,47,22,7,2,2,0,26,1,3,2,2,74,11,1,1,72,29,1,3,71,0,0,0,1,93,0,1,1,98,75,0,2,2,3,93,0,3,3,99,3,76,24,35,41,33,4,12,24,43,55,1,7,14,2,7,7,62,2,55,55,23,5,23,6,3,55,54,54,55,55,14,2,7,7,37,7,34,1,117,173,47,54,28,6,47,1,8,8,1,10,175,1,2,11,191,195,203,52,64,16,47,2,9,12,2,15,254,150,70,29,2,52,6,2,27,58,51,4,8,55,91,41,9,11,7,29,254,254,204,7,1,80,85,5,9,57,96,43,16,6,6,255,255,0,34,255,253,2,12,3,73,0,34,0,240,0,0,0,3,7,227,1,245,0,0,255,255,0,34,255,253,2,12,3,70,0,34,0,240,0,0,0,3,7,230,1,235,0,0,255,255,0,34,255,253,2,12,3,51,0,34,0,240,0,0,0,3,7,224,1,235,0,0,255,255,0,34,255,64,2,12,2,137,0,34,0,240,0,0,0,3,7,213,1,253,0,0,255,255,0,56,255,112,2,149,3,83,0,34,0,83,0,0,0,35,7,227,1,106,0,0,0,35,0,100,1,105,0,0,1,7,7,227,2,198,0,10,0,8,177,3,1,176,10,176,51,43,0,0,255,255,0,57,255,244,3,228,2,137,0,34,0,174,0,0,0,3,0,174,2,18,0,0,0,1,255,236,0,0,2,179,2,135,0,40,0,52,64,49,40,17,2,1,0,1,74,0,0,5,1,5,0,112,7,1,5,5,6,93,0,6,6,56,75,4,2,2,1,1,3,93,0,3,3,59,3,76,17,17,22,17,17,38,38,36,8,9,28,43,1,54,54,53,52,35,34,6,6,21,20,22,22,51,50,54,55,55,6,6,7,7,51,21,33,53,51,38,38,53,52,54,55,33,53,33,21,35,6,6,7,2,3,1,2,147,66,100,54,57,104,68,68,83,19,48,3,20,4,1,121,253,57,206,60,65,100,86,254,245,2,199,105,1,18,4,1,192,5,27,17,93,64,117,79,87,132,73,77,81,4,15,103,45,2,35,35,39,135,88,106,166,43,35,35,4,90,66,0,0,0,2,255,236,0,0,2,229,2,135,0,23,0,38,0,51,64,48,29,1,1,6,1,74,0,6,0,1,0,6,112,4,1,0,0,5,93,0,5,5,56,75,7,3,2,1,1,2,93,0,2,2,59,2,76,39,34,17,38,33,17,22,16,8,9,28,43,1,35,22,22,21,20,6,7,51,21,33,53,51,50,54,53,19,52,38,38,35,35,53,33,6,38,35,34,6,7,2,21,20,22,22,51,50,54,53,2,229,254,82,94,93,78,249,253,7,84,45,33,1,7,26,30,100,2,249,169,159,148,21,14,1,15,21,53,52,108,124,2,100,35,142,93,98,163,46,35,35,41,44,1,164,32,28,12,35,197,142,9,13,254,127,54,38,38,16,149,130,0,1,255,236,0,0,1,132,2,135,0,25,0,41,64,38,6,5,2,3,3,4,93,0,4,4,56,75,2,1,0,0,1,93,0,1,1,59,1,76,0,0,0,25,0,24,17,37,33,17,39,7,9,25,43,18,7,6,2,21,20,22,22,51,51,21,33,53,51,50,54,53,19,52,38,35,35,53,33,21,35,232,3,6,8,14,35,35,89,254,104,82,44,38,1,34,44,87,1,152,68,2,100,68,111,254,255,64,32,32,13,35,35,39,46,1,164,41,31,35,35,0,0,0,0,1,255,236,0,0,2,49,2,135,0,37,0,93,182,17,3,2,0,4,1,74,75,176,10,80,88,64,25,7,6,2,4,4,5,93,0,5,5,56,75,3,1,2,0,0,2,93,0,2,2,59,2,76,27,64,31,0,0,4,1,1,0,112,7,6,2,4,4,5,93,0,5,5,56,75,3,1,1,1,2,94,0,2,2,59,2,76,89,64,15,0,0,0,37,0,36,17,37,33,17,23,43,8,9,26,43,0,6,6,7,20,7,6,6,21,20,22,22,51,50,54,54,55,55,23,6,7,51,21,33,53,51,50,54,53,19,52,38,35,35,53,33,21,33,1,5,26,7,3,1,5,7,12,33,40,61,57,29,12,44,3,12,13,83,253,187,90,37,33,1,28,38,95,2,69,254,241,2,100,18,31,34,14,7,73,217,96,36,31,10,20,58,64,5,5,57,95,35,35,40,45,1,164,42,30,35,35,0,4,255,236,0,0,3,106,2,135,0,26,0,33,0,39,0,48,0,68,64,65,44,37,30,3,0,3,1,74,10,6,9,5,4,3,3,4,93,0,4,4,56,75,11,8,7,2,4,0,0,1,93,0,1,1,59,1,76,41,40,27,27,0,0,40,48,41,48,36,34,27,33,27,33,0,26,0,25,17,38,33,17,39,12,9,25,43,0,6,21,20,18,23,22,22,51,51,21,33,53,51,50,54,55,18,53,52,38,35,35,53,33,21,35,33,22,18,23,51,18,55,0,51,51,3,35,3,5,50,53,52,3,35,6,7,7,2,225,39,18,8,7,30,32,81,252,130,63,37,36,4,44,36,41,107,3,126,97,254,4,34,90,35,5,98,66,254,80,45,173,173,5,37,1,165,69,34,5,58,30,88,2,100,32,33,24,254,229,101,58,46,35,35,37,43,1,154,29,31,27,35,35,110,254,248,93,1,13,198,253,191,1,229,254,58,31,53,32,1,144,162,80,243,0,2,255,236,0,0,2,163,2,135,0,16,0,29,0,97,75,176,21,80,88,64,32,0,7,3,0,0,7,112,6,8,5,3,3,3,4,93,0,4,4,56,75,2,1,0,0,1,94,0,1,1,59,1,76,27,64,33,0,7,3,0,3,7,0,126,6,8,5,3,3,3,4,93,0,4,4,56,75,2,1,0,0,1,94,0,1,1,59,1,76,89,64,18,0,0,29,28,24,21,0,16,0,15,17,34,17,17,19,9,9,25,43,0,6,7,3,33,21,33,53,33,3,38,35,35,53,33,21,35,2,18,53,52,38,35,35,34,6,21,20,19,51,2,106,39,12,207,1,59,253,73,1,32,160,21,68,39,2,183,27,235,93,33,41,143,52,38,127,9,2,100,27,30,253,248,35,35,1,255,66,35,35,254,198,1,5,18,19,16,17,22,42,254,78,0,0,3,255,236,0,0,2,218,2,135,0,26,0,38,0,51,0,55,64,52,38,17,3,3,0,3,1,74,6,8,5,3,3,3,4,93,0,4,4,56,75,7,2,2,0,0,1,93,0,1,1,59,1,76,0,0,48,45,33,30,0,26,0,25,17,39,33,17,38,9,9,25,43,0,6,7,7,23,22,22,51,51,21,33,53,51,50,54,63,2,39,38,38,35,35,53,33,21,35,6,54,53,52,35,35,34,6,21,20,22,23,7,7,6,6,21,20,22,51,51,50,53,52,39,2,126,75,51,121,146,33,64,40,56,253,18,64,32,56,42,32,110,131,35,72,50,48,2,238,52,241,60,58,108,40,38,46,67,26,92,35,19,33,28,136,81,23,2,100,54,65,153,213,49,43,35,35,52,55,40,136,196,51,47,35,35,141,95,18,28,16,19,16,83,101,96,122,47,32,12,15,18,35,13,34,0,0,0,0,2,0,41,255,244,1,203,1,208,0,41,0,51,0,132,64,13,45,44,38,37,21,19,12,1,8,3,1,1,74,75,176,10,80,88,64,25,0,1,1,2,95,0,2,2,107,75,7,5,2,3,3,0,95,6,4,2,0,0,105,0,76,27,75,176,12,80,88,64,25,0,1,1,2,95,0,2,2,107,75,7,5,2,3,3,0,95,6,4,2,0,0,99,0,76,27,64,25,0,1,1,2,95,0,2,2,107,75,7,5,2,3,3,0,95,6,4,2,0,0,105,0,76,89,89,64,19,42,42,0,0,42,51,42,50,0,41,0,41,40,38,41,36,8,12,24,43,4,39,39,6,6,35,34,38,53,52,54,63,2,52,38,35,34,6,7,39,39,54,54,51,50,22,21,20,7,6,21,20,22,51,50,54,55,23,6,6,7,38,54,55,55,7,6,21,20,22,51,1,35,8,4,36,59,15,56,72,29,24,190,1,46,42,28,62,30,5,12,47,95,21,65,74,7,11,22,19,16,34,10,14,15,47,25,167,51,21,5,136,29,39,30,12,81,1,36,42,70,54,29,44,7,52,44,50,56,26,24,3,43,27,43,68,61,22,68,110,30,22,24,15,10,16,25,47,8,72,27,21,102,41,9,33,29,38,0,0,255,255,0,41,255,244,1,203,2,203,0,34,0,254,0,0,0,3,7,194,1,162,0,0,255,255,0,41,255,244,1,203,2,150,0,34,0,254,0,0,0,3,7,199,1,163,0,0,255,255,0,41,255,244,1,203,2,229,0,34,0,254,0,0,1,7,8,43,1,179,255,201,0,9,177,2,2,184,255,201,176,51,43,0,255,255,0,41,255,64,1,203,2,150,0,34,0,254,0,0,0,35,7,199,1,163,0,0,0,3,7,213,1,146,0,0,255,255,0,41,255,244,1,203,2,229,0,34,0,254,0,0,1,7,8,44,1,179,255,201,0,9,177,2,2,184,255,201,176,51,43,0,255,255,0,41,255,244,1,203,2,253,0,34,0,254,0,0,1,7,8,45,1,179,255,201,0,9,177,2,2,184,255,201,176,51,43,0,255,255,0,41,255,244,1,203,2,216,0,34,0,254,0,0,1,7,8,46,1,179,255,201,0,9,177,2,2,184,255,201,176,51,43,0,255,255,0,41,255,244,1,203,2,198,0,34,0,254,0,0,0,3,7,198,1,162,0,0,255,255,0,41,255,244,1,203,2,191,0,34,0,254,0,0,0,3,7,197,1,161,0,0,255,255,0,41,255,244,1,203,2,229,0,34,0,254,0,0,1,7,8,47,1,159,255,221,0,9,177,2,2,184,255,221,176,51,43,0,255,255,0,41,255,64,1,203,2,191,0,34,0,254,0,0,0,35,7,197,1,161,0,0,0,3,7,213,1,146,0,0,255,255,0,41,255,244,1,203,2,222,0,34,0,254,0,0,1,7,8,48,1,159,255,221,0,9,177,2,2,184,255,221,176,51,43,0,255,255,0,41,255,244,1,203,2,242,0,34,0,254,0,0,1,7,8,49,1,159,255,221,0,9,177,2,2,184,255,221,176,51,43,0,255,255,0,41,255,244,1,203,2,232,0,34,0,254,0,0,1,7,8,50,1,159,255,221,0,9,177,2,2,184,255,221,176,51,43,0,255,255,0,41,255,244,1,203,2,193,0,34,0,254,0,0,0,3,7,209,1,127,0,0,255,255,0,41,255,244,1,203,2,127,0,34,0,254,0,0,0,3,7,186,1,160,0,0,255,255,0,41,255,64,1,203,1,208,0,34,0,254,0,0,0,3,7,213,1,146,0,0,255,255,0,41,255,244,1,203,2,202,0,34,0,254,0,0,0,3,7,193,1,163,0,0,255,255,0,41,255,244,1,203,2,239,0,34,0,254,0,0,0,3,7,208,1,162,0,0,255,255,0,41,255,244,1,203,2,150,0,34,0,254,0,0,0,3,7,210,1,139,0,0,255,255,0,41,255,244,1,203,2,121,0,34,0,254,0,0,0,3,7,205,1,160,0,0,0,2,0,41,255,15,1,217,1,208,0,64,0,74,0,165,64,18,68,67,49,38,36,29,19,8,8,3,1,60,5,2,4,0,2,74,75,176,10,80,88,64,34,0,1,1,2,95,0,2,2,107,75,8,6,2,3,3,0,95,0,0,0,105,75,0,4,4,5,96,7,1,5,5,109,5,76,27,75,176,12,80,88,64,34,0,1,1,2,95,0,2,2,107,75,8,6,2,3,3,0,95,0,0,0,99,75,0,4,4,5,96,7,1,5,5,109,5,76,27,64,34,0,1,1,2,95,0,2,2,107,75,8,6,2,3,3,0,95,0,0,0,105,75,0,4,4,5,96,7,1,5,5,109,5,76,89,89,64,20,65,65,0,0,65,74,65,73,0,64,0,64,41,41,40,41,43,9,12,25,43,4,38,53,52,54,55,38,38,39,39,6,6,35,34,38,53,52,54,63,2,52,38,35,34,6,6,21,39,39,62,2,51,50,22,21,20,7,6,6,21,20,22,51,50,54,54,55,23,6,6,21,20,22,51,50,54,54,55,23,14,2,7,2,54,55,55,7,6,21,20,22,51,1,66,60,39,46,29,33,2,4,36,59,15,56,72,29,24,189,2,46,42,29,53,38,5,12,9,62,73,19,59,80,8,2,8,22,19,14,27,17,2,16,79,57,32,26,17,35,22,3,13,4,29,44,23,168,51,21,4,135,29,39,30,241,51,43,27,63,48,4,41,33,1,36,42,70,54,29,44,7,52,44,50,56,22,27,1,3,43,5,34,31,63,66,7,86,30,93,14,22,24,11,12,2,19,83,81,29,24,30,10,11,2,19,4,23,28,8,1,45,27,21,102,41,11,31,29,38,255,255,0,41,255,244,1,203,2,196,0,34,0,254,0,0,0,3,7,200,1,161,0,0,255,255,0,41,255,244,1,203,2,239,0,34,0,254,0,0,0,47,7,232,1,159,255,126,57,170,1,15,7,227,1,132,255,250,57,153,0,18,177,2,2,184,255,126,176,51,43,177,4,1,184,255,250,176,51,43,255,255,0,41,255,244,1,203,2,180,0,34,0,254,0,0,0,2,8,9,18,0,0,0,0,3,0,30,255,244,2,121,1,208,0,52,0,62,0,73,0,144,64,16,66,64,61,48,47,39,34,28,22,12,2,11,4,1,1,74,75,176,10,80,88,64,27,6,1,1,1,2,95,3,1,2,2,107,75,9,7,2,4,4,0,95,8,5,2,0,0,105,0,76,27,75,176,12,80,88,64,27,6,1,1,1,2,95,3,1,2,2,107,75,9,7,2,4,4,0,95,8,5,2,0,0,99,0,76,27,64,27,6,1,1,1,2,95,3,1,2,2,107,75,9,7,2,4,4,0,95,8,5,2,0,0,105,0,76,89,89,64,22,63,63,0,0,63,73,63,72,59,57,0,52,0,51,41,35,40,41,21,10,12,25,43,4,38,39,6,6,7,34,38,53,52,54,63,2,52,38,35,34,6,6,21,39,39,62,2,51,50,23,54,54,51,50,22,21,20,6,21,7,5,22,22,51,50,54,54,55,23,23,14,2,35,19,54,53,52,38,35,34,6,21,21,6,55,38,53,7,6,6,21,20,22,51,1,161,96,24,39,74,26,56,72,29,24,191,1,44,42,29,55,39,5,12,9,63,72,19,98,26,29,80,43,64,73,2,9,254,242,5,83,61,27,54,37,5,6,11,7,51,68,27,38,20,42,31,55,67,131,73,12,138,16,16,40,27,12,56,51,42,54,7,70,54,29,43,7,52,50,50,54,24,28,1,3,43,5,34,31,80,38,42,75,67,7,10,2,14,64,77,96,16,16,3,2,29,5,33,30,1,68,6,12,33,45,77,62,7,205,68,38,47,41,4,23,15,28,42,0,0,0,255,255,0,30,255,244,2,121,2,203,0,34,1,24,0,0,0,3,7,194,2,40,0,0,0,2,0,23,255,244,1,216,2,230,0,29,0,43,0,68,64,65,40,39,18,3,4,3,3,1,2,4,2,74,15,14,11,3,0,72,0,0,1,0,131,0,3,3,1,95,0,1,1,107,75,6,1,4,4,2,95,5,1,2,2,105,2,76,30,30,0,0,30,43,30,42,37,35,0,29,0,28,46,21,7,12,22,43,22,38,53,39,17,52,35,34,6,7,39,55,54,54,55,23,6,6,7,54,54,51,50,22,22,21,20,6,6,35,54,54,53,52,38,38,35,34,6,7,3,22,22,51,181,87,9,37,8,12,2,3,4,43,92,13,6,7,12,4,45,65,11,56,88,49,67,114,68,95,77,35,61,36,20,62,25,3,18,56,24,12,11,1,8,2,106,54,2,1,3,33,6,20,3,13,10,183,142,32,38,54,97,63,72,120,70,55,91,79,50,84,49,31,23,254,234,9,12,0,0,1,0,36,255,244,1,131,1,208,0,36,0,54,64,51,11,1,1,0,31,16,15,3,2,1,2,74,32,1,2,1,73,0,1,1,0,95,0,0,0,107,75,0,2,2,3,95,4,1,3,3,105,3,76,0,0,0,36,0,35,36,44,37,5,12,23,43,22,38,53,52,54,54,51,50,22,22,23,23,14,2,7,7,53,52,38,35,34,6,21,20,22,51,50,54,54,55,23,23,14,2,35,150,114,61,105,65,28,52,33,4,3,1,9,10,1,41,45,37,61,66,73,63,25,50,34,4,6,11,7,47,61,22,12,120,101,71,117,67,8,9,2,7,5,37,61,35,3,31,37,45,87,80,87,101,15,15,3,2,31,5,32,30,255,255,0,36,255,244,1,131,2,203,0,34,1,27,0,0,0,3,7,194,1,188,0,0,255,255,0,36,255,244,1,141,2,198,0,34,1,27,0,0,0,3,7,198,1,188,0,0,255,255,0,36,255,23,1,131,1,208,0,34,1,27,0,0,0,3,7,216,1,181,0,0,255,255,0,36,255,23,1,131,2,203,0,34,1,27,0,0,0,35,7,216,1,206,0,0,0,3,7,194,1,174,0,0,255,255,0,36,255,244,1,155,2,190,0,34,1,27,0,0,1,7,7,197,1,209,255,255,0,9,177,1,1,184,255,255,176,51,43,0,255,255,0,36,255,244,1,131,2,180,0,34,1,27,0,0,0,3,7,191,1,187,0,0,0,2,0,36,255,244,2,25,2,230,0,40,0,56,0,73,64,70,14,1,5,1,45,44,36,2,4,3,5,2,74,25,24,21,3,2,72,0,2,1,2,131,0,5,5,1,95,0,1,1,107,75,8,6,2,3,3,0,95,7,4,2,0,0,105,0,76,41,41,0,0,41,56,41,55,50,48,0,40,0,40,45,19,38,35,9,12,24,43,4,39,39,6,35,34,38,38,53,52,54,54,51,50,23,53,52,35,34,6,7,55,54,54,55,23,6,2,21,20,22,51,50,54,54,55,23,14,2,7,38,54,54,55,17,46,2,35,34,6,21,20,22,22,51,1,116,11,7,104,21,57,88,48,67,115,67,32,37,37,7,16,2,4,43,92,13,6,11,17,22,19,14,27,17,2,14,3,24,39,21,184,49,34,5,3,24,43,27,67,77,35,61,36,12,71,3,71,53,96,62,71,120,71,4,166,54,3,1,37,6,20,3,13,17,254,124,219,22,24,11,12,2,16,5,33,36,6,68,24,25,4,1,18,2,11,10,91,79,50,82,48,0,0,0,0,2,0,43,255,244,1,209,2,229,0,35,0,49,0,57,64,54,28,27,25,24,22,20,18,17,15,14,10,0,72,0,2,2,0,95,0,0,0,101,75,5,1,3,3,1,95,4,1,1,1,105,1,76,36,36,0,0,36,49,36,48,43,41,0,35,0,34,38,6,12,21,43,22,38,38,53,52,54,54,51,50,22,22,23,55,38,39,7,39,39,55,38,39,55,55,22,23,55,23,23,7,22,22,21,20,6,6,35,54,54,53,52,39,38,35,34,6,21,20,22,22,51,185,91,51,60,103,60,14,33,24,3,2,36,59,133,9,4,118,70,96,15,10,111,83,138,8,4,121,80,84,59,101,62,80,60,18,44,71,59,68,38,67,43,12,55,99,64,67,113,67,12,12,2,2,82,61,64,3,30,58,60,45,33,4,48,68,67,5,29,59,75,182,100,70,117,67,49,91,78,82,70,41,87,77,58,90,50,0,0,0,0,3,0,36,255,244,2,59,2,230,0,40,0,52,0,68,0,78,64,75,41,1,1,2,14,1,5,1,57,56,36,2,4,3,5,3,74,47,25,24,21,4,2,72,0,2,1,2,131,0,5,5,1,95,0,1,1,107,75,8,6,2,3,3,0,95,7,4,2,0,0,105,0,76,53,53,0,0,53,68,53,67,62,60,0,40,0,40,45,19,38,35,9,12,24,43,4,39,39,6,35,34,38,38,53,52,54,54,51,50,23,53,52,35,34,6,7,55,54,54,55,23,6,2,21,20,22,51,50,54,54,55,23,14,2,7,19,54,53,52,38,39,55,23,6,6,7,7,2,54,54,55,17,46,2,35,34,6,21,20,22,22,51,1,116,11,7,104,21,57,88,48,67,115,67,32,37,37,7,16,2,4,43,92,13,6,11,17,22,19,14,27,17,2,14,3,24,39,21,50,1,6,1,70,7,2,20,13,25,245,49,34,5,3,24,43,27,67,77,35,61,36,12,71,3,71,53,96,62,71,120,71,4,166,54,3,1,37,6,20,3,13,17,254,124,219,22,24,11,12,2,16,5,33,36,6,1,233,18,36,56,95,13,14,8,19,129,64,14,254,93,24,25,4,1,18,2,11,10,91,79,50,82,48,0,2,0,36,255,244,2,25,2,230,0,50,0,66,0,80,64,77,39,22,2,3,4,19,1,9,2,66,51,7,3,8,9,3,74,35,34,31,3,5,72,0,5,4,5,131,6,1,4,7,1,3,2,4,3,101,0,9,9,2,95,0,2,2,107,75,10,1,8,8,0,95,1,1,0,0,105,0,76,63,61,56,54,36,18,26,18,18,18,38,35,20,11,12,29,43,37,14,2,7,34,39,39,6,35,34,38,38,53,52,54,54,51,50,23,53,7,39,55,23,53,52,35,34,6,7,55,54,54,55,23,6,7,55,23,7,7,6,21,20,22,51,50,54,54,55,3,46,2,35,34,6,21,20,22,22,51,50,54,54,55,2,25,3,24,39,21,78,11,7,104,21,57,88,48,67,115,67,32,37,114,9,7,116,37,7,16,2,4,43,92,13,6,8,8,79,13,4,90,10,22,19,14,27,17,2,169,3,24,43,27,67,77,35,61,36,21,49,34,5,68,5,33,36,6,71,3,71,53,96,62,71,120,71,4,76,1,9,39,1,44,54,3,1,37,6,20,3,13,12,134,4,13,37,1,197,234,22,24,11,12,2,1,43,2,11,10,91,79,50,82,48,24,25,4,0,255,255,0,36,255,64,2,25,2,230,0,34,1,34,0,0,0,3,7,213,1,204,0,0,255,255,0,36,255,93,2,25,2,230,0,34,1,34,0,0,0,3,7,219,1,206,0,0,255,255,0,36,255,244,3,185,2,230,0,34,1,34,0,0,0,35,1,236,2,25,0,0,0,3,7,198,3,204,0,0,0,2,0,36,255,244,1,150,1,208,0,24,0,34,0,65,64,62,19,1,2,1,1,74,21,1,2,1,73,7,1,5,0,1,2,5,1,101,0,4,4,0,95,0,0,0,107,75,0,2,2,3,95,6,1,3,3,105,3,76,25,25,0,0,25,34,25,34,32,30,0,24,0,23,34,21,38,8,12,23,43,22,38,38,53,52,54,54,51,50,22,21,20,7,7,33,6,22,51,50,55,23,23,6,6,35,19,54,54,53,52,38,35,34,6,7,184,96,52,61,102,58,73,76,6,13,254,236,1,79,71,56,66,6,11,36,87,30,50,15,10,43,40,47,67,9,12,55,101,65,67,118,70,74,71,29,20,12,97,105,31,2,29,26,42,1,60,2,10,15,40,42,64,54,0,0,255,255,0,36,255,244,1,150,2,203,0,34,1,41,0,0,0,3,7,194,1,186,0,0,255,255,0,36,255,244,1,150,2,150,0,34,1,41,0,0,0,3,7,199,1,199,0,0,255,255,0,36,255,244,1,150,2,198,0,34,1,41,0,0,0,3,7,198,1,186,0,0,255,255,0,36,255,23,1,150,2,150,0,34,1,41,0,0,0,35,7,216,1,219,0,0,0,3,7,199,1,198,0,0,255,255,0,36,255,244,1,150,2,191,0,34,1,41,0,0,0,3,7,197,1,185,0,0,255,255,0,36,255,244,1,172,2,229,0,34,1,41,0,0,1,7,8,47,1,182,255,221,0,9,177,2,2,184,255,221,176,51,43,0,255,255,0,36,255,64,1,150,2,191,0,34,1,41,0,0,0,35,7,197,1,185,0,0,0,3,7,213,1,172,0,0,255,255,0,36,255,244,1,150,2,222,0,34,1,41,0,0,1,7,8,48,1,182,255,221,0,9,177,2,2,184,255,221,176,51,43,0,255,255,0,36,255,244,1,159,2,242,0,34,1,41,0,0,1,7,8,49,1,182,255,221,0,9,177,2,2,184,255,221,176,51,43,0,255,255,0,36,255,244,1,150,2,232,0,34,1,41,0,0,1,7,8,50,1,182,255,221,0,9,177,2,2,184,255,221,176,51,43,0,255,255,0,36,255,244,1,150,2,193,0,34,1,41,0,0,0,3,7,209,1,165,0,0,255,255,0,36,255,244,1,150,2,127,0,34,1,41,0,0,0,3,7,186,1,184,0,0,255,255,0,36,255,244,1,150,2,180,0,34,1,41,0,0,0,3,7,191,1,185,0,0,255,255,0,36,255,64,1,150,1,208,0,34,1,41,0,0,0,3,7,213,1,172,0,0,255,255,0,36,255,244,1,150,2,202,0,34,1,41,0,0,0,3,7,193,1,187,0,0,255,255,0,36,255,244,1,150,2,239,0,34,1,41,0,0,0,3,7,208,1,199,0,0,255,255,0,36,255,244,1,150,2,150,0,34,1,41,0,0,0,3,7,210,1,177,0,0,255,255,0,36,255,244,1,150,2,121,0,34,1,41,0,0,0,3,7,205,1,184,0,0,255,255,0,36,255,244,1,150,2,235,0,34,1,41,0,0,0,39,7,205,1,197,255,196,1,7,7,227,1,157,255,162,0,18,177,2,1,184,255,196,176,51,43,177,3,1,184,255,162,176,51,43,255,255,0,36,255,244,1,150,2,235,0,34,1,41,0,0,0,39,7,205,1,197,255,196,1,7,7,226,1,244,255,162,0,18,177,2,1,184,255,196,176,51,43,177,3,1,184,255,162,176,51,43,0,2,0,36,255,15,1,159,1,208,0,49,0,59,0,79,64,76,10,1,1,4,1,74,38,1,4,1,73,0,5,3,4,3,5,4,126,0,7,0,3,5,7,3,101,9,1,8,8,2,95,0,2,2,107,75,0,4,4,1,95,0,1,1,105,75,0,6,6,0,95,0,0,0,109,0,76,50,50,50,59,50,58,22,39,34,35,22,38,38,20,10,12,28,43,5,14,2,7,34,38,53,52,54,55,6,35,34,38,38,53,52,54,54,51,50,22,21,20,6,7,7,33,21,20,22,51,50,54,54,55,23,23,14,2,21,20,22,51,50,54,54,55,2,6,7,55,54,54,53,52,38,35,1,159,4,29,44,23,50,61,48,48,31,23,62,96,52,61,102,58,73,76,5,1,13,254,236,81,67,28,54,36,5,6,11,55,50,27,32,26,17,35,22,3,211,67,9,181,15,10,43,40,178,4,23,28,8,50,44,32,68,48,13,55,101,65,67,118,70,74,71,16,29,4,12,16,84,102,14,15,2,2,29,54,56,48,26,24,30,10,11,2,2,60,64,54,9,2,10,15,40,42,0,0,0,255,255,0,36,255,244,1,153,2,180,0,34,1,41,0,0,0,2,8,9,55,0,0,0,0,2,0,42,255,244,1,156,1,208,0,24,0,34,0,65,64,62,19,1,1,2,1,74,21,1,2,1,73,0,1,7,1,5,4,1,5,101,0,2,2,3,95,6,1,3,3,107,75,0,4,4,0,95,0,0,0,105,0,76,25,25,0,0,25,34,25,34,32,30,0,24,0,23,34,21,38,8,12,23,43,0,22,22,21,20,6,6,35,34,38,53,52,55,55,33,54,38,35,34,7,39,39,54,54,51,3,6,6,21,20,22,51,50,54,55,1,8,96,52,61,102,58,73,76,6,13,1,20,1,79,71,56,66,6,11,36,87,30,50,15,10,43,40,47,67,9,1,208,55,101,65,67,118,70,74,71,29,20,12,97,105,31,2,29,26,42,254,196,2,10,15,40,42,64,54,0,1,0,41,255,252,1,198,2,230,0,54,0,69,64,66,19,1,2,1,34,23,9,3,3,2,7,1,0,3,47,1,6,5,4,74,54,1,6,71,0,2,2,1,95,0,1,1,100,75,4,1,0,0,3,95,0,3,3,101,75,0,5,5,6,93,0,6,6,99,6,76,83,51,36,35,43,39,21,7,12,27,43,55,54,53,17,38,38,39,39,55,55,53,52,54,54,51,50,22,22,23,23,6,6,7,7,46,2,35,34,6,7,7,50,54,55,23,7,38,38,35,3,20,22,51,50,54,51,23,7,34,38,35,34,6,7,51,57,1,25,37,4,7,60,57,103,70,30,51,29,4,2,3,19,9,11,4,31,51,29,57,56,2,1,52,74,12,3,10,11,71,50,4,25,26,24,31,5,2,7,14,74,36,35,67,10,35,8,51,1,14,24,15,2,6,34,11,4,86,128,68,8,9,2,9,5,37,23,3,3,18,16,91,94,49,2,1,3,53,1,2,254,211,28,27,2,4,43,2,3,1,0,3,0,51,255,14,1,230,1,227,0,52,0,64,0,78,0,79,64,76,2,1,5,4,36,10,2,0,5,78,34,30,27,4,6,0,3,74,50,1,2,72,7,1,5,0,0,6,5,0,103,0,3,3,101,75,0,4,4,2,95,0,2,2,107,75,0,6,6,1,95,0,1,1,109,1,76,53,53,71,69,53,64,53,63,59,57,48,47,45,43,46,39,8,12,22,43,0,7,7,22,21,20,6,6,35,34,39,6,6,21,20,22,23,30,2,21,20,6,6,35,34,38,53,54,54,55,53,38,38,39,54,55,53,38,38,53,52,54,54,51,50,23,22,51,54,55,23,7,6,54,53,52,38,35,34,6,21,20,22,51,6,6,21,20,22,51,50,54,54,53,52,38,38,39,1,200,67,4,40,53,90,54,29,27,23,20,62,66,65,80,58,71,115,61,71,81,14,53,32,52,56,1,39,45,35,39,51,85,50,23,34,25,16,45,93,3,11,178,53,64,51,46,53,64,51,78,32,58,48,38,69,42,30,81,82,1,164,6,5,44,58,48,82,47,8,13,22,11,23,18,8,8,17,44,39,44,82,51,71,62,18,48,24,6,9,50,39,37,27,4,20,67,42,49,83,50,6,5,5,25,4,56,249,58,51,58,72,60,51,57,71,216,51,25,34,41,27,46,26,20,24,18,11,255,255,0,51,255,14,1,230,2,150,0,34,1,66,0,0,0,3,7,199,1,200,0,0,255,255,0,51,255,14,1,230,2,198,0,34,1,66,0,0,0,3,7,198,1,206,0,0,255,255,0,51,255,14,1,230,2,190,0,34,1,66,0,0,1,7,7,197,1,212,255,255,0,9,177,3,1,184,255,255,176,51,43,0,255,255,0,51,255,14,1,230,2,226,0,34,1,66,0,0,1,7,7,59,0,163,0,87,0,8,177,3,1,176,87,176,51,43,0,0,255,255,0,51,255,14,1,230,2,180,0,34,1,66,0,0,0,3,7,191,1,198,0,0,255,255,0,51,255,14,1,230,2,121,0,34,1,66,0,0,0,3,7,205,1,205,0,0,0,1,0,25,255,244,1,246,2,230,0,59,0,58,64,55,46,16,2,2,4,1,74,13,12,9,3,0,72,35,1,3,71,0,0,1,0,131,0,4,4,1,95,0,1,1,107,75,5,1,2,2,3,93,6,1,3,3,99,3,76,66,38,40,50,40,42,37,7,12,27,43,54,54,53,17,52,38,35,35,39,55,54,54,55,23,6,6,7,54,51,50,22,21,20,7,6,21,20,22,51,55,23,7,38,35,34,7,55,54,54,53,55,52,38,35,34,6,7,6,21,20,22,51,55,23,7,38,35,34,7,55,64,23,18,19,21,4,4,34,86,28,6,7,13,4,114,36,65,72,7,9,16,19,35,2,8,66,23,40,63,4,30,26,6,43,40,25,73,29,3,16,20,35,2,9,69,22,43,56,6,42,24,28,2,20,27,25,3,32,4,17,8,13,11,192,140,78,68,61,20,72,117,28,29,27,2,4,43,3,12,41,8,31,26,198,50,54,32,23,112,131,31,25,2,4,43,3,2,41,0,0,0,1,0,8,255,244,1,248,2,230,0,73,0,83,64,80,55,1,5,6,56,37,2,4,5,60,16,2,2,1,3,74,50,49,46,3,6,72,5,1,0,71,0,6,5,6,131,7,1,5,8,1,4,9,5,4,103,0,1,1,9,95,0,9,9,107,75,10,1,2,2,0,93,3,1,0,0,99,0,76,73,71,63,61,19,40,35,19,37,66,38,40,49,11,12,29,43,37,7,38,35,34,7,55,54,54,53,55,52,38,35,34,6,7,6,21,20,22,51,55,23,7,38,35,34,7,55,54,54,53,17,34,6,35,39,55,23,53,52,38,35,35,39,55,54,54,55,23,6,7,54,54,55,23,7,7,6,7,54,51,50,22,21,20,7,6,21,20,22,51,55,1,248,8,66,23,40,63,4,30,26,6,43,40,25,73,29,3,16,20,35,2,9,69,22,43,56,6,29,23,27,39,6,9,7,74,18,19,21,4,4,34,86,28,6,9,8,39,71,12,13,4,133,4,1,114,36,65,72,7,9,16,19,35,40,43,3,12,41,8,31,26,198,50,54,32,23,112,131,31,25,2,4,43,3,2,41,3,24,28,1,172,1,9,39,1,58,27,25,3,32,4,17,8,13,15,146,1,3,1,13,37,1,78,58,78,68,61,20,72,117,28,29,27,2,0,255,255,0,25,255,59,1,246,2,230,0,34,1,73,0,0,0,3,7,218,1,200,0,0,255,255,255,246,255,244,1,246,3,152,0,34,1,73,0,0,1,7,7,197,1,78,0,217,0,8,177,1,1,176,217,176,51,43,0,0,255,255,0,25,255,64,1,246,2,230,0,34,1,73,0,0,0,3,7,213,1,197,0,0,255,255,0,42,255,244,0,244,2,180,0,34,1,79,0,0,0,3,7,191,1,80,0,0,0,1,0,42,255,244,0,244,1,208,0,31,0,41,64,38,24,1,2,1,1,74,14,13,10,3,0,72,31,1,2,71,0,0,1,0,131,0,1,1,2,95,0,2,2,99,2,76,53,45,21,3,12,23,43,55,54,54,53,53,52,35,34,6,7,55,54,54,55,23,6,6,21,20,22,51,50,54,51,23,7,38,38,35,34,6,7,48,30,26,37,7,16,2,4,42,89,13,5,9,14,16,19,11,20,4,2,8,9,50,30,26,67,10,29,8,31,26,254,54,3,1,37,6,20,3,12,21,215,118,29,27,2,4,43,1,2,10,2,0,255,255,0,38,255,244,0,244,2,203,0,34,1,79,0,0,0,3,7,194,1,51,0,0,255,255,0,18,255,244,1,2,2,150,0,34,1,79,0,0,0,3,7,199,1,81,0,0,255,255,255,244,255,244,1,36,2,198,0,34,1,79,0,0,0,3,7,198,1,83,0,0,255,255,255,254,255,244,1,32,2,190,0,34,1,79,0,0,1,7,7,197,1,86,255,255,0,9,177,1,1,184,255,255,176,51,43,0,255,255,255,225,255,244,1,23,2,193,0,34,1,79,0,0,0,3,7,209,1,47,0,0,255,255,0,18,255,244,0,255,2,117,0,34,1,79,0,0,1,7,7,242,1,63,255,246,0,9,177,1,2,184,255,246,176,51,43,0,255,255,0,8,255,244,1,9,3,43,0,34,1,79,0,0,0,3,7,188,1,80,0,0,0,2,0,42,255,244,0,244,2,200,0,11,0,43,0,63,64,60,26,25,22,3,2,1,36,1,4,3,2,74,43,1,4,71,0,2,1,3,1,2,3,126,0,0,5,1,1,2,0,1,103,0,3,3,4,95,0,4,4,59,4,76,0,0,41,38,33,31,18,17,0,11,0,10,36,6,9,21,43,18,38,53,52,54,51,50,22,21,20,6,35,3,54,54,53,53,52,35,34,6,7,55,54,54,55,23,6,6,21,20,22,51,50,54,51,23,7,38,38,35,34,6,7,111,27,34,25,21,28,34,25,85,30,26,37,7,16,2,4,42,89,13,5,9,14,16,19,11,20,4,2,8,9,50,30,26,67,10,2,90,28,23,25,34,29,22,25,34,253,195,8,31,26,254,54,3,1,37,6,20,3,12,21,215,118,29,27,2,4,43,1,2,10,2,0,0,255,255,0,42,255,64,0,244,2,180,0,34,1,79,0,0,0,35,7,191,1,80,0,0,0,3,7,213,1,80,0,0,255,255,0,6,255,244,0,244,2,202,0,34,1,79,0,0,0,3,7,193,1,77,0,0,255,255,0,42,255,244,0,244,2,239,0,34,1,79,0,0,0,3,7,208,1,80,0,0,255,255,0,17,255,244,1,1,2,150,0,34,1,79,0,0,0,3,7,210,1,59,0,0,255,255,0,42,255,15,1,206,2,200,0,34,1,79,0,0,0,35,7,191,1,80,0,0,0,3,1,96,1,26,0,0,255,255,0,7,255,244,1,20,2,121,0,34,1,79,0,0,0,67,7,205,1,64,0,0,57,153,64,0,255,255,0,38,255,15,0,249,2,180,0,35,7,217,1,88,0,0,0,34,1,79,0,0,0,3,7,191,1,80,0,0,255,255,255,238,255,244,1,35,2,180,0,34,1,79,0,0,0,2,8,9,193,0,0,0,0,2,0,15,255,15,0,180,2,200,0,11,0,33,0,49,64,46,28,27,24,3,2,1,1,74,33,1,2,71,0,2,1,2,132,0,0,1,1,0,87,0,0,0,1,95,3,1,1,0,1,79,0,0,21,19,0,11,0,10,36,4,12,21,43,18,38,53,52,54,51,50,22,21,20,6,35,3,55,54,54,53,17,52,38,35,34,6,7,55,54,54,55,23,6,17,20,6,7,99,27,34,25,21,28,34,25,106,2,43,31,17,23,9,15,3,4,38,92,14,5,17,66,61,2,90,28,23,25,34,29,22,25,34,252,200,8,43,106,103,1,54,31,23,2,1,37,5,20,3,12,29,254,75,72,118,37,0,0,0,0,1,0,15,255,15,0,177,1,208,0,21,0,21,64,18,16,15,12,3,0,72,21,1,0,71,0,0,0,116,39,1,12,21,43,23,55,54,54,53,17,52,38,35,34,6,7,55,54,54,55,23,6,17,20,6,7,15,2,43,31,17,23,9,15,3,4,38,92,14,5,17,66,61,222,8,43,106,103,1,54,31,23,2,1,37,5,20,3,12,29,254,75,72,118,37,255,255,255,236,255,15,1,14,2,191,0,34,1,97,0,0,0,3,7,197,1,68,0,0,0,2,0,25,255,242,1,227,2,230,0,34,0,72,0,69,64,66,50,1,4,0,57,1,1,3,26,1,2,1,33,1,6,2,4,74,16,15,11,3,0,72,0,0,4,0,131,0,3,3,4,93,0,4,4,101,75,5,1,1,1,2,95,0,2,2,99,75,0,6,6,105,6,76,36,28,66,26,53,47,21,7,12,27,43,62,2,53,17,52,35,34,6,7,52,55,55,54,54,55,23,6,2,21,20,22,51,50,54,51,23,7,38,38,35,34,6,7,63,2,54,54,53,52,38,35,39,55,50,22,51,50,54,55,23,7,6,6,7,48,7,23,22,22,51,23,7,6,6,35,34,39,38,38,39,39,60,22,5,37,7,16,2,2,2,43,92,13,6,11,17,16,20,11,20,4,2,9,9,52,30,26,63,10,5,148,119,14,10,26,29,3,9,11,59,31,24,62,9,3,8,41,83,58,31,105,34,56,31,3,6,9,56,9,15,20,15,31,24,118,39,21,34,41,1,235,54,3,1,6,12,19,6,20,3,13,17,254,122,224,31,25,2,4,43,1,2,5,1,41,215,114,13,15,7,11,10,5,29,2,5,1,5,31,12,68,58,31,135,44,38,5,29,3,13,10,8,33,34,163,255,255,0,25,254,219,1,227,2,230,0,34,1,99,0,0,0,3,7,215,1,211,0,0,0,2,0,39,255,242,1,242,1,208,0,31,0,69,0,76,64,73,13,1,3,4,8,1,0,3,69,54,2,1,0,23,1,2,1,30,1,6,2,5,74,47,12,2,4,72,0,0,3,1,3,0,1,126,0,3,3,4,93,0,4,4,101,75,5,1,1,1,2,95,0,2,2,99,75,0,6,6,105,6,76,36,28,66,26,53,43,22,7,12,27,43,62,2,53,53,52,38,35,39,55,54,54,55,23,6,6,21,20,22,51,50,54,51,23,7,38,38,35,34,6,7,63,2,54,54,53,52,38,35,39,55,50,22,51,50,54,55,23,7,6,6,7,48,7,23,22,22,51,23,7,6,6,35,34,39,38,38,39,39,75,22,5,23,34,6,4,46,75,12,6,4,8,16,20,11,20,4,2,9,9,52,30,26,63,10,5,148,122,14,10,26,29,3,9,10,57,31,24,62,9,3,8,41,83,58,31,105,34,56,31,3,6,9,56,9,15,20,16,31,23,118,39,21,34,41,223,27,22,5,35,5,10,2,13,22,189,142,31,25,2,4,43,1,2,5,1,41,217,112,13,15,7,11,10,5,29,2,5,1,5,31,12,68,58,31,135,44,38,5,29,3,13,10,8,34,33,167,0,0,0,1,0,25,255,244,0,227,2,230,0,28,0,41,64,38,10,1,1,0,1,74,15,14,12,3,0,72,28,1,2,71,0,0,1,0,131,0,1,1,2,93,0,2,2,99,2,76,50,44,23,3,12,23,43,55,62,2,53,17,52,38,35,34,7,39,55,54,55,23,6,2,21,20,22,51,55,23,7,38,35,34,7,31,28,23,5,14,22,5,18,3,4,84,64,6,11,17,16,19,35,2,8,66,23,34,69,29,8,24,34,40,1,235,31,22,2,2,34,12,17,13,17,254,118,220,30,26,2,4,43,3,12,0,0,0,255,255,0,25,255,244,0,253,3,177,0,34,1,102,0,0,1,7,7,194,1,68,0,230,0,8,177,1,1,176,230,176,51,43,0,0,0,2,0,25,255,244,1,48,2,230,0,28,0,40,0,43,64,40,29,10,2,1,0,1,74,35,15,14,12,4,0,72,28,1,2,71,0,0,1,0,131,0,1,1,2,93,0,2,2,99,2,76,50,44,23,3,12,23,43,55,62,2,53,17,52,38,35,34,7,39,55,54,55,23,6,2,21,20,22,51,55,23,7,38,35,34,7,19,54,53,52,38,39,55,23,6,6,7,7,31,28,23,5,14,22,5,18,3,4,84,64,6,11,17,16,19,35,2,8,66,23,34,69,206,1,6,1,70,7,2,20,13,25,29,8,24,34,40,1,235,31,22,2,2,34,12,17,13,17,254,118,220,30,26,2,4,43,3,12,1,223,18,36,56,95,13,14,8,19,129,64,14,255,255,0,25,254,219,0,227,2,230,0,34,1,102,0,0,0,3,7,215,1,74,0,0,255,255,0,25,255,244,1,71,2,230,0,34,1,102,0,0,1,7,7,9,0,148,0,51,0,8,177,1,1,176,51,176,51,43,0,0,255,255,0,25,255,64,0,227,2,230,0,34,1,102,0,0,0,3,7,213,1,70,0,0,255,255,0,25,255,15,1,168,2,230,0,34,1,102,0,0,0,3,1,96,0,244,0,0,255,255,255,236,255,93,1,23,2,230,0,34,1,102,0,0,0,3,7,219,1,72,0,0,0,1,0,16,255,244,0,255,2,230,0,38,0,55,64,52,33,32,30,29,22,16,15,13,12,9,2,1,1,74,27,26,24,3,1,72,6,1,0,71,0,1,2,1,131,3,1,2,2,0,93,0,0,0,99,0,76,0,0,0,38,0,37,30,50,4,12,22,43,55,23,7,38,35,34,7,55,62,2,53,53,7,39,39,55,53,52,38,35,34,7,39,55,54,55,23,6,3,55,23,23,7,6,21,20,22,51,238,2,8,66,23,34,69,4,28,23,5,69,9,6,84,14,22,5,18,3,4,84,64,6,13,10,68,8,6,83,4,16,19,44,4,43,3,12,41,8,24,34,40,211,38,2,32,47,237,31,22,2,2,34,12,17,13,20,254,229,37,4,31,46,120,164,30,26,0,0,1,0,39,255,244,3,33,1,209,0,99,0,76,64,73,40,36,2,0,4,83,49,43,9,4,1,0,91,66,18,3,2,1,3,74,39,1,4,72,98,73,2,2,71,8,3,2,0,0,4,95,5,1,4,4,107,75,9,6,2,1,1,2,95,10,7,2,2,2,99,2,76,96,93,88,86,41,53,40,36,43,39,85,38,37,11,12,29,43,36,54,53,55,52,38,35,34,6,7,6,21,20,22,51,50,54,51,23,7,38,38,35,34,6,35,55,54,54,53,53,52,38,35,35,39,55,54,54,55,23,6,6,7,23,54,51,50,22,23,54,54,51,50,22,21,20,7,6,21,20,22,51,50,54,51,23,7,38,38,35,34,6,7,55,54,54,53,55,52,38,35,34,7,7,20,22,51,50,54,51,23,7,38,38,35,34,6,7,55,1,99,26,4,43,40,32,66,25,9,16,20,11,20,4,2,9,9,52,30,33,56,10,6,29,23,22,27,11,3,3,43,85,12,6,2,8,1,2,112,35,48,66,14,36,90,25,63,74,6,8,16,20,11,20,4,2,9,9,52,30,26,63,10,5,29,24,4,43,40,52,69,11,16,19,11,20,4,2,8,9,50,30,26,67,10,4,37,31,26,198,50,54,33,19,207,39,31,25,2,4,43,1,2,2,41,3,24,28,244,34,27,4,33,7,19,3,8,6,39,21,3,76,41,38,26,53,70,59,10,82,104,41,31,25,2,4,43,1,2,5,1,41,5,26,28,198,50,54,50,248,29,27,2,4,43,1,2,10,2,41,0,255,255,0,39,255,64,3,33,1,209,0,34,1,111,0,0,0,3,7,213,2,122,0,0,0,1,0,41,255,244,2,11,1,209,0,68,0,63,64,60,40,36,2,0,4,43,9,2,1,0,60,18,2,2,1,3,74,39,1,4,72,67,25,2,2,71,3,1,0,0,4,95,0,4,4,107,75,5,1,1,1,2,95,6,1,2,2,99,2,76,53,40,43,41,53,38,37,7,12,27,43,36,54,53,55,52,38,35,34,6,7,6,21,20,22,51,50,54,51,23,7,38,38,35,34,6,7,55,54,54,53,53,52,38,35,35,39,55,54,54,55,23,6,6,7,23,54,51,50,22,21,20,7,6,21,20,22,51,50,54,51,23,7,38,38,35,34,6,7,55,1,101,26,4,43,40,32,66,25,9,16,20,11,20,4,2,9,9,52,30,26,63,10,5,29,24,22,27,11,3,3,43,85,12,6,2,8,1,2,114,33,63,74,6,8,16,19,11,20,4,2,8,9,50,30,26,67,10,4,37,31,26,198,50,54,33,19,207,39,31,25,2,4,43,1,2,5,1,41,5,26,28,244,34,27,4,33,7,19,3,8,6,39,21,3,76,70,59,10,82,104,41,29,27,2,4,43,1,2,10,2,41,0,0,255,255,0,41,255,244,2,11,2,203,0,34,1,113,0,0,0,3,7,194,1,232,0,0,255,255,0,41,255,244,2,11,2,198,0,34,1,113,0,0,0,3,7,198,1,232,0,0,255,255,0,41,254,219,2,11,1,209,0,34,1,113,0,0,0,3,7,215,1,228,0,0,255,255,0,41,255,244,2,11,2,180,0,34,1,113,0,0,0,3,7,191,1,253,0,0,255,255,0,41,255,64,2,11,1,209,0,34,1,113,0,0,0,3,7,213,1,233,0,0,0,1,0,39,255,112,1,207,1,209,0,56,0,58,64,55,43,39,2,0,4,46,12,2,1,0,21,1,2,1,3,74,42,1,4,72,56,28,2,2,71,3,1,0,0,4,95,0,4,4,107,75,0,1,1,2,95,0,2,2,99,2,76,43,41,53,38,40,5,12,25,43,5,55,62,2,55,55,52,38,35,34,6,7,6,21,20,22,51,50,54,51,23,7,38,38,35,34,6,7,55,54,54,53,53,52,38,35,35,39,55,54,54,55,23,6,6,7,23,54,51,50,22,21,7,6,6,7,1,19,3,42,44,19,1,1,43,40,32,66,25,9,16,20,11,20,4,2,9,9,52,30,26,63,10,5,29,24,22,27,11,3,3,43,85,12,6,2,8,1,2,114,33,63,74,11,6,70,84,111,8,23,49,69,56,198,50,54,33,19,207,39,31,25,2,4,43,1,2,5,1,41,5,26,28,244,34,27,4,33,7,19,3,8,6,39,21,3,76,70,59,239,102,107,31,0,0,0,255,255,0,41,255,15,2,216,2,200,0,34,1,113,0,0,0,3,1,96,2,36,0,0,255,255,0,41,255,93,2,11,1,209,0,34,1,113,0,0,0,3,7,219,1,235,0,0,255,255,0,41,255,244,2,11,2,180,0,34,1,113,0,0,0,2,8,9,88,0,0,0,0,2,0,36,255,244,1,206,1,208,0,15,0,29,0,44,64,41,0,2,2,0,95,0,0,0,107,75,5,1,3,3,1,95,4,1,1,1,105,1,76,16,16,0,0,16,29,16,28,23,21,0,15,0,14,38,6,12,21,43,22,38,38,53,52,54,54,51,50,22,22,21,20,6,6,35,54,54,53,52,38,38,35,34,6,21,20,22,22,51,173,88,49,61,106,65,56,89,49,61,106,65,84,66,36,65,41,56,66,36,64,42,12,56,101,65,70,117,67,56,101,65,70,117,67,49,91,78,59,93,52,92,79,59,92,51,255,255,0,36,255,244,1,206,2,203,0,34,1,123,0,0,0,3,7,194,1,195,0,0,255,255,0,36,255,244,1,206,2,150,0,34,1,123,0,0,0,3,7,199,1,207,0,0,255,255,0,36,255,244,1,206,2,198,0,34,1,123,0,0,0,3,7,198,1,209,0,0,255,255,0,36,255,244,1,206,2,191,0,34,1,123,0,0,0,3,7,197,1,194,0,0,255,255,0,36,255,244,1,206,2,229,0,34,1,123,0,0,1,7,8,47,1,197,255,221,0,9,177,2,2,184,255,221,176,51,43,0,255,255,0,36,255,64,1,206,2,191,0,34,1,123,0,0,0,35,7,197,1,194,0,0,0,3,7,213,1,187,0,0,255,255,0,36,255,244,1,206,2,222,0,34,1,123,0,0,1,7,8,48,1,197,255,221,0,9,177,2,2,184,255,221,176,51,43,0,255,255,0,36,255,244,1,206,2,242,0,34,1,123,0,0,1,7,8,49,1,197,255,221,0,9,177,2,2,184,255,221,176,51,43,0,255,255,0,36,255,244,1,206,2,232,0,34,1,123,0,0,1,7,8,50,1,197,255,221,0,9,177,2,2,184,255,221,176,51,43,0,255,255,0,36,255,244,1,206,2,193,0,34,1,123,0,0,0,3,7,209,1,159,0,0,255,255,0,36,255,244,1,206,2,127,0,34,1,123,0,0,0,3,7,186,1,193,0,0,255,255,0,36,255,244,1,206,2,221,0,34,1,123,0,0,0,3,7,190,1,191,0,0,255,255,0,36,255,244,1,206,2,187,0,34,1,123,0,0,0,47,7,191,1,180,255,216,60,96,1,7,7,205,1,191,0,66,0,17,177,2,1,184,255,216,176,51,43,177,3,1,176,66,176,51,43,0,0,0,255,255,0,36,255,64,1,206,1,208,0,34,1,123,0,0,0,3,7,213,1,188,0,0,255,255,0,36,255,244,1,206,2,202,0,34,1,123,0,0,0,3,7,193,1,196,0,0,255,255,0,36,255,244,1,206,2,239,0,34,1,123,0,0,0,3,7,208,1,207,0,0,0,2,0,36,255,244,2,33,2,77,0,36,0,50,0,66,64,63,18,1,0,2,1,74,0,2,0,2,131,0,1,0,3,6,1,3,103,0,5,5,0,95,0,0,0,107,75,8,1,6,6,4,95,7,1,4,4,105,4,76,37,37,0,0,37,50,37,49,44,42,0,36,0,35,21,41,35,38,9,12,24,43,22,38,38,53,52,54,54,51,50,22,23,22,51,50,54,53,52,38,39,55,54,55,54,51,50,22,21,20,6,6,35,22,21,20,6,6,35,54,54,53,52,38,38,35,34,6,21,20,22,22,51,173,88,49,60,101,58,23,36,27,37,25,30,33,17,15,2,18,12,17,11,23,28,36,61,35,49,61,106,65,84,66,36,65,41,56,66,36,64,42,12,56,101,65,70,116,68,9,10,15,26,23,18,38,14,14,14,5,7,43,35,33,53,30,62,91,70,117,67,49,91,78,59,93,52,92,79,59,92,51,255,255,0,36,255,244,2,33,2,203,0,34,1,140,0,0,0,3,7,194,1,195,0,0,255,255,0,36,255,64,2,33,2,77,0,34,1,140,0,0,0,3,7,213,1,187,0,0,255,255,0,36,255,244,2,33,2,202,0,34,1,140,0,0,0,3,7,193,1,196,0,0,255,255,0,36,255,244,2,33,2,239,0,34,1,140,0,0,0,3,7,208,1,218,0,0,255,255,0,36,255,244,2,33,2,180,0,34,1,140,0,0,0,2,8,9,55,0,0,0,255,255,0,36,255,244,1,206,2,193,0,34,1,123,0,0,0,3,7,195,1,206,0,0,255,255,0,36,255,244,1,206,2,150,0,34,1,123,0,0,0,3,7,210,1,171,0,0,255,255,0,36,255,244,1,206,2,121,0,34,1,123,0,0,0,3,7,205,1,193,0,0,255,255,0,36,255,244,1,206,2,235,0,34,1,123,0,0,0,39,7,205,1,191,255,196,1,7,7,227,1,151,255,162,0,18,177,2,1,184,255,196,176,51,43,177,3,1,184,255,162,176,51,43,255,255,0,36,255,244,1,206,2,235,0,34,1,123,0,0,0,39,7,205,1,191,255,196,1,7,7,226,1,238,255,162,0,18,177,2,1,184,255,196,176,51,43,177,3,1,184,255,162,176,51,43,255,255,0,36,255,15,1,206,1,208,0,34,1,123,0,0,0,3,7,217,1,228,0,0,0,3,0,36,255,158,1,206,2,27,0,25,0,34,0,43,0,72,64,69,25,21,2,2,1,41,40,32,31,4,3,2,12,8,2,0,3,3,74,24,22,2,1,72,11,9,2,0,71,4,1,2,2,1,95,0,1,1,107,75,5,1,3,3,0,95,0,0,0,105,0,76,35,35,26,26,35,43,35,42,26,34,26,33,43,37,6,12,22,43,0,22,21,20,6,6,35,34,39,7,39,39,55,38,38,53,52,54,54,51,50,23,55,23,23,7,6,6,21,20,22,23,19,38,35,18,54,53,52,38,39,3,22,51,1,159,47,61,106,65,44,37,55,27,2,54,39,44,61,106,65,39,34,47,29,3,47,191,66,21,19,152,31,39,76,66,24,21,154,33,44,1,149,100,63,70,117,67,17,103,6,10,105,29,96,62,70,117,67,14,89,7,12,87,23,92,79,44,75,27,1,38,23,254,139,91,78,47,80,28,254,216,28,0,0,0,255,255,0,36,255,158,1,206,2,203,0,34,1,152,0,0,0,3,7,194,1,199,0,0,255,255,0,36,255,244,1,206,2,180,0,34,1,123,0,0,0,2,8,9,51,0,0,0,255,255,0,36,255,244,1,206,3,4,0,34,1,123,0,0,0,39,7,201,1,191,255,206,1,135,7,227,1,115,255,184,63,233,252,167,3,89,63,233,0,18,177,2,1,184,255,206,176,51,43,177,3,1,184,255,184,176,51,43,255,255,0,36,255,244,1,206,2,233,0,34,1,123,0,0,0,39,7,201,1,191,255,206,1,7,7,186,1,192,0,106,0,17,177,2,1,184,255,206,176,51,43,177,3,2,176,106,176,51,43,0,255,255,0,36,255,244,1,206,2,228,0,34,1,123,0,0,0,47,7,201,1,184,255,230,61,137,1,7,7,205,1,191,0,107,0,17,177,2,1,184,255,230,176,51,43,177,3,1,176,107,176,51,43,0,0,0,0,3,0,36,255,244,2,219,1,208,0,41,0,51,0,65,0,104,64,101,10,1,7,8,38,1,3,4,2,74,32,1,3,1,73,0,4,2,3,2,4,3,126,12,1,7,0,2,4,7,2,101,9,1,8,8,0,95,1,1,0,0,107,75,0,3,3,5,95,11,6,2,5,5,105,75,13,1,10,10,5,95,11,6,2,5,5,105,5,76,52,52,43,42,0,0,52,65,52,64,59,57,49,47,42,51,43,51,0,41,0,40,36,34,35,23,36,38,14,12,26,43,22,38,38,53,52,54,54,51,50,22,23,54,54,51,50,22,21,20,6,6,7,7,33,21,20,22,51,50,54,54,55,23,23,14,2,35,34,39,6,6,35,1,54,54,53,52,38,35,34,6,7,2,54,53,52,38,38,35,34,6,21,20,22,22,51,170,86,48,60,104,63,49,79,25,34,90,41,71,79,5,5,1,13,254,240,81,67,28,54,36,5,6,11,7,51,68,27,119,55,32,88,51,1,139,15,10,43,40,47,67,9,132,63,35,62,40,54,63,35,62,40,12,56,101,65,70,117,67,45,42,44,43,70,64,16,27,15,2,12,16,84,102,14,15,2,2,29,5,33,30,86,41,45,1,60,1,11,15,40,42,64,54,254,254,91,78,59,93,52,92,79,59,92,51,0,2,0,40,255,19,1,236,1,209,0,46,0,61,0,77,64,74,21,18,14,3,0,1,58,56,22,3,6,0,35,1,2,6,3,74,17,1,1,72,46,1,4,71,5,1,0,0,1,95,0,1,1,101,75,7,1,6,6,2,95,0,2,2,105,75,0,3,3,4,93,0,4,4,103,4,76,47,47,47,61,47,60,40,34,36,54,43,42,8,12,26,43,23,62,2,53,52,55,55,17,52,38,35,35,39,55,54,54,55,23,6,6,7,23,54,51,50,22,22,21,20,6,6,35,34,38,39,23,20,22,51,55,23,7,35,34,6,7,0,54,53,52,38,38,35,34,6,7,6,21,22,22,51,50,22,21,8,1,1,22,27,11,3,3,43,85,12,6,1,7,2,4,94,22,57,88,48,68,114,67,22,43,8,1,19,28,34,2,8,95,36,61,9,1,37,77,35,61,36,20,58,26,8,20,55,25,198,3,12,28,29,42,30,94,1,42,34,27,4,33,7,19,3,8,5,33,16,7,65,53,96,62,71,120,71,3,1,103,46,33,1,3,38,6,1,1,24,91,79,50,82,48,27,22,131,151,8,11,0,0,2,0,21,255,19,1,216,2,230,0,39,0,51,0,76,64,73,11,1,1,0,50,49,18,3,6,5,2,74,15,14,2,0,72,39,1,4,71,0,0,1,0,131,0,5,5,1,95,0,1,1,107,75,7,1,6,6,2,93,0,2,2,102,75,0,3,3,4,95,0,4,4,103,4,76,40,40,40,51,40,51,39,34,20,38,42,24,8,12,26,43,23,62,2,55,55,17,52,38,35,34,7,55,54,55,23,6,6,7,54,51,50,22,22,21,20,6,6,35,39,21,20,22,22,55,23,7,35,34,7,0,54,53,52,38,38,35,34,6,7,3,23,26,28,24,4,1,2,17,21,6,18,4,72,76,6,7,12,4,99,22,56,88,49,67,115,67,71,10,33,39,2,8,63,86,58,1,41,77,35,61,36,19,60,28,3,98,198,3,20,34,44,191,2,27,24,21,2,37,9,20,13,11,182,142,70,54,98,62,71,120,71,4,103,39,31,10,2,3,38,7,1,24,91,79,50,84,49,30,24,254,234,21,0,0,0,2,0,36,255,22,1,229,1,222,0,37,0,53,0,71,64,68,17,1,5,2,42,41,5,3,6,5,2,74,21,1,2,72,37,1,4,71,0,5,5,2,95,0,2,2,107,75,7,1,6,6,1,95,0,1,1,105,75,3,1,0,0,4,93,0,4,4,103,4,76,38,38,38,53,38,52,41,52,43,38,37,16,8,12,26,43,5,62,2,55,55,6,35,34,38,38,53,52,54,54,51,50,23,54,54,55,23,6,2,21,20,22,22,51,50,54,51,23,7,35,34,6,7,2,54,54,55,17,46,2,35,34,6,21,20,22,22,51,1,28,29,26,10,1,4,104,21,56,88,49,67,115,67,47,45,21,30,4,8,9,10,5,15,16,10,14,2,2,7,92,29,68,10,13,49,34,5,3,24,43,27,67,77,35,61,36,196,2,9,24,26,195,72,54,97,63,71,120,71,9,8,13,2,9,22,254,206,247,38,34,12,1,2,39,3,1,1,31,25,27,4,1,18,2,11,10,91,79,50,84,49,0,1,0,45,255,252,1,104,1,209,0,54,0,69,64,66,26,15,10,3,0,1,36,30,29,18,4,3,2,46,1,4,3,3,74,14,1,1,72,53,1,4,71,0,0,1,2,1,0,2,126,0,2,3,1,2,3,124,0,1,1,101,75,0,3,3,4,93,0,4,4,99,4,76,84,39,41,47,21,5,12,25,43,54,54,53,53,52,38,35,34,6,7,39,55,54,54,55,23,6,6,23,23,54,54,51,50,22,23,23,6,6,7,7,52,38,35,34,6,7,6,6,7,20,22,51,50,54,51,23,7,34,38,35,34,6,7,55,89,20,18,20,8,11,2,5,3,38,85,12,7,2,8,1,4,30,81,30,14,15,2,3,2,13,1,39,11,16,22,50,21,1,6,1,20,28,13,26,5,1,9,10,60,32,37,60,8,5,39,33,47,220,33,28,2,1,7,31,7,20,3,6,9,65,29,3,47,60,3,1,4,14,91,38,3,41,27,37,31,29,134,41,34,24,2,4,44,2,3,1,40,0,255,255,0,45,255,252,1,104,2,203,0,34,1,162,0,0,0,3,7,194,1,87,0,0,255,255,0,45,255,252,1,121,2,198,0,34,1,162,0,0,0,3,7,198,1,168,0,0,255,255,0,45,254,219,1,104,1,209,0,34,1,162,0,0,0,3,7,215,1,111,0,0,255,255,0,45,255,252,1,108,2,193,0,34,1,162,0,0,0,3,7,209,1,132,0,0,255,255,0,45,255,64,1,104,1,209,0,34,1,162,0,0,0,3,7,213,1,100,0,0,255,255,0,45,255,252,1,104,2,150,0,34,1,162,0,0,0,3,7,210,1,144,0,0,255,255,0,10,255,93,1,104,1,209,0,34,1,162,0,0,0,3,7,219,1,102,0,0,0,1,0,49,255,244,1,98,1,208,0,52,0,53,64,50,29,1,2,1,33,8,7,3,0,2,4,1,3,0,3,74,0,2,2,1,95,0,1,1,107,75,0,0,0,3,95,4,1,3,3,105,3,76,0,0,0,52,0,51,45,43,42,5,12,23,43,22,38,38,39,39,54,54,55,55,20,22,51,50,54,53,52,38,39,38,38,53,52,54,54,51,50,22,22,23,23,6,6,7,7,52,54,53,52,38,35,34,6,21,20,22,23,22,22,21,20,6,6,35,139,53,30,4,3,3,8,1,35,44,53,38,52,47,69,57,52,48,84,52,24,44,28,4,2,2,14,3,37,2,39,43,34,47,41,46,81,59,50,85,48,12,9,10,2,7,15,94,25,5,66,54,34,25,25,41,37,29,60,36,40,65,37,7,8,1,5,10,71,41,3,3,18,8,36,33,32,23,24,42,24,43,59,38,38,66,39,0,255,255,0,49,255,244,1,98,2,203,0,34,1,170,0,0,0,3,7,194,1,155,0,0,255,255,0,49,255,244,1,98,2,246,0,34,1,170,0,0,0,39,7,227,1,126,255,71,1,7,7,224,1,144,255,195,0,18,177,1,1,184,255,71,176,51,43,177,2,1,184,255,195,176,51,43,0,1,0,50,0,228,0,134,2,27,0,10,0,6,179,10,5,1,48,43,55,54,53,52,39,55,23,6,6,7,7,50,8,4,73,7,6,26,15,27,230,73,96,65,60,15,9,55,163,69,15,0,255,255,0,49,255,244,1,108,2,198,0,34,1,170,0,0,0,3,7,198,1,155,0,0,255,255,0,49,255,244,1,98,2,234,0,34,1,170,0,0,0,47,7,230,1,137,255,96,61,137,1,7,7,224,1,144,255,183,0,18,177,1,1,184,255,96,176,51,43,177,2,1,184,255,183,176,51,43,0,0,255,255,0,49,255,23,1,98,1,208,0,34,1,170,0,0,0,3,7,216,1,136,0,0,255,255,0,49,255,244,1,98,2,191,0,34,1,170,0,0,0,3,7,197,1,144,0,0,255,255,0,49,254,219,1,98,1,208,0,34,1,170,0,0,0,3,7,215,1,152,0,0,255,255,0,49,255,244,1,98,2,180,0,34,1,170,0,0,0,3,7,191,1,144,0,0,255,255,0,49,255,64,1,98,1,208,0,34,1,170,0,0,0,3,7,213,1,141,0,0,255,255,0,49,255,64,1,98,2,180,0,34,1,170,0,0,0,35,7,213,1,141,0,0,0,3,7,191,1,144,0,0,0,1,0,41,255,244,2,70,2,230,0,81,0,173,75,176,10,80,88,64,15,57,55,2,5,2,39,1,1,3,2,74,46,1,4,71,27,64,15,57,55,2,5,2,39,1,1,3,46,1,7,4,3,74,89,75,176,10,80,88,64,50,0,5,2,0,2,5,0,126,0,0,3,2,0,3,124,0,2,2,6,95,0,6,6,100,75,0,3,3,4,95,8,7,2,4,4,99,75,0,1,1,4,95,8,7,2,4,4,99,4,76,27,64,47,0,5,2,0,2,5,0,126,0,0,3,2,0,3,124,0,2,2,6,95,0,6,6,100,75,0,3,3,4,93,0,4,4,99,75,0,1,1,7,95,8,1,7,7,105,7,76,89,64,21,0,0,0,81,0,80,61,59,54,53,45,40,37,34,29,27,34,21,9,12,22,43,4,38,53,52,54,55,51,20,22,51,50,54,53,52,38,39,46,2,53,52,54,55,54,54,53,52,38,35,34,6,7,3,6,22,51,50,54,51,23,7,34,38,35,34,6,7,55,54,54,53,17,38,38,39,39,55,55,52,54,51,50,22,22,21,20,6,7,6,6,21,20,22,23,30,2,21,20,6,6,35,1,99,67,26,12,14,50,45,30,46,49,50,40,47,34,36,35,29,31,69,58,57,55,1,6,1,21,19,20,24,3,2,7,11,60,28,35,67,10,5,35,22,1,27,35,4,7,60,122,109,39,70,43,36,36,27,27,45,46,40,50,36,49,82,47,12,31,22,14,57,15,45,50,51,32,33,48,31,26,38,53,34,33,51,33,28,41,24,44,51,90,95,254,112,26,29,1,4,42,2,3,1,39,4,31,38,1,0,22,17,2,6,34,11,135,151,35,56,31,41,57,37,27,38,23,26,41,28,25,39,56,35,42,73,44,0,0,0,1,0,21,255,244,1,56,2,20,0,34,0,50,64,47,30,1,4,3,1,74,13,12,2,1,72,2,1,0,0,1,93,0,1,1,101,75,0,3,3,4,95,5,1,4,4,105,4,76,0,0,0,34,0,33,36,18,26,21,6,12,24,43,22,38,53,53,52,38,39,39,55,62,2,55,23,6,6,7,55,23,7,39,6,21,20,22,51,50,54,54,55,23,14,2,35,138,56,24,33,4,5,29,55,35,5,20,1,4,3,147,3,9,145,7,35,43,15,30,20,3,10,6,39,45,11,12,55,66,246,27,22,1,6,30,14,41,31,5,8,5,38,32,3,3,53,3,110,140,51,42,8,9,1,26,5,28,27,0,0,1,0,21,255,244,1,56,2,20,0,48,0,73,64,70,40,1,2,3,41,14,2,1,2,4,1,0,8,3,74,27,26,2,4,72,6,1,2,7,1,1,8,2,1,101,5,1,3,3,4,93,0,4,4,101,75,9,1,8,8,0,95,0,0,0,105,0,76,0,0,0,48,0,47,19,50,18,26,19,18,19,39,10,12,28,43,62,2,55,23,14,2,35,34,38,53,53,7,39,55,23,53,52,38,39,39,55,62,2,55,23,6,6,7,55,23,7,39,6,7,51,50,54,55,23,7,7,6,21,20,22,51,244,30,20,3,10,6,39,45,11,68,56,52,9,7,54,24,33,4,5,29,55,35,5,20,1,4,3,147,3,9,145,4,1,12,27,70,11,13,4,130,1,35,43,56,8,9,1,26,5,28,27,55,66,130,1,9,39,1,70,27,22,1,6,30,14,41,31,5,8,5,38,32,3,3,53,3,60,54,4,1,13,37,1,28,62,51,42,0,2,0,21,255,244,1,56,2,221,0,11,0,46,0,56,64,53,42,1,4,3,1,74,25,24,6,0,4,1,72,2,1,0,0,1,93,0,1,1,101,75,0,3,3,4,95,5,1,4,4,105,4,76,12,12,12,46,12,45,38,36,32,31,29,28,18,17,6,12,20,43,19,54,53,52,38,39,55,23,6,6,7,7,2,38,53,53,52,38,39,39,55,62,2,55,23,6,6,7,55,23,7,39,6,21,20,22,51,50,54,54,55,23,14,2,35,233,1,6,1,70,7,2,20,13,25,106,56,24,33,4,5,29,55,35,5,20,1,4,3,147,3,9,145,7,35,43,15,30,20,3,10,6,39,45,11,1,245,18,36,56,95,13,14,8,19,129,64,14,254,1,55,66,246,27,22,1,6,30,14,41,31,5,8,5,38,32,3,3,53,3,110,140,51,42,8,9,1,26,5,28,27,0,255,255,0,21,255,23,1,56,2,20,0,34,1,183,0,0,0,3,7,216,1,121,0,0,255,255,0,21,254,219,1,56,2,20,0,34,1,183,0,0,0,3,7,215,1,127,0,0,255,255,0,21,255,244,1,56,2,136,0,34,1,183,0,0,1,7,7,242,1,90,0,9,0,8,177,1,2,176,9,176,51,43,0,0,255,255,0,21,255,64,1,56,2,20,0,34,1,183,0,0,0,3,7,213,1,135,0,0,255,255,0,21,255,93,1,88,2,20,0,34,1,183,0,0,0,3,7,219,1,137,0,0,0,1,0,28,255,244,2,27,1,208,0,52,0,46,64,43,44,38,17,3,1,0,1,74,27,26,8,5,4,0,72,2,1,0,1,0,131,3,1,1,1,4,95,5,1,4,4,105,4,76,36,39,42,37,44,16,6,12,26,43,18,35,34,6,7,55,54,54,55,23,6,6,21,20,51,50,54,55,53,52,38,35,7,55,54,54,55,23,6,6,21,20,22,51,50,54,54,55,23,14,2,35,34,39,39,6,6,35,34,38,53,55,90,37,7,16,2,4,39,90,14,6,10,16,80,30,52,39,22,28,24,4,44,96,14,6,9,13,22,19,14,27,17,2,14,4,29,39,15,81,8,5,48,77,14,64,69,4,1,145,3,1,37,6,21,3,12,26,184,87,98,29,28,232,30,24,1,36,6,20,3,12,23,204,120,22,24,11,12,2,16,6,38,36,81,2,37,46,60,56,243,0,0,0,255,255,0,28,255,244,2,27,2,203,0,34,1,191,0,0,0,3,7,194,1,200,0,0,255,255,0,28,255,244,2,27,2,150,0,34,1,191,0,0,0,3,7,199,1,215,0,0,255,255,0,28,255,244,2,27,2,198,0,34,1,191,0,0,0,3,7,198,1,217,0,0,255,255,0,28,255,244,2,27,2,191,0,34,1,191,0,0,0,3,7,197,1,199,0,0,255,255,0,28,255,244,2,27,2,193,0,34,1,191,0,0,0,3,7,209,1,181,0,0,255,255,0,28,255,244,2,27,2,127,0,34,1,191,0,0,0,3,7,186,1,198,0,0,255,255,0,28,255,244,2,27,3,43,0,34,1,191,0,0,0,3,7,188,1,215,0,0,255,255,0,28,255,244,2,27,3,16,0,34,1,191,0,0,0,3,7,189,1,215,0,0,255,255,0,28,255,244,2,27,3,43,0,34,1,191,0,0,0,3,7,187,1,215,0,0,255,255,0,28,255,244,2,27,2,221,0,34,1,191,0,0,0,3,7,190,1,215,0,0,255,255,0,28,255,64,2,27,1,208,0,34,1,191,0,0,0,3,7,213,1,197,0,0,255,255,0,28,255,244,2,27,2,202,0,34,1,191,0,0,0,3,7,193,1,201,0,0,255,255,0,28,255,244,2,27,2,239,0,34,1,191,0,0,0,3,7,208,1,215,0,0,0,1,0,28,255,244,2,33,2,103,0,67,0,51,64,48,31,8,5,3,0,3,59,53,18,3,1,0,2,74,0,3,0,3,131,2,1,0,1,0,131,4,1,1,1,5,95,6,1,5,5,105,5,76,36,39,42,44,37,45,16,7,12,27,43,18,35,34,6,7,55,54,54,55,23,6,6,21,20,22,51,50,54,55,53,52,38,35,7,55,55,54,54,53,52,38,39,55,54,55,54,51,50,22,21,20,6,7,6,6,21,20,22,51,50,54,54,55,23,14,2,35,34,39,39,6,6,35,34,38,53,55,90,37,7,16,2,4,39,90,14,6,10,16,39,41,30,52,39,22,28,24,4,117,30,33,17,15,2,18,12,17,11,23,28,61,45,7,8,22,19,14,27,17,2,14,4,29,39,15,81,8,5,48,77,14,64,69,4,1,145,3,1,37,6,21,3,12,26,184,87,50,48,29,28,232,30,24,1,36,21,5,23,21,18,38,14,14,14,5,7,43,35,43,63,8,45,175,98,22,24,11,12,2,16,6,38,36,81,2,37,46,60,56,243,0,0,0,255,255,0,28,255,244,2,33,2,203,0,34,1,205,0,0,0,3,7,194,1,200,0,0,255,255,0,28,255,64,2,33,2,103,0,34,1,205,0,0,0,3,7,213,1,212,0,0,255,255,0,28,255,244,2,33,2,202,0,34,1,205,0,0,0,3,7,193,1,201,0,0,255,255,0,28,255,244,2,33,2,239,0,34,1,205,0,0,0,3,7,208,1,229,0,0,255,255,0,28,255,244,2,33,2,180,0,34,1,205,0,0,0,2,8,9,56,0,0,0,255,255,0,28,255,244,2,27,2,193,0,34,1,191,0,0,0,3,7,195,1,228,0,0,255,255,0,28,255,244,2,27,2,150,0,34,1,191,0,0,0,3,7,210,1,193,0,0,255,255,0,28,255,244,2,27,2,121,0,34,1,191,0,0,0,3,7,205,1,198,0,0,255,255,0,28,255,244,2,27,2,219,0,34,1,191,0,0,0,39,7,237,1,213,255,71,1,7,7,221,1,214,255,179,0,18,177,1,1,184,255,71,176,51,43,177,2,2,184,255,179,176,51,43,0,1,0,28,255,15,2,41,1,208,0,70,0,60,64,57,59,38,12,3,3,2,10,1,1,3,2,74,48,47,29,26,4,2,72,4,1,2,3,2,131,5,1,3,3,1,95,0,1,1,105,75,0,6,6,0,96,0,0,0,109,0,76,42,42,37,44,20,42,20,7,12,27,43,5,14,2,7,34,38,53,52,54,55,38,39,39,6,6,35,34,38,53,55,52,35,34,6,7,55,54,54,55,23,6,6,21,20,51,50,54,55,53,52,38,35,7,55,54,54,55,23,6,6,21,20,22,51,50,54,54,55,23,14,2,21,20,22,51,50,54,54,55,2,41,4,29,44,23,51,60,38,45,56,6,5,51,75,13,64,69,4,37,7,16,2,4,39,90,14,6,10,16,80,23,52,46,22,28,24,4,44,96,14,6,9,13,22,19,14,27,17,2,17,64,55,18,33,25,17,35,22,3,178,4,23,28,8,51,43,26,64,48,12,66,2,38,45,60,56,243,54,3,1,37,6,21,3,12,27,185,85,98,25,32,232,30,24,1,36,6,20,3,12,23,204,120,22,24,11,12,2,19,67,63,38,23,24,32,10,11,2,0,0,255,255,0,28,255,244,2,27,2,196,0,34,1,191,0,0,0,3,7,200,1,199,0,0,255,255,0,28,255,244,2,27,2,180,0,34,1,191,0,0,0,2,8,9,71,0,0,0,255,255,0,28,255,244,2,27,3,4,0,34,1,191,0,0,0,39,7,201,1,213,255,206,1,135,7,227,1,137,255,184,63,233,252,167,3,89,63,233,0,18,177,1,1,184,255,206,176,51,43,177,2,1,184,255,184,176,51,43,0,1,255,246,255,239,1,196,1,203,0,37,0,40,64,37,28,1,0,1,1,74,10,1,1,72,37,18,2,0,71,3,2,2,0,0,1,93,4,1,1,1,101,0,76,34,44,20,34,19,5,12,25,43,54,2,39,38,39,39,55,23,50,54,55,23,7,6,6,21,20,22,23,51,55,54,54,53,52,38,35,35,39,55,23,55,7,6,6,7,3,7,167,89,18,17,51,2,6,83,38,72,10,2,6,34,25,72,13,4,55,27,36,19,24,38,4,5,107,82,7,21,24,19,143,56,31,1,25,54,48,2,4,33,1,6,1,5,31,1,11,14,18,249,44,134,66,94,12,13,11,6,31,1,1,37,3,28,44,254,171,17,0,0,0,1,255,252,255,239,2,194,1,203,0,65,0,51,64,48,50,1,0,1,1,74,31,10,2,1,72,65,62,61,39,22,18,6,0,71,6,5,3,2,4,0,0,1,93,7,4,2,1,1,101,0,76,66,45,19,50,27,20,34,19,8,12,28,43,54,2,39,38,39,39,55,23,50,54,55,23,7,6,6,21,20,22,23,51,55,54,55,38,38,35,39,55,23,50,54,55,23,7,6,6,21,20,22,23,51,54,55,54,54,53,52,38,35,35,39,55,50,22,51,55,7,6,6,7,3,7,3,35,3,7,168,87,17,17,49,2,6,80,38,69,10,2,6,33,24,70,13,4,59,32,14,11,31,29,2,6,80,37,70,10,2,6,34,23,70,13,4,44,14,25,33,19,22,37,4,5,9,54,36,82,7,20,24,18,140,54,90,6,110,55,31,1,25,54,49,1,4,33,1,6,1,5,31,1,11,14,19,249,44,148,77,40,34,32,4,33,1,4,1,5,31,1,10,13,18,249,45,113,32,62,88,12,14,11,6,31,2,1,37,2,29,44,254,171,17,1,39,254,234,17,0,255,255,255,252,255,239,2,194,2,203,0,34,1,220,0,0,0,3,7,194,2,42,0,0,255,255,255,252,255,239,2,194,2,191,0,34,1,220,0,0,0,3,7,197,2,41,0,0,255,255,255,252,255,239,2,194,2,127,0,34,1,220,0,0,0,3,7,186,2,40,0,0,255,255,255,252,255,239,2,194,2,202,0,34,1,220,0,0,0,3,7,193,2,43,0,0,0,1,0,8,255,250,1,209,1,200,0,79,0,56,64,53,67,53,49,28,13,7,6,0,3,1,74,40,1,2,72,79,1,1,71,4,1,3,3,2,93,5,1,2,2,101,75,0,0,0,1,95,6,1,1,1,99,1,76,92,50,28,19,94,78,17,7,12,27,43,23,55,54,54,53,52,39,39,6,6,21,20,22,23,23,7,38,38,35,34,6,7,39,55,62,2,55,55,39,38,38,39,39,55,50,22,51,50,54,55,23,7,34,6,21,20,22,23,23,55,54,54,53,52,38,35,39,55,51,50,54,55,23,7,6,7,7,23,22,22,23,23,7,34,38,35,34,6,7,254,6,25,21,17,73,49,52,17,27,2,6,10,50,23,21,33,6,3,6,22,30,35,6,86,76,34,39,35,2,6,11,61,29,36,58,8,2,6,24,21,15,9,55,61,18,13,18,25,2,5,73,22,42,7,3,6,27,57,86,92,26,46,29,2,6,10,53,28,25,75,12,1,31,1,9,11,13,24,102,60,67,12,10,6,2,4,33,1,3,2,1,5,31,12,28,41,7,100,108,49,32,6,4,34,2,3,1,5,31,9,10,9,25,13,80,77,21,21,9,8,5,4,33,2,1,5,32,9,66,101,131,38,34,3,4,34,2,5,1,0,0,0,0,1,255,247,255,14,1,197,1,203,0,47,0,52,64,49,26,6,2,0,1,2,1,6,0,2,74,17,1,2,72,4,3,2,1,1,2,93,5,1,2,2,101,75,0,0,0,6,95,0,6,6,109,6,76,24,51,42,20,34,22,19,7,12,27,43,22,38,53,55,50,54,55,38,39,38,38,39,39,55,23,50,54,55,23,7,6,6,21,20,22,22,23,51,18,53,52,35,35,39,55,22,22,51,55,7,6,6,7,3,14,2,39,28,36,5,56,97,35,77,47,9,33,26,2,6,83,37,73,10,2,6,34,23,39,42,7,4,115,38,46,2,6,9,62,31,85,7,22,23,11,127,52,66,64,45,241,47,10,7,93,84,244,124,25,22,1,4,33,1,6,1,5,31,1,11,14,16,134,133,20,1,19,24,26,4,33,1,3,1,37,4,23,30,254,208,126,122,49,1,255,255,255,247,255,15,1,197,2,203,0,34,1,226,0,0,0,3,7,194,1,174,0,0,255,255,255,247,255,15,1,197,2,191,0,34,1,226,0,0,0,3,7,197,1,173,0,0,255,255,255,247,255,15,1,197,2,127,0,34,1,226,0,0,0,3,7,186,1,172,0,0,255,255,255,247,255,15,1,197,2,180,0,34,1,226,0,0,0,3,7,191,1,166,0,0,255,255,255,247,255,15,1,197,1,203,0,34,1,226,0,0,0,3,7,213,2,31,0,0,255,255,255,247,255,15,1,197,2,202,0,34,1,226,0,0,0,3,7,193,1,175,0,0,255,255,255,247,255,15,1,197,2,239,0,34,1,226,0,0,0,3,7,208,1,211,0,0,255,255,255,247,255,15,1,197,2,121,0,34,1,226,0,0,0,3,7,205,1,165,0,0,255,255,255,247,255,15,1,197,2,180,0,34,1,226,0,0,0,2,8,9,67,0,0,0,0,1,0,36,255,250,1,160,1,206,0,28,0,50,64,47,20,5,2,2,0,24,1,3,2,2,74,8,1,1,72,27,1,3,71,0,0,0,1,93,0,1,1,101,75,0,2,2,3,93,0,3,3,99,3,76,25,20,39,32,4,12,24,43,1,7,6,6,7,7,54,54,55,55,31,2,6,6,7,55,54,54,55,55,14,2,21,7,37,7,39,1,52,125,49,37,5,39,2,8,1,6,128,210,8,92,154,40,148,40,44,10,40,1,8,8,16,254,231,52,10,1,158,6,3,37,50,6,14,91,40,5,8,5,21,118,215,60,9,3,57,62,5,7,50,72,32,16,9,5,25,0,255,255,0,36,255,250,1,160,2,203,0,34,1,236,0,0,0,3,7,194,1,179,0,0,255,255,0,36,255,250,1,160,2,198,0,34,1,236,0,0,0,3,7,198,1,179,0,0,255,255,0,36,255,250,1,160,2,180,0,34,1,236,0,0,0,3,7,191,1,178,0,0,255,255,0,36,255,64,1,160,1,206,0,34,1,236,0,0,0,3,7,213,1,150,0,0,0,1,0,41,255,249,0,229,1,201,0,31,0,49,64,46,14,1,0,1,26,1,3,2,2,74,13,1,1,72,31,1,3,71,0,0,0,1,93,0,1,1,58,75,0,2,2,3,93,0,3,3,59,3,76,52,41,34,38,4,9,24,43,55,54,54,53,19,52,38,35,7,39,55,23,50,55,7,14,2,7,3,20,22,51,50,54,51,23,7,38,35,34,7,46,32,23,1,11,16,24,2,5,82,41,47,2,21,18,7,1,7,11,18,9,16,5,2,6,58,16,51,57,35,6,24,29,1,23,22,16,1,4,39,1,5,42,3,10,21,24,254,244,29,19,2,3,42,2,7,0,0,0,1,0,41,255,252,2,2,2,218,0,57,0,63,64,60,46,1,6,5,50,37,2,0,6,35,3,2,1,0,17,1,3,2,4,74,0,5,0,6,0,5,6,103,4,1,1,1,0,93,0,0,0,58,75,0,2,2,3,93,0,3,3,59,3,76,43,38,24,115,54,34,32,7,9,27,43,19,51,55,23,7,39,35,20,7,6,21,20,22,51,50,54,51,23,7,34,38,35,39,34,6,35,55,62,2,53,53,38,38,39,39,55,55,52,54,54,51,50,22,22,21,23,6,6,7,7,52,38,38,35,34,6,7,181,200,56,5,9,37,216,2,2,22,23,28,34,5,2,7,4,53,26,42,42,61,9,5,28,24,5,1,28,34,4,7,60,68,111,65,41,71,48,2,4,24,13,11,43,64,36,71,64,2,1,193,2,8,45,2,51,100,100,51,25,30,2,4,45,3,1,2,39,2,19,32,37,235,25,16,2,6,34,11,88,124,62,22,26,1,9,4,33,21,3,2,31,27,90,83,0,0,255,255,0,38,255,15,1,250,2,203,0,34,1,79,0,0,0,35,7,194,1,51,0,0,0,35,1,97,1,26,0,0,0,3,7,194,2,65,0,0,0,1,0,41,255,252,1,235,2,230,0,55,0,67,64,64,20,1,2,1,33,22,11,3,3,2,9,1,0,3,48,1,6,5,4,74,55,1,6,71,0,1,0,2,3,1,2,103,4,1,0,0,3,95,0,3,3,58,75,0,5,5,6,93,0,6,6,59,6,76,83,53,36,35,41,38,23,7,9,27,43,55,62,2,53,53,38,38,39,39,55,55,52,54,54,51,50,22,22,23,23,7,7,52,38,38,35,34,6,7,7,50,54,55,23,7,38,38,35,20,7,6,21,20,51,50,54,51,23,7,35,38,35,34,6,7,51,26,24,7,1,28,34,4,7,60,64,110,68,37,62,36,4,2,26,11,45,64,36,66,59,2,1,51,74,11,3,10,10,70,50,2,2,49,26,32,4,2,7,24,36,28,51,83,14,35,3,20,36,33,235,25,16,2,6,34,11,93,129,64,15,16,3,9,73,3,2,31,27,96,89,49,2,1,3,53,1,2,50,100,102,49,55,1,4,42,2,3,1,0,0,0,0,1,255,236,0,0,2,41,1,241,0,36,0,163,181,15,1,1,8,1,74,75,176,10,80,88,64,31,9,1,8,0,1,0,8,112,0,6,7,5,2,0,8,6,0,101,4,2,2,1,1,3,93,0,3,3,59,3,76,27,75,176,12,80,88,64,42,7,1,5,6,0,0,5,112,9,1,8,0,1,0,8,112,0,1,2,2,1,110,0,6,0,0,8,6,0,103,4,1,2,2,3,94,0,3,3,59,3,76,27,64,43,7,1,5,6,0,0,5,112,9,1,8,0,1,0,8,1,126,0,1,2,2,1,110,0,6,0,0,8,6,0,103,4,1,2,2,3,94,0,3,3,59,3,76,89,89,64,17,0,0,0,36,0,36,17,17,22,17,17,22,36,36,10,9,28,43,1,52,54,53,52,35,34,6,21,20,22,51,50,54,55,55,6,6,7,51,21,33,53,51,38,38,53,52,54,55,35,53,33,21,35,6,7,1,151,2,112,78,90,94,81,53,63,14,50,3,14,4,90,253,195,153,45,47,64,57,182,2,61,80,13,3,1,87,3,22,14,70,103,90,100,114,53,61,4,12,80,36,35,35,31,101,66,74,119,36,35,35,61,55,0,0,2,255,236,0,0,2,104,1,241,0,22,0,39,0,110,75,176,10,80,88,181,31,1,1,0,1,74,27,181,31,1,7,6,1,74,89,75,176,10,80,88,64,24,0,5,6,4,2,0,1,5,0,101,8,7,3,3,1,1,2,93,0,2,2,59,2,76,27,64,35,0,6,0,7,0,6,112,8,1,7,1,1,7,110,0,5,4,1,0,6,5,0,101,3,1,1,1,2,94,0,2,2,59,2,76,89,64,16,23,23,23,39,23,38,37,17,37,33,17,22,16,9,9,27,43,1,35,22,22,21,20,6,7,51,21,33,53,51,50,54,53,19,52,38,35,35,53,33,2,54,53,52,38,35,34,6,7,6,6,7,6,21,20,22,51,2,104,166,50,55,67,59,187,253,132,80,34,28,1,12,17,114,2,124,238,89,119,115,16,11,1,1,2,1,8,42,58,1,206,31,102,61,73,123,37,35,35,32,34,1,63,25,17,35,254,60,105,98,100,104,7,11,30,44,16,190,42,39,28,0,0,0,1,255,236,0,0,1,83,1,241,0,25,0,39,64,36,0,4,6,5,2,3,0,4,3,101,2,1,0,0,1,93,0,1,1,59,1,76,0,0,0,25,0,24,17,37,33,17,39,7,9,25,43,18,6,7,6,6,21,20,22,51,51,21,33,53,51,50,54,53,19,52,38,35,35,53,33,21,35,225,20,1,4,7,14,21,111,254,153,78,39,25,1,11,19,113,1,103,80,1,206,10,22,78,209,54,32,22,35,35,26,34,1,76,24,11,35,35,0,0,0,1,255,236,0,0,1,206,1,241,0,35,0,47,64,44,15,1,0,4,1,74,0,5,7,6,2,4,0,5,4,101,3,1,2,0,0,2,93,0,2,2,59,2,76,0,0,0,35,0,34,17,37,33,17,24,40,8,9,26,43,18,6,6,7,6,21,20,22,22,51,50,54,54,55,55,23,6,6,7,51,21,33,53,51,50,54,53,19,52,38,35,35,53,33,21,35,235,22,8,2,10,9,27,29,46,47,23,9,44,3,2,10,6,50,254,30,89,32,21,1,12,18,113,1,226,204,1,206,11,25,27,134,174,25,23,8,20,50,52,5,6,9,63,49,35,35,22,33,1,74,25,17,35,35,0,0,4,255,236,0,0,2,223,1,241,0,28,0,37,0,48,0,58,0,66,64,63,55,44,33,3,0,3,1,74,0,4,10,6,9,5,4,3,0,4,3,101,11,8,7,2,4,0,0,1,93,0,1,1,59,1,76,50,49,29,29,0,0,49,58,50,58,41,39,29,37,29,37,0,28,0,27,17,40,33,17,39,12,9,25,43,0,6,21,20,22,23,22,22,51,51,21,33,53,51,50,54,55,54,18,53,52,38,38,35,35,53,33,21,35,33,30,2,23,51,54,54,55,0,22,51,51,39,38,39,35,6,2,21,5,50,54,53,52,38,39,35,6,7,2,89,18,14,7,4,16,20,91,253,13,70,28,17,4,9,28,9,22,27,98,2,243,101,254,120,28,52,32,4,5,9,68,42,254,178,12,14,140,8,76,50,5,4,23,1,94,25,17,21,4,5,55,78,1,206,10,20,26,230,68,44,29,35,35,18,31,72,1,6,15,14,12,3,35,35,88,145,83,10,23,181,122,254,96,11,21,205,126,48,254,245,13,24,15,19,18,254,46,140,212,0,0,0,0,2,255,236,0,0,2,33,1,241,0,18,0,33,0,93,75,176,25,80,88,64,30,0,7,3,0,0,7,112,0,4,6,8,5,3,3,7,4,3,103,2,1,0,0,1,94,0,1,1,59,1,76,27,64,31,0,7,3,0,3,7,0,126,0,4,6,8,5,3,3,7,4,3,103,2,1,0,0,1,94,0,1,1,59,1,76,89,64,18,0,0,33,32,26,23,0,18,0,17,17,36,17,17,19,9,9,25,43,0,6,7,3,51,21,33,53,51,38,39,38,38,35,35,53,33,21,35,2,18,53,52,38,35,35,34,6,6,21,20,18,23,51,1,226,19,9,154,245,253,203,220,68,54,7,28,30,33,2,53,39,206,95,16,28,121,31,27,9,81,15,9,1,206,15,24,254,124,35,35,230,158,23,16,35,35,254,212,1,2,17,16,9,2,8,9,16,254,221,52,0,4,255,236,0,0,2,74,1,241,0,25,0,27,0,45,0,59,0,47,64,44,56,45,40,16,3,5,0,3,1,74,0,4,6,5,2,3,0,4,3,101,7,2,2,0,0,1,93,0,1,1,59,1,76,61,58,17,17,38,33,17,38,8,9,28,43,0,6,7,7,23,22,22,51,51,21,33,53,51,50,54,55,55,39,38,38,35,35,53,33,21,35,55,35,6,54,55,54,54,53,52,38,35,35,34,6,21,20,22,23,22,23,7,7,6,6,21,20,51,51,54,54,53,52,38,39,1,236,33,33,103,114,26,47,36,40,253,162,33,31,64,47,88,110,21,48,35,49,2,94,71,15,1,226,17,10,36,34,16,23,111,25,18,34,38,5,12,28,70,22,17,45,103,31,24,9,7,1,203,30,40,128,156,36,34,35,35,56,55,105,154,31,26,35,35,1,155,22,13,45,46,10,10,8,11,14,8,51,54,8,16,88,88,28,28,10,23,1,12,13,7,25,10,0,1,0,41,255,252,1,198,2,230,0,54,0,67,64,64,19,1,2,1,23,10,2,3,2,33,8,2,0,3,47,1,6,5,4,74,54,1,6,71,0,1,0,2,3,1,2,103,4,1,0,0,3,93,0,3,3,58,75,0,5,5,6,93,0,6,6,59,6,76,84,38,34,34,43,38,22,7,9,27,43,55,54,54,53,53,38,38,39,39,55,55,52,54,54,51,50,22,22,23,23,6,6,7,7,46,2,35,34,6,21,51,55,23,7,39,35,20,7,6,21,20,22,51,50,54,51,23,7,35,38,35,34,6,7,51,36,21,1,28,34,4,7,60,61,104,65,30,51,29,4,2,3,19,9,11,4,31,51,29,69,47,190,56,5,9,37,206,2,2,23,28,20,26,4,2,7,22,32,27,51,81,13,35,5,37,47,238,25,16,2,6,34,11,93,129,64,8,9,2,9,5,37,23,3,3,18,16,117,117,2,8,45,2,51,100,100,51,26,29,2,4,43,2,3,1,0,0,0,1,0,36,255,244,3,158,2,230,0,101,0,226,75,176,10,80,88,64,37,85,83,2,4,9,34,1,8,4,76,42,2,5,8,88,62,47,46,16,5,6,1,4,74,63,1,6,1,73,84,1,9,72,5,1,0,71,27,64,37,85,83,2,4,9,34,1,8,4,76,42,2,5,8,88,62,47,46,16,5,6,1,4,74,63,1,6,1,73,84,1,9,72,5,1,7,71,89,75,176,10,80,88,64,56,0,9,0,4,8,9,4,103,0,5,5,8,95,10,1,8,8,63,75,0,1,1,8,95,10,1,8,8,63,75,0,6,6,0,93,7,3,2,0,0,59,75,11,1,2,2,0,93,7,3,2,0,0,59,0,76,27,64,53,0,9,0,4,8,9,4,103,0,5,5,8,95,10,1,8,8,63,75,0,1,1,8,95,10,1,8,8,63,75,11,1,2,2,0,93,3,1,0,0,59,75,0,6,6,7,95,0,7,7,62,7,76,89,64,18,101,99,91,89,82,80,37,40,36,45,39,66,38,40,49,12,9,29,43,37,7,38,35,34,7,55,54,54,55,55,54,38,35,34,6,7,6,21,20,22,51,55,23,7,38,35,34,7,55,54,54,53,17,39,38,35,34,21,20,22,23,23,14,2,7,7,53,52,38,35,34,6,21,20,22,51,50,54,54,55,23,23,14,2,35,34,38,53,52,54,54,51,50,23,38,53,52,54,51,50,23,55,23,6,6,7,54,51,50,22,21,20,7,6,21,20,22,51,55,3,158,8,66,23,38,65,4,29,26,1,6,2,45,40,25,73,29,3,16,20,35,2,9,69,22,35,64,6,29,23,3,84,46,81,40,47,3,1,9,10,1,41,45,37,61,66,73,63,25,50,34,4,6,11,7,47,61,22,95,114,61,105,65,18,8,36,77,70,46,62,89,6,7,13,4,114,36,65,72,7,9,16,19,35,40,43,3,12,41,8,30,27,198,49,55,32,23,112,131,31,25,2,4,43,3,2,41,3,24,28,2,3,54,28,78,37,76,55,7,5,37,61,35,3,31,37,45,87,80,87,101,15,15,3,2,31,5,32,30,120,101,71,117,67,1,81,61,64,71,17,19,13,11,192,140,78,68,61,20,72,117,28,29,27,2,0,0,0,1,0,36,255,244,2,226,2,229,0,83,0,95,64,92,63,1,8,6,29,1,1,8,49,34,33,2,4,4,1,3,1,0,4,4,74,50,1,4,1,73,0,7,0,2,6,7,2,103,9,3,2,1,1,6,95,0,6,6,63,75,9,3,2,1,1,8,93,0,8,8,58,75,11,10,2,4,4,0,95,5,1,0,0,62,0,76,0,0,0,83,0,82,78,77,21,37,37,40,36,46,40,21,37,12,9,29,43,36,54,55,23,6,6,35,34,38,53,53,52,38,39,39,55,54,55,54,53,52,38,35,34,6,21,20,22,23,23,14,2,7,7,53,52,38,35,34,6,21,20,22,51,50,54,54,55,23,23,14,2,35,34,38,53,52,54,54,51,50,23,38,53,52,54,51,50,22,21,20,7,7,55,23,7,39,6,21,20,22,51,2,160,38,13,10,29,60,12,68,56,24,33,4,5,31,32,5,58,58,51,57,45,43,3,1,9,10,1,41,45,37,61,66,73,63,25,50,34,4,6,11,7,47,61,22,95,114,61,105,65,15,8,36,92,78,82,86,1,6,150,3,9,145,7,35,43,56,11,7,26,23,37,55,66,246,27,22,1,6,31,15,25,30,36,71,74,53,43,36,81,35,7,5,37,61,35,3,31,37,45,87,80,87,101,15,15,3,2,31,5,32,30,120,101,71,117,67,1,62,60,68,88,94,94,24,12,70,5,3,53,3,110,140,51,42,0,0,0,1,0,41,255,15,1,239,2,230,0,67,0,69,64,66,47,1,5,4,61,51,37,3,6,5,62,35,2,0,6,20,1,2,1,4,74,67,27,2,2,71,0,4,0,5,6,4,5,103,3,1,0,0,6,95,0,6,6,58,75,0,1,1,2,93,0,2,2,59,2,76,34,43,39,23,83,53,40,7,9,27,43,5,55,54,54,53,17,52,38,38,35,35,20,7,6,21,20,51,50,54,51,23,7,34,38,35,34,6,7,55,54,53,17,38,38,39,39,55,55,52,54,55,54,51,50,22,22,23,23,6,6,7,7,52,38,38,35,34,6,21,50,54,55,23,6,17,20,6,7,1,77,2,42,32,13,27,45,144,2,2,49,26,32,4,2,7,14,74,36,35,67,10,5,57,1,28,34,4,7,60,111,88,21,22,37,62,36,4,2,3,19,9,11,42,62,36,75,53,175,100,34,5,17,65,62,222,8,42,106,104,1,54,29,22,3,50,102,102,50,55,1,4,42,2,3,1,39,8,51,1,12,25,16,2,6,34,11,122,147,14,3,15,16,3,9,6,42,27,3,2,32,28,116,115,3,9,12,29,254,75,71,118,38,0,0,0,0,1,0,41,255,244,2,37,2,230,0,80,0,80,64,77,47,1,5,4,62,51,39,3,6,5,63,37,2,0,6,33,1,1,0,73,20,2,2,1,5,74,80,27,2,2,71,0,5,5,4,95,0,4,4,100,75,3,1,0,0,6,95,0,6,6,101,75,7,1,1,1,2,95,8,1,2,2,99,2,76,53,39,35,42,38,25,83,53,40,9,12,29,43,37,62,2,53,53,52,38,38,35,35,20,7,6,21,20,51,50,54,51,23,7,34,38,35,34,6,7,55,62,2,53,53,38,38,39,39,55,55,52,54,54,51,50,22,23,23,6,6,7,7,52,38,38,35,34,6,7,7,50,54,55,23,6,6,21,20,22,51,50,54,51,23,7,38,38,35,34,6,7,1,97,25,23,8,10,28,31,160,2,2,49,26,32,4,2,7,14,74,36,35,67,10,5,24,24,9,2,25,36,4,7,60,60,112,76,34,59,40,2,3,19,9,11,42,62,36,63,63,1,1,182,99,33,5,9,14,16,19,11,20,4,2,8,9,50,30,26,67,10,29,7,18,37,39,218,24,22,8,50,102,102,50,55,1,4,42,2,3,1,39,3,17,37,35,235,24,18,1,6,34,11,87,129,70,15,19,9,6,42,27,3,2,32,28,91,94,46,4,8,12,21,216,117,30,26,2,4,43,1,2,10,2,0,0,0,1,0,41,255,244,2,45,2,230,0,72,0,80,64,77,34,30,2,6,3,66,56,23,3,7,6,21,1,2,7,17,1,0,2,44,6,2,1,0,5,74,51,13,2,1,71,0,6,6,3,95,0,3,3,100,75,8,1,2,2,7,95,0,7,7,101,75,4,1,0,0,1,95,5,1,1,1,99,1,76,36,34,42,53,42,39,23,83,49,9,12,29,43,54,22,51,50,54,51,23,7,34,38,35,34,6,7,55,54,53,17,38,38,39,39,55,55,53,52,54,54,51,50,23,54,54,55,23,6,2,21,20,22,51,50,54,51,23,7,38,38,35,34,6,7,55,54,54,53,17,39,38,38,35,34,7,7,50,54,55,23,7,38,38,35,3,176,25,26,24,31,5,2,7,14,74,36,35,67,10,5,57,2,24,37,4,7,60,56,102,68,53,46,29,39,6,6,11,17,16,19,11,20,4,2,8,9,50,30,26,67,10,4,30,26,1,24,70,29,110,1,1,52,74,12,3,10,11,71,50,4,70,27,2,4,43,2,3,1,39,8,51,1,14,23,17,1,6,34,11,4,86,127,69,17,6,9,2,13,17,254,119,221,30,26,2,4,43,1,2,10,2,41,8,31,26,2,20,14,19,24,185,49,2,1,3,53,1,2,254,211,0,1,0,49,255,244,2,202,2,229,0,98,0,97,64,94,28,1,3,8,61,60,33,2,4,10,1,3,1,5,10,57,1,0,5,4,74,0,7,0,2,6,7,2,103,0,3,3,6,95,0,6,6,63,75,9,1,1,1,8,93,0,8,8,58,75,11,1,10,10,0,95,4,1,0,0,62,75,0,5,5,0,95,4,1,0,0,62,0,76,0,0,0,98,0,97,93,92,21,36,43,42,43,47,40,21,37,12,9,29,43,36,54,55,23,6,6,35,34,38,53,53,52,38,39,39,55,54,55,54,53,52,38,35,34,6,21,20,22,23,23,6,6,7,7,52,54,53,52,38,35,34,6,21,20,22,23,22,22,21,20,6,6,35,34,38,38,39,39,54,54,55,55,20,22,51,50,54,53,52,38,39,38,38,53,52,54,54,51,51,38,53,52,54,51,50,22,21,20,7,7,55,23,7,39,6,21,20,22,51,2,136,38,13,10,29,60,12,68,56,24,33,4,5,35,28,5,63,61,53,56,40,39,2,2,14,3,37,2,39,43,34,47,41,46,81,59,50,85,48,32,53,30,4,3,3,8,1,35,44,53,38,52,47,69,57,52,48,84,52,9,32,93,80,87,89,1,6,150,3,9,145,7,35,43,56,11,7,26,23,37,55,66,246,27,22,1,6,31,18,22,35,25,72,79,54,42,36,79,34,5,10,71,41,3,3,18,8,36,33,32,23,24,42,24,43,59,38,38,66,39,9,10,2,7,15,94,25,5,66,54,34,25,25,41,37,29,60,36,40,65,37,61,56,70,90,100,92,21,11,70,5,3,53,3,110,140,51,42,0,0,0,0,1,0,9,255,244,3,190,2,230,0,89,0,81,64,78,61,33,2,9,4,76,44,16,3,2,1,2,74,73,72,68,67,64,63,6,8,72,5,1,0,71,7,1,4,4,8,93,0,8,8,56,75,0,1,1,9,95,0,9,9,63,75,10,5,2,2,2,0,93,6,3,2,0,0,59,0,76,89,87,79,77,24,22,67,37,23,66,38,40,49,11,9,29,43,37,7,38,35,34,7,55,54,54,55,55,54,38,35,34,6,7,6,21,20,22,51,55,23,7,38,35,34,7,55,54,54,53,17,38,38,39,6,2,21,20,22,51,50,55,23,7,39,39,34,7,55,62,2,53,17,14,2,7,7,54,55,55,23,33,55,39,55,54,54,55,23,6,6,7,54,51,50,22,21,20,7,6,21,20,22,51,55,3,190,8,66,23,38,65,4,29,26,1,6,2,45,40,25,73,29,3,16,20,35,2,9,69,22,35,64,6,29,23,25,83,116,6,10,26,31,31,24,3,9,33,114,47,90,8,50,38,12,86,60,22,9,47,12,3,9,83,1,76,93,4,6,26,55,9,6,7,13,4,114,36,65,72,7,9,16,19,35,40,43,3,12,41,8,30,27,198,49,55,32,23,112,131,31,25,2,4,43,3,2,41,3,24,28,1,219,17,10,2,60,254,208,122,37,31,3,4,46,1,2,4,43,4,17,45,57,1,180,4,14,44,64,4,95,78,8,11,9,65,10,5,13,2,13,11,192,140,78,68,61,20,72,117,28,29,27,2,0,0,0,2,0,0,255,249,1,250,1,251,0,47,0,53,0,53,64,50,1,1,2,1,1,74,51,50,32,3,4,72,47,1,2,71,5,1,4,0,0,1,4,0,101,0,1,1,2,93,3,1,2,2,39,2,76,49,48,48,53,49,53,79,83,38,55,6,7,24,43,5,55,54,54,53,52,39,39,38,35,34,7,7,6,21,20,22,51,51,23,7,38,38,35,34,6,35,55,54,54,55,19,55,23,20,18,23,22,22,23,23,7,34,38,35,34,6,7,39,50,55,39,35,7,1,25,3,42,29,7,24,20,63,29,57,28,7,22,25,43,3,6,10,71,34,32,51,9,6,22,26,13,157,71,7,91,36,10,31,34,2,5,10,54,27,41,74,11,45,35,38,61,7,73,2,36,3,12,14,16,18,77,1,6,74,23,5,16,14,4,38,1,4,2,41,3,25,30,1,141,13,1,4,254,204,101,29,23,3,4,36,2,6,1,223,4,194,198,0,0,0,255,255,0,0,255,249,1,250,2,248,0,34,2,4,0,0,1,7,7,194,1,169,0,45,0,8,177,2,1,176,45,176,51,43,0,0,255,255,0,0,255,249,1,250,2,195,0,34,2,4,0,0,1,7,7,199,1,198,0,45,0,8,177,2,1,176,45,176,51,43,0,0,255,255,0,0,255,249,1,250,3,73,0,34,2,4,0,0,1,7,8,43,1,198,0,45,0,8,177,2,2,176,45,176,51,43,0,0,255,255,0,0,255,64,1,250,2,195,0,34,2,4,0,0,0,35,7,213,1,195,0,0,1,7,7,199,1,198,0,45,0,8,177,3,1,176,45,176,51,43,0,0,255,255,0,0,255,249,1,250,3,53,0,34,2,4,0,0,1,7,8,44,1,199,0,25,0,8,177,2,2,176,25,176,51,43,0,0,255,255,0,0,255,249,1,250,3,77,0,34,2,4,0,0,1,7,8,45,1,199,0,25,0,8,177,2,2,176,25,176,51,43,0,0,255,255,0,0,255,249,1,250,3,40,0,34,2,4,0,0,1,7,8,46,1,199,0,25,0,8,177,2,2,176,25,176,51,43,0,0,255,255,0,0,255,249,1,250,2,243,0,34,2,4,0,0,1,7,7,198,1,198,0,45,0,8,177,2,1,176,45,176,51,43,0,0,255,255,0,0,255,249,1,250,2,215,0,34,2,4,0,0,1,7,7,197,1,204,0,24,0,8,177,2,1,176,24,176,51,43,0,0,255,255,0,0,255,249,1,250,3,53,0,34,2,4,0,0,1,7,8,47,1,204,0,45,0,8,177,2,2,176,45,176,51,43,0,0,255,255,0,0,255,64,1,250,2,215,0,34,2,4,0,0,0,35,7,213,1,195,0,0,1,7,7,197,1,204,0,24,0,8,177,3,1,176,24,176,51,43,0,0,255,255,0,0,255,249,1,250,3,46,0,34,2,4,0,0,1,7,8,48,1,205,0,45,0,8,177,2,2,176,45,176,51,43,0,0,255,255,0,0,255,249,1,250,3,66,0,34,2,4,0,0,1,7,8,49,1,195,0,45,0,8,177,2,2,176,45,176,51,43,0,0,255,255,0,0,255,249,1,250,3,56,0,34,2,4,0,0,1,7,8,50,1,198,0,45,0,8,177,2,2,176,45,176,51,43,0,0,255,255,0,0,255,249,1,250,2,238,0,34,2,4,0,0,1,7,7,209,1,165,0,45,0,8,177,2,2,176,45,176,51,43,0,0,255,255,0,0,255,249,1,250,2,172,0,34,2,4,0,0,1,7,7,186,1,198,0,45,0,8,177,2,2,176,45,176,51,43,0,0,255,255,0,0,255,64,1,250,1,251,0,35,7,213,1,186,0,0,0,2,2,4,0,0,255,255,0,0,255,249,1,250,2,247,0,34,2,4,0,0,1,7,7,193,1,199,0,45,0,8,177,2,1,176,45,176,51,43,0,0,255,255,0,0,255,249,1,250,2,229,0,39,7,208,1,206,255,246,1,2,2,4,0,0,0,9,177,0,1,184,255,246,176,51,43,0,255,255,0,0,255,249,1,250,2,195,0,34,2,4,0,0,1,7,7,210,1,177,0,45,0,8,177,2,1,176,45,176,51,43,0,0,255,255,0,53,255,247,3,91,1,251,0,34,2,180,0,0,0,3,2,180,1,203,0,0,255,255,0,0,255,249,1,250,2,166,0,34,2,4,0,0,1,7,7,205,1,197,0,45,0,8,177,2,1,176,45,176,51,43,0,0,255,255,0,0,255,15,2,3,1,251,0,47,7,217,2,95,255,249,62,53,1,2,2,4,0,0,0,9,177,0,1,184,255,249,176,51,43,0,0,0,255,255,0,0,255,249,1,250,2,221,0,34,2,4,0,0,1,7,7,200,1,204,0,25,0,8,177,2,2,176,25,176,51,43,0,0,255,255,0,0,255,249,1,250,3,34,0,34,2,4,0,0,0,47,7,232,1,169,255,177,57,170,1,15,7,227,1,161,0,45,57,153,0,17,177,2,2,184,255,177,176,51,43,177,4,1,176,45,176,51,43,0,255,255,0,0,255,249,1,250,2,221,0,34,2,4,0,0,1,7,7,201,1,197,0,45,0,8,177,2,1,176,45,176,51,43,0,0,0,2,0,4,255,249,2,155,1,251,0,84,0,89,0,84,64,81,86,58,57,55,54,43,42,7,8,2,70,61,6,3,0,5,84,1,1,0,3,74,38,1,3,72,82,1,1,71,0,8,2,5,2,8,5,126,0,5,0,2,5,0,124,4,1,2,2,3,93,0,3,3,38,75,6,1,0,0,1,95,7,1,1,1,39,1,76,24,89,36,24,44,66,40,66,45,9,7,29,43,36,54,53,52,38,39,39,15,2,6,21,20,22,51,23,7,38,38,35,34,6,7,39,50,54,55,19,38,38,35,7,39,55,51,22,51,50,55,23,6,6,7,7,52,54,53,52,38,38,35,34,6,6,7,23,55,55,23,15,2,23,22,22,51,50,54,54,55,55,23,6,6,7,7,39,38,35,35,34,6,7,39,55,55,39,35,7,55,1,53,29,4,1,13,79,73,53,12,21,24,42,5,11,76,32,17,34,6,5,3,33,15,195,2,10,9,27,3,6,28,52,68,179,70,3,2,14,3,48,2,16,48,59,25,21,7,1,24,92,77,4,10,72,85,21,5,30,31,60,51,22,6,45,3,3,15,4,5,48,98,80,29,40,73,10,2,2,52,23,8,91,65,38,15,20,12,29,6,88,6,10,97,23,11,13,11,1,41,1,4,2,1,34,40,26,1,92,8,6,1,4,38,2,9,5,11,78,45,4,4,19,10,26,21,7,3,10,11,166,9,12,6,49,3,7,121,29,24,12,37,45,4,5,11,81,44,5,1,4,6,1,5,36,218,161,170,4,0,255,255,0,4,255,249,2,155,2,248,0,34,2,31,0,0,1,7,7,194,2,109,0,45,0,8,177,2,1,176,45,176,51,43,0,0,0,3,0,54,255,247,1,210,1,246,0,36,0,51,0,62,0,121,64,14,51,1,5,0,25,1,8,5,2,74,2,1,3,71,75,176,30,80,88,64,33,0,5,0,8,7,5,8,101,6,1,0,0,1,95,2,1,1,1,38,75,0,7,7,3,95,9,4,2,3,3,39,3,76,27,64,37,0,5,0,8,7,5,8,101,6,1,0,0,1,95,2,1,1,1,38,75,9,1,4,4,39,75,0,7,7,3,95,0,3,3,39,3,76,89,64,21,0,0,62,61,56,54,46,45,39,38,0,36,0,35,43,17,82,41,10,7,24,43,50,6,7,55,54,54,53,19,52,38,35,7,39,55,50,22,51,50,54,55,50,22,21,20,6,7,22,22,21,20,6,6,35,34,39,38,35,18,22,23,20,54,54,53,52,38,35,34,6,7,6,7,7,20,22,51,50,54,53,52,38,39,7,128,64,10,5,37,26,1,12,17,28,3,6,11,58,28,29,63,12,79,86,51,42,55,69,53,91,54,16,32,44,22,56,55,19,40,32,67,70,8,5,1,5,2,5,40,49,47,53,52,51,83,7,2,41,7,27,32,1,64,24,17,1,4,38,2,3,1,62,58,40,64,16,11,61,45,42,70,41,4,4,1,21,4,1,2,20,42,35,47,44,7,10,63,100,186,28,23,48,42,39,50,9,1,0,0,0,0,1,0,41,255,247,1,228,1,251,0,39,0,99,64,10,11,1,2,0,31,1,3,1,2,74,75,176,8,80,88,64,30,0,1,2,3,2,1,3,126,0,2,2,0,95,0,0,0,38,75,0,3,3,4,95,5,1,4,4,39,4,76,27,64,30,0,1,2,3,2,1,3,126,0,2,2,0,95,0,0,0,38,75,0,3,3,4,95,5,1,4,4,41,4,76,89,64,13,0,0,0,39,0,38,36,36,24,37,6,7,24,43,22,38,53,52,54,54,51,50,22,22,23,23,14,2,7,7,52,54,53,52,35,34,6,21,20,22,51,50,54,55,55,6,6,7,7,14,2,35,173,132,73,131,83,30,65,45,6,4,1,8,10,2,50,2,112,78,90,95,80,53,63,14,50,3,15,3,6,6,45,76,44,9,130,112,79,125,70,8,10,1,6,5,37,60,34,3,3,22,14,70,103,90,100,118,57,61,4,12,84,37,8,2,15,14,0,0,0,255,255,0,41,255,247,1,228,2,248,0,34,2,34,0,0,1,7,7,194,1,211,0,45,0,8,177,1,1,176,45,176,51,43,0,0,255,255,0,41,255,247,1,228,2,243,0,34,2,34,0,0,1,7,7,198,1,240,0,45,0,8,177,1,1,176,45,176,51,43,0,0,255,255,0,41,255,23,1,228,1,251,0,34,2,34,0,0,0,3,7,216,1,229,0,0,255,255,0,41,255,23,1,228,2,248,0,34,2,34,0,0,0,35,7,216,1,229,0,0,1,7,7,194,1,211,0,45,0,8,177,2,1,176,45,176,51,43,0,0,255,255,0,41,255,247,1,228,2,215,0,34,2,34,0,0,1,7,7,197,1,246,0,24,0,8,177,1,1,176,24,176,51,43,0,0,255,255,0,41,255,247,1,228,2,225,0,34,2,34,0,0,1,7,7,191,1,240,0,45,0,8,177,1,1,176,45,176,51,43,0,0,0,2,0,55,255,247,2,43,1,245,0,32,0,47,1,39,75,176,8,80,88,64,14,17,1,1,2,35,1,4,1,2,74,5,1,3,71,27,75,176,10,80,88,64,14,17,1,1,2,35,1,4,1,2,74,5,1,0,71,27,75,176,11,80,88,64,14,17,1,1,2,35,1,4,1,2,74,5,1,3,71,27,75,176,27,80,88,64,14,17,1,1,2,35,1,4,1,2,74,5,1,0,71,27,64,14,17,1,1,2,35,1,4,1,2,74,5,1,3,71,89,89,89,89,75,176,8,80,88,64,28,6,5,2,1,1,2,93,0,2,2,38,75,0,0,0,39,75,0,4,4,3,95,0,3,3,39,3,76,27,75,176,10,80,88,64,24,6,5,2,1,1,2,93,0,2,2,38,75,0,4,4,0,95,3,1,0,0,39,0,76,27,75,176,11,80,88,64,28,6,5,2,1,1,2,93,0,2,2,38,75,0,0,0,39,75,0,4,4,3,95,0,3,3,41,3,76,27,75,176,27,80,88,64,24,6,5,2,1,1,2,93,0,2,2,38,75,0,4,4,0,95,3,1,0,0,39,0,76,27,64,28,6,5,2,1,1,2,93,0,2,2,38,75,0,0,0,39,75,0,4,4,3,95,0,3,3,41,3,76,89,89,89,89,64,14,33,33,33,47,33,46,40,22,116,41,33,7,7,25,43,4,38,35,34,6,7,55,54,54,53,19,52,38,35,34,6,35,39,55,50,22,51,50,54,51,50,22,22,21,20,6,6,35,2,6,7,2,21,20,22,22,51,50,54,53,52,38,35,1,2,79,27,26,62,9,5,36,26,1,12,17,9,16,3,2,6,10,53,27,36,76,14,80,122,67,75,130,79,54,11,1,12,16,40,39,84,95,120,114,7,7,7,2,42,6,28,32,1,62,25,17,2,5,38,2,3,58,105,70,78,126,73,1,207,7,11,254,231,49,27,29,11,110,99,101,105,0,0,0,0,2,0,18,255,247,2,50,1,245,0,38,0,57,1,118,75,176,8,80,88,64,19,23,1,3,4,56,1,2,3,40,13,2,1,2,3,74,5,1,5,71,27,75,176,10,80,88,64,19,23,1,3,4,56,1,2,3,40,13,2,1,2,3,74,5,1,0,71,27,75,176,11,80,88,64,19,23,1,3,4,56,1,2,3,40,13,2,1,2,3,74,5,1,5,71,27,75,176,27,80,88,64,19,23,1,3,4,56,1,2,3,40,13,2,1,2,3,74,5,1,0,71,27,64,19,23,1,3,4,56,1,2,3,40,13,2,1,2,3,74,5,1,5,71,89,89,89,89,75,176,8,80,88,64,38,10,9,2,2,6,1,1,7,2,1,101,8,1,3,3,4,93,0,4,4,38,75,0,0,0,39,75,0,7,7,5,95,0,5,5,39,5,76,27,75,176,10,80,88,64,34,10,9,2,2,6,1,1,7,2,1,101,8,1,3,3,4,93,0,4,4,38,75,0,7,7,0,95,5,1,0,0,39,0,76,27,75,176,11,80,88,64,38,10,9,2,2,6,1,1,7,2,1,101,8,1,3,3,4,93,0,4,4,38,75,0,0,0,39,75,0,7,7,5,95,0,5,5,41,5,76,27,75,176,27,80,88,64,34,10,9,2,2,6,1,1,7,2,1,101,8,1,3,3,4,93,0,4,4,38,75,0,7,7,0,95,5,1,0,0,39,0,76,27,64,38,10,9,2,2,6,1,1,7,2,1,101,8,1,3,3,4,93,0,4,4,38,75,0,0,0,39,75,0,7,7,5,95,0,5,5,41,5,76,89,89,89,89,64,18,39,39,39,57,39,57,36,36,19,22,117,19,18,24,33,11,7,29,43,4,38,35,34,6,7,55,62,2,53,53,35,39,55,51,53,52,38,35,34,6,35,39,55,50,22,51,50,54,51,50,22,22,21,20,6,6,35,19,23,7,35,7,20,22,22,51,50,54,53,52,38,35,34,6,7,7,1,9,79,27,26,62,9,5,29,25,9,106,6,7,105,11,18,8,16,3,3,6,10,53,28,35,76,15,79,121,68,75,130,79,57,5,5,131,3,16,40,38,84,95,120,114,16,11,1,7,7,7,7,2,42,5,15,34,37,109,5,32,147,25,17,2,5,38,2,3,58,106,69,78,126,73,1,23,5,32,127,27,28,12,110,99,101,105,7,11,166,0,0,255,255,0,55,255,247,2,43,2,243,0,34,2,41,0,0,1,7,7,198,1,241,0,45,0,8,177,2,1,176,45,176,51,43,0,0,0,2,0,18,255,247,2,50,1,245,0,38,0,57,1,118,75,176,8,80,88,64,19,23,1,3,4,56,1,2,3,40,13,2,1,2,3,74,5,1,5,71,27,75,176,10,80,88,64,19,23,1,3,4,56,1,2,3,40,13,2,1,2,3,74,5,1,0,71,27,75,176,11,80,88,64,19,23,1,3,4,56,1,2,3,40,13,2,1,2,3,74,5,1,5,71,27,75,176,27,80,88,64,19,23,1,3,4,56,1,2,3,40,13,2,1,2,3,74,5,1,0,71,27,64,19,23,1,3,4,56,1,2,3,40,13,2,1,2,3,74,5,1,5,71,89,89,89,89,75,176,8,80,88,64,38,10,9,2,2,6,1,1,7,2,1,101,8,1,3,3,4,93,0,4,4,38,75,0,0,0,39,75,0,7,7,5,95,0,5,5,39,5,76,27,75,176,10,80,88,64,34,10,9,2,2,6,1,1,7,2,1,101,8,1,3,3,4,93,0,4,4,38,75,0,7,7,0,95,5,1,0,0,39,0,76,27,75,176,11,80,88,64,38,10,9,2,2,6,1,1,7,2,1,101,8,1,3,3,4,93,0,4,4,38,75,0,0,0,39,75,0,7,7,5,95,0,5,5,41,5,76,27,75,176,27,80,88,64,34,10,9,2,2,6,1,1,7,2,1,101,8,1,3,3,4,93,0,4,4,38,75,0,7,7,0,95,5,1,0,0,39,0,76,27,64,38,10,9,2,2,6,1,1,7,2,1,101,8,1,3,3,4,93,0,4,4,38,75,0,0,0,39,75,0,7,7,5,95,0,5,5,41,5,76,89,89,89,89,64,18,39,39,39,57,39,57,36,36,19,22,117,19,18,24,33,11,7,29,43,4,38,35,34,6,7,55,62,2,53,53,35,39,55,51,53,52,38,35,34,6,35,39,55,50,22,51,50,54,51,50,22,22,21,20,6,6,35,19,23,7,35,7,20,22,22,51,50,54,53,52,38,35,34,6,7,7,1,9,79,27,26,62,9,5,29,25,9,106,6,7,105,11,18,8,16,3,3,6,10,53,28,35,76,15,79,121,68,75,130,79,57,5,5,131,3,16,40,38,84,95,120,114,16,11,1,7,7,7,7,2,42,5,15,34,37,109,5,32,147,25,17,2,5,38,2,3,58,106,69,78,126,73,1,23,5,32,127,27,28,12,110,99,101,105,7,11,166,0,0,255,255,0,55,255,64,2,43,1,245,0,34,2,41,0,0,0,3,7,213,1,238,0,0,255,255,0,55,255,93,2,43,1,245,0,34,2,41,0,0,0,3,7,219,1,240,0,0,255,255,0,55,255,247,4,20,2,243,0,34,2,41,0,0,0,35,2,245,2,84,0,0,1,7,7,198,4,16,0,45,0,8,177,3,1,176,45,176,51,43,0,0,0,1,0,54,255,248,1,197,1,251,0,65,0,65,64,62,37,36,20,19,4,3,0,55,43,2,5,4,2,74,15,1,1,72,65,1,6,71,0,3,0,4,5,3,4,101,2,1,0,0,1,93,0,1,1,38,75,0,5,5,6,93,0,6,6,39,6,76,73,38,68,36,44,66,38,7,7,27,43,55,54,54,53,19,52,38,35,7,39,55,50,22,51,50,55,23,6,6,7,7,52,54,53,52,38,38,35,34,6,6,7,7,23,50,54,55,23,7,34,38,35,34,7,6,21,20,22,22,51,50,54,54,55,55,23,6,6,7,7,38,38,35,34,6,7,59,37,26,1,12,18,27,2,6,12,70,41,167,80,3,2,14,3,48,2,15,47,58,27,20,6,1,6,82,18,70,11,4,12,11,65,36,28,35,3,7,25,29,65,56,23,7,44,4,3,15,4,6,27,170,53,41,70,10,34,4,28,34,1,61,25,17,1,4,38,2,9,5,11,78,45,4,4,19,10,26,21,7,3,11,15,142,1,7,1,5,52,2,5,76,61,23,18,6,12,37,45,4,5,11,81,44,5,1,4,7,1,0,0,0,255,255,0,54,255,248,1,197,2,248,0,34,2,48,0,0,1,7,7,194,1,170,0,45,0,8,177,1,1,176,45,176,51,43,0,0,255,255,0,54,255,248,1,197,2,185,0,34,2,48,0,0,1,7,7,199,1,222,0,35,0,8,177,1,1,176,35,176,51,43,0,0,255,255,0,54,255,248,1,197,2,243,0,34,2,48,0,0,1,7,7,198,1,199,0,45,0,8,177,1,1,176,45,176,51,43,0,0,255,255,0,54,255,23,1,197,2,195,0,34,2,48,0,0,0,35,7,216,1,212,0,0,1,7,7,199,1,199,0,45,0,8,177,2,1,176,45,176,51,43,0,0,255,255,0,54,255,248,1,197,2,215,0,34,2,48,0,0,1,7,7,197,1,205,0,24,0,8,177,1,1,176,24,176,51,43,0,0,255,255,0,54,255,248,1,202,3,8,0,34,2,48,0,0,0,3,8,47,1,212,0,0,255,255,0,54,255,64,1,197,2,215,0,34,2,48,0,0,0,35,7,213,1,194,0,0,1,7,7,197,1,205,0,24,0,8,177,2,1,176,24,176,51,43,0,0,255,255,0,54,255,248,1,197,3,46,0,34,2,48,0,0,1,7,8,48,1,206,0,45,0,8,177,1,2,176,45,176,51,43,0,0,255,255,0,54,255,248,1,197,3,66,0,34,2,48,0,0,1,7,8,49,1,196,0,45,0,8,177,1,2,176,45,176,51,43,0,0,255,255,0,54,255,248,1,197,3,56,0,34,2,48,0,0,1,7,8,50,1,199,0,45,0,8,177,1,2,176,45,176,51,43,0,0,255,255,0,54,255,248,1,197,2,238,0,34,2,48,0,0,1,7,7,209,1,166,0,45,0,8,177,1,2,176,45,176,51,43,0,0,255,255,0,54,255,248,1,197,2,172,0,34,2,48,0,0,1,7,7,186,1,199,0,45,0,8,177,1,2,176,45,176,51,43,0,0,255,255,0,54,255,248,1,197,2,225,0,34,2,48,0,0,1,7,7,191,1,199,0,45,0,8,177,1,1,176,45,176,51,43,0,0,255,255,0,54,255,64,1,197,1,251,0,34,2,48,0,0,0,3,7,213,1,194,0,0,255,255,0,54,255,248,1,197,2,247,0,34,2,48,0,0,1,7,7,193,1,200,0,45,0,8,177,1,1,176,45,176,51,43,0,0,255,255,0,54,255,248,1,197,3,8,0,34,2,48,0,0,1,7,7,208,1,200,0,25,0,8,177,1,1,176,25,176,51,43,0,0,255,255,0,54,255,248,1,197,2,195,0,34,2,48,0,0,1,7,7,210,1,178,0,45,0,8,177,1,1,176,45,176,51,43,0,0,255,255,0,54,255,248,1,197,2,166,0,34,2,48,0,0,1,7,7,205,1,198,0,45,0,8,177,1,1,176,45,176,51,43,0,0,255,255,0,54,255,248,1,197,3,24,0,34,2,48,0,0,0,39,7,205,1,198,255,241,1,7,7,227,1,158,255,207,0,18,177,1,1,184,255,241,176,51,43,177,2,1,184,255,207,176,51,43,255,255,0,54,255,248,1,197,3,24,0,34,2,48,0,0,0,39,7,205,1,198,255,241,1,7,7,226,1,245,255,207,0,18,177,1,1,184,255,241,176,51,43,177,2,1,184,255,207,176,51,43,255,255,0,54,255,7,1,204,1,251,0,34,2,48,0,0,1,7,7,217,2,43,255,248,0,9,177,1,1,184,255,248,176,51,43,0,255,255,0,54,255,248,1,197,2,221,0,34,2,48,0,0,1,7,7,201,1,198,0,45,0,8,177,1,1,176,45,176,51,43,0,0,0,2,0,29,255,245,2,10,1,249,0,24,0,31,0,193,64,15,19,1,1,2,11,1,4,1,2,74,21,1,2,1,73,75,176,8,80,88,64,31,0,1,0,4,5,1,4,101,0,2,2,3,95,6,1,3,3,38,75,7,1,5,5,0,95,0,0,0,39,0,76,27,75,176,12,80,88,64,31,0,1,0,4,5,1,4,101,0,2,2,3,95,6,1,3,3,38,75,7,1,5,5,0,95,0,0,0,41,0,76,27,75,176,14,80,88,64,31,0,1,0,4,5,1,4,101,0,2,2,3,95,6,1,3,3,38,75,7,1,5,5,0,95,0,0,0,39,0,76,27,64,31,0,1,0,4,5,1,4,101,0,2,2,3,95,6,1,3,3,38,75,7,1,5,5,0,95,0,0,0,41,0,76,89,89,89,64,20,25,25,0,0,25,31,25,30,28,27,0,24,0,23,34,20,38,8,7,23,43,0,22,22,21,20,6,6,35,34,38,38,39,55,33,38,38,35,34,6,7,39,39,54,54,51,18,54,55,5,22,22,51,1,92,110,64,70,123,75,66,102,56,1,9,1,142,5,100,79,34,84,35,7,11,65,88,46,63,85,7,254,196,14,85,61,1,249,64,113,71,74,122,72,59,109,72,17,86,100,17,15,1,31,41,32,254,46,90,74,5,75,84,0,0,0,0,1,0,54,255,247,1,171,1,251,0,58,0,76,64,73,37,36,2,4,2,43,1,6,5,51,1,7,6,3,74,16,15,2,1,72,58,1,7,71,0,2,0,4,0,2,4,126,0,4,0,5,6,4,5,101,3,1,0,0,1,93,0,1,1,38,75,0,6,6,7,95,0,7,7,39,7,76,53,36,68,36,38,21,66,38,8,7,28,43,55,54,54,53,19,52,38,35,7,39,55,50,22,51,50,55,23,6,6,7,7,52,54,53,52,38,38,35,34,6,6,7,7,23,50,54,55,23,7,34,38,35,34,7,7,20,22,51,50,54,51,23,7,38,38,35,34,6,7,59,38,25,1,12,18,27,2,6,12,70,41,155,75,4,2,14,3,48,2,13,42,49,27,20,6,1,7,83,16,60,10,4,11,10,58,32,28,35,3,14,22,16,34,6,3,7,13,73,38,29,64,10,32,7,27,34,1,61,25,17,1,4,38,2,9,5,11,80,45,3,4,20,10,26,21,7,3,11,15,155,1,7,1,5,53,2,5,118,31,21,3,5,44,1,2,7,2,0,255,255,0,54,255,247,2,205,1,251,0,34,2,72,0,0,0,3,2,87,1,190,0,0,255,255,0,54,255,247,3,108,1,251,0,34,2,72,0,0,0,3,2,112,1,190,0,0,0,1,0,41,255,247,1,243,1,251,0,56,0,105,64,15,11,1,1,0,16,15,2,4,1,46,1,3,4,3,74,75,176,8,80,88,64,30,0,4,0,3,2,4,3,103,0,1,1,0,95,0,0,0,38,75,0,2,2,5,95,6,1,5,5,39,5,76,27,64,30,0,4,0,3,2,4,3,103,0,1,1,0,95,0,0,0,38,75,0,2,2,5,95,6,1,5,5,41,5,76,89,64,14,0,0,0,56,0,55,82,38,36,46,37,7,7,25,43,22,38,53,52,54,54,51,50,22,22,23,23,14,2,7,7,52,54,53,52,38,35,34,6,21,20,22,51,50,54,54,55,53,52,38,35,35,39,55,50,22,51,50,54,55,23,6,6,21,20,23,7,14,2,35,172,131,72,131,86,31,71,51,7,4,1,9,9,2,49,2,54,61,89,95,94,80,28,46,27,3,17,26,53,2,8,4,67,35,23,45,6,4,16,11,5,5,7,51,84,48,9,131,111,82,124,68,8,10,1,6,5,37,59,33,4,4,23,15,35,31,99,94,101,117,12,12,2,88,25,16,4,44,2,3,1,22,12,50,61,45,23,8,3,16,15,0,0,0,255,255,0,41,255,247,1,243,2,195,0,34,2,75,0,0,1,7,7,199,1,246,0,45,0,8,177,1,1,176,45,176,51,43,0,0,255,255,0,41,255,247,1,243,2,243,0,34,2,75,0,0,1,7,7,198,1,246,0,45,0,8,177,1,1,176,45,176,51,43,0,0,255,255,0,41,255,247,1,243,2,225,0,34,2,75,0,0,1,7,7,197,1,239,0,34,0,8,177,1,1,176,34,176,51,43,0,0,255,255,0,41,254,219,1,243,1,251,0,34,2,75,0,0,0,3,7,215,1,243,0,0,255,255,0,41,255,247,1,243,2,225,0,34,2,75,0,0,1,7,7,191,1,246,0,45,0,8,177,1,1,176,45,176,51,43,0,0,255,255,0,41,255,247,1,243,2,166,0,34,2,75,0,0,1,7,7,205,1,245,0,45,0,8,177,1,1,176,45,176,51,43,0,0,0,1,0,54,255,247,2,74,1,249,0,82,0,72,64,69,25,21,2,2,0,52,1,6,5,2,74,38,16,2,1,72,0,2,9,1,8,5,2,8,103,3,1,0,0,1,95,4,1,1,1,38,75,10,7,2,5,5,6,93,11,1,6,6,39,6,76,81,76,72,70,67,66,36,17,68,43,51,36,40,66,38,12,7,29,43,55,54,54,53,19,52,38,35,7,39,55,50,22,51,50,54,55,7,14,2,7,7,23,50,55,55,52,38,35,7,39,55,22,22,51,50,54,55,7,6,6,7,6,6,21,20,22,51,50,54,51,23,7,34,38,35,7,55,50,54,54,53,53,39,34,6,7,7,20,22,51,50,54,55,23,7,34,38,35,34,6,7,59,37,26,1,12,18,27,3,6,10,55,28,23,64,10,4,24,20,7,2,5,130,53,62,1,12,18,28,2,6,9,52,25,24,69,11,3,31,20,1,4,7,14,21,12,20,3,3,8,11,61,33,100,8,26,25,10,115,16,98,17,3,14,21,12,20,3,2,7,8,45,25,37,88,1,32,7,27,33,1,62,25,17,1,4,38,2,6,1,41,4,11,23,28,121,1,7,134,25,17,1,4,38,1,1,6,1,41,4,17,23,79,195,53,32,21,2,4,40,2,1,40,13,33,33,112,1,7,1,130,32,22,2,1,4,40,2,6,3,0,0,2,0,41,255,247,2,83,1,249,0,91,0,98,0,105,64,102,90,46,2,7,8,98,1,17,7,9,1,1,0,3,74,83,61,2,10,72,14,11,2,8,16,18,15,3,7,17,8,7,101,0,17,4,1,3,0,17,3,103,12,1,9,9,10,95,13,1,10,10,38,75,5,2,2,0,0,1,93,6,1,1,1,39,1,76,0,0,97,95,94,92,0,91,0,91,89,88,81,78,75,73,70,67,59,55,53,51,18,22,84,35,17,36,17,68,36,19,7,29,43,1,6,21,20,22,51,50,54,51,23,7,34,38,35,7,55,50,54,54,53,53,39,34,6,7,7,20,22,51,50,54,55,23,7,34,38,35,34,6,7,55,54,54,53,55,35,39,55,51,53,52,38,35,7,39,55,50,22,51,50,54,55,7,14,2,7,7,51,50,55,53,52,38,35,7,39,55,22,22,51,50,54,55,7,6,6,7,7,55,23,7,7,35,35,7,23,50,55,2,6,7,14,21,12,20,3,3,8,11,61,33,100,8,26,25,10,115,16,98,17,3,14,21,12,20,3,2,7,8,45,25,37,88,1,5,37,26,1,73,7,6,74,12,18,27,3,6,10,55,28,23,64,10,4,24,20,7,2,1,137,69,36,12,18,28,2,6,9,52,25,24,69,11,3,31,20,1,2,64,11,4,150,123,120,3,130,53,62,1,91,164,90,32,21,2,4,40,2,1,40,13,33,33,102,1,7,1,120,32,22,2,1,4,40,2,6,3,41,7,27,33,246,7,33,32,25,17,1,4,38,2,6,1,41,4,11,23,28,14,1,32,25,17,1,4,38,1,1,6,1,41,4,17,23,34,2,10,31,1,79,1,7,0,255,255,0,54,255,59,2,74,1,249,0,34,2,82,0,0,0,3,7,218,2,7,0,0,255,255,0,54,255,247,2,74,2,251,0,34,2,82,0,0,1,7,7,197,2,6,0,60,0,8,177,1,1,176,60,176,51,43,0,0,255,255,0,54,255,64,2,74,1,249,0,34,2,82,0,0,0,3,7,213,2,4,0,0,0,1,0,53,255,247,1,15,1,249,0,37,0,49,64,46,20,1,2,0,30,1,3,2,2,74,16,1,1,72,37,1,3,71,0,0,0,1,93,0,1,1,38,75,0,2,2,3,93,0,3,3,39,3,76,68,43,66,38,4,7,24,43,55,54,54,53,19,52,38,35,7,39,55,50,22,51,50,54,55,7,6,6,7,6,6,21,20,22,51,50,54,55,23,7,34,38,35,34,6,7,58,38,26,1,12,18,33,2,5,6,53,43,23,67,10,4,33,22,2,4,7,14,21,14,23,4,2,7,12,66,33,27,63,10,32,7,27,33,1,62,25,17,1,4,38,2,6,1,41,4,17,23,80,194,53,32,22,2,1,4,40,2,7,2,0,0,0,0,1,0,53,255,247,1,15,1,249,0,37,0,49,64,46,20,1,2,0,30,1,3,2,2,74,16,1,1,72,37,1,3,71,0,0,0,1,93,0,1,1,46,75,0,2,2,3,93,0,3,3,47,3,76,68,43,66,38,4,8,24,43,55,54,54,53,19,52,38,35,7,39,55,50,22,51,50,54,55,7,6,6,7,6,6,21,20,22,51,50,54,55,23,7,34,38,35,34,6,7,58,38,26,1,12,18,33,2,5,6,53,43,23,67,10,4,33,22,2,4,7,14,21,14,23,4,2,7,12,66,33,27,63,10,32,7,27,33,1,62,25,17,1,4,38,2,6,1,41,4,17,23,80,194,53,32,22,2,1,4,40,2,7,2,0,0,0,255,255,0,53,255,247,1,15,2,248,0,34,2,87,0,0,1,7,7,194,1,76,0,45,0,8,177,1,1,176,45,176,51,43,0,0,255,255,0,53,255,141,2,52,2,248,0,34,2,87,0,0,0,39,7,194,1,76,0,45,0,35,2,106,1,63,0,0,1,7,7,194,2,123,0,45,0,16,177,1,1,176,45,176,51,43,177,3,1,176,45,176,51,43,0,0,255,255,0,45,255,247,1,29,2,185,0,34,2,87,0,0,1,7,7,199,1,108,0,35,0,8,177,1,1,176,35,176,51,43,0,0,255,255,0,10,255,247,1,58,2,243,0,34,2,87,0,0,1,7,7,198,1,105,0,45,0,8,177,1,1,176,45,176,51,43,0,0,255,255,0,23,255,247,1,57,2,215,0,34,2,87,0,0,1,7,7,197,1,111,0,24,0,8,177,1,1,176,24,176,51,43,0,0,255,255,255,250,255,247,1,48,2,238,0,34,2,87,0,0,1,7,7,209,1,72,0,45,0,8,177,1,2,176,45,176,51,43,0,0,255,255,0,43,255,247,1,24,2,162,0,34,2,87,0,0,1,7,7,242,1,88,0,35,0,8,177,1,2,176,35,176,51,43,0,0,255,255,0,33,255,247,1,34,3,30,0,34,2,87,0,0,1,7,7,222,1,105,255,116,0,9,177,1,3,184,255,116,176,51,43,0,255,255,0,53,255,247,1,15,2,225,0,34,2,87,0,0,1,7,7,191,1,105,0,45,0,8,177,1,1,176,45,176,51,43,0,0,255,255,0,53,255,64,1,15,1,249,0,35,7,213,1,104,0,0,0,2,2,87,0,0,255,255,0,35,255,247,1,15,2,247,0,34,2,87,0,0,1,7,7,193,1,106,0,45,0,8,177,1,1,176,45,176,51,43,0,0,255,255,0,53,255,247,1,15,2,249,0,39,7,208,1,115,0,10,1,2,2,87,0,0,0,8,177,0,1,176,10,176,51,43,0,0,255,255,0,42,255,247,1,26,2,195,0,34,2,87,0,0,1,7,7,210,1,84,0,45,0,8,177,1,1,176,45,176,51,43,0,0,255,255,0,53,255,141,2,94,1,249,0,34,2,87,0,0,0,3,2,106,1,105,0,0,255,255,0,12,255,247,1,55,2,166,0,34,2,87,0,0,1,7,7,205,1,104,0,45,0,8,177,1,1,176,45,176,51,43,0,0,255,255,0,53,255,13,1,22,1,249,0,39,7,217,1,116,255,252,1,2,2,87,0,0,0,9,177,0,1,184,255,252,176,51,43,0,255,255,0,9,255,247,1,62,2,215,0,34,2,87,0,0,1,6,8,9,220,35,0,8,177,1,1,176,35,176,51,43,0,1,0,27,255,141,0,245,1,249,0,26,0,34,64,31,12,1,0,1,1,74,17,1,1,72,26,21,2,0,71,0,0,0,1,93,0,1,1,38,0,76,36,39,2,7,22,43,23,55,54,54,53,19,52,38,35,34,6,35,39,55,51,50,54,55,7,6,6,7,6,21,6,6,7,27,2,49,35,1,12,18,10,23,4,3,6,92,26,67,10,4,28,16,2,10,1,67,74,87,7,30,71,71,1,69,25,16,2,4,38,6,1,41,4,16,24,233,100,79,96,27,0,0,0,1,0,27,255,141,0,245,1,249,0,26,0,34,64,31,12,1,0,1,1,74,17,1,1,72,26,21,2,0,71,0,0,0,1,93,0,1,1,46,0,76,36,39,2,8,22,43,23,55,54,54,53,19,52,38,35,34,6,35,39,55,51,50,54,55,7,6,6,7,6,21,6,6,7,27,2,49,35,1,12,18,10,23,4,3,6,92,26,67,10,4,28,16,2,10,1,67,74,87,7,30,71,71,1,69,25,16,2,4,38,6,1,41,4,16,24,233,100,79,96,27,0,0,255,255,0,8,255,141,1,42,2,225,0,34,2,106,0,0,1,7,7,197,1,96,0,34,0,8,177,1,1,176,34,176,51,43,0,0,0,2,0,54,255,245,2,13,1,249,0,33,0,65,0,177,64,16,64,52,2,2,0,57,1,3,2,2,74,46,11,2,1,72,75,176,8,80,88,64,29,4,1,0,0,1,95,5,1,1,1,38,75,6,1,2,2,3,93,0,3,3,39,75,0,7,7,39,7,76,27,75,176,12,80,88,64,29,4,1,0,0,1,95,5,1,1,1,38,75,6,1,2,2,3,93,0,3,3,39,75,0,7,7,41,7,76,27,75,176,14,80,88,64,29,4,1,0,0,1,95,5,1,1,1,38,75,6,1,2,2,3,93,0,3,3,39,75,0,7,7,39,7,76,27,64,29,4,1,0,0,1,95,5,1,1,1,38,75,6,1,2,2,3,93,0,3,3,39,75,0,7,7,41,7,76,89,89,89,64,11,36,26,67,25,68,41,66,33,8,7,28,43,18,38,35,7,39,55,50,22,51,50,54,55,7,6,6,7,3,6,22,51,50,54,55,23,7,34,38,35,7,55,54,54,53,19,23,54,53,52,39,39,55,22,22,51,50,54,55,23,7,6,6,7,7,23,22,22,23,23,7,6,6,7,34,39,39,55,123,12,18,27,3,6,11,58,27,22,62,10,3,31,22,1,9,1,15,21,12,20,3,2,7,11,62,32,99,8,38,22,1,233,24,49,2,6,10,64,19,26,47,8,4,6,22,39,37,120,130,29,45,28,4,5,10,49,16,44,48,138,1,1,186,17,1,4,38,2,6,1,41,5,19,22,254,187,32,22,2,1,4,40,2,1,40,4,22,34,1,62,19,23,16,21,3,4,38,1,4,2,1,6,36,6,29,38,119,166,36,30,1,5,31,1,7,1,66,191,13,255,255,0,54,254,219,2,13,1,249,0,34,2,109,0,0,0,3,7,215,1,238,0,0,0,2,0,54,255,245,2,13,1,249,0,33,0,65,0,135,64,16,64,52,2,2,0,57,1,3,2,2,74,46,11,2,1,72,75,176,11,80,88,64,29,4,1,0,0,1,95,5,1,1,1,46,75,6,1,2,2,3,93,0,3,3,47,75,0,7,7,50,7,76,27,75,176,13,80,88,64,25,4,1,0,0,1,95,5,1,1,1,46,75,6,1,2,2,3,95,7,1,3,3,47,3,76,27,64,29,4,1,0,0,1,95,5,1,1,1,46,75,6,1,2,2,3,93,0,3,3,47,75,0,7,7,50,7,76,89,89,64,11,36,26,67,25,68,41,66,33,8,8,28,43,18,38,35,7,39,55,50,22,51,50,54,55,7,6,6,7,3,6,22,51,50,54,55,23,7,34,38,35,7,55,54,54,53,19,23,54,53,52,39,39,55,22,22,51,50,54,55,23,7,6,6,7,7,23,22,22,23,23,7,6,6,7,34,39,39,55,123,12,18,27,3,6,11,58,27,22,62,10,3,31,22,1,9,1,15,21,12,20,3,2,7,11,62,32,99,8,38,22,1,233,24,49,2,6,10,64,19,26,47,8,4,6,22,39,37,120,130,29,45,28,4,5,10,49,16,44,48,138,1,1,186,17,1,4,38,2,6,1,41,5,19,22,254,187,32,22,2,1,4,40,2,1,40,4,22,34,1,62,19,23,16,21,3,4,38,1,4,2,1,6,36,6,29,38,119,166,36,30,1,5,31,1,7,1,66,191,13,0,0,0,1,0,61,255,248,1,174,1,249,0,43,0,45,64,42,33,1,2,0,1,74,16,1,1,72,43,1,3,71,0,0,0,1,93,0,1,1,38,75,0,2,2,3,93,0,3,3,39,3,76,73,44,66,38,4,7,24,43,55,54,54,53,19,52,38,35,7,39,55,50,22,51,50,54,55,7,14,2,7,6,21,20,22,22,51,50,54,54,55,55,23,6,6,7,7,38,38,35,34,6,7,67,32,23,1,12,18,27,3,6,5,50,42,22,65,10,4,27,22,4,3,10,9,27,29,48,45,23,9,44,3,2,15,6,5,23,149,51,40,69,9,34,5,27,34,1,61,25,17,1,4,38,2,6,1,42,3,13,20,31,134,163,25,23,8,16,47,51,5,6,13,93,51,6,1,6,7,1,0,255,255,0,61,255,248,1,174,2,248,0,34,2,112,0,0,1,7,7,194,1,135,0,45,0,8,177,1,1,176,45,176,51,43,0,0,0,2,0,61,255,248,1,174,1,249,0,43,0,55,0,50,64,47,50,1,0,1,44,33,2,2,0,2,74,16,1,1,72,43,1,3,71,0,0,0,1,93,0,1,1,38,75,0,2,2,3,93,0,3,3,39,3,76,73,44,66,38,4,7,24,43,55,54,54,53,19,52,38,35,7,39,55,50,22,51,50,54,55,7,14,2,7,6,21,20,22,22,51,50,54,54,55,55,23,6,6,7,7,38,38,35,34,6,7,1,54,53,52,38,39,55,23,6,6,7,7,67,32,23,1,12,18,27,3,6,5,50,42,22,65,10,4,27,22,4,3,10,9,27,29,48,45,23,9,44,3,2,15,6,5,23,149,51,40,69,9,1,37,1,5,1,64,6,2,17,11,25,34,5,27,34,1,61,25,17,1,4,38,2,6,1,42,3,13,20,31,134,163,25,23,8,16,47,51,5,6,13,93,51,6,1,6,7,1,1,64,16,31,43,72,10,11,6,15,101,51,12,0,0,255,255,0,61,254,219,1,174,1,249,0,34,2,112,0,0,0,3,7,215,1,208,0,0,255,255,0,61,255,248,1,178,1,249,0,34,2,112,0,0,1,7,7,9,0,255,0,95,0,8,177,1,1,176,95,176,51,43,0,0,255,255,0,61,255,64,1,174,1,249,0,34,2,112,0,0,0,3,7,213,1,180,0,0,255,255,0,61,255,141,2,175,1,249,0,34,2,112,0,0,0,3,2,106,1,186,0,0,255,255,0,61,255,93,1,174,1,249,0,34,2,112,0,0,0,3,7,219,1,182,0,0,0,1,0,68,255,248,1,186,1,249,0,53,0,54,64,51,42,41,39,38,37,19,18,16,15,9,3,1,1,74,32,1,2,72,10,1,0,71,0,1,1,2,93,0,2,2,38,75,0,3,3,0,93,0,0,0,39,0,76,49,47,66,46,68,4,7,23,43,37,6,6,7,7,38,38,35,34,6,7,55,54,54,53,53,7,39,39,55,53,52,38,35,7,39,55,50,22,51,50,54,55,7,14,2,7,7,55,23,23,7,6,21,20,22,22,51,50,54,54,55,55,1,186,2,15,6,5,23,149,51,40,69,9,6,32,23,52,8,6,67,12,18,27,3,6,5,50,42,22,65,10,4,27,22,4,3,6,139,7,7,154,3,9,27,29,48,45,23,9,44,156,13,93,51,6,1,6,7,1,42,5,27,34,121,25,2,32,32,155,25,17,1,4,38,2,6,1,42,3,13,20,31,104,65,4,32,72,82,68,25,23,8,16,47,51,5,0,1,0,45,255,242,2,157,1,247,0,82,0,59,64,56,78,39,1,3,0,2,72,1,1,0,2,74,51,1,3,72,82,1,1,71,0,2,2,3,95,5,4,2,3,3,38,75,6,1,0,0,1,94,7,1,1,1,39,1,76,66,43,49,57,67,27,66,39,8,7,28,43,18,39,35,6,2,21,20,22,51,51,23,7,34,38,35,34,6,7,55,54,54,55,54,54,53,52,38,39,39,55,22,22,51,50,54,55,30,2,23,51,54,54,55,54,22,51,22,51,50,54,55,23,7,6,6,21,20,22,23,22,22,51,55,23,7,34,38,35,34,6,35,55,54,54,53,52,38,39,35,6,7,7,230,50,5,4,21,12,14,32,2,7,9,51,25,20,46,7,4,26,22,4,8,27,31,38,3,7,11,56,26,22,37,6,30,57,37,5,5,11,77,45,6,19,9,11,21,16,61,10,2,5,35,28,14,7,5,16,19,23,2,7,8,46,26,26,66,2,4,26,22,21,4,5,59,91,29,1,4,127,48,254,250,13,13,11,3,40,3,5,1,41,3,25,31,68,246,15,20,19,2,5,33,1,3,2,1,93,163,97,12,28,206,129,1,1,1,4,1,3,35,4,19,20,20,214,75,45,28,1,3,40,2,6,41,3,18,18,18,250,45,151,244,6,0,0,0,255,255,0,45,255,64,2,157,1,247,0,34,2,121,0,0,0,3,7,213,2,42,0,0,0,1,0,51,255,228,2,67,1,248,0,54,0,48,64,45,43,1,0,1,1,74,11,1,1,72,34,16,2,3,71,0,0,0,1,95,4,1,1,1,38,75,0,2,2,3,96,0,3,3,39,3,76,77,51,47,51,33,5,7,25,43,1,52,35,35,39,55,22,22,51,50,54,55,7,6,6,7,3,7,38,2,21,35,3,20,22,51,55,23,7,38,38,35,34,6,7,55,54,54,55,19,52,38,39,39,55,22,22,51,50,54,55,22,22,53,51,1,205,27,30,2,7,9,50,26,22,55,8,4,29,25,1,12,39,95,194,5,3,12,14,40,3,8,9,53,29,23,52,8,5,25,24,1,11,29,41,4,7,8,45,23,22,34,5,81,181,5,1,169,33,4,39,1,2,5,1,41,4,23,23,254,82,11,139,1,10,2,254,209,19,14,1,3,40,1,2,5,1,41,3,23,23,1,74,25,19,5,5,34,1,3,2,1,119,248,2,0,0,0,255,255,0,51,255,228,2,67,2,248,0,34,2,123,0,0,1,7,7,194,1,221,0,45,0,8,177,1,1,176,45,176,51,43,0,0,255,255,0,51,255,228,2,67,2,243,0,34,2,123,0,0,1,7,7,198,1,250,0,45,0,8,177,1,1,176,45,176,51,43,0,0,255,255,0,51,254,219,2,67,1,248,0,34,2,123,0,0,0,3,7,215,2,9,0,0,255,255,0,51,255,228,2,67,2,225,0,34,2,123,0,0,1,7,7,191,1,250,0,45,0,8,177,1,1,176,45,176,51,43,0,0,255,255,0,51,255,64,2,67,1,248,0,34,2,123,0,0,0,3,7,213,1,247,0,0,0,1,0,52,255,134,2,66,1,248,0,61,0,53,64,50,40,7,2,0,3,4,1,1,0,2,74,53,31,2,2,72,61,1,1,71,0,3,3,2,95,4,1,2,2,38,75,0,0,0,1,96,0,1,1,39,1,76,66,40,61,51,43,5,7,25,43,5,55,54,54,55,38,38,39,35,3,20,22,51,55,23,7,38,38,35,34,6,7,55,54,54,55,19,52,38,39,39,55,22,22,51,50,54,51,22,22,23,51,17,52,35,7,39,55,50,22,51,50,54,55,7,6,6,7,3,6,6,7,1,99,3,38,42,9,90,155,22,5,3,11,15,39,3,7,10,56,33,21,46,7,4,28,22,1,10,28,42,3,6,8,45,20,16,40,8,69,167,26,5,27,31,2,7,9,51,25,22,54,8,4,29,25,1,7,2,66,73,95,7,18,44,31,130,213,29,254,206,18,14,2,4,40,1,2,5,1,40,3,27,35,1,60,23,20,5,5,34,1,3,3,104,229,34,1,35,34,1,4,39,3,5,1,41,4,22,23,254,165,76,88,25,0,0,255,255,0,51,255,141,3,91,1,249,0,34,2,123,0,0,0,3,2,106,2,102,0,0,255,255,0,51,255,93,2,67,1,248,0,34,2,123,0,0,0,3,7,219,1,249,0,0,255,255,0,51,255,228,2,67,2,221,0,34,2,123,0,0,1,7,7,201,1,249,0,45,0,8,177,1,1,176,45,176,51,43,0,0,0,2,0,41,255,247,2,32,1,251,0,15,0,29,0,78,75,176,8,80,88,64,23,0,2,2,0,95,0,0,0,38,75,5,1,3,3,1,95,4,1,1,1,39,1,76,27,64,23,0,2,2,0,95,0,0,0,38,75,5,1,3,3,1,95,4,1,1,1,41,1,76,89,64,18,16,16,0,0,16,29,16,28,23,21,0,15,0,14,38,6,7,21,43,22,38,38,53,52,54,54,51,50,22,22,21,20,6,6,35,54,54,53,52,38,38,35,34,6,21,20,22,22,51,203,105,57,71,123,76,69,106,58,71,125,77,97,90,43,79,52,71,87,42,77,50,9,60,110,72,78,125,71,60,109,72,78,125,72,48,105,87,66,100,54,104,87,66,100,55,0,0,255,255,0,41,255,247,2,32,2,248,0,34,2,133,0,0,1,7,7,194,1,207,0,45,0,8,177,2,1,176,45,176,51,43,0,0,255,255,0,41,255,247,2,32,2,195,0,34,2,133,0,0,1,7,7,199,1,236,0,45,0,8,177,2,1,176,45,176,51,43,0,0,255,255,0,41,255,247,2,32,2,243,0,34,2,133,0,0,1,7,7,198,1,236,0,45,0,8,177,2,1,176,45,176,51,43,0,0,255,255,0,41,255,247,2,32,2,215,0,34,2,133,0,0,1,7,7,197,1,242,0,24,0,8,177,2,1,176,24,176,51,43,0,0,255,255,0,41,255,247,2,32,3,53,0,34,2,133,0,0,1,7,8,47,1,242,0,45,0,8,177,2,2,176,45,176,51,43,0,0,255,255,0,41,255,64,2,32,2,215,0,34,2,133,0,0,0,35,7,213,1,233,0,0,1,7,7,197,1,242,0,24,0,8,177,3,1,176,24,176,51,43,0,0,255,255,0,41,255,247,2,32,3,46,0,34,2,133,0,0,1,7,8,48,1,243,0,45,0,8,177,2,2,176,45,176,51,43,0,0,255,255,0,41,255,247,2,32,3,66,0,34,2,133,0,0,1,7,8,49,1,233,0,45,0,8,177,2,2,176,45,176,51,43,0,0,255,255,0,41,255,247,2,32,3,56,0,34,2,133,0,0,1,7,8,50,1,236,0,45,0,8,177,2,2,176,45,176,51,43,0,0,255,255,0,41,255,247,2,32,2,238,0,34,2,133,0,0,1,7,7,209,1,203,0,45,0,8,177,2,2,176,45,176,51,43,0,0,255,255,0,41,255,247,2,32,2,172,0,34,2,133,0,0,1,7,7,186,1,236,0,45,0,8,177,2,2,176,45,176,51,43,0,0,255,255,0,41,255,247,2,32,3,10,0,34,2,133,0,0,1,7,7,190,1,235,0,45,0,8,177,2,3,176,45,176,51,43,0,0,255,255,0,41,255,247,2,32,2,232,0,34,2,133,0,0,0,47,7,191,1,224,0,5,60,96,1,7,7,205,1,235,0,111,0,16,177,2,1,176,5,176,51,43,177,3,1,176,111,176,51,43,255,255,0,41,255,64,2,32,1,251,0,34,2,133,0,0,0,3,7,213,1,233,0,0,255,255,0,41,255,247,2,32,2,247,0,34,2,133,0,0,1,7,7,193,1,237,0,45,0,8,177,2,1,176,45,176,51,43,0,0,255,255,0,41,255,247,2,32,3,8,0,34,2,133,0,0,1,7,7,208,1,237,0,25,0,8,177,2,1,176,25,176,51,43,0,0,0,2,0,41,255,247,2,68,2,94,0,35,0,49,0,112,181,19,1,0,2,1,74,75,176,8,80,88,64,35,0,2,0,2,131,0,1,3,3,1,87,5,1,3,3,0,95,0,0,0,38,75,8,1,6,6,4,95,7,1,4,4,39,4,76,27,64,35,0,2,0,2,131,0,1,3,3,1,87,5,1,3,3,0,95,0,0,0,38,75,8,1,6,6,4,95,7,1,4,4,41,4,76,89,64,21,36,36,0,0,36,49,36,48,43,41,0,35,0,34,20,39,36,38,9,7,24,43,22,38,38,53,52,54,54,51,50,22,23,22,22,51,50,54,53,52,38,39,55,54,51,50,22,21,20,6,39,22,22,21,20,6,6,35,54,54,53,52,38,38,35,34,6,21,20,22,22,51,203,105,57,71,123,76,29,40,24,12,26,12,24,30,14,12,2,26,25,20,25,68,44,36,40,71,125,77,97,90,43,79,52,71,87,42,77,50,9,60,110,72,78,125,71,8,7,4,6,20,17,14,29,10,11,23,35,28,39,56,2,32,94,58,78,125,72,48,105,87,66,100,54,104,87,66,100,55,255,255,0,41,255,247,2,68,2,248,0,34,2,150,0,0,1,7,7,194,1,213,0,45,0,8,177,2,1,176,45,176,51,43,0,0,255,255,0,41,255,64,2,68,2,94,0,34,2,150,0,0,0,3,7,213,1,239,0,0,255,255,0,41,255,247,2,68,2,247,0,34,2,150,0,0,1,7,7,193,1,243,0,45,0,8,177,2,1,176,45,176,51,43,0,0,255,255,0,41,255,247,2,68,3,8,0,34,2,150,0,0,1,7,7,208,1,243,0,25,0,8,177,2,1,176,25,176,51,43,0,0,255,255,0,41,255,247,2,68,2,221,0,34,2,150,0,0,1,7,7,201,1,241,0,45,0,8,177,2,1,176,45,176,51,43,0,0,255,255,0,41,255,247,2,32,2,238,0,34,2,133,0,0,1,7,7,195,1,250,0,45,0,8,177,2,2,176,45,176,51,43,0,0,255,255,0,41,255,247,2,32,2,195,0,34,2,133,0,0,1,7,7,210,1,215,0,45,0,8,177,2,1,176,45,176,51,43,0,0,255,255,0,41,255,247,2,32,2,166,0,34,2,133,0,0,1,7,7,205,1,235,0,45,0,8,177,2,1,176,45,176,51,43,0,0,255,255,0,41,255,247,2,32,3,24,0,34,2,133,0,0,0,39,7,205,1,235,255,241,1,7,7,227,1,195,255,207,0,18,177,2,1,184,255,241,176,51,43,177,3,1,184,255,207,176,51,43,255,255,0,41,255,247,2,32,3,24,0,34,2,133,0,0,0,39,7,205,1,235,255,241,1,7,7,226,2,26,255,207,0,18,177,2,1,184,255,241,176,51,43,177,3,1,184,255,207,176,51,43,255,255,0,41,255,15,2,32,1,251,0,35,7,217,2,18,0,0,0,2,2,133,0,0,0,3,0,41,255,179,2,32,2,41,0,25,0,33,0,42,0,108,64,29,25,21,2,2,1,40,39,31,30,4,3,2,12,8,2,0,3,3,74,24,22,2,1,72,11,9,2,0,71,75,176,8,80,88,64,23,4,1,2,2,1,95,0,1,1,38,75,5,1,3,3,0,95,0,0,0,39,0,76,27,64,23,4,1,2,2,1,95,0,1,1,38,75,5,1,3,3,0,95,0,0,0,41,0,76,89,64,17,34,34,26,26,34,42,34,41,26,33,26,32,43,37,6,7,22,43,0,22,21,20,6,6,35,34,39,7,39,39,55,38,38,53,52,54,54,51,50,23,55,23,23,7,6,6,21,20,23,19,38,35,18,54,53,52,38,39,3,22,51,1,230,58,71,125,77,58,45,51,25,2,50,47,52,71,123,76,47,45,35,27,2,34,220,87,52,190,38,46,84,90,34,30,192,40,53,1,192,110,72,78,125,72,21,89,7,8,89,31,107,68,78,125,71,16,62,8,10,58,26,104,87,106,61,1,80,22,254,100,105,87,58,91,29,254,173,31,0,0,255,255,0,41,255,179,2,32,2,248,0,34,2,162,0,0,1,7,7,194,1,207,0,45,0,8,177,3,1,176,45,176,51,43,0,0,255,255,0,41,255,247,2,32,2,221,0,34,2,133,0,0,1,7,7,201,1,235,0,45,0,8,177,2,1,176,45,176,51,43,0,0,255,255,0,41,255,247,2,32,3,49,0,34,2,133,0,0,0,39,7,201,1,235,255,251,1,135,7,227,1,159,255,229,63,233,252,167,3,89,63,233,0,18,177,2,1,184,255,251,176,51,43,177,3,1,184,255,229,176,51,43,255,255,0,41,255,247,2,32,3,22,0,34,2,133,0,0,0,39,7,201,1,235,255,251,1,7,7,186,1,236,0,151,0,17,177,2,1,184,255,251,176,51,43,177,3,2,176,151,176,51,43,0,255,255,0,41,255,247,2,32,3,17,0,34,2,133,0,0,0,47,7,201,1,228,0,19,61,137,1,7,7,205,1,235,0,152,0,16,177,2,1,176,19,176,51,43,177,3,1,176,152,176,51,43,0,2,0,42,255,247,2,238,1,251,0,63,0,77,0,138,64,18,36,35,19,18,4,3,2,51,41,2,5,4,2,74,14,1,0,72,75,176,30,80,88,64,35,0,3,0,4,5,3,4,101,8,1,2,2,0,95,1,1,0,0,38,75,11,9,2,5,5,6,93,10,7,2,6,6,39,6,76,27,64,45,0,3,0,4,5,3,4,101,8,1,2,2,0,95,0,0,0,38,75,8,1,2,2,1,95,0,1,1,38,75,11,9,2,5,5,6,93,10,7,2,6,6,39,6,76,89,64,24,64,64,0,0,64,77,64,76,72,70,0,63,0,61,73,37,52,36,44,50,38,12,7,27,43,22,38,38,53,52,54,54,51,50,23,22,22,51,50,55,23,6,6,7,7,52,54,53,52,38,38,35,34,6,6,7,7,23,50,54,55,23,7,34,38,35,7,7,20,22,22,51,50,54,54,55,55,23,6,6,7,7,38,38,35,34,7,6,35,54,54,55,55,52,38,38,35,34,6,21,20,22,51,201,102,57,69,120,75,35,47,10,61,28,160,91,3,2,14,3,48,2,15,48,58,27,20,6,1,6,83,18,70,11,4,12,11,66,36,63,3,8,24,30,65,56,23,7,44,3,2,15,5,5,28,171,53,49,72,60,23,97,61,1,1,25,59,56,72,89,89,75,9,60,110,72,78,124,71,5,1,4,11,5,11,78,45,4,4,19,10,26,21,7,3,11,15,142,1,7,1,5,52,2,5,137,22,19,6,12,37,45,4,5,11,81,44,5,1,5,6,4,48,55,67,200,37,39,16,105,87,102,120,0,0,0,2,0,58,255,250,1,197,1,245,0,40,0,51,0,54,64,51,51,50,48,3,2,0,33,1,4,3,2,74,0,2,0,3,0,2,3,126,5,1,0,0,1,93,0,1,1,38,75,0,3,3,4,93,0,4,4,39,4,76,37,84,36,37,114,38,6,7,26,43,55,54,54,53,19,52,38,35,7,39,55,50,22,51,50,54,51,50,22,21,20,6,6,35,35,7,20,22,22,51,50,54,51,23,7,34,38,35,34,6,7,36,53,52,38,35,34,6,7,6,7,23,64,35,23,1,12,17,28,3,6,5,49,40,27,68,14,90,91,54,87,49,69,1,5,14,17,13,26,4,2,8,9,48,25,33,92,1,1,58,70,76,14,6,1,8,1,83,35,6,25,33,1,62,25,17,1,4,38,2,3,76,66,44,80,49,70,35,31,10,2,4,40,2,4,2,250,101,56,53,3,9,127,75,11,0,0,0,0,2,0,53,255,247,1,190,1,249,0,45,0,58,0,69,64,66,55,1,7,6,38,1,5,4,2,74,16,1,1,72,45,1,5,71,0,2,0,6,7,2,6,103,0,7,0,3,4,7,3,103,0,0,0,1,93,0,1,1,38,75,0,4,4,5,93,0,5,5,39,5,76,22,38,68,35,37,39,66,38,8,7,28,43,55,54,54,53,19,52,38,35,7,39,55,50,22,51,50,54,55,7,6,6,7,7,51,50,22,21,20,6,6,35,35,21,20,22,51,50,54,55,23,7,34,38,35,34,6,7,36,53,52,38,35,34,6,7,6,21,22,22,23,58,38,26,1,12,18,33,2,5,6,53,43,23,67,10,4,34,21,2,2,66,87,91,53,90,52,58,14,21,15,23,4,2,7,12,66,34,27,63,10,1,57,70,75,13,7,1,6,15,47,17,32,7,27,33,1,62,25,17,1,4,38,2,6,1,41,4,17,21,27,67,64,40,69,41,26,29,20,2,1,4,40,2,7,2,177,84,50,47,3,5,120,52,4,8,1,0,2,0,41,255,84,2,161,1,251,0,31,0,45,0,106,64,10,18,1,0,5,27,1,3,2,2,74,75,176,8,80,88,64,30,0,2,6,1,3,2,3,99,0,4,4,1,95,0,1,1,38,75,7,1,5,5,0,95,0,0,0,39,0,76,27,64,30,0,2,6,1,3,2,3,99,0,4,4,1,95,0,1,1,38,75,7,1,5,5,0,95,0,0,0,41,0,76,89,64,20,32,32,0,0,32,45,32,44,39,37,0,31,0,30,41,38,19,8,7,23,43,4,38,38,39,34,38,38,53,52,54,54,51,50,22,22,21,20,6,7,21,22,22,51,50,54,55,23,23,14,2,35,38,54,53,52,38,38,35,34,6,21,20,22,22,51,2,35,71,105,100,68,105,57,71,123,76,69,106,58,106,86,82,114,48,24,38,5,4,6,5,35,38,8,219,90,43,79,52,71,87,42,77,50,172,24,67,72,60,110,72,78,125,71,60,109,72,94,143,25,5,52,46,7,1,4,20,4,28,25,211,105,87,66,100,54,104,87,66,100,55,0,0,0,2,0,54,255,244,2,1,1,245,0,47,0,59,0,169,64,16,59,58,40,3,0,3,45,1,2,1,17,1,6,2,3,74,75,176,8,80,88,64,37,0,0,3,1,3,0,1,126,7,1,3,3,4,93,0,4,4,38,75,5,1,1,1,2,95,0,2,2,39,75,8,1,6,6,41,6,76,27,75,176,10,80,88,64,37,0,0,3,1,3,0,1,126,7,1,3,3,4,93,0,4,4,38,75,5,1,1,1,2,95,0,2,2,39,75,8,1,6,6,39,6,76,27,64,37,0,0,3,1,3,0,1,126,7,1,3,3,4,93,0,4,4,38,75,5,1,1,1,2,95,0,2,2,39,75,8,1,6,6,41,6,76,89,89,64,17,0,0,53,52,0,47,0,47,24,114,40,67,20,19,9,7,26,43,4,38,39,39,35,7,20,22,22,23,23,7,38,38,35,34,6,7,55,54,54,53,19,52,38,35,7,39,55,50,22,51,50,54,51,50,22,21,20,6,7,23,22,22,51,23,7,7,2,54,54,53,52,35,34,6,21,6,21,23,1,153,46,19,84,65,2,8,23,28,2,8,12,63,32,31,46,8,7,37,24,1,12,17,28,3,6,10,56,28,29,66,12,81,92,62,56,85,24,44,31,4,5,77,134,29,36,143,8,6,8,81,12,39,34,147,107,29,25,8,1,3,38,1,1,2,1,41,5,24,33,1,63,24,17,1,4,38,2,3,67,59,46,78,25,128,36,30,5,31,8,1,16,15,48,38,97,7,11,122,58,8,0,255,255,0,54,255,244,2,1,2,248,0,34,2,172,0,0,1,7,7,194,1,182,0,45,0,8,177,2,1,176,45,176,51,43,0,0,255,255,0,54,255,244,2,1,2,243,0,34,2,172,0,0,1,7,7,198,1,211,0,45,0,8,177,2,1,176,45,176,51,43,0,0,255,255,0,54,254,219,2,1,1,245,0,34,2,172,0,0,0,3,7,215,1,230,0,0,255,255,0,54,255,244,2,1,2,238,0,34,2,172,0,0,1,7,7,209,1,178,0,45,0,8,177,2,2,176,45,176,51,43,0,0,255,255,0,54,255,64,2,1,1,245,0,34,2,172,0,0,0,3,7,213,1,225,0,0,255,255,0,54,255,244,2,1,2,195,0,34,2,172,0,0,1,7,7,210,1,190,0,45,0,8,177,2,1,176,45,176,51,43,0,0,255,255,0,54,255,93,2,1,1,245,0,34,2,172,0,0,0,3,7,219,1,227,0,0,0,1,0,53,255,247,1,144,1,251,0,57,0,90,64,18,32,1,2,1,37,36,35,9,8,5,0,2,4,1,3,0,3,74,75,176,8,80,88,64,22,0,2,2,1,95,0,1,1,38,75,0,0,0,3,95,4,1,3,3,39,3,76,27,64,22,0,2,2,1,95,0,1,1,38,75,0,0,0,3,95,4,1,3,3,41,3,76,89,64,12,0,0,0,57,0,56,46,44,44,5,7,23,43,22,38,38,39,39,62,2,53,55,20,22,22,51,50,54,53,52,38,38,39,38,38,53,52,54,54,51,50,22,22,23,23,6,6,7,7,39,52,54,53,52,38,35,34,6,21,20,22,23,30,2,21,20,6,6,35,156,59,35,4,5,1,5,5,45,17,42,43,48,59,33,43,47,64,69,51,90,55,33,58,34,4,4,2,14,3,39,6,2,41,52,42,55,55,56,49,59,42,53,95,61,9,12,13,2,9,5,35,63,32,4,54,53,20,42,35,23,35,24,23,31,60,47,42,68,38,8,9,2,7,11,77,44,4,4,3,19,14,39,31,39,30,30,42,27,23,34,52,34,45,69,39,255,255,0,53,255,247,1,144,2,248,0,34,2,180,0,0,1,7,7,194,1,144,0,45,0,8,177,1,1,176,45,176,51,43,0,0,255,255,0,53,255,247,1,144,3,35,0,34,2,180,0,0,0,39,7,227,1,155,255,116,1,7,7,224,1,173,255,240,0,18,177,1,1,184,255,116,176,51,43,177,2,1,184,255,240,176,51,43,255,255,0,53,255,247,1,144,2,243,0,34,2,180,0,0,1,7,7,198,1,173,0,45,0,8,177,1,1,176,45,176,51,43,0,0,255,255,0,53,255,247,1,144,3,27,0,34,2,180,0,0,0,39,7,230,1,173,255,116,1,7,7,224,1,173,255,232,0,18,177,1,1,184,255,116,176,51,43,177,2,1,184,255,232,176,51,43,255,255,0,53,255,23,1,144,1,251,0,34,2,180,0,0,0,3,7,216,1,165,0,0,255,255,0,53,255,247,1,144,2,225,0,34,2,180,0,0,1,7,7,197,1,194,0,34,0,8,177,1,1,176,34,176,51,43,0,0,255,255,0,53,254,219,1,144,1,251,0,34,2,180,0,0,0,3,7,215,1,171,0,0,255,255,0,53,255,247,1,144,2,225,0,34,2,180,0,0,1,7,7,191,1,173,0,45,0,8,177,1,1,176,45,176,51,43,0,0,255,255,0,53,255,64,1,144,1,251,0,34,2,180,0,0,0,3,7,213,1,170,0,0,255,255,0,53,255,64,1,144,2,225,0,34,2,180,0,0,0,35,7,213,1,170,0,0,1,7,7,191,1,173,0,45,0,8,177,2,1,176,45,176,51,43,0,0,0,1,0,54,255,247,2,100,1,247,0,70,0,166,75,176,30,80,88,64,24,61,1,2,6,22,1,1,7,36,8,7,3,0,1,4,1,4,0,4,74,43,1,4,71,27,64,24,61,1,2,6,22,1,1,7,36,8,7,3,0,1,4,1,4,0,4,74,43,1,8,71,89,75,176,30,80,88,64,33,0,7,0,1,0,7,1,103,5,1,2,2,6,93,0,6,6,38,75,3,1,0,0,4,95,9,8,2,4,4,39,4,76,27,64,43,0,7,0,1,0,7,1,103,5,1,2,2,6,93,0,6,6,38,75,3,1,0,0,4,95,0,4,4,39,75,3,1,0,0,8,95,9,1,8,8,41,8,76,89,64,17,0,0,0,70,0,69,34,98,41,53,38,36,36,43,10,7,28,43,4,38,38,39,39,54,54,55,55,20,22,22,51,50,54,53,52,38,35,34,6,7,39,55,35,34,6,6,7,3,20,22,51,50,54,51,23,7,38,38,35,34,6,7,55,54,54,53,19,52,38,35,7,39,55,50,22,51,50,54,55,23,7,23,22,22,21,20,6,6,35,1,130,58,34,4,5,1,8,2,44,16,41,42,41,51,69,67,20,42,6,17,147,199,27,20,6,1,11,14,20,10,19,3,3,8,10,56,31,29,64,10,5,38,25,1,12,18,27,2,6,19,100,48,73,202,32,12,143,28,75,96,49,87,55,9,12,13,2,9,11,76,40,4,50,50,19,53,43,51,54,5,1,27,190,3,11,15,254,185,31,21,2,5,43,1,2,7,2,41,7,27,34,1,61,25,17,1,4,38,2,4,1,20,178,1,2,80,61,49,77,44,0,1,0,17,255,252,1,199,1,251,0,43,0,61,64,58,36,1,6,5,1,74,18,17,14,13,4,2,72,43,1,6,71,3,1,1,0,5,0,1,5,126,4,1,0,0,2,93,0,2,2,38,75,0,5,5,6,93,0,6,6,39,6,76,84,37,19,21,21,19,21,7,7,27,43,55,62,2,53,17,14,2,7,7,54,54,55,55,23,33,55,23,22,22,23,7,46,2,39,6,6,21,20,22,51,50,54,51,23,7,34,38,35,34,6,7,117,40,33,9,63,44,21,7,47,2,9,1,8,71,0,255,73,8,1,8,2,46,8,21,41,58,5,8,22,25,18,23,3,3,7,14,76,36,36,70,13,36,3,14,33,41,1,75,2,10,37,51,3,13,89,43,7,8,8,7,44,86,12,3,52,39,10,2,48,223,94,29,24,2,3,42,3,3,1,0,0,1,0,17,255,252,1,199,1,251,0,53,0,82,64,79,37,11,2,3,2,22,1,5,4,2,74,53,52,49,48,4,10,72,29,1,5,71,9,1,0,1,2,1,0,2,126,7,1,2,6,1,3,4,2,3,101,8,1,1,1,10,93,0,10,10,38,75,0,4,4,5,93,0,5,5,39,5,76,51,50,45,44,17,18,23,84,36,18,18,19,18,11,7,29,43,0,22,23,7,46,2,39,6,7,55,23,7,7,6,21,20,22,51,50,54,51,23,7,34,38,35,34,6,7,55,62,2,53,53,7,39,55,23,53,14,2,7,7,54,54,55,55,23,33,55,23,1,189,8,2,46,8,21,41,58,6,5,82,13,4,92,1,22,25,18,23,3,3,7,14,76,36,36,70,13,7,40,33,9,90,9,7,92,63,44,21,7,47,2,9,1,8,71,0,255,73,8,1,200,86,12,3,52,39,10,2,59,154,5,13,37,1,37,69,29,24,2,3,42,3,3,1,40,3,14,33,41,72,1,9,39,1,213,2,10,37,51,3,13,89,43,7,8,8,7,0,0,255,255,0,17,255,252,1,199,2,243,0,34,2,192,0,0,1,7,7,198,1,180,0,45,0,8,177,1,1,176,45,176,51,43,0,0,255,255,0,17,255,23,1,199,1,251,0,34,2,192,0,0,0,3,7,216,1,185,0,0,255,255,0,17,254,219,1,199,1,251,0,34,2,192,0,0,0,3,7,215,1,191,0,0,255,255,0,17,255,252,1,199,2,172,0,34,2,192,0,0,1,7,7,186,1,180,0,45,0,8,177,1,2,176,45,176,51,43,0,0,255,255,0,17,255,64,1,199,1,251,0,34,2,192,0,0,0,3,7,213,1,177,0,0,255,255,0,17,255,93,1,199,1,251,0,34,2,192,0,0,0,3,7,219,1,179,0,0,0,1,0,36,255,247,2,28,1,248,0,49,0,90,64,12,29,19,2,2,0,1,74,41,15,2,1,72,75,176,8,80,88,64,24,3,1,0,0,1,93,4,1,1,1,38,75,0,2,2,5,95,6,1,5,5,39,5,76,27,64,24,3,1,0,0,1,93,4,1,1,1,38,75,0,2,2,5,95,6,1,5,5,41,5,76,89,64,14,0,0,0,49,0,48,66,39,41,66,37,7,7,25,43,22,38,53,53,52,38,35,7,39,55,50,22,51,50,54,55,7,6,6,7,7,20,22,51,50,54,53,52,38,39,38,38,35,7,39,55,50,22,51,50,54,55,7,6,6,21,17,20,6,35,188,93,12,18,27,2,6,11,58,30,22,58,9,4,29,20,2,6,66,62,63,65,3,1,2,10,17,34,1,6,10,55,28,23,53,8,3,35,20,107,98,9,88,83,255,25,17,1,3,39,2,5,1,40,4,18,22,229,71,77,63,60,62,157,32,27,15,1,3,39,2,5,1,40,5,16,22,255,0,83,91,0,255,255,0,36,255,247,2,28,2,248,0,34,2,200,0,0,1,7,7,194,1,202,0,45,0,8,177,1,1,176,45,176,51,43,0,0,255,255,0,36,255,247,2,28,2,185,0,34,2,200,0,0,1,7,7,199,1,227,0,35,0,8,177,1,1,176,35,176,51,43,0,0,255,255,0,36,255,247,2,28,2,243,0,34,2,200,0,0,1,7,7,198,1,231,0,45,0,8,177,1,1,176,45,176,51,43,0,0,255,255,0,36,255,247,2,28,2,215,0,34,2,200,0,0,1,7,7,197,1,237,0,24,0,8,177,1,1,176,24,176,51,43,0,0,255,255,0,36,255,247,2,28,2,238,0,34,2,200,0,0,1,7,7,209,1,198,0,45,0,8,177,1,2,176,45,176,51,43,0,0,255,255,0,36,255,247,2,28,2,172,0,34,2,200,0,0,1,7,7,186,1,231,0,45,0,8,177,1,2,176,45,176,51,43,0,0,255,255,0,36,255,247,2,28,3,48,0,39,7,188,1,233,0,5,1,2,2,200,0,0,0,8,177,0,3,176,5,176,51,43,0,0,255,255,0,36,255,247,2,28,3,21,0,39,7,189,1,234,0,5,1,2,2,200,0,0,0,8,177,0,3,176,5,176,51,43,0,0,255,255,0,36,255,247,2,28,3,48,0,39,7,187,1,235,0,5,1,2,2,200,0,0,0,8,177,0,3,176,5,176,51,43,0,0,255,255,0,36,255,247,2,28,2,226,0,39,7,190,1,234,0,5,1,2,2,200,0,0,0,8,177,0,3,176,5,176,51,43,0,0,255,255,0,36,255,64,2,28,1,248,0,35,7,213,1,232,0,0,0,2,2,200,0,0,255,255,0,36,255,247,2,28,2,247,0,34,2,200,0,0,1,7,7,193,1,232,0,45,0,8,177,1,1,176,45,176,51,43,0,0,255,255,0,36,255,247,2,28,2,224,0,39,7,208,1,243,255,241,1,2,2,200,0,0,0,9,177,0,1,184,255,241,176,51,43,0,0,1,0,36,255,247,2,59,2,90,0,59,0,101,64,12,43,15,2,1,5,29,19,2,2,0,2,74,75,176,8,80,88,64,29,0,5,1,5,131,3,1,0,0,1,93,4,1,1,1,38,75,0,2,2,6,95,7,1,6,6,39,6,76,27,64,29,0,5,1,5,131,3,1,0,0,1,93,4,1,1,1,38,75,0,2,2,6,95,7,1,6,6,41,6,76,89,64,15,0,0,0,59,0,58,38,66,39,41,66,37,8,7,26,43,22,38,53,53,52,38,35,7,39,55,50,22,51,50,54,55,7,6,6,7,7,20,22,51,50,54,53,52,38,39,38,38,35,7,39,55,50,22,51,50,53,52,38,39,55,54,51,50,22,21,20,7,14,2,21,17,20,6,35,188,93,12,18,27,2,6,11,58,30,22,58,9,4,29,20,2,6,66,62,63,65,3,1,2,10,17,34,1,6,10,60,33,35,14,12,2,28,21,21,24,44,3,30,12,107,98,9,88,83,255,25,17,1,3,39,2,5,1,40,4,18,22,229,71,77,63,60,62,157,32,27,15,1,3,39,2,30,11,22,8,11,22,26,23,54,25,2,14,21,16,255,0,83,91,0,0,0,255,255,0,36,255,247,2,59,2,243,0,34,2,214,0,0,1,7,7,194,1,235,0,40,0,8,177,1,1,176,40,176,51,43,0,0,255,255,0,36,255,64,2,59,2,90,0,34,2,214,0,0,0,3,7,213,1,232,0,0,255,255,0,36,255,247,2,59,2,252,0,34,2,214,0,0,1,7,7,193,1,244,0,50,0,8,177,1,1,176,50,176,51,43,0,0,255,255,0,36,255,247,2,59,3,8,0,34,2,214,0,0,1,7,7,208,1,240,0,25,0,8,177,1,1,176,25,176,51,43,0,0,255,255,0,36,255,247,2,59,2,215,0,34,2,214,0,0,1,6,8,9,83,35,0,8,177,1,1,176,35,176,51,43,255,255,0,36,255,247,2,28,2,238,0,34,2,200,0,0,1,7,7,195,1,245,0,45,0,8,177,1,2,176,45,176,51,43,0,0,255,255,0,36,255,247,2,28,2,195,0,34,2,200,0,0,1,7,7,210,1,210,0,45,0,8,177,1,1,176,45,176,51,43,0,0,255,255,0,36,255,247,2,28,2,166,0,34,2,200,0,0,1,7,7,205,1,230,0,45,0,8,177,1,1,176,45,176,51,43,0,0,255,255,0,36,255,247,2,28,3,8,0,34,2,200,0,0,0,39,7,237,1,230,255,116,1,7,7,221,1,231,255,224,0,18,177,1,1,184,255,116,176,51,43,177,2,2,184,255,224,176,51,43,0,1,0,36,255,15,2,28,1,248,0,62,0,115,64,21,32,24,2,3,1,5,1,0,3,59,58,2,6,0,3,74,41,20,2,2,72,75,176,8,80,88,64,31,0,6,8,1,7,6,7,99,4,1,1,1,2,93,5,1,2,2,38,75,0,3,3,0,95,0,0,0,39,0,76,27,64,31,0,6,8,1,7,6,7,99,4,1,1,1,2,93,5,1,2,2,38,75,0,3,3,0,95,0,0,0,41,0,76,89,64,16,0,0,0,62,0,62,46,34,37,40,34,37,38,9,7,27,43,4,38,53,52,54,55,6,35,34,38,53,53,52,38,35,7,39,55,23,50,55,7,6,6,7,7,20,22,51,50,54,53,39,38,38,35,7,39,55,23,50,55,7,6,6,21,17,20,6,7,6,6,21,20,22,51,50,54,55,23,6,6,7,1,62,61,47,46,35,38,89,93,12,18,27,2,6,91,23,74,4,29,20,2,6,66,62,63,65,4,2,10,17,34,1,6,93,44,40,3,35,20,47,44,36,35,32,26,19,44,14,13,19,56,25,241,50,44,32,68,46,8,88,83,255,25,17,1,3,39,2,6,40,4,18,22,229,71,77,63,60,251,27,15,1,3,39,2,6,40,6,15,22,255,0,51,75,46,38,52,31,24,30,14,9,19,18,37,8,0,0,255,255,0,36,255,247,2,28,2,221,0,34,2,200,0,0,1,7,7,200,1,237,0,25,0,8,177,1,2,176,25,176,51,43,0,0,255,255,0,36,255,247,2,28,2,215,0,34,2,200,0,0,1,6,8,9,83,35,0,8,177,1,1,176,35,176,51,43,255,255,0,36,255,247,2,28,3,49,0,34,2,200,0,0,0,39,7,201,1,230,255,251,1,135,7,227,1,154,255,229,63,233,252,167,3,89,63,233,0,18,177,1,1,184,255,251,176,51,43,177,2,1,184,255,229,176,51,43,0,1,0,4,255,243,2,4,1,250,0,43,0,42,64,39,14,13,2,1,72,43,1,3,71,0,3,0,3,132,6,4,2,3,0,0,1,93,5,1,1,1,38,0,76,17,83,37,21,20,66,20,7,7,27,43,54,2,39,38,38,39,39,55,50,22,51,50,54,55,23,7,6,6,21,20,18,23,51,54,54,53,52,38,35,35,39,55,22,22,51,50,54,51,7,6,6,7,3,7,202,85,39,7,35,30,2,6,11,58,28,30,84,13,3,3,44,27,81,15,9,35,93,24,29,40,2,5,11,73,34,31,52,9,7,24,19,9,169,74,28,1,13,116,22,22,2,3,38,2,7,1,6,36,3,12,16,16,254,230,51,84,248,16,16,13,4,38,1,4,2,41,1,15,23,254,96,17,0,0,0,1,0,5,255,243,3,14,1,250,0,76,0,51,64,48,65,1,0,1,1,74,40,14,2,1,72,76,73,70,48,27,22,6,0,71,4,2,2,0,0,1,93,5,3,2,1,1,38,0,76,63,59,56,54,38,34,32,31,67,20,6,7,22,43,54,2,39,38,38,39,52,39,55,50,22,51,50,54,55,23,7,6,6,21,20,18,23,51,54,55,54,55,48,39,38,38,39,39,55,50,22,51,50,54,55,23,7,6,6,21,20,18,23,51,54,18,53,52,38,35,35,39,55,22,22,51,50,54,51,7,6,6,7,3,7,38,38,39,35,3,7,197,81,39,8,33,29,2,6,11,56,27,37,75,11,3,4,42,26,79,15,6,25,42,16,27,13,7,33,31,2,6,11,59,28,32,78,12,3,3,42,27,79,15,7,32,92,23,29,38,2,6,11,71,32,30,51,8,6,23,19,8,165,71,2,59,34,5,109,72,28,1,13,116,23,22,1,1,2,38,2,7,1,6,36,3,12,16,19,254,232,50,61,116,45,72,39,22,18,2,3,38,2,7,1,6,36,3,12,16,17,254,231,51,78,1,1,16,14,12,4,38,1,4,2,41,2,14,23,254,96,17,12,198,104,254,215,17,0,255,255,0,5,255,243,3,14,2,248,0,34,2,229,0,0,1,7,7,194,2,55,0,45,0,8,177,1,1,176,45,176,51,43,0,0,255,255,0,5,255,243,3,14,2,215,0,34,2,229,0,0,1,7,7,197,2,90,0,24,0,8,177,1,1,176,24,176,51,43,0,0,255,255,0,5,255,243,3,14,2,172,0,34,2,229,0,0,1,7,7,186,2,84,0,45,0,8,177,1,2,176,45,176,51,43,0,0,255,255,0,5,255,243,3,14,2,247,0,34,2,229,0,0,1,7,7,193,2,85,0,45,0,8,177,1,1,176,45,176,51,43,0,0,0,1,0,20,255,250,2,38,1,248,0,82,0,75,64,72,73,53,49,32,10,5,3,0,45,1,2,3,2,74,18,1,0,1,73,26,2,2,1,72,67,44,2,2,71,0,0,1,3,1,0,3,126,7,6,2,1,1,38,75,4,1,3,3,2,96,5,1,2,2,39,2,76,0,0,0,82,0,79,67,27,19,93,95,20,8,7,26,43,18,54,55,23,7,6,6,21,20,22,23,55,62,2,53,52,38,39,39,55,50,22,51,50,54,55,23,7,6,6,7,7,23,22,22,23,23,7,34,38,35,34,6,7,39,55,54,54,53,52,38,39,39,7,6,6,21,20,23,23,7,38,38,35,34,6,7,39,55,54,54,55,55,39,38,38,39,39,55,50,22,51,192,68,9,2,3,31,29,43,45,31,5,43,22,22,24,2,5,5,67,23,27,48,8,3,5,36,40,35,96,114,23,51,37,2,6,11,60,32,28,90,14,3,3,31,29,9,7,85,70,22,16,45,3,6,10,65,19,27,49,9,3,5,32,58,40,88,103,21,52,37,2,5,13,71,37,1,242,5,1,6,33,1,13,12,10,65,64,39,7,54,35,7,10,10,2,3,36,5,2,1,6,34,9,31,42,118,156,31,31,3,3,39,2,5,1,6,35,2,11,13,6,17,9,119,88,28,26,10,20,3,4,38,1,4,2,1,6,37,9,50,47,105,144,29,31,5,4,36,2,0,1,255,253,255,247,1,223,1,248,0,67,0,58,64,55,22,1,1,0,29,1,4,1,60,1,5,4,3,74,43,21,2,0,72,67,1,5,71,2,1,1,1,0,93,3,1,0,0,38,75,0,4,4,5,95,0,5,5,39,5,76,53,45,82,26,19,95,6,7,26,43,55,62,2,53,53,52,38,39,39,46,2,39,39,55,50,22,51,50,54,55,23,7,6,6,21,20,22,23,51,55,54,53,52,39,39,55,50,22,51,50,54,55,23,7,14,2,7,7,6,6,21,20,22,51,50,54,51,23,7,38,38,35,34,6,7,133,30,28,8,10,14,75,19,20,32,30,2,6,9,55,30,28,80,12,3,3,34,25,71,15,5,86,13,49,2,5,6,68,22,26,44,8,3,5,27,30,23,26,81,11,6,16,21,13,23,4,2,8,12,66,34,26,66,10,32,5,16,30,30,31,23,36,27,144,36,29,18,3,4,36,2,5,1,6,33,2,11,14,13,146,29,154,23,15,19,3,3,36,5,2,1,6,34,6,20,32,43,138,21,50,65,26,20,2,3,42,1,2,7,2,255,255,255,253,255,247,1,223,2,248,0,34,2,235,0,0,1,7,7,194,1,152,0,45,0,8,177,1,1,176,45,176,51,43,0,0,255,255,255,253,255,247,1,223,2,215,0,34,2,235,0,0,1,7,7,197,1,187,0,24,0,8,177,1,1,176,24,176,51,43,0,0,255,255,255,253,255,247,1,223,2,172,0,34,2,235,0,0,1,7,7,186,1,181,0,45,0,8,177,1,2,176,45,176,51,43,0,0,255,255,255,253,255,247,1,223,2,225,0,34,2,235,0,0,1,7,7,191,1,181,0,45,0,8,177,1,1,176,45,176,51,43,0,0,255,255,255,253,255,64,1,223,1,248,0,34,2,235,0,0,0,3,7,213,1,178,0,0,255,255,255,253,255,247,1,223,2,247,0,34,2,235,0,0,1,7,7,193,1,182,0,45,0,8,177,1,1,176,45,176,51,43,0,0,255,255,255,253,255,247,1,223,3,8,0,34,2,235,0,0,1,7,7,208,1,182,0,25,0,8,177,1,1,176,25,176,51,43,0,0,255,255,255,253,255,247,1,223,2,166,0,34,2,235,0,0,1,7,7,205,1,180,0,45,0,8,177,1,1,176,45,176,51,43,0,0,255,255,255,253,255,247,1,223,2,221,0,34,2,235,0,0,1,7,7,201,1,180,0,45,0,8,177,1,1,176,45,176,51,43,0,0,0,1,0,36,255,253,1,192,1,252,0,27,0,50,64,47,9,1,0,1,21,6,2,2,0,24,1,3,2,3,74,27,1,3,71,0,0,0,1,93,0,1,1,38,75,0,2,2,3,93,0,3,3,39,3,76,23,36,39,33,4,7,24,43,55,1,7,6,6,7,7,54,54,55,55,31,2,6,6,7,55,54,54,55,55,6,6,7,7,37,7,36,1,45,132,56,45,6,46,2,11,1,9,144,218,11,99,169,43,156,42,51,12,47,3,15,3,13,254,209,59,25,1,175,5,3,44,57,4,14,98,45,8,9,5,25,124,240,66,7,2,60,64,5,15,104,47,13,4,5,0,0,255,255,0,36,255,253,1,192,2,248,0,34,2,245,0,0,1,7,7,194,1,159,0,45,0,8,177,1,1,176,45,176,51,43,0,0,255,255,0,36,255,253,1,192,2,243,0,34,2,245,0,0,1,7,7,198,1,188,0,45,0,8,177,1,1,176,45,176,51,43,0,0,255,255,0,36,255,253,1,192,2,225,0,34,2,245,0,0,1,7,7,191,1,188,0,45,0,8,177,1,1,176,45,176,51,43,0,0,255,255,0,36,255,64,1,192,1,252,0,34,2,245,0,0,0,3,7,213,1,185,0,0,0,2,0,30,1,87,1,54,2,135,0,43,0,53,0,100,64,17,21,1,1,2,47,46,39,11,4,3,1,1,1,0,3,3,74,75,176,10,80,88,64,25,0,1,1,2,95,0,2,2,130,75,7,5,2,3,3,0,95,6,4,2,0,0,131,0,76,27,64,23,0,2,0,1,3,2,1,103,7,5,2,3,3,0,95,6,4,2,0,0,131,0,76,89,64,19,44,44,0,0,44,53,44,52,0,43,0,43,40,40,41,35,8,14,24,43,18,39,39,6,35,34,38,53,52,54,63,2,52,38,35,34,6,6,7,39,39,62,2,51,50,22,21,20,7,6,21,20,22,51,50,54,55,23,14,2,7,38,54,55,55,7,6,21,20,22,51,195,5,4,50,21,36,49,20,16,122,1,29,26,18,34,21,3,5,9,6,43,49,13,49,50,5,7,13,11,11,21,3,9,2,17,26,14,107,29,12,2,76,17,23,17,1,87,50,1,48,49,37,19,29,4,30,20,29,32,13,15,2,2,33,4,22,21,46,38,15,42,68,11,13,14,11,2,12,4,24,26,4,56,13,10,62,22,5,18,17,23,0,0,0,2,0,28,1,87,1,54,2,135,0,12,0,24,0,108,75,176,8,80,88,64,23,0,2,2,0,95,0,0,0,130,75,5,1,3,3,1,95,4,1,1,1,131,1,76,27,75,176,10,80,88,64,23,0,2,2,0,95,0,0,0,130,75,5,1,3,3,1,95,4,1,1,1,137,1,76,27,64,21,0,0,0,2,3,0,2,103,5,1,3,3,1,95,4,1,1,1,137,1,76,89,89,64,18,13,13,0,0,13,24,13,23,19,17,0,12,0,11,37,6,14,21,43,18,38,53,52,54,54,51,50,22,21,20,6,35,54,54,53,52,38,35,34,6,21,20,22,51,100,72,39,70,43,59,71,85,66,46,34,41,35,31,34,41,35,1,87,79,64,46,73,42,78,65,70,91,41,49,45,58,65,49,45,58,65,0,0,0,1,0,17,1,89,1,81,3,50,0,63,0,110,64,20,15,1,4,1,48,1,2,4,38,1,3,2,3,74,13,12,9,3,0,72,75,176,10,80,88,64,30,0,0,1,0,131,0,4,4,1,95,0,1,1,130,75,8,7,5,3,2,2,3,95,6,1,3,3,131,3,76,27,64,28,0,0,1,0,131,0,1,0,4,2,1,4,103,8,7,5,3,2,2,3,95,6,1,3,3,131,3,76,89,64,16,0,0,0,63,0,63,82,38,41,66,40,42,37,9,14,27,43,18,54,53,17,52,38,35,35,39,55,54,54,55,23,6,7,54,54,51,50,22,21,20,7,6,21,20,22,51,55,23,7,34,38,35,34,6,7,55,54,54,53,55,52,38,35,34,6,7,6,21,20,22,51,55,23,7,34,38,35,34,6,35,55,45,14,11,14,14,3,3,33,71,11,5,12,5,17,59,14,44,48,5,6,10,11,21,1,6,6,37,20,16,47,7,4,17,15,3,24,22,18,38,13,2,10,11,19,2,6,7,37,21,23,38,7,5,1,128,16,17,1,62,19,15,2,28,4,13,2,10,15,198,15,37,43,39,17,45,66,20,17,15,1,3,34,2,5,1,34,4,17,16,115,29,31,20,10,92,53,17,14,1,3,34,2,2,34,0,2,0,16,0,198,0,138,3,37,0,11,0,33,0,49,64,46,28,27,24,3,2,1,1,74,33,1,2,71,0,2,1,2,132,0,0,1,1,0,87,0,0,0,1,95,3,1,1,0,1,79,0,0,20,19,0,11,0,10,36,4,14,21,43,18,38,53,52,54,51,50,22,21,20,6,35,3,55,54,54,53,53,52,38,35,34,6,35,55,54,54,55,23,6,17,20,6,7,75,21,26,19,18,21,25,20,77,1,28,19,10,14,6,10,2,3,29,69,11,4,12,49,45,2,208,22,18,20,25,22,18,19,26,254,6,6,27,64,63,190,19,15,2,31,4,14,2,10,22,254,239,45,75,24,0,0,1,0,18,1,89,0,164,3,50,0,29,0,31,64,28,14,13,9,3,0,72,0,0,1,0,131,0,1,1,2,95,0,2,2,131,2,76,66,43,53,3,14,23,43,19,54,54,53,17,52,39,35,7,53,55,54,54,55,23,6,6,21,20,22,51,55,23,7,34,38,35,34,6,7,26,23,10,20,5,16,2,33,71,11,5,8,12,10,11,22,1,6,7,38,21,19,44,7,1,122,6,22,30,1,43,33,1,1,9,22,4,13,2,10,10,232,151,17,14,1,3,33,2,5,1,0,0,0,1,0,29,1,89,1,94,2,135,0,65,0,94,64,22,41,38,33,3,0,4,50,8,2,1,0,65,24,2,2,1,3,74,37,1,4,72,75,176,10,80,88,64,24,3,1,0,0,4,95,0,4,4,130,75,5,1,1,1,2,95,6,1,2,2,131,2,76,27,64,22,0,4,3,1,0,1,4,0,103,5,1,1,1,2,95,6,1,2,2,131,2,76,89,64,10,66,40,45,24,82,38,37,7,14,27,43,18,54,53,55,52,38,35,34,7,7,6,21,20,22,51,55,23,7,34,38,35,34,6,7,55,54,54,53,53,52,38,35,35,39,55,54,54,55,23,6,6,7,23,54,54,51,50,22,21,20,7,6,21,20,22,51,55,23,7,34,38,35,34,6,7,55,231,16,2,24,22,29,37,1,5,9,12,19,1,6,6,37,20,19,45,7,4,19,15,14,17,8,2,3,32,64,9,5,1,5,1,2,20,56,12,43,49,4,6,10,11,21,1,6,6,37,21,16,46,7,3,1,127,17,16,115,29,31,28,25,112,10,17,14,1,3,34,2,3,1,34,2,17,17,142,21,17,3,28,4,13,2,6,4,25,13,2,16,34,44,38,8,54,66,20,17,15,1,3,34,2,5,1,34,0,0,0,1,0,33,1,87,0,243,2,135,0,47,0,141,64,15,32,1,2,3,8,7,2,0,2,4,1,4,0,3,74,75,176,8,80,88,64,30,0,2,3,0,3,2,0,126,0,3,3,1,95,0,1,1,130,75,0,0,0,4,95,5,1,4,4,131,4,76,27,75,176,10,80,88,64,30,0,2,3,0,3,2,0,126,0,3,3,1,95,0,1,1,130,75,0,0,0,4,95,5,1,4,4,137,4,76,27,64,28,0,2,3,0,3,2,0,126,0,1,0,3,2,1,3,103,0,0,0,4,95,5,1,4,4,137,4,76,89,89,64,13,0,0,0,47,0,46,35,22,42,42,6,14,24,43,18,38,38,39,39,54,54,55,55,22,22,51,50,54,53,52,38,39,38,38,53,52,54,51,50,22,21,23,6,6,7,7,55,52,38,35,34,6,21,20,22,23,22,22,21,20,6,35,96,37,20,3,3,3,4,1,30,1,28,30,21,29,27,42,38,33,71,55,24,44,2,1,8,3,31,1,23,25,19,25,23,26,54,38,73,52,1,87,7,8,1,6,16,46,21,3,35,33,18,13,14,23,20,18,39,25,41,53,10,1,5,7,47,26,2,14,22,21,17,13,13,23,13,26,38,27,38,55,0,0,1,0,5,1,85,1,219,2,132,0,62,0,80,64,15,31,11,2,1,72,62,59,56,42,38,21,18,7,0,71,75,176,10,80,88,64,16,5,3,2,3,0,0,1,95,6,4,2,1,1,130,0,76,27,64,23,6,4,2,1,0,0,1,87,6,4,2,1,1,0,95,5,3,2,3,0,1,0,79,89,64,10,34,47,50,26,20,34,19,7,14,27,43,18,38,39,38,39,39,55,23,50,54,55,23,7,6,6,21,20,22,23,51,54,55,38,38,35,39,55,23,50,54,55,23,7,6,6,21,20,22,23,51,54,54,53,52,38,35,35,39,55,23,55,7,6,6,15,2,38,39,39,35,7,7,108,43,18,10,31,1,4,56,25,49,7,2,5,20,13,37,7,5,36,23,5,17,18,1,5,55,25,48,7,2,5,21,12,37,7,5,27,37,10,12,21,2,4,66,56,5,13,14,10,84,60,2,36,9,6,58,61,1,115,147,58,31,1,2,30,1,4,1,4,29,1,7,8,12,144,26,90,72,17,15,3,30,1,3,1,3,30,2,5,8,11,145,26,69,103,9,8,6,4,28,1,1,32,1,16,24,216,10,15,121,33,159,10,0,0,0,0,1,0,12,1,91,1,61,2,130,0,73,0,107,64,18,3,1,1,0,66,46,43,29,11,5,5,1,2,74,39,1,4,71,75,176,10,80,88,64,26,2,1,1,1,0,95,3,8,2,0,0,130,75,6,1,5,5,4,95,7,1,4,4,131,4,76,27,64,24,3,8,2,0,2,1,1,5,0,1,103,6,1,5,5,4,95,7,1,4,4,131,4,76,89,64,23,1,0,58,54,52,51,42,41,38,35,23,20,18,17,5,4,0,73,1,72,9,14,20,43,18,54,55,23,7,34,6,21,20,22,23,23,55,54,54,53,52,38,35,39,55,51,50,54,51,23,7,6,7,7,23,22,22,23,23,7,39,34,6,7,39,55,50,53,52,39,39,6,6,21,20,22,23,23,7,34,38,35,34,6,35,39,55,54,54,55,55,39,38,38,39,39,55,23,114,40,6,2,4,14,13,13,2,30,34,3,15,10,15,1,3,53,16,29,5,2,4,24,30,53,53,17,29,18,1,4,61,23,50,9,1,4,27,9,42,18,37,11,15,1,4,7,36,15,15,26,4,2,4,14,20,24,53,45,19,27,22,1,4,70,2,127,2,1,4,27,5,7,7,19,3,42,43,3,20,7,5,3,3,27,2,3,28,12,35,65,72,23,21,2,2,28,1,3,1,4,26,12,7,13,57,21,48,7,6,5,1,3,27,3,2,4,26,7,20,28,61,63,27,19,4,3,29,1,0,0,0,0,1,255,255,0,198,1,53,2,132,0,48,0,86,64,12,29,26,6,3,0,1,1,74,18,1,2,72,75,176,10,80,88,64,21,0,0,0,6,0,6,99,4,3,2,1,1,2,95,5,1,2,2,130,1,76,27,64,27,5,1,2,4,3,2,1,0,2,1,103,0,0,6,6,0,87,0,0,0,6,95,0,6,0,6,79,89,64,10,24,66,42,19,50,23,19,7,14,27,43,54,38,53,55,54,54,55,38,38,39,38,38,35,39,55,23,50,54,55,23,7,6,6,21,20,22,23,51,54,53,52,38,35,35,39,55,50,22,51,55,7,6,6,7,7,14,2,39,31,32,4,39,66,22,16,54,16,8,19,14,1,4,51,27,53,8,2,5,20,14,42,8,4,66,10,11,25,1,4,6,37,24,57,5,14,14,6,82,31,46,44,29,199,37,8,6,2,51,44,47,145,40,15,13,3,30,1,3,2,4,29,1,7,8,13,135,24,158,13,8,7,3,29,2,1,32,3,13,17,193,72,78,34,1,0,0,0,2,0,30,1,87,1,54,2,135,0,43,0,53,0,64,64,61,21,1,1,2,47,46,39,11,4,3,1,1,1,0,3,3,74,0,1,1,2,95,0,2,2,91,75,7,5,2,3,3,0,95,6,4,2,0,0,88,0,76,44,44,0,0,44,53,44,52,0,43,0,43,40,40,41,35,8,11,24,43,18,39,39,6,35,34,38,53,52,54,63,2,52,38,35,34,6,6,7,39,39,62,2,51,50,22,21,20,7,6,21,20,22,51,50,54,55,23,14,2,7,38,54,55,55,7,6,21,20,22,51,195,5,4,50,21,36,49,20,16,122,1,29,26,18,34,21,3,5,9,6,43,49,13,49,50,5,7,13,11,11,21,3,9,2,17,26,14,107,29,12,2,76,17,23,17,1,87,50,1,48,49,37,19,29,4,30,20,29,32,13,15,2,2,33,4,22,21,46,38,15,42,68,11,13,14,11,2,12,4,24,26,4,56,13,10,62,22,5,18,17,23,0,0,0,2,0,15,1,88,1,61,3,50,0,27,0,40,0,71,64,68,18,1,3,1,37,36,2,4,3,3,1,2,4,3,74,16,15,12,3,0,72,0,0,1,0,131,0,3,3,1,95,0,1,1,87,75,6,1,4,4,2,95,5,1,2,2,92,2,76,28,28,0,0,28,40,28,39,34,32,0,27,0,26,44,22,7,11,22,43,18,38,39,39,17,52,38,35,34,6,35,39,55,54,54,55,23,6,7,54,51,50,22,21,20,6,6,35,54,54,53,52,38,35,34,6,7,7,22,22,51,127,56,8,6,12,13,5,9,1,2,3,40,64,11,4,11,5,62,11,56,67,42,74,45,52,41,41,32,12,31,13,2,10,31,13,1,88,7,2,6,1,120,19,16,2,3,28,6,11,2,10,14,190,42,75,62,47,75,43,45,50,46,47,61,15,11,167,4,7,0,0,0,0,1,0,28,1,87,1,5,2,135,0,35,0,56,64,53,11,1,2,0,31,1,4,3,2,74,0,1,2,3,2,1,3,126,0,2,2,0,95,0,0,0,91,75,0,3,3,4,95,5,1,4,4,92,4,76,0,0,0,35,0,34,36,35,23,37,6,11,24,43,18,38,53,52,54,54,51,50,22,22,23,23,6,6,7,7,53,52,38,35,34,6,21,20,22,51,50,54,54,55,23,23,14,2,35,102,74,40,70,43,20,35,20,3,2,2,10,1,35,25,21,34,35,41,37,16,30,20,3,5,9,4,32,41,16,1,87,78,65,46,73,42,6,6,1,5,7,54,32,2,20,22,26,48,45,52,59,8,10,1,1,28,3,22,20,0,0,0,0,2,0,28,1,87,1,97,3,50,0,39,0,53,0,75,64,72,13,1,5,1,44,35,2,3,5,1,1,0,3,3,74,25,24,21,3,2,72,0,2,1,2,131,0,5,5,1,95,0,1,1,87,75,8,6,2,3,3,0,95,7,4,2,0,0,88,0,76,40,40,0,0,40,53,40,52,48,46,0,39,0,39,45,20,37,35,9,11,24,43,18,39,39,6,35,34,38,53,52,54,54,51,50,23,53,52,38,35,34,6,35,55,54,54,55,23,6,6,21,20,22,51,50,54,55,23,14,2,7,38,54,54,55,53,52,38,35,34,6,21,20,22,51,238,6,4,65,12,56,67,42,74,45,9,28,12,13,5,9,2,4,33,70,10,5,8,12,13,11,11,19,3,9,2,17,26,15,112,25,18,2,33,20,36,41,41,32,1,87,46,1,44,74,62,46,75,43,2,90,19,16,2,32,4,13,2,9,12,229,141,13,14,11,2,12,4,23,26,5,54,12,12,2,165,1,11,51,45,47,60,0,0,2,0,28,1,87,1,22,2,135,0,27,0,37,0,60,64,57,23,1,3,2,1,74,7,1,5,0,1,2,5,1,101,0,4,4,0,95,0,0,0,91,75,0,2,2,3,95,6,1,3,3,92,3,76,28,28,0,0,28,37,28,37,35,33,0,27,0,26,35,21,37,8,11,23,43,18,38,53,52,54,54,51,50,21,20,6,7,7,35,21,22,22,51,50,54,54,55,23,23,14,2,35,55,54,54,53,52,38,35,34,6,7,105,77,39,68,40,103,3,1,8,171,2,46,39,18,34,23,3,4,9,5,34,46,19,27,8,6,24,22,27,36,4,1,87,78,65,44,74,43,101,11,20,3,7,8,47,53,8,10,1,1,26,4,22,20,197,1,6,9,23,25,36,33,0,0,1,0,29,1,92,1,47,3,50,0,51,0,61,64,58,18,1,2,1,22,10,2,3,2,34,9,2,0,3,3,74,0,2,2,1,95,0,1,1,86,75,4,1,0,0,3,95,0,3,3,87,75,0,5,5,6,93,0,6,6,88,6,76,83,51,19,35,42,38,22,7,11,27,43,19,54,54,53,53,38,38,39,39,55,55,53,52,54,51,50,22,21,23,6,6,7,7,46,2,35,34,6,7,21,50,54,51,23,7,39,7,20,22,51,50,54,51,23,7,34,38,35,34,6,7,37,19,17,1,16,24,3,5,39,84,71,28,45,2,2,11,8,7,2,20,31,18,34,32,1,32,46,7,2,7,81,2,14,15,15,21,3,2,5,10,52,25,28,44,7,1,125,2,18,16,157,15,9,1,4,28,6,5,81,95,11,1,8,4,26,20,2,2,11,11,50,56,30,2,2,39,2,179,16,15,1,3,36,2,2,1,0,3,0,38,0,199,1,71,2,149,0,51,0,63,0,77,0,87,64,84,29,1,4,0,37,12,2,2,5,70,9,5,2,4,6,2,3,74,26,1,0,72,8,1,5,0,2,6,5,2,103,0,4,4,0,95,1,1,0,0,91,75,9,1,6,6,3,95,7,1,3,3,93,3,76,64,64,52,52,0,0,64,77,64,76,52,63,52,62,58,56,0,51,0,50,36,34,23,22,19,18,10,11,20,43,54,38,53,54,54,55,53,38,38,53,54,54,55,53,38,38,53,52,54,51,50,23,22,51,54,54,55,23,15,2,22,21,20,6,35,34,39,6,6,21,20,22,23,30,2,21,20,6,6,35,18,54,53,52,38,35,34,6,21,20,22,51,22,54,53,52,38,38,39,14,2,21,20,22,51,99,57,13,44,7,30,38,12,36,6,23,25,73,53,5,33,15,12,20,60,9,3,8,50,3,26,76,58,18,20,10,12,38,42,42,54,39,47,76,41,49,28,34,29,26,28,34,29,33,50,17,47,51,2,15,14,34,29,199,46,40,15,32,4,4,4,35,24,12,26,4,3,13,44,28,48,66,3,3,2,15,3,3,43,5,3,28,35,48,64,5,5,14,6,15,9,3,3,9,30,28,29,54,33,1,13,34,31,34,39,34,31,34,39,229,32,21,12,12,10,7,2,14,22,11,21,24,0,0,1,0,17,1,89,1,81,3,50,0,63,0,69,64,66,15,1,4,1,48,1,2,4,38,1,3,2,3,74,13,12,9,3,0,72,0,0,1,0,131,0,4,4,1,95,0,1,1,91,75,8,7,5,3,2,2,3,95,6,1,3,3,88,3,76,0,0,0,63,0,63,82,38,41,66,40,42,37,9,11,27,43,18,54,53,17,52,38,35,35,39,55,54,54,55,23,6,7,54,54,51,50,22,21,20,7,6,21,20,22,51,55,23,7,34,38,35,34,6,7,55,54,54,53,55,52,38,35,34,6,7,6,21,20,22,51,55,23,7,34,38,35,34,6,35,55,45,14,11,14,14,3,3,33,71,11,5,12,5,17,59,14,44,48,5,6,10,11,21,1,6,6,37,20,16,47,7,4,17,15,3,24,22,18,38,13,2,10,11,19,2,6,7,37,21,23,38,7,5,1,128,16,17,1,62,19,15,2,28,4,13,2,10,15,198,15,37,43,39,17,45,66,20,17,15,1,3,34,2,5,1,34,4,17,16,115,29,31,20,10,92,53,17,14,1,3,34,2,2,34,0,0,2,0,30,1,88,0,174,3,37,0,11,0,42,0,57,64,54,27,26,23,3,2,1,1,74,0,2,1,3,1,2,3,126,5,1,1,1,0,95,0,0,0,86,75,0,3,3,4,95,0,4,4,88,4,76,0,0,40,36,34,32,19,18,0,11,0,10,36,6,11,21,43,18,38,53,52,54,51,50,22,21,20,6,35,3,54,54,53,53,52,38,35,34,6,35,55,54,54,55,23,6,6,21,20,22,51,55,23,7,34,38,35,34,6,7,82,21,25,20,17,21,25,20,64,19,17,12,14,5,9,1,3,32,67,10,5,7,8,10,11,20,1,5,7,37,21,19,47,7,2,208,22,18,20,25,22,18,19,26,254,170,4,19,17,146,19,15,2,31,4,14,2,10,13,127,82,16,14,1,3,34,2,6,1,0,0,0,0,2,0,16,0,198,0,138,3,37,0,11,0,33,0,44,64,41,28,27,24,3,2,1,1,74,33,1,2,71,0,2,1,2,132,3,1,1,1,0,95,0,0,0,86,1,76,0,0,20,19,0,11,0,10,36,4,11,21,43,18,38,53,52,54,51,50,22,21,20,6,35,3,55,54,54,53,53,52,38,35,34,6,35,55,54,54,55,23,6,17,20,6,7,75,21,26,19,18,21,25,20,77,1,28,19,10,14,6,10,2,3,29,69,11,4,12,49,45,2,208,22,18,20,25,22,18,19,26,254,6,6,27,64,63,190,19,15,2,31,4,14,2,10,22,254,239,45,75,24,0,0,0,2,0,18,1,87,1,73,3,50,0,29,0,64,0,63,64,60,43,1,3,4,64,48,2,1,3,54,29,2,2,1,3,74,13,12,8,3,0,72,0,0,4,0,131,0,3,3,4,95,0,4,4,87,75,5,1,1,1,2,95,6,1,2,2,88,2,76,52,26,50,24,82,43,52,7,11,27,43,18,54,53,17,52,39,35,7,53,55,54,54,55,23,6,6,21,20,22,51,55,23,7,34,38,35,34,6,7,63,2,54,53,52,38,35,39,55,23,50,54,55,23,7,14,2,7,23,22,22,23,23,7,6,6,35,35,34,39,38,38,39,39,49,10,20,5,16,2,33,71,11,5,8,12,10,11,20,1,6,7,37,21,18,43,7,4,108,69,14,16,18,2,6,70,22,37,6,2,5,25,50,43,6,60,19,33,19,2,4,6,33,8,5,13,8,13,23,14,69,1,128,21,31,1,43,33,1,1,9,22,4,13,2,10,10,231,152,17,14,1,3,33,2,3,1,34,131,65,14,7,7,6,4,25,1,2,1,3,29,8,41,42,6,83,25,23,1,4,26,1,7,3,4,22,23,105,0,1,0,18,1,89,0,164,3,50,0,29,0,31,64,28,14,13,9,3,0,72,0,0,1,0,131,0,1,1,2,95,0,2,2,88,2,76,66,43,53,3,11,23,43,19,54,54,53,17,52,39,35,7,53,55,54,54,55,23,6,6,21,20,22,51,55,23,7,34,38,35,34,6,7,26,23,10,20,5,16,2,33,71,11,5,8,12,10,11,22,1,6,7,38,21,19,44,7,1,122,6,22,30,1,43,33,1,1,9,22,4,13,2,10,10,232,151,17,14,1,3,33,2,5,1,0,0,0,1,0,29,1,89,2,15,2,135,0,94,0,73,64,70,49,42,39,34,4,0,4,80,57,10,8,4,1,0,94,72,25,3,2,1,3,74,38,1,4,72,8,3,2,0,0,4,95,5,1,4,4,91,75,9,6,2,1,1,2,95,10,7,2,2,2,88,2,76,91,87,85,83,39,82,40,36,45,24,82,39,37,11,11,29,43,18,54,53,55,52,38,35,34,7,20,7,6,21,20,22,51,55,23,7,34,38,35,34,6,35,55,54,54,53,53,52,38,35,35,39,55,54,54,55,23,6,6,7,23,54,54,51,50,22,23,54,54,51,50,22,21,20,7,6,21,20,22,51,55,23,7,34,38,35,34,6,7,55,54,54,55,55,52,35,34,7,7,20,22,51,55,23,7,34,38,35,34,6,7,55,232,15,2,24,22,29,37,2,4,9,12,19,1,6,6,37,20,24,40,7,5,18,15,14,17,8,2,3,32,64,9,5,1,5,1,1,23,54,12,33,45,8,19,58,14,43,49,4,6,10,11,21,1,6,7,38,20,21,38,7,3,17,13,1,2,47,28,36,8,10,11,20,1,6,6,37,20,16,46,7,4,1,127,17,16,115,29,31,28,9,24,88,26,17,14,1,3,34,2,2,34,2,15,17,142,21,17,3,28,4,13,2,6,4,25,13,2,17,33,27,25,15,37,44,38,8,54,66,20,18,14,1,3,34,2,2,1,33,3,16,16,115,60,27,147,17,15,1,3,34,2,5,1,34,0,1,0,29,1,89,1,94,2,135,0,65,0,59,64,56,41,38,33,3,0,4,50,8,2,1,0,65,24,2,2,1,3,74,37,1,4,72,3,1,0,0,4,95,0,4,4,91,75,5,1,1,1,2,95,6,1,2,2,88,2,76,66,40,45,24,82,38,37,7,11,27,43,18,54,53,55,52,38,35,34,7,7,6,21,20,22,51,55,23,7,34,38,35,34,6,7,55,54,54,53,53,52,38,35,35,39,55,54,54,55,23,6,6,7,23,54,54,51,50,22,21,20,7,6,21,20,22,51,55,23,7,34,38,35,34,6,7,55,231,16,2,24,22,29,37,1,5,9,12,19,1,6,6,37,20,19,45,7,4,19,15,14,17,8,2,3,32,64,9,5,1,5,1,2,20,56,12,43,49,4,6,10,11,21,1,6,6,37,21,16,46,7,3,1,127,17,16,115,29,31,28,25,112,10,17,14,1,3,34,2,3,1,34,2,17,17,142,21,17,3,28,4,13,2,6,4,25,13,2,16,34,44,38,8,54,66,20,17,15,1,3,34,2,5,1,34,0,0,2,0,28,1,87,1,54,2,135,0,12,0,24,0,44,64,41,0,2,2,0,95,0,0,0,91,75,5,1,3,3,1,95,4,1,1,1,92,1,76,13,13,0,0,13,24,13,23,19,17,0,12,0,11,37,6,11,21,43,18,38,53,52,54,54,51,50,22,21,20,6,35,54,54,53,52,38,35,34,6,21,20,22,51,100,72,39,70,43,59,71,85,66,46,34,41,35,31,34,41,35,1,87,79,64,46,73,42,78,65,70,91,41,49,45,58,65,49,45,58,65,0,0,0,2,0,28,0,202,1,75,2,135,0,42,0,55,0,72,64,69,18,15,10,3,0,1,53,51,2,6,0,0,1,4,3,3,74,14,1,1,72,5,1,0,0,1,95,0,1,1,87,75,7,1,6,6,2,95,0,2,2,92,75,0,3,3,4,93,0,4,4,89,4,76,43,43,43,55,43,54,38,50,37,37,44,23,8,11,26,43,55,54,54,53,55,53,52,38,35,35,39,55,54,54,55,23,6,6,7,23,54,51,50,22,21,20,6,6,35,34,38,35,21,20,22,51,55,23,7,39,34,6,7,54,54,53,52,38,35,34,6,7,6,21,22,51,36,19,12,3,14,18,8,2,3,32,64,9,5,1,4,2,3,55,13,57,69,43,76,46,11,21,4,10,16,25,1,6,71,22,45,6,190,41,40,32,11,31,13,5,26,29,235,2,16,24,100,182,21,17,3,28,4,13,2,6,3,21,13,3,44,75,61,47,75,43,2,61,27,19,1,2,33,1,3,1,187,50,46,46,59,13,10,85,83,10,0,0,0,2,0,28,0,204,1,70,2,144,0,32,0,46,0,67,64,64,15,1,4,1,37,1,5,4,4,1,0,5,3,74,19,1,1,72,0,4,4,1,95,0,1,1,87,75,6,1,5,5,0,95,0,0,0,92,75,0,2,2,3,93,0,3,3,89,3,76,33,33,33,46,33,45,40,50,42,37,37,7,11,25,43,55,54,54,55,55,6,35,34,38,53,52,54,54,51,50,23,54,54,55,23,6,6,21,20,22,51,51,23,7,35,34,6,35,62,2,55,53,52,38,35,34,6,21,20,22,51,180,27,16,1,2,63,12,56,67,42,74,45,30,35,16,21,3,6,6,7,8,13,17,1,4,72,24,43,7,5,25,18,2,33,20,36,41,41,32,236,2,14,23,113,44,75,63,46,75,43,6,6,9,1,7,13,197,153,29,17,1,33,2,192,12,13,2,165,1,11,51,45,47,61,0,0,1,0,32,1,92,0,254,2,135,0,50,0,77,64,74,24,13,9,3,0,1,16,7,2,3,0,34,1,2,3,3,74,12,1,1,72,0,0,1,3,1,0,3,126,0,3,2,1,3,2,124,0,2,2,1,95,0,1,1,87,75,7,6,2,4,4,5,93,0,5,5,88,5,76,0,0,0,50,0,50,82,39,34,22,45,21,8,11,26,43,18,54,53,53,52,38,35,7,39,55,54,54,55,23,6,6,21,23,54,54,51,50,22,51,23,6,6,7,7,52,38,35,34,6,7,6,6,7,20,22,51,55,23,7,34,38,35,34,6,7,55,60,13,11,15,12,3,2,37,58,9,5,1,5,3,20,48,21,9,11,2,3,2,9,1,34,7,11,12,27,11,1,4,1,12,16,30,1,6,8,44,24,28,40,6,4,1,127,19,27,130,21,17,1,4,27,6,12,2,5,6,37,18,2,29,35,2,4,10,66,29,2,28,19,18,16,18,82,24,19,13,1,3,36,2,2,1,34,0,0,0,0,1,0,33,1,87,0,243,2,135,0,47,0,61,64,58,32,1,2,3,8,7,2,0,2,4,1,4,0,3,74,0,2,3,0,3,2,0,126,0,3,3,1,95,0,1,1,91,75,0,0,0,4,95,5,1,4,4,92,4,76,0,0,0,47,0,46,35,22,42,42,6,11,24,43,18,38,38,39,39,54,54,55,55,22,22,51,50,54,53,52,38,39,38,38,53,52,54,51,50,22,21,23,6,6,7,7,55,52,38,35,34,6,21,20,22,23,22,22,21,20,6,35,96,37,20,3,3,3,4,1,30,1,28,30,21,29,27,42,38,33,71,55,24,44,2,1,8,3,31,1,23,25,19,25,23,26,54,38,73,52,1,87,7,8,1,6,16,46,21,3,35,33,18,13,14,23,20,18,39,25,41,53,10,1,5,7,47,26,2,14,22,21,17,13,13,23,13,26,38,27,38,55,0,0,1,0,17,1,87,0,211,2,181,0,33,0,53,64,50,8,1,0,1,29,1,4,3,2,74,13,1,1,72,2,1,0,0,1,93,0,1,1,87,75,0,3,3,4,95,5,1,4,4,92,4,76,0,0,0,33,0,32,36,18,26,21,6,11,24,43,18,38,53,53,52,38,39,39,55,62,2,55,23,6,6,7,55,23,7,39,6,21,20,22,51,50,54,55,23,14,2,35,96,39,15,21,4,3,22,43,27,4,16,1,4,2,84,2,6,83,4,21,24,12,24,4,8,4,27,31,8,1,87,37,41,146,18,14,1,4,26,10,28,22,3,7,3,27,22,2,2,39,2,76,70,29,25,8,2,19,3,22,20,0,1,0,22,1,87,1,102,2,135,0,51,0,56,64,53,47,27,2,2,1,1,1,0,2,2,74,37,36,19,18,15,5,1,72,3,1,1,2,1,131,4,1,2,2,0,95,6,5,2,0,0,92,0,76,0,0,0,51,0,51,42,37,44,20,36,7,11,25,43,18,39,39,6,6,35,34,38,53,55,52,35,34,6,35,55,54,54,55,23,6,6,21,20,51,50,54,55,53,52,38,35,35,55,54,54,55,23,6,6,21,20,22,51,50,54,53,23,14,2,7,240,6,4,27,44,8,46,48,4,22,6,9,2,4,29,66,10,5,7,10,45,16,30,19,13,17,12,4,32,68,10,5,7,9,13,11,11,23,10,3,19,28,12,1,87,50,2,23,28,39,37,146,32,2,31,4,14,2,10,16,109,56,56,16,13,136,19,13,30,4,13,2,9,14,123,73,13,14,12,1,12,4,26,26,2,0,0,0,1,0,2,1,85,1,51,2,132,0,36,0,35,64,32,11,1,1,72,36,22,18,3,0,71,3,2,2,0,0,1,95,4,1,1,1,87,0,76,34,43,20,34,19,5,11,25,43,18,38,39,38,39,39,55,23,50,54,55,23,7,6,6,21,20,22,23,51,55,54,53,52,38,35,35,39,55,23,55,7,6,6,15,2,108,52,11,10,32,1,4,58,25,50,7,2,5,21,13,39,7,5,26,40,10,14,21,2,4,68,56,5,14,13,11,86,61,1,115,174,31,30,2,2,30,1,4,1,4,29,1,7,8,11,145,26,68,101,12,7,6,4,29,1,1,32,2,15,24,216,10,0,1,0,5,1,85,1,219,2,132,0,62,0,44,64,41,31,11,2,1,72,62,59,56,42,38,21,18,7,0,71,5,3,2,3,0,0,1,95,6,4,2,1,1,87,0,76,34,47,50,26,20,34,19,7,11,27,43,18,38,39,38,39,39,55,23,50,54,55,23,7,6,6,21,20,22,23,51,54,55,38,38,35,39,55,23,50,54,55,23,7,6,6,21,20,22,23,51,54,54,53,52,38,35,35,39,55,23,55,7,6,6,15,2,38,39,39,35,7,7,108,43,18,10,31,1,4,56,25,49,7,2,5,20,13,37,7,5,36,23,5,17,18,1,5,55,25,48,7,2,5,21,12,37,7,5,27,37,10,12,21,2,4,66,56,5,13,14,10,84,60,2,36,9,6,58,61,1,115,147,58,31,1,2,30,1,4,1,4,29,1,7,8,12,144,26,90,72,17,15,3,30,1,3,1,3,30,2,5,8,11,145,26,69,103,9,8,6,4,28,1,1,32,1,16,24,216,10,15,121,33,159,10,0,0,0,0,1,0,12,1,91,1,61,2,130,0,73,0,70,64,67,3,1,1,0,66,46,43,29,11,5,5,1,2,74,39,1,4,71,2,1,1,1,0,95,3,8,2,0,0,87,75,6,1,5,5,4,95,7,1,4,4,88,4,76,1,0,58,54,52,51,42,41,38,35,23,20,18,17,5,4,0,73,1,72,9,11,20,43,18,54,55,23,7,34,6,21,20,22,23,23,55,54,54,53,52,38,35,39,55,51,50,54,51,23,7,6,7,7,23,22,22,23,23,7,39,34,6,7,39,55,50,53,52,39,39,6,6,21,20,22,23,23,7,34,38,35,34,6,35,39,55,54,54,55,55,39,38,38,39,39,55,23,114,40,6,2,4,14,13,13,2,30,34,3,15,10,15,1,3,53,16,29,5,2,4,24,30,53,53,17,29,18,1,4,61,23,50,9,1,4,27,9,42,18,37,11,15,1,4,7,36,15,15,26,4,2,4,14,20,24,53,45,19,27,22,1,4,70,2,127,2,1,4,27,5,7,7,19,3,42,43,3,20,7,5,3,3,27,2,3,28,12,35,65,72,23,21,2,2,28,1,3,1,4,26,12,7,13,57,21,48,7,6,5,1,3,27,3,2,4,26,7,20,28,61,63,27,19,4,3,29,1,0,1,255,255,0,198,1,53,2,132,0,48,0,49,64,46,29,26,6,3,0,1,1,74,18,1,2,72,4,3,2,1,1,2,95,5,1,2,2,87,75,0,0,0,6,95,0,6,6,93,6,76,24,66,42,19,50,23,19,7,11,27,43,54,38,53,55,54,54,55,38,38,39,38,38,35,39,55,23,50,54,55,23,7,6,6,21,20,22,23,51,54,53,52,38,35,35,39,55,50,22,51,55,7,6,6,7,7,14,2,39,31,32,4,39,66,22,16,54,16,8,19,14,1,4,51,27,53,8,2,5,20,14,42,8,4,66,10,11,25,1,4,6,37,24,57,5,14,14,6,82,31,46,44,29,199,37,8,6,2,51,44,47,145,40,15,13,3,30,1,3,2,4,29,1,7,8,13,135,24,158,13,8,7,3,29,2,1,32,3,13,17,193,72,78,34,1,0,0,0,0,1,0,26,1,92,1,24,2,133,0,27,0,38,64,35,23,20,15,5,4,2,0,1,74,26,1,2,71,0,0,0,1,93,0,1,1,87,75,0,2,2,88,2,76,29,54,32,3,11,23,43,19,7,6,6,7,7,54,54,55,55,31,2,6,6,7,55,54,54,55,55,6,6,21,7,39,7,39,193,67,33,23,3,29,1,5,1,4,82,143,6,55,95,23,79,27,28,6,30,2,9,10,186,35,9,2,94,4,2,22,32,4,10,63,26,4,5,2,17,70,133,35,6,2,35,38,3,11,69,29,10,4,3,19,0,255,255,255,241,255,246,2,82,2,137,0,2,0,3,0,0,0,2,0,58,255,244,2,26,2,137,0,44,0,55,0,147,75,176,10,80,88,64,15,26,25,2,4,1,1,74,21,1,2,72,5,1,0,71,27,64,15,26,25,2,4,1,1,74,21,1,2,72,5,1,5,71,89,75,176,10,80,88,64,33,0,4,0,6,7,4,6,101,3,1,1,1,2,93,0,2,2,56,75,9,1,7,7,0,95,8,5,2,0,0,59,0,76,27,64,37,0,4,0,6,7,4,6,101,3,1,1,1,2,93,0,2,2,56,75,0,0,0,59,75,9,1,7,7,5,95,8,1,5,5,57,5,76,89,64,22,45,45,0,0,45,55,45,54,51,50,0,44,0,43,36,42,66,40,34,10,9,25,43,4,39,38,35,34,7,55,54,54,53,19,52,38,35,7,39,55,22,51,50,54,55,23,6,6,7,7,55,54,38,38,35,34,6,6,7,7,51,50,22,21,20,6,6,35,54,54,53,52,38,39,7,7,6,22,51,1,24,35,57,16,26,88,6,46,34,1,15,22,34,2,7,102,35,125,128,42,3,8,13,2,48,2,1,17,55,67,41,29,9,1,6,100,100,117,61,106,64,77,68,64,65,104,5,1,51,61,10,5,5,12,46,9,36,41,1,164,32,22,2,4,44,3,5,7,6,38,103,48,4,66,34,28,9,4,15,20,194,94,79,53,88,50,51,66,58,62,67,11,7,187,38,32,255,255,0,58,255,244,2,30,2,129,0,2,0,31,0,0,255,255,0,58,255,244,1,239,2,137,0,2,4,63,0,0,255,255,0,58,255,244,1,239,3,73,0,34,4,63,0,0,0,3,7,227,1,206,0,0,0,1,0,58,255,244,1,230,3,18,0,40,0,84,64,11,3,2,2,1,0,1,74,22,1,2,71,75,176,27,80,88,64,22,3,1,0,0,4,93,0,4,4,56,75,0,1,1,2,93,0,2,2,59,2,76,27,64,28,0,3,4,0,0,3,112,0,0,0,4,94,0,4,4,56,75,0,1,1,2,93,0,2,2,59,2,76,89,183,50,40,50,54,52,5,9,25,43,1,6,7,7,38,38,35,34,6,6,7,3,20,22,51,55,55,23,7,39,39,34,7,55,54,54,53,19,52,38,35,7,39,55,22,51,50,54,54,55,55,1,230,16,3,4,58,77,36,33,24,7,1,14,18,26,51,20,2,9,62,77,44,80,6,46,32,1,15,22,34,2,7,103,130,50,40,18,6,11,3,14,113,87,6,6,5,4,15,20,254,76,41,27,2,1,4,47,2,2,12,46,9,35,42,1,164,32,22,2,4,44,3,9,32,39,69,0,0,2,0,10,255,101,2,82,2,131,0,41,0,57,0,61,64,58,33,20,2,3,1,41,12,2,0,3,2,74,29,1,2,72,11,0,2,0,71,4,1,1,1,2,93,0,2,2,56,75,5,1,3,3,0,93,0,0,0,59,0,76,54,51,46,44,40,38,28,26,24,23,52,6,9,21,43,5,7,39,38,38,35,33,34,6,15,2,55,55,62,2,63,3,52,38,38,7,39,55,33,50,55,7,6,6,7,6,2,21,20,22,31,2,3,52,38,35,39,7,14,2,7,23,51,50,54,54,53,2,82,51,8,4,47,51,254,250,51,46,5,8,51,1,8,69,68,26,15,3,16,1,18,42,42,2,7,1,94,73,42,4,42,28,2,6,8,13,17,60,8,168,21,26,98,22,11,24,51,45,1,204,38,38,16,151,4,80,45,30,30,45,76,4,196,10,20,79,115,120,26,134,11,16,14,4,1,4,44,6,45,5,22,27,99,254,246,73,30,22,1,2,10,1,237,28,23,1,191,99,120,97,24,6,15,41,42,0,0,0,255,255,0,58,255,246,2,20,2,137,0,2,0,47,0,0,255,255,0,58,255,246,2,20,3,73,0,34,0,47,0,0,0,3,7,226,2,1,0,0,255,255,0,58,255,246,2,20,3,50,0,34,0,47,0,0,1,7,7,221,2,13,0,10,0,8,177,1,2,176,10,176,51,43,0,0,0,1,0,10,255,242,3,135,2,134,0,98,0,222,75,176,29,80,88,64,30,65,1,9,7,94,88,47,46,4,8,6,40,1,1,8,33,15,2,3,2,1,1,0,3,5,74,72,1,7,72,27,64,33,65,1,9,10,94,88,47,46,4,8,6,40,1,1,8,15,1,14,2,33,1,3,14,1,1,0,3,6,74,72,1,7,72,89,75,176,29,80,88,64,53,11,1,8,4,1,1,2,8,1,101,0,9,9,7,95,12,10,2,7,7,56,75,13,1,6,6,7,95,12,10,2,7,7,56,75,14,1,2,2,3,93,0,3,3,59,75,5,1,0,0,62,0,76,27,64,57,0,14,2,3,2,14,3,126,11,1,8,4,1,1,2,8,1,101,0,9,9,10,95,0,10,10,56,75,13,1,6,6,7,95,12,1,7,7,56,75,0,2,2,3,93,0,3,3,59,75,5,1,0,0,62,0,76,89,64,24,98,97,91,89,82,81,78,77,70,67,62,60,19,23,44,19,22,53,35,19,18,15,9,29,43,37,7,7,34,38,39,39,35,7,6,22,51,50,54,55,23,7,38,38,35,7,55,62,2,53,53,35,7,6,6,35,39,39,55,50,54,55,55,54,55,39,38,38,35,34,7,39,38,53,52,54,55,50,22,23,23,51,53,52,38,35,34,6,35,39,55,22,22,51,50,54,55,7,6,6,7,7,51,55,54,54,51,22,22,21,20,7,7,38,35,34,6,7,7,23,22,22,51,3,135,6,83,26,56,26,130,82,5,1,18,27,15,26,4,2,9,13,73,38,115,10,32,32,12,81,130,26,56,26,83,6,4,38,59,27,98,24,30,87,23,49,33,29,32,9,1,11,12,63,83,48,93,82,15,23,10,20,4,2,7,12,66,33,27,70,11,4,38,27,1,5,80,93,48,83,63,12,11,1,9,32,29,33,49,23,78,143,27,59,38,32,34,12,50,45,218,187,40,28,2,1,4,46,1,2,1,45,3,14,30,29,179,218,45,50,12,34,4,42,42,155,39,17,145,39,40,14,7,7,17,24,40,10,65,80,155,194,32,22,2,4,44,1,2,7,2,45,6,25,29,195,155,80,65,10,40,24,17,7,7,14,40,39,129,227,42,42,0,0,1,0,74,255,244,1,217,2,131,0,49,0,68,64,65,30,1,2,3,42,18,2,1,2,8,7,6,3,0,1,2,1,5,0,4,74,0,2,0,1,0,2,1,101,0,3,3,4,95,0,4,4,56,75,0,0,0,5,95,6,1,5,5,62,5,76,0,0,0,49,0,48,41,37,18,20,42,7,9,25,43,22,39,39,54,53,52,39,55,23,6,22,51,50,53,52,38,39,7,39,55,23,54,54,53,52,38,35,34,6,7,7,54,53,52,39,55,54,51,50,22,21,20,7,22,22,21,20,6,6,35,165,87,4,3,2,35,16,4,62,68,131,58,59,85,5,8,107,31,35,61,56,53,48,6,51,7,1,4,85,66,97,101,108,68,72,66,117,72,12,18,6,72,31,17,48,7,2,72,70,123,54,65,13,4,5,57,3,16,65,42,55,60,61,76,5,49,77,31,14,6,17,75,71,109,52,17,79,57,55,89,51,0,0,0,0,1,0,58,255,244,2,184,2,134,0,84,0,66,64,63,64,41,2,4,5,57,55,15,13,4,1,4,2,74,22,0,2,1,1,73,71,48,2,5,72,6,1,4,4,5,95,7,1,5,5,56,75,8,2,2,1,1,0,95,3,1,0,0,59,0,76,43,53,45,53,41,53,40,17,82,9,9,29,43,37,7,38,38,35,34,6,35,55,62,2,53,19,6,7,22,22,51,50,54,55,23,7,38,38,35,34,6,7,55,54,54,55,19,52,38,35,34,6,35,39,55,22,22,51,50,54,55,7,14,2,7,6,7,54,55,38,38,35,34,6,35,39,55,22,22,51,50,54,55,7,6,6,7,6,2,21,20,22,51,50,54,55,2,184,9,13,72,38,33,69,13,9,33,31,12,1,162,160,1,19,24,15,26,4,2,9,8,49,28,44,107,1,6,46,31,1,1,15,22,10,20,4,2,7,12,66,33,27,69,11,4,30,26,8,2,7,4,171,150,1,14,22,10,20,4,2,7,11,58,29,30,78,12,4,37,25,2,6,8,18,26,15,26,4,43,46,1,2,2,45,1,16,44,46,1,60,174,195,31,22,2,1,4,46,1,2,8,4,46,9,35,42,1,164,32,22,2,4,44,1,2,7,2,45,5,15,32,38,144,189,184,184,29,19,2,4,44,1,2,7,2,45,5,23,29,105,254,250,65,41,27,2,1,0,0,255,255,0,58,255,244,2,184,3,64,0,34,3,42,0,0,1,7,8,42,2,64,0,184,0,8,177,1,1,176,184,176,51,43,0,0,255,255,0,58,255,244,2,184,3,63,0,34,3,42,0,0,1,7,7,226,2,52,255,246,0,9,177,1,1,184,255,246,176,51,43,0,0,1,0,57,255,242,2,116,2,134,0,66,0,184,75,176,29,80,88,64,24,33,1,4,5,62,56,45,3,1,7,15,1,3,2,1,1,0,3,4,74,40,1,5,72,27,64,24,33,1,4,5,62,56,45,3,1,7,15,1,8,2,1,1,0,3,4,74,40,1,6,72,89,75,176,29,80,88,64,47,0,1,7,2,7,1,2,126,0,4,4,5,95,6,1,5,5,56,75,0,7,7,5,95,6,1,5,5,56,75,8,1,2,2,3,93,0,3,3,59,75,0,0,0,62,0,76,27,64,52,0,1,7,2,7,1,2,126,0,8,2,3,2,8,3,126,0,4,4,5,95,0,5,5,56,75,0,7,7,6,95,0,6,6,56,75,0,2,2,3,93,0,3,3,59,75,0,0,0,62,0,76,89,64,12,22,39,27,53,40,53,35,19,18,9,9,29,43,37,7,7,34,38,39,39,35,7,6,22,51,50,54,55,23,7,38,38,35,7,55,62,2,55,19,52,38,35,34,6,35,39,55,22,22,51,50,54,55,7,6,6,7,7,23,55,54,54,51,22,22,21,20,7,7,38,35,34,6,7,7,23,22,22,51,2,116,6,83,26,56,26,130,82,5,1,18,27,15,26,4,2,9,13,73,38,115,10,32,31,12,1,1,15,23,10,20,4,2,7,12,66,33,28,69,11,4,38,27,1,5,81,92,48,83,63,12,11,1,9,32,29,33,49,23,78,143,27,59,38,32,34,12,50,45,218,187,40,28,2,1,4,46,1,2,1,45,3,14,29,30,1,164,32,22,2,4,44,1,2,7,2,45,6,25,29,188,6,154,80,65,10,40,24,17,7,7,14,40,39,129,227,42,42,0,255,255,0,57,255,242,2,116,3,73,0,34,3,45,0,0,0,3,7,227,2,8,0,0,0,1,0,13,255,243,2,90,2,131,0,49,0,55,64,52,41,23,2,2,3,1,74,37,1,5,72,20,1,0,71,4,1,3,3,5,93,0,5,5,56,75,6,1,2,2,0,95,1,1,0,0,59,0,76,48,46,36,34,32,31,37,17,49,17,7,9,24,43,37,7,34,39,38,35,35,55,54,54,53,19,52,38,35,39,7,14,2,7,38,38,39,55,62,2,55,55,54,38,7,39,55,33,50,55,7,6,6,7,6,2,21,20,22,51,50,55,2,90,9,14,8,70,39,114,6,44,34,1,21,26,108,23,11,43,77,67,13,27,4,8,63,67,37,11,18,3,46,63,2,7,1,106,73,42,4,42,28,2,5,9,18,26,17,36,43,46,1,2,43,3,32,39,1,161,28,23,1,246,119,136,75,23,13,56,21,9,9,52,113,107,170,31,22,1,4,44,6,45,5,22,27,108,254,255,67,41,27,3,0,0,0,255,255,0,46,255,237,3,30,2,131,0,2,0,114,0,0,255,255,0,58,255,244,2,185,2,134,0,2,0,78,0,0,255,255,0,40,255,244,2,140,2,137,0,2,0,127,0,0,255,255,0,56,255,244,2,149,2,134,0,2,4,76,0,0,255,255,0,63,255,248,2,16,2,129,0,2,0,163,0,0,255,255,0,40,255,244,2,65,2,137,0,2,0,32,0,0,255,255,0,9,255,252,2,23,2,137,0,2,0,188,0,0,0,1,0,19,255,247,2,56,2,133,0,51,0,49,64,46,25,1,3,2,39,21,15,3,1,3,12,1,0,1,3,74,0,3,3,2,93,4,1,2,2,56,75,0,1,1,0,95,0,0,0,57,0,76,34,30,73,39,24,5,9,25,43,1,7,6,6,7,3,14,2,39,39,38,53,52,55,55,22,51,50,54,55,55,3,38,38,39,39,55,22,51,50,55,23,7,6,6,21,20,23,23,51,55,54,53,52,38,39,39,55,23,50,55,2,56,6,26,31,20,157,27,51,71,59,13,12,2,10,59,31,34,40,16,7,178,33,34,28,2,5,57,21,22,123,2,5,41,37,28,133,5,112,16,39,45,2,6,77,63,44,2,122,37,22,42,45,254,163,60,62,26,1,7,41,32,8,18,7,16,32,36,16,1,53,57,42,16,4,39,3,8,7,35,5,18,18,21,50,234,248,37,17,21,16,1,4,40,4,4,0,0,255,255,0,19,255,248,2,56,3,64,0,34,3,55,0,0,1,7,8,42,1,252,0,184,0,8,177,1,1,176,184,176,51,43,0,0,255,255,0,33,255,214,2,159,2,164,0,2,4,81,0,0,255,255,0,12,255,248,2,139,2,133,0,2,0,229,0,0,0,1,0,11,255,253,2,37,2,134,0,61,0,66,64,63,37,22,2,6,4,12,1,3,6,2,74,49,27,2,5,72,0,6,0,3,2,6,3,103,7,1,4,4,5,95,8,1,5,5,56,75,9,1,2,2,0,95,1,1,0,0,59,0,76,60,58,51,36,25,35,21,37,17,49,17,10,9,29,43,37,7,34,39,38,35,7,55,62,2,53,53,6,35,34,38,53,53,52,38,35,7,39,55,23,50,55,7,14,2,7,7,6,22,51,55,55,52,38,35,7,39,55,22,22,51,50,55,7,6,6,7,6,2,21,20,22,51,50,55,2,37,9,14,8,66,35,125,9,37,36,13,66,53,92,105,12,19,28,1,5,100,35,72,4,30,26,9,1,1,1,74,71,91,1,15,22,34,2,7,11,58,29,29,91,4,37,26,1,6,8,18,26,12,33,43,46,1,2,2,45,1,16,44,46,123,17,92,83,109,32,22,2,4,44,3,9,45,5,14,34,37,55,74,77,20,215,32,22,2,4,44,1,2,9,45,5,23,29,115,255,0,67,36,26,3,0,0,0,1,0,51,255,101,2,156,2,134,0,62,0,54,64,51,62,1,0,3,1,74,51,47,24,3,2,72,8,0,2,0,71,4,1,1,1,2,95,5,1,2,2,56,75,6,1,3,3,0,93,0,0,0,59,0,76,41,35,54,58,50,41,52,7,9,27,43,5,7,39,38,38,35,33,34,7,55,62,2,53,19,52,38,35,7,39,55,22,51,50,55,7,14,2,7,2,21,20,22,51,51,50,54,54,53,19,52,38,35,34,7,39,55,22,51,50,55,7,6,6,7,2,21,20,22,31,2,2,156,51,8,4,47,51,254,171,36,79,4,34,31,11,1,15,22,34,2,7,44,39,72,73,4,35,29,10,2,12,22,26,155,39,38,16,1,15,25,7,24,2,7,40,40,70,68,4,37,26,1,14,13,17,60,8,151,4,80,45,30,9,45,6,15,31,32,1,164,32,22,2,4,44,3,9,45,5,14,33,38,254,240,130,33,27,15,41,42,1,137,32,22,2,4,44,3,9,45,5,23,29,254,227,153,30,22,1,2,10,0,0,1,0,69,255,247,3,224,2,134,0,87,0,58,64,55,68,64,41,15,4,1,72,87,1,9,71,6,3,2,0,0,1,93,7,4,2,1,1,56,75,8,5,2,2,2,9,95,10,1,9,9,59,9,76,86,83,82,81,42,35,54,58,50,38,58,50,39,11,9,29,43,55,62,2,55,19,52,38,35,7,39,55,22,51,50,55,7,14,2,7,2,21,20,22,51,51,50,54,54,53,19,52,38,35,7,39,55,22,51,50,55,7,14,2,7,2,21,20,22,51,51,50,54,54,53,19,52,38,35,34,7,39,55,22,51,50,55,7,6,6,7,6,2,21,20,22,51,55,23,7,34,39,39,33,34,7,73,34,30,10,1,2,15,22,34,2,7,43,40,71,74,4,35,29,10,2,12,22,26,133,39,38,16,1,15,22,34,2,7,44,39,72,73,4,35,29,10,2,12,22,26,133,39,38,16,1,15,25,7,24,2,7,41,39,70,68,4,37,26,1,6,8,15,22,42,2,7,16,9,94,253,87,36,79,36,6,15,31,32,1,164,32,22,2,4,44,3,9,45,5,14,33,38,254,240,130,33,27,15,41,42,1,137,32,22,2,4,44,3,9,45,5,14,33,38,254,240,130,33,27,15,41,42,1,137,32,22,2,4,44,3,9,45,5,23,29,120,254,255,61,39,24,2,4,44,1,2,9,0,0,0,0,1,0,52,255,101,3,224,2,134,0,89,0,62,64,59,89,1,0,3,1,74,77,73,50,24,4,2,72,8,0,2,0,71,7,4,2,1,1,2,93,8,5,2,2,2,56,75,9,6,2,3,3,0,93,0,0,0,59,0,76,88,86,35,54,58,50,38,58,50,41,52,10,9,29,43,5,7,39,38,38,35,33,34,7,55,62,2,55,19,52,38,35,7,39,55,22,51,50,55,7,14,2,7,2,21,20,22,51,51,50,54,54,53,19,52,38,35,7,39,55,22,51,50,55,7,14,2,7,2,21,20,22,51,51,50,54,54,53,19,52,38,35,34,7,39,55,22,51,50,55,7,6,6,7,6,2,21,20,22,31,2,3,224,51,8,4,47,51,253,104,36,79,4,34,30,10,1,2,15,22,34,2,7,44,39,71,74,4,35,29,10,2,12,22,26,133,39,38,16,1,15,22,34,2,7,43,40,72,73,4,35,29,10,2,12,22,26,133,39,38,16,1,15,25,7,24,2,7,40,40,71,67,4,37,26,1,6,8,13,17,60,8,151,4,80,45,30,9,45,6,15,31,32,1,164,32,22,2,4,44,3,9,45,5,14,33,38,254,240,130,33,27,15,41,42,1,137,32,22,2,4,44,3,9,45,5,14,33,38,254,240,130,33,27,15,41,42,1,137,32,22,2,4,44,3,9,45,5,23,29,120,254,255,61,30,22,1,2,10,0,1,0,52,255,71,2,141,2,134,0,73,0,59,64,56,63,59,35,31,4,4,72,19,11,2,0,71,6,1,3,3,4,95,7,1,4,4,56,75,9,8,2,5,5,0,93,2,1,2,0,0,59,0,76,0,0,0,73,0,72,35,54,59,35,41,56,49,18,10,9,28,43,37,23,7,34,39,39,35,34,6,15,2,39,46,2,35,35,34,7,55,62,2,55,19,52,38,35,7,39,55,22,51,50,55,7,14,2,7,6,6,21,20,22,51,51,50,54,54,53,19,52,38,35,34,7,39,55,22,51,50,55,7,6,6,7,6,2,21,20,22,51,2,138,2,7,16,9,94,97,26,20,2,10,45,9,2,11,28,28,81,34,81,4,34,30,10,1,2,15,22,34,2,7,39,40,70,79,4,35,29,10,2,5,7,22,26,156,39,39,15,1,15,25,7,24,2,7,40,40,70,68,4,37,26,1,5,9,15,22,45,4,44,1,2,19,27,135,4,123,27,26,9,9,45,6,15,31,32,1,164,32,22,2,4,44,3,9,45,5,14,33,38,104,234,64,33,27,16,41,41,1,137,32,22,2,4,44,3,9,45,5,23,29,104,254,250,72,38,25,0,0,2,0,56,255,244,2,13,2,134,0,33,0,44,0,128,75,176,10,80,88,183,20,1,2,72,5,1,0,71,27,183,20,1,2,72,5,1,4,71,89,75,176,10,80,88,64,32,0,3,0,5,6,3,5,101,0,1,1,2,93,0,2,2,56,75,8,1,6,6,0,95,7,4,2,0,0,59,0,76,27,64,36,0,3,0,5,6,3,5,101,0,1,1,2,93,0,2,2,56,75,0,0,0,59,75,8,1,6,6,4,95,7,1,4,4,57,4,76,89,64,21,34,34,0,0,34,44,34,43,40,39,0,33,0,32,38,50,40,34,9,9,24,43,4,39,38,35,34,7,55,54,54,53,19,54,38,35,7,39,55,22,51,50,55,7,6,6,7,7,51,50,22,21,20,6,6,35,54,54,53,52,38,39,7,7,6,22,51,1,17,35,55,15,27,85,6,45,32,1,1,16,21,40,2,7,43,45,74,69,4,41,32,1,6,98,97,114,59,103,63,74,65,61,63,101,5,1,50,59,10,5,5,12,46,9,36,41,1,164,32,22,2,4,44,3,9,45,5,23,25,194,94,79,53,88,50,51,66,58,62,67,11,7,187,38,32,0,0,2,0,9,255,246,2,78,2,137,0,38,0,49,0,120,64,15,26,1,1,2,19,1,3,1,2,74,22,21,2,2,72,75,176,29,80,88,64,32,0,3,0,5,6,3,5,101,0,1,1,2,93,0,2,2,56,75,8,1,6,6,0,95,7,4,2,0,0,59,0,76,27,64,36,0,3,0,5,6,3,5,101,0,1,1,2,93,0,2,2,56,75,0,0,0,59,75,8,1,6,6,4,95,7,1,4,4,57,4,76,89,64,21,39,39,0,0,39,49,39,48,45,44,0,38,0,37,37,40,40,50,9,9,24,43,4,39,38,35,34,7,55,62,2,53,17,52,38,35,34,6,6,7,7,54,55,55,23,23,55,7,6,6,7,7,51,50,22,21,20,6,6,35,54,54,53,52,38,39,7,7,6,22,51,1,87,35,52,17,24,106,8,38,40,16,13,19,53,43,18,9,47,10,4,9,80,130,127,3,40,32,1,5,95,95,112,58,101,62,72,63,59,61,99,4,1,48,58,10,5,5,4,43,4,15,32,30,1,164,31,23,14,47,61,4,83,90,8,11,1,7,45,4,22,25,194,94,79,53,88,50,51,66,58,60,69,11,7,187,38,32,0,3,0,56,255,244,3,26,2,134,0,33,0,69,0,80,0,228,75,176,10,80,88,64,17,76,61,2,8,3,1,74,49,20,2,2,72,69,5,2,0,71,27,64,17,76,61,2,8,3,1,74,49,20,2,2,72,69,5,2,4,71,89,75,176,10,80,88,64,38,0,3,1,8,1,3,8,126,5,1,1,1,2,93,7,6,2,2,2,56,75,13,11,2,8,8,0,96,10,9,12,4,4,0,0,59,0,76,27,75,176,27,80,88,64,42,0,3,1,8,1,3,8,126,5,1,1,1,2,93,7,6,2,2,2,56,75,0,0,0,59,75,13,11,2,8,8,4,96,10,9,12,3,4,4,57,4,76,27,64,49,0,3,1,8,1,3,8,126,5,1,1,1,2,93,7,6,2,2,2,56,75,13,11,2,8,8,0,96,10,1,0,0,59,75,13,11,2,8,8,4,96,9,12,2,4,4,57,4,76,89,89,64,31,70,70,0,0,70,80,70,79,68,65,64,63,60,58,48,46,45,44,42,40,0,33,0,32,38,50,40,34,14,9,24,43,4,39,38,35,34,7,55,54,54,53,19,54,38,35,7,39,55,22,51,50,55,7,6,6,7,7,51,50,22,21,20,6,6,35,55,54,54,53,19,52,38,35,7,39,55,50,23,23,50,55,7,6,6,7,6,6,21,20,22,51,50,55,23,7,34,39,38,35,34,7,38,54,53,52,38,39,7,7,6,22,51,1,7,32,52,15,27,81,6,42,30,1,1,15,20,37,2,6,44,42,72,66,4,38,31,1,6,91,93,108,56,98,60,254,47,33,1,15,22,42,2,7,16,9,94,45,70,4,41,29,2,6,8,18,26,17,36,2,9,14,8,70,39,49,67,180,60,57,58,94,4,1,46,54,10,5,5,12,46,9,36,41,1,164,32,22,2,4,44,3,9,45,5,23,25,194,93,79,53,88,51,44,9,35,42,1,164,32,22,2,4,44,1,2,9,45,5,23,29,117,255,60,41,27,3,4,46,1,2,12,53,66,59,62,66,11,7,187,38,32,0,0,0,2,0,13,255,243,3,56,2,134,0,49,0,60,0,125,64,15,29,1,7,6,1,74,43,1,4,72,26,12,2,0,71,75,176,10,80,88,64,33,8,1,5,0,6,7,5,6,101,3,1,2,2,4,93,0,4,4,56,75,9,1,7,7,0,95,1,1,0,0,57,0,76,27,64,37,8,1,5,0,6,7,5,6,101,3,1,2,2,4,93,0,4,4,56,75,0,1,1,59,75,9,1,7,7,0,95,0,0,0,57,0,76,89,64,24,50,50,0,0,50,60,50,59,56,55,0,49,0,48,42,40,38,37,40,34,37,10,9,23,43,0,22,21,20,6,6,35,34,39,38,35,34,7,55,54,54,53,19,52,38,35,39,7,14,2,7,38,38,39,55,62,2,55,55,54,38,7,39,55,33,50,55,7,6,6,7,7,51,18,54,53,52,38,39,7,7,6,22,51,2,195,117,61,106,64,27,35,57,16,26,88,6,46,34,1,22,25,106,23,11,43,77,67,13,27,4,8,63,67,37,11,18,3,46,63,2,7,1,75,77,69,4,42,32,1,7,100,63,68,64,65,104,5,1,51,61,1,98,94,79,53,88,50,5,5,12,46,9,36,41,1,164,24,21,1,246,119,136,75,23,13,56,21,9,9,52,113,107,170,31,22,1,4,44,9,45,5,23,25,194,254,199,66,58,62,67,11,7,187,38,32,0,2,0,58,255,244,3,161,2,134,0,78,0,89,0,198,64,16,27,21,2,3,2,1,74,72,52,2,6,72,12,1,0,71,75,176,10,80,88,64,38,13,10,2,7,11,1,2,3,7,2,101,8,1,5,5,6,93,9,1,6,6,56,75,14,12,2,3,3,0,95,4,1,2,0,0,57,0,76,27,75,176,27,80,88,64,42,13,10,2,7,11,1,2,3,7,2,101,8,1,5,5,6,93,9,1,6,6,56,75,0,1,1,59,75,14,12,2,3,3,0,95,4,1,0,0,57,0,76,27,64,49,13,10,2,7,11,1,2,3,7,2,101,8,1,5,5,6,93,9,1,6,6,56,75,14,12,2,3,3,1,95,4,1,1,1,59,75,14,12,2,3,3,0,95,0,0,0,57,0,76,89,89,64,28,79,79,0,0,79,89,79,88,85,84,0,78,0,77,71,68,35,55,82,41,52,36,54,34,37,15,9,29,43,0,22,21,20,6,6,35,34,39,38,35,34,7,55,54,54,53,53,39,6,6,7,7,6,22,51,50,55,23,7,38,38,35,34,6,7,55,54,54,53,19,52,38,35,7,39,55,50,23,22,51,50,55,7,14,2,7,7,23,50,55,53,52,38,35,7,39,55,22,51,50,55,7,6,6,7,7,51,18,54,53,52,38,39,7,7,6,22,51,3,43,118,61,106,64,27,35,57,16,30,84,6,46,34,152,25,90,51,4,1,19,26,12,33,2,9,9,50,26,46,105,1,6,46,32,1,15,22,34,2,7,13,7,60,31,42,65,4,30,25,9,2,6,168,66,83,15,22,42,2,7,45,45,77,69,4,43,32,1,6,100,63,68,63,66,104,5,1,51,61,1,98,94,79,53,88,50,5,5,12,46,9,36,41,181,1,1,5,5,179,40,28,3,4,46,1,2,8,4,46,9,35,42,1,164,32,22,2,4,44,1,2,9,45,5,14,33,38,162,1,4,188,32,22,2,4,44,3,9,45,5,23,25,194,254,199,66,58,61,68,11,7,187,38,32,0,255,255,0,57,255,244,1,210,2,137,0,2,0,174,0,0,0,1,0,40,255,246,2,32,2,136,0,46,0,59,64,56,17,1,2,1,34,33,23,22,21,5,3,2,4,1,0,5,3,74,0,3,0,4,5,3,4,101,0,2,2,1,95,0,1,1,56,75,0,5,5,0,95,0,0,0,57,0,76,34,67,34,43,37,38,6,9,26,43,37,6,21,20,23,7,6,35,34,38,53,52,54,54,51,50,23,23,6,21,20,23,7,39,54,38,38,35,34,6,7,23,50,55,23,7,38,35,34,7,22,22,51,50,54,54,55,2,32,5,2,4,94,83,154,166,88,162,109,67,73,4,1,2,37,10,1,23,56,52,118,115,4,48,119,141,4,14,63,71,88,75,8,120,105,49,53,25,6,191,47,57,25,44,6,22,159,149,108,158,84,16,6,36,53,55,21,7,2,54,59,24,118,125,1,12,5,59,3,5,123,127,25,59,57,0,0,0,1,0,73,255,246,2,65,2,136,0,46,0,63,64,60,45,1,5,0,41,1,4,5,28,27,17,16,15,5,2,3,11,1,1,2,4,74,0,4,0,3,2,4,3,103,0,5,5,0,95,0,0,0,56,75,0,2,2,1,95,0,1,1,57,1,76,34,67,34,43,37,32,6,9,26,43,18,51,50,22,21,20,6,6,35,34,39,39,54,53,52,39,55,23,6,22,22,51,50,54,55,39,34,7,39,55,22,51,50,55,38,38,35,34,6,6,7,7,54,53,52,39,55,174,83,154,166,88,162,109,67,73,4,1,2,37,10,1,23,56,52,121,115,1,48,119,141,4,14,63,71,87,75,11,119,102,49,53,25,6,47,5,2,4,2,136,159,149,108,158,84,16,6,36,54,56,21,7,2,55,59,25,125,132,1,12,5,59,3,5,116,120,24,58,57,5,47,56,24,44,6,0,0,255,255,0,56,255,244,1,56,2,134,0,2,0,83,0,0,255,255,0,52,255,244,1,56,3,40,0,34,0,83,0,0,0,3,7,221,1,124,0,0,255,255,0,23,255,112,1,21,2,134,0,2,0,100,0,0,0,1,0,9,255,252,2,132,2,137,0,65,0,71,64,68,47,38,2,7,4,54,1,1,7,65,21,14,3,2,1,3,74,45,44,41,40,4,5,72,0,7,0,1,2,7,1,103,6,1,4,4,5,93,0,5,5,56,75,8,1,2,2,0,93,3,1,0,0,59,0,76,37,35,24,24,22,67,37,24,49,9,9,29,43,37,7,39,34,7,55,62,2,55,55,54,38,35,7,6,21,20,22,51,50,55,23,7,39,34,7,7,55,62,2,53,17,14,2,7,7,54,55,55,23,33,55,23,22,23,7,46,2,39,6,7,54,51,50,22,21,21,20,22,51,50,55,2,132,5,100,47,60,4,31,25,9,1,1,2,74,72,83,3,18,29,17,24,3,9,123,30,51,36,8,40,31,9,69,49,20,9,47,12,3,9,83,1,54,85,9,3,12,47,11,25,67,96,7,5,60,51,92,104,11,23,15,10,42,44,3,4,45,4,12,32,37,55,74,77,19,105,97,40,28,3,4,45,2,3,1,43,3,14,38,48,1,200,3,14,45,64,4,95,78,8,11,11,8,88,81,4,66,46,14,4,80,151,15,92,83,109,33,20,1,0,0,0,0,2,0,58,255,244,3,192,2,137,0,57,0,73,0,155,64,14,43,1,5,7,20,1,2,1,2,74,26,1,0,71,75,176,10,80,88,64,45,0,6,0,1,2,6,1,101,8,1,4,4,7,95,10,1,7,7,56,75,8,1,4,4,5,93,0,5,5,56,75,11,9,2,2,2,0,95,3,1,0,0,62,0,76,27,64,56,0,6,0,1,2,6,1,101,8,1,4,4,7,95,10,1,7,7,56,75,8,1,4,4,5,93,0,5,5,56,75,11,9,2,2,2,3,93,0,3,3,59,75,11,9,2,2,2,0,95,0,0,0,62,0,76,89,64,24,58,58,0,0,58,73,58,72,66,64,0,57,0,56,71,82,40,51,35,51,38,12,9,27,43,0,22,22,21,20,6,6,35,34,38,38,53,53,34,7,7,6,22,51,50,55,23,7,38,35,34,7,55,54,54,53,19,52,38,35,7,39,55,50,23,22,51,50,55,7,14,2,7,7,22,51,50,55,62,2,51,18,54,54,53,52,38,38,35,34,6,6,21,20,22,22,51,2,253,125,70,86,149,91,79,123,68,82,65,4,1,19,26,12,33,2,9,54,39,64,80,6,46,32,1,15,22,34,2,7,13,7,60,31,42,65,4,30,25,9,2,6,25,49,50,24,11,88,137,82,39,94,53,56,100,64,59,91,51,54,98,62,2,137,78,140,90,98,162,93,78,141,90,3,4,184,40,28,3,4,46,3,12,46,9,35,42,1,164,32,22,2,4,44,1,2,9,45,5,14,33,38,162,1,1,85,137,78,253,158,66,118,76,85,131,74,66,118,76,84,132,74,0,2,0,8,255,240,2,52,2,134,0,54,0,65,0,73,64,70,27,1,2,7,18,7,2,3,0,2,74,40,1,4,72,8,1,7,0,2,5,7,2,101,0,6,6,4,93,0,4,4,56,75,0,5,5,0,95,1,1,0,0,59,75,0,3,3,62,3,76,55,55,55,65,55,65,60,58,53,51,39,33,19,22,49,17,9,9,24,43,37,7,34,39,38,35,34,7,55,54,54,53,53,35,7,6,6,35,39,39,55,54,54,55,55,54,54,55,38,38,53,52,54,54,51,50,23,22,51,50,55,7,14,2,7,6,2,21,20,22,22,51,50,55,3,55,52,38,35,34,6,21,20,22,23,2,52,9,14,8,72,38,85,30,6,47,33,92,95,24,51,23,98,3,6,48,54,26,63,14,23,15,74,81,59,105,68,14,36,38,17,53,63,4,31,27,11,2,4,11,7,18,20,16,36,168,1,38,40,63,69,63,58,43,46,1,2,12,46,9,35,42,143,184,46,49,11,5,33,5,35,45,106,23,26,9,17,91,64,54,85,48,2,2,9,45,5,10,20,22,41,254,196,64,35,32,12,3,1,8,227,31,30,67,62,59,80,15,0,0,1,0,9,255,91,2,77,2,137,0,56,0,77,64,74,47,38,2,6,3,54,1,0,6,21,14,2,1,0,3,74,45,44,41,40,4,4,72,7,5,2,2,71,7,1,6,0,0,1,6,0,103,5,1,3,3,4,93,0,4,4,56,75,0,1,1,2,93,0,2,2,59,2,76,0,0,0,56,0,55,24,24,22,67,37,28,8,9,26,43,0,22,21,20,6,7,39,39,54,54,53,52,38,35,7,6,21,20,22,51,50,55,23,7,39,34,7,7,55,62,2,53,17,14,2,7,7,54,55,55,23,33,55,23,22,23,7,46,2,39,6,7,54,51,1,227,106,130,128,7,11,98,93,74,70,84,3,18,29,17,24,3,9,123,30,51,36,8,40,31,9,69,49,20,9,47,12,3,9,83,1,54,85,9,3,12,47,11,25,67,96,7,5,63,49,1,126,98,87,118,182,62,5,30,55,149,104,76,79,19,105,97,40,28,3,4,45,2,3,1,43,3,16,45,59,1,180,3,14,45,64,4,95,78,8,11,11,8,88,81,4,66,46,14,4,80,151,15,0,0,0,0,2,0,54,255,247,2,136,2,197,0,58,0,70,0,88,64,85,48,47,26,25,4,3,4,50,23,2,9,2,2,74,40,1,5,72,6,1,5,0,4,3,5,4,103,7,1,3,8,1,2,9,3,2,103,12,1,9,0,10,11,9,10,101,13,1,11,11,0,95,1,1,0,0,57,0,76,59,59,0,0,59,70,59,69,65,64,0,58,0,57,24,22,33,18,35,24,22,50,37,14,9,29,43,0,22,21,20,6,6,35,34,39,38,35,34,7,55,62,2,53,17,14,2,7,7,54,55,55,23,51,53,52,38,35,7,39,55,50,23,23,50,55,7,6,6,7,7,51,55,23,22,23,7,46,2,39,6,7,51,18,54,53,52,38,39,7,6,21,20,22,51,2,19,117,61,105,65,20,42,37,35,31,96,8,45,34,11,72,52,20,9,47,12,3,9,83,93,14,22,42,2,7,16,9,94,36,79,4,41,29,1,1,132,85,9,3,12,47,11,25,67,94,5,3,103,64,67,62,67,106,3,50,61,1,74,87,74,50,81,47,4,5,4,42,4,16,41,52,1,135,2,13,42,61,4,86,80,7,10,20,32,22,2,4,44,1,2,9,45,5,24,28,24,10,7,80,81,4,61,43,14,3,102,110,254,224,59,53,55,61,11,6,97,72,35,29,0,0,0,0,2,0,10,255,244,3,49,2,128,0,73,0,90,0,252,75,176,27,80,88,64,13,83,1,6,10,41,23,17,1,4,0,2,2,74,27,75,176,29,80,88,64,16,83,1,6,10,41,17,1,3,3,2,23,1,0,3,3,74,27,64,19,83,1,6,10,17,1,9,2,41,1,2,3,9,23,1,0,3,4,74,89,89,75,176,27,80,88,64,42,8,1,6,10,1,10,6,1,126,4,1,1,2,10,1,2,124,11,1,10,10,7,93,0,7,7,56,75,9,1,2,2,0,96,5,3,2,0,0,62,0,76,27,75,176,29,80,88,64,46,8,1,6,10,1,10,6,1,126,4,1,1,2,10,1,2,124,11,1,10,10,7,93,0,7,7,56,75,9,1,2,2,3,94,0,3,3,59,75,5,1,0,0,62,0,76,27,64,53,8,1,6,10,1,10,6,1,126,4,1,1,2,10,1,2,124,0,9,2,3,2,9,3,126,11,1,10,10,7,93,0,7,7,56,75,0,2,2,3,94,0,3,3,59,75,5,1,0,0,62,0,76,89,89,64,20,74,74,74,90,74,88,73,72,23,55,25,21,41,66,37,36,18,12,9,29,43,37,7,7,34,39,39,38,38,35,35,6,6,21,20,22,51,55,23,7,39,38,35,34,7,55,62,2,53,53,52,39,35,34,6,7,7,6,6,35,39,39,55,50,54,55,55,54,54,55,39,46,2,39,39,55,23,33,55,23,7,14,2,7,7,50,22,23,23,22,22,51,0,6,21,20,22,23,22,22,23,51,55,54,53,52,38,35,33,3,49,6,83,48,58,110,8,16,13,17,5,3,17,26,49,3,10,40,67,21,60,51,7,35,31,11,12,2,16,17,10,120,34,48,22,83,6,4,34,57,29,98,29,40,39,99,35,34,38,42,2,6,118,1,170,110,6,7,35,35,35,35,120,40,43,23,96,25,60,37,253,245,13,70,57,8,9,1,11,139,36,14,17,254,241,34,34,12,93,178,14,11,19,72,83,39,26,2,6,46,2,3,6,46,6,17,38,41,70,44,28,9,15,179,49,43,12,34,4,38,43,144,42,27,2,147,52,41,16,6,4,39,3,3,6,37,11,18,36,45,152,25,35,155,42,40,2,46,9,10,18,113,85,11,13,2,176,48,17,11,9,0,0,0,3,0,40,255,244,2,140,2,137,0,15,0,24,0,34,0,61,64,58,0,2,0,4,5,2,4,101,7,1,3,3,1,95,6,1,1,1,56,75,8,1,5,5,0,95,0,0,0,62,0,76,25,25,16,16,0,0,25,34,25,33,30,28,16,24,16,23,21,19,0,15,0,14,38,9,9,21,43,0,22,22,21,20,6,6,35,34,38,38,53,52,54,54,51,14,2,7,23,55,38,38,35,18,54,54,55,34,7,30,2,51,1,196,128,72,89,153,93,81,126,70,87,151,91,93,92,55,3,234,200,13,122,90,75,96,56,1,251,184,6,59,95,60,2,137,78,140,90,98,162,93,78,141,90,98,161,93,60,61,110,71,1,5,108,130,253,218,63,115,74,2,74,113,63,0,0,1,255,247,255,239,2,77,2,136,0,35,0,107,75,176,29,80,88,64,16,1,1,0,1,1,74,20,1,2,72,29,9,2,3,0,71,27,64,16,1,1,0,1,1,74,20,1,3,72,29,9,2,3,0,71,89,75,176,29,80,88,64,23,0,1,1,2,95,3,1,2,2,56,75,0,0,0,2,95,3,1,2,2,56,0,76,27,64,21,0,1,1,2,93,0,2,2,56,75,0,0,0,3,95,0,3,3,56,0,76,89,182,31,50,24,35,4,9,24,43,0,7,7,38,35,34,6,7,3,7,2,39,38,38,39,39,55,23,23,50,55,23,7,14,2,21,20,18,23,51,19,62,2,51,2,77,1,7,22,8,27,32,18,152,64,91,82,9,45,38,2,7,30,86,53,97,3,4,37,37,15,73,53,8,125,21,33,44,39,2,92,47,7,4,41,56,254,60,22,1,46,251,29,27,1,4,43,1,2,11,7,39,3,8,16,15,15,254,243,178,1,139,66,63,24,0,0,0,1,0,61,255,244,1,242,2,137,0,54,0,64,64,61,18,3,2,3,1,0,40,19,2,2,1,2,74,33,1,4,71,6,1,1,5,1,2,3,1,2,101,7,1,0,0,8,93,0,8,8,56,75,0,3,3,4,93,0,4,4,59,4,76,66,35,18,22,50,51,19,52,40,9,9,29,43,1,6,7,7,54,53,52,38,38,35,34,6,6,7,7,51,50,54,55,23,15,2,20,22,51,55,55,23,7,39,39,34,7,55,54,54,53,53,7,39,55,23,53,52,38,35,7,39,55,22,51,50,54,55,1,242,17,6,48,2,15,47,59,39,30,8,1,7,11,37,87,13,13,5,157,6,18,26,51,20,2,9,62,77,47,77,6,46,32,75,9,7,78,15,22,34,2,7,102,37,113,121,42,2,131,92,108,4,32,37,39,31,9,4,15,20,215,4,1,14,39,1,172,41,27,2,1,4,47,2,2,12,46,9,35,42,164,1,9,42,1,207,32,22,2,4,44,3,5,7,0,1,0,58,255,101,2,19,2,137,0,59,0,76,64,73,46,45,2,6,3,57,1,0,6,20,14,2,1,0,3,74,43,42,2,4,72,26,7,5,3,2,71,7,1,6,0,0,1,6,0,103,5,1,3,3,4,93,0,4,4,56,75,0,1,1,2,93,0,2,2,59,2,76,0,0,0,59,0,58,42,66,40,51,36,28,8,9,26,43,0,22,21,20,6,7,39,39,54,54,53,52,38,35,7,7,20,22,51,50,55,23,7,39,39,34,7,55,54,54,53,19,52,38,35,7,39,55,22,51,50,54,55,23,6,7,7,54,53,52,38,38,35,34,6,6,21,7,54,51,1,169,106,127,131,7,11,100,91,74,70,82,7,19,31,9,36,2,9,52,67,47,77,6,46,32,1,15,22,34,2,7,102,37,125,127,42,3,16,6,48,2,19,49,54,41,37,18,6,61,49,1,126,98,87,115,174,63,5,30,56,141,101,76,79,18,203,41,28,4,4,47,2,2,12,46,9,35,42,1,164,32,22,2,4,44,3,5,7,6,80,96,4,40,10,35,30,9,4,17,18,181,15,0,0,0,0,1,0,31,255,101,3,157,2,134,0,99,0,221,75,176,29,80,88,64,31,65,1,9,7,94,88,47,46,4,8,6,40,1,1,8,99,33,15,3,3,2,4,74,72,1,7,72,0,1,0,71,27,64,31,65,1,9,10,94,88,47,46,4,8,6,40,1,1,8,99,33,15,3,3,2,4,74,72,1,7,72,0,1,0,71,89,75,176,29,80,88,64,53,11,1,8,4,1,1,2,8,1,101,0,9,9,7,95,12,10,2,7,7,56,75,13,1,6,6,7,95,12,10,2,7,7,56,75,14,1,2,2,3,93,0,3,3,59,75,5,1,0,0,62,0,76,27,64,57,0,14,1,2,1,14,2,126,11,1,8,4,1,1,14,8,1,101,0,9,9,10,95,0,10,10,56,75,13,1,6,6,7,95,12,1,7,7,56,75,0,2,2,3,93,0,3,3,59,75,5,1,0,0,62,0,76,89,64,24,98,97,91,89,82,81,78,77,70,67,62,60,19,23,44,19,22,53,35,19,18,15,9,29,43,5,7,39,34,38,39,39,35,7,6,22,51,50,54,55,23,7,38,38,35,7,55,62,2,53,53,35,7,6,6,35,39,39,55,50,54,55,55,54,55,39,38,38,35,34,7,39,38,53,52,54,55,50,22,23,23,51,53,52,38,35,34,6,35,39,55,22,22,51,50,54,55,7,6,6,7,7,51,55,54,54,51,22,22,21,20,7,7,38,35,34,6,7,7,23,22,22,23,23,3,157,48,22,39,61,28,130,82,5,1,18,27,15,26,4,2,9,13,73,38,115,10,32,32,12,81,130,26,56,26,83,6,4,38,59,27,98,24,30,87,23,49,33,29,32,9,1,11,12,63,83,48,93,82,15,23,10,20,4,2,7,12,66,33,28,69,11,4,38,27,1,5,80,93,48,83,63,12,11,1,9,32,29,33,49,23,78,143,26,46,48,8,151,4,143,46,47,218,187,40,28,2,1,4,46,1,2,1,45,3,14,30,29,179,218,45,50,12,34,4,42,42,155,39,17,145,39,40,14,7,7,17,24,40,10,65,80,155,194,32,22,2,4,44,1,2,7,2,45,6,25,29,195,155,80,65,10,40,24,17,7,7,14,40,39,129,227,40,27,2,10,0,0,0,1,0,74,255,71,1,239,2,131,0,57,0,66,64,63,42,1,3,4,54,30,2,2,3,20,19,18,3,1,2,14,1,0,1,4,74,7,1,0,71,0,3,0,2,1,3,2,101,0,4,4,5,95,0,5,5,56,75,0,1,1,0,95,0,0,0,62,0,76,41,37,18,20,42,27,6,9,26,43,36,6,7,6,6,15,2,39,38,38,39,34,39,39,54,53,52,39,55,23,6,22,51,50,54,53,52,39,7,39,55,23,54,54,53,52,38,35,34,6,7,7,54,53,52,39,55,54,51,50,22,21,20,7,22,22,21,1,239,91,76,11,10,2,11,45,10,2,7,7,58,87,4,3,2,38,12,4,65,73,72,74,128,90,5,9,114,34,38,66,60,58,53,7,50,7,1,4,97,62,102,107,117,73,78,119,97,21,11,26,22,123,4,111,24,27,11,18,6,75,31,16,46,7,2,73,69,63,60,107,25,4,5,57,3,17,65,41,55,60,61,76,5,53,76,29,13,6,17,75,71,109,52,17,79,57,0,1,0,46,255,101,2,106,2,134,0,66,1,21,75,176,27,80,88,64,24,61,55,43,3,1,8,13,1,2,1,66,1,4,2,3,74,38,1,6,72,0,1,0,71,27,75,176,29,80,88,64,24,61,55,43,3,1,8,13,1,2,1,66,1,3,2,3,74,38,1,6,72,0,1,0,71,27,64,24,61,55,43,3,1,8,13,1,2,9,66,1,3,2,3,74,38,1,7,72,0,1,0,71,89,89,75,176,27,80,88,64,48,0,1,8,2,8,1,2,126,0,5,5,6,95,7,1,6,6,56,75,0,8,8,6,95,7,1,6,6,56,75,9,1,2,2,4,93,0,4,4,59,75,3,1,0,0,62,0,76,27,75,176,29,80,88,64,48,0,1,8,2,8,1,2,126,0,5,5,6,95,7,1,6,6,56,75,0,8,8,6,95,7,1,6,6,56,75,9,1,2,2,3,95,4,1,3,3,59,75,0,0,0,62,0,76,27,64,52,0,1,8,9,8,1,9,126,0,9,2,8,9,2,124,0,5,5,6,93,0,6,6,56,75,0,8,8,7,95,0,7,7,56,75,0,2,2,3,95,4,1,3,3,59,75,0,0,0,62,0,76,89,89,64,14,65,64,39,27,82,40,49,19,35,19,18,10,9,29,43,5,7,39,34,38,39,39,35,7,6,22,51,50,55,23,7,34,39,38,35,7,55,62,2,53,19,52,38,35,7,39,55,50,23,22,51,50,55,7,6,6,7,7,23,55,62,2,51,22,22,21,20,7,7,38,35,34,6,7,7,23,22,22,23,23,2,106,48,22,39,61,28,130,82,5,1,18,27,12,33,2,9,13,8,66,37,115,10,33,31,12,1,15,23,34,2,7,13,7,60,31,43,65,4,38,27,1,5,81,92,34,57,62,41,11,12,1,9,36,25,30,50,25,78,143,26,46,48,8,151,4,143,46,47,218,187,40,28,3,4,46,1,2,1,45,3,14,29,30,1,164,32,22,2,4,44,1,2,9,45,6,25,29,188,6,154,56,63,26,9,40,26,15,8,7,14,38,41,129,227,40,27,2,10,0,0,1,0,57,255,242,2,162,2,134,0,76,0,216,75,176,29,80,88,64,35,38,1,5,6,66,54,53,52,4,7,10,72,1,1,7,10,9,8,3,3,1,20,1,4,3,1,1,0,4,6,74,45,1,6,72,27,64,35,38,1,5,6,66,54,53,52,4,7,10,72,1,1,7,10,9,8,3,3,1,20,1,11,3,1,1,0,4,6,74,45,1,9,72,89,75,176,29,80,88,64,49,8,1,7,2,1,1,3,7,1,101,0,5,5,6,95,9,1,6,6,56,75,0,10,10,6,95,9,1,6,6,56,75,11,1,3,3,4,93,0,4,4,59,75,0,0,0,62,0,76,27,64,54,0,11,3,4,3,11,4,126,8,1,7,2,1,1,3,7,1,101,0,5,5,6,95,0,6,6,56,75,0,10,10,9,95,0,9,9,56,75,0,3,3,4,93,0,4,4,59,75,0,0,0,62,0,76,89,64,18,76,75,69,67,60,59,20,23,53,40,53,35,20,19,18,12,9,29,43,37,7,7,34,38,39,39,35,7,7,39,55,35,7,6,22,51,50,54,55,23,7,38,38,35,7,55,62,2,55,19,52,38,35,34,6,35,39,55,22,22,51,50,54,55,7,6,6,7,7,23,39,55,23,7,23,55,54,54,51,22,22,21,20,7,7,38,35,34,6,7,7,23,22,22,51,2,162,6,83,26,56,26,130,27,1,44,7,3,52,5,1,18,27,15,26,4,2,9,13,73,38,115,10,32,31,12,1,1,15,23,10,20,4,2,7,12,66,33,28,69,11,4,38,27,1,5,50,1,45,8,3,28,92,48,83,63,12,11,1,9,32,29,33,49,23,78,143,27,59,38,32,34,12,50,45,218,130,8,4,134,187,40,28,2,1,4,46,1,2,1,45,3,14,29,30,1,164,32,22,2,4,44,1,2,7,2,45,6,25,29,188,2,129,8,4,136,1,154,80,65,10,40,24,17,7,7,14,40,39,129,227,42,42,0,1,0,9,255,242,2,174,2,137,0,66,0,182,75,176,29,80,88,64,22,62,56,45,34,4,1,7,15,1,3,2,1,1,0,3,3,74,37,36,2,5,72,27,64,22,62,56,45,34,4,1,7,15,1,8,2,1,1,0,3,3,74,37,36,2,5,72,89,75,176,29,80,88,64,47,0,1,7,2,7,1,2,126,0,4,4,5,95,6,1,5,5,56,75,0,7,7,5,95,6,1,5,5,56,75,8,1,2,2,3,93,0,3,3,59,75,0,0,0,62,0,76,27,64,54,0,1,7,2,7,1,2,126,0,8,2,3,2,8,3,126,0,4,4,5,95,6,1,5,5,56,75,0,7,7,5,95,6,1,5,5,56,75,0,2,2,3,93,0,3,3,59,75,0,0,0,62,0,76,89,64,12,22,39,25,40,40,53,35,19,18,9,9,29,43,37,7,7,34,38,39,39,35,7,6,22,51,50,54,55,23,7,38,38,35,7,55,62,2,55,19,52,38,7,14,2,7,7,54,55,55,23,23,55,7,6,6,7,7,23,55,54,54,51,22,22,21,20,7,7,38,35,34,6,7,7,23,22,22,51,2,174,6,83,26,56,26,130,82,5,1,18,27,15,26,4,2,9,13,73,38,115,10,32,31,12,1,1,15,22,46,37,18,8,47,12,3,9,83,117,131,4,42,33,1,5,81,92,48,83,63,12,11,1,9,32,29,33,49,23,78,143,27,59,38,32,34,12,50,45,218,187,40,28,2,1,4,46,1,2,1,45,3,14,29,30,1,164,32,23,1,2,15,46,59,4,95,78,8,11,1,7,45,4,22,25,195,6,154,80,65,10,40,24,17,7,7,14,40,39,129,227,42,42,0,0,0,0,1,0,47,255,101,2,182,2,134,0,82,0,169,75,176,27,80,88,64,25,63,57,2,7,5,23,17,2,1,2,82,1,0,1,3,74,70,48,2,6,72,0,1,0,71,27,64,28,63,57,2,7,5,17,1,10,2,23,1,1,10,82,1,0,1,4,74,70,48,2,6,72,0,1,0,71,89,75,176,27,80,88,64,34,0,7,0,2,1,7,2,101,8,1,5,5,6,95,9,1,6,6,56,75,10,3,2,1,1,0,95,4,1,0,0,59,0,76,27,64,41,0,10,2,1,2,10,1,126,0,7,0,2,10,7,2,101,8,1,5,5,6,95,9,1,6,6,56,75,3,1,1,1,0,95,4,1,0,0,59,0,76,89,64,16,81,79,69,66,36,39,82,41,52,36,52,17,52,11,9,29,43,5,7,39,38,38,39,34,7,55,62,2,53,53,39,6,6,7,7,20,22,51,50,55,23,7,38,38,35,34,6,7,55,54,54,53,19,52,38,35,7,39,55,50,23,22,51,50,55,7,14,2,7,7,23,50,55,55,52,38,35,34,7,39,55,22,22,51,50,55,7,6,6,7,6,2,21,20,22,31,2,2,182,51,8,4,44,46,40,62,9,33,31,12,152,25,90,51,4,18,26,12,33,2,9,9,50,26,46,105,1,6,46,32,1,15,22,34,2,7,13,7,60,31,42,65,4,30,25,9,2,6,168,63,85,1,15,22,14,20,2,7,11,58,29,48,72,4,37,26,1,6,8,13,17,60,8,151,4,80,43,31,1,2,45,1,16,44,46,151,1,1,5,5,179,41,27,3,4,46,1,2,8,4,46,9,35,42,1,164,32,22,2,4,44,1,2,9,45,5,14,33,38,162,1,10,182,32,22,2,4,44,1,2,9,45,5,23,29,113,254,253,66,30,22,1,2,10,0,0,0,1,0,58,255,244,3,119,2,137,0,86,0,74,64,71,74,3,2,3,8,0,40,34,2,1,3,2,74,65,1,7,72,25,1,2,71,0,8,0,3,1,8,3,101,9,6,2,0,0,7,93,10,1,7,7,56,75,4,1,1,1,2,95,5,1,2,2,59,2,76,85,81,79,77,39,82,41,52,36,54,50,54,40,11,9,29,43,1,6,7,7,54,53,52,38,38,35,34,6,6,7,3,20,22,51,55,55,23,7,39,39,34,7,55,54,54,53,53,39,6,6,7,7,20,22,51,50,55,23,7,38,38,35,34,6,7,55,54,54,53,19,52,38,35,7,39,55,50,23,22,51,50,55,7,14,2,7,7,23,50,55,53,52,38,35,7,39,55,22,51,50,54,55,3,119,17,6,48,2,15,47,59,39,30,8,1,14,18,26,51,20,2,9,62,77,53,71,6,46,32,151,25,90,51,4,18,26,12,33,2,9,9,50,26,46,105,1,6,46,32,1,15,22,34,2,7,13,7,60,31,42,65,4,30,25,9,2,6,168,63,85,15,22,34,2,7,102,37,113,121,42,2,131,92,108,4,38,31,39,31,9,4,15,20,254,76,41,27,2,1,4,47,2,2,12,46,9,35,42,181,1,1,5,5,179,41,27,3,4,46,1,2,8,4,46,9,35,42,1,164,32,22,2,4,44,1,2,9,45,5,14,33,38,162,1,9,183,32,22,2,4,44,3,5,7,0,0,0,1,0,48,255,101,2,150,2,134,0,65,0,144,75,176,29,80,88,64,19,26,1,1,2,65,1,0,1,2,74,51,1,7,72,34,0,2,0,71,27,64,19,26,1,1,9,65,1,0,1,2,74,51,1,7,72,34,0,2,0,71,89,75,176,29,80,88,64,27,6,1,2,2,7,95,8,1,7,7,56,75,9,3,2,1,1,0,93,5,4,2,0,0,59,0,76,27,64,40,0,6,7,2,2,6,112,0,9,2,1,2,9,1,126,0,2,2,7,96,8,1,7,7,56,75,3,1,1,1,0,93,5,4,2,0,0,59,0,76,89,64,14,64,63,49,18,40,49,19,39,53,17,36,10,9,29,43,5,7,39,38,38,35,35,55,54,54,53,19,52,38,35,35,34,6,7,6,6,21,20,22,51,50,55,23,7,34,39,38,35,34,7,55,54,54,53,19,52,38,35,7,39,55,50,23,23,33,50,55,7,6,6,7,6,2,21,20,23,22,22,31,2,2,150,51,8,4,47,51,93,6,44,34,1,23,24,145,44,37,1,6,8,18,26,17,36,2,9,14,8,70,39,49,67,6,47,33,1,15,22,42,2,7,16,9,94,1,102,36,79,4,41,29,2,6,8,3,2,13,12,60,8,151,4,80,45,30,43,3,32,39,1,161,30,21,19,28,114,251,61,41,27,3,4,46,1,2,12,46,9,35,42,1,164,32,22,2,4,44,1,2,9,45,5,23,29,110,254,254,64,22,15,12,9,1,2,10,0,0,0,1,0,51,255,71,2,76,2,137,0,49,0,42,64,39,28,1,1,0,33,1,2,1,2,74,12,1,2,71,0,2,1,2,132,0,1,1,0,95,0,0,0,56,1,76,47,45,39,37,24,22,3,9,20,43,37,6,6,7,7,14,2,7,6,15,2,39,38,38,39,38,38,53,52,54,54,51,50,22,22,23,23,14,2,7,7,54,54,53,52,35,34,6,6,21,20,22,22,51,50,54,55,2,76,3,20,4,6,5,39,67,40,11,3,11,45,10,2,8,7,118,138,90,159,100,37,77,53,7,4,2,9,11,3,48,1,2,147,66,100,54,57,104,68,68,83,19,200,15,103,45,9,2,15,16,4,17,32,123,4,111,24,28,12,14,163,130,100,161,91,11,11,2,6,6,46,74,41,4,5,27,17,93,64,117,79,87,132,73,77,81,255,255,255,237,255,244,2,46,2,133,0,2,0,230,0,0,255,255,255,237,255,244,2,46,2,133,0,34,0,230,0,0,1,7,7,220,1,244,255,194,0,9,177,1,1,184,255,194,176,51,43,0,0,1,0,27,255,101,2,154,2,133,0,77,0,61,64,58,75,70,57,50,32,13,6,1,4,1,74,63,59,42,3,4,72,77,76,26,22,6,5,6,0,71,2,1,1,4,0,4,1,0,126,5,1,4,4,56,75,3,1,0,0,59,0,76,62,60,61,35,27,19,34,6,9,25,43,5,38,38,35,34,7,39,55,54,54,53,52,39,39,7,6,6,21,20,22,23,23,7,38,35,34,7,39,55,54,54,55,55,39,38,38,39,39,55,23,23,50,55,23,7,6,6,21,20,22,23,55,54,54,53,52,38,39,39,55,22,51,50,55,23,7,14,2,7,7,23,22,22,23,23,21,7,2,95,4,38,45,33,107,3,4,42,36,20,109,92,32,19,28,30,2,7,72,38,43,56,4,7,37,69,56,110,131,25,66,46,2,6,32,112,74,61,3,3,42,36,50,63,34,52,47,25,35,2,6,72,38,43,54,4,6,28,37,39,32,121,146,28,57,45,9,51,75,41,34,8,7,39,2,16,17,15,29,164,122,43,32,14,13,15,2,4,43,7,4,7,41,11,58,69,136,196,37,40,6,4,39,1,2,8,7,35,3,17,16,10,84,96,46,72,66,3,18,16,3,4,39,7,4,7,37,6,18,39,41,153,213,39,33,4,11,191,4,0,0,0,0,1,0,23,255,101,2,57,2,134,0,61,0,123,64,24,37,22,2,5,3,12,1,2,5,61,1,0,1,3,74,49,27,2,4,72,0,1,0,71,75,176,27,80,88,64,32,0,5,0,2,1,5,2,103,6,1,3,3,4,95,7,1,4,4,56,75,8,1,1,1,0,93,0,0,0,59,0,76,27,64,39,0,8,2,1,2,8,1,126,0,5,0,2,8,5,2,103,6,1,3,3,4,95,7,1,4,4,56,75,0,1,1,0,93,0,0,0,59,0,76,89,64,12,42,51,36,25,35,21,37,17,36,9,9,29,43,5,7,39,38,38,39,7,55,62,2,53,53,6,35,34,38,53,53,52,38,35,7,39,55,23,50,55,7,14,2,7,7,6,22,51,55,55,52,38,35,7,39,55,22,22,51,50,55,7,6,6,7,6,2,21,20,22,31,2,2,57,51,8,4,44,45,113,9,37,36,13,66,53,92,105,12,19,28,1,5,100,35,72,4,30,26,9,1,1,1,74,71,91,1,15,22,34,2,7,11,58,29,29,91,4,37,26,1,6,8,13,17,60,8,151,4,80,43,31,1,2,45,1,16,44,46,123,17,92,83,109,32,22,2,4,44,3,9,45,5,14,34,37,55,74,77,20,215,32,22,2,4,44,1,2,9,45,5,23,29,115,255,0,67,30,22,1,2,10,0,0,0,1,0,11,255,253,2,58,2,134,0,72,0,77,64,74,48,46,44,43,42,40,26,12,8,3,5,17,16,15,3,2,3,2,74,60,31,2,6,72,4,1,3,5,2,5,3,2,126,7,1,5,5,6,95,8,1,6,6,56,75,9,1,2,2,0,95,1,1,0,0,59,0,76,71,69,59,56,53,51,35,21,20,21,17,49,17,10,9,27,43,37,7,34,39,38,35,7,55,62,2,53,53,6,15,2,39,55,38,38,53,53,52,38,35,7,39,55,23,50,55,7,14,2,7,7,6,22,23,53,39,55,23,7,21,51,55,55,52,38,35,7,39,55,22,22,51,50,55,7,6,6,7,6,2,21,20,22,51,50,55,2,58,9,14,8,66,35,125,9,37,36,13,51,52,1,44,7,2,86,98,12,19,28,1,5,100,35,72,4,30,26,9,1,1,1,53,52,1,45,8,3,1,102,1,15,22,34,2,7,11,58,29,29,91,4,37,26,1,6,8,18,26,12,33,43,46,1,2,2,45,1,16,44,46,124,14,3,90,8,4,94,6,91,77,109,32,22,2,4,44,3,9,45,5,14,34,37,55,61,74,11,8,160,8,4,152,25,21,214,32,22,2,4,44,1,2,9,45,5,23,29,115,255,0,67,36,26,3,0,0,0,0,1,0,56,255,244,2,74,2,134,0,63,0,68,64,65,52,1,1,7,63,24,16,14,4,2,1,2,74,46,1,5,72,30,1,0,71,0,7,0,1,2,7,1,103,0,4,4,5,95,6,1,5,5,56,75,8,1,2,2,0,93,3,1,0,0,59,0,76,37,40,33,18,40,51,40,24,49,9,9,29,43,37,7,39,34,7,55,62,2,55,55,54,38,35,7,20,7,6,6,21,20,22,51,50,55,23,7,38,35,34,7,55,54,54,53,19,52,38,35,7,39,55,50,23,23,50,55,7,6,6,7,6,7,54,51,50,22,21,21,20,22,51,50,55,2,74,5,100,21,86,4,31,26,8,1,1,2,74,72,84,1,1,2,18,30,17,24,2,9,51,72,49,67,6,47,33,1,15,22,42,2,7,16,9,94,36,79,4,41,29,2,5,3,60,51,92,104,11,23,15,10,42,44,3,4,45,4,13,32,36,55,74,77,19,21,10,45,89,37,40,28,3,4,46,3,12,46,9,35,42,1,164,32,22,2,4,44,1,2,9,45,5,23,29,99,78,15,92,83,109,33,20,1,0,0,255,255,0,56,255,244,1,56,2,134,0,2,0,83,0,0,255,255,0,10,255,242,3,135,3,64,0,34,3,40,0,0,1,7,8,42,2,144,0,184,0,8,177,1,1,176,184,176,51,43,0,0,0,1,0,23,255,101,2,49,2,134,0,66,0,158,75,176,29,80,88,64,25,58,41,26,3,5,3,16,1,2,5,10,1,0,1,3,74,54,31,2,4,72,9,1,0,71,27,64,25,58,41,26,3,5,3,16,1,2,5,10,1,0,8,3,74,54,31,2,4,72,9,1,0,71,89,75,176,29,80,88,64,32,0,5,0,2,1,5,2,103,6,1,3,3,4,95,7,1,4,4,56,75,8,1,1,1,0,93,0,0,0,59,0,76,27,64,39,0,1,2,8,2,1,8,126,0,5,0,2,1,5,2,103,6,1,3,3,4,95,7,1,4,4,56,75,0,8,8,0,93,0,0,0,59,0,76,89,64,12,43,51,36,25,35,21,36,39,49,9,9,29,43,37,7,38,35,34,6,6,15,2,63,2,54,54,55,53,6,35,34,38,53,53,52,38,35,7,39,55,23,50,55,7,14,2,7,7,6,22,51,55,53,52,38,35,7,39,55,22,22,51,50,55,55,7,6,6,7,6,2,21,20,22,51,50,55,2,49,9,87,56,30,30,14,4,8,51,2,8,60,29,27,1,66,54,92,104,12,19,28,1,5,100,33,74,4,30,26,9,1,1,1,74,71,92,15,22,34,2,7,11,58,29,21,65,34,4,37,26,1,6,8,18,26,12,33,43,46,3,12,31,32,76,4,196,10,2,1,24,28,167,17,92,83,109,32,22,2,4,44,3,9,45,5,14,34,37,55,74,77,20,215,32,22,2,4,44,1,2,6,3,45,5,23,29,77,254,254,103,37,25,3,255,255,255,241,255,246,2,82,3,64,0,34,0,3,0,0,1,7,8,42,1,235,0,184,0,8,177,2,1,176,184,176,51,43,0,0,255,255,255,241,255,246,2,82,3,40,0,34,0,3,0,0,0,3,7,221,1,235,0,0,255,255,255,246,255,246,3,16,2,137,0,2,0,29,0,0,255,255,0,58,255,246,2,20,3,74,0,34,0,47,0,0,1,7,8,42,2,13,0,194,0,8,177,1,1,176,194,176,51,43,0,0,255,255,0,21,255,244,2,120,2,135,0,2,0,187,0,0,255,255,0,10,255,242,3,135,3,40,0,34,3,40,0,0,0,3,7,221,2,144,0,0,255,255,0,74,255,244,1,217,3,40,0,34,3,41,0,0,0,3,7,221,1,213,0,0,255,255,0,58,255,244,2,184,3,10,0,34,3,42,0,0,0,3,7,237,2,63,0,0,255,255,0,58,255,244,2,184,3,40,0,34,3,42,0,0,0,3,7,221,2,64,0,0,255,255,0,40,255,244,2,140,3,40,0,34,0,127,0,0,0,3,7,221,2,33,0,0,255,255,0,40,255,244,2,140,2,137,0,2,3,81,0,0,255,255,0,19,255,248,2,56,3,10,0,34,3,55,0,0,0,3,7,237,1,251,0,0,255,255,0,19,255,248,2,56,3,40,0,34,3,55,0,0,0,3,7,221,1,252,0,0,255,255,0,19,255,248,2,56,3,59,0,34,3,55,0,0,1,7,7,228,1,251,255,246,0,9,177,1,2,184,255,246,176,51,43,0,255,255,0,11,255,253,2,37,3,40,0,34,3,59,0,0,0,3,7,221,1,234,0,0,0,1,0,47,255,101,1,228,2,137,0,44,0,57,64,54,26,25,2,4,1,42,1,0,4,2,74,22,1,2,72,44,43,6,3,0,71,0,4,1,0,1,4,0,126,3,1,1,1,2,93,0,2,2,56,75,0,0,0,59,0,76,38,42,66,40,35,5,9,25,43,5,46,2,35,34,7,55,54,54,53,19,52,38,35,7,39,55,22,51,50,54,55,23,6,7,7,54,53,52,38,38,35,34,6,6,7,3,20,22,31,3,7,1,32,4,19,45,45,35,93,6,46,32,1,15,22,34,2,7,102,37,113,121,42,3,17,6,48,2,15,47,59,39,30,8,1,14,20,24,92,10,1,51,69,29,29,11,12,46,9,35,42,1,164,32,22,2,4,44,3,5,7,6,92,108,4,18,51,39,31,9,4,15,20,254,76,29,26,1,2,10,195,4,0,0,255,255,0,56,255,244,3,26,3,39,0,34,3,66,0,0,1,7,7,221,2,109,255,255,0,9,177,3,2,184,255,255,176,51,43,0,255,255,0,40,255,40,3,36,2,137,0,2,0,165,0,0,255,255,255,249,255,239,3,163,2,136,0,2,0,224,0,0,255,255,0,58,255,244,1,244,2,137,0,2,0,70,0,0,255,255,0,74,255,71,1,239,2,131,0,2,3,86,0,0,255,255,0,40,255,23,2,65,2,137,0,34,0,32,0,0,0,3,7,216,2,16,0,0,255,255,0,39,255,244,1,201,1,208,0,2,0,254,254,0,0,2,0,59,255,244,1,228,2,230,0,27,0,41,0,54,64,51,24,1,3,2,1,74,17,1,1,72,0,2,2,1,95,4,1,1,1,63,75,5,1,3,3,0,95,0,0,0,62,0,76,28,28,0,0,28,41,28,40,35,33,0,27,0,27,38,6,9,21,43,0,22,22,21,20,6,6,35,34,38,53,52,54,55,54,54,55,23,23,7,7,14,2,23,23,54,55,18,54,53,52,38,38,35,34,6,21,20,22,22,51,1,84,93,51,58,103,64,97,103,147,160,33,24,13,28,2,42,10,117,115,46,2,6,51,85,57,65,36,65,41,56,66,36,64,42,1,208,57,102,66,72,114,65,156,149,171,193,38,8,15,24,12,4,100,9,16,43,81,76,3,51,15,254,85,91,80,59,92,51,93,80,58,91,51,0,0,0,0,3,0,42,255,248,1,179,1,199,0,37,0,49,0,60,0,68,64,65,14,1,0,1,49,25,2,6,0,2,74,2,1,2,71,0,6,0,5,0,6,5,126,4,1,0,0,1,93,0,1,1,58,75,0,5,5,2,95,7,3,2,2,2,59,2,76,0,0,60,59,54,52,45,44,0,37,0,36,43,85,25,8,9,23,43,50,6,7,55,54,54,53,19,52,38,35,34,6,35,39,55,23,50,54,51,50,22,21,20,6,7,22,22,21,20,6,6,35,34,38,39,38,35,55,20,54,54,53,52,38,35,34,6,21,7,7,20,22,51,50,54,53,52,38,39,7,112,61,9,5,36,25,1,12,17,8,16,3,2,6,91,28,61,11,76,81,46,43,56,63,51,87,51,16,25,10,38,20,124,39,31,64,67,8,6,8,5,40,46,46,51,51,49,80,7,1,43,6,24,28,1,25,22,15,2,4,40,1,3,56,52,36,56,17,11,56,40,38,64,36,2,1,4,247,2,19,38,30,41,40,6,9,145,168,25,21,43,38,34,44,8,1,0,0,1,0,44,255,248,1,147,1,204,0,40,0,100,64,16,28,8,2,2,0,1,74,15,14,2,1,72,40,1,5,71,75,176,12,80,88,64,29,0,2,0,4,0,2,112,3,1,0,0,1,93,0,1,1,58,75,0,4,4,5,93,0,5,5,59,5,76,27,64,30,0,2,0,4,0,2,4,126,3,1,0,0,1,93,0,1,1,58,75,0,4,4,5,93,0,5,5,59,5,76,89,64,9,50,54,37,20,51,22,6,9,26,43,55,54,54,53,19,52,38,35,7,39,55,22,51,50,55,23,6,7,7,54,53,52,38,38,35,34,6,6,7,3,20,22,51,50,55,23,7,38,35,34,7,49,34,24,1,11,17,24,3,5,58,57,171,55,4,11,6,46,2,12,41,51,28,20,6,1,10,13,19,5,48,3,7,73,35,43,59,33,6,25,29,1,24,23,15,2,5,40,2,8,6,53,99,3,26,28,26,20,7,3,10,13,254,219,26,18,3,5,44,3,8,0,0,0,255,255,0,44,255,248,1,147,2,203,0,34,3,128,0,0,0,3,7,194,1,144,0,0,0,1,0,44,255,248,1,135,2,44,0,39,0,49,64,46,30,1,0,4,9,3,2,3,1,0,2,74,21,1,2,71,3,1,0,0,4,93,0,4,4,58,75,0,1,1,2,93,0,2,2,59,2,76,51,24,50,54,36,5,9,25,43,1,6,7,7,38,35,34,6,6,7,3,20,22,51,50,55,23,7,38,35,34,7,55,54,54,53,19,52,38,35,7,39,55,22,51,50,54,54,55,55,1,135,10,2,3,87,66,20,15,4,1,10,13,19,5,48,3,7,51,57,49,53,5,34,24,1,11,17,24,3,5,132,54,40,33,15,6,7,2,40,85,65,6,10,3,10,13,254,219,26,18,3,5,44,3,8,41,6,25,29,1,24,22,16,2,5,40,2,8,26,33,37,0,0,2,255,253,255,120,1,201,1,200,0,42,0,56,0,57,64,54,31,25,2,5,3,42,14,2,1,4,2,74,30,1,3,72,2,1,0,4,0,81,0,5,5,3,93,0,3,3,58,75,6,1,4,4,1,93,0,1,1,59,1,76,52,36,27,47,19,51,17,7,9,27,43,4,23,7,39,38,38,35,35,34,6,15,2,54,53,55,54,54,55,55,54,53,52,38,38,39,39,55,33,50,55,7,6,6,7,6,6,21,20,22,31,2,3,52,38,35,35,7,6,6,7,23,51,50,54,53,1,193,8,46,15,5,35,41,177,40,33,6,15,47,8,7,55,65,13,9,2,14,35,36,2,7,1,15,68,27,3,32,21,2,5,6,11,14,44,6,141,17,20,65,13,7,43,39,1,134,42,27,61,72,3,83,30,23,22,31,80,3,88,84,7,16,111,98,71,20,5,18,18,8,3,4,37,4,43,3,14,20,62,166,64,22,16,1,2,7,1,76,20,16,139,76,104,36,5,25,38,0,0,0,255,255,0,39,255,244,1,153,1,208,0,2,1,41,3,0,255,255,0,39,255,244,1,153,2,202,0,34,1,41,3,0,0,3,7,193,1,202,0,0,255,255,0,39,255,244,1,153,2,127,0,34,1,41,3,0,0,3,7,186,1,201,0,0,0,1,0,22,255,246,2,218,1,201,0,96,0,106,64,103,93,87,47,3,9,7,41,1,1,9,1,1,0,6,3,74,69,1,8,72,15,1,6,2,0,2,6,0,126,12,1,9,4,1,1,2,9,1,101,0,10,10,8,95,13,11,2,8,8,58,75,14,1,7,7,8,95,13,11,2,8,8,58,75,0,2,2,0,95,5,3,2,0,0,57,0,76,96,95,90,88,81,80,77,76,68,65,63,61,58,57,23,39,34,19,22,84,36,19,18,16,9,29,43,37,7,7,34,38,39,39,35,6,21,20,22,51,50,54,51,23,7,34,38,35,34,6,7,55,54,54,53,53,35,7,6,6,35,39,39,55,50,55,55,54,55,39,38,38,35,34,7,39,38,53,52,54,55,50,22,23,23,51,53,52,38,35,7,39,55,23,50,54,55,7,14,2,7,6,7,51,55,54,54,51,22,22,21,20,7,7,38,35,34,6,7,7,23,22,51,2,218,5,71,22,44,19,87,72,3,15,20,10,18,3,2,7,7,42,22,33,85,1,5,35,23,71,87,19,44,22,71,5,4,59,35,60,22,30,53,17,32,22,22,36,8,1,8,12,52,61,33,63,72,11,17,25,2,5,87,21,60,9,3,22,19,7,1,1,4,70,63,33,61,52,12,8,1,8,36,22,22,32,17,43,101,37,58,28,30,8,34,32,151,69,49,28,20,2,3,42,2,5,2,42,6,24,30,112,151,32,34,8,30,4,59,99,36,14,86,28,26,15,7,11,19,16,24,13,42,56,107,123,23,15,1,4,39,1,4,1,42,3,10,21,24,33,74,107,56,42,13,24,16,19,11,7,15,26,28,71,163,60,0,0,1,0,62,255,248,1,131,1,200,0,49,0,74,64,71,30,1,3,4,42,1,2,3,6,1,1,0,2,1,6,1,4,74,0,0,2,1,2,0,1,126,0,3,0,2,0,3,2,101,0,4,4,5,95,0,5,5,58,75,0,1,1,6,95,7,1,6,6,64,6,76,0,0,0,49,0,48,41,37,18,20,34,23,8,9,26,43,22,39,39,54,53,52,39,55,51,6,22,51,50,54,53,52,39,7,39,55,23,54,54,53,52,38,35,34,6,7,7,54,53,52,39,55,54,51,50,22,21,20,7,22,22,21,20,6,6,35,135,68,4,1,2,26,19,1,45,52,52,54,91,77,2,7,91,23,26,49,45,40,34,5,45,4,1,4,64,58,79,83,83,54,57,53,94,61,8,12,6,29,37,34,19,6,50,46,40,39,71,18,3,5,46,1,11,42,26,36,40,40,50,4,31,50,28,13,6,13,55,52,72,38,11,57,41,40,63,35,0,0,0,1,0,44,255,249,2,28,1,201,0,73,0,55,64,52,50,48,12,10,4,1,4,1,74,60,41,2,5,72,6,1,4,4,5,93,7,1,5,5,58,75,8,2,2,1,1,0,93,3,1,0,0,59,0,76,42,50,44,50,40,84,39,17,65,9,9,29,43,37,7,34,38,35,7,55,54,54,53,55,6,7,22,22,51,50,54,51,23,7,34,38,35,34,6,7,55,54,54,53,19,52,38,35,7,39,55,23,50,54,55,7,14,2,15,2,54,55,38,38,35,7,39,55,23,50,54,55,7,6,6,7,7,6,21,20,22,51,50,54,55,2,28,7,10,57,32,92,7,34,23,1,135,98,1,16,17,10,18,3,2,7,7,42,22,33,85,1,5,35,23,1,11,17,25,2,5,87,21,60,9,3,22,19,7,1,1,8,117,116,1,13,16,24,2,5,81,23,64,10,3,29,18,1,2,8,14,19,11,18,3,40,42,2,1,41,1,28,43,205,136,110,17,13,2,3,42,2,5,2,42,6,24,30,1,22,23,15,1,4,39,1,4,1,42,3,10,21,24,29,190,114,130,17,12,1,4,39,1,4,1,42,4,15,20,47,172,68,28,20,2,1,255,255,0,44,255,249,2,28,2,143,0,34,3,137,0,0,0,3,8,41,1,230,0,0,255,255,0,44,255,249,2,28,2,202,0,34,3,137,0,0,0,3,7,193,1,238,0,0,0,1,0,44,255,246,1,241,1,201,0,65,0,162,75,176,27,80,88,64,16,62,56,45,3,1,7,0,1,0,2,2,74,38,1,5,72,27,64,16,62,56,45,3,1,7,0,1,0,8,2,74,38,1,5,72,89,75,176,27,80,88,64,43,0,1,7,2,7,1,2,126,0,4,4,5,95,6,1,5,5,58,75,0,7,7,5,95,6,1,5,5,58,75,8,1,2,2,0,95,3,1,0,0,57,0,76,27,64,50,0,1,7,2,7,1,2,126,0,8,2,0,2,8,0,126,0,4,4,5,95,6,1,5,5,58,75,0,7,7,5,95,6,1,5,5,58,75,0,2,2,0,95,3,1,0,0,57,0,76,89,64,12,21,39,28,50,40,84,36,19,18,9,9,29,43,37,7,7,34,38,39,39,35,6,21,20,22,51,50,54,51,23,7,34,38,35,34,6,7,55,54,54,53,19,52,38,35,7,39,55,23,50,54,55,7,14,2,7,6,7,23,55,54,54,51,22,22,21,20,7,7,38,35,34,6,7,7,23,22,51,1,241,5,71,21,45,19,90,70,3,15,20,10,18,3,2,7,7,42,22,33,85,1,5,35,23,1,11,17,25,2,5,87,21,60,9,3,22,19,7,1,1,4,70,63,33,61,52,12,8,1,8,36,22,22,32,17,43,103,38,56,27,29,8,34,32,151,69,49,28,20,2,3,42,2,5,2,42,6,24,30,1,22,23,15,1,4,39,1,4,1,42,3,10,21,24,31,70,6,107,56,42,13,24,16,19,11,7,15,26,28,71,163,60,0,255,255,0,44,255,246,1,241,2,203,0,34,3,140,0,0,0,3,7,194,1,175,0,0,0,1,0,5,255,241,1,200,1,200,0,43,0,48,64,45,36,19,2,4,1,1,74,32,1,3,72,17,1,0,71,2,1,1,1,3,93,0,3,3,58,75,0,4,4,0,93,0,0,0,59,0,76,41,34,30,39,33,5,9,25,43,37,7,39,35,55,54,54,53,19,52,38,35,35,7,14,2,7,38,39,55,54,54,55,55,54,38,35,39,55,33,50,55,7,6,6,7,6,21,20,22,51,50,55,1,200,7,105,93,5,34,25,1,17,21,64,13,11,36,61,48,31,9,9,62,66,11,7,3,34,49,2,6,1,16,45,49,3,32,22,1,10,13,20,19,20,40,42,2,40,3,22,27,1,20,20,16,118,96,119,69,17,30,51,7,10,104,106,67,29,22,4,37,4,41,3,15,19,125,164,29,19,2,0,1,0,38,255,244,2,119,1,200,0,60,0,60,64,57,37,1,2,3,57,46,28,3,0,2,2,74,60,52,12,8,4,1,71,0,2,2,3,93,5,4,2,3,3,58,75,8,6,2,0,0,1,96,7,1,1,1,59,1,76,18,51,40,17,37,66,24,35,36,9,9,29,43,19,35,3,6,22,51,55,23,7,38,35,34,7,55,54,54,55,19,54,38,35,39,55,22,51,50,55,22,23,51,54,55,50,22,55,55,23,7,6,6,23,19,22,22,51,50,55,23,7,38,35,34,7,55,54,54,39,3,35,3,7,171,7,27,2,12,14,41,3,8,36,54,23,46,4,25,24,3,32,2,32,36,2,7,62,26,27,34,70,51,6,55,71,5,45,14,79,2,4,34,26,2,20,3,16,18,10,12,2,7,40,34,30,70,5,30,26,2,24,6,141,27,1,90,254,239,18,14,1,4,41,3,6,43,2,24,27,1,26,20,20,4,39,3,2,200,126,133,192,3,1,5,3,39,4,18,20,254,247,40,26,2,4,41,2,6,43,2,21,23,1,7,254,159,5,0,0,0,0,1,0,44,255,249,2,25,1,201,0,77,0,64,64,61,23,1,2,0,1,74,34,14,2,1,72,0,2,0,8,5,2,8,101,3,1,0,0,1,93,4,1,1,1,58,75,9,7,2,5,5,6,93,10,1,6,6,59,6,76,76,71,67,65,67,17,68,42,50,36,39,50,38,11,9,29,43,55,54,54,53,19,52,38,35,7,39,55,23,50,54,55,7,14,2,7,7,23,50,55,55,52,38,35,7,39,55,23,50,54,55,7,6,6,7,6,6,21,20,22,51,50,54,55,23,7,34,38,35,7,55,54,54,53,53,39,6,6,7,7,6,22,51,50,54,51,23,7,34,38,35,34,6,7,49,35,23,1,11,17,25,2,5,86,21,60,9,3,22,18,7,1,5,119,44,62,1,11,17,26,2,5,81,23,64,10,3,28,18,2,5,5,13,19,12,18,3,2,7,10,57,31,92,7,34,22,106,29,76,16,2,1,13,19,12,18,3,2,7,7,42,23,32,84,1,35,6,24,29,1,24,22,16,1,4,38,1,4,1,41,3,10,21,24,106,1,6,117,22,16,1,4,38,1,4,1,41,4,15,20,65,167,58,26,20,2,1,4,42,2,1,41,1,28,43,95,1,1,5,1,112,28,20,2,3,42,2,5,2,0,0,255,255,0,40,255,244,1,210,1,208,0,2,1,123,4,0,0,1,0,44,255,249,2,11,1,201,0,54,0,57,64,54,15,1,0,1,48,25,18,3,2,0,2,74,14,1,1,72,54,1,3,71,4,1,0,0,1,93,0,1,1,58,75,5,1,2,2,3,93,6,1,3,3,59,3,76,51,38,55,35,41,50,38,7,9,27,43,55,54,54,53,19,52,38,35,7,39,55,23,33,50,55,7,6,6,7,6,21,20,22,51,50,55,23,7,39,35,55,54,54,53,19,52,38,35,35,34,6,7,6,21,20,22,51,50,55,23,7,38,35,34,7,49,35,24,1,12,16,30,3,6,95,1,22,29,63,3,31,21,1,10,13,19,19,16,3,4,104,91,5,32,25,1,18,19,105,32,27,1,11,13,20,22,16,2,7,58,45,35,58,35,6,24,29,1,22,22,16,1,4,40,1,5,43,4,15,20,127,159,29,19,2,3,42,2,40,3,22,27,1,20,21,15,14,20,194,87,28,20,2,3,42,2,7,0,0,255,255,0,36,255,19,1,232,1,209,0,2,1,159,252,0,255,255,0,40,255,244,1,135,1,208,0,2,1,27,4,0,0,1,0,20,255,252,1,169,1,204,0,38,0,57,64,54,32,1,5,1,1,74,17,16,13,12,4,2,72,3,1,1,0,5,0,1,5,126,4,1,0,0,2,93,0,2,2,58,75,0,5,5,6,93,0,6,6,59,6,76,67,37,19,20,20,19,21,7,9,27,43,55,62,2,53,17,14,2,7,7,54,55,55,23,51,55,23,22,23,7,46,2,39,6,6,21,20,22,51,50,55,23,7,39,39,34,7,111,37,29,10,56,44,17,7,43,9,2,6,67,236,68,6,2,9,43,8,16,41,53,4,7,19,23,26,16,2,7,26,90,45,66,37,3,11,30,37,1,38,1,11,35,46,3,66,71,7,8,8,7,42,92,3,47,35,12,2,42,193,88,26,22,2,3,43,1,2,4,0,0,255,255,255,251,255,15,1,201,1,203,0,2,1,226,4,0,255,255,255,251,255,15,1,201,2,143,0,34,1,226,4,0,0,3,8,41,1,163,0,0,0,3,0,36,255,19,2,61,2,230,0,41,0,49,0,57,0,82,64,79,27,1,4,3,21,1,5,4,52,44,2,6,5,41,1,2,6,4,74,31,30,2,3,72,9,1,1,71,0,3,4,3,131,0,5,4,6,4,5,6,126,0,6,2,4,6,2,124,0,4,4,58,75,0,2,2,57,75,0,0,0,1,96,0,1,1,60,1,76,23,27,25,24,23,34,19,7,9,27,43,5,6,22,22,55,23,7,35,34,7,55,62,2,55,55,38,38,53,52,54,55,53,52,38,35,34,7,55,54,55,23,6,6,7,22,22,21,20,6,6,7,38,22,23,55,17,6,6,21,36,38,39,21,3,54,54,53,1,75,1,11,33,39,2,8,63,76,84,5,33,29,11,1,1,107,121,124,105,17,21,6,18,4,70,77,6,6,11,4,108,126,60,109,72,220,79,73,1,75,78,1,127,83,75,4,78,84,111,39,31,10,2,3,38,7,39,4,16,39,42,85,5,119,99,99,134,15,174,24,21,2,37,9,20,13,9,143,114,5,118,99,67,107,67,9,164,99,14,52,1,58,4,88,80,55,100,13,10,254,155,4,89,80,0,255,255,0,20,255,250,1,221,1,200,0,2,1,225,12,0,0,1,0,13,255,254,1,178,1,201,0,61,0,68,64,65,50,1,3,4,36,1,5,3,11,1,2,5,3,74,26,1,4,72,0,5,0,2,1,5,2,103,6,1,3,3,4,93,8,7,2,4,4,58,75,9,1,1,1,0,94,0,0,0,59,0,76,60,58,17,34,36,25,34,37,37,17,65,10,9,29,43,37,7,34,38,35,7,55,62,2,53,53,6,35,34,38,53,53,52,38,35,7,39,55,23,50,55,7,14,2,7,7,6,22,23,55,55,52,38,35,7,39,55,23,50,55,50,54,51,7,6,6,7,7,6,21,20,22,51,50,55,1,178,7,4,50,45,101,7,28,27,10,56,50,61,73,10,13,22,1,4,79,31,60,3,23,19,6,1,1,1,51,46,69,1,11,17,26,2,5,82,34,42,10,9,2,3,29,19,1,4,6,15,20,13,18,40,42,2,1,41,1,11,30,30,70,22,67,60,92,21,15,1,4,35,1,5,38,3,10,21,24,57,48,51,1,22,147,23,15,1,4,39,1,4,1,42,4,15,20,112,134,43,26,20,3,0,0,1,0,47,255,120,2,10,1,201,0,62,0,63,64,60,62,1,1,4,9,1,0,1,2,74,45,1,2,1,73,51,24,2,3,72,0,0,4,0,81,5,1,2,2,3,95,6,1,3,3,58,75,7,1,4,4,1,93,0,1,1,59,1,76,26,51,37,59,50,40,51,17,8,9,28,43,4,23,7,39,38,38,35,35,34,7,55,54,54,53,17,52,38,35,7,39,55,22,51,50,55,7,14,2,7,6,6,21,20,22,51,51,50,54,53,19,52,38,35,34,7,39,55,22,51,50,55,7,6,6,7,6,21,20,22,31,2,2,2,8,43,16,6,33,37,247,15,78,3,36,20,12,21,18,2,5,48,20,57,55,4,24,19,7,2,4,5,15,21,102,40,25,1,12,20,11,8,3,6,46,20,57,52,4,28,17,2,10,9,13,42,7,35,98,3,83,30,23,6,42,6,21,32,1,22,23,15,1,4,39,2,6,42,3,9,20,26,54,161,57,24,17,24,38,1,12,23,14,1,4,39,2,6,42,4,15,20,135,157,23,15,1,2,7,0,0,0,0,1,0,46,255,250,3,1,1,201,0,88,0,65,64,62,62,9,2,2,0,81,1,9,2,2,74,68,42,15,3,1,72,88,1,9,71,6,3,2,0,0,1,95,7,4,2,1,1,58,75,8,5,2,2,2,9,93,0,9,9,59,9,76,87,83,43,51,37,58,50,22,60,51,38,10,9,29,43,55,54,54,53,19,52,38,35,34,7,39,55,22,51,50,55,7,14,2,7,7,6,6,21,20,22,51,51,50,54,53,19,52,38,38,7,39,55,22,51,50,55,7,14,2,7,6,21,20,22,51,51,50,54,53,19,52,38,35,34,7,39,55,22,51,50,55,7,6,6,7,6,7,6,21,20,22,51,50,55,23,7,38,35,33,34,7,49,36,21,1,12,20,13,8,2,5,46,21,57,60,3,25,21,8,1,2,1,7,17,21,94,41,27,1,7,22,24,2,5,46,21,57,60,4,25,21,8,1,9,17,20,94,41,28,1,12,21,12,8,2,5,44,21,58,55,4,28,19,1,1,4,6,12,18,16,14,2,5,50,46,253,241,16,78,36,6,21,31,1,23,22,16,1,4,39,2,6,42,3,9,21,25,38,40,160,34,23,18,24,38,1,11,18,16,4,1,4,39,2,6,42,3,9,21,25,202,70,23,18,24,38,1,12,22,15,1,4,39,2,6,42,4,15,20,34,72,144,38,29,18,1,4,40,2,6,0,0,1,0,46,255,120,3,21,1,201,0,91,0,72,64,69,72,19,2,4,2,91,1,1,4,9,1,0,1,3,74,78,52,25,3,3,72,0,0,4,0,81,8,5,2,2,2,3,95,9,6,2,3,3,58,75,10,7,2,4,4,1,93,0,1,1,59,1,76,90,89,77,74,37,58,50,22,60,51,40,51,17,11,9,29,43,4,23,7,39,38,38,35,33,34,7,55,54,54,53,19,52,38,35,34,7,39,55,22,51,50,55,7,14,2,7,7,6,6,21,20,22,51,51,50,54,53,19,52,38,38,7,39,55,22,51,50,55,7,14,2,7,6,21,20,22,51,51,50,54,53,19,52,38,35,34,7,39,55,22,51,50,55,7,6,6,7,6,7,6,21,20,22,31,2,3,13,8,46,15,6,35,39,254,4,16,78,3,36,21,1,12,20,13,8,2,5,46,21,57,60,3,25,21,8,1,2,1,7,17,21,94,41,27,1,7,22,24,2,5,46,21,57,60,4,25,21,8,1,9,17,20,94,41,28,1,12,21,12,8,2,5,44,21,58,55,4,28,19,1,1,4,6,11,14,44,6,45,88,3,83,31,22,6,42,6,21,31,1,23,22,16,1,4,39,2,6,42,3,9,21,25,38,40,160,34,23,18,24,38,1,11,18,16,4,1,4,39,2,6,42,3,9,21,25,202,70,23,18,24,38,1,12,22,15,1,4,39,2,6,42,4,15,20,36,69,146,38,23,18,1,2,7,0,0,0,0,1,0,47,255,100,1,249,1,201,0,69,0,62,64,59,69,1,0,4,1,74,52,1,2,1,73,58,31,2,3,72,16,9,8,7,4,0,71,5,1,2,2,3,95,6,1,3,3,58,75,7,1,4,4,0,95,1,1,0,0,59,0,76,41,51,37,59,50,40,55,65,8,9,28,43,37,7,38,35,35,34,6,15,2,39,38,38,35,35,34,7,55,54,54,53,17,52,38,35,7,39,55,22,51,50,55,7,14,2,7,6,6,21,20,22,51,51,50,54,53,19,52,38,35,34,7,39,55,22,51,50,55,7,6,6,7,6,21,20,22,51,50,55,1,249,5,50,46,58,22,16,2,8,39,7,2,21,34,55,15,78,3,36,20,12,21,18,2,5,48,20,57,55,4,24,19,7,2,4,5,15,21,102,40,25,1,12,20,11,8,3,6,46,20,57,52,4,28,17,2,10,12,18,16,14,38,40,2,16,22,115,3,104,33,19,6,42,6,21,32,1,22,23,15,1,4,39,2,6,42,3,9,20,26,54,161,57,24,17,24,38,1,12,23,14,1,4,39,2,6,42,4,15,20,135,153,29,18,1,0,2,0,44,255,248,1,165,1,201,0,34,0,45,0,64,64,61,21,1,2,72,6,1,0,71,0,3,0,5,6,3,5,101,0,1,1,2,95,0,2,2,58,75,8,1,6,6,0,95,7,4,2,0,0,59,0,76,35,35,0,0,35,45,35,44,41,40,0,34,0,33,38,50,40,35,9,9,24,43,22,38,39,38,35,34,7,55,54,54,53,19,52,38,35,7,39,55,22,51,50,55,7,6,6,7,7,51,50,22,21,20,6,6,35,54,54,53,52,38,39,7,7,6,22,51,226,25,9,36,20,27,65,5,34,25,1,11,17,30,2,5,46,23,63,57,3,31,24,1,5,75,77,90,47,81,50,52,47,45,47,73,3,1,36,43,7,2,1,4,8,42,6,25,27,1,25,22,16,1,4,39,2,6,42,4,16,19,110,67,58,42,67,39,46,48,43,41,44,6,4,132,25,21,0,2,0,19,255,249,1,222,1,204,0,38,0,49,0,75,64,72,21,1,1,3,1,74,22,1,3,72,0,2,1,4,1,2,4,126,0,4,0,6,7,4,6,101,0,1,1,3,93,0,3,3,58,75,9,1,7,7,0,95,8,5,2,0,0,59,0,76,39,39,0,0,39,49,39,48,45,44,0,38,0,37,37,36,19,39,51,10,9,25,43,4,38,39,38,35,34,7,55,54,54,53,19,52,38,35,34,6,6,7,7,54,55,55,23,51,55,7,6,6,7,7,51,50,22,21,20,6,6,35,54,54,53,52,38,39,7,7,6,22,51,1,34,24,9,34,21,44,63,6,43,29,1,10,14,36,32,14,6,43,9,2,6,65,103,103,4,31,24,1,4,75,74,86,45,78,48,48,44,41,45,72,2,1,36,41,7,2,1,4,4,41,4,22,30,1,28,20,13,11,36,43,3,69,67,7,8,4,41,3,16,19,111,67,58,42,68,38,46,48,43,41,43,7,4,132,25,21,255,255,0,45,255,248,2,102,1,201,0,34,3,217,0,0,0,3,1,241,1,129,0,0,0,2,0,5,255,241,2,117,1,198,0,47,0,58,0,71,64,68,29,1,8,7,1,74,27,13,2,0,71,9,1,6,0,7,8,6,7,101,5,3,2,2,2,4,93,0,4,4,58,75,10,1,8,8,0,95,1,1,0,0,59,0,76,48,48,0,0,48,58,48,57,54,53,0,47,0,46,17,34,30,40,35,37,11,9,26,43,0,22,21,20,6,6,35,34,38,39,38,35,34,7,55,54,54,53,19,52,38,35,35,7,14,2,7,38,39,55,54,54,55,55,54,38,35,39,55,33,55,7,6,6,7,7,51,22,54,53,52,38,39,7,7,6,22,51,2,27,90,47,81,50,17,25,9,36,20,27,65,5,34,25,1,17,21,65,13,11,36,61,48,31,9,9,62,66,11,7,3,34,49,2,6,1,7,104,3,31,24,1,5,75,41,47,45,47,73,3,1,36,43,1,10,67,58,42,67,39,2,1,4,8,42,6,25,27,1,20,20,16,118,96,119,69,17,30,51,7,10,104,106,67,29,22,4,37,2,42,2,15,19,110,227,48,43,41,44,6,4,132,25,21,0,0,2,0,44,255,248,2,204,1,201,0,73,0,84,0,140,64,15,27,1,3,2,1,74,67,48,2,6,72,13,1,0,71,75,176,29,80,88,64,38,13,10,2,7,11,1,2,3,7,2,101,8,1,5,5,6,93,9,1,6,6,58,75,14,12,2,3,3,0,95,4,1,2,0,0,59,0,76,27,64,43,0,11,2,7,11,85,13,10,2,7,0,2,3,7,2,101,8,1,5,5,6,93,9,1,6,6,58,75,14,12,2,3,3,0,95,4,1,2,0,0,59,0,76,89,64,28,74,74,0,0,74,84,74,83,80,79,0,73,0,72,66,63,35,39,34,40,67,35,54,35,37,15,9,29,43,0,22,21,20,6,6,35,34,38,39,38,35,34,7,55,54,54,53,53,39,34,7,7,6,22,51,50,55,23,7,38,35,34,6,7,55,54,54,53,19,52,38,35,7,39,55,23,50,55,7,14,2,7,7,23,55,53,52,38,35,7,39,55,22,51,50,55,7,6,6,7,7,51,22,54,53,52,38,39,7,7,6,22,51,2,115,89,46,82,50,17,25,9,36,20,31,61,5,34,25,106,21,100,2,1,13,19,17,16,2,7,42,30,26,90,1,5,35,23,1,11,17,25,2,5,86,28,62,3,22,18,7,1,5,119,107,11,17,30,2,5,50,23,63,53,3,32,23,1,5,75,41,47,44,48,73,3,1,36,43,1,7,65,57,41,68,39,2,1,4,8,42,6,25,27,119,1,7,116,28,20,2,3,42,2,5,2,42,6,24,29,1,24,22,16,1,4,38,1,5,41,3,9,22,24,102,1,4,114,22,16,1,4,39,2,6,42,4,16,19,113,224,48,43,40,42,6,3,130,25,21,0,255,255,0,49,255,244,1,98,1,208,0,2,1,170,0,0,0,1,0,41,255,249,1,137,1,204,0,45,0,75,64,72,40,1,0,5,44,1,6,0,11,1,1,6,24,17,2,3,2,4,74,7,1,6,0,1,0,6,1,126,0,1,0,2,3,1,2,103,0,0,0,5,95,0,5,5,58,75,0,3,3,4,95,0,4,4,59,4,76,0,0,0,45,0,45,36,42,34,36,50,35,8,9,26,43,1,54,38,38,35,34,6,7,22,51,50,55,23,7,38,35,34,7,22,51,50,54,54,55,55,6,21,20,23,7,6,35,34,38,53,52,54,51,50,23,23,6,21,20,23,7,1,91,1,14,36,34,71,68,3,17,36,66,75,3,8,28,56,64,40,12,128,32,34,16,4,44,4,1,4,68,59,106,112,130,116,48,54,4,1,1,7,1,64,37,38,15,74,81,1,7,5,49,2,4,161,16,38,37,4,28,52,31,14,5,16,111,108,117,131,12,5,29,41,33,14,6,0,0,1,0,65,255,248,1,161,1,203,0,44,0,69,64,66,39,32,2,5,6,26,1,2,4,14,1,3,2,10,1,1,3,4,74,0,2,4,3,4,2,3,126,0,5,0,4,2,5,4,103,0,6,6,0,95,0,0,0,58,75,0,3,3,1,95,0,1,1,64,1,76,34,36,50,34,23,36,32,7,9,27,43,18,51,50,22,21,20,6,35,34,39,39,54,53,52,39,55,51,6,22,51,50,54,55,38,35,34,7,39,55,22,51,50,55,38,35,34,6,6,7,7,54,53,52,39,55,140,59,106,112,130,116,48,54,4,2,2,7,39,1,34,50,73,68,1,17,35,65,77,3,8,28,55,64,40,15,124,32,34,16,4,44,4,1,4,1,203,111,108,117,131,12,5,58,14,22,26,6,54,39,79,87,1,7,5,49,2,4,150,15,37,36,4,28,50,30,14,5,255,255,0,42,255,244,0,244,2,180,0,34,1,79,0,0,0,3,7,191,1,80,0,0,255,255,0,8,255,244,1,9,2,127,0,34,1,79,0,0,0,3,7,186,1,80,0,0,255,255,0,15,255,15,0,180,2,200,0,2,1,96,0,0,255,255,0,8,255,244,1,248,2,230,0,2,1,74,0,0,0,2,0,46,255,244,2,180,1,208,0,54,0,68,0,101,64,98,40,1,5,7,41,1,4,5,21,1,3,2,26,1,0,3,4,74,0,6,0,1,2,6,1,101,8,1,4,4,7,95,10,1,7,7,63,75,8,1,4,4,5,93,0,5,5,58,75,11,9,2,2,2,3,93,0,3,3,59,75,11,9,2,2,2,0,95,0,0,0,62,0,76,55,55,0,0,55,68,55,67,62,60,0,54,0,53,71,34,40,52,35,35,38,12,9,27,43,0,22,22,21,20,6,6,35,34,38,38,53,34,7,7,6,22,51,50,54,51,23,7,38,35,34,7,55,54,54,53,19,52,38,35,7,39,55,23,50,55,7,14,2,7,7,22,51,50,55,62,2,51,18,54,53,52,38,38,35,34,6,21,20,22,22,51,2,46,86,48,60,103,63,54,86,48,53,49,3,1,12,18,9,16,5,2,6,58,16,51,57,5,32,23,1,11,16,24,2,5,82,41,47,2,21,18,7,1,4,15,29,41,20,8,63,95,57,43,63,35,61,40,53,63,35,61,40,1,208,56,101,65,71,116,67,56,99,64,3,115,29,19,2,3,42,2,7,42,6,24,29,1,23,22,16,1,4,39,1,5,42,3,10,21,24,105,1,1,61,96,55,254,85,91,78,59,93,52,92,79,59,92,51,0,0,0,0,2,0,7,255,245,1,185,1,201,0,46,0,55,0,139,75,176,10,80,88,64,15,23,1,1,7,1,74,34,1,3,72,15,4,2,0,71,27,64,15,23,1,1,7,15,4,2,2,0,2,74,34,1,3,72,89,75,176,10,80,88,64,32,8,1,7,0,1,5,7,1,101,0,6,6,3,95,4,1,3,3,58,75,0,5,5,0,96,2,1,0,0,59,0,76,27,64,36,8,1,7,0,1,5,7,1,101,0,6,6,3,95,4,1,3,3,58,75,0,5,5,0,94,0,0,0,59,75,0,2,2,57,2,76,89,64,16,47,47,47,55,47,55,35,43,33,46,19,22,33,9,9,27,43,37,7,39,34,7,55,54,54,53,53,35,7,6,6,35,39,39,55,54,54,55,55,54,55,38,38,53,52,54,51,23,22,51,50,55,7,14,2,7,6,6,21,20,22,51,55,39,55,52,35,34,21,20,22,23,1,185,7,104,61,32,5,35,25,73,66,17,42,21,73,3,6,33,35,23,47,18,15,49,57,99,81,43,28,14,41,52,3,24,20,8,2,3,8,12,22,37,137,1,54,95,45,39,40,42,2,7,42,6,24,29,80,119,32,34,7,5,33,3,22,32,66,25,7,14,69,46,62,75,1,2,5,41,3,7,14,15,27,206,48,35,20,2,174,156,40,85,43,58,7,0,0,0,0,1,0,14,255,57,1,216,2,230,0,62,0,84,64,81,54,1,4,5,55,36,2,3,4,59,16,2,1,0,3,74,49,48,45,3,5,72,7,5,2,2,71,0,5,4,5,131,6,1,4,7,1,3,8,4,3,103,0,0,0,8,95,9,1,8,8,63,75,0,1,1,2,93,0,2,2,59,2,76,0,0,0,62,0,61,19,40,35,19,37,50,38,44,10,9,28,43,0,22,21,20,6,7,39,39,54,54,53,52,38,35,34,6,7,6,21,20,22,51,55,23,7,38,35,7,55,54,54,53,17,34,6,35,39,55,23,53,52,38,35,35,39,55,54,54,55,23,6,7,54,54,55,23,7,7,6,7,54,54,51,1,134,82,105,118,7,20,93,75,53,53,22,68,27,3,16,20,35,2,9,69,22,99,6,29,23,27,40,6,9,7,75,18,19,21,4,4,34,84,30,6,9,8,39,70,12,13,4,132,4,1,41,77,22,1,208,111,105,157,213,77,3,27,76,171,134,90,94,32,23,97,146,31,25,1,4,42,3,2,41,3,24,28,1,172,1,9,39,1,58,27,25,3,32,4,16,9,13,15,146,1,3,1,13,37,1,78,58,30,48,0,0,2,0,21,255,249,1,245,2,230,0,53,0,65,0,91,64,88,44,35,27,3,4,5,1,74,40,39,37,3,5,72,0,5,4,5,131,7,1,3,2,9,2,3,9,126,12,1,9,0,10,11,9,10,101,8,1,2,2,4,93,6,1,4,4,58,75,13,1,11,11,0,95,1,1,0,0,59,0,76,54,54,0,0,54,65,54,64,60,59,0,53,0,52,19,19,25,19,19,19,22,67,37,14,9,29,43,0,22,21,20,6,6,35,34,38,39,38,35,34,7,7,55,62,2,53,17,14,2,7,7,55,55,23,51,53,52,38,35,34,7,39,55,54,55,23,6,7,51,55,23,23,7,46,2,39,7,51,22,54,53,52,38,39,7,6,21,20,22,51,1,157,88,45,81,50,17,25,9,36,21,30,60,21,6,37,29,10,56,44,17,7,43,11,6,67,83,14,22,5,18,3,4,84,55,6,9,7,102,68,6,11,43,8,19,50,68,3,81,41,45,43,47,77,1,37,43,1,5,65,58,41,67,37,2,1,4,3,1,41,3,11,30,37,1,38,1,11,37,50,3,143,7,8,174,31,22,2,2,34,15,14,13,39,238,8,7,140,3,51,37,12,2,151,222,45,43,40,42,7,4,42,85,25,21,0,0,0,0,2,0,1,255,248,2,141,1,198,0,71,0,89,0,82,64,79,81,1,8,10,40,23,1,3,0,2,2,74,48,1,8,1,73,0,8,10,1,10,8,1,126,4,1,1,2,10,1,2,124,11,1,10,10,7,93,0,7,7,58,75,9,6,2,2,2,0,96,5,3,2,0,0,64,0,76,72,72,72,89,72,87,71,70,22,61,19,21,25,50,37,37,18,12,9,29,43,37,7,7,34,38,39,39,38,38,35,35,6,6,21,20,22,51,55,23,7,38,35,34,7,55,62,2,53,53,52,39,34,6,7,7,6,6,35,39,39,55,54,54,55,55,54,54,55,39,46,2,39,39,55,23,33,55,23,7,6,6,7,7,22,22,23,23,22,22,23,0,6,21,20,22,22,23,22,23,51,55,54,54,53,52,38,35,35,2,141,5,70,20,40,24,85,8,11,11,11,5,2,14,20,37,3,9,68,36,43,49,5,27,24,9,10,13,12,8,93,27,37,19,70,5,4,26,43,23,71,24,33,27,69,24,28,31,32,1,5,95,1,83,90,5,6,37,36,38,78,27,32,17,74,19,45,29,254,98,11,29,34,6,40,1,10,104,15,12,11,14,201,30,30,8,32,33,121,11,7,11,40,57,28,19,1,5,41,4,4,41,4,12,26,28,40,28,21,6,12,121,35,30,8,30,5,1,27,30,91,32,25,3,93,32,27,12,5,3,38,2,2,4,36,10,26,43,90,1,21,25,106,28,28,2,1,123,6,7,8,41,44,7,50,5,115,17,17,6,7,6,0,0,0,255,255,0,39,255,244,1,214,1,208,0,2,3,208,0,0,0,1,255,252,255,239,1,189,1,203,0,32,0,44,64,41,24,1,3,0,1,74,22,8,2,1,72,32,25,16,3,3,71,0,3,0,3,132,2,1,0,0,1,93,0,1,1,58,0,76,47,19,34,18,4,9,24,43,54,39,38,39,39,55,23,50,55,23,7,6,6,21,20,22,23,51,55,62,2,55,22,7,7,38,35,34,6,7,3,7,116,50,17,51,2,6,83,50,70,2,6,34,25,51,34,6,71,22,32,36,33,18,2,7,16,6,22,27,17,99,61,219,147,48,2,4,33,1,7,5,31,1,11,14,14,187,110,219,67,60,20,3,38,42,7,2,34,50,254,225,16,0,0,1,0,54,255,248,1,158,1,204,0,53,0,136,64,27,47,1,1,9,13,1,0,1,18,1,2,0,40,19,2,3,2,4,74,0,1,9,72,33,1,5,71,75,176,12,80,88,64,39,0,0,1,2,1,0,112,7,1,2,6,1,3,4,2,3,101,8,1,1,1,9,93,0,9,9,58,75,0,4,4,5,93,0,5,5,59,5,76,27,64,40,0,0,1,2,1,0,2,126,7,1,2,6,1,3,4,2,3,101,8,1,1,1,9,93,0,9,9,58,75,0,4,4,5,93,0,5,5,59,5,76,89,64,14,52,49,19,18,22,50,51,19,52,37,18,10,9,29,43,1,6,7,7,54,53,52,38,38,35,34,6,6,7,7,51,50,54,55,23,7,35,7,20,22,51,50,55,23,7,38,35,34,7,55,54,54,53,53,7,39,55,23,53,52,38,35,7,39,55,22,51,50,55,1,158,11,6,46,2,12,41,51,28,20,6,1,5,7,29,69,11,11,5,123,4,13,19,5,48,3,7,73,35,43,59,5,34,24,57,7,6,59,11,17,24,3,5,58,57,171,55,1,198,53,99,3,26,28,26,20,7,3,10,13,142,3,1,11,33,111,26,18,3,5,44,3,8,41,6,25,29,105,1,7,35,1,135,23,15,2,5,40,2,8,0,0,1,0,44,255,76,1,166,1,204,0,57,0,135,64,26,54,34,2,5,3,55,1,0,7,13,1,1,0,3,74,41,40,2,4,72,25,7,5,3,2,71,75,176,12,80,88,64,38,0,5,3,7,3,5,112,8,1,7,0,0,1,7,0,103,6,1,3,3,4,93,0,4,4,58,75,0,1,1,2,93,0,2,2,59,2,76,27,64,39,0,5,3,7,3,5,7,126,8,1,7,0,0,1,7,0,103,6,1,3,3,4,93,0,4,4,58,75,0,1,1,2,93,0,2,2,59,2,76,89,64,16,0,0,0,57,0,56,37,20,51,24,50,52,27,9,9,27,43,0,22,21,20,6,7,39,39,54,54,53,52,39,7,7,20,22,51,50,55,23,7,38,35,34,7,55,54,54,53,19,52,38,35,7,39,55,22,51,50,55,23,6,7,7,54,53,52,38,38,35,34,6,6,7,7,54,51,1,83,83,104,100,6,11,73,71,106,62,4,13,22,7,28,3,8,54,26,66,48,5,34,24,1,11,17,24,3,5,58,57,171,55,4,11,6,46,2,12,41,51,28,20,6,1,4,46,39,1,4,73,67,90,159,51,4,24,51,132,74,104,3,13,112,27,17,2,5,42,2,5,41,4,24,29,1,24,23,15,2,5,40,2,8,6,53,99,3,26,28,26,20,7,3,10,13,132,12,0,0,1,0,23,255,120,2,231,1,201,0,99,0,114,64,111,94,88,48,3,10,8,42,1,2,10,2,74,99,1,7,1,73,70,1,9,72,0,7,3,1,3,7,1,126,13,1,10,5,1,2,3,10,2,101,0,0,3,0,81,0,11,11,9,95,14,12,2,9,9,58,75,15,1,8,8,9,95,14,12,2,9,9,58,75,16,1,3,3,1,95,6,4,2,1,1,57,1,76,98,97,91,89,82,81,78,77,69,66,64,62,59,58,55,54,39,34,19,22,84,36,19,17,17,17,9,29,43,4,23,7,39,34,38,39,39,35,6,21,20,22,51,50,54,51,23,7,34,38,35,34,6,7,55,54,54,53,53,35,7,6,6,35,39,39,55,50,55,55,54,55,39,38,38,35,34,7,39,38,53,52,54,55,50,22,23,23,51,53,52,38,35,7,39,55,23,50,54,55,7,14,2,7,6,7,51,55,54,54,51,22,22,21,20,7,7,38,35,34,6,7,7,23,22,22,23,23,2,228,3,47,32,21,43,21,97,71,3,15,20,10,18,3,2,7,7,42,22,33,85,1,5,35,23,71,87,19,44,22,71,5,4,59,35,60,22,30,53,17,32,22,22,36,8,1,8,12,52,61,33,63,72,11,17,25,2,5,87,21,60,9,3,22,19,7,1,1,4,70,63,33,61,52,12,8,1,8,36,22,22,32,17,43,111,19,33,35,11,61,72,3,126,33,33,151,69,49,28,20,2,3,42,2,5,2,42,6,24,30,112,151,32,34,8,30,4,59,99,36,14,86,28,26,15,7,11,19,16,24,13,42,56,107,123,23,15,1,4,39,1,4,1,42,3,10,21,24,33,74,107,56,42,13,24,16,19,11,7,15,26,28,70,164,29,18,2,13,0,0,0,0,1,0,62,255,100,1,131,1,200,0,55,0,72,64,69,40,1,4,5,52,1,3,4,16,1,2,1,12,1,0,2,4,74,6,1,0,71,0,1,3,2,3,1,2,126,0,4,0,3,1,4,3,101,0,5,5,6,95,0,6,6,58,75,0,2,2,0,95,0,0,0,64,0,76,41,37,18,20,34,23,25,7,9,27,43,36,6,7,6,15,2,39,38,39,34,39,39,54,53,52,39,55,51,6,22,51,50,54,53,52,39,7,39,55,23,54,54,53,52,38,35,34,6,7,7,54,53,52,39,55,54,51,50,22,21,20,7,22,22,21,1,131,66,58,11,3,10,39,9,5,7,44,68,4,1,2,26,19,1,45,52,52,54,91,77,2,7,91,23,26,49,45,40,34,5,45,4,1,4,64,58,79,83,83,54,57,85,68,15,19,32,104,3,90,39,19,12,6,29,37,34,19,6,50,46,40,39,71,18,3,5,46,1,11,42,26,36,40,40,50,4,31,50,28,13,6,13,55,52,72,38,11,57,41,0,0,1,0,44,255,120,1,247,1,201,0,68,0,85,64,82,57,1,7,9,63,1,2,7,68,1,1,3,3,74,39,1,6,72,0,7,0,2,3,7,2,101,0,0,3,0,81,0,5,5,6,95,8,1,6,6,58,75,0,9,9,6,95,8,1,6,6,58,75,10,1,3,3,1,95,4,1,1,1,57,1,76,67,66,60,58,19,24,50,40,84,36,19,17,17,11,9,29,43,4,23,7,39,34,38,39,39,35,6,21,20,22,51,50,54,51,23,7,34,38,35,34,6,7,55,54,54,53,19,52,38,35,7,39,55,23,50,54,55,7,14,2,7,6,7,23,55,54,54,51,22,22,21,20,7,7,38,35,34,6,7,7,23,22,22,23,23,1,244,3,47,32,21,43,21,97,66,3,15,20,10,18,3,2,7,7,42,22,33,85,1,5,35,23,1,11,17,25,2,5,87,21,60,9,3,22,19,7,1,1,4,71,62,33,61,52,12,8,1,8,36,22,22,32,17,45,108,19,33,35,11,61,72,3,126,33,33,151,69,49,28,20,2,3,42,2,5,2,42,6,24,30,1,22,23,15,1,4,39,1,4,1,42,3,10,21,24,29,73,4,106,56,42,13,24,16,19,11,7,15,26,28,74,160,29,18,2,13,0,1,0,44,255,246,2,26,1,201,0,74,0,190,75,176,27,80,88,64,27,71,65,54,53,52,51,50,49,8,1,8,10,9,8,3,3,1,0,1,0,3,3,74,43,1,6,72,27,64,27,71,65,54,53,52,51,50,49,8,1,8,10,9,8,3,3,1,0,1,0,9,3,74,43,1,6,72,89,75,176,27,80,88,64,44,2,1,1,8,3,8,1,3,126,0,5,5,6,95,7,1,6,6,58,75,0,8,8,6,95,7,1,6,6,58,75,9,1,3,3,0,95,4,1,0,0,57,0,76,27,64,51,2,1,1,8,3,8,1,3,126,0,9,3,0,3,9,0,126,0,5,5,6,95,7,1,6,6,58,75,0,8,8,6,95,7,1,6,6,58,75,0,3,3,0,95,4,1,0,0,57,0,76,89,64,16,74,73,68,66,59,58,50,40,84,36,20,19,18,10,9,27,43,37,7,7,34,38,39,39,35,21,7,39,55,35,6,21,20,22,51,50,54,51,23,7,34,38,35,34,6,7,55,54,54,53,19,52,38,35,7,39,55,23,50,54,55,7,14,2,7,7,23,39,55,23,7,23,55,54,54,51,22,22,21,20,7,7,38,35,34,6,7,7,23,22,51,2,26,5,71,21,45,19,90,30,37,6,2,40,3,15,20,10,18,3,2,7,7,42,22,33,85,1,5,35,23,1,11,17,25,2,5,87,21,60,9,3,22,19,7,1,4,37,1,37,8,3,32,63,33,61,52,12,8,1,8,36,22,22,32,17,43,103,38,56,27,29,8,34,32,151,88,6,5,89,69,49,28,20,2,3,42,2,5,2,42,6,24,30,1,22,23,15,1,4,39,1,4,1,42,3,10,21,24,97,3,83,5,4,88,3,107,56,42,13,24,16,19,11,7,15,26,28,71,163,60,0,1,0,19,255,246,2,62,1,204,0,58,1,56,75,176,27,80,88,64,27,30,1,4,6,48,47,2,5,9,54,1,1,7,12,1,2,1,1,1,0,2,5,74,31,1,6,72,27,75,176,29,80,88,64,27,30,1,4,6,48,47,2,5,9,54,1,1,7,12,1,2,1,1,1,0,10,5,74,31,1,6,72,27,64,28,30,1,4,6,48,47,2,5,9,54,1,1,7,12,1,2,1,4,74,1,1,3,1,73,31,1,6,72,89,89,75,176,27,80,88,64,51,0,5,9,7,9,5,7,126,0,7,0,1,2,7,1,101,0,4,4,6,95,8,1,6,6,58,75,0,9,9,6,95,8,1,6,6,58,75,10,1,2,2,0,95,3,1,0,0,57,0,76,27,75,176,29,80,88,64,58,0,5,9,7,9,5,7,126,0,10,2,0,2,10,0,126,0,7,0,1,2,7,1,101,0,4,4,6,95,8,1,6,6,58,75,0,9,9,6,95,8,1,6,6,58,75,0,2,2,0,95,3,1,0,0,57,0,76,27,64,62,0,5,9,7,9,5,7,126,0,10,2,3,2,10,3,126,0,7,0,1,2,7,1,101,0,4,4,6,95,8,1,6,6,58,75,0,9,9,6,95,8,1,6,6,58,75,0,2,2,3,93,0,3,3,59,75,0,0,0,57,0,76,89,89,64,16,58,57,51,49,19,21,36,19,22,51,35,18,18,11,9,29,43,37,7,7,34,39,39,35,7,6,22,51,50,55,23,7,39,34,7,55,62,2,53,17,14,2,7,7,54,55,55,23,51,55,7,6,6,7,7,23,55,54,54,51,22,21,7,7,38,35,34,6,7,7,23,22,22,51,2,62,5,71,41,43,97,62,3,1,20,27,13,8,2,7,99,45,66,6,37,29,10,56,44,17,7,43,9,2,6,67,112,108,3,34,25,1,3,64,69,38,64,50,21,1,8,27,18,24,39,20,54,104,21,46,28,28,30,8,66,151,118,27,21,1,3,41,2,4,41,3,11,30,37,1,38,1,11,35,46,3,66,71,7,8,4,38,3,17,19,124,4,106,58,43,21,42,15,7,8,26,29,81,153,31,29,0,0,0,1,0,44,255,120,2,41,1,201,0,73,0,79,64,76,51,1,8,6,21,1,2,3,73,1,1,2,3,74,61,42,2,7,72,0,8,0,3,2,8,3,101,0,0,2,0,81,9,1,6,6,7,93,10,1,7,7,58,75,11,4,2,2,2,1,93,5,1,1,1,59,1,76,72,71,60,58,56,54,39,34,40,67,35,51,17,35,17,12,9,29,43,4,23,7,39,38,38,35,7,55,54,54,53,53,39,34,7,7,6,22,51,50,55,23,7,38,35,34,6,7,55,54,54,53,19,52,38,35,7,39,55,23,50,55,7,14,2,7,7,23,50,55,55,52,38,35,7,39,55,23,50,55,7,6,6,7,6,6,21,20,22,31,2,2,33,8,46,15,5,35,40,72,7,34,22,106,21,100,2,1,13,19,17,16,2,7,42,30,26,90,1,5,35,23,1,11,17,25,2,5,86,28,62,3,22,18,7,1,5,119,54,52,1,11,17,26,2,5,81,32,65,3,28,18,2,4,6,11,14,44,6,35,98,3,83,30,23,1,41,1,28,43,95,1,7,112,28,20,2,3,42,2,5,2,42,6,24,29,1,24,22,16,1,4,38,1,5,41,3,9,22,24,106,1,6,117,22,16,1,4,38,1,5,41,4,15,20,54,165,71,23,18,1,2,7,0,0,0,0,1,0,44,255,248,2,177,1,204,0,79,0,144,64,27,74,1,1,8,13,1,0,1,69,1,9,0,39,1,3,2,4,74,60,0,2,8,72,25,1,3,71,75,176,12,80,88,64,41,0,0,1,9,1,0,112,0,9,0,4,2,9,4,101,10,7,2,1,1,8,93,11,1,8,8,58,75,5,1,2,2,3,93,6,1,3,3,59,3,76,27,64,42,0,0,1,9,1,0,9,126,0,9,0,4,2,9,4,101,10,7,2,1,1,8,93,11,1,8,8,58,75,5,1,2,2,3,93,6,1,3,3,59,3,76,89,64,18,78,76,73,72,68,66,34,40,67,35,54,50,54,37,18,12,9,29,43,1,6,7,7,54,53,52,38,38,35,34,6,6,7,3,20,22,51,50,55,23,7,38,35,34,7,55,54,54,53,53,39,34,7,7,6,22,51,50,55,23,7,38,35,34,6,7,55,54,54,53,19,52,38,35,7,39,55,23,50,55,7,14,2,7,7,23,50,55,53,52,38,35,7,39,55,23,50,55,2,177,11,6,46,2,12,37,45,28,20,6,1,10,13,19,5,48,3,7,63,45,46,56,5,34,24,106,21,100,2,1,13,19,17,16,2,7,42,30,26,90,1,5,35,23,1,11,17,25,2,5,86,28,62,3,22,18,7,1,5,119,54,53,11,17,24,3,5,115,161,55,1,198,52,100,3,18,36,25,21,7,3,10,13,254,219,26,18,3,5,44,3,8,41,6,25,29,114,1,7,112,28,20,2,3,42,2,5,2,42,6,24,29,1,24,22,16,1,4,38,1,5,41,3,9,22,24,106,1,6,116,22,16,2,5,40,2,8,0,1,0,44,255,120,2,24,1,201,0,59,0,66,64,63,48,1,2,6,51,26,2,3,2,59,1,1,3,32,1,0,1,4,74,47,1,6,72,0,0,3,0,81,5,1,2,2,6,93,0,6,6,58,75,7,1,3,3,1,93,4,1,1,1,59,1,76,27,50,40,51,38,55,35,17,8,9,28,43,4,23,7,39,38,38,35,35,55,54,54,53,19,52,38,35,35,34,6,7,6,21,20,22,51,50,55,23,7,38,35,34,7,55,54,54,53,19,52,38,35,7,39,55,23,33,50,55,7,6,6,7,6,21,21,22,22,31,2,2,16,8,46,15,6,35,39,71,5,32,25,1,18,19,105,32,27,1,11,13,20,22,16,2,7,58,45,35,58,5,35,24,1,12,16,30,3,6,95,1,22,29,63,3,31,21,1,10,1,11,13,44,6,45,88,3,83,31,22,40,3,22,27,1,20,21,15,14,20,194,87,28,20,2,3,42,2,7,42,6,24,29,1,22,22,16,1,4,40,1,5,43,4,15,20,127,159,7,18,18,1,2,7,0,0,1,0,40,255,100,1,135,1,208,0,43,0,44,64,41,23,1,1,0,43,28,27,3,2,1,2,74,8,1,2,71,0,2,1,2,132,0,1,1,0,95,0,0,0,63,1,76,39,37,33,31,19,17,3,9,20,43,37,14,2,7,6,15,2,39,38,39,38,38,53,52,54,54,51,50,22,22,23,23,14,2,7,7,53,52,38,35,34,6,21,20,22,51,50,54,54,55,23,1,130,4,32,47,21,7,3,10,39,9,5,8,75,86,61,105,65,28,52,33,4,3,1,9,10,1,41,45,37,61,66,73,63,25,50,34,4,6,55,3,23,26,8,16,28,104,3,90,40,18,15,115,87,71,117,67,8,9,2,7,5,37,61,35,3,31,37,45,87,80,87,101,15,15,3,2,0,1,255,252,255,19,1,202,1,203,0,51,0,63,64,60,49,1,2,3,40,21,5,3,0,2,2,74,32,1,3,72,15,1,1,71,5,4,2,2,2,3,93,7,6,2,3,3,58,75,0,0,0,1,93,0,1,1,60,1,76,0,0,0,51,0,50,43,19,34,28,34,40,8,9,26,43,1,7,6,6,7,3,23,20,22,51,55,23,7,35,34,7,55,62,2,53,55,38,39,38,39,38,39,39,55,23,50,55,23,7,6,6,21,20,22,23,51,54,54,53,52,38,35,35,39,55,23,1,202,7,21,24,19,140,1,19,28,34,2,8,95,39,77,5,27,25,9,2,5,24,66,19,17,51,2,6,83,57,63,2,6,34,25,50,35,4,82,36,19,24,38,4,5,107,1,197,37,3,28,44,254,179,119,47,32,1,3,38,7,39,3,11,24,24,146,16,75,208,57,48,2,4,33,1,7,5,31,1,11,14,14,184,113,202,93,11,13,11,6,31,1,0,0,255,255,255,252,255,19,1,202,1,203,0,34,3,189,0,0,1,7,7,220,1,195,255,17,0,9,177,1,1,184,255,17,176,51,43,0,0,1,0,20,255,120,1,225,1,200,0,75,0,70,64,67,67,50,46,32,13,5,7,4,72,19,2,1,7,25,21,5,3,8,0,3,74,0,1,7,0,7,1,0,126,0,7,0,8,7,8,97,5,1,4,4,3,93,6,1,3,3,58,75,2,1,0,0,59,0,76,19,24,50,28,18,62,46,19,34,9,9,29,43,5,38,38,35,34,7,39,55,54,54,53,52,39,39,6,6,21,20,22,23,23,7,38,35,34,7,39,55,62,2,55,55,39,38,38,39,39,55,23,50,55,23,7,34,6,21,20,22,23,23,55,54,54,53,52,38,35,39,55,51,50,55,23,7,6,7,7,23,22,22,23,23,20,23,7,1,164,5,31,34,18,64,2,6,25,21,17,73,58,43,17,27,2,6,56,27,18,42,3,6,22,30,35,6,86,76,34,39,35,2,6,101,26,76,2,6,25,20,9,15,55,61,19,12,18,25,2,5,73,14,57,3,6,27,57,86,92,29,35,29,6,8,46,53,30,23,6,5,31,1,9,11,13,24,102,71,60,8,10,6,2,4,33,4,3,5,31,12,28,41,7,100,108,50,31,6,4,34,2,4,5,31,9,10,8,17,22,80,77,22,21,8,8,5,4,33,3,5,32,9,66,101,131,41,26,1,7,55,114,3,0,0,0,1,0,13,255,120,1,193,1,201,0,63,0,79,64,76,52,1,4,5,38,1,6,4,13,1,3,6,63,1,1,2,4,74,28,1,5,72,0,6,0,3,2,6,3,103,0,0,2,0,81,7,1,4,4,5,93,9,8,2,5,5,58,75,10,1,2,2,1,93,0,1,1,59,1,76,62,61,49,48,34,36,25,34,37,37,17,35,17,11,9,29,43,4,23,7,39,38,38,35,7,55,62,2,53,53,6,35,34,38,53,53,52,38,35,7,39,55,23,50,55,7,14,2,7,7,6,22,23,55,55,52,38,35,7,39,55,23,50,55,50,54,51,7,6,6,7,7,6,21,20,22,31,2,1,185,8,46,15,5,35,40,81,7,28,27,10,56,50,61,73,10,13,22,1,4,79,34,57,3,23,19,6,1,1,1,50,47,69,1,11,17,26,2,5,82,34,42,10,9,2,3,29,19,1,4,6,11,14,44,6,35,98,3,83,30,23,1,41,1,11,29,31,70,22,67,60,92,21,15,1,4,35,1,5,38,3,10,21,24,57,47,52,1,22,147,23,15,1,4,39,1,4,1,42,4,15,20,112,134,43,23,18,1,2,7,0,0,0,1,0,10,255,254,1,213,1,201,0,69,0,76,64,73,57,1,3,4,45,44,42,41,40,38,13,11,8,2,3,16,15,14,3,1,2,3,74,30,1,4,72,0,2,3,1,3,2,1,126,5,1,3,3,4,93,6,1,4,4,58,75,7,1,1,1,0,93,0,0,0,59,0,76,68,66,54,52,50,48,34,37,26,17,65,8,9,25,43,37,7,34,38,35,7,55,62,2,53,53,6,7,21,7,39,55,34,38,53,53,52,38,35,7,39,55,23,50,55,7,14,2,7,7,6,23,55,39,55,23,7,21,55,55,52,38,35,7,39,55,23,50,54,51,7,6,6,7,6,7,6,21,20,22,51,50,55,1,213,8,3,53,51,109,8,32,30,11,37,40,37,6,1,67,79,10,16,24,1,4,87,37,58,3,25,21,7,1,1,2,72,1,1,37,7,2,76,1,12,19,30,2,6,88,30,70,4,3,32,22,1,1,4,6,16,23,14,21,40,42,2,1,41,1,11,30,30,72,14,6,49,5,4,46,66,61,92,21,15,1,4,35,1,5,38,3,10,21,24,57,84,15,19,112,5,4,105,26,21,146,23,15,1,4,39,1,5,42,4,15,20,39,83,128,39,25,21,3,0,255,255,0,25,255,244,1,246,2,230,0,2,1,73,0,0,0,1,0,35,255,249,0,232,2,223,0,36,0,33,64,30,14,1,1,72,0,1,0,0,2,1,0,103,0,2,2,3,93,0,3,3,59,3,76,84,43,50,38,4,9,24,43,55,54,54,53,19,52,38,35,7,39,55,23,50,54,55,7,14,2,7,6,2,7,20,22,51,50,54,51,23,7,34,38,35,34,6,7,40,35,23,1,11,17,25,2,5,87,21,60,9,3,22,19,7,1,3,6,1,15,20,10,18,3,2,7,7,42,22,33,85,1,35,6,24,30,2,44,23,15,1,4,39,1,4,1,42,3,10,21,24,60,254,125,99,28,20,2,3,42,2,5,2,255,255,0,22,255,246,2,218,2,143,0,34,3,135,0,0,0,3,8,41,2,56,0,0,0,1,0,13,255,120,1,178,1,201,0,66,0,79,64,76,55,1,4,5,41,1,6,4,16,1,3,6,10,1,0,2,4,74,31,1,5,72,0,6,0,3,2,6,3,103,0,1,2,1,82,7,1,4,4,5,93,9,8,2,5,5,58,75,10,1,2,2,0,94,0,0,0,59,0,76,65,63,52,51,34,36,25,34,37,37,19,19,49,11,9,29,43,37,7,38,35,34,6,15,2,54,53,55,55,54,54,53,53,6,35,34,38,53,53,52,38,35,7,39,55,23,50,55,7,14,2,7,7,6,22,23,55,55,52,38,35,7,39,55,23,50,55,50,54,51,7,6,6,7,7,6,21,20,22,51,50,55,1,178,7,35,36,40,35,5,14,47,8,6,44,14,12,56,50,61,73,10,13,22,1,4,79,34,57,3,23,19,6,1,1,1,50,47,69,1,11,17,26,2,5,82,34,42,10,9,2,3,29,19,1,4,6,15,20,13,18,40,42,2,23,30,80,3,98,74,7,2,1,19,22,95,22,67,60,92,21,15,1,4,35,1,5,38,3,10,21,24,57,47,52,1,22,147,23,15,1,4,39,1,4,1,42,4,15,20,112,134,43,26,20,3,255,255,0,39,255,244,1,201,2,143,0,34,0,254,254,0,0,3,8,41,1,151,0,0,255,255,0,39,255,244,1,201,2,127,0,34,0,254,254,0,0,3,7,186,1,158,0,0,255,255,0,30,255,244,2,121,1,208,0,2,1,24,0,0,255,255,0,39,255,244,1,153,2,143,0,34,1,41,3,0,0,3,8,41,1,194,0,0,255,255,0,42,255,244,1,156,1,208,0,2,1,64,0,0,255,255,0,22,255,246,2,218,2,127,0,34,3,135,0,0,0,3,7,186,2,63,0,0,255,255,0,62,255,248,1,131,2,127,0,34,3,136,0,0,0,3,7,186,1,157,0,0,255,255,0,44,255,249,2,28,2,121,0,34,3,137,0,0,0,3,7,205,1,236,0,0,255,255,0,44,255,249,2,28,2,127,0,34,3,137,0,0,0,3,7,186,1,237,0,0,255,255,0,40,255,244,1,210,2,127,0,34,1,123,4,0,0,3,7,186,1,196,0,0,0,3,0,39,255,244,1,214,1,208,0,15,0,23,0,32,0,61,64,58,0,2,0,4,5,2,4,101,7,1,3,3,1,95,6,1,1,1,63,75,8,1,5,5,0,95,0,0,0,62,0,76,24,24,16,16,0,0,24,32,24,31,29,26,16,23,16,22,20,18,0,15,0,14,38,9,9,21,43,0,22,22,21,20,6,6,35,34,38,38,53,52,54,54,51,6,6,7,23,55,38,38,35,18,54,53,53,34,7,22,22,51,1,75,89,50,62,108,65,57,89,50,62,108,65,85,66,5,154,113,11,77,54,79,67,154,116,8,79,58,1,208,56,101,65,70,117,67,56,101,65,70,117,67,54,82,71,1,4,68,82,254,138,92,78,4,2,78,94,0,0,0,255,255,255,251,255,15,1,201,2,121,0,34,1,226,4,0,0,3,7,205,1,169,0,0,255,255,255,251,255,15,1,201,2,127,0,34,1,226,4,0,0,3,7,186,1,170,0,0,255,255,255,251,255,15,1,201,2,193,0,34,1,226,4,0,0,3,7,195,1,184,0,0,255,255,0,13,255,254,1,178,2,127,0,34,3,154,0,0,0,3,7,186,1,160,0,0,0,1,0,44,255,120,1,147,1,204,0,43,0,161,64,22,37,1,1,6,13,1,0,1,19,1,4,2,28,1,3,4,4,74,0,1,6,72,75,176,10,80,88,64,35,0,0,1,2,1,0,112,0,3,4,4,3,111,5,1,1,1,6,93,0,6,6,58,75,0,2,2,4,95,0,4,4,59,4,76,27,75,176,12,80,88,64,34,0,0,1,2,1,0,112,0,3,4,3,132,5,1,1,1,6,93,0,6,6,58,75,0,2,2,4,95,0,4,4,59,4,76,27,64,35,0,0,1,2,1,0,2,126,0,3,4,3,132,5,1,1,1,6,93,0,6,6,58,75,0,2,2,4,95,0,4,4,59,4,76,89,89,64,10,51,24,35,19,38,37,18,7,9,27,43,1,6,7,7,54,53,52,38,38,35,34,6,6,7,3,20,22,31,2,20,23,7,39,38,38,35,34,7,55,54,54,53,19,52,38,35,7,39,55,23,50,54,55,1,147,11,6,46,2,13,41,50,28,20,6,1,10,18,26,66,6,8,46,15,6,27,40,32,87,5,34,24,1,11,17,24,3,5,115,96,99,31,1,198,52,100,3,13,41,26,20,7,3,10,13,254,219,25,17,1,1,7,55,114,3,83,33,20,8,41,6,25,29,1,24,22,16,2,5,40,2,4,4,0,0,255,255,0,45,255,248,2,102,2,127,0,34,3,217,0,0,0,35,1,241,1,129,0,0,0,3,7,186,2,21,0,0,255,255,0,36,255,22,1,229,1,222,0,2,1,161,0,0,255,255,255,252,255,239,2,194,1,203,0,2,1,220,0,0,0,2,0,45,255,248,1,143,1,201,0,34,0,45,0,64,64,61,21,1,2,72,6,1,0,71,0,3,0,5,6,3,5,101,0,1,1,2,95,0,2,2,58,75,8,1,6,6,0,95,7,4,2,0,0,59,0,76,35,35,0,0,35,45,35,44,41,40,0,34,0,33,38,50,40,35,9,9,24,43,22,38,39,38,35,34,7,55,54,54,53,19,52,38,35,7,39,55,22,51,50,55,7,6,6,7,7,51,50,22,21,20,6,6,35,54,54,53,52,38,39,7,7,20,22,51,217,24,9,32,19,28,60,5,31,22,1,10,15,27,2,4,44,22,58,56,3,29,22,1,5,70,71,84,43,76,47,45,43,41,42,66,3,32,39,7,2,1,4,8,42,6,25,27,1,25,23,15,1,4,39,2,6,42,4,16,19,110,67,58,42,68,38,46,48,43,41,44,6,4,132,25,21,0,0,1,0,44,255,248,1,147,1,204,0,46,0,124,64,22,40,1,1,7,13,1,0,1,17,1,3,2,3,74,0,1,7,72,31,1,5,71,75,176,12,80,88,64,37,0,0,1,2,1,0,112,0,2,0,3,4,2,3,101,6,1,1,1,7,93,0,7,7,58,75,0,4,4,5,93,0,5,5,59,5,76,27,64,38,0,0,1,2,1,0,2,126,0,2,0,3,4,2,3,101,6,1,1,1,7,93,0,7,7,58,75,0,4,4,5,93,0,5,5,59,5,76,89,64,11,51,24,50,51,18,36,37,18,8,9,28,43,1,6,7,7,54,53,52,38,38,35,34,6,6,7,7,54,55,23,7,35,7,20,22,51,50,55,23,7,38,35,34,7,55,54,54,53,19,52,38,35,7,39,55,23,50,54,55,1,147,11,6,46,2,13,41,50,28,20,6,1,5,102,29,12,5,139,4,13,19,5,48,3,7,63,45,46,56,5,34,24,1,11,17,24,3,5,115,96,99,31,1,198,52,100,3,18,36,26,20,7,3,10,13,144,2,2,12,36,105,26,18,3,5,44,3,8,41,6,25,29,1,24,22,16,2,5,40,2,4,4,255,255,0,62,255,100,1,131,1,200,0,2,3,181,0,0,255,255,0,40,255,23,1,135,1,208,0,34,1,27,4,0,0,3,7,216,1,210,0,0,0,2,0,39,255,244,1,206,2,230,0,32,0,45,0,43,64,40,39,16,2,2,1,1,74,26,1,1,72,0,1,2,1,131,3,1,2,2,0,95,0,0,0,62,0,76,33,33,33,45,33,44,30,29,41,4,9,21,43,18,22,23,30,2,21,20,6,6,35,34,38,53,52,54,55,38,38,53,52,54,55,54,54,55,23,23,7,7,34,6,21,18,54,53,52,38,38,39,6,6,21,20,22,51,184,45,49,57,73,54,61,104,64,88,106,81,71,41,43,99,111,48,33,15,27,1,42,9,114,92,132,64,40,60,44,63,54,76,64,2,27,38,27,31,55,92,65,67,112,64,114,95,80,128,34,24,51,38,45,64,26,12,19,24,13,5,103,8,22,27,253,241,85,74,59,82,51,25,31,87,67,88,103,0,255,255,0,0,255,249,1,250,1,251,0,2,2,4,0,0,0,2,0,54,255,247,1,206,1,252,0,43,0,54,1,228,75,176,8,80,88,64,15,14,1,4,1,1,74,22,21,2,2,72,5,1,0,71,27,75,176,10,80,88,64,15,14,1,3,1,1,74,22,21,2,2,72,5,1,0,71,27,75,176,11,80,88,64,15,14,1,4,1,1,74,22,21,2,2,72,5,1,0,71,27,75,176,27,80,88,64,15,14,1,3,1,1,74,22,21,2,2,72,5,1,0,71,27,75,176,30,80,88,64,15,14,1,4,1,1,74,22,21,2,2,72,5,1,0,71,27,64,15,14,1,4,1,1,74,22,21,2,2,72,5,1,6,71,89,89,89,89,89,75,176,8,80,88,64,47,0,1,2,4,4,1,112,0,3,4,5,4,3,5,126,0,5,0,7,8,5,7,101,0,4,4,2,94,0,2,2,38,75,10,1,8,8,0,95,9,6,2,0,0,39,0,76,27,75,176,10,80,88,64,41,0,3,1,5,1,3,5,126,0,5,0,7,8,5,7,101,4,1,1,1,2,93,0,2,2,38,75,10,1,8,8,0,95,9,6,2,0,0,39,0,76,27,75,176,11,80,88,64,47,0,1,2,4,4,1,112,0,3,4,5,4,3,5,126,0,5,0,7,8,5,7,101,0,4,4,2,94,0,2,2,38,75,10,1,8,8,0,95,9,6,2,0,0,39,0,76,27,75,176,27,80,88,64,41,0,3,1,5,1,3,5,126,0,5,0,7,8,5,7,101,4,1,1,1,2,93,0,2,2,38,75,10,1,8,8,0,95,9,6,2,0,0,39,0,76,27,75,176,30,80,88,64,47,0,1,2,4,4,1,112,0,3,4,5,4,3,5,126,0,5,0,7,8,5,7,101,0,4,4,2,94,0,2,2,38,75,10,1,8,8,0,95,9,6,2,0,0,39,0,76,27,64,51,0,1,2,4,4,1,112,0,3,4,5,4,3,5,126,0,5,0,7,8,5,7,101,0,4,4,2,94,0,2,2,38,75,0,0,0,39,75,10,1,8,8,6,95,9,1,6,6,39,6,76,89,89,89,89,89,64,23,44,44,0,0,44,54,44,53,50,49,0,43,0,42,36,36,20,67,24,34,11,7,26,43,22,39,38,35,34,7,55,54,54,53,19,52,38,35,7,39,55,50,23,23,50,55,23,6,7,7,55,54,38,38,35,34,6,6,21,7,51,50,22,21,20,6,6,35,54,54,53,52,38,39,7,7,6,22,51,250,36,40,21,30,69,5,37,27,1,12,17,27,3,6,33,21,68,179,67,4,15,3,49,2,1,14,43,52,33,26,7,5,81,84,98,51,88,54,57,52,50,50,81,4,1,40,47,8,4,4,9,42,7,27,31,1,64,24,17,2,5,38,1,1,10,6,68,83,3,49,25,21,7,3,11,15,141,73,63,43,69,40,49,48,43,45,48,8,5,135,28,24,255,255,0,54,255,247,1,210,1,246,0,2,2,33,0,0,255,255,0,54,255,247,1,167,1,252,0,2,5,129,0,0,255,255,0,54,255,247,1,167,2,249,0,34,5,129,0,0,1,7,7,194,1,158,0,46,0,8,177,1,1,176,46,176,51,43,0,0,0,1,0,54,255,247,1,160,2,104,0,40,1,38,75,176,8,80,88,64,16,31,1,0,3,9,3,2,3,1,0,2,74,22,1,2,71,27,75,176,10,80,88,64,16,31,1,0,4,9,3,2,3,1,0,2,74,22,1,2,71,27,75,176,11,80,88,64,16,31,1,0,3,9,3,2,3,1,0,2,74,22,1,2,71,27,75,176,27,80,88,64,16,31,1,0,4,9,3,2,3,1,0,2,74,22,1,2,71,27,64,16,31,1,0,3,9,3,2,3,1,0,2,74,22,1,2,71,89,89,89,89,75,176,8,80,88,64,28,0,3,4,0,0,3,112,0,0,0,4,94,0,4,4,38,75,0,1,1,2,93,0,2,2,39,2,76,27,75,176,10,80,88,64,22,3,1,0,0,4,93,0,4,4,38,75,0,1,1,2,93,0,2,2,39,2,76,27,75,176,11,80,88,64,28,0,3,4,0,0,3,112,0,0,0,4,94,0,4,4,38,75,0,1,1,2,93,0,2,2,39,2,76,27,75,176,27,80,88,64,22,3,1,0,0,4,93,0,4,4,38,75,0,1,1,2,93,0,2,2,39,2,76,27,64,28,0,3,4,0,0,3,112,0,0,0,4,94,0,4,4,38,75,0,1,1,2,93,0,2,2,39,2,76,89,89,89,89,183,51,24,66,54,36,5,7,25,43,1,6,7,7,38,35,34,6,6,7,3,6,22,51,50,55,23,7,39,38,35,34,7,55,54,54,53,19,52,38,35,7,39,55,22,51,50,54,54,55,55,1,160,13,3,4,97,44,25,19,6,1,11,1,15,22,5,51,3,7,71,19,27,45,65,5,37,26,1,12,18,27,2,6,110,81,41,34,15,5,10,2,100,83,81,6,8,3,11,14,254,185,31,21,3,5,44,2,1,9,42,7,27,33,1,61,25,17,2,5,38,2,7,24,29,58,0,2,0,6,255,134,1,242,1,247,0,40,0,56,0,56,64,53,32,20,2,3,1,40,12,2,0,3,2,74,28,1,2,72,11,0,2,0,71,4,1,1,1,2,93,0,2,2,38,75,5,1,3,3,0,93,0,0,0,39,0,76,53,36,42,34,31,52,6,7,26,43,5,7,39,38,38,35,35,34,6,15,2,55,55,62,2,55,55,54,53,52,38,7,39,55,33,50,55,7,6,6,7,6,6,21,20,22,31,2,3,52,38,35,39,7,14,2,7,23,51,50,54,54,53,1,242,50,7,4,39,42,208,42,39,4,7,50,1,6,59,56,21,13,13,1,35,49,2,5,1,40,58,42,4,34,22,2,5,6,11,15,46,7,149,17,21,72,19,9,20,41,35,1,161,29,30,12,118,4,63,35,24,24,35,59,4,160,8,18,62,88,101,99,4,7,19,12,2,5,39,5,41,4,17,21,75,194,60,25,17,1,2,8,1,115,22,17,1,147,73,90,70,17,5,11,29,29,255,255,0,54,255,248,1,197,1,251,0,2,2,48,0,0,255,255,0,54,255,248,1,197,2,247,0,34,2,48,0,0,1,7,7,193,1,200,0,45,0,8,177,1,1,176,45,176,51,43,0,0,255,255,0,54,255,248,1,197,2,172,0,34,2,48,0,0,1,7,7,186,1,199,0,45,0,8,177,1,2,176,45,176,51,43,0,0,0,1,0,18,255,245,2,251,1,249,0,89,1,41,64,21,79,43,2,9,7,85,37,2,1,9,30,0,2,3,2,3,74,64,1,8,72,75,176,8,80,88,64,54,12,1,9,4,1,1,2,9,1,101,0,10,10,8,95,13,11,2,8,8,38,75,14,1,7,7,8,95,13,11,2,8,8,38,75,15,6,2,2,2,3,93,0,3,3,39,75,5,1,0,0,39,0,76,27,75,176,12,80,88,64,54,12,1,9,4,1,1,2,9,1,101,0,10,10,8,95,13,11,2,8,8,38,75,14,1,7,7,8,95,13,11,2,8,8,38,75,15,6,2,2,2,3,93,0,3,3,39,75,5,1,0,0,41,0,76,27,75,176,14,80,88,64,54,12,1,9,4,1,1,2,9,1,101,0,10,10,8,95,13,11,2,8,8,38,75,14,1,7,7,8,95,13,11,2,8,8,38,75,15,6,2,2,2,3,93,0,3,3,39,75,5,1,0,0,39,0,76,27,64,54,12,1,9,4,1,1,2,9,1,101,0,10,10,8,95,13,11,2,8,8,38,75,14,1,7,7,8,95,13,11,2,8,8,38,75,15,6,2,2,2,3,93,0,3,3,39,75,5,1,0,0,41,0,76,89,89,89,64,26,89,88,82,80,74,73,70,69,63,59,57,55,52,51,21,40,19,18,21,68,35,18,18,16,7,29,43,37,7,7,34,39,39,35,7,6,22,51,50,54,51,23,7,35,38,35,7,55,54,54,53,53,35,7,6,35,39,39,55,50,54,55,55,54,55,39,38,38,35,34,7,39,38,54,55,50,22,23,23,51,53,52,38,35,7,39,55,50,22,51,50,55,7,6,6,7,7,51,55,54,54,51,22,21,20,7,7,38,35,34,6,7,7,23,22,22,51,2,251,5,76,45,44,102,64,4,1,15,21,13,22,1,2,7,20,48,38,99,8,37,23,63,102,44,45,75,5,4,30,47,21,73,24,22,66,20,38,28,19,29,9,2,11,13,54,68,38,74,67,12,18,27,3,6,7,51,38,25,70,4,31,22,1,4,66,74,39,68,54,22,1,8,29,19,28,40,19,58,110,22,48,30,29,31,9,73,167,136,31,22,2,4,40,2,1,40,4,23,33,130,167,73,9,31,5,33,33,110,34,14,104,31,30,9,7,25,46,13,49,62,119,142,25,17,1,4,38,2,7,41,5,20,22,142,119,62,49,21,47,11,5,7,9,30,31,91,171,33,33,0,0,0,0,1,0,68,255,247,1,151,1,247,0,48,0,126,64,19,29,1,3,4,41,17,2,2,3,6,1,1,0,2,1,6,1,4,74,75,176,8,80,88,64,38,0,0,2,1,2,0,1,126,0,3,0,2,0,3,2,101,0,4,4,5,95,0,5,5,38,75,0,1,1,6,95,7,1,6,6,39,6,76,27,64,38,0,0,2,1,2,0,1,126,0,3,0,2,0,3,2,101,0,4,4,5,95,0,5,5,38,75,0,1,1,6,95,7,1,6,6,41,6,76,89,64,15,0,0,0,48,0,47,41,37,18,19,34,23,8,7,26,43,22,39,39,54,53,52,39,55,51,6,22,51,50,53,52,39,7,39,55,23,54,54,53,52,38,35,34,6,7,7,54,53,52,39,55,54,51,50,22,21,20,7,22,22,21,20,6,6,35,138,66,4,2,1,27,24,2,48,53,102,90,73,5,7,90,24,26,47,44,42,38,4,51,6,1,5,73,56,82,86,87,56,57,55,99,63,9,14,6,37,45,32,18,6,55,51,89,78,19,3,5,51,2,13,47,29,40,43,43,56,5,39,59,25,12,6,14,59,56,83,41,14,61,44,45,70,39,0,0,1,0,54,255,248,2,74,1,249,0,82,0,66,64,63,62,39,2,4,5,73,55,53,13,11,5,1,4,20,0,2,0,1,3,74,69,46,2,5,72,6,1,4,4,5,95,7,1,5,5,38,75,8,2,2,1,1,0,93,3,1,0,0,39,0,76,43,54,29,69,24,84,40,17,65,9,7,29,43,37,7,34,38,35,7,55,62,2,53,55,6,7,22,22,51,50,54,51,23,7,34,38,35,34,6,7,55,54,54,55,19,52,38,35,34,6,35,39,55,50,22,51,50,54,55,7,14,2,7,6,7,54,55,38,38,35,34,6,35,39,55,22,22,51,50,54,55,7,6,6,7,6,6,21,20,22,51,50,54,51,2,74,8,11,61,33,100,7,26,26,10,1,128,122,1,15,19,12,20,3,2,7,8,45,25,36,89,1,5,37,25,1,1,12,19,8,16,3,2,6,10,55,28,23,64,10,4,24,20,7,1,8,1,117,132,1,12,18,8,16,3,2,6,9,52,25,24,69,11,3,31,19,2,4,7,14,21,12,20,3,38,40,2,1,40,1,12,33,33,233,131,140,23,17,2,4,40,2,6,2,40,7,27,33,1,62,25,17,2,5,38,2,6,1,41,4,11,24,27,142,104,118,152,22,15,2,5,38,1,1,6,1,41,4,17,23,79,195,53,32,21,2,0,255,255,0,54,255,248,2,74,2,189,0,34,3,234,0,0,1,7,8,41,2,0,0,46,0,8,177,1,1,176,46,176,51,43,0,0,255,255,0,54,255,248,2,74,2,248,0,34,3,234,0,0,1,7,7,193,2,8,0,46,0,8,177,1,1,176,46,176,51,43,0,0,0,1,0,54,255,245,2,21,1,249,0,59,0,255,64,19,49,1,6,8,55,1,1,6,14,0,2,3,2,3,74,35,1,5,72,75,176,8,80,88,64,47,0,6,0,1,2,6,1,101,0,4,4,5,95,7,1,5,5,38,75,0,8,8,5,95,7,1,5,5,38,75,9,1,2,2,3,93,0,3,3,39,75,0,0,0,39,0,76,27,75,176,12,80,88,64,47,0,6,0,1,2,6,1,101,0,4,4,5,95,7,1,5,5,38,75,0,8,8,5,95,7,1,5,5,38,75,9,1,2,2,3,93,0,3,3,39,75,0,0,0,41,0,76,27,75,176,14,80,88,64,47,0,6,0,1,2,6,1,101,0,4,4,5,95,7,1,5,5,38,75,0,8,8,5,95,7,1,5,5,38,75,9,1,2,2,3,93,0,3,3,39,75,0,0,0,39,0,76,27,64,47,0,6,0,1,2,6,1,101,0,4,4,5,95,7,1,5,5,38,75,0,8,8,5,95,7,1,5,5,38,75,9,1,2,2,3,93,0,3,3,39,75,0,0,0,41,0,76,89,89,89,64,14,59,58,37,19,22,66,39,68,35,18,18,10,7,29,43,37,7,7,34,39,39,35,7,6,22,51,50,54,51,23,7,34,38,35,7,55,54,54,53,17,54,38,35,7,39,55,50,22,51,50,55,7,6,6,7,7,23,55,54,54,51,22,22,7,7,38,35,34,6,7,7,23,22,22,51,2,21,5,75,44,46,102,64,4,1,15,22,12,20,3,3,8,6,56,44,99,8,37,24,1,13,18,27,2,6,6,51,38,32,63,3,31,22,1,4,66,73,39,69,54,13,10,2,9,27,21,28,40,19,57,110,22,47,30,29,31,9,73,167,136,31,22,2,4,40,2,1,40,4,23,32,1,63,25,17,1,4,38,2,7,41,5,19,22,138,4,118,62,49,13,46,25,7,9,30,31,90,172,33,33,0,0,255,255,0,54,255,245,2,21,2,249,0,34,3,237,0,0,1,7,7,194,1,205,0,46,0,8,177,1,1,176,46,176,51,43,0,0,0,1,0,20,255,244,2,0,1,247,0,47,0,51,64,48,39,21,2,4,1,1,74,35,1,3,72,18,1,0,71,2,1,1,1,3,93,0,3,3,38,75,0,4,4,0,93,0,0,0,39,0,76,46,44,34,32,30,29,39,49,5,7,22,43,37,7,38,35,35,55,54,54,53,19,52,38,35,35,7,14,2,7,38,38,39,55,62,2,55,55,54,38,7,39,55,33,50,55,7,6,6,7,6,6,21,20,22,51,50,55,2,0,7,60,51,99,6,35,27,1,17,21,79,20,11,36,62,55,13,25,5,7,50,54,31,10,14,3,38,53,2,6,1,48,60,40,4,34,21,2,5,6,14,21,23,18,38,40,2,39,3,24,30,1,57,22,17,178,97,108,59,18,12,46,19,10,8,41,87,82,115,27,20,1,5,39,5,41,4,17,21,76,191,60,32,21,2,0,0,255,255,0,45,255,242,2,157,1,247,0,2,2,121,0,0,255,255,0,54,255,247,2,74,1,249,0,2,2,82,0,0,255,255,0,41,255,247,2,32,1,251,0,2,2,133,0,0,255,255,0,53,255,248,2,48,1,249,0,2,5,142,0,0,255,255,0,58,255,250,1,197,1,245,0,2,2,169,0,0,255,255,0,41,255,247,1,228,1,251,0,2,2,34,0,0,255,255,0,17,255,252,1,199,1,251,0,2,2,192,0,0,255,255,255,253,255,247,1,223,1,248,0,2,2,235,0,0,255,255,255,253,255,247,1,223,2,188,0,34,2,235,0,0,1,7,8,41,1,174,0,45,0,8,177,1,1,176,45,176,51,43,0,0,255,255,0,36,255,224,2,62,2,16,0,2,5,148,0,0,255,255,0,20,255,250,2,38,1,248,0,2,2,234,0,0,0,1,0,19,255,254,1,217,1,249,0,58,0,70,64,67,49,39,34,20,4,5,3,10,1,2,5,0,1,0,1,3,74,45,41,25,3,4,72,0,5,0,2,1,5,2,103,6,1,3,3,4,95,7,1,4,4,38,75,8,1,1,1,0,93,0,0,0,39,0,76,42,36,20,24,35,21,37,17,49,9,7,29,43,37,7,38,35,7,55,62,2,53,53,6,35,34,38,53,53,52,38,35,7,39,55,23,50,55,7,14,2,21,21,20,23,55,53,52,38,35,7,39,55,22,51,50,55,7,6,6,7,6,6,21,20,22,51,50,54,51,1,217,7,58,48,106,7,29,29,11,56,43,76,87,10,15,22,2,4,84,29,67,4,24,21,7,111,72,11,18,27,3,6,10,76,30,74,3,31,19,2,5,7,15,21,10,19,6,38,40,2,1,40,1,12,33,34,90,14,73,67,84,23,17,2,5,38,2,7,41,4,11,24,26,45,110,2,15,160,25,17,2,5,38,2,7,41,4,17,23,82,192,55,30,21,2,0,0,0,0,1,0,51,255,134,2,55,1,249,0,62,0,58,64,55,45,18,2,3,1,62,1,0,3,2,74,51,24,2,2,72,8,0,2,0,71,4,1,1,1,2,95,5,1,2,2,38,75,6,1,3,3,0,93,0,0,0,39,0,76,41,52,22,58,51,25,52,7,7,27,43,5,7,39,38,38,35,33,34,7,55,62,2,53,19,52,38,35,7,39,55,22,51,50,55,7,14,2,7,6,21,20,22,51,51,50,54,54,53,19,52,38,35,34,7,39,55,22,51,50,55,7,6,6,7,6,21,20,22,31,2,2,55,50,7,4,39,42,254,238,28,72,4,27,25,9,1,12,19,27,2,6,46,23,67,60,3,27,24,8,1,9,17,23,117,30,31,12,1,12,20,5,20,3,6,46,21,66,57,4,30,20,1,12,12,15,46,6,118,4,63,35,24,7,41,5,12,23,24,1,63,25,17,2,5,38,2,7,41,4,10,24,28,223,83,25,20,11,28,30,1,46,24,17,2,5,38,2,7,41,5,17,22,234,95,24,18,1,2,8,0,0,0,0,1,0,62,255,249,3,65,1,249,0,85,0,62,64,59,62,35,9,3,2,0,1,74,68,41,15,3,1,72,85,1,9,71,6,3,2,0,0,1,95,7,4,2,1,1,38,75,8,5,2,2,2,9,93,0,9,9,39,9,76,84,80,41,52,22,58,51,22,58,51,23,10,7,29,43,55,62,2,55,19,52,38,35,7,39,55,22,51,50,55,7,14,2,7,6,21,20,22,51,51,50,54,54,53,17,52,38,35,7,39,55,22,51,50,55,7,14,2,7,6,21,20,22,51,51,50,54,54,53,19,52,38,35,34,7,39,55,22,51,50,55,7,6,6,7,6,21,20,22,51,55,23,7,38,35,33,34,7,66,27,24,8,1,2,12,19,27,2,6,46,23,67,60,4,27,23,8,1,9,17,23,100,30,31,13,12,18,27,2,6,46,22,67,60,3,27,23,8,1,10,18,22,101,30,31,12,1,12,20,5,20,2,6,44,23,66,56,3,30,21,1,11,12,19,32,3,6,54,48,253,205,28,72,34,5,12,23,25,1,62,25,17,2,5,38,2,7,41,4,10,24,28,223,83,25,20,11,29,30,1,44,25,17,2,5,38,2,7,41,4,10,24,28,200,106,25,20,11,28,30,1,46,24,17,2,5,38,2,7,41,5,17,22,214,115,33,19,2,5,38,2,7,0,0,1,0,51,255,134,3,67,1,249,0,88,0,67,64,64,72,45,19,3,3,1,0,1,0,3,2,74,78,51,25,3,2,72,9,1,2,0,71,7,4,2,1,1,2,95,8,5,2,2,2,38,75,9,6,2,3,3,0,93,0,0,0,39,0,76,88,86,52,22,58,51,22,58,51,25,53,10,7,29,43,37,21,7,39,38,38,35,33,34,7,55,62,2,55,19,52,38,35,7,39,55,22,51,50,55,7,14,2,7,6,21,20,22,51,51,50,54,54,53,17,52,38,35,7,39,55,22,51,50,55,7,14,2,7,6,21,20,22,51,51,50,54,54,53,19,52,38,35,34,7,39,55,22,51,50,55,7,6,6,7,6,21,20,22,23,23,3,67,49,7,4,40,42,253,226,28,72,4,27,24,8,1,2,12,19,27,2,6,46,23,67,60,4,27,23,8,1,9,17,23,100,30,31,13,12,18,27,2,6,46,22,67,60,3,27,23,8,1,10,18,22,101,30,31,12,1,12,20,5,20,2,6,44,23,66,56,3,30,21,1,11,11,15,46,38,156,4,63,35,24,7,41,5,12,23,25,1,62,25,17,2,5,38,2,7,41,4,10,24,28,223,83,25,20,11,29,30,1,44,25,17,2,5,38,2,7,41,4,10,24,28,200,106,25,20,11,28,30,1,46,24,17,2,5,38,2,7,41,5,17,22,214,115,25,17,1,2,0,0,0,1,0,50,255,111,2,42,1,249,0,69,0,63,64,60,54,27,2,4,2,1,74,60,33,2,3,72,17,10,8,3,0,71,5,1,2,2,3,95,6,1,3,3,38,75,8,7,2,4,4,0,95,1,1,0,0,39,0,76,0,0,0,69,0,68,52,22,58,51,25,55,66,9,7,27,43,37,23,7,38,35,35,34,6,15,2,39,38,38,35,35,34,7,55,62,2,55,19,52,38,35,7,39,55,22,51,50,55,7,14,2,7,6,21,20,22,51,51,50,54,54,53,17,52,38,35,34,7,39,55,22,51,50,55,7,6,6,7,6,21,20,22,51,2,39,2,6,54,47,77,21,17,1,8,46,8,3,20,33,62,26,74,4,27,24,8,1,2,12,19,27,2,6,46,21,66,63,3,27,24,8,1,9,17,23,117,31,31,12,12,20,5,20,2,6,46,22,67,55,4,30,21,1,11,12,19,41,5,38,2,15,22,104,4,97,30,18,7,41,5,12,23,25,1,62,25,17,2,5,38,2,7,41,4,10,24,28,218,88,25,20,11,30,29,1,45,24,17,2,5,38,2,7,41,5,17,22,224,105,31,21,0,0,0,2,0,53,255,247,1,197,1,249,0,33,0,44,0,128,75,176,30,80,88,183,20,1,2,72,5,1,0,71,27,183,20,1,2,72,5,1,4,71,89,75,176,30,80,88,64,32,0,3,0,5,6,3,5,101,0,1,1,2,95,0,2,2,38,75,8,1,6,6,0,95,7,4,2,0,0,39,0,76,27,64,36,0,3,0,5,6,3,5,101,0,1,1,2,95,0,2,2,38,75,0,0,0,39,75,8,1,6,6,4,95,7,1,4,4,39,4,76,89,64,21,34,34,0,0,34,44,34,43,40,39,0,33,0,32,38,50,40,34,9,7,24,43,22,39,38,35,34,7,55,54,54,53,19,52,38,35,7,39,55,22,51,50,55,7,6,6,7,7,51,50,22,21,20,6,6,35,54,54,53,52,38,39,7,7,6,22,51,246,36,38,21,30,68,5,36,26,1,12,17,32,2,6,46,24,72,59,4,34,26,1,5,81,82,95,49,87,53,55,50,47,50,79,3,1,40,45,8,4,4,9,42,7,27,32,1,62,25,17,2,5,38,2,7,41,5,17,21,140,73,64,43,69,40,49,48,43,46,48,8,5,136,28,24,0,0,0,0,2,0,17,255,248,1,252,1,251,0,37,0,48,0,67,64,64,18,1,3,1,1,74,21,20,2,2,72,0,3,0,5,6,3,5,101,0,1,1,2,93,0,2,2,38,75,8,1,6,6,0,95,7,4,2,0,0,39,0,76,38,38,0,0,38,48,38,47,44,43,0,37,0,36,37,40,39,50,9,7,24,43,4,39,38,35,34,7,55,54,54,53,17,52,38,35,14,2,7,7,54,55,55,23,23,55,7,6,6,21,7,51,50,22,21,20,6,6,35,54,54,53,52,38,39,7,7,6,22,51,1,50,36,38,21,21,92,6,46,32,11,15,39,33,14,7,46,7,4,8,69,108,111,3,34,25,4,77,80,93,48,85,52,53,49,46,48,76,3,1,38,44,8,4,4,4,40,5,25,34,1,61,22,16,1,12,37,47,4,64,82,7,8,1,5,41,3,18,20,140,73,64,43,69,40,49,48,43,45,49,8,5,136,28,24,0,3,0,53,255,247,2,179,1,249,0,33,0,71,0,82,0,170,75,176,30,80,88,64,20,54,1,3,1,64,1,0,7,2,74,50,20,2,2,72,71,5,2,0,71,27,64,20,54,1,3,1,64,1,0,7,2,74,50,20,2,2,72,71,5,2,4,71,89,75,176,30,80,88,64,36,0,3,0,9,7,3,9,101,5,1,1,1,2,95,6,1,2,2,38,75,12,10,2,7,7,0,95,8,11,4,3,0,0,39,0,76,27,64,40,0,3,0,9,7,3,9,101,5,1,1,1,2,95,6,1,2,2,38,75,0,0,0,39,75,12,10,2,7,7,4,95,8,11,2,4,4,39,4,76,89,64,29,72,72,0,0,72,82,72,81,78,77,69,65,61,59,48,44,42,40,0,33,0,32,38,50,40,34,13,7,24,43,22,39,38,35,34,7,55,54,54,53,19,52,38,35,7,39,55,22,51,50,55,7,6,6,7,7,51,50,22,21,20,6,6,35,55,54,54,53,19,52,38,35,7,39,55,50,22,51,50,54,55,7,6,6,7,6,6,21,20,22,51,50,54,55,23,7,34,38,35,34,6,7,38,54,53,52,38,39,7,7,6,22,51,240,36,36,21,30,64,5,34,24,1,11,17,29,2,5,46,22,70,57,3,32,25,1,5,76,78,90,47,82,51,222,38,26,1,12,18,33,2,5,6,53,43,23,67,10,4,33,22,2,4,7,14,21,14,23,4,2,7,12,66,33,27,63,10,167,46,44,45,73,3,1,36,41,8,4,4,9,42,7,27,32,1,62,25,17,2,5,38,2,7,41,5,17,21,140,73,63,43,70,40,40,7,27,33,1,62,25,17,1,4,38,2,6,1,41,4,17,23,80,194,53,32,22,2,1,4,40,2,7,2,50,48,44,45,48,8,5,136,28,24,0,0,2,0,20,255,244,2,188,1,249,0,49,0,60,0,125,64,15,29,1,7,6,1,74,43,1,4,72,26,12,2,0,71,75,176,30,80,88,64,33,8,1,5,0,6,7,5,6,101,3,1,2,2,4,93,0,4,4,38,75,9,1,7,7,0,95,1,1,0,0,39,0,76,27,64,37,8,1,5,0,6,7,5,6,101,3,1,2,2,4,93,0,4,4,38,75,0,1,1,39,75,9,1,7,7,0,95,0,0,0,39,0,76,89,64,24,50,50,0,0,50,60,50,59,56,55,0,49,0,48,42,40,38,37,40,34,37,10,7,23,43,0,22,21,20,6,6,35,34,39,38,35,34,7,55,54,54,53,19,52,38,35,39,7,14,2,7,38,38,39,55,62,2,55,55,54,38,7,39,55,33,50,55,7,6,6,7,7,51,22,54,53,52,38,39,7,7,6,22,51,2,91,97,51,88,54,19,36,40,21,30,69,5,37,27,1,17,21,77,20,11,36,62,55,13,25,5,7,50,54,31,10,14,3,38,53,2,6,1,20,72,57,3,35,26,1,6,83,45,52,49,51,81,4,1,40,47,1,25,73,64,43,69,40,4,4,9,42,7,27,32,1,57,19,17,1,179,97,108,59,18,12,46,19,10,8,41,87,82,115,27,20,1,5,39,7,41,5,17,21,140,240,48,43,46,48,8,5,136,28,24,0,0,2,0,54,255,247,3,12,1,249,0,75,0,86,0,145,64,21,43,1,7,5,26,20,2,3,2,2,74,69,49,2,6,72,34,12,2,0,71,75,176,30,80,88,64,38,13,10,2,7,11,1,2,3,7,2,101,8,1,5,5,6,95,9,1,6,6,38,75,14,12,2,3,3,0,95,4,1,2,0,0,39,0,76,27,64,42,13,10,2,7,11,1,2,3,7,2,101,8,1,5,5,6,95,9,1,6,6,38,75,0,1,1,39,75,14,12,2,3,3,0,95,4,1,0,0,39,0,76,89,64,28,76,76,0,0,76,86,76,85,82,81,0,75,0,74,68,65,35,55,51,25,67,36,38,34,37,15,7,29,43,0,22,21,20,6,6,35,34,39,38,35,34,7,55,54,54,53,53,39,34,7,7,6,22,51,50,55,23,7,34,38,35,34,6,7,55,54,54,53,19,52,38,35,7,39,55,22,51,50,55,7,14,2,7,7,23,50,55,53,52,38,35,7,39,55,22,51,50,55,7,6,6,7,7,51,22,54,53,52,38,39,7,7,6,22,51,2,170,98,51,88,54,18,36,40,22,28,71,5,37,28,116,22,108,3,1,15,20,18,18,2,8,5,42,30,34,84,8,5,38,25,1,12,19,27,2,6,52,41,31,65,3,24,20,8,1,5,130,42,74,13,18,33,2,6,46,23,72,64,4,36,25,1,5,82,45,53,49,52,81,3,1,40,46,1,25,73,64,43,69,40,4,4,9,42,7,27,31,132,1,8,130,31,22,2,4,40,2,6,2,40,8,26,32,1,63,25,17,2,5,38,2,7,41,4,10,25,27,121,1,3,138,25,17,2,5,38,2,7,41,5,17,21,140,240,48,43,45,49,8,5,136,28,24,0,255,255,0,53,255,247,1,144,1,251,0,2,2,180,0,0,0,1,0,41,255,248,1,204,1,251,0,44,0,62,64,59,39,1,0,5,43,10,9,0,4,1,0,23,1,3,2,27,1,4,3,4,74,0,1,0,2,3,1,2,101,0,0,0,5,95,0,5,5,38,75,0,3,3,4,95,0,4,4,39,4,76,36,42,34,67,18,35,6,7,26,43,1,54,38,38,35,34,6,7,22,55,23,7,38,35,34,7,22,22,51,50,54,54,55,55,6,21,20,23,7,6,35,34,38,53,52,54,51,50,23,23,6,21,20,23,7,1,156,1,18,44,42,90,87,4,116,128,4,12,51,56,54,74,7,91,80,40,42,19,5,47,4,1,4,82,68,127,135,158,137,58,62,4,1,1,39,1,99,40,42,17,85,91,2,10,5,53,3,4,90,91,18,44,42,4,31,58,33,16,6,18,124,118,129,144,13,6,30,45,38,17,6,0,0,0,0,1,0,68,255,248,1,231,1,251,0,44,0,63,64,60,43,1,5,0,39,1,4,5,26,25,16,15,14,5,2,3,10,1,1,2,4,74,0,4,0,3,2,4,3,103,0,5,5,0,95,0,0,0,38,75,0,2,2,1,95,0,1,1,39,1,76,34,67,18,43,36,32,6,7,26,43,18,51,50,22,21,20,6,35,34,39,39,54,53,52,39,55,23,6,22,22,51,50,54,55,38,7,39,55,22,51,50,55,38,38,35,34,6,6,7,7,54,53,52,39,55,158,67,127,135,158,138,56,63,4,2,2,39,9,1,18,45,41,93,87,1,116,128,4,12,49,57,55,72,9,89,78,40,42,19,5,47,4,1,4,1,251,124,118,129,144,12,6,62,15,24,32,6,3,40,43,18,89,98,2,10,5,53,3,4,84,86,17,42,42,5,32,56,32,16,6,0,0,0,255,255,0,53,255,247,1,15,1,249,0,2,2,87,0,0,255,255,0,33,255,247,1,34,2,172,0,34,2,87,0,0,1,7,7,186,1,105,0,45,0,8,177,1,2,176,45,176,51,43,0,0,255,255,0,27,255,141,0,245,1,249,0,2,2,106,0,0,0,1,0,17,255,253,2,41,1,251,0,63,0,82,64,79,36,1,8,6,52,1,1,8,13,1,2,1,0,1,0,2,4,74,43,42,39,38,4,5,72,0,6,4,8,4,6,8,126,0,8,0,1,2,8,1,103,7,1,4,4,5,93,0,5,5,38,75,9,1,2,2,0,93,3,1,0,0,39,0,76,62,60,35,19,20,24,22,50,53,23,49,10,7,29,43,37,7,39,34,7,55,62,2,55,55,54,39,7,6,21,20,22,51,50,55,23,7,39,34,7,55,62,2,53,17,14,2,7,7,54,55,55,23,33,55,23,22,23,7,46,2,39,6,7,54,51,50,22,21,21,20,22,51,50,55,2,41,5,86,35,56,4,23,20,8,1,1,2,115,66,2,15,24,7,22,3,7,104,40,63,7,32,26,8,52,40,15,7,46,9,3,7,72,1,4,73,8,1,10,46,9,19,52,75,6,3,51,42,76,86,9,18,12,7,38,40,3,3,41,3,9,24,27,39,107,2,14,100,44,31,21,2,3,41,2,3,40,3,11,28,35,1,87,2,11,36,50,4,81,65,7,8,8,7,64,76,3,52,35,11,2,47,124,12,72,65,77,27,16,1,0,0,2,0,54,255,247,3,34,1,252,0,54,0,67,1,232,75,176,8,80,88,64,18,40,1,5,7,34,1,6,4,19,1,2,1,25,1,0,2,4,74,27,75,176,10,80,88,64,18,34,1,6,4,19,1,2,1,25,1,0,2,3,74,40,1,5,72,27,75,176,11,80,88,64,18,40,1,5,7,34,1,6,4,19,1,2,1,25,1,0,2,4,74,27,75,176,27,80,88,64,18,34,1,6,4,19,1,2,1,25,1,0,2,3,74,40,1,5,72,27,75,176,30,80,88,64,18,40,1,5,7,34,1,6,4,19,1,2,1,25,1,0,2,4,74,27,64,18,40,1,5,7,34,1,8,4,19,1,2,1,25,1,0,3,4,74,89,89,89,89,89,75,176,8,80,88,64,45,0,6,0,1,2,6,1,101,8,1,4,4,7,95,10,1,7,7,38,75,8,1,4,4,5,93,0,5,5,38,75,11,9,2,2,2,0,95,3,1,0,0,39,0,76,27,75,176,10,80,88,64,35,0,6,0,1,2,6,1,101,8,1,4,4,5,95,10,7,2,5,5,38,75,11,9,2,2,2,0,95,3,1,0,0,41,0,76,27,75,176,11,80,88,64,45,0,6,0,1,2,6,1,101,8,1,4,4,7,95,10,1,7,7,38,75,8,1,4,4,5,93,0,5,5,38,75,11,9,2,2,2,0,95,3,1,0,0,41,0,76,27,75,176,27,80,88,64,35,0,6,0,1,2,6,1,101,8,1,4,4,5,95,10,7,2,5,5,38,75,11,9,2,2,2,0,95,3,1,0,0,41,0,76,27,75,176,30,80,88,64,45,0,6,0,1,2,6,1,101,8,1,4,4,7,95,10,1,7,7,38,75,8,1,4,4,5,93,0,5,5,38,75,11,9,2,2,2,0,95,3,1,0,0,41,0,76,27,64,54,0,6,0,1,2,6,1,101,0,4,4,5,93,0,5,5,38,75,0,8,8,7,95,10,1,7,7,38,75,11,9,2,2,2,3,93,0,3,3,39,75,11,9,2,2,2,0,95,0,0,0,41,0,76,89,89,89,89,89,64,24,55,55,0,0,55,67,55,66,61,59,0,54,0,53,71,51,24,51,35,35,38,12,7,27,43,0,22,22,21,20,6,6,35,34,38,38,39,34,7,7,6,22,51,50,55,23,7,38,35,34,7,55,54,54,53,19,52,38,35,7,39,55,22,51,50,55,7,14,2,7,7,22,51,50,55,62,2,51,18,54,53,52,38,35,34,6,21,20,22,22,51,2,130,103,57,69,122,76,66,101,56,1,58,57,3,1,15,20,18,18,2,8,62,19,62,60,5,38,25,1,12,19,27,2,6,52,41,42,54,3,24,20,8,1,5,17,33,44,23,9,71,112,68,55,86,92,75,69,84,41,74,48,1,252,60,110,72,78,126,71,59,108,71,3,133,31,22,2,4,40,2,8,40,8,26,32,1,63,25,17,2,5,38,2,7,41,4,10,25,27,121,1,1,67,105,59,254,44,104,86,101,120,104,86,67,100,54,0,0,0,2,0,16,255,244,1,226,1,249,0,49,0,60,0,164,64,19,24,1,1,6,18,1,0,4,16,6,2,2,0,3,74,36,1,3,72,75,176,8,80,88,64,35,7,1,6,0,1,4,6,1,101,0,5,5,3,93,0,3,3,38,75,0,4,4,0,93,0,0,0,39,75,0,2,2,41,2,76,27,75,176,10,80,88,64,35,7,1,6,0,1,4,6,1,101,0,5,5,3,93,0,3,3,38,75,0,4,4,0,93,0,0,0,39,75,0,2,2,39,2,76,27,64,35,7,1,6,0,1,4,6,1,101,0,5,5,3,93,0,3,3,38,75,0,4,4,0,93,0,0,0,39,75,0,2,2,41,2,76,89,89,64,15,50,50,50,60,50,60,36,44,110,18,22,65,8,7,26,43,37,7,39,38,35,34,7,55,54,54,55,53,35,7,6,35,39,39,55,54,54,55,55,54,55,38,38,53,52,54,51,50,23,22,51,50,55,7,14,2,7,6,6,21,20,22,22,51,55,39,55,38,38,35,34,6,21,20,22,23,1,226,8,59,20,33,72,27,5,38,26,1,72,75,40,42,85,3,5,36,43,23,48,19,22,59,65,109,88,13,32,30,16,46,53,3,25,21,8,2,3,10,6,14,16,41,147,1,1,30,31,50,54,49,45,38,40,1,1,8,40,8,26,32,101,138,73,8,5,31,4,29,34,73,32,12,15,72,51,66,82,2,2,7,41,4,8,15,17,33,237,49,27,25,9,2,203,168,23,22,49,45,43,60,12,0,0,0,0,1,0,17,255,121,1,253,1,251,0,54,0,84,64,81,36,1,7,5,52,1,0,7,13,1,1,0,3,74,43,42,39,38,4,4,72,7,5,2,2,71,0,5,3,7,3,5,7,126,8,1,7,0,0,1,7,0,103,6,1,3,3,4,93,0,4,4,38,75,0,1,1,2,93,0,2,2,39,2,76,0,0,0,54,0,53,19,20,24,22,50,53,27,9,7,27,43,0,22,21,20,6,7,39,39,54,54,53,52,39,7,6,21,20,22,51,50,55,23,7,39,34,7,55,62,2,53,17,14,2,7,7,54,55,55,23,33,55,23,22,23,7,46,2,39,6,7,54,51,1,165,88,110,105,6,12,77,74,111,67,2,15,24,7,22,3,7,104,40,63,7,32,26,8,52,40,15,7,46,9,3,7,72,1,4,73,8,1,10,46,9,19,52,75,6,3,53,40,1,41,77,70,92,147,46,4,25,45,118,77,113,3,14,100,44,31,21,2,3,41,2,3,40,3,12,34,41,1,74,2,11,36,50,4,81,65,7,8,8,7,64,76,3,52,35,11,2,47,125,12,0,0,2,0,51,255,249,2,41,2,43,0,57,0,69,0,94,64,91,48,47,27,26,4,3,4,24,1,9,7,2,74,40,1,5,72,0,7,2,9,2,7,9,126,0,5,0,4,3,5,4,103,6,1,3,8,1,2,7,3,2,103,12,1,9,0,10,11,9,10,101,13,1,11,11,0,95,1,1,0,0,39,0,76,58,58,0,0,58,69,58,68,64,63,0,57,0,56,19,20,22,50,35,24,22,51,37,14,7,29,43,0,22,21,20,6,6,35,34,38,39,38,35,34,7,55,62,2,53,17,14,2,7,7,54,55,55,23,51,53,52,38,35,7,39,55,22,51,50,55,7,6,6,7,7,51,55,23,22,23,7,46,2,39,7,51,22,54,53,52,38,39,7,6,21,20,22,51,1,201,96,50,88,55,18,27,9,38,23,31,80,7,36,29,9,55,40,16,7,46,9,3,7,72,73,12,18,32,3,6,60,42,16,84,4,32,23,1,1,104,74,8,2,9,46,9,20,53,72,6,85,44,53,48,53,82,2,39,47,1,4,67,59,40,64,37,2,1,4,4,40,3,12,31,37,1,38,1,10,33,46,4,74,64,7,8,12,25,17,2,4,39,2,6,41,4,17,22,15,8,7,64,67,3,45,33,10,2,153,218,42,38,40,43,8,5,90,29,25,22,0,0,2,0,18,255,247,2,182,1,244,0,71,0,88,0,141,64,17,84,1,8,11,39,22,1,3,0,2,2,74,47,1,8,1,73,75,176,8,80,88,64,43,10,1,8,11,1,11,8,1,126,4,1,1,2,11,1,2,124,12,1,11,11,7,93,0,7,7,38,75,9,6,2,2,2,0,96,5,3,2,0,0,39,0,76,27,64,43,10,1,8,11,1,11,8,1,126,4,1,1,2,11,1,2,124,12,1,11,11,7,93,0,7,7,38,75,9,6,2,2,2,0,96,5,3,2,0,0,41,0,76,89,64,22,72,72,72,88,72,86,81,80,71,70,23,61,19,21,25,50,37,36,18,13,7,29,43,37,7,7,34,39,39,38,38,35,35,6,6,21,20,22,51,55,23,7,39,39,34,7,55,62,2,53,53,52,39,34,6,7,7,6,6,35,39,39,55,54,54,55,55,54,54,55,39,46,2,39,39,55,23,33,55,23,7,14,2,7,7,22,22,23,23,22,22,23,0,6,21,20,22,22,23,22,23,51,55,54,53,52,38,35,35,2,182,5,73,42,46,86,7,14,11,11,5,2,14,20,39,3,8,50,59,45,52,6,28,25,9,10,14,13,9,93,27,41,19,73,5,4,27,43,24,74,24,36,29,72,26,28,32,33,2,5,100,1,94,93,5,6,27,29,29,28,84,31,36,17,74,20,47,29,254,84,11,36,40,6,26,5,10,106,28,12,14,206,32,32,9,72,135,11,8,13,47,65,31,21,2,5,41,2,2,5,41,5,13,29,31,49,34,20,7,13,134,38,34,10,31,5,1,30,33,103,34,27,3,105,37,30,14,6,3,37,2,2,4,36,8,16,29,35,103,1,23,28,117,31,31,2,1,168,7,8,10,56,56,9,36,9,128,34,14,8,7,0,0,0,0,3,0,41,255,247,2,32,1,251,0,15,0,23,0,31,0,104,75,176,8,80,88,64,32,0,2,0,4,5,2,4,101,7,1,3,3,1,95,6,1,1,1,38,75,8,1,5,5,0,95,0,0,0,39,0,76,27,64,32,0,2,0,4,5,2,4,101,7,1,3,3,1,95,6,1,1,1,38,75,8,1,5,5,0,95,0,0,0,41,0,76,89,64,26,24,24,16,16,0,0,24,31,24,30,28,26,16,23,16,22,20,18,0,15,0,14,38,9,7,21,43,0,22,22,21,20,6,6,35,34,38,38,53,52,54,54,51,6,6,7,23,55,38,38,35,18,54,55,34,7,22,22,51,1,124,106,58,72,125,77,68,104,57,71,123,76,97,88,5,182,156,11,94,70,84,92,2,187,152,9,92,70,1,251,60,109,72,78,125,72,60,110,72,77,126,71,55,96,81,1,3,81,94,254,98,101,84,2,84,99,0,0,1,0,4,255,243,1,246,1,250,0,34,0,52,64,49,1,1,0,1,1,74,22,21,2,2,72,28,9,2,3,0,71,3,1,1,1,2,95,4,1,2,2,38,75,0,0,0,2,95,4,1,2,2,38,0,76,25,19,66,24,35,5,7,25,43,0,7,7,38,35,34,6,7,3,7,38,3,38,38,39,39,55,23,22,51,50,55,23,7,6,6,21,20,19,51,19,62,2,51,1,246,2,7,18,6,22,24,15,120,74,40,96,8,34,30,2,6,57,16,24,38,90,3,3,44,28,96,8,96,16,29,40,36,1,212,41,7,2,29,41,254,164,17,139,1,31,23,21,1,4,38,1,1,8,6,36,3,12,17,21,254,186,1,44,51,50,19,0,1,0,58,255,247,1,172,1,252,0,55,1,138,75,176,8,80,88,64,25,48,1,0,7,18,3,2,3,1,0,41,19,2,2,1,3,74,0,1,8,72,34,1,4,71,27,75,176,10,80,88,64,25,48,1,0,8,18,3,2,3,1,0,41,19,2,2,1,3,74,0,1,8,72,34,1,4,71,27,75,176,11,80,88,64,25,48,1,0,7,18,3,2,3,1,0,41,19,2,2,1,3,74,0,1,8,72,34,1,4,71,27,75,176,27,80,88,64,25,48,1,0,8,18,3,2,3,1,0,41,19,2,2,1,3,74,0,1,8,72,34,1,4,71,27,64,25,48,1,0,7,18,3,2,3,1,0,41,19,2,2,1,3,74,0,1,8,72,34,1,4,71,89,89,89,89,75,176,8,80,88,64,38,0,7,8,0,0,7,112,6,1,1,5,1,2,3,1,2,101,0,0,0,8,94,0,8,8,38,75,0,3,3,4,93,0,4,4,39,4,76,27,75,176,10,80,88,64,32,6,1,1,5,1,2,3,1,2,101,7,1,0,0,8,93,0,8,8,38,75,0,3,3,4,93,0,4,4,39,4,76,27,75,176,11,80,88,64,38,0,7,8,0,0,7,112,6,1,1,5,1,2,3,1,2,101,0,0,0,8,94,0,8,8,38,75,0,3,3,4,93,0,4,4,39,4,76,27,75,176,27,80,88,64,32,6,1,1,5,1,2,3,1,2,101,7,1,0,0,8,93,0,8,8,38,75,0,3,3,4,93,0,4,4,39,4,76,27,64,38,0,7,8,0,0,7,112,6,1,1,5,1,2,3,1,2,101,0,0,0,8,94,0,8,8,38,75,0,3,3,4,93,0,4,4,39,4,76,89,89,89,89,64,12,67,19,18,22,66,51,19,52,40,9,7,29,43,1,6,7,7,54,53,52,38,38,35,34,6,6,7,7,51,50,54,55,23,7,35,7,20,22,51,50,55,23,7,39,38,35,34,7,55,54,54,53,53,7,39,55,23,53,52,38,35,7,39,55,50,23,23,50,55,1,172,14,5,48,2,12,37,46,30,23,6,1,5,5,30,74,11,11,5,128,4,14,22,3,54,3,8,70,20,26,39,72,6,37,25,60,8,6,63,11,18,27,3,6,35,21,67,163,64,1,246,72,84,4,44,6,28,23,7,3,11,15,159,3,1,11,36,124,31,21,3,5,44,2,1,9,42,7,27,33,119,1,8,37,1,155,26,16,2,5,38,1,1,10,0,0,1,0,54,255,127,1,201,1,252,0,58,1,150,75,176,8,80,88,64,29,34,1,5,3,55,45,2,6,5,56,1,0,6,12,1,1,0,4,74,41,1,4,72,25,6,4,3,2,71,27,75,176,10,80,88,64,26,55,45,34,3,6,3,56,1,0,6,12,1,1,0,3,74,41,1,4,72,25,6,4,3,2,71,27,75,176,11,80,88,64,29,34,1,5,3,55,45,2,6,5,56,1,0,6,12,1,1,0,4,74,41,1,4,72,25,6,4,3,2,71,27,75,176,27,80,88,64,26,55,45,34,3,6,3,56,1,0,6,12,1,1,0,3,74,41,1,4,72,25,6,4,3,2,71,27,64,29,34,1,5,3,55,45,2,6,5,56,1,0,6,12,1,1,0,4,74,41,1,4,72,25,6,4,3,2,71,89,89,89,89,75,176,8,80,88,64,37,0,3,4,5,5,3,112,7,1,6,0,0,1,6,0,103,0,5,5,4,94,0,4,4,38,75,0,1,1,2,93,0,2,2,39,2,76,27,75,176,10,80,88,64,31,7,1,6,0,0,1,6,0,103,5,1,3,3,4,93,0,4,4,38,75,0,1,1,2,93,0,2,2,39,2,76,27,75,176,11,80,88,64,37,0,3,4,5,5,3,112,7,1,6,0,0,1,6,0,103,0,5,5,4,94,0,4,4,38,75,0,1,1,2,93,0,2,2,39,2,76,27,75,176,27,80,88,64,31,7,1,6,0,0,1,6,0,103,5,1,3,3,4,93,0,4,4,38,75,0,1,1,2,93,0,2,2,39,2,76,27,64,37,0,3,4,5,5,3,112,7,1,6,0,0,1,6,0,103,0,5,5,4,94,0,4,4,38,75,0,1,1,2,93,0,2,2,39,2,76,89,89,89,89,64,15,0,0,0,58,0,57,42,67,24,66,52,26,8,7,26,43,0,22,21,20,7,39,39,54,54,53,52,39,7,7,20,22,51,50,55,23,7,39,38,35,34,7,55,54,54,53,19,52,38,35,7,39,55,50,23,23,50,55,23,6,7,7,54,53,52,38,38,35,34,6,6,7,7,54,51,1,113,88,215,7,11,79,72,111,66,5,15,25,7,26,2,7,59,16,22,42,68,5,37,26,1,12,18,27,2,6,34,21,68,177,66,3,11,7,47,1,15,37,43,33,29,13,1,5,51,41,1,41,78,69,183,96,4,26,46,112,75,113,3,14,145,30,21,2,4,41,2,1,9,42,7,27,33,1,61,25,17,2,5,38,1,1,10,6,60,85,4,13,22,29,25,8,3,12,14,136,12,0,0,0,0,1,0,29,255,134,3,6,1,249,0,91,2,39,75,176,8,80,88,64,25,80,44,2,9,7,86,38,2,1,9,91,31,2,3,2,3,74,65,1,8,72,0,1,0,71,27,75,176,10,80,88,64,25,80,44,2,9,7,86,38,2,1,9,91,31,2,0,2,3,74,65,1,8,72,0,1,0,71,27,75,176,11,80,88,64,25,80,44,2,9,7,86,38,2,1,9,91,31,2,3,2,3,74,65,1,8,72,0,1,0,71,27,75,176,27,80,88,64,25,80,44,2,9,7,86,38,2,1,9,91,31,2,0,2,3,74,65,1,8,72,0,1,0,71,27,64,25,80,44,2,9,7,86,38,2,1,9,91,31,2,3,2,3,74,65,1,8,72,0,1,0,71,89,89,89,89,75,176,8,80,88,64,54,12,1,9,4,1,1,2,9,1,101,0,10,10,8,95,13,11,2,8,8,38,75,14,1,7,7,8,95,13,11,2,8,8,38,75,15,6,2,2,2,3,93,0,3,3,39,75,5,1,0,0,41,0,76,27,75,176,10,80,88,64,50,12,1,9,4,1,1,2,9,1,101,0,10,10,8,95,13,11,2,8,8,38,75,14,1,7,7,8,95,13,11,2,8,8,38,75,15,6,2,2,2,0,95,5,3,2,0,0,39,0,76,27,75,176,11,80,88,64,54,12,1,9,4,1,1,2,9,1,101,0,10,10,8,95,13,11,2,8,8,38,75,14,1,7,7,8,95,13,11,2,8,8,38,75,15,6,2,2,2,3,93,0,3,3,39,75,5,1,0,0,39,0,76,27,75,176,12,80,88,64,50,12,1,9,4,1,1,2,9,1,101,0,10,10,8,95,13,11,2,8,8,38,75,14,1,7,7,8,95,13,11,2,8,8,38,75,15,6,2,2,2,0,95,5,3,2,0,0,39,0,76,27,75,176,27,80,88,64,50,12,1,9,4,1,1,2,9,1,101,0,10,10,8,95,13,11,2,8,8,38,75,14,1,7,7,8,95,13,11,2,8,8,38,75,15,6,2,2,2,0,95,5,3,2,0,0,41,0,76,27,64,54,12,1,9,4,1,1,2,9,1,101,0,10,10,8,95,13,11,2,8,8,38,75,14,1,7,7,8,95,13,11,2,8,8,38,75,15,6,2,2,2,3,93,0,3,3,39,75,5,1,0,0,41,0,76,89,89,89,89,89,64,26,90,89,83,81,75,74,71,70,64,60,58,56,53,52,21,40,19,18,21,68,35,19,18,16,7,29,43,5,7,39,34,38,39,39,35,7,6,22,51,50,54,51,23,7,35,38,35,7,55,54,54,53,53,35,7,6,35,39,39,55,50,54,55,55,54,55,39,38,38,35,34,7,39,38,54,55,50,22,23,23,51,53,52,38,35,7,39,55,50,22,51,50,55,7,6,6,7,7,51,55,54,54,51,22,21,20,7,7,38,35,34,6,7,7,23,22,22,23,23,3,6,48,18,32,49,23,102,64,4,1,15,21,13,22,1,2,7,20,48,38,99,8,37,23,63,102,44,45,75,5,4,30,47,21,73,24,22,66,20,38,28,20,28,9,2,11,13,54,68,38,74,67,12,18,27,3,6,7,51,38,25,70,4,31,22,1,4,66,74,39,68,54,22,1,8,28,20,28,40,19,58,110,21,36,40,6,118,4,112,35,37,167,136,31,22,2,4,40,2,1,40,4,23,33,130,167,73,9,31,5,33,33,110,34,14,104,31,30,9,7,25,46,13,49,62,119,142,25,17,1,4,38,2,7,41,5,20,22,142,119,62,49,21,47,11,5,7,9,30,31,91,171,32,20,2,8,0,0,0,1,0,68,255,111,1,168,1,247,0,55,0,123,64,23,40,1,4,5,52,28,2,3,4,16,1,2,1,12,1,0,2,4,74,6,1,0,71,75,176,8,80,88,64,37,0,1,3,2,3,1,2,126,0,4,0,3,1,4,3,101,0,5,5,6,95,0,6,6,38,75,0,2,2,0,95,0,0,0,39,0,76,27,64,37,0,1,3,2,3,1,2,126,0,4,0,3,1,4,3,101,0,5,5,6,95,0,6,6,38,75,0,2,2,0,95,0,0,0,41,0,76,89,64,10,41,37,18,20,34,23,25,7,7,27,43,36,6,7,6,15,2,39,38,39,34,39,39,54,53,52,39,55,51,6,22,51,50,54,53,52,39,7,39,55,23,54,54,53,52,38,35,34,6,7,7,54,53,52,39,55,54,51,50,22,21,20,7,22,22,21,1,168,75,64,16,3,9,44,8,3,10,42,78,4,2,1,29,21,3,50,58,56,58,99,77,5,8,95,26,30,52,48,46,40,5,50,6,1,5,84,51,86,91,94,59,62,94,76,17,16,32,94,4,88,33,15,14,6,39,45,31,17,6,56,50,45,44,78,19,3,5,51,2,13,47,29,40,43,44,55,5,42,58,24,11,6,14,59,56,82,42,14,61,44,0,0,0,1,0,48,255,134,2,15,1,249,0,60,1,251,75,176,8,80,88,64,27,50,49,2,6,8,56,1,1,6,14,1,2,1,0,1,3,2,4,74,36,1,5,72,1,1,0,71,27,75,176,10,80,88,64,27,50,49,2,6,8,56,1,1,6,14,1,2,1,0,1,0,2,4,74,36,1,5,72,1,1,0,71,27,75,176,11,80,88,64,27,50,49,2,6,8,56,1,1,6,14,1,2,1,0,1,3,2,4,74,36,1,5,72,1,1,0,71,27,75,176,27,80,88,64,27,50,49,2,6,8,56,1,1,6,14,1,2,1,0,1,0,2,4,74,36,1,5,72,1,1,0,71,27,64,27,50,49,2,6,8,56,1,1,6,14,1,2,1,0,1,3,2,4,74,36,1,5,72,1,1,0,71,89,89,89,89,75,176,8,80,88,64,47,0,6,0,1,2,6,1,101,0,4,4,5,95,7,1,5,5,38,75,0,8,8,5,95,7,1,5,5,38,75,9,1,2,2,3,93,0,3,3,39,75,0,0,0,41,0,76,27,75,176,10,80,88,64,43,0,6,0,1,2,6,1,101,0,4,4,5,95,7,1,5,5,38,75,0,8,8,5,95,7,1,5,5,38,75,9,1,2,2,0,95,3,1,0,0,39,0,76,27,75,176,11,80,88,64,47,0,6,0,1,2,6,1,101,0,4,4,5,95,7,1,5,5,38,75,0,8,8,5,95,7,1,5,5,38,75,9,1,2,2,3,93,0,3,3,39,75,0,0,0,39,0,76,27,75,176,12,80,88,64,43,0,6,0,1,2,6,1,101,0,4,4,5,95,7,1,5,5,38,75,0,8,8,5,95,7,1,5,5,38,75,9,1,2,2,0,95,3,1,0,0,39,0,76,27,75,176,27,80,88,64,43,0,6,0,1,2,6,1,101,0,4,4,5,95,7,1,5,5,38,75,0,8,8,5,95,7,1,5,5,38,75,9,1,2,2,0,95,3,1,0,0,41,0,76,27,64,47,0,6,0,1,2,6,1,101,0,4,4,5,95,7,1,5,5,38,75,0,8,8,5,95,7,1,5,5,38,75,9,1,2,2,3,93,0,3,3,39,75,0,0,0,41,0,76,89,89,89,89,89,64,14,60,59,37,19,22,66,39,67,35,19,19,10,7,29,43,37,21,7,39,34,38,39,39,35,7,6,22,51,50,55,23,7,39,38,35,7,55,54,54,53,17,54,38,35,7,39,55,23,22,51,50,55,7,6,6,7,7,23,55,54,54,51,22,21,7,7,38,35,34,6,7,7,23,22,22,23,2,15,47,19,32,49,23,102,64,4,1,15,22,19,16,3,8,56,19,31,99,8,38,23,1,13,18,27,2,6,54,16,25,34,61,3,31,22,1,4,66,73,40,69,53,22,1,9,27,21,26,40,21,57,110,21,35,40,38,156,4,112,35,37,167,136,31,22,2,4,40,1,1,1,40,4,23,33,1,62,25,17,1,4,38,1,1,7,41,5,19,22,138,4,118,64,47,22,47,15,7,9,29,32,90,172,32,20,2,0,0,1,0,54,255,245,2,60,1,249,0,69,1,20,64,28,59,49,48,47,4,7,10,65,1,1,7,9,8,7,3,3,1,19,0,2,4,3,4,74,40,1,6,72,75,176,8,80,88,64,49,8,1,7,2,1,1,3,7,1,101,0,5,5,6,95,9,1,6,6,38,75,0,10,10,6,95,9,1,6,6,38,75,11,1,3,3,4,93,0,4,4,39,75,0,0,0,39,0,76,27,75,176,12,80,88,64,49,8,1,7,2,1,1,3,7,1,101,0,5,5,6,95,9,1,6,6,38,75,0,10,10,6,95,9,1,6,6,38,75,11,1,3,3,4,93,0,4,4,39,75,0,0,0,41,0,76,27,75,176,14,80,88,64,49,8,1,7,2,1,1,3,7,1,101,0,5,5,6,95,9,1,6,6,38,75,0,10,10,6,95,9,1,6,6,38,75,11,1,3,3,4,93,0,4,4,39,75,0,0,0,39,0,76,27,64,49,8,1,7,2,1,1,3,7,1,101,0,5,5,6,95,9,1,6,6,38,75,0,10,10,6,95,9,1,6,6,38,75,11,1,3,3,4,93,0,4,4,39,75,0,0,0,41,0,76,89,89,89,64,18,69,68,62,60,55,54,20,22,66,39,68,35,20,18,18,12,7,29,43,37,7,7,34,39,39,35,7,7,39,55,35,7,6,22,51,50,54,51,23,7,34,38,35,7,55,54,54,53,17,54,38,35,7,39,55,50,22,51,50,55,7,6,6,7,7,23,39,55,23,7,23,55,54,54,51,22,22,7,7,38,35,34,6,7,7,23,22,22,51,2,60,5,75,44,46,102,18,1,38,7,2,41,4,1,15,22,12,20,3,3,8,6,56,44,99,8,37,24,1,13,18,27,2,6,6,51,38,32,63,3,31,22,1,4,40,1,39,8,3,22,73,39,69,54,13,10,2,8,29,19,28,40,20,57,110,22,47,30,29,31,9,73,167,98,6,5,99,136,31,22,2,4,40,2,1,40,4,23,32,1,63,25,17,1,4,38,2,7,41,5,19,22,137,2,96,6,4,100,1,118,62,49,12,46,26,7,9,30,31,90,172,33,33,0,1,0,17,255,245,2,73,1,251,0,62,1,0,64,20,52,32,2,6,8,58,1,1,6,0,1,3,2,3,74,35,34,2,5,72,75,176,8,80,88,64,47,0,6,0,1,2,6,1,101,0,4,4,5,95,7,1,5,5,38,75,0,8,8,5,95,7,1,5,5,38,75,9,1,2,2,3,93,0,3,3,39,75,0,0,0,39,0,76,27,75,176,12,80,88,64,47,0,6,0,1,2,6,1,101,0,4,4,5,95,7,1,5,5,38,75,0,8,8,5,95,7,1,5,5,38,75,9,1,2,2,3,93,0,3,3,39,75,0,0,0,41,0,76,27,75,176,14,80,88,64,47,0,6,0,1,2,6,1,101,0,4,4,5,95,7,1,5,5,38,75,0,8,8,5,95,7,1,5,5,38,75,9,1,2,2,3,93,0,3,3,39,75,0,0,0,39,0,76,27,64,47,0,6,0,1,2,6,1,101,0,4,4,5,95,7,1,5,5,38,75,0,8,8,5,95,7,1,5,5,38,75,9,1,2,2,3,93,0,3,3,39,75,0,0,0,41,0,76,89,89,89,64,14,62,61,37,19,21,40,39,68,35,18,18,10,7,29,43,37,7,7,34,39,39,35,7,6,22,51,50,54,51,23,7,35,38,35,7,55,54,54,55,19,52,38,7,14,2,7,7,54,55,55,23,23,55,7,6,6,7,7,23,55,54,54,51,22,22,7,7,38,35,34,6,7,7,23,22,22,51,2,73,5,75,45,44,102,64,4,1,14,21,13,22,1,2,7,20,48,38,99,8,37,23,1,1,12,16,34,30,14,7,46,9,3,7,72,99,114,4,35,26,1,4,67,73,38,68,54,13,11,2,9,28,20,28,38,20,57,110,21,47,30,29,31,9,73,167,136,31,22,2,4,40,2,1,40,4,23,33,1,62,22,17,1,2,12,37,46,4,82,64,7,8,1,5,41,3,17,21,141,4,118,62,49,13,46,25,7,9,30,31,91,171,33,33,0,1,0,48,255,134,2,74,1,249,0,77,0,175,75,176,30,80,88,64,28,59,53,38,3,7,5,21,15,2,1,2,77,30,2,0,1,3,74,65,61,44,3,6,72,0,1,0,71,27,64,31,59,53,38,3,7,5,15,1,10,2,21,1,1,10,77,30,2,0,1,4,74,65,61,44,3,6,72,0,1,0,71,89,75,176,30,80,88,64,34,0,7,0,2,1,7,2,101,8,1,5,5,6,95,9,1,6,6,38,75,10,3,2,1,1,0,93,4,1,0,0,39,0,76,27,64,41,0,10,2,1,2,10,1,126,0,7,0,2,10,7,2,101,8,1,5,5,6,95,9,1,6,6,38,75,3,1,1,1,0,93,4,1,0,0,39,0,76,89,64,16,76,74,64,62,36,39,51,24,83,36,36,17,36,11,7,29,43,5,7,39,38,38,39,7,55,62,2,53,53,39,34,7,7,6,22,51,50,55,23,7,34,38,35,34,6,7,55,54,54,53,19,52,38,35,7,39,55,22,51,50,55,7,14,2,7,7,23,50,55,55,52,38,35,34,7,39,55,22,51,50,55,7,6,6,7,6,6,21,20,22,31,2,2,74,50,7,4,35,38,85,7,26,26,10,116,36,95,2,1,15,20,18,18,2,8,5,41,31,34,86,6,5,38,25,1,12,19,27,2,6,52,41,35,61,3,24,20,8,1,5,130,42,73,1,12,19,11,16,2,6,8,78,38,66,3,31,20,1,5,7,12,15,46,6,118,4,63,33,25,1,1,40,1,12,33,34,111,1,9,129,31,22,2,4,40,2,6,2,40,8,26,32,1,63,25,17,2,5,38,2,7,41,4,10,25,27,121,1,7,134,25,17,2,5,38,2,7,41,5,17,22,81,193,55,24,18,1,2,8,0,0,0,0,1,0,54,255,247,2,230,1,252,0,83,1,194,75,176,8,80,88,64,31,76,56,2,0,6,71,3,2,8,0,34,1,1,3,40,20,2,2,1,4,74,62,1,7,72,47,42,26,3,2,71,27,75,176,10,80,88,64,31,76,56,2,0,7,71,3,2,8,0,34,1,1,3,40,20,2,2,1,4,74,62,1,7,72,47,42,26,3,2,71,27,75,176,11,80,88,64,31,76,56,2,0,6,71,3,2,8,0,34,1,1,3,40,20,2,2,1,4,74,62,1,7,72,47,42,26,3,2,71,27,75,176,27,80,88,64,31,76,56,2,0,7,71,3,2,8,0,34,1,1,3,40,20,2,2,1,4,74,62,1,7,72,47,42,26,3,2,71,27,64,31,76,56,2,0,6,71,3,2,8,0,34,1,1,3,40,20,2,2,1,4,74,62,1,7,72,47,42,26,3,2,71,89,89,89,89,75,176,8,80,88,64,44,0,8,0,3,1,8,3,101,9,1,6,6,7,93,10,1,7,7,38,75,0,0,0,7,94,10,1,7,7,38,75,4,1,1,1,2,95,5,1,2,2,39,2,76,27,75,176,10,80,88,64,34,0,8,0,3,1,8,3,101,9,6,2,0,0,7,93,10,1,7,7,38,75,4,1,1,1,2,95,5,1,2,2,39,2,76,27,75,176,11,80,88,64,44,0,8,0,3,1,8,3,101,9,1,6,6,7,93,10,1,7,7,38,75,0,0,0,7,94,10,1,7,7,38,75,4,1,1,1,2,95,5,1,2,2,39,2,76,27,75,176,27,80,88,64,34,0,8,0,3,1,8,3,101,9,6,2,0,0,7,93,10,1,7,7,38,75,4,1,1,1,2,95,5,1,2,2,39,2,76,27,64,44,0,8,0,3,1,8,3,101,9,1,6,6,7,93,10,1,7,7,38,75,0,0,0,7,94,10,1,7,7,38,75,4,1,1,1,2,95,5,1,2,2,39,2,76,89,89,89,89,64,16,82,78,75,74,39,51,25,36,36,38,66,54,40,11,7,29,43,1,6,7,7,54,53,52,38,38,35,34,6,6,7,3,20,22,51,50,55,23,7,39,38,35,34,7,55,54,54,53,53,39,34,7,7,6,22,51,50,55,23,7,38,35,34,6,7,55,54,54,53,19,52,38,35,7,39,55,22,51,50,55,7,14,2,7,7,23,50,55,53,52,38,35,7,39,55,50,23,23,50,55,2,230,12,7,48,2,12,36,46,30,23,6,1,11,14,22,5,51,4,8,71,19,27,50,60,5,37,26,115,32,99,2,1,15,20,18,18,2,8,16,61,33,84,9,5,38,25,1,12,19,27,2,6,52,41,31,65,3,24,20,8,1,5,130,44,71,12,18,27,2,6,34,21,68,161,66,1,246,74,92,4,29,30,29,23,7,3,11,15,254,186,31,21,3,5,44,2,1,9,42,7,27,33,130,1,9,129,31,22,2,4,40,2,6,2,40,8,26,32,1,63,25,17,2,5,38,2,7,41,4,10,25,27,121,1,7,134,25,17,2,5,38,1,1,10,0,1,0,48,255,134,2,50,1,249,0,62,0,62,64,59,26,1,2,1,0,1,0,2,2,74,49,1,5,72,33,1,2,0,71,0,4,5,1,1,4,112,0,1,1,5,94,0,5,5,38,75,6,1,2,2,0,93,3,1,0,0,39,0,76,29,66,40,67,38,55,37,7,7,27,43,37,21,7,39,38,38,35,35,55,54,54,53,17,52,38,35,35,34,6,7,6,21,20,22,51,50,55,23,7,39,38,35,34,7,55,54,54,53,19,52,38,35,7,39,55,22,51,33,50,55,7,6,6,7,6,6,21,20,23,22,22,23,23,2,50,50,7,4,39,42,76,5,36,27,18,21,109,35,29,1,11,14,21,23,18,2,7,60,19,32,30,70,5,38,26,1,13,17,33,2,5,60,42,1,39,26,74,4,33,24,1,4,6,1,1,11,12,47,38,156,4,63,35,24,39,3,24,31,1,55,24,16,15,22,187,131,32,21,2,4,40,1,1,8,40,8,26,32,1,63,25,17,2,5,38,2,7,41,5,17,22,81,193,53,14,6,13,11,1,2,0,0,0,1,0,42,255,111,1,228,1,252,0,48,0,44,64,41,28,1,1,0,33,32,2,2,1,2,74,12,10,2,2,71,0,2,1,2,132,0,1,1,0,95,0,0,0,38,1,76,46,44,40,38,24,22,3,7,20,43,37,6,6,7,7,14,2,7,6,15,2,39,38,38,39,38,38,53,52,54,54,51,50,22,22,23,23,14,2,7,7,52,54,53,52,38,35,34,6,21,20,22,51,50,54,55,1,228,3,14,3,6,4,31,54,32,11,1,9,44,8,3,6,6,96,111,73,130,83,31,65,45,6,3,1,7,10,2,50,2,56,57,78,89,94,80,53,64,14,163,12,84,37,8,2,10,13,3,15,26,94,4,88,19,23,8,11,127,102,80,125,70,8,10,1,7,5,35,63,33,4,4,21,14,36,34,101,90,100,119,57,61,0,0,255,255,255,253,255,247,1,223,1,248,0,2,2,235,0,0,255,255,255,253,255,247,1,223,1,248,0,34,2,235,0,0,1,7,7,220,1,208,255,194,0,9,177,1,1,184,255,194,176,51,43,0,0,1,0,24,255,134,2,41,1,248,0,79,0,84,64,81,45,1,4,3,72,68,57,52,49,33,14,10,8,1,4,2,74,60,1,4,77,21,2,1,2,73,62,44,2,3,72,79,78,27,23,6,5,6,0,71,0,4,3,1,3,4,1,126,0,1,0,3,1,0,124,5,1,3,3,38,75,2,1,0,0,39,0,76,66,63,47,46,43,39,26,24,19,34,6,7,22,43,5,38,38,35,34,7,39,55,54,54,53,52,38,39,39,7,6,6,21,20,22,23,23,7,38,35,34,7,39,55,54,54,55,55,39,38,38,39,39,55,23,22,51,50,55,23,7,6,6,21,20,22,23,55,54,54,38,53,52,38,39,39,55,22,51,50,55,23,7,6,6,7,7,23,22,22,23,23,21,7,1,239,3,32,37,29,81,3,4,32,27,9,7,85,70,24,14,22,24,2,6,57,37,47,38,3,6,29,57,42,88,102,20,52,38,2,5,61,22,38,66,49,3,3,33,27,37,50,27,45,31,2,21,25,1,5,57,37,14,69,3,5,34,41,36,96,114,24,44,36,8,51,59,33,26,6,6,36,2,11,12,6,16,10,118,87,31,23,9,11,11,2,4,38,5,3,6,37,8,48,51,105,143,29,31,5,3,37,1,1,6,6,33,2,12,13,8,59,71,35,57,43,5,2,10,10,2,3,36,5,3,5,36,8,31,43,117,155,32,25,3,9,155,4,0,0,0,1,0,17,255,134,1,222,1,249,0,59,0,126,64,27,51,41,36,22,4,5,3,12,1,2,5,59,1,0,1,3,74,47,43,27,3,4,72,0,1,0,71,75,176,30,80,88,64,32,0,5,0,2,1,5,2,103,6,1,3,3,4,95,7,1,4,4,38,75,8,1,1,1,0,93,0,0,0,39,0,76,27,64,39,0,8,2,1,2,8,1,126,0,5,0,2,8,5,2,103,6,1,3,3,4,95,7,1,4,4,38,75,0,1,1,0,93,0,0,0,39,0,76,89,64,12,42,36,20,24,35,21,37,17,36,9,7,29,43,5,7,39,38,38,39,7,55,62,2,53,53,6,35,34,38,53,53,52,38,35,7,39,55,23,50,55,7,14,2,21,21,20,23,55,53,52,38,35,7,39,55,22,51,50,55,7,6,6,7,6,6,21,20,22,31,2,1,222,50,7,4,35,37,93,7,29,29,11,56,43,76,87,10,15,22,2,4,84,29,67,4,24,21,7,111,72,11,18,27,3,6,10,76,30,74,3,31,19,2,5,7,11,15,47,6,118,4,63,33,25,1,1,40,1,12,33,34,90,14,73,67,84,23,17,2,5,38,2,7,41,4,11,24,26,45,110,2,15,160,25,17,2,5,38,2,7,41,4,17,23,82,192,55,25,17,1,2,8,0,0,1,0,19,255,254,1,237,1,249,0,68,0,80,64,77,49,44,43,41,40,39,38,24,10,9,2,3,15,14,13,12,4,1,2,0,1,0,1,3,74,55,51,29,3,4,72,0,2,3,1,3,2,1,126,5,1,3,3,4,95,6,1,4,4,38,75,7,1,1,1,0,93,0,0,0,39,0,76,66,64,54,52,48,47,35,21,26,17,49,8,7,25,43,37,7,38,35,7,55,62,2,53,53,6,15,2,39,55,38,38,53,53,52,38,35,7,39,55,23,50,55,7,14,2,7,7,6,22,23,39,55,23,7,21,55,55,52,38,35,7,39,55,22,51,50,55,7,6,6,7,6,6,21,20,22,51,50,54,51,1,237,8,58,47,107,7,29,29,11,45,34,1,39,6,1,74,83,10,15,22,2,4,84,30,67,4,24,21,7,1,1,1,41,40,1,39,8,2,79,1,12,18,27,3,6,10,76,30,74,3,30,21,1,5,6,14,21,10,19,6,38,40,2,1,40,1,12,33,34,91,11,3,69,6,5,70,4,72,63,84,23,17,2,5,38,2,7,41,4,11,24,26,45,44,54,9,124,6,4,117,14,16,159,25,17,2,5,38,2,7,41,5,17,22,79,191,59,30,21,2,0,0,0,255,255,0,54,255,247,2,74,1,249,0,2,2,82,0,0,255,255,0,53,255,247,1,15,1,249,0,2,2,87,0,0,255,255,0,18,255,245,2,251,2,189,0,34,3,232,0,0,1,7,8,41,2,71,0,46,0,8,177,1,1,176,46,176,51,43,0,0,0,1,0,17,255,134,1,215,1,249,0,65,0,170,75,176,30,80,88,64,27,56,45,40,26,4,6,4,16,1,3,6,10,0,2,0,2,3,74,47,31,2,5,72,9,1,0,71,27,64,27,56,45,40,26,4,6,4,16,1,3,6,10,0,2,0,10,3,74,47,31,2,5,72,9,1,0,71,89,75,176,30,80,88,64,34,0,6,0,3,2,6,3,103,7,1,4,4,5,93,9,8,2,5,5,38,75,10,1,2,2,0,96,1,1,0,0,39,0,76,27,64,41,0,2,3,10,3,2,10,126,0,6,0,3,2,6,3,103,7,1,4,4,5,93,9,8,2,5,5,38,75,0,10,10,0,96,1,1,0,0,39,0,76,89,64,16,63,61,52,51,36,20,24,35,21,36,38,33,17,11,7,29,43,37,7,34,39,39,34,6,15,2,63,2,54,54,55,53,6,35,34,38,53,53,52,38,35,7,39,55,23,50,55,7,14,2,21,21,20,23,55,53,52,38,35,7,39,55,22,51,50,55,55,7,6,6,7,6,6,21,20,22,51,50,54,51,1,215,7,20,9,87,36,24,5,7,51,2,7,47,25,21,1,56,43,76,87,10,15,22,2,4,84,26,70,4,24,21,7,111,72,11,18,27,3,6,10,76,14,45,45,3,31,21,1,5,6,15,21,10,19,6,38,40,1,1,23,36,59,4,160,9,1,1,19,23,118,14,73,67,84,23,17,2,5,38,2,7,41,4,11,24,26,45,110,2,15,160,26,16,2,5,38,2,4,3,41,5,17,22,58,193,78,30,21,2,0,0,0,255,255,0,0,255,249,1,250,2,188,0,34,2,4,0,0,1,7,8,41,1,191,0,45,0,8,177,2,1,176,45,176,51,43,0,0,255,255,0,0,255,249,1,250,2,172,0,34,2,4,0,0,1,7,7,186,1,198,0,45,0,8,177,2,2,176,45,176,51,43,0,0,255,255,0,4,255,249,2,155,1,251,0,2,2,31,0,0,255,255,0,54,255,248,1,197,2,188,0,34,2,48,0,0,1,7,8,41,1,192,0,45,0,8,177,1,1,176,45,176,51,43,0,0,255,255,0,29,255,245,2,10,1,249,0,2,2,71,0,0,255,255,0,18,255,245,2,251,2,173,0,34,3,232,0,0,1,7,7,186,2,78,0,46,0,8,177,1,2,176,46,176,51,43,0,0,255,255,0,68,255,247,1,151,2,173,0,34,3,233,0,0,1,7,7,186,1,177,0,46,0,8,177,1,2,176,46,176,51,43,0,0,255,255,0,54,255,248,2,74,2,167,0,34,3,234,0,0,1,7,7,205,2,6,0,46,0,8,177,1,1,176,46,176,51,43,0,0,255,255,0,54,255,248,2,74,2,173,0,34,3,234,0,0,1,7,7,186,2,7,0,46,0,8,177,1,2,176,46,176,51,43,0,0,255,255,0,41,255,247,2,32,2,172,0,34,2,133,0,0,1,7,7,186,1,236,0,45,0,8,177,2,2,176,45,176,51,43,0,0,255,255,0,41,255,247,2,32,1,251,0,2,4,17,0,0,255,255,255,253,255,247,1,223,2,166,0,34,2,235,0,0,1,7,7,205,1,180,0,45,0,8,177,1,1,176,45,176,51,43,0,0,255,255,255,253,255,247,1,223,2,172,0,34,2,235,0,0,1,7,7,186,1,181,0,45,0,8,177,1,2,176,45,176,51,43,0,0,255,255,255,253,255,247,1,223,2,238,0,34,2,235,0,0,1,7,7,195,1,195,0,45,0,8,177,1,2,176,45,176,51,43,0,0,255,255,0,19,255,254,1,217,2,173,0,34,3,251,0,0,1,7,7,186,1,198,0,46,0,8,177,1,2,176,46,176,51,43,0,0,0,1,0,48,255,134,1,161,1,252,0,44,1,92,75,176,8,80,88,64,25,15,1,3,1,36,26,2,4,3,42,1,0,4,3,74,22,1,2,72,44,43,6,3,0,71,27,75,176,10,80,88,64,22,36,26,15,3,4,1,42,1,0,4,2,74,22,1,2,72,44,43,6,3,0,71,27,75,176,11,80,88,64,25,15,1,3,1,36,26,2,4,3,42,1,0,4,3,74,22,1,2,72,44,43,6,3,0,71,27,75,176,27,80,88,64,22,36,26,15,3,4,1,42,1,0,4,2,74,22,1,2,72,44,43,6,3,0,71,27,64,25,15,1,3,1,36,26,2,4,3,42,1,0,4,3,74,22,1,2,72,44,43,6,3,0,71,89,89,89,89,75,176,8,80,88,64,31,0,1,2,3,3,1,112,0,4,3,0,3,4,0,126,0,3,3,2,94,0,2,2,38,75,0,0,0,39,0,76,27,75,176,10,80,88,64,25,0,4,1,0,1,4,0,126,3,1,1,1,2,93,0,2,2,38,75,0,0,0,39,0,76,27,75,176,11,80,88,64,31,0,1,2,3,3,1,112,0,4,3,0,3,4,0,126,0,3,3,2,94,0,2,2,38,75,0,0,0,39,0,76,27,75,176,27,80,88,64,25,0,4,1,0,1,4,0,126,3,1,1,1,2,93,0,2,2,38,75,0,0,0,39,0,76,27,64,31,0,1,2,3,3,1,112,0,4,3,0,3,4,0,126,0,3,3,2,94,0,2,2,38,75,0,0,0,39,0,76,89,89,89,89,183,38,42,67,24,35,5,7,25,43,23,46,2,35,34,7,55,54,54,53,19,52,38,35,7,39,55,50,23,23,50,55,23,6,7,7,54,53,52,38,38,35,34,6,6,7,3,6,22,31,3,7,250,3,17,37,38,33,74,5,37,26,1,12,18,27,2,6,34,21,68,161,66,3,12,7,48,2,12,37,45,30,23,6,1,11,1,17,22,75,8,1,50,55,23,23,9,9,42,7,27,33,1,61,25,17,2,5,38,1,1,10,6,73,93,4,16,43,29,23,7,3,11,14,254,185,25,19,1,2,8,158,4,0,0,0,255,255,0,53,255,247,2,179,2,172,0,34,4,2,0,0,1,7,7,186,2,58,0,45,0,8,177,3,2,176,45,176,51,43,0,0,255,255,0,41,255,84,2,161,1,251,0,2,2,171,0,0,255,255,0,5,255,243,3,14,1,250,0,2,2,229,0,0,255,255,0,54,255,247,1,171,1,251,0,2,2,72,0,0,255,255,0,68,255,111,1,168,1,247,0,2,4,22,0,0,255,255,0,41,255,23,1,228,1,251,0,34,2,34,0,0,0,3,7,216,1,229,0,0,255,255,255,241,255,246,2,82,2,137,0,2,0,3,0,0,255,255,0,58,255,244,2,30,2,129,0,2,0,31,0,0,0,1,0,58,255,244,1,239,2,137,0,41,0,48,64,45,19,18,2,3,0,1,74,15,1,1,72,41,1,4,71,2,1,0,0,1,93,0,1,1,70,75,0,3,3,4,93,0,4,4,71,4,76,50,54,42,66,38,5,10,25,43,55,54,54,53,19,52,38,35,7,39,55,22,51,50,54,55,23,6,7,7,54,53,52,38,38,35,34,6,6,7,3,20,22,51,55,55,23,7,39,39,34,7,64,46,32,1,15,22,34,2,7,102,37,113,121,42,3,17,6,48,2,15,47,59,39,30,8,1,14,18,26,51,20,2,9,62,77,53,71,34,9,35,42,1,164,32,22,2,4,44,3,5,7,6,92,108,4,38,31,39,31,9,4,15,20,254,76,41,27,2,1,4,47,2,2,12,0,0,0,2,0,11,0,0,1,253,2,137,0,9,0,16,0,30,64,27,12,2,2,1,72,2,1,1,1,0,93,0,0,0,71,0,76,10,10,10,16,10,15,24,3,10,21,43,55,19,55,51,22,22,18,23,7,33,37,55,3,35,3,23,23,11,237,63,8,9,63,85,33,7,254,30,1,126,7,140,7,171,4,162,13,2,107,17,32,225,254,227,100,7,61,11,1,212,254,38,5,4,255,255,0,58,255,246,2,20,2,137,0,2,0,47,0,0,255,255,0,34,255,253,2,12,2,137,0,2,0,240,0,0,255,255,0,58,255,244,2,185,2,134,0,2,0,78,0,0,0,3,0,40,255,244,2,140,2,137,0,15,0,31,0,47,0,67,64,64,40,39,2,4,2,32,1,3,5,2,74,0,4,0,5,3,4,5,101,0,2,2,0,95,0,0,0,70,75,7,1,3,3,1,95,6,1,1,1,77,1,76,16,16,0,0,45,41,37,33,16,31,16,30,24,22,0,15,0,14,38,8,10,21,43,22,38,38,53,52,54,54,51,50,22,22,21,20,6,6,35,62,2,53,52,38,38,35,34,6,6,21,20,22,22,51,39,55,23,22,51,50,54,55,23,7,39,38,35,34,6,7,236,126,70,87,151,91,83,128,72,89,153,93,94,98,54,58,103,67,61,95,53,56,101,65,170,17,49,60,58,23,86,35,6,17,49,60,58,23,86,35,12,78,141,90,98,161,93,78,140,90,98,162,93,51,66,118,76,85,131,74,66,118,76,85,131,74,239,75,1,3,8,6,6,75,1,3,8,6,0,0,255,255,0,56,255,244,1,56,2,134,0,2,0,83,0,0,255,255,0,57,255,242,2,106,2,134,0,2,0,102,0,0,0,1,255,241,255,246,2,82,2,137,0,45,0,31,64,28,29,7,2,0,72,45,1,1,71,0,0,0,1,95,2,1,1,1,71,1,76,43,39,67,45,3,10,22,43,5,55,54,54,53,52,39,3,35,3,6,21,20,22,51,51,23,7,38,38,35,34,6,7,55,54,54,55,19,55,51,30,2,23,22,22,23,23,7,34,38,35,34,6,7,1,73,4,51,38,9,126,7,150,9,28,32,57,2,6,12,86,41,37,63,10,8,28,34,16,195,63,8,6,49,71,33,12,40,44,2,7,12,63,31,48,89,12,3,39,4,16,18,20,28,1,162,254,92,27,12,22,19,4,43,1,6,2,1,47,3,33,41,1,255,17,24,174,238,100,37,30,4,4,41,3,8,2,0,0,0,255,255,0,46,255,237,3,30,2,131,0,2,0,114,0,0,255,255,0,54,255,216,2,174,2,133,0,2,0,116,0,0,0,3,0,41,255,253,2,39,2,138,0,22,0,38,0,59,0,128,64,29,1,1,2,0,31,30,22,3,3,1,53,43,41,23,4,5,4,56,39,2,6,5,4,74,7,6,2,0,72,75,176,14,80,88,64,36,0,1,2,3,2,1,112,0,3,0,4,5,3,4,101,0,2,2,0,93,0,0,0,70,75,0,5,5,6,93,0,6,6,71,6,76,27,64,37,0,1,2,3,2,1,3,126,0,3,0,4,5,3,4,101,0,2,2,0,93,0,0,0,70,75,0,5,5,6,93,0,6,6,71,6,76,89,64,10,40,58,68,70,53,20,50,7,10,27,43,18,55,55,23,50,54,55,23,6,7,7,54,53,52,38,38,35,35,34,6,6,7,7,23,55,23,22,51,50,54,55,23,7,39,38,35,34,6,7,3,38,39,55,55,30,2,51,51,50,54,54,55,55,23,6,7,7,39,7,68,3,15,207,103,104,39,3,21,3,51,1,13,31,32,162,48,45,25,12,45,70,17,51,60,58,23,87,36,6,17,51,60,58,23,87,36,78,3,9,3,38,11,25,46,48,166,47,46,24,12,40,4,8,6,15,232,222,2,61,55,14,5,6,7,6,84,76,3,13,21,27,26,9,12,37,42,5,198,75,1,3,8,6,6,75,1,3,8,6,254,247,99,36,6,6,44,39,14,13,38,42,4,4,48,95,15,5,5,0,0,255,255,0,40,255,244,2,140,2,137,0,2,0,127,0,0,0,1,0,56,255,244,2,149,2,134,0,61,0,129,75,176,29,80,88,64,15,53,28,2,3,0,1,74,16,1,1,72,61,1,4,71,27,64,15,53,28,2,3,6,1,74,16,1,1,72,61,1,4,71,89,75,176,29,80,88,64,27,6,1,0,0,1,95,2,1,1,1,70,75,7,5,2,3,3,4,93,9,8,2,4,4,71,4,76,27,64,33,0,0,1,6,6,0,112,0,6,6,1,96,2,1,1,1,70,75,7,5,2,3,3,4,93,9,8,2,4,4,71,4,76,89,64,14,60,57,19,39,53,17,51,42,49,18,38,10,10,29,43,55,54,54,53,19,52,38,35,7,39,55,50,23,23,33,50,55,7,6,6,7,6,2,21,20,22,51,50,55,23,7,38,35,35,55,54,54,53,19,52,38,35,35,34,6,7,6,6,21,20,22,51,50,55,23,7,34,39,38,35,34,7,62,47,33,1,15,22,42,2,7,16,9,94,1,102,36,79,4,41,29,2,6,8,18,26,23,20,2,9,99,22,114,6,44,34,1,23,24,145,44,37,1,6,8,18,26,17,36,2,9,14,8,70,39,49,67,34,9,35,42,1,164,32,22,2,4,44,1,2,9,45,5,23,29,110,254,254,64,41,27,2,4,45,3,43,3,32,39,1,161,30,21,19,28,114,251,61,41,27,3,4,46,1,2,12,0,0,0,255,255,0,63,255,248,2,16,2,129,0,2,0,163,0,0,0,1,0,18,255,253,1,239,2,137,0,30,0,54,64,51,23,15,10,9,1,5,2,1,27,1,3,2,2,74,7,6,2,0,72,30,1,3,71,0,1,1,0,93,0,0,0,70,75,0,2,2,3,93,0,3,3,71,3,76,25,35,39,35,4,10,24,43,55,19,3,55,55,54,55,23,22,23,7,38,38,35,35,23,7,7,51,50,54,54,55,55,23,6,6,7,7,37,7,18,235,221,12,230,91,84,10,2,9,42,8,58,67,159,188,2,213,204,50,48,26,12,43,3,8,12,2,15,254,167,82,36,1,11,1,38,34,7,2,9,9,93,80,8,72,57,250,25,242,19,53,60,5,4,43,108,40,16,6,6,255,255,0,9,255,252,2,23,2,137,0,2,0,188,0,0,0,1,255,227,255,250,2,52,2,128,0,43,0,56,64,53,14,1,1,6,1,74,21,1,2,71,0,6,0,1,0,6,1,126,4,1,0,0,5,95,7,1,5,5,70,75,0,1,1,2,96,3,1,2,2,71,2,76,34,17,35,26,33,19,39,34,8,10,28,43,1,7,38,35,34,6,6,21,53,7,6,22,51,50,55,23,7,34,39,39,34,7,55,62,2,53,53,52,38,38,35,39,55,54,51,50,19,51,54,54,51,50,23,2,52,1,14,8,64,110,66,1,1,20,26,12,36,2,9,16,9,102,36,78,6,35,32,11,65,116,75,2,12,39,37,160,51,10,31,109,74,21,22,2,89,7,2,120,203,120,2,43,39,29,3,4,46,1,2,6,46,4,17,39,42,39,122,188,104,3,29,13,254,230,138,143,6,0,0,3,0,33,255,214,2,159,2,164,0,52,0,60,0,69,0,145,64,18,46,1,5,6,9,1,1,0,2,74,42,1,7,72,17,1,2,71,75,176,23,80,88,64,43,9,1,5,12,1,11,10,5,11,103,13,1,10,4,1,0,1,10,0,103,0,6,6,7,95,8,1,7,7,70,75,0,1,1,2,95,3,1,2,2,77,2,76,27,64,46,8,1,7,0,6,5,7,6,103,9,1,5,12,1,11,10,5,11,103,13,1,10,4,1,0,1,10,0,103,0,1,2,2,1,87,0,1,1,2,95,3,1,2,1,2,79,89,64,22,67,65,63,62,58,56,55,54,50,48,33,18,35,21,38,49,19,35,18,14,10,29,43,0,6,6,7,21,20,22,51,50,55,23,7,34,39,38,35,34,7,55,54,54,53,53,35,34,38,53,52,54,54,55,53,52,38,35,7,39,55,50,23,23,50,55,7,6,6,7,6,21,51,50,22,21,4,22,51,19,35,34,6,21,36,38,39,6,7,51,50,54,53,2,159,72,130,84,18,26,17,36,2,9,14,8,70,39,49,67,6,47,33,28,118,135,71,128,83,15,22,42,2,7,16,9,94,45,70,4,41,29,2,1,20,118,135,253,209,107,95,1,12,91,100,1,224,104,93,8,1,15,91,100,1,20,107,62,3,22,41,27,3,4,46,1,2,12,46,9,35,42,14,106,94,68,107,63,3,25,32,22,2,4,44,1,2,9,45,5,23,29,9,20,106,94,94,97,1,85,82,75,58,97,2,210,131,82,75,0,0,0,255,255,0,12,255,248,2,139,2,133,0,2,0,229,0,0,0,1,0,15,255,244,2,192,2,134,0,69,0,91,64,88,69,40,2,8,9,39,1,0,8,38,1,2,7,0,16,1,2,1,4,74,57,1,9,72,24,1,3,71,6,1,0,8,7,8,0,7,126,11,1,7,5,1,1,2,7,1,103,0,8,8,9,95,10,1,9,9,70,75,0,2,2,3,95,4,1,3,3,71,3,76,65,64,56,54,53,52,35,23,37,22,49,19,36,21,18,12,10,29,43,1,7,39,34,6,7,14,2,7,6,21,20,22,51,50,55,23,7,34,39,38,35,34,7,55,54,54,53,53,46,2,39,38,38,35,34,7,39,55,23,30,2,23,55,52,38,35,7,39,55,50,23,23,50,55,7,6,6,7,7,6,7,62,2,55,55,2,192,5,20,21,18,12,21,56,87,70,3,18,26,17,36,2,9,14,8,70,39,49,67,6,47,33,77,86,54,24,7,12,17,9,14,5,108,12,20,43,65,57,1,15,22,42,2,7,16,9,94,45,70,4,41,29,2,2,3,4,58,68,43,20,12,2,77,39,2,29,44,79,87,39,2,99,61,41,27,3,4,46,1,2,12,46,9,35,42,152,2,38,96,95,29,20,3,40,24,9,114,118,53,3,224,32,22,2,4,44,1,2,9,45,5,23,29,45,54,130,3,52,119,115,9,0,0,0,0,1,0,42,255,250,2,247,2,137,0,52,0,48,64,45,28,22,8,2,4,0,4,31,1,3,0,2,74,0,4,4,1,95,0,1,1,70,75,2,1,0,0,3,93,5,1,3,3,71,3,76,24,40,23,39,39,37,6,10,26,43,55,54,39,55,22,22,51,51,53,38,38,53,52,54,54,51,50,22,22,21,20,6,7,21,51,50,54,55,55,6,6,7,7,37,39,55,54,54,53,52,38,38,35,34,6,6,21,20,22,23,23,7,5,60,3,21,41,11,41,46,93,82,90,82,143,86,82,127,71,95,86,106,46,41,11,43,8,11,1,16,254,236,6,13,78,72,51,94,62,62,95,52,80,67,13,7,254,247,10,42,107,5,62,46,10,57,151,83,81,134,77,70,126,81,94,161,51,10,43,60,5,34,88,32,16,7,9,59,60,131,83,74,112,60,57,105,68,86,161,46,58,8,6,0,0,0,255,255,0,45,255,246,2,142,2,163,0,34,0,3,60,0,1,6,8,15,160,219,0,9,177,2,1,184,255,219,176,51,43,0,0,0,255,255,0,12,255,246,2,120,2,163,0,34,0,47,100,0,1,7,8,15,255,95,255,219,0,9,177,1,1,184,255,219,176,51,43,0,255,255,0,12,255,244,3,29,2,163,0,34,0,78,100,0,1,7,8,15,255,95,255,219,0,9,177,1,1,184,255,219,176,51,43,0,255,255,0,12,255,244,1,156,2,163,0,34,0,83,100,0,1,7,8,15,255,95,255,219,0,9,177,1,1,184,255,219,176,51,43,0,255,255,255,252,255,244,2,183,2,163,0,34,0,127,43,0,1,7,8,15,255,79,255,219,0,9,177,2,1,184,255,219,176,51,43,0,255,255,0,4,255,250,2,212,2,163,0,35,4,80,0,160,0,0,1,7,8,15,255,87,255,219,0,9,177,1,1,184,255,219,176,51,43,0,0,0,255,255,0,41,255,250,3,49,2,163,0,34,4,84,58,0,1,7,8,15,255,124,255,219,0,9,177,1,1,184,255,219,176,51,43,0,255,255,0,52,255,244,1,56,3,56,0,34,0,83,0,0,1,7,7,186,1,124,0,185,0,8,177,1,2,176,185,176,51,43,0,0,255,255,255,227,255,250,2,52,3,56,0,34,4,80,0,0,1,7,7,186,1,208,0,185,0,8,177,1,2,176,185,176,51,43,0,0,0,2,0,57,255,20,2,104,2,134,0,34,0,78,0,167,75,176,23,80,88,64,18,74,56,1,3,4,2,51,46,2,6,0,2,74,64,26,2,3,72,27,64,21,74,56,1,3,4,2,51,1,7,0,46,1,6,7,3,74,64,26,2,3,72,89,75,176,23,80,88,64,37,8,1,2,2,3,93,9,1,3,3,70,75,10,11,2,4,4,0,95,7,1,2,0,0,71,75,0,6,6,5,95,0,5,5,75,5,76,27,64,41,8,1,2,2,3,93,9,1,3,3,70,75,10,11,2,4,4,0,95,1,1,0,0,71,75,0,7,7,77,75,0,6,6,5,95,0,5,5,75,5,76,89,64,25,0,0,78,77,68,65,62,61,53,52,49,47,40,38,0,34,0,33,82,40,49,19,12,10,24,43,36,55,23,7,34,39,38,35,7,55,62,2,53,19,52,38,35,7,39,55,50,23,22,51,50,55,7,6,6,7,3,6,22,51,5,14,2,35,34,39,38,53,52,55,55,22,51,50,54,55,7,34,38,39,39,55,55,54,53,52,39,39,55,22,51,50,55,23,7,6,6,7,7,23,22,22,51,1,13,33,2,9,14,8,66,35,115,10,32,31,12,1,15,22,34,2,7,13,7,60,31,35,72,4,37,28,1,12,1,18,27,1,103,37,64,68,44,25,32,38,2,8,55,43,41,65,28,21,24,58,30,175,1,179,31,63,2,7,72,38,20,72,4,7,26,43,46,161,168,37,55,34,44,3,4,46,1,2,1,45,3,14,30,29,1,164,32,22,2,4,44,1,2,9,45,6,25,29,254,83,40,28,16,99,114,51,8,38,50,17,9,4,34,65,67,2,45,41,243,14,186,31,21,26,4,4,43,7,4,7,41,5,32,47,169,219,47,37,0,0,0,255,255,0,45,255,246,2,142,2,160,0,34,0,3,60,0,1,6,8,18,186,220,0,9,177,2,1,184,255,220,176,51,43,0,0,0,255,255,0,45,255,246,2,142,2,160,0,34,0,3,60,0,1,6,8,21,186,220,0,9,177,2,1,184,255,220,176,51,43,0,0,0,255,255,0,45,255,246,2,231,2,166,0,35,0,3,0,149,0,0,1,6,8,40,198,220,0,9,177,2,2,184,255,220,176,51,43,0,255,255,0,45,255,246,2,226,2,166,0,35,0,3,0,144,0,0,1,6,8,24,203,220,0,9,177,2,2,184,255,220,176,51,43,0,255,255,0,45,255,246,2,239,2,165,0,35,0,3,0,157,0,0,1,6,8,26,196,220,0,9,177,2,2,184,255,220,176,51,43,0,255,255,0,45,255,246,2,236,2,159,0,35,0,3,0,154,0,0,1,6,8,28,201,220,0,9,177,2,2,184,255,220,176,51,43,0,255,255,0,45,255,246,2,201,2,230,0,34,0,3,119,0,1,6,8,30,218,220,0,9,177,2,2,184,255,220,176,51,43,0,0,0,255,255,0,45,255,246,2,202,2,239,0,34,0,3,120,0,1,6,8,32,219,220,0,9,177,2,2,184,255,220,176,51,43,0,0,0,255,255,0,45,255,246,2,142,2,140,0,34,0,3,60,0,1,6,8,36,210,202,0,9,177,2,1,184,255,202,176,51,43,0,0,0,255,255,0,45,255,246,2,142,2,163,0,34,0,3,60,0,1,6,8,15,160,219,0,9,177,2,1,184,255,219,176,51,43,0,0,0,255,255,255,241,255,246,2,82,3,50,0,34,0,3,0,0,0,3,7,231,1,247,0,0,255,255,255,241,255,246,2,82,3,20,0,34,0,3,0,0,1,7,7,237,1,246,0,10,0,8,177,2,1,176,10,176,51,43,0,0,255,255,255,241,255,24,2,82,2,137,0,34,0,3,0,0,0,3,8,14,1,199,0,0,255,255,0,45,255,24,2,142,2,137,0,38,8,18,201,194,0,34,0,3,60,0,1,3,8,14,2,3,0,0,0,9,177,0,1,184,255,194,176,51,43,0,0,0,255,255,0,45,255,24,2,142,2,160,0,34,0,3,60,0,0,35,8,14,2,3,0,0,1,6,8,21,186,220,0,9,177,3,1,184,255,220,176,51,43,0,0,0,255,255,0,45,255,24,2,231,2,166,0,35,0,3,0,149,0,0,0,35,8,14,2,92,0,0,1,6,8,40,198,220,0,9,177,3,2,184,255,220,176,51,43,0,255,255,0,45,255,24,2,226,2,166,0,35,0,3,0,144,0,0,0,35,8,14,2,87,0,0,1,6,8,24,203,220,0,9,177,3,2,184,255,220,176,51,43,0,255,255,0,45,255,24,2,239,2,165,0,35,0,3,0,157,0,0,0,35,8,14,2,100,0,0,1,6,8,26,196,220,0,9,177,3,2,184,255,220,176,51,43,0,255,255,0,45,255,24,2,236,2,159,0,35,0,3,0,154,0,0,0,35,8,14,2,97,0,0,1,6,8,28,201,220,0,9,177,3,2,184,255,220,176,51,43,0,255,255,0,45,255,24,2,201,2,230,0,34,0,3,119,0,0,35,8,14,2,62,0,0,1,6,8,30,218,220,0,9,177,3,2,184,255,220,176,51,43,0,0,0,255,255,0,45,255,24,2,202,2,239,0,34,0,3,120,0,0,35,8,14,2,63,0,0,1,6,8,32,219,220,0,9,177,3,2,184,255,220,176,51,43,0,0,0,255,255,0,12,255,246,2,122,2,160,0,34,0,47,102,0,1,7,8,18,255,123,255,220,0,9,177,1,1,184,255,220,176,51,43,0,255,255,0,12,255,246,2,128,2,160,0,34,0,47,108,0,1,6,8,21,129,220,0,9,177,1,1,184,255,220,176,51,43,0,0,0,255,255,0,12,255,246,2,241,2,166,0,35,0,47,0,221,0,0,1,6,8,40,165,220,0,9,177,1,2,184,255,220,176,51,43,0,255,255,0,12,255,246,2,236,2,166,0,35,0,47,0,216,0,0,1,6,8,24,170,220,0,9,177,1,2,184,255,220,176,51,43,0,255,255,0,12,255,246,2,249,2,165,0,35,0,47,0,229,0,0,1,6,8,26,163,220,0,9,177,1,2,184,255,220,176,51,43,0,255,255,0,12,255,246,2,246,2,159,0,35,0,47,0,226,0,0,1,6,8,28,168,220,0,9,177,1,2,184,255,220,176,51,43,0,255,255,0,12,255,246,2,138,2,140,0,34,0,47,118,0,1,6,8,36,163,202,0,9,177,1,1,184,255,202,176,51,43,0,0,0,255,255,0,12,255,246,2,120,2,163,0,34,0,47,100,0,1,7,8,15,255,95,255,219,0,9,177,1,1,184,255,219,176,51,43,0,255,255,0,12,255,244,3,31,2,160,0,34,0,78,102,0,1,7,8,18,255,123,255,220,0,9,177,1,1,184,255,220,176,51,43,0,255,255,0,12,255,244,3,37,2,160,0,34,0,78,108,0,1,6,8,21,129,220,0,9,177,1,1,184,255,220,176,51,43,0,0,0,255,255,0,12,255,244,3,150,2,166,0,35,0,78,0,221,0,0,1,6,8,40,165,220,0,9,177,1,2,184,255,220,176,51,43,0,255,255,0,12,255,244,3,145,2,166,0,35,0,78,0,216,0,0,1,6,8,24,170,220,0,9,177,1,2,184,255,220,176,51,43,0,255,255,0,12,255,244,3,158,2,165,0,35,0,78,0,229,0,0,1,6,8,26,163,220,0,9,177,1,2,184,255,220,176,51,43,0,255,255,0,12,255,244,3,155,2,159,0,35,0,78,0,226,0,0,1,6,8,28,168,220,0,9,177,1,2,184,255,220,176,51,43,0,255,255,0,12,255,244,3,120,2,230,0,35,0,78,0,191,0,0,1,6,8,30,185,220,0,9,177,1,2,184,255,220,176,51,43,0,255,255,0,12,255,244,3,121,2,239,0,35,0,78,0,192,0,0,1,6,8,32,186,220,0,9,177,1,2,184,255,220,176,51,43,0,255,255,0,12,255,244,3,47,2,140,0,34,0,78,118,0,1,6,8,36,163,202,0,9,177,1,1,184,255,202,176,51,43,0,0,0,255,255,0,12,255,244,3,29,2,163,0,34,0,78,100,0,1,7,8,15,255,95,255,219,0,9,177,1,1,184,255,219,176,51,43,0,255,255,0,58,255,24,2,185,2,134,0,34,0,78,0,0,0,3,8,14,2,33,0,0,255,255,0,12,255,24,3,31,2,134,0,39,8,18,255,123,255,194,0,34,0,78,102,0,1,3,8,14,2,135,0,0,0,9,177,0,1,184,255,194,176,51,43,0,255,255,0,12,255,24,3,37,2,160,0,34,0,78,108,0,0,35,8,14,2,141,0,0,1,6,8,21,129,220,0,9,177,2,1,184,255,220,176,51,43,0,0,0,255,255,0,12,255,24,3,150,2,166,0,35,0,78,0,221,0,0,0,35,8,14,2,254,0,0,1,6,8,40,165,220,0,9,177,2,2,184,255,220,176,51,43,0,255,255,0,12,255,24,3,145,2,166,0,35,0,78,0,216,0,0,0,35,8,14,2,249,0,0,1,6,8,24,170,220,0,9,177,2,2,184,255,220,176,51,43,0,255,255,0,12,255,24,3,158,2,165,0,35,0,78,0,229,0,0,0,35,8,14,3,6,0,0,1,6,8,26,163,220,0,9,177,2,2,184,255,220,176,51,43,0,255,255,0,12,255,24,3,155,2,159,0,35,0,78,0,226,0,0,0,35,8,14,3,3,0,0,1,6,8,28,168,220,0,9,177,2,2,184,255,220,176,51,43,0,255,255,0,12,255,24,3,120,2,230,0,35,0,78,0,191,0,0,0,35,8,14,2,224,0,0,1,6,8,30,185,220,0,9,177,2,2,184,255,220,176,51,43,0,255,255,0,12,255,24,3,121,2,239,0,35,0,78,0,192,0,0,0,35,8,14,2,225,0,0,1,6,8,32,186,220,0,9,177,2,2,184,255,220,176,51,43,0,255,255,0,12,255,244,1,158,2,160,0,34,0,83,102,0,1,7,8,18,255,123,255,220,0,9,177,1,1,184,255,220,176,51,43,0,255,255,0,12,255,244,1,164,2,160,0,34,0,83,108,0,1,6,8,21,129,220,0,9,177,1,1,184,255,220,176,51,43,0,0,0,255,255,0,12,255,244,2,21,2,166,0,35,0,83,0,221,0,0,1,6,8,40,165,220,0,9,177,1,2,184,255,220,176,51,43,0,255,255,0,12,255,244,2,16,2,166,0,35,0,83,0,216,0,0,1,6,8,24,170,220,0,9,177,1,2,184,255,220,176,51,43,0,255,255,0,12,255,244,2,29,2,165,0,35,0,83,0,229,0,0,1,6,8,26,163,220,0,9,177,1,2,184,255,220,176,51,43,0,255,255,0,12,255,244,2,26,2,159,0,35,0,83,0,226,0,0,1,6,8,28,168,220,0,9,177,1,2,184,255,220,176,51,43,0,255,255,0,12,255,244,1,247,2,230,0,35,0,83,0,191,0,0,1,6,8,30,185,220,0,9,177,1,2,184,255,220,176,51,43,0,255,255,0,12,255,244,1,248,2,239,0,35,0,83,0,192,0,0,1,6,8,32,186,220,0,9,177,1,2,184,255,220,176,51,43,0,255,255,0,12,255,244,1,174,2,140,0,34,0,83,118,0,1,6,8,36,163,202,0,9,177,1,1,184,255,202,176,51,43,0,0,0,255,255,0,12,255,244,1,156,2,163,0,34,0,83,100,0,1,7,8,15,255,95,255,219,0,9,177,1,1,184,255,219,176,51,43,0,255,255,0,56,255,244,1,56,3,40,0,34,0,83,0,0,1,7,7,231,1,124,255,246,0,9,177,1,1,184,255,246,176,51,43,0,255,255,0,31,255,244,1,74,3,10,0,34,0,83,0,0,0,3,7,237,1,123,0,0,255,255,255,252,255,244,2,185,2,160,0,34,0,127,45,0,1,7,8,18,255,107,255,220,0,9,177,2,1,184,255,220,176,51,43,0,255,255,255,252,255,244,2,191,2,160,0,34,0,127,51,0,1,7,8,21,255,113,255,220,0,9,177,2,1,184,255,220,176,51,43,0,255,255,255,252,255,244,3,48,2,166,0,35,0,127,0,164,0,0,1,6,8,40,149,220,0,9,177,2,2,184,255,220,176,51,43,0,255,255,255,252,255,244,3,43,2,166,0,35,0,127,0,159,0,0,1,6,8,24,154,220,0,9,177,2,2,184,255,220,176,51,43,0,255,255,255,252,255,244,3,56,2,165,0,35,0,127,0,172,0,0,1,6,8,26,147,220,0,9,177,2,2,184,255,220,176,51,43,0,255,255,255,252,255,244,3,53,2,159,0,35,0,127,0,169,0,0,1,6,8,28,152,220,0,9,177,2,2,184,255,220,176,51,43,0,255,255,255,252,255,244,2,201,2,140,0,34,0,127,61,0,1,6,8,36,147,202,0,9,177,2,1,184,255,202,176,51,43,0,0,0,255,255,255,252,255,244,2,183,2,163,0,34,0,127,43,0,1,7,8,15,255,79,255,219,0,9,177,2,1,184,255,219,176,51,43,0,255,255,0,12,255,248,2,124,2,160,0,34,0,163,108,0,1,6,8,21,129,220,0,9,177,2,1,184,255,220,176,51,43,0,0,0,255,255,0,4,255,250,2,220,2,160,0,35,4,80,0,168,0,0,1,7,8,21,255,121,255,220,0,9,177,1,1,184,255,220,176,51,43,0,0,0,255,255,0,4,255,250,3,72,2,166,0,35,4,80,1,20,0,0,1,6,8,24,162,220,0,9,177,1,2,184,255,220,176,51,43,0,255,255,0,4,255,250,3,82,2,159,0,35,4,80,1,30,0,0,1,6,8,28,160,220,0,9,177,1,2,184,255,220,176,51,43,0,255,255,0,4,255,250,3,48,2,239,0,35,4,80,0,252,0,0,1,6,8,32,178,220,0,9,177,1,2,184,255,220,176,51,43,0,255,255,0,4,255,250,2,230,2,140,0,35,4,80,0,178,0,0,1,6,8,36,155,202,0,9,177,1,1,184,255,202,176,51,43,0,255,255,0,4,255,250,2,212,2,163,0,35,4,80,0,160,0,0,1,7,8,15,255,87,255,219,0,9,177,1,1,184,255,219,176,51,43,0,0,0,255,255,255,227,255,250,2,52,3,40,0,34,4,80,0,0,1,7,7,231,1,208,255,246,0,9,177,1,1,184,255,246,176,51,43,0,255,255,255,227,255,250,2,52,3,10,0,34,4,80,0,0,0,3,7,237,1,207,0,0,255,255,0,41,255,250,3,51,2,160,0,34,4,84,60,0,1,6,8,18,152,220,0,9,177,1,1,184,255,220,176,51,43,0,0,0,255,255,0,41,255,250,3,57,2,160,0,34,4,84,66,0,1,6,8,21,158,220,0,9,177,1,1,184,255,220,176,51,43,0,0,0,255,255,0,41,255,250,3,170,2,166,0,35,4,84,0,179,0,0,1,6,8,40,194,220,0,9,177,1,2,184,255,220,176,51,43,0,255,255,0,41,255,250,3,165,2,166,0,35,4,84,0,174,0,0,1,6,8,24,199,220,0,9,177,1,2,184,255,220,176,51,43,0,255,255,0,41,255,250,3,178,2,165,0,35,4,84,0,187,0,0,1,6,8,26,192,220,0,9,177,1,2,184,255,220,176,51,43,0,255,255,0,41,255,250,3,175,2,159,0,35,4,84,0,184,0,0,1,6,8,28,197,220,0,9,177,1,2,184,255,220,176,51,43,0,255,255,0,41,255,250,3,140,2,230,0,35,4,84,0,149,0,0,1,6,8,30,214,220,0,9,177,1,2,184,255,220,176,51,43,0,255,255,0,41,255,250,3,141,2,239,0,35,4,84,0,150,0,0,1,6,8,32,215,220,0,9,177,1,2,184,255,220,176,51,43,0,255,255,0,41,255,250,3,67,2,140,0,34,4,84,76,0,1,6,8,36,192,202,0,9,177,1,1,184,255,202,176,51,43,0,0,0,255,255,0,41,255,250,3,49,2,163,0,34,4,84,58,0,1,7,8,15,255,124,255,219,0,9,177,1,1,184,255,219,176,51,43,0,255,255,0,42,255,24,2,247,2,137,0,34,4,84,0,0,0,3,8,14,2,48,0,0,255,255,0,41,255,24,3,51,2,137,0,38,8,18,152,194,0,34,4,84,60,0,1,3,8,14,2,108,0,0,0,9,177,0,1,184,255,194,176,51,43,0,0,0,255,255,0,41,255,24,3,57,2,160,0,34,4,84,66,0,0,35,8,14,2,114,0,0,1,6,8,21,158,220,0,9,177,2,1,184,255,220,176,51,43,0,0,0,255,255,0,41,255,24,3,170,2,166,0,35,4,84,0,179,0,0,0,35,8,14,2,227,0,0,1,6,8,40,194,220,0,9,177,2,2,184,255,220,176,51,43,0,255,255,0,41,255,24,3,165,2,166,0,35,4,84,0,174,0,0,0,35,8,14,2,222,0,0,1,6,8,24,199,220,0,9,177,2,2,184,255,220,176,51,43,0,255,255,0,41,255,24,3,178,2,165,0,35,4,84,0,187,0,0,0,35,8,14,2,235,0,0,1,6,8,26,192,220,0,9,177,2,2,184,255,220,176,51,43,0,255,255,0,41,255,24,3,175,2,159,0,35,4,84,0,184,0,0,0,35,8,14,2,232,0,0,1,6,8,28,197,220,0,9,177,2,2,184,255,220,176,51,43,0,255,255,0,41,255,24,3,140,2,230,0,35,4,84,0,149,0,0,0,35,8,14,2,197,0,0,1,6,8,30,214,220,0,9,177,2,2,184,255,220,176,51,43,0,255,255,0,41,255,24,3,141,2,239,0,35,4,84,0,150,0,0,0,35,8,14,2,198,0,0,1,6,8,32,215,220,0,9,177,2,2,184,255,220,176,51,43,0,255,255,0,45,255,246,3,133,2,137,0,34,0,3,60,0,0,3,4,226,2,132,0,0,255,255,0,45,255,246,3,148,2,137,0,38,8,18,156,194,0,34,0,3,75,0,1,3,4,226,2,147,0,0,0,9,177,0,1,184,255,194,176,51,43,0,0,0,255,255,0,45,255,246,3,133,2,160,0,34,0,3,60,0,0,35,4,226,2,132,0,0,1,6,8,21,186,220,0,9,177,3,1,184,255,220,176,51,43,0,0,0,255,255,0,45,255,246,3,222,2,166,0,35,0,3,0,149,0,0,0,35,4,226,2,221,0,0,1,6,8,40,198,220,0,9,177,3,2,184,255,220,176,51,43,0,255,255,0,45,255,246,3,217,2,166,0,35,0,3,0,144,0,0,0,35,4,226,2,216,0,0,1,6,8,24,203,220,0,9,177,3,2,184,255,220,176,51,43,0,255,255,0,45,255,246,3,230,2,165,0,35,0,3,0,157,0,0,0,35,4,226,2,229,0,0,1,6,8,26,196,220,0,9,177,3,2,184,255,220,176,51,43,0,255,255,0,45,255,246,3,227,2,159,0,35,0,3,0,154,0,0,0,35,4,226,2,226,0,0,1,6,8,28,201,220,0,9,177,3,2,184,255,220,176,51,43,0,255,255,0,45,255,246,3,192,2,230,0,34,0,3,119,0,0,35,4,226,2,191,0,0,1,6,8,30,218,220,0,9,177,3,2,184,255,220,176,51,43,0,0,0,255,255,0,45,255,246,3,193,2,239,0,34,0,3,120,0,0,35,4,226,2,192,0,0,1,6,8,32,219,220,0,9,177,3,2,184,255,220,176,51,43,0,0,0,255,255,0,58,255,244,3,243,2,134,0,34,0,78,0,0,0,3,4,226,2,242,0,0,255,255,0,12,255,244,4,89,2,134,0,39,8,18,255,123,255,194,0,34,0,78,102,0,1,3,4,226,3,88,0,0,0,9,177,0,1,184,255,194,176,51,43,0,255,255,0,12,255,244,4,95,2,160,0,34,0,78,108,0,0,35,4,226,3,94,0,0,1,6,8,21,129,220,0,9,177,2,1,184,255,220,176,51,43,0,0,0,255,255,0,12,255,244,4,208,2,166,0,35,0,78,0,221,0,0,0,35,4,226,3,207,0,0,1,6,8,40,165,220,0,9,177,2,2,184,255,220,176,51,43,0,255,255,0,12,255,244,4,203,2,166,0,35,0,78,0,216,0,0,0,35,4,226,3,202,0,0,1,6,8,24,170,220,0,9,177,2,2,184,255,220,176,51,43,0,255,255,0,12,255,244,4,216,2,165,0,35,0,78,0,229,0,0,0,35,4,226,3,215,0,0,1,6,8,26,163,220,0,9,177,2,2,184,255,220,176,51,43,0,255,255,0,12,255,244,4,213,2,159,0,35,0,78,0,226,0,0,0,35,4,226,3,212,0,0,1,6,8,28,168,220,0,9,177,2,2,184,255,220,176,51,43,0,255,255,0,12,255,244,4,178,2,230,0,35,0,78,0,191,0,0,0,35,4,226,3,177,0,0,1,6,8,30,185,220,0,9,177,2,2,184,255,220,176,51,43,0,255,255,0,12,255,244,4,179,2,239,0,35,0,78,0,192,0,0,0,35,4,226,3,178,0,0,1,6,8,32,186,220,0,9,177,2,2,184,255,220,176,51,43,0,255,255,0,42,255,246,4,34,2,137,0,34,4,84,0,0,0,3,4,226,3,33,0,0,255,255,0,41,255,246,4,94,2,137,0,38,8,18,152,194,0,34,4,84,60,0,1,3,4,226,3,93,0,0,0,9,177,0,1,184,255,194,176,51,43,0,0,0,255,255,0,41,255,246,4,100,2,160,0,34,4,84,66,0,0,35,4,226,3,99,0,0,1,6,8,21,158,220,0,9,177,2,1,184,255,220,176,51,43,0,0,0,255,255,0,41,255,246,4,213,2,166,0,35,4,84,0,179,0,0,0,35,4,226,3,212,0,0,1,6,8,40,194,220,0,9,177,2,2,184,255,220,176,51,43,0,255,255,0,41,255,246,4,208,2,166,0,35,4,84,0,174,0,0,0,35,4,226,3,207,0,0,1,6,8,24,199,220,0,9,177,2,2,184,255,220,176,51,43,0,255,255,0,41,255,246,4,221,2,165,0,35,4,84,0,187,0,0,0,35,4,226,3,220,0,0,1,6,8,26,192,220,0,9,177,2,2,184,255,220,176,51,43,0,255,255,0,41,255,246,4,218,2,159,0,35,4,84,0,184,0,0,0,35,4,226,3,217,0,0,1,6,8,28,197,220,0,9,177,2,2,184,255,220,176,51,43,0,255,255,0,41,255,246,4,183,2,230,0,35,4,84,0,149,0,0,0,35,4,226,3,182,0,0,1,6,8,30,214,220,0,9,177,2,2,184,255,220,176,51,43,0,255,255,0,41,255,246,4,184,2,239,0,35,4,84,0,150,0,0,0,35,4,226,3,183,0,0,1,6,8,32,215,220,0,9,177,2,2,184,255,220,176,51,43,0,0,2,0,48,255,246,1,254,1,208,0,32,0,44,0,68,64,65,25,1,4,2,35,27,19,5,4,3,4,2,74,23,1,2,72,0,4,4,2,95,0,2,2,73,75,0,3,3,0,95,1,1,0,0,71,75,6,1,5,5,0,95,1,1,0,0,71,0,76,33,33,33,44,33,43,38,45,22,36,18,7,10,25,43,37,6,7,38,38,39,39,6,35,34,38,38,53,52,54,54,51,22,22,23,51,54,55,55,22,23,6,7,22,22,51,50,55,4,54,55,38,38,35,34,6,6,21,20,51,1,254,15,52,50,54,1,7,92,76,32,52,31,48,81,48,43,68,11,8,35,28,13,28,25,61,58,2,44,43,23,30,254,196,90,42,12,45,38,36,60,35,55,83,66,25,2,64,58,4,130,54,92,56,72,122,72,9,94,67,77,94,5,26,33,138,95,44,43,6,35,88,80,80,71,58,101,60,100,0,2,0,78,255,20,1,232,2,225,0,24,0,51,0,74,64,71,38,24,2,4,6,51,1,3,5,10,1,0,3,14,11,2,1,0,4,74,0,4,6,5,6,4,5,126,0,5,3,6,5,3,124,0,6,6,2,95,0,2,2,72,75,0,3,3,0,95,0,0,0,77,75,0,1,1,75,1,76,42,17,37,38,36,21,22,7,10,27,43,0,22,22,21,20,6,6,35,38,39,7,19,6,7,39,19,54,54,51,50,22,22,21,20,7,2,51,50,54,54,53,52,38,35,34,7,35,38,39,55,54,55,54,54,53,52,38,35,34,6,7,17,1,112,75,45,59,105,66,54,48,8,21,28,52,11,14,2,87,78,45,73,42,95,131,61,43,75,46,46,37,42,45,12,23,14,2,19,26,67,56,33,36,78,73,4,1,105,56,82,46,53,87,49,21,35,3,254,248,10,3,11,2,203,119,128,41,71,42,89,123,254,209,38,68,44,45,52,33,31,33,10,11,5,86,108,42,34,31,145,163,254,251,0,0,0,0,1,0,18,255,20,1,197,1,204,0,34,0,41,64,38,34,1,0,1,1,74,27,20,19,10,7,5,4,1,8,0,71,0,0,0,1,95,2,1,1,1,73,0,76,32,31,23,22,18,16,3,10,20,43,36,7,22,21,7,7,39,39,54,54,55,38,38,39,46,2,35,34,7,39,52,55,50,22,23,22,23,51,54,55,55,51,22,23,1,86,97,4,1,52,17,41,6,20,32,1,9,9,9,20,30,24,25,45,6,49,59,74,22,6,7,8,47,81,20,16,32,14,206,194,57,85,83,23,2,36,69,78,75,53,84,51,56,62,28,17,6,80,31,114,125,33,53,113,171,43,23,47,0,0,0,0,2,0,32,255,249,1,217,2,231,0,38,0,53,0,59,64,56,35,1,1,2,22,1,3,1,2,74,32,1,2,72,0,2,1,2,131,0,1,3,1,131,0,3,4,3,131,5,1,4,4,0,96,0,0,0,71,0,76,39,39,39,53,39,52,47,45,38,37,21,44,6,10,22,43,18,6,21,22,22,23,30,2,21,20,6,6,35,34,38,38,53,52,54,55,22,23,55,38,38,39,38,38,53,52,54,55,22,23,7,38,38,35,18,54,54,53,52,39,38,35,34,6,6,21,20,22,51,178,9,1,34,39,58,77,59,53,92,58,56,93,53,102,86,33,51,5,17,42,31,51,48,49,47,177,80,13,76,166,32,68,71,41,20,42,38,45,75,44,58,50,2,148,9,8,14,40,38,57,90,121,67,62,102,59,59,105,65,87,112,4,5,19,5,25,45,31,51,66,36,33,42,8,44,147,20,50,78,253,165,50,87,51,52,45,22,49,83,49,59,67,0,0,0,0,1,0,50,255,244,1,124,1,203,0,48,0,54,64,51,22,21,2,3,2,33,30,10,3,4,3,2,74,0,3,0,4,5,3,4,103,0,2,2,1,95,0,1,1,73,75,0,5,5,0,95,0,0,0,77,0,76,38,36,22,37,43,20,6,10,26,43,37,6,7,6,7,34,38,53,52,54,55,38,38,53,52,54,54,51,50,23,22,23,7,38,35,34,6,21,20,22,23,54,55,23,20,7,6,35,34,39,6,6,21,20,22,51,50,54,55,1,124,3,16,66,57,93,95,44,39,35,39,56,93,54,47,35,10,1,9,37,38,61,85,33,32,60,65,9,8,33,39,21,18,48,54,50,41,40,95,44,117,34,46,38,11,56,52,35,64,25,19,58,35,36,58,33,10,32,30,7,10,51,40,19,26,5,24,1,7,36,28,11,3,9,37,24,27,31,28,26,0,0,0,1,0,45,255,77,1,127,2,226,0,49,0,60,64,18,20,1,0,1,1,74,41,37,29,28,4,1,72,6,5,2,0,71,75,176,25,80,88,64,11,0,0,1,0,132,0,1,1,70,1,76,27,64,9,0,1,0,1,131,0,0,0,116,89,182,35,33,23,22,2,10,20,43,36,22,21,20,6,7,39,55,54,54,53,52,38,38,39,38,38,53,52,54,55,6,7,34,38,53,52,54,55,23,6,21,20,22,51,50,55,55,23,22,23,23,14,2,21,20,22,22,23,1,16,44,81,85,41,5,92,67,13,36,27,75,77,90,102,41,41,42,58,40,36,14,18,43,39,25,24,55,11,29,27,3,113,129,57,25,52,62,98,58,49,61,81,28,76,13,22,34,23,10,10,10,6,18,80,76,76,190,140,11,4,38,29,24,43,14,7,30,22,24,25,4,73,1,15,27,11,140,177,111,35,24,26,17,14,0,0,0,0,1,0,7,255,19,1,186,1,204,0,43,0,42,64,39,39,33,32,23,21,20,19,7,5,4,10,0,71,1,1,0,0,2,95,4,3,2,2,2,73,0,76,0,0,0,43,0,43,20,45,46,5,10,23,43,0,22,22,21,17,7,38,39,54,55,54,54,53,52,38,35,34,6,6,15,2,38,39,55,55,54,53,52,38,35,34,7,39,54,55,50,22,7,21,23,54,54,55,1,105,52,29,9,50,37,4,1,24,18,20,21,26,64,61,22,1,18,34,39,51,7,1,36,38,26,31,8,16,51,52,55,1,6,28,67,46,1,204,58,107,68,254,58,10,9,19,33,14,204,176,43,55,51,74,126,75,87,12,3,15,164,81,8,14,43,40,7,11,64,30,72,72,43,1,70,91,28,0,0,0,3,0,57,255,248,1,150,2,222,0,15,0,24,0,34,0,157,64,10,20,1,2,3,29,1,5,4,2,74,75,176,10,80,88,64,32,0,2,0,4,5,2,4,101,7,1,3,3,1,95,6,1,1,1,72,75,8,1,5,5,0,95,0,0,0,77,0,76,27,75,176,12,80,88,64,32,0,2,0,4,5,2,4,101,7,1,3,3,1,95,6,1,1,1,72,75,8,1,5,5,0,95,0,0,0,71,0,76,27,64,32,0,2,0,4,5,2,4,101,7,1,3,3,1,95,6,1,1,1,72,75,8,1,5,5,0,95,0,0,0,77,0,76,89,89,64,26,25,25,16,16,0,0,25,34,25,33,28,27,16,24,16,23,19,18,0,15,0,14,38,9,10,21,43,0,22,22,21,20,6,6,35,34,38,38,53,52,54,54,51,6,6,7,51,55,54,38,38,35,2,54,55,7,7,6,21,20,22,51,1,31,76,43,48,84,50,47,77,43,48,84,51,24,68,16,207,5,2,19,41,27,2,70,13,208,7,1,46,40,2,222,93,164,102,106,176,101,92,164,102,107,175,102,72,137,116,5,72,113,63,253,168,160,132,12,5,18,33,102,122,0,0,1,0,75,255,246,1,1,1,202,0,17,0,44,64,41,14,7,6,3,4,1,0,15,1,2,1,2,74,0,0,0,73,75,0,1,1,2,95,3,1,2,2,77,2,76,0,0,0,17,0,17,38,20,4,10,22,43,22,38,39,3,55,22,23,3,6,21,20,22,51,50,55,23,6,7,136,56,1,4,9,45,39,33,1,28,30,28,32,5,15,51,10,74,71,1,61,6,1,19,254,227,5,10,26,26,8,12,60,32,0,0,0,1,0,9,255,245,1,246,1,208,0,45,0,42,64,39,45,40,29,21,7,5,1,0,1,74,36,34,24,22,4,0,72,14,11,3,3,1,71,0,0,1,0,131,0,1,1,116,44,42,20,18,2,10,20,43,37,6,6,7,46,2,39,39,15,2,35,39,39,55,54,53,52,35,34,7,39,54,55,22,22,21,20,7,23,55,54,54,55,22,23,7,6,6,7,6,22,51,50,55,1,246,9,47,35,51,55,26,3,7,101,12,39,1,8,41,59,20,84,21,27,5,18,53,51,54,5,7,54,64,73,44,27,14,2,52,66,30,2,41,46,38,58,107,40,60,18,4,41,90,82,4,144,63,10,2,49,81,94,49,99,6,7,65,24,4,90,81,29,42,3,75,88,73,20,27,27,12,31,56,39,95,91,32,0,1,255,252,255,246,1,203,2,226,0,33,0,49,64,46,33,22,21,15,7,5,3,1,13,1,0,3,2,74,11,1,0,71,0,1,1,2,95,0,2,2,72,75,0,3,3,0,95,0,0,0,71,0,76,37,20,47,18,4,10,24,43,37,6,7,34,38,38,39,39,35,6,7,7,39,39,18,55,39,38,38,35,34,7,39,38,55,50,22,23,19,22,22,51,50,55,1,203,7,55,29,36,25,12,71,5,73,62,8,67,5,129,63,29,16,29,27,25,64,8,2,66,51,78,24,114,12,23,21,20,46,93,67,33,19,44,43,250,202,153,4,22,8,1,22,149,103,54,41,24,9,79,29,88,84,254,107,42,33,17,0,0,0,0,1,0,75,255,16,2,25,1,207,0,46,0,58,64,55,40,38,33,27,26,19,11,5,0,9,3,2,1,74,13,1,3,1,73,36,1,2,72,18,17,15,3,0,71,0,2,2,73,75,4,1,3,3,0,95,1,1,0,0,77,0,76,44,36,31,21,18,5,10,25,43,37,6,7,34,38,39,39,6,6,35,38,39,7,7,22,23,6,7,39,19,38,53,52,55,55,51,23,3,22,22,51,50,54,55,54,55,55,22,23,6,7,7,6,22,51,50,55,2,25,13,49,53,54,4,5,31,61,42,59,31,5,1,5,43,15,68,16,20,23,9,20,14,54,32,15,36,27,42,65,28,1,17,26,37,22,29,28,1,2,33,40,27,36,87,63,35,60,67,2,70,55,34,60,3,4,136,168,5,11,11,1,160,86,68,46,61,13,28,254,253,51,43,77,73,122,94,17,22,27,115,94,15,55,50,10,0,0,1,0,0,255,246,1,127,1,207,0,30,0,39,64,36,16,2,2,0,1,1,74,30,29,2,1,72,27,24,15,8,5,5,0,71,0,0,0,1,95,0,1,1,73,0,76,20,44,2,10,22,43,0,22,23,6,7,7,38,39,39,54,53,52,38,35,34,7,39,54,55,50,22,22,21,20,7,23,54,55,38,39,55,1,83,34,10,23,171,14,27,31,1,25,43,48,23,20,7,14,47,35,55,31,7,9,94,38,1,29,21,1,185,31,19,227,171,3,8,25,14,69,93,84,75,5,9,60,36,67,117,73,49,46,5,107,133,46,71,5,0,0,0,0,1,0,17,255,76,1,96,2,230,0,60,0,44,64,41,28,1,0,1,1,74,49,46,37,36,4,1,72,60,59,57,55,24,12,11,7,0,71,0,0,1,0,132,0,1,1,70,1,76,43,41,31,30,2,10,20,43,54,21,20,22,22,23,22,22,21,20,6,7,39,55,54,54,53,52,38,39,38,38,53,52,55,38,53,52,55,6,7,34,38,53,52,54,55,23,6,21,20,22,51,50,55,54,55,31,2,6,6,21,20,22,23,54,55,23,23,21,89,22,60,62,53,57,72,81,49,4,88,69,32,50,84,87,88,75,89,24,11,44,55,42,34,15,18,38,35,15,8,47,25,11,57,4,119,109,29,38,48,72,12,51,247,81,21,23,14,6,5,62,52,55,76,32,70,15,25,34,19,15,14,4,8,87,75,67,81,36,68,71,92,4,1,36,29,23,44,14,8,30,22,23,24,1,40,20,1,44,10,79,107,38,16,25,15,39,42,2,46,10,0,2,0,41,255,244,1,195,1,208,0,15,0,29,0,44,64,41,0,2,2,0,95,0,0,0,73,75,5,1,3,3,1,95,4,1,1,1,77,1,76,16,16,0,0,16,29,16,28,23,21,0,15,0,14,38,6,10,21,43,22,38,38,53,52,54,54,51,50,22,22,21,20,6,6,35,62,2,53,52,38,35,34,6,6,21,20,22,51,181,90,50,56,98,60,56,90,50,56,97,60,13,81,50,53,46,44,82,51,53,46,12,58,104,66,70,113,65,58,104,66,69,114,65,65,63,103,57,56,67,63,103,56,57,67,0,0,1,0,4,255,243,2,37,1,208,0,43,0,57,64,54,29,27,6,3,0,2,20,7,2,1,0,2,74,37,36,2,4,72,17,1,1,71,5,3,2,2,2,4,93,0,4,4,73,75,0,0,0,1,95,0,1,1,77,1,76,22,56,38,19,37,35,6,10,26,43,36,21,20,22,51,50,55,23,14,2,35,6,38,55,55,35,3,38,39,39,54,55,35,34,6,6,7,35,39,39,54,54,51,33,50,55,23,6,6,7,7,35,7,1,131,51,53,10,24,6,1,28,36,12,56,60,3,11,111,51,62,18,5,71,20,13,45,50,36,22,7,18,1,13,88,79,1,6,44,51,8,7,21,3,9,93,27,187,18,42,40,2,7,16,43,32,1,79,70,236,254,124,14,7,14,167,186,11,30,32,13,7,67,63,12,8,22,46,6,7,178,0,2,0,56,255,21,1,202,1,206,0,17,0,29,0,61,64,58,29,1,3,4,9,8,2,0,3,13,10,2,1,0,3,74,0,4,4,2,95,5,1,2,2,73,75,0,3,3,0,95,0,0,0,77,75,0,1,1,75,1,76,0,0,27,25,20,18,0,17,0,16,21,21,6,10,22,43,0,22,22,21,20,6,35,38,39,7,19,6,7,39,19,54,54,51,2,51,50,54,54,53,52,38,35,34,6,7,1,59,91,52,117,100,66,40,9,20,35,44,11,12,3,101,86,82,58,42,71,42,55,49,76,82,4,1,206,64,112,70,105,123,25,34,5,254,248,10,3,11,1,195,110,125,254,114,47,88,58,66,74,148,142,0,0,0,1,0,43,255,74,1,73,1,202,0,34,0,30,64,27,18,1,1,0,1,74,34,19,2,1,71,0,1,1,0,95,0,0,0,73,1,76,37,45,2,10,22,43,23,55,54,54,53,52,38,39,38,38,53,52,54,54,51,50,23,22,23,7,38,35,34,6,21,20,22,22,23,22,22,21,20,6,7,129,3,81,64,27,44,83,80,50,90,58,27,34,19,8,8,32,32,78,94,21,55,57,48,54,69,77,108,13,26,34,18,17,13,5,9,99,92,72,109,59,8,38,44,10,7,88,76,34,35,19,7,6,62,52,57,79,32,0,0,0,0,2,0,37,255,244,2,16,1,208,0,22,0,37,0,43,64,40,7,1,4,0,1,74,22,1,2,72,3,1,0,0,2,93,0,2,2,73,75,0,4,4,1,95,0,1,1,77,1,76,37,37,54,37,19,5,10,25,43,1,6,7,7,35,7,22,23,20,6,35,34,38,38,53,52,54,54,51,51,50,54,55,6,38,39,35,34,6,6,21,20,22,51,50,54,54,53,2,16,11,19,10,121,5,53,23,104,90,58,94,55,57,98,60,159,37,46,24,151,33,30,23,50,82,46,59,51,42,71,41,1,200,41,28,7,8,57,87,108,132,61,106,65,65,106,61,5,7,178,72,22,50,88,54,64,72,51,87,52,0,0,1,0,2,255,251,1,151,1,208,0,35,0,49,64,46,28,26,13,3,1,0,14,1,2,1,2,74,0,1,4,72,3,1,0,0,4,93,0,4,4,73,75,0,1,1,2,95,0,2,2,71,2,76,56,19,37,37,20,5,10,25,43,1,6,6,7,7,35,7,6,21,20,22,51,50,55,23,14,2,35,34,38,55,55,14,2,7,35,39,39,54,54,51,51,50,55,1,151,7,21,3,9,131,32,3,57,58,29,16,4,1,29,38,13,65,67,4,12,39,45,35,21,7,18,1,13,88,79,122,44,51,1,200,22,46,6,7,173,15,14,41,38,2,9,16,44,32,78,71,231,1,11,30,31,13,7,67,63,12,0,1,0,11,255,243,1,149,1,208,0,39,0,54,64,51,30,12,2,0,1,28,11,5,3,2,0,2,74,31,1,1,72,0,0,0,1,95,0,1,1,73,75,0,2,2,3,95,4,1,3,3,77,3,76,0,0,0,39,0,38,41,20,40,5,10,23,43,22,38,53,52,55,55,54,53,52,35,34,7,39,54,55,50,22,21,20,7,7,6,21,20,22,51,50,54,39,38,39,55,22,23,22,21,20,6,6,35,165,65,1,25,1,58,25,28,5,19,48,43,50,3,19,2,43,35,62,65,2,28,37,13,59,32,16,46,85,56,13,61,47,13,6,177,6,11,53,7,8,66,29,61,53,16,20,123,12,7,36,47,122,113,73,64,10,25,44,68,65,80,125,70,0,3,0,35,255,15,2,43,2,140,0,27,0,36,0,44,0,42,64,39,38,36,2,1,0,1,74,23,21,19,18,17,5,0,72,9,8,6,5,3,5,1,71,0,0,1,0,131,0,1,1,116,44,43,33,32,2,10,20,43,36,6,6,7,20,23,7,38,39,55,46,2,53,52,54,54,63,2,22,23,6,7,30,2,21,6,54,53,52,38,35,35,6,7,7,19,6,6,21,20,22,51,2,43,61,107,68,4,8,36,22,4,66,103,57,60,107,68,4,7,33,26,7,4,66,102,58,159,98,89,76,2,6,2,57,7,74,99,88,77,162,104,64,5,89,130,11,7,11,212,6,64,103,63,65,105,63,5,178,11,5,13,91,81,6,64,102,64,152,114,76,64,75,136,210,6,1,88,19,118,74,62,71,0,0,1,0,24,255,15,2,22,1,205,0,45,0,60,64,57,35,34,2,1,2,45,38,30,24,23,15,7,7,3,1,13,1,0,3,3,74,32,1,2,72,9,1,0,71,0,1,1,2,95,0,2,2,73,75,0,3,3,0,95,0,0,0,75,0,76,47,21,47,19,4,10,24,43,5,6,6,7,34,38,38,39,6,7,39,38,38,39,54,55,39,46,2,35,34,6,7,39,54,55,50,22,23,23,54,55,22,23,7,7,6,7,23,30,2,51,50,55,2,22,6,40,32,51,59,52,37,91,86,8,23,20,5,95,112,16,14,21,27,22,16,40,39,6,2,50,62,84,30,8,61,99,39,23,1,54,77,64,14,23,28,39,29,36,62,115,39,64,22,45,127,136,145,164,2,21,22,15,169,178,61,53,54,26,11,14,7,81,34,99,109,29,96,145,16,36,15,66,105,98,54,85,82,48,40,0,0,0,0,1,0,12,255,15,2,44,2,140,0,50,0,66,64,63,47,1,1,2,45,42,22,13,4,3,1,4,1,0,3,3,74,23,1,1,1,73,48,40,38,37,4,2,72,9,7,6,3,0,71,0,1,1,2,95,0,2,2,73,75,0,3,3,0,95,0,0,0,77,0,76,25,20,40,26,4,10,24,43,0,21,20,6,7,20,23,7,38,39,55,38,38,53,52,55,55,54,53,52,35,34,7,39,54,55,50,22,21,20,7,7,6,21,20,22,23,19,55,22,23,6,3,54,54,39,38,39,55,22,23,2,44,112,103,4,8,36,22,4,87,96,2,23,2,56,20,34,5,19,52,43,46,4,19,2,73,65,11,7,33,26,18,3,81,81,2,35,37,15,63,33,1,72,62,115,145,15,89,132,11,7,11,210,1,67,58,7,16,155,14,6,51,8,8,65,30,56,49,23,20,105,16,6,46,57,4,2,54,11,5,13,215,254,171,11,122,106,81,56,10,24,45,0,0,1,0,49,255,244,2,92,1,204,0,52,0,45,64,42,49,47,41,35,30,22,9,7,2,4,1,74,20,1,4,72,0,4,4,73,75,3,1,2,2,0,95,1,1,0,0,77,0,76,22,46,46,36,37,5,10,25,43,0,22,21,20,6,6,35,34,38,39,6,6,35,34,38,38,53,52,54,55,55,22,23,6,6,21,20,22,51,50,55,38,53,52,55,55,22,23,22,21,20,7,22,22,51,50,54,53,38,39,55,55,51,2,52,40,39,64,36,33,78,27,25,75,41,39,63,35,57,49,14,33,28,63,75,47,47,80,33,19,11,10,37,21,5,19,14,48,37,55,56,24,71,5,53,9,1,165,115,66,65,117,70,67,49,49,62,55,98,60,77,136,37,4,11,26,54,137,58,43,46,74,44,63,46,26,6,16,25,30,24,58,47,32,30,68,72,90,104,10,32,255,255,0,75,255,246,1,1,2,200,0,34,4,226,0,0,0,2,8,15,188,0,0,0,255,255,0,11,255,246,1,1,2,117,0,34,4,226,0,0,1,7,7,242,1,56,255,246,0,9,177,1,2,184,255,246,176,51,43,0,255,255,255,248,255,246,1,18,2,187,0,34,4,226,0,0,0,2,8,16,187,0,0,0,255,255,0,11,255,243,1,149,2,200,0,34,4,238,0,0,0,2,8,15,31,0,0,0,255,255,0,11,255,243,1,149,2,127,0,34,4,238,0,0,0,3,7,186,1,172,0,0,255,255,0,11,255,243,1,149,2,187,0,34,4,238,0,0,0,2,8,16,30,0,0,0,255,255,0,41,255,244,1,195,2,200,0,34,4,232,0,0,0,2,8,15,56,0,0,0,255,255,0,49,255,244,2,92,2,200,0,34,4,242,0,0,0,3,8,15,0,132,0,0,255,255,0,48,255,246,1,254,2,200,0,34,4,218,0,0,0,2,8,15,89,0,0,0,255,255,0,50,255,244,1,124,2,200,0,34,4,222,0,0,0,2,8,15,26,0,0,0,255,255,0,7,255,19,1,186,2,200,0,34,4,224,0,0,0,2,8,15,93,0,0,0,0,1,0,9,255,19,1,238,1,208,0,57,0,57,64,54,57,52,41,33,19,5,3,2,26,23,16,11,4,1,3,2,74,48,46,36,34,4,2,72,0,2,3,2,131,0,3,1,3,131,0,1,1,0,95,0,0,0,75,0,76,56,54,32,30,39,35,4,10,22,43,37,14,2,35,34,39,38,53,52,55,55,22,51,50,54,55,38,38,39,39,15,2,35,39,39,55,54,53,52,35,34,7,39,54,55,22,22,21,20,7,23,55,54,54,55,22,23,7,6,6,7,6,22,51,50,55,1,238,43,71,73,47,25,32,38,2,8,56,41,42,65,28,67,59,5,7,101,12,39,1,8,41,59,20,84,21,27,5,18,53,51,54,5,7,54,64,73,44,27,14,2,50,64,34,2,43,53,29,47,88,123,140,62,9,38,50,17,9,4,35,66,68,7,100,110,4,144,63,10,2,49,81,96,47,99,6,7,65,24,4,90,81,29,42,3,75,88,73,20,27,27,12,31,54,43,98,86,14,0,0,0,255,255,0,57,255,248,1,150,2,222,0,2,4,225,0,0,255,255,0,35,255,15,2,43,2,140,0,2,4,239,0,0,255,255,0,4,255,243,2,37,1,208,0,2,4,233,0,0,255,255,0,9,255,245,1,246,1,208,0,2,4,227,0,0,255,255,0,48,255,246,1,254,2,196,0,34,4,218,0,0,0,2,8,17,89,0,0,0,255,255,0,48,255,246,1,254,2,196,0,34,4,218,0,0,0,2,8,20,88,0,0,0,255,255,0,48,255,246,1,254,2,202,0,34,4,218,0,0,0,2,8,22,61,0,0,0,255,255,0,48,255,246,1,254,2,202,0,34,4,218,0,0,0,2,8,23,61,0,0,0,255,255,0,48,255,246,1,254,2,201,0,34,4,218,0,0,0,2,8,25,61,0,0,0,255,255,0,48,255,246,1,254,2,195,0,34,4,218,0,0,0,2,8,27,61,0,0,0,255,255,0,48,255,246,1,254,3,10,0,34,4,218,0,0,0,2,8,29,61,0,0,0,255,255,0,48,255,246,1,254,3,19,0,34,4,218,0,0,0,2,8,31,61,0,0,0,255,255,0,48,255,246,1,254,2,194,0,34,4,218,0,0,0,2,8,36,85,0,0,0,255,255,0,48,255,246,1,254,2,200,0,34,4,218,0,0,0,2,8,15,89,0,0,0,255,255,0,48,255,246,1,254,2,160,0,34,4,218,0,0,1,6,8,38,92,236,0,9,177,2,1,184,255,236,176,51,43,0,0,0,255,255,0,48,255,246,1,254,2,150,0,34,4,218,0,0,0,3,7,199,1,230,0,0,255,255,0,48,255,246,1,254,2,121,0,34,4,218,0,0,0,3,7,205,1,229,0,0,255,255,0,48,255,24,1,254,1,208,0,34,4,218,0,0,0,3,8,14,1,200,0,0,255,255,0,48,255,24,1,254,2,194,0,34,4,218,0,0,0,35,8,14,1,200,0,0,0,2,8,36,85,0,0,0,255,255,0,48,255,24,1,254,2,200,0,34,4,218,0,0,0,35,8,14,1,200,0,0,0,2,8,15,89,0,0,0,255,255,0,48,255,24,1,254,2,196,0,34,4,218,0,0,0,35,8,14,1,200,0,0,0,2,8,17,89,0,0,0,255,255,0,48,255,24,1,254,2,196,0,34,4,218,0,0,0,35,8,14,1,200,0,0,0,2,8,20,88,0,0,0,255,255,0,48,255,24,1,254,2,202,0,34,4,218,0,0,0,35,8,14,1,200,0,0,0,2,8,22,61,0,0,0,255,255,0,48,255,24,1,254,2,202,0,34,4,218,0,0,0,35,8,14,1,200,0,0,0,2,8,23,61,0,0,0,255,255,0,48,255,24,1,254,2,201,0,34,4,218,0,0,0,35,8,14,1,200,0,0,0,2,8,25,61,0,0,0,255,255,0,48,255,24,1,254,2,195,0,34,4,218,0,0,0,35,8,14,1,200,0,0,0,2,8,27,61,0,0,0,255,255,0,48,255,24,1,254,3,10,0,34,4,218,0,0,0,35,8,14,1,200,0,0,0,2,8,29,61,0,0,0,255,255,0,48,255,24,1,254,3,19,0,34,4,218,0,0,0,35,8,14,1,200,0,0,0,2,8,31,61,0,0,0,255,255,0,48,255,24,1,254,2,145,0,34,4,218,0,0,0,35,8,14,1,200,0,0,1,6,8,38,102,221,0,9,177,3,1,184,255,221,176,51,43,0,0,0,255,255,0,50,255,244,1,124,2,196,0,34,4,222,0,0,0,2,8,17,26,0,0,0,255,255,0,50,255,244,1,124,2,196,0,34,4,222,0,0,0,2,8,20,25,0,0,0,255,255,0,50,255,244,1,124,2,202,0,34,4,222,0,0,0,2,8,22,254,0,0,0,255,255,0,50,255,244,1,124,2,202,0,34,4,222,0,0,0,2,8,23,254,0,0,0,255,255,0,50,255,244,1,124,2,201,0,34,4,222,0,0,0,2,8,25,254,0,0,0,255,255,0,50,255,244,1,124,2,195,0,34,4,222,0,0,0,2,8,27,254,0,0,0,255,255,0,50,255,244,1,124,2,194,0,34,4,222,0,0,0,2,8,36,22,0,0,0,255,255,0,50,255,244,1,124,2,200,0,34,4,222,0,0,0,2,8,15,26,0,0,0,255,255,0,7,255,19,1,186,2,196,0,34,4,224,0,0,0,2,8,17,93,0,0,0,255,255,0,7,255,19,1,186,2,196,0,34,4,224,0,0,0,2,8,20,92,0,0,0,255,255,0,7,255,19,1,186,2,202,0,34,4,224,0,0,0,2,8,22,65,0,0,0,255,255,0,7,255,19,1,186,2,202,0,34,4,224,0,0,0,2,8,23,65,0,0,0,255,255,0,7,255,19,1,186,2,201,0,34,4,224,0,0,0,2,8,25,65,0,0,0,255,255,0,7,255,19,1,186,2,195,0,34,4,224,0,0,0,2,8,27,65,0,0,0,255,255,0,7,255,19,1,186,3,10,0,34,4,224,0,0,0,2,8,29,65,0,0,0,255,255,0,7,255,19,1,186,3,19,0,34,4,224,0,0,0,2,8,31,65,0,0,0,255,255,0,7,255,19,1,186,2,194,0,34,4,224,0,0,0,2,8,36,89,0,0,0,255,255,0,7,255,19,1,186,2,200,0,34,4,224,0,0,0,2,8,15,93,0,0,0,255,255,0,7,255,19,1,186,2,160,0,34,4,224,0,0,1,6,8,38,96,236,0,9,177,1,1,184,255,236,176,51,43,0,0,0,255,255,0,7,255,19,1,186,1,204,0,34,4,224,0,0,0,3,8,14,1,41,0,0,255,255,0,7,255,19,1,186,2,194,0,34,4,224,0,0,0,35,8,14,1,41,0,0,0,2,8,36,89,0,0,0,255,255,0,7,255,19,1,186,2,200,0,34,4,224,0,0,0,35,8,14,1,41,0,0,0,2,8,15,93,0,0,0,255,255,0,7,255,19,1,186,2,196,0,34,4,224,0,0,0,35,8,14,1,41,0,0,0,2,8,17,93,0,0,0,255,255,0,7,255,19,1,186,2,196,0,34,4,224,0,0,0,35,8,14,1,41,0,0,0,2,8,20,92,0,0,0,255,255,0,7,255,19,1,186,2,202,0,34,4,224,0,0,0,35,8,14,1,41,0,0,0,2,8,22,65,0,0,0,255,255,0,7,255,19,1,186,2,202,0,34,4,224,0,0,0,35,8,14,1,41,0,0,0,2,8,23,65,0,0,0,255,255,0,7,255,19,1,186,2,201,0,34,4,224,0,0,0,35,8,14,1,41,0,0,0,2,8,25,65,0,0,0,255,255,0,7,255,19,1,186,2,195,0,34,4,224,0,0,0,35,8,14,1,41,0,0,0,2,8,27,65,0,0,0,255,255,0,7,255,19,1,186,3,10,0,34,4,224,0,0,0,35,8,14,1,41,0,0,0,2,8,29,65,0,0,0,255,255,0,7,255,19,1,186,3,19,0,34,4,224,0,0,0,35,8,14,1,41,0,0,0,2,8,31,65,0,0,0,255,255,0,7,255,19,1,186,2,145,0,34,4,224,0,0,0,35,8,14,1,41,0,0,1,6,8,38,90,221,0,9,177,2,1,184,255,221,176,51,43,0,0,0,255,255,0,75,255,246,1,1,2,196,0,34,4,226,0,0,0,2,8,17,188,0,0,0,255,255,0,68,255,246,1,1,2,196,0,34,4,226,0,0,0,2,8,20,187,0,0,0,255,255,0,13,255,246,1,1,2,202,0,34,4,226,0,0,0,2,8,22,160,0,0,0,255,255,255,245,255,246,1,1,2,202,0,34,4,226,0,0,0,2,8,23,160,0,0,0,255,255,0,26,255,246,1,17,2,201,0,34,4,226,0,0,0,2,8,25,160,0,0,0,255,255,0,2,255,246,1,3,2,195,0,34,4,226,0,0,0,2,8,27,160,0,0,0,255,255,255,243,255,246,1,1,3,10,0,34,4,226,0,0,0,2,8,29,160,0,0,0,255,255,255,242,255,246,1,1,3,19,0,34,4,226,0,0,0,2,8,31,160,0,0,0,255,255,0,33,255,246,1,1,2,194,0,34,4,226,0,0,0,2,8,36,184,0,0,0,255,255,0,75,255,246,1,1,2,200,0,34,4,226,0,0,0,2,8,15,188,0,0,0,255,255,255,222,255,246,1,9,2,145,0,34,4,226,0,0,1,6,8,38,177,221,0,9,177,1,1,184,255,221,176,51,43,0,0,0,255,255,0,10,255,246,1,1,2,150,0,34,4,226,0,0,0,3,7,199,1,73,0,0,255,255,255,236,255,246,1,23,2,121,0,34,4,226,0,0,0,3,7,205,1,72,0,0,255,255,255,244,255,246,1,21,2,186,0,34,4,226,0,0,0,2,8,33,187,0,0,0,255,255,255,245,255,246,1,22,2,185,0,34,4,226,0,0,0,2,8,34,187,0,0,0,255,255,255,223,255,246,1,7,3,0,0,34,4,226,0,0,0,2,8,35,160,0,0,0,255,255,0,41,255,244,1,195,2,196,0,34,4,232,0,0,0,2,8,17,56,0,0,0,255,255,0,41,255,244,1,195,2,196,0,34,4,232,0,0,0,2,8,20,55,0,0,0,255,255,0,41,255,244,1,195,2,202,0,34,4,232,0,0,0,2,8,22,28,0,0,0,255,255,0,41,255,244,1,195,2,202,0,34,4,232,0,0,0,2,8,23,28,0,0,0,255,255,0,41,255,244,1,195,2,201,0,34,4,232,0,0,0,2,8,25,28,0,0,0,255,255,0,41,255,244,1,195,2,195,0,34,4,232,0,0,0,2,8,27,28,0,0,0,255,255,0,41,255,244,1,195,2,194,0,34,4,232,0,0,0,2,8,36,52,0,0,0,255,255,0,41,255,244,1,195,2,200,0,34,4,232,0,0,0,2,8,15,56,0,0,0,255,255,0,56,255,21,1,202,2,196,0,34,4,234,0,0,0,2,8,17,54,0,0,0,255,255,0,56,255,21,1,202,2,196,0,34,4,234,0,0,0,2,8,20,53,0,0,0,255,255,0,11,255,243,1,149,2,196,0,34,4,238,0,0,0,2,8,17,31,0,0,0,255,255,0,11,255,243,1,149,2,196,0,34,4,238,0,0,0,2,8,20,8,0,0,0,255,255,0,11,255,243,1,149,2,202,0,34,4,238,0,0,0,2,8,22,3,0,0,0,255,255,0,11,255,243,1,149,2,202,0,34,4,238,0,0,0,2,8,23,3,0,0,0,255,255,0,11,255,243,1,149,2,201,0,34,4,238,0,0,0,2,8,25,3,0,0,0,255,255,0,11,255,243,1,149,2,195,0,34,4,238,0,0,0,2,8,27,3,0,0,0,255,255,0,11,255,243,1,149,3,10,0,34,4,238,0,0,0,2,8,29,3,0,0,0,255,255,0,11,255,243,1,149,3,19,0,34,4,238,0,0,0,2,8,31,3,0,0,0,255,255,0,11,255,243,1,149,2,194,0,34,4,238,0,0,0,2,8,36,27,0,0,0,255,255,0,11,255,243,1,149,2,200,0,34,4,238,0,0,0,2,8,15,31,0,0,0,255,255,0,11,255,243,1,149,2,145,0,34,4,238,0,0,1,6,8,9,47,221,0,9,177,1,1,184,255,221,176,51,43,0,0,0,255,255,0,11,255,243,1,149,2,150,0,34,4,238,0,0,0,3,7,199,1,172,0,0,255,255,0,11,255,243,1,149,2,121,0,34,4,238,0,0,0,3,7,205,1,171,0,0,255,255,0,11,255,243,1,149,2,186,0,34,4,238,0,0,0,2,8,33,30,0,0,0,255,255,0,11,255,243,1,149,2,185,0,34,4,238,0,0,0,2,8,34,30,0,0,0,255,255,0,11,255,243,1,149,3,0,0,34,4,238,0,0,0,2,8,35,3,0,0,0,255,255,0,49,255,244,2,92,2,196,0,34,4,242,0,0,0,3,8,17,0,132,0,0,255,255,0,49,255,244,2,92,2,196,0,34,4,242,0,0,0,3,8,20,0,131,0,0,255,255,0,49,255,244,2,92,2,202,0,34,4,242,0,0,0,2,8,22,104,0,0,0,255,255,0,49,255,244,2,92,2,202,0,34,4,242,0,0,0,2,8,23,104,0,0,0,255,255,0,49,255,244,2,92,2,201,0,34,4,242,0,0,0,2,8,25,104,0,0,0,255,255,0,49,255,244,2,92,2,195,0,34,4,242,0,0,0,2,8,27,104,0,0,0,255,255,0,49,255,244,2,92,3,10,0,34,4,242,0,0,0,2,8,29,104,0,0,0,255,255,0,49,255,244,2,92,3,19,0,34,4,242,0,0,0,2,8,31,104,0,0,0,255,255,0,49,255,244,2,92,2,194,0,34,4,242,0,0,0,3,8,36,0,128,0,0,255,255,0,49,255,244,2,92,2,200,0,34,4,242,0,0,0,3,8,15,0,132,0,0,255,255,0,49,255,244,2,92,2,145,0,34,4,242,0,0,1,7,8,38,0,140,255,221,0,9,177,1,1,184,255,221,176,51,43,0,255,255,0,49,255,24,2,92,1,204,0,34,4,242,0,0,0,3,8,14,1,229,0,0,255,255,0,49,255,24,2,92,2,194,0,34,4,242,0,0,0,35,8,14,1,229,0,0,0,3,8,36,0,128,0,0,255,255,0,49,255,24,2,92,2,200,0,34,4,242,0,0,0,35,8,14,1,229,0,0,0,3,8,15,0,132,0,0,255,255,0,49,255,24,2,92,2,196,0,34,4,242,0,0,0,35,8,14,1,229,0,0,0,3,8,17,0,132,0,0,255,255,0,49,255,24,2,92,2,196,0,34,4,242,0,0,0,35,8,14,1,229,0,0,0,3,8,20,0,131,0,0,255,255,0,49,255,24,2,92,2,202,0,34,4,242,0,0,0,35,8,14,1,229,0,0,0,2,8,22,104,0,0,0,255,255,0,49,255,24,2,92,2,202,0,34,4,242,0,0,0,35,8,14,1,229,0,0,0,2,8,23,104,0,0,0,255,255,0,49,255,24,2,92,2,201,0,34,4,242,0,0,0,35,8,14,1,229,0,0,0,2,8,25,104,0,0,0,255,255,0,49,255,24,2,92,2,195,0,34,4,242,0,0,0,35,8,14,1,229,0,0,0,2,8,27,104,0,0,0,255,255,0,49,255,24,2,92,3,10,0,34,4,242,0,0,0,35,8,14,1,229,0,0,0,2,8,29,104,0,0,0,255,255,0,49,255,24,2,92,3,19,0,34,4,242,0,0,0,35,8,14,1,229,0,0,0,2,8,31,104,0,0,0,255,255,0,49,255,24,2,92,2,145,0,34,4,242,0,0,0,35,8,14,1,229,0,0,1,7,8,38,0,140,255,221,0,9,177,2,1,184,255,221,176,51,43,0,0,1,0,75,255,248,0,238,1,141,0,17,0,52,177,6,100,68,64,41,15,1,1,0,1,74,14,9,6,4,3,5,0,72,0,0,1,1,0,87,0,0,0,1,95,2,1,1,0,1,79,0,0,0,17,0,17,43,3,10,21,43,177,6,0,68,22,38,39,3,55,22,23,7,6,21,20,22,51,50,55,23,6,7,130,50,1,4,9,42,38,30,1,23,24,23,29,6,13,47,8,63,61,1,19,6,3,16,243,4,8,22,20,7,11,55,30,0,0,0,0,1,0,18,255,20,3,69,1,204,0,65,0,53,64,50,65,1,0,2,1,74,58,47,40,39,30,27,25,24,21,10,7,5,4,1,14,0,71,1,1,0,0,2,95,4,3,2,2,2,58,0,76,63,62,54,52,43,42,38,36,18,16,5,9,20,43,36,7,22,21,7,7,39,39,54,54,55,38,38,39,46,2,35,34,7,6,7,22,21,7,7,39,39,54,54,55,38,38,39,46,2,35,34,7,39,52,55,50,22,23,22,23,51,54,63,2,23,50,22,23,22,23,51,54,55,55,51,22,23,2,214,97,4,1,52,17,41,6,20,32,1,9,9,9,20,30,24,17,33,96,87,4,1,52,17,41,6,20,32,1,9,9,9,20,30,24,25,45,6,49,59,74,22,6,7,8,37,64,37,29,41,59,74,22,6,7,8,47,81,20,16,32,14,206,194,57,85,83,23,2,36,69,78,75,53,84,51,56,62,28,10,160,176,57,85,83,23,2,36,69,78,75,53,84,51,56,62,28,17,6,80,31,114,125,33,53,90,133,81,22,1,114,125,33,53,113,171,43,23,47,0,0,1,255,252,255,246,3,57,2,226,0,63,0,59,64,56,63,52,51,45,32,31,25,17,7,9,4,2,23,1,0,4,2,74,21,1,0,71,6,1,3,5,1,2,4,3,2,103,7,1,4,4,0,95,1,1,0,0,59,0,76,37,20,39,21,20,47,40,18,8,9,28,43,37,6,7,34,38,38,39,39,35,6,7,7,39,46,2,39,39,35,6,7,7,39,39,18,55,39,38,38,35,34,7,39,38,55,50,22,23,19,22,22,51,50,55,54,55,39,38,38,35,34,7,39,38,55,50,22,23,19,22,22,51,50,55,3,57,7,55,29,36,25,12,71,5,62,62,34,30,29,36,25,12,71,5,73,62,8,67,5,129,63,29,16,29,27,25,64,8,2,66,51,78,24,114,12,22,21,5,12,103,58,29,16,29,27,25,64,8,2,66,51,78,24,114,12,23,21,20,46,93,67,33,19,44,43,250,175,154,28,1,1,18,45,42,250,202,153,4,22,8,1,22,149,103,54,41,24,9,79,29,88,84,254,107,43,32,2,220,139,103,54,41,24,9,79,29,88,84,254,107,42,33,17,0,255,255,0,0,255,249,1,250,1,251,0,2,2,4,0,0,255,255,0,54,255,247,1,210,1,246,0,2,2,33,0,0,0,1,0,54,255,247,1,167,1,252,0,42,1,42,75,176,8,80,88,64,18,8,1,2,0,19,1,3,2,2,74,15,1,1,72,42,1,4,71,27,75,176,10,80,88,64,15,19,8,2,3,0,1,74,15,1,1,72,42,1,4,71,27,75,176,11,80,88,64,18,8,1,2,0,19,1,3,2,2,74,15,1,1,72,42,1,4,71,27,75,176,27,80,88,64,15,19,8,2,3,0,1,74,15,1,1,72,42,1,4,71,27,64,18,8,1,2,0,19,1,3,2,2,74,15,1,1,72,42,1,4,71,89,89,89,89,75,176,8,80,88,64,28,0,0,1,2,2,0,112,0,2,2,1,94,0,1,1,38,75,0,3,3,4,93,0,4,4,39,4,76,27,75,176,10,80,88,64,22,2,1,0,0,1,93,0,1,1,38,75,0,3,3,4,93,0,4,4,39,4,76,27,75,176,11,80,88,64,28,0,0,1,2,2,0,112,0,2,2,1,94,0,1,1,38,75,0,3,3,4,93,0,4,4,39,4,76,27,75,176,27,80,88,64,22,2,1,0,0,1,93,0,1,1,38,75,0,3,3,4,93,0,4,4,39,4,76,27,64,28,0,0,1,2,2,0,112,0,2,2,1,94,0,1,1,38,75,0,3,3,4,93,0,4,4,39,4,76,89,89,89,89,183,66,54,42,67,22,5,7,25,43,55,54,54,53,19,52,38,35,7,39,55,50,23,23,50,55,23,6,7,7,54,53,52,38,38,35,34,6,6,7,3,20,22,51,50,55,23,7,39,38,35,34,7,59,37,26,1,12,18,27,2,6,34,21,68,161,66,3,12,7,48,2,12,37,45,30,23,6,1,11,14,22,5,51,3,7,71,19,27,50,60,33,7,27,33,1,61,25,17,2,5,38,1,1,10,6,74,92,4,29,30,29,23,7,3,11,15,254,186,31,21,3,5,44,2,1,9,0,0,0,0,2,0,20,0,0,1,188,1,252,0,8,0,15,0,30,64,27,11,2,2,1,72,2,1,1,1,0,93,0,0,0,39,0,76,9,9,9,15,9,13,23,3,7,21,43,55,19,55,51,22,18,23,7,33,37,55,3,35,3,23,23,20,191,72,6,5,110,40,6,254,102,1,56,6,108,7,132,3,125,10,1,228,14,26,254,148,113,5,57,9,1,94,254,157,4,3,0,0,0,255,255,0,54,255,248,1,197,1,251,0,2,2,48,0,0,255,255,0,36,255,253,1,192,1,252,0,2,2,245,0,0,255,255,0,54,255,247,2,74,1,249,0,2,2,82,0,0,0,3,0,41,255,247,2,32,1,251,0,15,0,29,0,43,0,111,64,11,37,36,2,4,2,30,1,3,5,2,74,75,176,8,80,88,64,31,0,4,0,5,3,4,5,101,0,2,2,0,95,0,0,0,38,75,7,1,3,3,1,95,6,1,1,1,39,1,76,27,64,31,0,4,0,5,3,4,5,101,0,2,2,0,95,0,0,0,38,75,7,1,3,3,1,95,6,1,1,1,41,1,76,89,64,22,16,16,0,0,41,38,35,31,16,29,16,28,23,21,0,15,0,14,38,8,7,21,43,22,38,38,53,52,54,54,51,50,22,22,21,20,6,6,35,54,54,53,52,38,38,35,34,6,21,20,22,22,51,39,55,23,22,51,50,55,23,7,38,35,34,6,7,202,104,57,71,123,76,69,106,58,72,125,77,99,93,45,80,53,73,90,43,79,51,133,13,64,48,18,39,74,5,13,102,28,19,68,26,9,60,110,72,77,126,71,60,109,72,78,125,72,47,106,87,66,100,55,106,86,66,101,55,177,64,1,2,10,5,65,3,6,4,0,255,255,0,53,255,247,1,15,1,249,0,2,2,87,0,0,255,255,0,54,255,245,2,13,1,249,0,2,2,109,0,0,0,1,0,0,255,249,1,251,1,251,0,44,0,36,64,33,1,1,1,0,1,74,29,7,2,0,72,44,1,1,71,0,0,0,1,93,2,1,1,1,39,1,76,79,83,45,3,7,23,43,5,55,54,54,53,52,39,3,35,3,6,21,20,22,51,51,23,7,38,38,35,34,6,35,55,54,54,55,19,55,23,22,18,23,22,22,23,23,7,34,38,35,34,6,7,1,25,4,42,28,6,97,8,117,6,21,25,44,2,5,11,71,34,31,52,9,6,23,26,13,156,72,7,12,80,34,10,32,34,2,6,10,53,27,41,75,11,2,37,3,12,14,14,19,1,60,254,194,19,9,16,14,3,39,1,4,2,42,2,25,30,1,141,13,1,42,254,242,101,28,24,3,3,37,2,6,1,0,0,0,255,255,0,45,255,242,2,157,1,247,0,2,2,121,0,0,255,255,0,51,255,228,2,67,1,248,0,2,2,123,0,0,0,3,0,44,255,254,1,211,1,252,0,21,0,35,0,56,0,128,64,29,1,1,2,0,29,28,21,3,3,1,50,40,38,22,4,5,4,53,36,2,6,5,4,74,7,6,2,0,72,75,176,19,80,88,64,36,0,1,2,3,2,1,112,0,3,0,4,5,3,4,101,0,2,2,0,93,0,0,0,38,75,0,5,5,6,93,0,6,6,39,6,76,27,64,37,0,1,2,3,2,1,3,126,0,3,0,4,5,3,4,101,0,2,2,0,93,0,0,0,38,75,0,5,5,6,93,0,6,6,39,6,76,89,64,10,40,58,52,54,52,20,50,7,7,27,43,18,55,55,23,51,50,55,23,6,7,7,54,53,52,38,35,35,34,6,6,7,7,23,55,22,51,50,54,55,23,7,38,35,34,6,7,7,38,39,55,55,30,2,51,51,50,54,54,55,55,23,6,7,7,39,7,64,3,13,178,44,105,51,4,17,3,50,1,25,39,127,38,36,20,9,45,59,14,108,31,21,73,28,6,14,108,32,20,74,28,64,3,7,3,39,8,21,36,37,134,37,35,20,9,41,3,6,5,13,191,186,1,186,48,11,2,9,6,64,65,3,8,14,29,18,9,26,30,4,153,69,3,6,4,6,69,3,6,4,201,80,31,5,5,31,29,10,9,27,30,4,4,42,75,12,3,3,0,255,255,0,41,255,247,2,32,1,251,0,2,2,133,0,0,0,1,0,53,255,248,2,48,1,249,0,59,0,58,64,55,52,27,2,2,4,1,74,15,1,1,72,59,1,3,71,0,0,1,4,4,0,112,0,4,4,1,94,0,1,1,38,75,5,1,2,2,3,93,6,1,3,3,39,3,76,67,38,55,67,42,66,38,7,7,27,43,55,54,54,53,19,52,38,35,7,39,55,22,51,33,50,55,7,6,6,7,6,6,21,20,22,51,50,55,23,7,39,38,35,35,55,54,54,53,17,52,38,35,35,34,6,7,6,21,20,22,51,50,55,23,7,39,38,35,34,7,58,38,26,1,13,17,33,2,5,60,42,1,39,26,74,4,33,24,1,4,6,14,20,19,16,2,8,55,18,30,99,5,36,27,18,21,109,35,29,1,11,14,21,23,18,2,7,60,19,32,30,70,32,8,26,32,1,63,25,17,2,5,38,2,7,41,5,17,22,81,193,53,32,21,2,4,40,1,1,39,3,24,31,1,55,24,16,15,22,187,131,32,21,2,4,40,1,1,8,0,255,255,0,58,255,250,1,197,1,245,0,2,2,169,0,0,255,255,0,26,255,253,1,172,1,252,0,2,5,145,0,0,0,1,0,26,255,253,1,172,1,252,0,29,0,55,64,52,23,16,15,10,9,1,6,2,1,26,1,3,2,2,74,7,6,2,0,72,29,1,3,71,0,1,1,0,93,0,0,0,38,75,0,2,2,3,93,0,3,3,39,3,76,24,35,39,35,4,7,24,43,55,55,39,55,55,54,55,23,22,23,7,38,38,35,35,23,7,7,51,50,54,54,55,55,23,6,7,7,37,7,26,190,178,10,199,78,67,8,2,7,43,6,46,53,124,148,1,169,160,38,39,21,9,43,3,14,4,13,254,222,68,34,202,229,29,5,2,7,8,72,67,7,55,43,187,20,179,15,40,43,4,3,78,76,13,4,5,255,255,0,17,255,252,1,199,1,251,0,2,2,192,0,0,0,1,255,246,255,251,1,225,1,245,0,42,0,54,64,51,13,1,1,5,1,74,19,1,2,71,0,5,0,1,0,5,1,126,3,1,0,0,4,95,6,1,4,4,38,75,0,1,1,2,94,0,2,2,39,2,76,34,18,35,26,51,38,49,7,7,27,43,1,7,38,35,34,6,6,7,7,6,22,51,50,55,23,7,39,39,34,7,55,62,2,53,53,52,38,38,35,39,55,54,51,50,22,23,51,54,54,51,50,23,1,225,2,5,11,48,86,55,4,1,1,16,22,10,30,2,8,34,77,35,68,5,30,27,10,52,93,61,2,11,33,33,63,87,20,10,24,87,55,22,24,1,202,7,1,79,137,83,61,30,22,3,4,42,1,2,5,42,3,13,30,31,28,91,140,78,5,32,13,109,104,101,110,9,0,3,0,36,255,224,2,62,2,16,0,48,0,56,0,65,0,133,64,20,43,34,2,4,5,19,9,2,1,0,2,74,39,1,6,72,15,1,2,71,75,176,29,80,88,64,41,7,1,4,10,1,9,8,4,9,103,11,1,8,3,1,0,1,8,0,103,0,5,5,6,93,0,6,6,38,75,0,1,1,2,93,0,2,2,39,2,76,27,64,38,7,1,4,10,1,9,8,4,9,103,11,1,8,3,1,0,1,8,0,103,0,1,0,2,1,2,97,0,5,5,6,93,0,6,6,38,5,76,89,64,18,63,61,59,58,54,52,20,38,35,35,21,23,51,35,18,12,7,29,43,36,6,6,7,21,20,22,51,50,55,23,7,39,39,34,7,55,54,54,53,53,35,34,38,53,52,54,54,55,53,52,38,35,34,7,39,55,23,50,55,7,6,6,7,7,51,50,22,21,4,22,51,55,35,34,6,21,36,38,39,6,7,51,50,54,53,2,62,59,108,69,14,22,11,30,2,8,28,82,34,67,6,37,26,22,98,111,58,106,68,12,18,23,10,2,6,102,43,56,3,34,22,2,1,17,97,112,254,51,81,73,1,10,69,76,1,128,79,72,5,2,13,69,76,214,83,48,2,10,33,22,3,4,41,1,2,9,41,7,27,33,5,84,74,53,83,49,2,15,25,16,1,4,38,1,6,41,4,17,23,17,84,74,69,72,253,61,55,43,72,1,148,105,60,56,0,0,255,255,0,20,255,250,2,38,1,248,0,2,2,234,0,0,0,1,0,23,255,248,2,86,1,249,0,65,0,80,64,77,65,38,2,7,8,36,1,6,0,16,1,2,1,3,74,54,1,8,72,23,1,3,71,5,1,0,7,6,7,0,6,126,9,1,6,4,1,1,2,6,1,103,0,7,7,8,93,0,8,8,38,75,0,2,2,3,93,0,3,3,39,3,76,61,60,50,35,23,21,22,67,35,21,49,10,7,29,43,1,7,38,35,34,6,7,14,2,7,7,20,22,51,50,55,23,7,39,38,35,34,7,55,54,54,53,53,46,2,39,38,38,35,7,39,55,23,30,2,23,53,54,38,35,7,39,55,22,51,50,55,7,6,6,7,6,7,62,2,55,55,2,86,3,6,9,18,17,8,17,45,72,58,2,14,21,22,20,2,7,60,19,33,31,70,5,38,27,64,73,44,17,5,10,15,17,4,97,10,14,33,51,44,1,13,17,33,2,5,60,42,35,65,4,33,23,1,5,3,46,53,33,14,10,1,204,35,1,23,31,63,71,31,2,112,32,21,2,4,40,1,1,8,40,7,27,33,106,2,31,76,74,22,16,2,36,18,7,88,92,40,3,169,25,17,2,5,38,2,7,41,5,17,22,91,81,3,39,92,89,7,0,1,0,44,255,252,2,117,1,252,0,49,0,48,64,45,28,22,2,3,0,4,30,0,2,3,0,2,74,0,4,4,1,95,0,1,1,38,75,2,1,0,0,3,93,5,1,3,3,39,3,76,23,39,22,24,39,37,6,7,26,43,55,38,39,55,22,22,51,51,53,38,38,53,52,54,54,51,50,22,22,21,20,6,7,21,51,50,54,55,55,6,7,7,39,39,55,54,54,53,52,38,35,34,6,21,20,22,23,23,7,7,58,3,11,41,9,31,37,71,69,73,66,117,72,68,106,59,78,71,80,36,32,9,42,13,2,14,228,5,10,60,55,85,73,72,87,61,52,10,6,220,9,49,71,3,45,32,8,42,114,65,63,103,58,54,97,63,72,121,38,8,31,43,4,63,61,13,5,7,63,44,96,63,82,95,91,76,64,115,35,63,7,4,0,0,255,255,0,53,255,247,1,15,2,245,0,34,2,87,0,0,1,6,8,15,218,45,0,8,177,1,1,176,45,176,51,43,255,255,0,41,255,247,1,22,2,162,0,34,2,87,0,0,1,7,7,242,1,86,0,35,0,8,177,1,2,176,35,176,51,43,0,0,255,255,0,24,255,247,1,50,2,232,0,34,2,87,0,0,1,6,8,16,219,45,0,8,177,1,3,176,45,176,51,43,255,255,255,246,255,251,1,225,2,245,0,34,5,147,0,0,1,6,8,15,38,45,0,8,177,1,1,176,45,176,51,43,255,255,255,246,255,251,1,225,2,172,0,34,5,147,0,0,1,7,7,186,1,179,0,45,0,8,177,1,2,176,45,176,51,43,0,0,255,255,255,246,255,251,1,225,2,232,0,34,5,147,0,0,1,6,8,16,37,45,0,8,177,1,3,176,45,176,51,43,255,255,0,41,255,247,2,32,2,245,0,34,2,133,0,0,1,6,8,15,95,45,0,8,177,2,1,176,45,176,51,43,255,255,0,44,255,252,2,117,2,245,0,34,5,151,0,0,1,7,8,15,0,138,0,45,0,8,177,1,1,176,45,176,51,43,0,0,255,255,0,0,255,249,1,250,2,245,0,34,2,4,0,0,1,6,8,15,57,45,0,8,177,2,1,176,45,176,51,43,255,255,0,54,255,248,1,197,2,245,0,34,2,48,0,0,1,6,8,15,56,45,0,8,177,1,1,176,45,176,51,43,255,255,0,54,255,247,2,74,2,245,0,34,2,82,0,0,1,6,8,15,122,45,0,8,177,1,1,176,45,176,51,43,0,1,0,53,255,248,1,15,1,149,0,36,0,47,64,44,20,1,2,0,29,1,3,2,2,74,16,1,1,72,36,1,3,71,0,1,0,0,2,1,0,103,0,2,2,3,93,0,3,3,47,3,76,68,42,66,38,4,8,24,43,55,54,54,53,55,52,38,35,7,39,55,50,22,51,50,54,55,7,6,6,7,6,21,20,22,51,50,54,55,23,7,34,38,35,34,6,7,58,38,26,1,12,18,33,2,5,6,53,43,21,65,10,4,34,21,2,7,14,21,14,23,4,2,7,12,66,33,27,63,10,32,6,26,31,225,24,16,1,5,37,2,5,1,40,4,16,22,101,132,31,21,2,1,4,39,2,7,1,0,0,2,0,54,255,50,2,12,1,249,0,31,0,77,0,218,64,26,60,1,1,2,73,53,30,13,4,3,1,48,1,6,0,43,1,5,6,4,74,62,20,2,2,72,75,176,8,80,88,64,36,0,5,0,4,5,4,99,0,1,1,2,95,8,7,2,2,2,38,75,9,1,3,3,0,93,0,0,0,39,75,0,6,6,39,6,76,27,75,176,12,80,88,64,36,0,5,0,4,5,4,99,0,1,1,2,95,8,7,2,2,2,38,75,9,1,3,3,0,93,0,0,0,39,75,0,6,6,41,6,76,27,75,176,14,80,88,64,36,0,5,0,4,5,4,99,0,1,1,2,95,8,7,2,2,2,38,75,9,1,3,3,0,93,0,0,0,39,75,0,6,6,39,6,76,27,64,36,0,5,0,4,5,4,99,0,1,1,2,95,8,7,2,2,2,38,75,9,1,3,3,0,93,0,0,0,39,75,0,6,6,41,6,76,89,89,89,64,14,77,76,17,44,20,39,38,40,67,23,64,10,7,29,43,5,39,38,35,7,55,54,54,53,19,52,38,35,7,39,55,23,22,51,50,55,7,6,6,7,3,6,22,51,50,55,23,5,14,2,35,34,39,38,53,52,55,55,22,51,50,54,55,6,35,34,39,39,55,55,54,53,52,38,39,39,55,22,51,55,54,51,23,7,6,6,7,7,23,22,22,23,1,3,57,19,30,99,8,37,23,1,12,18,27,2,6,54,16,25,27,68,4,31,22,1,9,1,15,21,18,18,2,1,2,33,59,63,41,20,31,38,1,9,51,38,37,58,23,5,6,44,48,138,1,140,25,24,26,2,6,57,37,35,26,19,4,6,22,37,39,120,131,29,44,28,2,1,1,1,40,4,23,33,1,63,24,17,2,5,38,1,1,7,41,5,20,22,254,188,31,22,2,4,11,87,100,46,7,35,49,13,7,5,27,52,55,1,66,190,14,138,24,16,10,12,2,4,38,5,1,2,6,36,7,28,39,118,166,37,28,1,0,255,255,0,0,255,249,1,250,2,241,0,34,2,4,0,0,1,6,8,17,57,45,0,8,177,2,1,176,45,176,51,43,255,255,0,0,255,249,1,250,2,241,0,34,2,4,0,0,1,6,8,20,56,45,0,8,177,2,1,176,45,176,51,43,255,255,0,0,255,249,1,250,2,247,0,34,2,4,0,0,1,6,8,22,29,45,0,8,177,2,2,176,45,176,51,43,255,255,0,0,255,249,1,250,2,247,0,34,2,4,0,0,1,6,8,23,29,45,0,8,177,2,2,176,45,176,51,43,255,255,0,0,255,249,1,250,2,246,0,34,2,4,0,0,1,6,8,25,29,45,0,8,177,2,2,176,45,176,51,43,255,255,0,0,255,249,1,250,2,240,0,34,2,4,0,0,1,6,8,27,29,45,0,8,177,2,2,176,45,176,51,43,255,255,0,0,255,249,1,250,3,55,0,34,2,4,0,0,1,6,8,29,29,45,0,8,177,2,2,176,45,176,51,43,255,255,0,0,255,249,1,250,3,64,0,34,2,4,0,0,1,6,8,31,29,45,0,8,177,2,2,176,45,176,51,43,255,255,0,0,255,249,1,250,2,239,0,34,2,4,0,0,1,6,8,36,53,45,0,8,177,2,1,176,45,176,51,43,255,255,0,0,255,249,1,250,2,245,0,34,2,4,0,0,1,6,8,15,57,45,0,8,177,2,1,176,45,176,51,43,255,255,0,0,255,249,1,250,2,205,0,34,2,4,0,0,1,6,8,38,60,25,0,8,177,2,1,176,25,176,51,43,255,255,0,0,255,249,1,250,2,195,0,34,2,4,0,0,1,7,7,199,1,198,0,45,0,8,177,2,1,176,45,176,51,43,0,0,255,255,0,0,255,249,1,250,2,166,0,34,2,4,0,0,1,7,7,205,1,197,0,45,0,8,177,2,1,176,45,176,51,43,0,0,255,255,0,0,255,24,1,250,1,251,0,34,2,4,0,0,0,3,8,14,1,158,0,0,255,255,0,0,255,24,1,250,2,239,0,34,2,4,0,0,0,35,8,14,1,158,0,0,1,6,8,36,53,45,0,8,177,3,1,176,45,176,51,43,255,255,0,0,255,24,1,250,2,245,0,34,2,4,0,0,0,35,8,14,1,158,0,0,1,6,8,15,57,45,0,8,177,3,1,176,45,176,51,43,255,255,0,0,255,24,1,250,2,241,0,34,2,4,0,0,0,35,8,14,1,158,0,0,1,6,8,17,57,45,0,8,177,3,1,176,45,176,51,43,255,255,0,0,255,24,1,250,2,241,0,34,2,4,0,0,0,35,8,14,1,158,0,0,1,6,8,20,56,45,0,8,177,3,1,176,45,176,51,43,255,255,0,0,255,24,1,250,2,247,0,34,2,4,0,0,0,35,8,14,1,158,0,0,1,6,8,22,29,45,0,8,177,3,2,176,45,176,51,43,255,255,0,0,255,24,1,250,2,247,0,34,2,4,0,0,0,35,8,14,1,158,0,0,1,6,8,23,29,45,0,8,177,3,2,176,45,176,51,43,255,255,0,0,255,24,1,250,2,246,0,34,2,4,0,0,0,35,8,14,1,158,0,0,1,6,8,25,29,45,0,8,177,3,2,176,45,176,51,43,255,255,0,0,255,24,1,250,2,240,0,34,2,4,0,0,0,35,8,14,1,158,0,0,1,6,8,27,29,45,0,8,177,3,2,176,45,176,51,43,255,255,0,0,255,24,1,250,3,55,0,34,2,4,0,0,0,35,8,14,1,158,0,0,1,6,8,29,29,45,0,8,177,3,2,176,45,176,51,43,255,255,0,0,255,24,1,250,3,64,0,34,2,4,0,0,0,35,8,14,1,158,0,0,1,6,8,31,29,45,0,8,177,3,2,176,45,176,51,43,255,255,0,0,255,24,1,250,2,205,0,34,2,4,0,0,0,35,8,14,1,158,0,0,1,6,8,38,60,25,0,8,177,3,1,176,25,176,51,43,255,255,0,54,255,248,1,197,2,241,0,34,2,48,0,0,1,6,8,17,56,45,0,8,177,1,1,176,45,176,51,43,255,255,0,54,255,248,1,197,2,241,0,34,2,48,0,0,1,6,8,20,55,45,0,8,177,1,1,176,45,176,51,43,255,255,0,54,255,248,1,197,2,247,0,34,2,48,0,0,1,6,8,22,28,45,0,8,177,1,2,176,45,176,51,43,255,255,0,54,255,248,1,197,2,247,0,34,2,48,0,0,1,6,8,23,28,45,0,8,177,1,2,176,45,176,51,43,255,255,0,54,255,248,1,197,2,246,0,34,2,48,0,0,1,6,8,25,28,45,0,8,177,1,2,176,45,176,51,43,255,255,0,54,255,248,1,197,2,240,0,34,2,48,0,0,1,6,8,27,28,45,0,8,177,1,2,176,45,176,51,43,255,255,0,54,255,248,1,197,2,239,0,34,2,48,0,0,1,6,8,36,52,45,0,8,177,1,1,176,45,176,51,43,255,255,0,54,255,248,1,197,2,245,0,34,2,48,0,0,1,6,8,15,56,45,0,8,177,1,1,176,45,176,51,43,255,255,0,54,255,247,2,74,2,241,0,34,2,82,0,0,1,6,8,17,122,45,0,8,177,1,1,176,45,176,51,43,255,255,0,54,255,247,2,74,2,241,0,34,2,82,0,0,1,6,8,20,121,45,0,8,177,1,1,176,45,176,51,43,255,255,0,54,255,247,2,74,2,247,0,34,2,82,0,0,1,6,8,22,94,45,0,8,177,1,2,176,45,176,51,43,255,255,0,54,255,247,2,74,2,247,0,34,2,82,0,0,1,6,8,23,94,45,0,8,177,1,2,176,45,176,51,43,255,255,0,54,255,247,2,74,2,246,0,34,2,82,0,0,1,6,8,25,94,45,0,8,177,1,2,176,45,176,51,43,255,255,0,54,255,247,2,74,2,240,0,34,2,82,0,0,1,6,8,27,94,45,0,8,177,1,2,176,45,176,51,43,255,255,0,54,255,247,2,74,3,55,0,34,2,82,0,0,1,6,8,29,94,45,0,8,177,1,2,176,45,176,51,43,255,255,0,54,255,247,2,74,3,64,0,34,2,82,0,0,1,6,8,31,94,45,0,8,177,1,2,176,45,176,51,43,255,255,0,54,255,247,2,74,2,239,0,34,2,82,0,0,1,6,8,36,118,45,0,8,177,1,1,176,45,176,51,43,255,255,0,54,255,247,2,74,2,245,0,34,2,82,0,0,1,6,8,15,122,45,0,8,177,1,1,176,45,176,51,43,255,255,0,54,255,247,2,74,2,205,0,34,2,82,0,0,1,6,8,38,125,25,0,8,177,1,1,176,25,176,51,43,255,255,0,54,255,24,2,74,1,249,0,34,2,82,0,0,0,3,8,14,1,223,0,0,255,255,0,54,255,24,2,74,2,239,0,34,2,82,0,0,0,35,8,14,1,223,0,0,1,6,8,36,118,45,0,8,177,2,1,176,45,176,51,43,255,255,0,54,255,24,2,74,2,245,0,34,2,82,0,0,0,35,8,14,1,223,0,0,1,6,8,15,122,45,0,8,177,2,1,176,45,176,51,43,255,255,0,54,255,24,2,74,2,241,0,34,2,82,0,0,0,35,8,14,1,223,0,0,1,6,8,17,122,45,0,8,177,2,1,176,45,176,51,43,255,255,0,54,255,24,2,74,2,241,0,34,2,82,0,0,0,35,8,14,1,223,0,0,1,6,8,20,121,45,0,8,177,2,1,176,45,176,51,43,255,255,0,54,255,24,2,74,2,247,0,34,2,82,0,0,0,35,8,14,1,223,0,0,1,6,8,22,94,45,0,8,177,2,2,176,45,176,51,43,255,255,0,54,255,24,2,74,2,247,0,34,2,82,0,0,0,35,8,14,1,223,0,0,1,6,8,23,94,45,0,8,177,2,2,176,45,176,51,43,255,255,0,54,255,24,2,74,2,246,0,34,2,82,0,0,0,35,8,14,1,223,0,0,1,6,8,25,94,45,0,8,177,2,2,176,45,176,51,43,255,255,0,54,255,24,2,74,2,240,0,34,2,82,0,0,0,35,8,14,1,223,0,0,1,6,8,27,94,45,0,8,177,2,2,176,45,176,51,43,255,255,0,54,255,24,2,74,3,55,0,34,2,82,0,0,0,35,8,14,1,223,0,0,1,6,8,29,94,45,0,8,177,2,2,176,45,176,51,43,255,255,0,54,255,24,2,74,3,64,0,34,2,82,0,0,0,35,8,14,1,223,0,0,1,6,8,31,94,45,0,8,177,2,2,176,45,176,51,43,255,255,0,54,255,24,2,74,2,205,0,34,2,82,0,0,0,35,8,14,1,223,0,0,1,6,8,38,125,25,0,8,177,2,1,176,25,176,51,43,255,255,0,53,255,247,1,15,2,241,0,34,2,87,0,0,1,6,8,17,218,45,0,8,177,1,1,176,45,176,51,43,255,255,0,53,255,247,1,15,2,241,0,34,2,87,0,0,1,6,8,20,217,45,0,8,177,1,1,176,45,176,51,43,255,255,0,43,255,247,1,15,2,247,0,34,2,87,0,0,1,6,8,22,190,45,0,8,177,1,2,176,45,176,51,43,255,255,0,19,255,247,1,15,2,247,0,34,2,87,0,0,1,6,8,23,190,45,0,8,177,1,2,176,45,176,51,43,255,255,0,53,255,247,1,47,2,246,0,34,2,87,0,0,1,6,8,25,190,45,0,8,177,1,2,176,45,176,51,43,255,255,0,32,255,247,1,33,2,240,0,34,2,87,0,0,1,6,8,27,190,45,0,8,177,1,2,176,45,176,51,43,255,255,0,17,255,247,1,30,3,55,0,34,2,87,0,0,1,6,8,29,190,45,0,8,177,1,2,176,45,176,51,43,255,255,0,16,255,247,1,29,3,64,0,34,2,87,0,0,1,6,8,31,190,45,0,8,177,1,2,176,45,176,51,43,255,255,0,53,255,247,1,15,2,239,0,34,2,87,0,0,1,6,8,36,214,45,0,8,177,1,1,176,45,176,51,43,255,255,0,53,255,247,1,15,2,245,0,34,2,87,0,0,1,6,8,15,218,45,0,8,177,1,1,176,45,176,51,43,255,255,0,12,255,247,1,55,2,205,0,34,2,87,0,0,1,6,8,38,223,25,0,8,177,1,1,176,25,176,51,43,255,255,0,40,255,247,1,24,2,195,0,34,2,87,0,0,1,7,7,199,1,103,0,45,0,8,177,1,1,176,45,176,51,43,0,0,255,255,0,10,255,247,1,53,2,166,0,34,2,87,0,0,1,7,7,205,1,102,0,45,0,8,177,1,1,176,45,176,51,43,0,0,255,255,0,20,255,247,1,53,2,231,0,34,2,87,0,0,1,6,8,33,219,45,0,8,177,1,3,176,45,176,51,43,255,255,0,21,255,247,1,54,2,230,0,34,2,87,0,0,1,6,8,34,219,45,0,8,177,1,3,176,45,176,51,43,255,255,255,255,255,247,1,39,3,45,0,34,2,87,0,0,1,6,8,35,192,45,0,8,177,1,3,176,45,176,51,43,255,255,0,41,255,247,2,32,2,241,0,34,2,133,0,0,1,6,8,17,95,45,0,8,177,2,1,176,45,176,51,43,255,255,0,41,255,247,2,32,2,241,0,34,2,133,0,0,1,6,8,20,94,45,0,8,177,2,1,176,45,176,51,43,255,255,0,41,255,247,2,32,2,247,0,34,2,133,0,0,1,6,8,22,67,45,0,8,177,2,2,176,45,176,51,43,255,255,0,41,255,247,2,32,2,247,0,34,2,133,0,0,1,6,8,23,67,45,0,8,177,2,2,176,45,176,51,43,255,255,0,41,255,247,2,32,2,246,0,34,2,133,0,0,1,6,8,25,67,45,0,8,177,2,2,176,45,176,51,43,255,255,0,41,255,247,2,32,2,240,0,34,2,133,0,0,1,6,8,27,67,45,0,8,177,2,2,176,45,176,51,43,255,255,0,41,255,247,2,32,2,239,0,34,2,133,0,0,1,6,8,36,91,45,0,8,177,2,1,176,45,176,51,43,255,255,0,41,255,247,2,32,2,245,0,34,2,133,0,0,1,6,8,15,95,45,0,8,177,2,1,176,45,176,51,43,255,255,0,58,255,250,1,197,2,241,0,34,2,169,0,0,1,6,8,17,42,45,0,8,177,2,1,176,45,176,51,43,255,255,0,58,255,250,1,197,2,241,0,34,2,169,0,0,1,6,8,20,49,45,0,8,177,2,1,176,45,176,51,43,255,255,255,246,255,251,1,225,2,241,0,34,5,147,0,0,1,6,8,17,38,45,0,8,177,1,1,176,45,176,51,43,255,255,255,246,255,251,1,225,2,241,0,34,5,147,0,0,1,6,8,20,37,45,0,8,177,1,1,176,45,176,51,43,255,255,255,246,255,251,1,225,2,247,0,34,5,147,0,0,1,6,8,22,10,45,0,8,177,1,2,176,45,176,51,43,255,255,255,246,255,251,1,225,2,247,0,34,5,147,0,0,1,6,8,23,10,45,0,8,177,1,2,176,45,176,51,43,255,255,255,246,255,251,1,225,2,246,0,34,5,147,0,0,1,6,8,25,10,45,0,8,177,1,2,176,45,176,51,43,255,255,255,246,255,251,1,225,2,240,0,34,5,147,0,0,1,6,8,27,10,45,0,8,177,1,2,176,45,176,51,43,255,255,255,246,255,251,1,225,3,55,0,34,5,147,0,0,1,6,8,29,10,45,0,8,177,1,2,176,45,176,51,43,255,255,255,246,255,251,1,225,3,64,0,34,5,147,0,0,1,6,8,31,10,45,0,8,177,1,2,176,45,176,51,43,255,255,255,246,255,251,1,225,2,239,0,34,5,147,0,0,1,6,8,36,34,45,0,8,177,1,1,176,45,176,51,43,255,255,255,246,255,251,1,225,2,245,0,34,5,147,0,0,1,6,8,15,38,45,0,8,177,1,1,176,45,176,51,43,255,255,255,246,255,251,1,225,2,205,0,34,5,147,0,0,1,6,8,38,41,25,0,8,177,1,1,176,25,176,51,43,255,255,255,246,255,251,1,225,2,195,0,34,5,147,0,0,1,7,7,199,1,179,0,45,0,8,177,1,1,176,45,176,51,43,0,0,255,255,255,246,255,251,1,225,2,166,0,34,5,147,0,0,1,7,7,205,1,178,0,45,0,8,177,1,1,176,45,176,51,43,0,0,255,255,255,246,255,251,1,225,2,231,0,34,5,147,0,0,1,6,8,33,37,45,0,8,177,1,3,176,45,176,51,43,255,255,255,246,255,251,1,225,2,230,0,34,5,147,0,0,1,6,8,34,37,45,0,8,177,1,3,176,45,176,51,43,255,255,255,246,255,251,1,225,3,45,0,34,5,147,0,0,1,6,8,35,10,45,0,8,177,1,3,176,45,176,51,43,255,255,0,44,255,252,2,117,2,241,0,34,5,151,0,0,1,7,8,17,0,138,0,45,0,8,177,1,1,176,45,176,51,43,0,0,255,255,0,44,255,252,2,117,2,241,0,34,5,151,0,0,1,7,8,20,0,137,0,45,0,8,177,1,1,176,45,176,51,43,0,0,255,255,0,44,255,252,2,117,2,247,0,34,5,151,0,0,1,6,8,22,110,45,0,8,177,1,2,176,45,176,51,43,255,255,0,44,255,252,2,117,2,247,0,34,5,151,0,0,1,6,8,23,110,45,0,8,177,1,2,176,45,176,51,43,255,255,0,44,255,252,2,117,2,246,0,34,5,151,0,0,1,6,8,25,110,45,0,8,177,1,2,176,45,176,51,43,255,255,0,44,255,252,2,117,2,240,0,34,5,151,0,0,1,6,8,27,110,45,0,8,177,1,2,176,45,176,51,43,255,255,0,44,255,252,2,117,3,55,0,34,5,151,0,0,1,6,8,29,110,45,0,8,177,1,2,176,45,176,51,43,255,255,0,44,255,252,2,117,3,64,0,34,5,151,0,0,1,6,8,31,110,45,0,8,177,1,2,176,45,176,51,43,255,255,0,44,255,252,2,117,2,239,0,34,5,151,0,0,1,7,8,36,0,134,0,45,0,8,177,1,1,176,45,176,51,43,0,0,255,255,0,44,255,252,2,117,2,245,0,34,5,151,0,0,1,7,8,15,0,138,0,45,0,8,177,1,1,176,45,176,51,43,0,0,255,255,0,44,255,252,2,117,2,205,0,34,5,151,0,0,1,7,8,38,0,141,0,25,0,8,177,1,1,176,25,176,51,43,0,0,255,255,0,44,255,24,2,117,1,252,0,34,5,151,0,0,0,3,8,14,1,240,0,0,255,255,0,44,255,24,2,117,2,239,0,34,5,151,0,0,0,35,8,14,1,240,0,0,1,7,8,36,0,134,0,45,0,8,177,2,1,176,45,176,51,43,0,0,255,255,0,44,255,24,2,117,2,245,0,34,5,151,0,0,0,35,8,14,1,240,0,0,1,7,8,15,0,138,0,45,0,8,177,2,1,176,45,176,51,43,0,0,255,255,0,44,255,24,2,117,2,241,0,34,5,151,0,0,0,35,8,14,1,240,0,0,1,7,8,17,0,138,0,45,0,8,177,2,1,176,45,176,51,43,0,0,255,255,0,44,255,24,2,117,2,241,0,34,5,151,0,0,0,35,8,14,1,240,0,0,1,7,8,20,0,137,0,45,0,8,177,2,1,176,45,176,51,43,0,0,255,255,0,44,255,24,2,117,2,247,0,34,5,151,0,0,0,35,8,14,1,240,0,0,1,6,8,22,110,45,0,8,177,2,2,176,45,176,51,43,255,255,0,44,255,24,2,117,2,247,0,34,5,151,0,0,0,35,8,14,1,240,0,0,1,6,8,23,110,45,0,8,177,2,2,176,45,176,51,43,255,255,0,44,255,24,2,117,2,246,0,34,5,151,0,0,0,35,8,14,1,240,0,0,1,6,8,25,110,45,0,8,177,2,2,176,45,176,51,43,255,255,0,44,255,24,2,117,2,240,0,34,5,151,0,0,0,35,8,14,1,240,0,0,1,6,8,27,110,45,0,8,177,2,2,176,45,176,51,43,255,255,0,44,255,24,2,117,3,55,0,34,5,151,0,0,0,35,8,14,1,240,0,0,1,6,8,29,110,45,0,8,177,2,2,176,45,176,51,43,255,255,0,44,255,24,2,117,3,64,0,34,5,151,0,0,0,35,8,14,1,240,0,0,1,6,8,31,110,45,0,8,177,2,2,176,45,176,51,43,255,255,0,44,255,24,2,117,2,205,0,34,5,151,0,0,0,35,8,14,1,240,0,0,1,7,8,38,0,141,0,25,0,8,177,2,1,176,25,176,51,43,0,0,255,255,255,241,255,246,3,87,2,137,0,34,0,3,0,0,0,3,2,87,2,72,0,0,255,255,0,45,255,246,3,147,2,137,0,38,8,18,201,194,0,34,0,3,60,0,1,3,2,87,2,132,0,0,0,9,177,0,1,184,255,194,176,51,43,0,0,0,255,255,0,45,255,246,3,147,2,160,0,34,0,3,60,0,0,35,2,87,2,132,0,0,1,6,8,21,186,220,0,9,177,3,1,184,255,220,176,51,43,0,0,0,255,255,0,45,255,246,3,236,2,166,0,35,0,3,0,149,0,0,0,35,2,87,2,221,0,0,1,6,8,40,198,220,0,9,177,3,2,184,255,220,176,51,43,0,255,255,0,45,255,246,3,231,2,166,0,35,0,3,0,144,0,0,0,35,2,87,2,216,0,0,1,6,8,24,203,220,0,9,177,3,2,184,255,220,176,51,43,0,255,255,0,45,255,246,3,244,2,165,0,35,0,3,0,157,0,0,0,35,2,87,2,229,0,0,1,6,8,26,196,220,0,9,177,3,2,184,255,220,176,51,43,0,255,255,0,45,255,246,3,241,2,159,0,35,0,3,0,154,0,0,0,35,2,87,2,226,0,0,1,6,8,28,201,220,0,9,177,3,2,184,255,220,176,51,43,0,255,255,0,45,255,246,3,206,2,230,0,34,0,3,119,0,0,35,2,87,2,191,0,0,1,6,8,30,218,220,0,9,177,3,2,184,255,220,176,51,43,0,0,0,255,255,0,45,255,246,3,207,2,239,0,34,0,3,120,0,0,35,2,87,2,192,0,0,1,6,8,32,219,220,0,9,177,3,2,184,255,220,176,51,43,0,0,0,255,255,0,58,255,244,4,1,2,134,0,34,0,78,0,0,0,3,2,87,2,242,0,0,255,255,0,12,255,244,4,103,2,134,0,39,8,18,255,123,255,194,0,34,0,78,102,0,1,3,2,87,3,88,0,0,0,9,177,0,1,184,255,194,176,51,43,0,255,255,0,12,255,244,4,109,2,160,0,34,0,78,108,0,0,35,2,87,3,94,0,0,1,6,8,21,129,220,0,9,177,2,1,184,255,220,176,51,43,0,0,0,255,255,0,12,255,244,4,222,2,166,0,35,0,78,0,221,0,0,0,35,2,87,3,207,0,0,1,6,8,40,165,220,0,9,177,2,2,184,255,220,176,51,43,0,255,255,0,12,255,244,4,217,2,166,0,35,0,78,0,216,0,0,0,35,2,87,3,202,0,0,1,6,8,24,170,220,0,9,177,2,2,184,255,220,176,51,43,0,255,255,0,12,255,244,4,230,2,165,0,35,0,78,0,229,0,0,0,35,2,87,3,215,0,0,1,6,8,26,163,220,0,9,177,2,2,184,255,220,176,51,43,0,255,255,0,12,255,244,4,227,2,159,0,35,0,78,0,226,0,0,0,35,2,87,3,212,0,0,1,6,8,28,168,220,0,9,177,2,2,184,255,220,176,51,43,0,255,255,0,12,255,244,4,192,2,230,0,35,0,78,0,191,0,0,0,35,2,87,3,177,0,0,1,6,8,30,185,220,0,9,177,2,2,184,255,220,176,51,43,0,255,255,0,12,255,244,4,193,2,239,0,35,0,78,0,192,0,0,0,35,2,87,3,178,0,0,1,6,8,32,186,220,0,9,177,2,2,184,255,220,176,51,43,0,255,255,0,42,255,247,4,48,2,137,0,34,4,84,0,0,0,3,2,87,3,33,0,0,255,255,0,41,255,247,4,108,2,137,0,38,8,18,152,194,0,34,4,84,60,0,1,3,2,87,3,93,0,0,0,9,177,0,1,184,255,194,176,51,43,0,0,0,255,255,0,41,255,247,4,114,2,160,0,34,4,84,66,0,0,35,2,87,3,99,0,0,1,6,8,21,158,220,0,9,177,2,1,184,255,220,176,51,43,0,0,0,255,255,0,41,255,247,4,227,2,166,0,35,4,84,0,179,0,0,0,35,2,87,3,212,0,0,1,6,8,40,194,220,0,9,177,2,2,184,255,220,176,51,43,0,255,255,0,41,255,247,4,222,2,166,0,35,4,84,0,174,0,0,0,35,2,87,3,207,0,0,1,6,8,24,199,220,0,9,177,2,2,184,255,220,176,51,43,0,255,255,0,41,255,247,4,235,2,165,0,35,4,84,0,187,0,0,0,35,2,87,3,220,0,0,1,6,8,26,192,220,0,9,177,2,2,184,255,220,176,51,43,0,255,255,0,41,255,247,4,232,2,159,0,35,4,84,0,184,0,0,0,35,2,87,3,217,0,0,1,6,8,28,197,220,0,9,177,2,2,184,255,220,176,51,43,0,255,255,0,41,255,247,4,197,2,230,0,35,4,84,0,149,0,0,0,35,2,87,3,182,0,0,1,6,8,30,214,220,0,9,177,2,2,184,255,220,176,51,43,0,255,255,0,41,255,247,4,198,2,239,0,35,4,84,0,150,0,0,0,35,2,87,3,183,0,0,1,6,8,32,215,220,0,9,177,2,2,184,255,220,176,51,43,0,255,255,0,0,255,248,3,13,1,251,0,34,2,4,0,0,0,3,5,163,1,254,0,0,255,255,0,0,255,248,3,13,2,239,0,34,2,4,0,0,0,35,5,163,1,254,0,0,1,6,8,36,53,45,0,8,177,3,1,176,45,176,51,43,255,255,0,0,255,248,3,13,2,245,0,34,2,4,0,0,0,35,5,163,1,254,0,0,1,6,8,15,57,45,0,8,177,3,1,176,45,176,51,43,255,255,0,0,255,248,3,13,2,241,0,34,2,4,0,0,0,35,5,163,1,254,0,0,1,6,8,17,57,45,0,8,177,3,1,176,45,176,51,43,255,255,0,0,255,248,3,13,2,241,0,34,2,4,0,0,0,35,5,163,1,254,0,0,1,6,8,20,56,45,0,8,177,3,1,176,45,176,51,43,255,255,0,0,255,248,3,13,2,247,0,34,2,4,0,0,0,35,5,163,1,254,0,0,1,6,8,22,29,45,0,8,177,3,2,176,45,176,51,43,255,255,0,0,255,248,3,13,2,247,0,34,2,4,0,0,0,35,5,163,1,254,0,0,1,6,8,23,29,45,0,8,177,3,2,176,45,176,51,43,255,255,0,0,255,248,3,13,2,246,0,34,2,4,0,0,0,35,5,163,1,254,0,0,1,6,8,25,29,45,0,8,177,3,2,176,45,176,51,43,255,255,0,0,255,248,3,13,2,240,0,34,2,4,0,0,0,35,5,163,1,254,0,0,1,6,8,27,29,45,0,8,177,3,2,176,45,176,51,43,255,255,0,0,255,248,3,13,3,55,0,34,2,4,0,0,0,35,5,163,1,254,0,0,1,6,8,29,29,45,0,8,177,3,2,176,45,176,51,43,255,255,0,0,255,248,3,13,3,64,0,34,2,4,0,0,0,35,5,163,1,254,0,0,1,6,8,31,29,45,0,8,177,3,2,176,45,176,51,43,255,255,0,0,255,248,3,13,2,205,0,34,2,4,0,0,0,35,5,163,1,254,0,0,1,6,8,38,60,25,0,8,177,3,1,176,25,176,51,43,255,255,0,54,255,247,3,142,1,249,0,34,2,82,0,0,0,3,5,163,2,127,0,0,255,255,0,54,255,247,3,142,2,239,0,34,2,82,0,0,0,35,5,163,2,127,0,0,1,6,8,36,118,45,0,8,177,2,1,176,45,176,51,43,255,255,0,54,255,247,3,142,2,245,0,34,2,82,0,0,0,35,5,163,2,127,0,0,1,6,8,15,122,45,0,8,177,2,1,176,45,176,51,43,255,255,0,54,255,247,3,142,2,241,0,34,2,82,0,0,0,35,5,163,2,127,0,0,1,6,8,17,122,45,0,8,177,2,1,176,45,176,51,43,255,255,0,54,255,247,3,142,2,241,0,34,2,82,0,0,0,35,5,163,2,127,0,0,1,6,8,20,121,45,0,8,177,2,1,176,45,176,51,43,255,255,0,54,255,247,3,142,2,247,0,34,2,82,0,0,0,35,5,163,2,127,0,0,1,6,8,22,94,45,0,8,177,2,2,176,45,176,51,43,255,255,0,54,255,247,3,142,2,247,0,34,2,82,0,0,0,35,5,163,2,127,0,0,1,6,8,23,94,45,0,8,177,2,2,176,45,176,51,43,255,255,0,54,255,247,3,142,2,246,0,34,2,82,0,0,0,35,5,163,2,127,0,0,1,6,8,25,94,45,0,8,177,2,2,176,45,176,51,43,255,255,0,54,255,247,3,142,2,240,0,34,2,82,0,0,0,35,5,163,2,127,0,0,1,6,8,27,94,45,0,8,177,2,2,176,45,176,51,43,255,255,0,54,255,247,3,142,3,55,0,34,2,82,0,0,0,35,5,163,2,127,0,0,1,6,8,29,94,45,0,8,177,2,2,176,45,176,51,43,255,255,0,54,255,247,3,142,3,64,0,34,2,82,0,0,0,35,5,163,2,127,0,0,1,6,8,31,94,45,0,8,177,2,2,176,45,176,51,43,255,255,0,54,255,247,3,142,2,205,0,34,2,82,0,0,0,35,5,163,2,127,0,0,1,6,8,38,125,25,0,8,177,2,1,176,25,176,51,43,255,255,0,44,255,248,3,176,1,252,0,34,5,151,0,0,0,3,5,163,2,161,0,0,255,255,0,44,255,248,3,176,2,239,0,34,5,151,0,0,0,35,5,163,2,161,0,0,1,7,8,36,0,134,0,45,0,8,177,2,1,176,45,176,51,43,0,0,255,255,0,44,255,248,3,176,2,245,0,34,5,151,0,0,0,35,5,163,2,161,0,0,1,7,8,15,0,138,0,45,0,8,177,2,1,176,45,176,51,43,0,0,255,255,0,44,255,248,3,176,2,241,0,34,5,151,0,0,0,35,5,163,2,161,0,0,1,7,8,17,0,138,0,45,0,8,177,2,1,176,45,176,51,43,0,0,255,255,0,44,255,248,3,176,2,241,0,34,5,151,0,0,0,35,5,163,2,161,0,0,1,7,8,20,0,137,0,45,0,8,177,2,1,176,45,176,51,43,0,0,255,255,0,44,255,248,3,176,2,247,0,34,5,151,0,0,0,35,5,163,2,161,0,0,1,6,8,22,110,45,0,8,177,2,2,176,45,176,51,43,255,255,0,44,255,248,3,176,2,247,0,34,5,151,0,0,0,35,5,163,2,161,0,0,1,6,8,23,110,45,0,8,177,2,2,176,45,176,51,43,255,255,0,44,255,248,3,176,2,246,0,34,5,151,0,0,0,35,5,163,2,161,0,0,1,6,8,25,110,45,0,8,177,2,2,176,45,176,51,43,255,255,0,44,255,248,3,176,2,240,0,34,5,151,0,0,0,35,5,163,2,161,0,0,1,6,8,27,110,45,0,8,177,2,2,176,45,176,51,43,255,255,0,44,255,248,3,176,3,55,0,34,5,151,0,0,0,35,5,163,2,161,0,0,1,6,8,29,110,45,0,8,177,2,2,176,45,176,51,43,255,255,0,44,255,248,3,176,3,64,0,34,5,151,0,0,0,35,5,163,2,161,0,0,1,6,8,31,110,45,0,8,177,2,2,176,45,176,51,43,255,255,0,44,255,248,3,176,2,205,0,34,5,151,0,0,0,35,5,163,2,161,0,0,1,7,8,38,0,141,0,25,0,8,177,2,1,176,25,176,51,43,0,0,255,255,0,105,255,24,0,184,255,224,0,3,8,14,1,62,0,0,0,0,0,2,255,248,1,76,1,168,3,1,0,46,0,52,0,65,64,62,26,4,2,1,0,1,1,2,1,2,74,38,1,1,1,73,50,49,31,3,4,72,46,19,2,2,71,5,1,4,0,0,1,4,0,103,0,1,1,2,95,3,1,2,2,92,2,76,48,47,47,52,48,52,44,40,67,38,39,6,11,23,43,19,55,54,54,53,52,39,39,35,34,7,7,6,21,20,22,51,51,23,7,38,38,35,34,6,35,55,54,54,55,19,55,23,22,22,23,22,22,23,23,7,34,38,35,34,6,7,39,50,55,39,35,7,225,3,34,21,5,16,65,35,32,19,5,15,19,32,3,5,9,61,28,28,45,7,5,17,21,9,124,89,7,10,66,24,8,24,25,3,5,9,47,24,36,66,9,31,32,21,43,8,54,1,81,37,3,9,12,8,17,55,4,54,17,5,12,10,4,38,1,3,2,41,2,21,22,1,80,11,3,37,231,76,23,21,2,4,36,2,5,1,193,3,151,154,0,0,0,3,0,29,1,75,1,136,2,252,0,38,0,53,0,63,0,71,64,68,14,1,0,1,53,1,4,0,27,1,7,4,3,74,2,1,2,71,0,1,5,1,0,4,1,0,103,0,4,0,7,6,4,7,101,0,6,6,2,95,8,3,2,2,2,92,2,76,0,0,63,62,58,56,48,47,41,40,0,38,0,37,42,117,25,9,11,23,43,18,6,7,55,54,54,53,19,52,38,35,34,6,35,39,55,50,22,51,50,54,51,50,22,21,20,6,7,22,22,21,20,6,35,34,38,39,38,35,54,22,23,20,54,54,53,52,38,35,34,6,7,6,7,7,20,22,51,50,54,53,52,39,7,99,61,9,5,30,20,1,10,13,7,14,2,4,6,11,54,24,25,60,12,69,72,39,35,45,53,96,76,13,23,10,38,14,52,43,16,29,23,50,52,7,4,1,4,2,4,31,37,35,40,75,65,1,82,6,1,41,6,22,26,1,6,19,15,2,5,38,2,3,52,50,33,51,17,11,50,38,58,73,2,1,4,240,4,1,2,17,33,26,35,34,5,8,50,74,156,22,18,37,32,59,15,1,0,1,0,29,1,75,1,95,3,1,0,39,0,115,64,23,8,1,3,0,34,1,4,2,35,1,5,4,3,74,15,14,2,1,72,39,1,5,71,75,176,12,80,88,64,33,0,0,1,3,3,0,112,0,2,3,4,3,2,112,0,1,0,3,2,1,3,103,0,4,4,5,93,0,5,5,88,5,76,27,64,34,0,0,1,3,3,0,112,0,2,3,4,3,2,4,126,0,1,0,3,2,1,3,103,0,4,4,5,93,0,5,5,88,5,76,89,64,9,35,38,37,20,51,22,6,11,26,43,19,54,54,53,19,52,38,35,7,39,55,22,51,50,55,23,6,7,7,54,53,52,38,38,35,34,6,6,21,3,20,22,51,50,55,23,7,39,34,7,34,29,21,1,9,14,22,3,5,58,58,140,49,4,12,3,54,3,9,29,33,21,18,5,9,12,17,16,30,4,7,100,41,63,1,116,5,24,28,1,1,22,14,2,5,38,2,8,7,82,69,3,36,20,22,18,7,3,9,11,254,250,25,17,4,7,45,2,7,0,0,0,2,0,8,1,82,1,126,3,1,0,8,0,15,0,30,64,27,11,2,2,1,72,2,1,1,1,0,93,0,0,0,88,0,76,9,9,9,15,9,13,23,3,11,21,43,19,19,55,51,22,18,23,7,33,37,55,3,35,3,23,23,8,153,89,6,8,85,33,6,254,151,1,2,4,78,8,98,3,92,1,91,1,155,11,42,254,222,94,5,58,8,1,24,254,228,4,2,0,0,0,1,0,29,1,75,1,118,3,1,0,56,0,73,64,70,17,1,3,1,41,40,27,26,4,4,3,46,1,6,5,3,74,24,23,2,2,72,7,1,0,71,0,1,2,3,3,1,112,0,2,0,3,4,2,3,103,0,4,0,5,6,4,5,101,0,6,6,0,93,0,0,0,88,0,76,37,51,35,42,51,40,51,7,11,27,43,1,6,7,7,38,35,34,7,55,54,54,53,19,52,38,35,34,7,39,55,22,51,50,55,23,6,7,7,54,53,52,38,38,35,34,6,21,7,23,50,55,23,7,38,35,34,7,7,20,22,22,51,50,54,54,55,55,1,118,12,6,6,127,83,53,58,5,29,21,1,9,14,10,12,3,5,58,58,149,57,4,11,4,54,2,12,36,44,26,13,5,65,24,56,5,9,48,43,20,32,2,6,18,23,48,42,18,5,49,1,204,61,59,7,5,7,42,4,24,28,1,1,22,14,2,5,38,2,8,7,54,63,4,14,13,20,17,6,7,16,108,1,6,5,53,2,4,101,19,15,5,10,30,36,5,0,0,0,1,0,16,1,79,1,117,3,1,0,26,0,48,64,45,9,1,0,1,20,6,2,2,0,23,1,3,2,3,74,26,1,3,71,0,1,0,0,2,1,0,101,0,2,2,3,93,0,3,3,88,3,76,23,35,40,17,4,11,24,43,19,19,7,6,6,7,7,54,54,55,55,31,2,6,7,55,54,54,55,55,6,6,7,7,37,7,16,243,96,44,34,4,50,2,9,1,7,120,192,11,121,129,115,35,38,9,51,2,13,2,12,254,251,50,1,106,1,99,5,4,34,47,4,13,89,38,6,7,3,25,156,197,7,2,49,52,5,14,94,40,12,4,5,0,0,0,0,1,0,30,1,76,1,226,2,254,0,68,0,80,64,77,28,9,2,0,1,36,27,21,8,4,2,0,56,43,2,5,8,3,74,32,13,2,1,72,68,63,2,6,71,4,1,1,3,1,0,2,1,0,103,0,2,0,8,5,2,8,101,9,7,2,5,5,6,95,10,1,6,6,92,6,76,67,64,61,59,35,17,51,41,35,36,38,35,22,11,11,29,43,19,54,54,53,19,52,38,35,7,39,55,23,50,55,7,6,6,7,7,23,50,55,53,54,38,35,34,7,39,55,23,50,55,7,6,6,7,6,21,20,22,51,50,55,23,7,38,35,7,55,54,54,53,53,35,34,7,7,20,22,51,55,23,7,38,35,34,6,7,35,30,19,1,10,15,21,3,5,80,29,65,4,26,15,1,4,95,41,45,1,10,15,9,12,3,5,81,29,65,3,25,16,2,9,12,17,15,12,3,6,52,43,90,6,29,20,82,17,84,1,11,16,26,3,6,24,51,30,64,13,1,116,5,22,28,1,4,21,14,2,6,36,1,5,41,5,16,29,97,1,5,105,21,14,2,6,36,1,5,40,4,14,19,151,114,27,19,2,4,40,2,1,40,1,25,37,88,6,99,27,18,1,4,39,2,4,2,0,0,0,0,3,0,21,1,74,1,183,3,0,0,13,0,25,0,39,0,65,64,62,32,31,2,4,2,26,1,3,5,2,74,0,0,0,2,4,0,2,103,0,4,0,5,3,4,5,101,7,1,3,3,1,95,6,1,1,1,92,1,76,14,14,0,0,37,33,30,27,14,25,14,24,20,18,0,13,0,12,37,8,11,21,43,18,38,53,52,54,54,51,50,22,21,20,6,6,35,54,54,53,52,38,35,34,6,21,20,22,51,39,55,22,51,50,55,23,7,34,39,39,34,6,7,125,104,57,102,64,89,106,58,103,65,76,69,73,62,56,66,71,60,102,11,75,23,31,54,5,11,29,18,50,18,49,19,1,74,112,95,67,105,59,111,94,67,106,60,49,82,70,85,97,82,70,84,98,138,62,3,8,6,61,1,1,4,4,0,0,0,1,0,29,1,76,0,223,2,254,0,28,0,48,64,45,9,1,0,1,17,8,2,2,0,2,74,13,1,1,72,28,1,3,71,0,1,0,0,2,1,0,103,0,2,2,3,93,0,3,3,88,3,76,34,41,35,22,4,11,24,43,19,54,54,53,19,52,38,35,7,39,55,23,50,55,7,6,6,7,6,21,20,22,51,55,23,7,39,34,7,34,30,20,1,10,15,25,3,5,91,28,63,3,27,17,2,8,11,16,31,3,6,98,24,66,1,116,6,22,27,1,4,21,14,2,6,36,1,5,41,3,14,19,138,128,27,18,1,4,39,2,6,0,0,2,0,29,1,72,1,182,2,254,0,33,0,66,0,63,64,60,39,6,2,0,1,65,53,2,2,0,58,1,3,2,3,74,47,11,2,1,72,0,0,2,1,0,87,5,1,2,2,3,93,0,3,3,88,75,4,1,1,1,6,95,0,6,6,92,6,76,36,26,78,98,40,53,17,7,11,27,43,18,38,35,34,6,35,39,55,23,50,54,55,7,6,6,7,3,6,22,51,55,23,7,34,38,35,34,6,35,55,54,54,53,19,23,54,53,52,38,39,39,55,22,22,51,50,54,55,23,7,6,6,7,7,23,22,22,23,23,7,6,6,7,34,39,39,55,85,10,15,7,12,2,3,5,86,19,59,10,3,25,18,1,7,1,12,16,28,3,6,11,56,27,30,51,9,6,30,19,1,200,18,18,20,2,5,9,49,25,22,44,8,4,5,19,35,32,82,97,21,37,22,5,6,10,47,15,38,38,108,2,2,196,14,2,6,36,1,4,1,41,4,16,19,254,249,26,19,1,4,39,2,2,40,4,19,28,1,4,18,18,15,10,9,2,4,38,1,3,2,1,7,35,7,30,34,85,135,30,27,1,5,32,1,6,1,56,162,13,0,1,255,248,1,76,1,168,3,1,0,44,0,41,64,38,1,1,1,0,1,74,36,29,24,7,4,5,0,72,44,17,2,1,71,0,0,0,1,95,2,1,1,1,92,1,76,42,38,67,45,3,11,22,43,19,55,54,54,53,52,39,3,35,3,6,21,20,22,51,51,23,7,38,38,35,34,6,35,55,54,54,55,19,55,23,22,22,23,22,22,23,23,7,34,38,35,34,6,7,225,3,34,21,5,71,8,88,5,15,19,32,3,5,9,61,28,28,45,7,5,17,21,9,124,89,7,10,66,24,8,24,25,3,5,9,47,24,36,66,9,1,81,37,3,9,12,8,17,1,0,254,253,17,5,12,10,4,38,1,3,2,41,2,21,22,1,80,11,3,37,231,76,23,21,2,4,36,2,5,1,0,0,0,0,1,0,23,1,71,2,39,2,253,0,78,0,54,64,51,74,72,39,1,4,0,2,1,74,47,1,3,72,78,1,1,71,5,4,2,3,0,2,0,3,2,103,6,1,0,0,1,96,7,1,1,1,92,1,76,66,44,41,17,50,27,51,38,8,11,28,43,18,39,35,7,6,21,20,51,55,23,7,38,38,35,34,6,7,55,54,54,55,54,54,53,52,38,39,39,55,22,51,55,54,51,22,22,23,22,23,51,54,55,55,23,50,54,51,23,7,6,6,21,20,22,23,22,22,51,55,23,7,34,38,35,34,6,35,55,54,54,53,52,39,38,53,35,6,7,7,195,50,5,6,12,22,24,3,7,13,44,19,15,43,7,4,20,17,4,7,22,23,31,3,6,51,32,42,10,13,20,46,7,20,1,5,2,32,64,71,15,51,4,3,4,29,22,11,6,4,12,17,19,2,6,5,36,27,23,65,2,5,20,18,6,10,6,54,58,39,2,1,131,84,161,1,21,1,3,40,1,2,4,1,40,2,21,26,54,203,12,18,14,2,4,35,3,1,1,66,134,22,58,5,9,90,185,1,4,3,36,3,15,18,21,173,57,37,24,1,4,39,2,5,41,2,15,15,4,86,118,30,138,173,6,0,0,0,1,0,27,1,62,1,222,2,253,0,57,0,53,64,50,52,27,2,3,2,37,2,2,0,3,19,11,2,1,0,3,74,57,56,2,1,71,4,1,2,0,3,0,2,3,103,0,0,0,1,96,0,1,1,92,1,76,82,40,92,54,22,5,11,25,43,0,38,39,35,7,6,22,51,50,54,51,23,7,38,38,35,34,6,7,55,54,54,55,19,52,38,39,39,55,22,22,51,50,54,51,22,22,23,51,39,38,38,35,35,39,55,50,22,51,50,54,55,7,6,6,21,3,7,1,39,126,18,6,1,1,10,13,8,19,4,3,6,9,49,25,21,50,7,5,21,19,1,9,23,34,4,5,7,42,24,21,33,5,60,119,17,6,1,1,11,11,24,2,5,9,48,24,20,49,7,3,23,21,9,56,1,170,178,24,222,16,13,2,4,40,1,2,4,1,41,2,19,20,1,12,21,16,4,5,35,1,2,2,91,169,24,214,15,13,4,38,2,3,1,41,3,20,19,254,157,9,0,3,0,27,1,80,1,130,3,1,0,19,0,31,0,50,0,77,64,74,1,1,1,0,25,19,9,8,4,2,1,20,1,3,2,44,36,34,3,4,3,47,32,2,5,4,5,74,26,1,2,1,73,6,5,2,0,72,0,0,0,1,2,0,1,101,0,2,0,3,4,2,3,101,0,4,4,5,93,0,5,5,88,5,76,39,56,51,54,56,34,6,11,26,43,18,55,55,23,22,55,23,6,7,7,54,38,38,35,35,34,6,6,7,7,23,55,22,51,50,55,23,7,38,35,34,7,7,52,39,55,55,22,22,51,51,50,54,55,55,23,6,7,7,39,7,41,3,11,160,93,71,4,12,3,55,1,6,23,25,99,28,27,16,7,50,50,12,93,25,41,64,6,12,93,25,41,64,55,7,3,44,9,30,39,108,39,29,9,46,3,6,2,12,160,160,2,192,49,10,2,1,9,6,56,58,4,24,21,8,7,20,22,4,127,69,3,8,7,69,3,8,164,56,44,4,5,34,20,18,31,4,3,41,64,11,3,3,0,0,0,2,0,21,1,74,1,184,3,1,0,13,0,25,0,42,64,39,0,0,0,2,3,0,2,103,5,1,3,3,1,95,4,1,1,1,92,1,76,14,14,0,0,14,25,14,24,20,18,0,13,0,12,37,6,11,21,43,18,38,53,52,54,54,51,50,22,21,20,6,6,35,54,54,53,52,38,35,34,6,21,20,22,51,126,105,56,102,65,91,105,57,103,66,72,62,66,58,52,60,65,56,1,74,113,95,68,105,58,111,95,68,106,59,52,79,69,86,94,78,69,86,95,0,0,1,0,29,1,76,1,209,2,254,0,52,0,69,64,66,9,1,0,1,8,1,5,0,18,1,2,5,26,1,3,2,4,74,14,1,1,72,52,1,3,71,0,0,1,5,5,0,112,0,1,0,5,2,1,5,101,6,4,2,2,2,3,93,7,1,3,3,88,3,76,34,38,53,17,35,41,51,22,8,11,28,43,19,54,54,53,19,52,38,35,7,39,55,23,51,50,55,7,6,6,7,6,21,20,22,51,50,55,23,7,39,35,55,54,54,53,53,52,38,35,35,34,6,7,6,21,20,22,51,55,23,7,39,34,7,34,30,20,1,10,15,25,3,5,91,246,21,70,4,26,17,2,9,11,17,20,6,3,6,93,89,5,29,20,15,19,75,27,23,1,8,11,16,31,2,6,97,22,68,1,116,6,22,27,1,4,21,14,2,6,36,1,5,41,3,14,19,166,100,27,18,1,4,39,2,39,2,21,26,248,20,14,13,19,154,99,27,18,1,4,39,2,6,0,2,0,32,1,76,1,125,2,252,0,38,0,49,0,57,64,54,11,1,0,1,49,48,2,2,5,2,74,0,0,1,5,5,0,112,0,2,5,3,5,2,3,126,0,1,0,5,2,1,5,103,0,3,3,4,93,0,4,4,88,4,76,37,82,36,37,85,22,6,11,26,43,19,54,54,53,19,52,38,35,34,6,35,39,55,23,50,54,51,50,22,21,20,6,6,35,35,7,20,22,22,51,55,23,7,34,38,35,34,6,7,36,53,52,38,35,34,6,7,6,7,23,37,28,19,1,10,13,7,14,2,3,5,83,25,61,12,82,77,45,74,42,57,1,4,13,14,32,2,6,9,47,23,32,77,1,1,8,53,56,10,5,1,5,2,64,1,118,4,23,27,1,2,21,15,2,5,37,1,3,70,55,38,69,42,52,27,24,9,1,3,40,2,5,1,218,79,43,41,3,8,65,92,9,0,0,0,0,1,0,13,1,79,1,106,3,1,0,29,0,53,64,50,23,16,15,10,9,1,6,2,1,26,1,3,2,2,74,7,6,2,0,72,29,1,3,71,0,0,0,1,2,0,1,101,0,2,2,3,93,0,3,3,88,3,76,24,35,39,35,4,11,24,43,19,55,39,55,55,50,55,23,22,23,7,38,38,35,35,23,7,7,51,50,54,54,55,55,23,6,7,7,39,7,13,154,144,10,181,50,70,7,2,5,46,4,36,41,95,114,1,132,123,29,30,17,6,47,3,12,2,12,251,58,1,117,165,192,28,4,7,7,65,56,8,45,36,150,17,141,12,31,33,4,3,80,55,12,4,5,0,0,0,0,1,0,4,1,78,1,121,3,1,0,38,0,46,64,43,32,19,10,3,3,0,1,74,17,16,13,12,4,1,72,0,1,2,1,0,3,1,0,103,0,3,3,4,93,0,4,4,88,4,76,67,37,24,24,21,5,11,25,43,19,62,2,53,17,14,2,7,7,54,55,55,23,51,55,23,22,23,7,46,2,39,6,6,21,20,22,51,50,55,23,7,39,39,34,7,82,32,27,9,44,34,13,5,50,4,5,7,64,212,66,7,2,6,50,6,12,32,42,3,5,17,21,10,26,3,6,32,81,36,72,1,118,3,11,27,31,1,13,1,11,31,42,4,42,94,7,8,8,7,78,54,4,45,32,10,2,46,174,71,25,21,2,3,42,1,2,4,0,1,255,243,1,77,1,144,2,251,0,43,0,56,64,53,31,1,0,4,1,1,5,0,15,1,2,1,3,74,0,5,0,1,0,5,1,126,6,1,4,3,1,0,5,4,0,103,0,1,1,2,94,0,2,2,88,2,76,34,18,35,25,68,39,18,7,11,27,43,1,7,39,34,6,6,21,39,21,20,22,51,50,54,51,23,7,39,39,34,7,55,62,2,53,53,52,38,38,35,39,55,54,51,50,22,23,51,54,54,51,50,23,1,144,3,11,41,71,42,1,13,19,9,17,7,2,6,44,60,20,78,5,26,24,9,41,75,48,3,10,29,30,50,73,16,9,17,73,44,24,22,2,202,8,1,70,120,72,2,26,25,18,2,3,42,1,2,5,42,2,11,25,26,20,73,113,61,6,37,14,90,82,79,92,13,0,0,0,3,0,17,1,56,1,229,3,18,0,45,0,54,0,63,0,88,64,85,30,1,5,6,39,29,2,4,5,9,1,2,1,3,74,35,1,6,72,13,1,2,71,0,6,0,5,4,6,5,103,7,1,4,10,1,9,8,4,9,103,11,1,8,3,1,0,1,8,0,103,0,1,2,2,1,87,0,1,1,2,93,0,2,1,2,77,61,59,57,56,52,50,20,39,51,19,20,37,36,34,17,12,11,29,43,0,6,7,20,22,51,50,54,51,23,7,39,34,7,55,54,54,53,35,34,38,53,52,54,55,53,52,38,35,7,39,55,22,51,50,55,7,6,6,7,20,7,51,50,22,21,4,22,51,51,53,35,34,6,21,36,38,39,6,7,51,50,54,53,1,229,109,88,10,18,10,15,5,3,6,96,37,54,4,30,21,19,82,93,106,88,9,15,25,3,5,28,62,24,67,3,27,18,1,1,15,81,94,254,125,59,53,1,10,50,53,1,50,58,52,4,2,13,49,54,1,238,87,1,31,18,2,4,39,2,6,40,6,22,26,72,64,69,86,2,8,21,14,2,6,36,1,5,41,4,13,19,7,3,72,64,53,58,201,47,44,33,57,1,82,119,47,45,0,0,0,1,0,6,1,77,1,198,2,254,0,80,0,59,64,56,70,55,46,39,28,7,6,0,3,1,74,38,1,3,72,80,22,2,2,71,5,4,2,3,0,3,131,6,1,2,0,0,2,96,7,1,2,2,92,2,76,79,76,74,73,63,59,58,57,61,67,27,17,8,11,24,43,19,55,54,54,53,52,39,39,7,6,6,21,20,22,23,23,7,38,38,35,34,6,7,39,55,54,54,55,55,39,38,38,39,39,55,23,50,54,55,23,7,6,6,21,20,22,23,54,54,55,54,54,53,52,38,39,39,55,50,23,22,51,50,54,51,23,7,6,6,7,7,23,22,22,23,23,7,39,34,6,7,242,3,22,20,12,63,50,13,14,17,19,2,5,10,51,23,23,44,8,3,5,23,49,29,70,78,18,41,30,2,5,105,29,63,9,3,3,24,21,31,35,5,12,7,25,24,16,19,1,4,14,12,36,23,24,42,7,3,4,30,35,26,76,86,20,41,29,2,5,87,22,82,13,1,82,37,1,8,10,9,16,90,66,17,23,7,10,9,1,4,38,1,3,2,1,7,36,8,45,36,88,111,26,24,5,3,38,1,4,1,6,34,2,9,10,9,49,49,6,17,10,33,36,8,8,7,2,3,36,1,2,2,5,36,9,28,33,99,119,27,26,2,3,39,1,4,1,0,0,0,0,1,0,9,1,76,1,245,2,254,0,63,0,79,64,76,63,48,37,36,0,5,6,7,47,1,0,6,58,42,35,1,4,1,0,3,74,52,1,7,72,21,1,3,71,5,1,0,6,1,6,0,1,126,4,1,1,2,6,1,2,124,0,7,0,6,0,7,6,103,0,2,2,3,93,0,3,3,88,3,76,35,28,21,22,34,36,21,19,8,11,28,43,1,7,38,35,34,6,7,14,2,7,6,21,20,22,51,55,23,7,39,34,7,55,54,54,53,53,46,2,39,38,38,35,34,7,39,55,23,30,2,23,53,52,38,35,7,39,55,23,50,55,7,6,6,7,6,7,62,2,55,55,1,245,2,4,7,15,15,5,13,38,61,49,1,11,16,34,2,6,99,25,68,5,31,22,53,62,37,12,3,11,14,7,4,2,92,9,9,23,39,33,10,14,25,3,5,90,28,63,3,26,19,1,4,1,35,38,24,10,8,2,215,34,1,18,24,56,61,28,3,31,50,27,18,1,4,39,2,6,40,4,24,28,76,2,28,66,62,18,14,1,34,15,6,73,77,33,3,137,21,14,2,6,36,1,5,41,3,14,19,78,61,3,33,76,74,6,0,0,0,0,1,0,25,1,79,1,251,3,1,0,49,0,97,64,11,22,1,1,0,30,0,2,5,1,2,74,75,176,23,80,88,64,29,4,1,0,6,1,1,0,112,0,2,0,6,0,2,6,103,3,1,1,1,5,94,7,1,5,5,88,5,76,27,64,30,4,1,0,6,1,6,0,1,126,0,2,0,6,0,2,6,103,3,1,1,1,5,94,7,1,5,5,88,5,76,89,64,11,23,39,19,18,24,39,34,18,8,11,28,43,19,52,39,55,22,22,51,51,53,38,38,53,52,54,54,51,50,22,22,21,20,6,7,21,51,50,54,55,55,6,7,7,39,39,55,54,54,53,52,38,35,34,6,21,20,22,23,23,7,7,37,12,44,8,24,28,50,58,61,54,97,61,58,90,49,64,59,56,28,24,8,45,9,4,12,190,6,8,44,39,59,54,53,60,43,38,8,6,185,1,91,39,67,1,35,23,7,33,94,55,53,84,47,45,81,52,60,97,31,7,22,34,3,44,64,12,3,7,72,33,75,51,64,70,67,61,51,87,28,72,6,3,0,0,2,0,24,1,77,1,92,2,136,0,30,0,42,0,71,64,68,24,1,4,2,33,18,2,3,4,4,0,2,5,3,3,74,22,1,2,72,0,4,4,2,95,0,2,2,87,75,0,3,3,0,95,1,1,0,0,92,75,6,1,5,5,0,95,1,1,0,0,92,0,76,31,31,31,42,31,41,38,44,22,35,18,7,11,25,43,1,6,7,38,39,39,6,35,34,38,38,53,52,54,54,51,22,22,23,51,54,55,55,22,23,6,7,22,51,50,55,6,54,55,38,38,35,34,6,6,21,20,51,1,92,12,39,65,6,5,61,49,24,40,23,33,56,33,29,44,10,5,26,17,9,28,19,48,37,6,46,15,28,224,61,31,8,24,21,23,42,26,29,1,153,54,21,3,71,2,77,38,65,38,46,78,46,7,53,39,51,50,2,22,33,93,52,37,5,22,59,50,35,31,36,58,33,48,0,0,0,0,2,0,41,0,182,1,80,3,57,0,20,0,46,0,128,64,20,33,20,2,4,6,46,1,3,5,7,1,0,3,12,9,2,1,0,4,74,75,176,30,80,88,64,41,0,4,6,5,6,4,5,126,0,5,3,6,5,3,124,0,6,6,2,95,0,2,2,86,75,0,3,3,0,95,0,0,0,92,75,0,1,1,93,1,76,27,64,41,0,4,6,5,6,4,5,126,0,5,3,6,5,3,124,0,1,0,1,132,0,6,6,2,95,0,2,2,86,75,0,3,3,0,95,0,0,0,92,0,76,89,64,10,42,17,36,37,35,21,20,7,11,27,43,0,22,21,20,6,35,38,39,7,23,6,7,39,19,54,51,50,22,21,20,7,6,51,50,54,53,52,38,35,34,7,35,38,39,55,54,55,54,54,53,52,38,35,34,6,7,7,1,24,56,86,69,34,36,5,22,30,46,11,16,4,107,52,73,55,108,33,47,68,24,21,28,32,9,23,10,3,14,19,41,38,17,19,49,55,1,2,2,58,73,43,54,68,15,26,3,172,13,3,8,1,218,161,68,49,54,68,180,48,37,22,25,22,38,21,8,8,3,49,65,22,16,15,92,89,161,0,0,0,1,0,7,0,182,1,58,2,134,0,31,0,36,64,33,31,1,0,1,1,74,18,17,10,7,5,4,6,0,71,0,0,0,1,95,2,1,1,1,87,0,76,23,20,46,3,11,23,43,18,7,22,21,21,7,39,39,54,54,55,38,39,38,38,35,34,7,39,54,55,50,22,23,23,51,6,55,55,51,22,23,241,69,4,40,14,32,2,14,23,1,13,10,22,25,13,31,7,3,35,39,53,16,6,7,4,59,31,11,30,21,1,221,134,47,65,36,13,1,25,44,58,52,57,57,49,35,7,7,55,30,80,82,34,9,136,70,16,33,0,2,0,16,1,77,1,74,3,60,0,35,0,49,0,65,64,62,32,31,2,1,2,20,1,3,1,2,74,29,1,2,72,5,1,2,1,2,131,0,1,3,1,131,0,3,4,3,131,6,1,4,4,0,96,0,0,0,92,0,76,36,36,0,0,36,49,36,48,44,42,0,35,0,34,21,42,7,11,22,43,18,21,20,22,23,22,22,21,20,6,6,35,34,38,38,53,52,54,55,22,23,55,38,39,38,38,53,52,54,55,22,23,7,38,38,35,18,54,54,53,52,39,38,35,34,6,21,20,22,51,129,20,23,58,73,37,65,40,40,66,39,67,56,30,26,4,17,29,35,34,36,32,122,56,12,49,111,20,24,49,30,11,17,21,47,68,31,27,2,246,8,7,22,21,55,100,61,42,69,40,41,72,44,57,72,2,8,11,4,23,28,36,47,25,23,34,6,28,100,20,30,48,254,152,32,52,28,24,24,7,63,43,28,33,0,0,1,0,26,1,75,1,11,2,134,0,46,0,59,64,56,21,20,2,3,2,37,31,28,10,4,4,3,0,1,5,4,3,74,0,3,0,4,5,3,4,103,0,2,2,1,95,0,1,1,87,75,0,5,5,0,95,0,0,0,92,0,76,38,36,21,37,42,20,6,11,26,43,1,6,7,6,7,34,38,53,52,54,55,38,38,53,52,54,51,50,23,22,23,7,38,35,34,6,21,20,23,54,23,23,22,7,6,35,34,39,6,6,21,20,22,51,50,54,55,1,11,3,13,40,43,70,72,31,26,25,28,86,61,34,30,10,3,6,27,37,39,53,35,46,47,7,1,6,21,27,17,15,31,36,31,26,30,71,28,1,173,32,30,27,9,37,35,23,43,18,15,39,22,36,47,12,27,29,5,10,25,21,17,10,19,3,6,23,27,7,3,5,19,12,13,15,16,15,0,0,1,0,24,0,219,1,5,3,58,0,47,0,45,64,42,40,18,2,0,1,1,74,36,28,27,3,1,72,9,5,4,3,0,71,0,1,0,0,1,87,0,1,1,0,95,0,0,1,0,79,33,31,22,21,2,11,20,43,18,21,20,6,7,39,55,54,54,53,52,38,39,38,38,53,52,54,55,6,6,7,34,38,53,52,54,55,23,6,21,20,51,50,55,54,55,51,22,23,23,6,6,21,20,22,22,23,221,54,63,35,6,54,49,12,24,63,55,53,58,13,20,8,29,40,30,26,11,9,56,10,6,11,26,8,29,31,1,106,92,14,34,39,1,163,75,40,57,28,66,11,12,20,10,6,5,4,12,53,57,48,119,83,3,4,2,30,22,18,31,9,6,18,14,36,1,16,34,14,29,9,122,130,26,12,13,9,7,0,1,0,2,0,183,1,52,2,134,0,35,0,40,64,37,26,1,0,2,1,74,32,25,19,18,16,15,14,6,4,3,10,0,71,1,1,0,0,2,95,0,2,2,87,0,76,20,42,42,3,11,23,43,0,22,21,17,7,38,39,54,54,53,52,35,34,6,7,23,7,38,39,55,55,54,38,35,34,7,39,54,55,50,22,31,2,54,55,1,10,42,7,47,40,25,23,19,25,63,21,2,11,36,36,48,1,1,22,26,14,32,7,9,43,36,37,1,1,5,41,59,2,131,94,68,254,222,8,6,20,135,141,27,45,88,62,63,11,3,18,131,25,26,25,7,9,55,28,43,45,15,1,76,28,0,0,3,0,31,1,76,1,31,3,55,0,15,0,25,0,35,0,61,64,58,0,2,0,4,5,2,4,101,7,1,3,3,1,95,6,1,1,1,86,75,8,1,5,5,0,95,0,0,0,92,0,76,26,26,16,16,0,0,26,35,26,34,29,28,16,25,16,24,19,18,0,15,0,14,38,9,11,21,43,18,22,22,21,20,6,6,35,34,38,38,53,52,54,54,51,6,6,7,51,55,54,53,52,38,35,2,54,55,7,7,6,21,20,22,51,200,55,32,35,61,38,35,56,31,34,62,38,13,39,10,118,4,1,25,23,10,41,11,121,3,2,24,22,3,55,60,107,67,73,117,67,61,107,68,73,116,66,59,79,73,4,12,22,55,59,254,140,89,83,7,3,19,33,53,57,0,0,1,0,41,1,76,0,179,2,135,0,15,0,39,64,36,13,1,1,0,1,74,12,8,6,4,3,5,0,72,0,0,0,1,95,2,1,1,1,92,1,76,0,0,0,15,0,15,41,3,11,21,43,18,38,39,39,55,22,23,7,7,20,51,50,55,23,6,7,87,41,1,4,9,39,40,27,1,30,16,26,6,10,44,1,76,48,46,214,7,6,15,177,9,24,6,10,49,31,0,0,1,0,3,1,76,1,90,2,137,0,43,0,58,64,55,35,22,2,1,2,38,28,21,7,0,5,3,1,13,1,0,3,3,74,33,1,2,72,11,1,0,71,0,1,1,2,95,0,2,2,87,75,0,3,3,0,95,0,0,0,92,0,76,47,21,30,19,4,11,24,43,1,6,6,7,46,2,39,39,15,2,39,39,55,54,53,52,38,35,34,7,39,54,55,22,21,20,7,23,55,54,54,55,22,23,7,6,7,22,22,51,50,55,1,90,9,28,25,35,37,20,6,4,60,7,30,8,40,48,8,23,27,7,26,7,14,37,74,4,5,23,48,56,32,24,13,2,59,44,1,26,29,25,38,1,162,30,39,17,2,22,55,53,2,83,42,8,2,43,60,46,26,30,26,4,7,49,27,3,97,25,24,2,30,62,51,12,22,28,10,28,47,54,49,16,0,1,255,255,1,75,1,64,3,57,0,31,0,49,64,46,21,20,14,6,4,3,1,12,0,2,0,3,2,74,10,1,0,71,0,1,1,2,95,0,2,2,86,75,0,3,3,0,95,0,0,0,92,0,76,36,20,46,18,4,11,24,43,1,6,7,34,38,39,39,35,6,7,7,39,39,54,55,39,38,38,35,34,7,39,54,55,50,23,23,22,22,51,50,55,1,64,9,38,32,31,11,41,5,49,38,8,56,3,55,77,16,8,20,18,19,40,8,2,42,80,33,70,8,17,19,14,26,1,154,49,28,30,40,140,126,84,2,23,7,109,167,54,27,23,14,9,59,30,116,247,28,21,6,0,0,0,1,0,42,0,180,1,111,2,136,0,43,0,205,75,176,10,80,88,64,28,37,35,33,30,25,24,17,7,3,2,5,0,2,4,3,11,10,2,0,4,3,74,16,15,13,3,0,71,27,75,176,12,80,88,64,25,37,35,33,30,25,24,17,7,3,2,11,10,5,0,4,0,3,2,74,16,15,13,3,0,71,27,64,28,37,35,33,30,25,24,17,7,3,2,5,0,2,4,3,11,10,2,0,4,3,74,16,15,13,3,0,71,89,89,75,176,10,80,88,64,28,0,2,2,87,75,0,3,3,0,95,1,1,0,0,92,75,0,4,4,0,95,1,1,0,0,92,0,76,27,75,176,12,80,88,64,18,0,2,2,87,75,4,1,3,3,0,95,1,1,0,0,92,0,76,27,64,28,0,2,2,87,75,0,3,3,0,95,1,1,0,0,92,75,0,4,4,0,95,1,1,0,0,92,0,76,89,89,183,44,35,30,20,18,5,11,25,43,1,6,7,34,38,39,39,6,35,38,39,7,22,23,6,7,39,19,38,53,52,55,55,51,23,7,22,51,50,54,55,52,55,55,22,23,6,7,21,6,22,51,50,55,1,111,8,39,36,35,3,5,40,44,38,21,7,7,32,25,51,11,16,17,7,14,10,53,25,16,27,25,42,20,8,16,36,27,30,15,1,19,24,17,30,1,155,49,30,40,45,2,85,20,33,4,89,103,7,4,8,1,18,57,47,35,38,9,18,175,37,48,47,69,53,12,11,17,103,41,4,32,29,8,0,0,1,255,254,1,76,1,11,2,137,0,28,0,40,64,37,27,15,1,3,0,1,1,74,28,1,1,72,25,22,14,7,6,4,6,0,71,0,0,0,1,95,0,1,1,87,0,76,20,43,2,11,22,43,18,23,6,7,7,38,39,53,54,53,52,38,35,34,7,39,54,55,50,22,21,20,7,23,54,55,38,39,55,250,17,12,114,10,24,34,17,23,30,13,18,8,11,36,40,44,6,10,51,26,3,17,16,2,111,29,147,113,2,9,24,12,50,57,42,35,3,8,48,32,73,67,34,39,3,56,75,38,45,5,0,0,0,1,0,2,0,219,0,244,3,68,0,56,0,42,64,39,44,27,2,0,1,1,74,42,35,34,3,1,72,55,53,51,23,16,12,11,7,0,71,0,1,0,1,131,0,0,0,116,40,39,29,28,2,11,20,43,18,6,21,20,22,22,23,22,21,20,6,7,39,55,54,54,53,52,38,39,38,53,52,55,38,53,52,55,7,34,38,53,52,54,55,23,6,21,20,22,55,54,55,31,2,6,6,21,20,22,23,54,55,23,23,7,144,79,13,38,42,80,52,62,39,4,54,50,16,24,126,57,49,54,19,30,38,31,26,12,9,31,29,36,17,10,45,1,90,66,18,22,32,51,9,37,1,2,17,51,18,10,10,7,5,9,77,38,56,29,63,13,12,19,10,6,6,2,11,107,49,46,27,45,45,54,3,26,21,18,32,8,6,19,14,18,17,1,27,11,1,49,7,50,53,20,9,16,10,22,23,2,54,7,0,0,0,2,0,22,1,74,1,58,2,137,0,13,0,27,0,44,64,41,0,2,2,0,95,0,0,0,91,75,5,1,3,3,1,95,4,1,1,1,92,1,76,14,14,0,0,14,27,14,26,21,19,0,13,0,12,37,6,11,21,43,18,38,53,52,54,54,51,50,22,21,20,6,6,35,38,54,54,53,52,38,35,34,6,6,21,20,22,51,103,81,39,68,42,62,81,38,68,42,5,56,36,29,24,26,56,36,28,24,1,74,88,68,46,74,43,88,69,46,74,42,65,38,60,30,27,33,38,60,29,28,33,0,0,1,0,1,1,74,1,122,2,137,0,39,0,56,64,53,26,24,2,0,2,19,7,2,1,0,2,74,34,33,2,4,72,16,1,1,71,5,3,2,2,2,4,93,0,4,4,87,75,0,0,0,1,95,0,1,1,92,1,76,21,55,22,19,35,51,6,11,26,43,0,21,20,22,51,50,55,23,6,6,35,6,38,55,55,35,7,38,39,39,54,55,34,6,7,35,39,39,54,54,51,51,50,55,23,6,7,7,35,7,1,11,30,32,7,22,5,4,40,19,39,40,2,5,61,31,52,18,5,47,16,45,36,22,5,14,1,7,60,58,172,39,34,7,10,18,7,56,17,1,213,9,22,21,2,8,25,50,1,47,44,140,236,10,7,11,103,105,15,29,9,5,55,50,8,7,37,34,5,85,0,2,0,28,0,182,1,62,2,135,0,17,0,28,0,48,64,45,28,1,2,3,5,4,2,0,2,2,74,9,8,6,3,0,71,0,3,3,1,95,0,1,1,91,75,0,2,2,0,95,0,0,0,92,0,76,36,36,42,17,4,11,24,43,0,6,35,38,39,7,23,6,7,39,19,54,54,51,50,22,22,21,6,51,50,54,53,52,38,35,34,6,7,1,62,77,67,44,29,6,21,39,38,11,13,3,63,56,44,71,40,200,27,46,67,27,26,51,59,3,1,149,74,21,25,4,175,13,3,9,1,51,73,76,47,81,49,65,61,48,31,32,84,76,0,1,0,22,0,222,0,225,2,134,0,32,0,40,64,37,17,1,2,1,18,1,0,2,2,74,32,4,2,0,71,0,2,2,1,95,0,1,1,87,75,0,0,0,88,0,76,37,36,23,3,11,23,43,19,55,54,54,53,52,38,39,38,38,53,52,54,51,50,23,22,23,7,38,35,34,6,21,20,22,22,23,22,21,20,6,7,74,5,52,47,14,20,63,59,77,63,18,25,14,6,6,20,24,51,65,13,37,38,74,53,58,1,31,11,14,19,9,7,6,2,4,65,63,73,86,5,43,37,8,4,41,35,15,16,10,5,9,75,44,61,24,0,0,0,2,0,19,1,74,1,100,2,137,0,21,0,34,0,43,64,40,7,1,4,0,1,74,0,1,2,72,3,1,0,0,2,93,0,2,2,87,75,0,4,4,1,95,0,1,1,92,1,76,36,35,54,37,19,5,11,25,43,1,6,7,7,35,7,22,23,20,6,35,34,38,38,53,52,54,54,51,51,50,55,6,39,35,34,6,21,20,22,51,50,54,54,53,1,100,10,18,7,67,3,30,13,71,59,40,67,38,40,71,44,96,51,27,110,18,29,49,65,30,27,27,48,29,2,130,43,27,5,5,36,45,68,83,42,73,43,43,70,40,8,105,23,62,46,31,34,33,55,32,0,0,0,1,0,0,1,81,1,27,2,137,0,32,0,50,64,47,20,18,7,3,0,2,8,1,1,0,2,74,28,27,2,3,72,4,1,2,2,3,93,0,3,3,87,75,0,0,0,1,95,0,1,1,92,1,76,21,55,19,36,36,5,11,25,43,19,6,21,20,22,51,50,55,23,6,6,35,6,38,55,55,6,6,7,35,39,39,54,54,51,51,50,55,23,6,7,7,35,149,3,32,33,9,28,4,4,43,21,42,42,2,5,34,33,20,5,14,1,7,60,58,79,39,34,6,7,21,7,81,1,227,12,9,22,20,2,9,25,50,1,47,44,138,1,17,26,9,5,55,50,8,7,33,38,5,0,0,0,1,0,2,1,75,1,22,2,137,0,39,0,59,64,56,31,13,2,0,1,29,23,12,7,4,2,0,2,1,3,2,3,74,32,1,1,72,0,0,0,1,95,0,1,1,87,75,0,2,2,3,95,4,1,3,3,92,3,76,0,0,0,39,0,38,41,20,41,5,11,23,43,18,38,53,52,55,55,54,53,52,38,35,34,7,39,54,55,22,22,21,20,7,7,6,21,20,22,51,50,54,55,38,39,55,22,23,22,21,20,6,35,106,43,1,15,1,19,22,13,18,6,16,37,33,35,1,13,1,22,20,37,37,3,16,27,11,47,28,8,74,61,1,75,37,30,8,4,108,4,8,18,16,3,9,52,24,2,37,31,12,6,76,5,9,20,22,61,64,42,46,10,15,30,45,34,86,108,0,0,3,0,19,0,179,1,122,3,2,0,23,0,32,0,40,0,49,64,46,34,32,2,2,1,1,74,20,18,16,15,14,5,1,72,8,7,5,4,4,0,71,0,1,2,1,131,0,2,0,2,131,0,0,0,92,0,76,40,39,30,28,17,3,11,21,43,0,6,7,20,23,7,38,39,55,38,38,53,52,54,63,2,22,23,6,7,22,22,21,6,54,53,52,38,35,35,6,7,7,55,6,6,21,20,22,51,1,122,91,71,3,6,25,20,3,68,84,89,70,3,6,25,20,6,2,68,86,115,63,51,44,10,4,1,43,4,45,62,52,44,1,168,88,5,80,65,7,4,8,141,8,86,63,65,87,6,116,7,3,9,61,50,8,87,63,78,66,39,33,39,117,74,7,189,15,66,38,32,38,0,1,0,10,0,179,1,106,2,135,0,43,0,89,64,28,33,1,1,2,43,37,29,22,21,15,7,7,3,1,13,1,0,3,3,74,31,1,2,72,9,1,0,71,75,176,27,80,88,64,21,0,1,1,2,95,0,2,2,87,75,0,3,3,0,95,0,0,0,93,0,76,27,64,18,0,3,0,0,3,0,99,0,1,1,2,95,0,2,2,87,1,76,89,182,46,21,46,19,4,11,24,43,1,6,6,7,34,38,38,39,6,7,39,38,38,39,54,55,39,38,38,35,34,7,39,54,54,55,50,22,23,23,54,55,22,23,7,7,6,7,30,2,51,50,55,1,106,7,26,22,35,40,35,24,63,46,9,17,20,8,60,79,12,10,21,20,21,42,7,1,20,18,44,57,19,4,51,51,34,26,1,44,53,40,18,20,27,21,24,40,1,15,30,42,18,27,77,81,98,89,2,14,20,12,101,123,44,37,29,15,8,28,47,15,62,70,15,77,73,16,27,12,52,67,61,65,56,32,21,0,0,0,1,0,3,0,179,1,127,3,2,0,50,0,58,64,55,47,29,24,3,1,2,45,42,36,23,18,4,6,0,1,2,74,48,40,38,37,4,2,72,9,7,6,3,0,71,0,1,2,0,2,1,0,126,0,2,2,87,75,0,0,0,92,0,76,20,41,26,3,11,23,43,0,21,20,6,7,20,23,7,38,39,55,38,38,53,52,55,55,54,53,52,38,35,34,7,39,54,55,22,22,21,20,7,7,6,21,20,23,19,55,22,23,6,7,54,54,55,38,39,55,22,23,1,127,77,73,3,7,24,20,3,61,63,1,12,1,18,21,18,12,6,16,41,31,32,2,12,2,83,8,6,23,22,13,3,48,48,2,25,18,12,44,32,2,44,28,84,100,10,82,66,7,4,8,140,1,42,40,10,6,87,5,9,17,15,2,9,53,22,1,34,30,7,16,67,12,5,56,6,1,96,7,3,9,125,220,7,68,63,60,28,10,13,33,0,0,1,0,26,1,76,1,157,2,135,0,50,0,40,64,37,9,1,0,2,1,74,49,47,45,40,34,29,22,20,8,2,72,3,1,2,2,0,95,1,1,0,0,92,0,76,46,45,36,37,4,11,24,43,0,22,21,20,6,6,35,34,38,39,6,6,35,34,38,38,53,52,54,55,55,22,23,6,6,21,20,51,50,55,38,53,52,55,55,22,23,22,21,20,7,22,22,51,50,53,38,39,55,55,51,1,133,24,29,49,26,22,47,19,18,47,26,28,48,28,37,30,12,33,24,42,52,48,48,28,12,7,9,30,27,2,13,12,29,22,63,26,43,3,60,6,2,109,79,40,43,79,48,37,34,33,37,41,70,41,50,91,19,2,13,21,38,87,30,40,39,29,38,28,14,5,8,19,16,9,35,30,19,18,68,68,57,8,29,0,0,0,0,2,0,38,255,244,1,239,1,249,0,15,0,29,0,42,64,39,0,0,0,2,3,0,2,103,5,1,3,3,1,95,4,1,1,1,105,1,76,16,16,0,0,16,29,16,28,23,21,0,15,0,14,38,6,12,21,43,22,38,38,53,52,54,54,51,50,22,22,21,20,6,6,35,54,54,53,52,38,38,35,34,6,21,20,22,22,51,189,97,54,63,111,69,62,98,54,63,110,69,93,93,46,81,52,75,91,45,80,52,12,62,112,73,77,123,70,61,110,71,78,126,71,76,95,76,55,86,48,95,79,54,85,47,0,0,0,1,0,35,255,244,1,61,1,249,0,39,0,41,64,38,32,1,2,1,1,74,20,1,0,72,39,1,2,71,0,0,1,0,131,0,1,1,2,95,0,2,2,99,2,76,37,34,30,27,39,3,12,21,43,55,62,2,53,53,52,38,35,34,6,7,39,55,54,54,55,54,54,51,23,6,6,7,6,21,20,22,51,50,54,55,23,7,38,38,35,34,6,7,55,38,38,14,25,29,13,35,5,3,4,10,61,39,80,20,1,6,20,15,2,6,20,29,18,30,5,2,9,14,78,41,32,82,12,34,3,20,46,45,228,35,22,5,1,3,42,1,8,6,13,5,17,17,33,34,159,133,40,28,2,1,4,46,1,2,10,2,0,0,0,1,0,27,255,244,1,197,1,249,0,37,0,56,64,53,11,1,1,0,28,1,3,1,37,1,4,3,3,74,36,1,4,71,0,1,0,3,0,1,3,126,0,2,0,0,1,2,0,103,0,3,3,4,93,0,4,4,102,4,76,56,39,35,18,37,5,12,25,43,55,54,54,53,52,38,35,34,6,7,35,39,54,54,51,50,22,21,20,6,6,7,23,51,50,54,54,55,55,6,6,7,7,38,38,35,7,39,106,84,79,40,35,34,66,23,9,11,25,96,48,62,75,39,90,84,4,153,38,40,24,10,40,4,20,5,12,38,229,54,54,10,94,95,131,42,36,40,48,41,45,48,63,66,54,30,77,116,94,7,14,38,39,5,14,97,46,7,1,6,12,18,0,1,0,23,255,151,1,104,1,249,0,43,0,73,64,70,26,1,3,2,36,14,2,1,3,3,2,2,0,1,3,74,0,3,2,1,2,3,1,126,0,1,0,2,1,0,124,0,4,0,2,3,4,2,103,0,0,5,5,0,87,0,0,0,5,95,6,1,5,0,5,79,0,0,0,43,0,42,36,18,40,21,36,7,12,25,43,22,38,39,55,22,51,50,54,54,53,52,38,47,2,55,54,54,53,52,38,35,34,6,7,35,39,52,54,54,51,50,22,21,20,6,7,21,22,21,20,6,6,35,53,29,1,5,42,38,49,81,47,87,92,5,5,65,40,51,44,34,28,63,23,10,10,59,73,33,59,71,60,50,135,83,128,62,105,34,39,6,9,35,61,37,51,49,1,5,35,16,19,65,33,31,39,28,23,42,1,39,32,61,51,40,76,26,5,31,93,52,106,69,0,2,0,13,255,151,1,172,1,249,0,19,0,23,0,57,64,54,12,1,0,1,1,74,9,1,3,72,17,0,2,0,71,0,3,1,3,131,5,4,2,1,0,0,1,85,5,4,2,1,1,0,93,2,1,0,1,0,77,20,20,20,23,20,23,23,18,21,35,6,12,24,43,23,54,54,55,38,35,55,1,55,23,17,51,23,7,39,22,22,23,7,7,53,53,35,7,254,1,4,1,154,93,4,1,20,4,32,93,6,8,91,1,5,1,5,71,9,161,96,17,103,61,4,37,1,122,1,10,254,160,8,55,3,51,103,15,7,12,248,224,224,0,0,0,1,0,16,255,151,1,124,2,26,0,36,0,56,64,53,17,1,2,1,29,3,2,3,0,2,2,74,23,1,1,72,0,1,0,2,0,1,2,101,0,0,3,3,0,87,0,0,0,3,95,4,1,3,0,3,79,0,0,0,36,0,35,53,44,36,5,12,23,43,22,38,39,55,22,51,50,54,54,53,52,38,38,39,39,54,54,63,2,54,54,55,55,7,7,38,38,35,7,22,22,21,20,6,6,35,48,30,2,5,42,39,52,85,49,39,91,79,9,6,10,1,8,189,30,25,8,33,24,6,18,128,73,7,115,125,90,135,60,105,31,42,6,9,34,60,39,33,46,33,14,11,74,148,22,8,8,2,15,22,4,118,6,1,7,126,27,75,66,58,108,67,0,2,0,50,255,244,1,173,2,86,0,23,0,38,0,53,64,50,19,1,2,1,1,74,16,14,2,1,72,4,1,1,0,2,3,1,2,103,5,1,3,3,0,95,0,0,0,105,0,76,24,24,0,0,24,38,24,37,31,29,0,23,0,22,38,6,12,21,43,0,22,22,21,20,6,6,35,34,38,38,53,52,54,55,23,23,6,6,7,23,54,54,51,18,54,53,52,38,38,35,34,6,7,6,21,20,22,51,1,48,79,46,52,91,56,52,82,46,176,156,7,11,103,132,23,3,38,60,13,43,56,33,55,33,24,56,21,3,64,56,1,88,43,75,46,54,88,50,53,95,61,133,213,55,5,30,43,139,87,2,24,28,254,204,64,56,35,59,35,21,16,22,23,77,90,0,0,1,0,38,255,151,1,162,1,241,0,24,0,38,64,35,11,1,0,1,1,74,12,1,1,72,8,1,0,71,0,1,0,0,1,85,0,1,1,0,93,0,0,1,0,77,57,34,2,12,22,43,23,39,19,7,14,2,7,7,54,54,55,55,22,22,51,51,23,6,2,7,6,7,7,35,102,10,250,173,34,34,17,7,39,2,14,3,6,10,73,39,211,22,93,113,8,1,9,25,7,87,22,1,234,7,2,16,37,38,6,16,109,48,5,1,3,28,186,255,0,18,3,21,86,0,0,0,0,3,0,56,255,244,1,175,2,86,0,26,0,38,0,52,0,51,64,48,45,38,19,5,4,3,2,1,74,0,0,0,2,3,0,2,103,5,1,3,3,1,95,4,1,1,1,105,1,76,39,39,0,0,39,52,39,51,32,30,0,26,0,25,43,6,12,21,43,22,38,53,52,54,55,38,38,53,52,54,54,51,50,22,22,21,20,6,7,22,22,21,20,6,6,35,18,53,52,38,35,34,6,21,20,22,22,23,18,54,53,52,38,38,39,6,6,21,20,22,22,51,156,100,79,50,52,59,46,83,51,40,72,44,59,40,57,63,54,93,57,108,55,43,41,52,35,49,47,21,66,38,52,52,36,55,32,56,34,12,73,63,62,80,23,28,67,51,42,75,46,30,61,43,52,72,21,30,70,53,48,82,48,1,129,70,52,57,52,35,29,44,30,25,254,206,61,45,32,46,30,26,15,59,49,30,54,33,0,2,0,35,255,151,1,158,1,249,0,23,0,38,0,59,64,56,11,1,0,3,1,74,8,6,2,0,71,4,1,1,0,2,3,1,2,103,5,1,3,0,0,3,87,5,1,3,3,0,95,0,0,3,0,79,24,24,0,0,24,38,24,37,32,30,0,23,0,22,46,6,12,21,43,0,22,22,21,20,6,7,39,39,54,54,55,39,6,6,35,34,38,38,53,52,54,54,51,18,54,55,54,53,52,38,35,34,6,21,20,22,22,51,1,30,82,46,176,156,7,11,103,132,23,3,38,60,13,48,79,46,52,91,56,20,56,21,3,64,56,49,56,33,55,33,1,249,53,95,61,133,213,55,5,30,43,139,87,2,24,28,43,75,46,54,88,50,254,215,21,16,23,22,77,90,64,56,35,59,35,0,0,0,0,2,0,38,255,244,1,239,2,86,0,15,0,30,0,42,64,39,0,0,0,2,3,0,2,103,5,1,3,3,1,95,4,1,1,1,62,1,76,16,16,0,0,16,30,16,29,24,22,0,15,0,14,38,6,9,21,43,22,38,38,53,52,54,54,51,50,22,22,21,20,6,6,35,62,2,53,52,38,38,35,34,6,21,20,22,22,51,189,97,54,63,111,69,62,98,54,63,110,69,67,75,42,45,80,52,75,89,44,80,51,12,73,134,87,90,144,82,73,131,84,92,147,83,73,55,101,65,70,108,60,122,101,70,107,59,0,1,0,36,255,244,1,62,2,86,0,39,0,55,64,52,19,1,1,2,12,1,3,0,32,1,4,3,3,74,39,1,4,71,0,2,1,2,131,0,1,0,1,131,0,0,3,0,131,0,3,3,4,95,0,4,4,59,4,76,52,57,19,20,39,5,9,25,43,55,62,2,53,17,52,38,35,34,6,7,39,55,50,54,55,54,35,23,6,6,7,6,6,21,20,22,51,50,54,55,23,7,38,38,35,34,6,7,56,39,37,14,25,29,13,35,5,3,4,10,65,35,113,10,6,20,15,2,3,5,20,29,18,30,5,2,9,14,78,41,32,82,12,34,3,21,46,48,1,61,35,22,5,1,3,42,9,6,18,17,17,33,34,73,245,67,40,28,2,1,4,46,1,2,10,2,0,1,0,26,255,244,1,198,2,86,0,36,0,56,64,53,11,1,1,0,27,1,3,1,36,1,4,3,3,74,35,1,4,71,0,1,0,3,0,1,3,126,0,2,0,0,1,2,0,103,0,3,3,4,93,0,4,4,59,4,76,56,38,35,18,37,5,9,25,43,55,54,54,53,52,38,35,34,6,7,35,39,54,54,51,50,22,21,20,6,7,23,51,50,54,54,55,55,6,6,7,7,38,38,35,7,39,125,83,87,47,44,46,78,28,9,11,26,111,55,72,87,105,133,4,153,38,40,24,10,40,4,22,5,12,38,229,54,54,10,119,105,168,57,40,42,56,53,45,55,76,71,59,58,176,164,7,14,38,39,5,15,98,46,7,1,6,12,18,0,0,0,0,1,0,43,255,244,1,113,2,86,0,44,0,68,64,65,26,1,3,2,36,14,2,1,3,3,2,2,0,1,3,74,0,3,2,1,2,3,1,126,0,1,0,2,1,0,124,0,4,0,2,3,4,2,103,0,0,0,5,95,6,1,5,5,62,5,76,0,0,0,44,0,43,36,18,40,21,36,7,9,25,43,22,38,39,55,22,51,50,54,54,53,52,38,35,39,39,55,54,54,53,52,38,35,34,6,7,35,39,52,54,54,51,50,22,21,20,6,7,21,22,22,21,20,6,6,35,73,29,1,5,42,38,46,76,44,85,94,5,5,65,40,51,42,34,29,65,22,10,10,59,73,33,56,74,60,50,67,68,80,123,59,12,34,39,6,9,31,53,33,59,53,5,35,16,20,65,32,34,41,26,20,42,1,36,30,66,51,40,76,26,7,17,71,51,47,96,62,0,0,0,2,0,2,255,245,1,161,2,87,0,19,0,23,0,57,64,54,12,1,0,1,1,74,9,1,3,72,17,0,2,0,71,0,3,1,3,131,5,4,2,1,0,0,1,85,5,4,2,1,1,0,93,2,1,0,1,0,77,20,20,20,23,20,23,23,18,21,35,6,9,24,43,23,54,54,55,38,35,55,1,55,23,17,51,23,7,39,22,22,23,7,7,53,53,35,7,243,1,4,1,154,93,4,1,20,4,32,93,6,8,91,1,5,1,5,71,9,161,2,17,103,61,4,37,1,122,1,10,254,160,8,55,3,51,103,15,7,12,248,224,224,0,0,0,1,0,31,255,244,1,119,2,119,0,34,0,64,64,61,15,1,3,2,27,12,2,1,3,3,2,2,0,1,3,74,21,1,2,72,0,1,3,0,3,1,0,126,0,2,0,3,1,2,3,101,0,0,0,4,95,5,1,4,4,62,4,76,0,0,0,34,0,33,53,37,20,36,6,9,24,43,22,38,39,55,22,51,50,54,53,52,38,39,39,54,54,63,2,54,54,55,55,7,7,38,38,35,7,22,22,21,20,6,6,35,62,29,2,5,42,39,74,94,103,108,9,6,10,1,8,189,30,25,8,33,24,6,18,129,72,9,125,119,81,125,61,12,33,40,6,9,72,56,59,60,2,11,77,155,22,8,8,2,15,22,4,118,6,1,7,149,9,78,74,50,101,66,0,0,0,2,0,40,255,244,1,163,2,94,0,26,0,41,0,53,64,50,13,1,2,0,1,74,9,1,0,72,0,0,0,2,3,0,2,103,5,1,3,3,1,95,4,1,1,1,62,1,76,27,27,0,0,27,41,27,40,34,32,0,26,0,25,19,17,6,9,20,43,22,38,38,53,52,54,54,21,23,23,52,6,6,7,23,62,2,51,50,22,22,21,20,6,6,35,54,54,53,52,38,38,35,34,6,7,6,21,20,22,51,166,82,44,148,184,7,11,121,115,23,4,6,42,50,13,55,78,40,51,90,58,68,57,31,56,34,29,54,18,3,64,56,12,55,95,59,134,178,97,8,5,30,5,68,119,87,2,4,25,23,49,75,40,52,88,52,48,64,56,34,59,36,24,13,22,23,76,91,0,0,0,1,0,38,255,244,1,162,2,78,0,24,0,38,64,35,11,1,0,1,1,74,12,1,1,72,8,1,0,71,0,1,0,0,1,85,0,1,1,0,93,0,0,1,0,77,57,34,2,9,22,43,55,39,19,7,14,2,7,7,54,54,55,55,22,22,51,51,23,6,2,7,6,7,7,35,102,10,250,173,34,34,17,7,39,2,14,3,6,10,73,39,211,22,93,113,8,1,9,25,7,6,22,1,234,7,2,16,37,38,6,16,109,48,5,1,3,28,186,255,0,18,3,21,86,0,0,0,0,3,0,56,255,244,1,175,2,86,0,26,0,38,0,52,0,51,64,48,45,38,19,5,4,3,2,1,74,0,0,0,2,3,0,2,103,5,1,3,3,1,95,4,1,1,1,62,1,76,39,39,0,0,39,52,39,51,32,30,0,26,0,25,43,6,9,21,43,22,38,53,52,54,55,38,38,53,52,54,54,51,50,22,22,21,20,6,7,22,22,21,20,6,6,35,18,53,52,38,35,34,6,21,20,22,22,23,18,54,53,52,38,38,39,6,6,21,20,22,22,51,156,100,79,50,52,59,46,83,51,40,72,44,59,40,57,63,54,93,57,108,55,43,41,52,35,49,47,21,66,38,52,52,36,55,32,56,34,12,73,63,62,80,23,28,67,51,42,75,46,30,61,43,52,72,21,30,70,53,48,82,48,1,129,70,52,57,52,35,29,44,30,25,254,206,61,45,32,46,30,26,15,59,49,30,54,33,0,2,0,36,255,237,1,159,2,87,0,26,0,39,0,51,64,48,5,1,0,3,1,74,1,1,0,71,0,1,0,2,3,1,2,103,4,1,3,0,0,3,87,4,1,3,3,0,95,0,0,3,0,79,27,27,27,39,27,38,45,38,41,5,9,23,43,23,39,20,54,54,55,39,14,2,35,34,38,38,53,52,54,54,51,50,22,22,21,20,6,6,53,18,55,54,53,52,38,35,34,6,21,20,22,51,76,11,121,114,23,3,6,42,50,13,55,78,40,51,90,58,54,82,44,148,184,195,54,3,65,55,48,57,68,53,6,30,5,67,119,87,3,4,25,23,49,75,40,52,88,52,55,95,59,134,178,97,8,1,57,37,21,24,76,91,64,56,53,76,0,0,255,255,0,31,255,128,1,65,1,1,0,2,6,196,0,0,255,255,0,27,255,129,0,221,1,1,0,2,6,197,0,0,255,255,0,24,255,129,1,52,1,1,0,2,6,198,0,0,255,255,0,31,255,128,0,254,1,1,0,2,6,199,0,0,255,255,0,10,255,129,1,30,1,1,0,2,6,200,0,0,255,255,0,24,255,128,1,1,1,20,0,2,6,201,0,0,255,255,0,30,255,128,1,28,1,1,0,2,6,202,0,0,255,255,0,29,255,129,1,24,0,252,0,2,6,203,0,0,255,255,0,39,255,128,1,32,1,1,0,2,6,204,0,0,255,255,0,28,255,129,1,26,1,1,0,2,6,205,0,0,0,2,0,23,255,244,1,178,2,86,0,15,0,30,0,42,64,39,0,0,0,2,3,0,2,103,5,1,3,3,1,95,4,1,1,1,62,1,76,16,16,0,0,16,30,16,29,24,22,0,15,0,14,38,6,9,21,43,22,38,38,53,52,54,54,51,50,22,22,21,20,6,6,35,62,2,53,52,38,38,35,34,6,21,20,22,22,51,156,86,47,57,102,63,56,86,47,57,101,63,61,66,37,38,69,45,67,78,37,68,45,12,72,131,85,92,147,83,72,128,83,93,149,85,73,57,102,67,69,105,59,124,104,68,105,58,0,1,0,57,255,244,1,126,2,86,0,40,0,101,75,176,10,80,88,64,14,0,1,1,2,1,74,28,1,2,72,7,1,0,71,27,64,14,0,1,1,3,1,74,28,1,2,72,7,1,0,71,89,75,176,10,80,88,64,17,0,2,1,2,131,3,1,1,1,0,93,0,0,0,59,0,76,27,64,24,0,2,3,2,131,0,1,3,0,3,1,0,126,0,3,3,0,93,0,0,0,59,0,76,89,183,39,36,38,19,65,4,9,23,43,37,7,38,38,35,34,6,7,55,62,2,39,3,38,38,35,34,6,7,39,55,54,54,55,54,54,49,23,6,6,7,6,21,20,22,22,51,50,54,55,1,126,8,16,88,47,36,89,14,6,46,42,15,1,6,1,30,33,16,40,6,3,4,13,69,42,98,13,6,23,17,1,2,9,24,26,22,34,6,43,46,1,2,10,2,46,3,21,46,48,1,61,35,22,5,1,3,42,1,8,6,14,4,17,17,33,34,136,160,72,64,21,2,1,0,0,0,0,1,0,20,255,244,1,179,2,86,0,36,0,56,64,53,11,1,1,0,27,1,3,1,36,1,4,3,3,74,35,1,4,71,0,1,0,3,0,1,3,126,0,2,0,0,1,2,0,103,0,3,3,4,93,0,4,4,59,4,76,56,38,35,18,37,5,9,25,43,55,54,54,53,52,38,35,34,6,7,35,39,54,54,51,50,22,21,20,6,7,23,51,50,54,54,55,55,6,6,7,7,38,38,35,7,39,117,80,83,44,42,44,76,27,9,10,25,108,53,70,84,101,129,4,145,36,39,22,10,41,4,22,5,11,37,221,52,54,9,119,105,168,57,40,42,56,53,45,55,76,71,58,59,175,165,7,14,38,39,5,15,98,46,7,1,6,12,18,0,0,0,0,1,0,51,255,244,1,130,2,86,0,44,0,68,64,65,26,1,3,2,36,14,2,1,3,3,2,2,0,1,3,74,0,3,2,1,2,3,1,126,0,1,0,2,1,0,124,0,4,0,2,3,4,2,103,0,0,0,5,95,6,1,5,5,62,5,76,0,0,0,44,0,43,36,18,40,21,36,7,9,25,43,22,38,39,55,22,51,50,54,54,53,52,38,35,39,39,55,54,54,53,52,38,35,34,6,7,35,39,34,54,54,51,50,22,21,20,6,7,21,22,22,21,20,6,6,35,82,30,1,4,44,39,48,79,46,89,99,5,5,68,41,53,43,37,29,68,23,10,10,3,61,77,34,59,76,62,52,70,71,82,127,61,12,34,39,6,9,31,53,33,59,53,5,35,16,20,65,32,34,41,26,20,42,37,30,66,51,40,76,26,7,17,71,51,47,96,62,0,0,0,2,0,3,255,245,1,164,2,87,0,19,0,23,0,57,64,54,12,1,0,1,1,74,9,1,3,72,17,0,2,0,71,0,3,1,3,131,5,4,2,1,0,0,1,85,5,4,2,1,1,0,93,2,1,0,1,0,77,20,20,20,23,20,23,23,18,21,35,6,9,24,43,23,54,54,55,38,35,55,1,55,23,19,51,23,7,39,22,22,23,7,7,53,53,35,7,246,1,4,1,156,93,4,1,22,4,31,1,93,6,7,92,1,5,1,5,71,10,162,2,17,103,61,4,37,1,122,1,10,254,160,8,55,3,51,103,15,7,12,248,224,224,0,0,1,0,39,255,244,1,137,2,119,0,34,0,64,64,61,15,1,3,2,12,1,1,4,3,2,2,0,1,3,74,21,1,2,72,0,2,0,3,4,2,3,101,0,4,0,1,0,4,1,103,0,0,0,5,95,6,1,5,5,62,5,76,0,0,0,34,0,33,17,53,37,20,36,7,9,25,43,22,38,39,55,22,51,50,54,53,52,38,39,39,54,54,63,2,54,54,55,55,7,7,38,38,35,7,22,22,21,20,6,6,35,71,30,2,5,43,41,77,100,109,113,10,6,9,1,9,196,31,26,9,33,25,6,19,134,76,8,131,124,84,129,63,12,33,40,6,9,72,56,59,60,2,11,77,155,22,8,8,2,15,22,4,118,6,1,7,149,9,79,73,50,101,66,0,0,0,2,0,39,255,244,1,160,2,94,0,26,0,41,0,53,64,50,13,1,2,0,1,74,9,1,0,72,0,0,0,2,3,0,2,103,5,1,3,3,1,95,4,1,1,1,62,1,76,27,27,0,0,27,41,27,40,34,32,0,26,0,25,19,17,6,9,20,43,22,38,38,53,52,54,54,21,23,23,52,6,6,7,23,62,2,51,50,22,22,21,20,6,6,35,54,54,53,52,38,38,35,34,6,7,6,21,20,22,51,164,81,44,147,183,7,11,120,114,23,4,6,42,49,13,54,78,40,51,90,57,67,57,31,55,34,29,53,18,3,63,55,12,55,95,59,134,178,97,8,5,30,5,68,119,87,2,4,25,23,49,75,40,52,88,52,48,64,56,33,60,36,24,13,22,23,76,91,0,0,0,1,0,45,255,244,1,182,2,78,0,21,0,38,64,35,11,1,0,1,1,74,12,1,1,72,8,1,0,71,0,1,0,0,1,85,0,1,1,0,93,0,0,1,0,77,57,34,2,9,22,43,55,39,1,7,14,2,7,7,54,54,55,55,22,22,51,51,23,2,7,7,35,113,10,1,3,182,36,36,17,7,39,2,14,3,6,11,75,41,219,22,137,95,25,7,6,22,1,234,7,2,16,37,38,6,16,110,47,5,1,3,28,254,246,218,86,0,0,0,0,3,0,46,255,244,1,151,2,86,0,25,0,37,0,50,0,51,64,48,44,37,18,5,4,3,2,1,74,0,0,0,2,3,0,2,103,5,1,3,3,1,95,4,1,1,1,62,1,76,38,38,0,0,38,50,38,49,31,29,0,25,0,24,43,6,9,21,43,22,38,53,52,54,55,38,38,53,52,54,54,51,50,22,21,20,6,7,22,22,21,20,6,6,35,18,53,52,38,35,34,6,21,20,22,22,23,18,54,53,52,38,38,39,6,6,21,20,22,51,142,96,75,48,49,55,45,80,49,61,89,57,38,53,60,52,90,55,105,52,40,39,49,33,46,44,18,62,36,49,49,33,52,65,49,12,72,63,62,81,23,28,67,50,43,75,46,70,63,52,72,22,31,69,52,49,82,48,1,128,72,51,57,52,35,29,44,31,24,254,206,61,45,32,46,30,26,15,59,50,46,70,0,0,0,2,0,35,255,237,1,156,2,87,0,26,0,39,0,51,64,48,5,1,0,3,1,74,1,1,0,71,0,1,0,2,3,1,2,103,4,1,3,0,0,3,87,4,1,3,3,0,95,0,0,3,0,79,27,27,27,39,27,38,45,38,41,5,9,23,43,23,39,20,54,54,55,39,14,2,35,34,38,38,53,52,54,54,51,50,22,22,21,20,6,6,53,18,55,54,53,52,38,35,34,6,21,20,22,51,75,11,120,113,23,3,6,42,49,13,54,78,40,51,90,57,54,81,44,147,184,194,54,3,65,54,48,56,67,53,6,30,5,67,119,87,3,4,25,23,49,75,40,52,88,52,55,95,59,134,178,97,8,1,57,37,21,24,75,92,64,56,53,76,0,0,0,2,0,22,255,244,1,178,1,249,0,15,0,28,0,42,64,39,0,0,0,2,3,0,2,103,5,1,3,3,1,95,4,1,1,1,62,1,76,16,16,0,0,16,28,16,27,23,21,0,15,0,14,38,6,9,21,43,22,38,38,53,52,54,54,51,50,22,22,21,20,6,6,35,54,54,53,52,38,38,35,34,6,21,20,22,51,156,87,47,58,101,63,56,86,48,57,101,63,84,82,39,71,45,67,81,85,69,12,60,111,72,78,125,71,60,108,70,79,128,72,76,96,78,54,85,47,97,80,81,102,0,0,1,0,58,255,244,1,125,1,249,0,39,0,108,75,176,10,80,88,64,15,32,12,2,0,1,1,74,20,1,1,72,39,1,3,71,27,64,18,12,1,2,1,32,1,0,2,2,74,20,1,1,72,39,1,3,71,89,75,176,10,80,88,64,17,0,1,0,1,131,2,1,0,0,3,93,0,3,3,59,3,76,27,64,24,0,1,2,1,131,0,0,2,3,2,0,3,126,0,2,2,3,93,0,3,3,59,3,76,89,64,9,37,33,30,27,38,16,4,9,22,43,55,62,2,39,39,38,38,35,34,6,7,39,55,55,54,7,54,54,49,23,6,6,7,7,20,22,22,51,50,54,55,23,7,38,38,35,34,6,7,89,44,43,16,1,5,1,30,33,15,40,6,3,3,23,107,6,98,10,6,23,16,1,2,10,24,26,22,34,6,2,9,16,88,47,35,89,14,34,3,20,45,46,228,35,22,5,1,3,42,3,13,1,14,4,17,17,33,34,191,77,70,22,2,1,4,46,1,2,10,2,0,1,0,21,255,244,1,179,1,249,0,37,0,56,64,53,11,1,1,0,28,1,3,1,37,1,4,3,3,74,36,1,4,71,0,1,0,3,0,1,3,126,0,2,0,0,1,2,0,103,0,3,3,4,93,0,4,4,59,4,76,56,39,35,18,37,5,9,25,43,55,54,54,53,52,38,35,34,6,7,35,39,54,54,51,50,22,21,20,6,6,7,23,51,50,54,54,55,55,6,6,7,7,38,38,35,7,39,97,81,77,37,34,33,64,22,9,11,25,93,47,61,72,37,88,81,4,145,36,39,23,10,41,4,20,5,12,37,222,52,53,9,94,94,132,42,36,40,48,41,45,48,63,66,54,31,76,116,94,7,14,38,39,5,14,97,46,7,1,6,12,18,0,1,0,29,255,151,1,123,1,249,0,43,0,73,64,70,26,1,3,2,36,14,2,1,3,3,2,2,0,1,3,74,0,3,2,1,2,3,1,126,0,1,0,2,1,0,124,0,4,0,2,3,4,2,103,0,0,5,5,0,87,0,0,0,5,95,6,1,5,0,5,79,0,0,0,43,0,42,36,18,40,21,36,7,9,25,43,22,38,39,55,22,51,50,54,54,53,52,38,47,2,55,54,54,53,52,38,35,34,6,7,35,39,34,54,54,51,50,22,21,20,6,7,21,22,21,20,6,6,35,61,30,2,5,45,39,52,86,49,93,98,5,5,68,42,54,47,36,30,67,23,11,10,3,63,77,35,61,75,62,53,142,86,132,65,105,34,39,6,9,35,60,37,52,49,1,5,35,16,19,65,33,31,39,28,23,42,40,32,61,51,40,76,26,5,31,94,51,106,69,0,2,0,4,255,151,1,166,1,249,0,19,0,23,0,57,64,54,12,1,0,1,1,74,9,1,3,72,17,0,2,0,71,0,3,1,3,131,5,4,2,1,0,0,1,85,5,4,2,1,1,0,93,2,1,0,1,0,77,20,20,20,23,20,23,23,18,21,35,6,9,24,43,23,54,54,55,38,35,55,1,55,23,19,51,23,7,39,22,22,23,7,7,53,53,35,7,247,1,4,1,156,93,4,1,22,4,31,1,94,6,8,92,1,5,1,5,71,9,163,96,17,103,61,4,37,1,122,1,10,254,160,8,55,3,51,103,15,7,12,248,224,224,0,0,1,0,21,255,151,1,136,2,26,0,36,0,56,64,53,17,1,2,1,29,3,2,3,0,2,2,74,23,1,1,72,0,1,0,2,0,1,2,101,0,0,3,3,0,87,0,0,0,3,95,4,1,3,0,3,79,0,0,0,36,0,35,53,44,36,5,9,23,43,22,38,39,55,22,51,50,54,54,53,52,38,38,39,39,54,54,63,2,54,54,55,55,7,7,38,38,35,7,22,22,21,20,6,6,35,55,32,2,5,44,39,54,88,50,40,94,82,9,6,9,1,9,194,30,26,8,33,24,6,18,133,75,6,118,129,93,137,61,105,31,42,6,9,34,60,39,33,46,33,14,11,74,148,22,8,8,2,15,22,4,118,6,1,7,126,27,75,66,58,108,67,0,2,0,39,255,244,1,160,2,94,0,26,0,41,0,53,64,50,13,1,2,0,1,74,9,1,0,72,0,0,0,2,3,0,2,103,5,1,3,3,1,95,4,1,1,1,62,1,76,27,27,0,0,27,41,27,40,34,32,0,26,0,25,19,17,6,9,20,43,22,38,38,53,52,54,54,21,23,23,52,6,6,7,23,62,2,51,50,22,22,21,20,6,6,35,54,54,53,52,38,38,35,34,6,7,6,21,20,22,51,164,81,44,147,183,7,11,120,114,23,4,6,42,49,13,54,78,40,51,90,57,67,57,31,55,34,29,53,18,3,63,55,12,55,95,59,134,178,97,8,5,30,5,68,119,87,2,4,25,23,49,75,40,52,88,52,48,64,56,33,60,36,24,13,22,23,76,91,0,0,0,1,0,45,255,151,1,183,1,241,0,21,0,38,64,35,11,1,0,1,1,74,12,1,1,72,8,1,0,71,0,1,0,0,1,85,0,1,1,0,93,0,0,1,0,77,57,34,2,9,22,43,23,39,1,7,14,2,7,7,54,54,55,55,22,22,51,51,23,6,3,7,35,114,11,1,4,183,36,35,17,8,39,2,14,3,6,11,76,40,220,22,118,115,25,7,87,22,1,234,7,2,16,36,39,6,16,110,47,5,1,3,28,228,255,0,86,0,0,0,0,3,0,46,255,244,1,151,2,86,0,25,0,37,0,50,0,51,64,48,44,37,18,5,4,3,2,1,74,0,0,0,2,3,0,2,103,5,1,3,3,1,95,4,1,1,1,62,1,76,38,38,0,0,38,50,38,49,31,29,0,25,0,24,43,6,9,21,43,22,38,53,52,54,55,38,38,53,52,54,54,51,50,22,21,20,6,7,22,22,21,20,6,6,35,18,53,52,38,35,34,6,21,20,22,22,23,18,54,53,52,38,38,39,6,6,21,20,22,51,142,96,75,48,49,55,45,80,49,61,89,57,38,53,60,52,90,55,105,52,40,39,49,33,46,44,18,62,36,49,49,33,52,65,49,12,72,63,62,81,23,28,67,50,43,75,46,70,63,52,72,22,31,69,52,49,82,48,1,128,72,51,57,52,35,29,44,31,24,254,206,61,45,32,46,30,26,15,59,50,46,70,0,0,0,2,0,35,255,143,1,156,1,249,0,25,0,38,0,51,64,48,5,1,0,3,1,74,1,1,0,71,0,1,0,2,3,1,2,103,4,1,3,0,0,3,87,4,1,3,3,0,95,0,0,3,0,79,26,26,26,38,26,37,45,38,40,5,9,23,43,23,39,20,54,54,55,39,6,6,35,34,38,38,53,52,54,54,51,50,22,22,21,20,6,6,53,18,55,54,53,52,38,35,34,6,21,20,22,51,74,11,120,114,23,3,2,84,24,55,77,40,50,90,58,54,81,44,147,184,194,54,3,65,54,48,56,67,53,100,30,5,67,119,87,3,1,51,48,76,40,52,88,52,55,95,59,134,178,97,8,1,57,37,21,24,75,92,64,56,53,76,255,255,0,31,255,128,1,65,1,1,0,2,6,196,0,0,255,255,0,27,255,129,0,221,1,1,0,2,6,197,0,0,255,255,0,24,255,129,1,52,1,1,0,2,6,198,0,0,0,2,0,31,255,128,1,65,1,1,0,13,0,25,0,44,64,41,0,2,2,0,95,0,0,0,114,75,5,1,3,3,1,95,4,1,1,1,121,1,76,14,14,0,0,14,25,14,24,20,18,0,13,0,12,37,6,13,21,43,22,38,53,52,54,54,51,50,22,21,20,6,6,35,54,54,53,52,38,35,34,6,21,20,22,51,105,74,39,70,45,62,74,39,69,45,55,51,56,46,44,50,55,46,128,100,85,59,91,50,100,83,59,92,51,66,65,55,59,71,65,57,58,70,0,1,0,27,255,129,0,221,1,1,0,37,0,43,64,40,20,1,0,1,1,74,17,1,1,72,37,1,3,71,0,1,0,1,131,2,1,0,0,3,93,0,3,3,115,3,76,35,31,27,25,37,16,4,13,22,43,23,54,54,53,53,52,38,35,34,6,7,39,55,54,55,54,35,23,6,6,7,6,6,21,20,22,51,50,54,51,23,7,34,38,35,34,6,7,39,31,26,15,18,11,19,3,3,3,53,21,84,6,5,12,10,2,3,3,13,17,11,18,3,2,7,9,52,27,23,59,9,92,2,22,27,209,22,13,2,1,3,32,7,3,12,15,10,21,20,53,130,50,24,19,2,3,36,2,6,1,0,0,0,0,1,0,24,255,129,1,52,1,1,0,32,0,47,64,44,23,8,6,3,2,0,32,1,3,2,2,74,31,1,3,71,0,0,0,1,95,0,1,1,114,75,0,2,2,3,93,0,3,3,115,3,76,55,53,37,35,4,13,24,43,23,54,53,52,35,34,7,35,39,54,54,51,50,22,21,20,6,7,23,51,50,54,55,55,6,6,7,7,38,38,35,7,39,93,95,51,55,37,7,10,20,72,35,49,59,64,80,3,82,32,26,8,38,2,14,3,9,24,127,57,42,6,25,116,60,47,62,41,34,46,47,38,38,105,93,5,22,35,4,10,70,31,6,1,4,7,25,0,1,0,31,255,128,0,254,1,1,0,41,0,63,64,60,25,1,2,3,34,23,13,3,1,2,3,2,2,0,1,3,74,0,1,2,0,2,1,0,126,0,2,2,3,95,0,3,3,114,75,0,0,0,4,95,5,1,4,4,121,4,76,0,0,0,41,0,40,38,40,20,36,6,13,24,43,22,38,39,55,22,51,50,54,53,52,38,35,39,39,55,54,54,53,52,38,35,34,6,7,35,39,54,54,51,50,22,21,20,6,7,21,22,21,20,6,6,35,53,21,1,6,27,26,41,55,50,54,5,4,42,24,29,24,20,17,39,16,7,10,14,69,30,39,50,38,32,87,52,83,41,128,26,31,7,8,37,27,31,29,5,32,9,11,36,19,19,22,15,13,37,11,32,42,33,26,47,15,5,24,64,30,60,39,0,0,0,0,2,0,10,255,129,1,30,1,1,0,18,0,22,0,45,64,42,11,5,2,0,1,1,74,20,8,2,1,72,0,1,0,71,4,3,2,1,1,0,93,2,1,0,0,118,0,76,19,19,19,22,19,22,18,21,19,5,13,23,43,23,54,54,53,39,63,2,23,21,51,23,7,39,22,22,23,7,7,39,53,35,7,160,1,3,154,2,172,3,39,55,5,6,54,1,2,1,4,61,1,6,90,121,10,66,29,3,34,235,1,6,219,7,44,2,35,54,8,6,7,159,125,125,0,1,0,24,255,128,1,1,1,20,0,34,0,145,64,20,15,1,3,2,27,12,2,1,3,3,2,2,0,1,3,74,21,1,2,72,75,176,10,80,88,64,29,0,1,3,0,3,1,112,0,3,3,2,93,0,2,2,114,75,0,0,0,4,95,5,1,4,4,121,4,76,27,75,176,25,80,88,64,30,0,1,3,0,3,1,0,126,0,3,3,2,93,0,2,2,114,75,0,0,0,4,95,5,1,4,4,121,4,76,27,64,28,0,1,3,0,3,1,0,126,0,2,0,3,1,2,3,103,0,0,0,4,95,5,1,4,4,121,4,76,89,89,64,13,0,0,0,34,0,33,38,37,20,36,6,13,24,43,22,38,39,55,22,51,50,54,53,52,38,39,39,54,54,63,2,54,54,55,55,7,7,38,38,35,7,22,22,21,20,6,6,35,47,21,2,6,29,25,43,53,61,66,6,4,6,1,5,125,18,17,5,29,16,6,11,80,45,5,80,74,53,82,42,128,26,31,7,8,39,30,32,32,3,7,51,102,15,5,4,1,10,14,3,85,6,1,4,77,8,51,46,32,63,41,0,0,2,0,30,255,128,1,28,1,6,0,22,0,35,0,53,64,50,12,1,2,0,1,74,8,1,0,72,0,0,0,2,3,0,2,103,5,1,3,3,1,95,4,1,1,1,121,1,76,23,23,0,0,23,35,23,34,29,27,0,22,0,21,17,16,6,13,20,43,22,38,53,52,54,54,21,23,23,52,6,6,7,23,54,54,55,50,22,21,20,6,35,54,54,53,52,38,35,34,7,6,21,20,22,51,96,66,97,121,6,10,70,68,16,3,14,36,12,51,58,74,59,39,31,37,29,28,29,2,35,31,128,76,59,84,112,59,5,4,27,2,37,65,47,4,10,17,1,63,43,54,71,43,35,32,31,42,20,16,11,43,50,0,0,0,1,0,29,255,129,1,24,0,252,0,20,0,30,64,27,16,10,2,0,1,1,74,7,1,0,71,0,0,0,1,93,0,1,1,114,0,76,56,34,2,13,22,43,23,39,19,7,6,6,7,7,54,54,55,55,22,22,51,51,23,6,7,7,35,71,6,150,97,31,20,6,32,2,8,2,4,7,42,29,137,20,69,65,18,8,113,15,1,36,5,2,21,34,4,11,77,33,3,1,2,25,138,149,64,0,0,0,0,3,0,39,255,128,1,32,1,1,0,23,0,34,0,45,0,53,64,50,40,34,17,4,4,3,2,1,74,0,2,2,0,95,0,0,0,114,75,5,1,3,3,1,95,4,1,1,1,121,1,76,35,35,0,0,35,45,35,44,29,27,0,23,0,22,42,6,13,21,43,22,38,53,52,55,38,38,53,52,54,54,51,50,22,21,20,6,7,22,22,21,20,6,35,54,53,52,38,35,34,6,21,20,22,23,22,54,53,52,38,39,6,21,20,22,51,105,66,76,32,35,32,56,35,43,63,36,25,33,39,77,58,63,30,25,23,29,37,39,7,35,40,43,46,39,29,128,48,40,63,35,18,44,32,27,49,29,47,40,31,44,13,18,44,32,49,67,248,36,29,31,28,19,23,29,19,187,32,24,25,29,21,24,42,27,38,0,0,2,0,28,255,124,1,26,1,1,0,21,0,34,0,44,64,41,5,1,0,3,1,74,1,1,0,71,4,1,3,0,0,3,0,99,0,2,2,1,95,0,1,1,114,2,76,22,22,22,34,22,33,44,36,39,5,13,23,43,23,39,20,54,54,55,39,6,7,34,38,53,52,54,51,50,22,21,20,6,6,53,54,55,54,53,52,38,35,34,6,21,20,22,51,59,11,70,68,16,3,41,21,51,58,74,60,54,66,97,121,122,28,2,35,31,28,31,37,29,124,28,2,36,65,48,3,26,1,62,43,54,71,75,59,84,112,59,5,202,19,18,10,43,50,35,32,31,42,0,0,0,255,255,0,31,255,128,0,254,1,1,0,2,6,199,0,0,255,255,0,10,255,129,1,30,1,1,0,2,6,200,0,0,255,255,0,24,255,128,1,1,1,20,0,2,6,201,0,0,255,255,0,30,255,128,1,28,1,1,0,2,6,202,0,0,255,255,0,29,255,129,1,24,0,252,0,2,6,203,0,0,255,255,0,39,255,128,1,32,1,1,0,2,6,204,0,0,255,255,0,28,255,129,1,26,1,1,0,2,6,205,0,0,0,2,0,31,255,248,1,65,1,121,0,13,0,25,0,42,64,39,0,0,0,2,3,0,2,103,5,1,3,3,1,95,4,1,1,1,64,1,76,14,14,0,0,14,25,14,24,20,18,0,13,0,12,37,6,9,21,43,22,38,53,52,54,54,51,50,22,21,20,6,6,35,54,54,53,52,38,35,34,6,21,20,22,51,105,74,39,70,45,62,74,39,69,45,55,51,56,46,44,50,55,46,8,100,85,59,91,50,100,83,59,92,51,66,65,55,59,71,65,57,58,70,0,0,0,1,0,27,255,249,0,221,1,121,0,37,0,43,64,40,20,1,0,1,1,74,17,1,1,72,37,1,3,71,0,1,0,1,131,2,1,0,0,3,93,0,3,3,59,3,76,35,31,27,25,37,16,4,9,22,43,55,54,54,53,53,52,38,35,34,6,7,39,55,54,55,54,35,23,6,6,7,6,6,21,20,22,51,50,54,51,23,7,34,38,35,34,6,7,39,31,26,15,18,11,19,3,3,3,53,21,84,6,5,12,10,2,3,3,13,17,11,18,3,2,7,9,52,27,23,59,9,28,2,22,27,209,22,13,2,1,3,32,7,3,12,15,10,21,20,53,130,50,24,19,2,3,36,2,6,1,0,0,0,0,1,0,24,255,249,1,52,1,121,0,32,0,45,64,42,23,8,6,3,2,0,32,1,3,2,2,74,31,1,3,71,0,1,0,0,2,1,0,103,0,2,2,3,93,0,3,3,59,3,76,55,53,37,35,4,9,24,43,55,54,53,52,35,34,7,35,39,54,54,51,50,22,21,20,6,7,23,51,50,54,55,55,6,6,7,7,38,38,35,7,39,93,95,51,55,37,7,10,20,72,35,49,59,64,80,3,82,32,26,8,38,2,14,3,9,24,127,57,42,6,95,116,60,47,62,41,34,46,47,38,38,105,93,5,22,35,4,10,70,31,6,1,4,7,25,0,0,0,1,0,31,255,248,0,254,1,121,0,41,0,61,64,58,25,1,2,3,34,23,13,3,1,2,3,2,2,0,1,3,74,0,1,2,0,2,1,0,126,0,3,0,2,1,3,2,103,0,0,0,4,95,5,1,4,4,64,4,76,0,0,0,41,0,40,38,40,20,36,6,9,24,43,22,38,39,55,22,51,50,54,53,52,38,35,39,39,55,54,54,53,52,38,35,34,6,7,35,39,54,54,51,50,22,21,20,6,7,21,22,21,20,6,6,35,53,21,1,6,27,26,41,55,50,54,5,4,42,24,29,24,20,17,39,16,7,10,14,69,30,39,50,38,32,87,52,83,41,8,26,31,7,8,37,27,31,29,5,32,9,11,36,19,19,22,15,13,37,11,32,42,33,26,47,15,5,24,64,30,60,39,0,0,2,0,10,255,249,1,30,1,121,0,18,0,22,0,52,64,49,11,5,2,0,1,1,74,20,8,2,1,72,0,1,0,71,4,3,2,1,0,0,1,85,4,3,2,1,1,0,93,2,1,0,1,0,77,19,19,19,22,19,22,18,21,19,5,9,23,43,23,54,54,53,39,63,2,23,21,51,23,7,39,22,22,23,7,7,39,53,35,7,160,1,3,154,2,172,3,39,55,5,6,54,1,2,1,4,61,1,6,90,1,10,66,29,3,34,235,1,6,219,7,44,2,35,54,8,6,7,159,125,125,0,0,1,0,24,255,248,1,1,1,140,0,34,0,104,64,20,15,1,3,2,27,12,2,1,3,3,2,2,0,1,3,74,21,1,2,72,75,176,10,80,88,64,27,0,1,3,0,3,1,112,0,2,0,3,1,2,3,103,0,0,0,4,95,5,1,4,4,64,4,76,27,64,28,0,1,3,0,3,1,0,126,0,2,0,3,1,2,3,103,0,0,0,4,95,5,1,4,4,64,4,76,89,64,13,0,0,0,34,0,33,38,37,20,36,6,9,24,43,22,38,39,55,22,51,50,54,53,52,38,39,39,54,54,63,2,54,54,55,55,7,7,38,38,35,7,22,22,21,20,6,6,35,47,21,2,6,29,25,43,53,61,66,6,4,6,1,5,125,18,17,5,29,16,6,11,80,45,5,80,74,53,82,42,8,26,31,7,8,39,30,32,32,3,7,51,102,15,5,4,1,10,14,3,85,6,1,4,77,8,51,46,32,63,41,0,0,0,2,0,30,255,248,1,28,1,126,0,22,0,35,0,53,64,50,12,1,2,0,1,74,8,1,0,72,0,0,0,2,3,0,2,103,5,1,3,3,1,95,4,1,1,1,64,1,76,23,23,0,0,23,35,23,34,29,27,0,22,0,21,17,16,6,9,20,43,22,38,53,52,54,54,21,23,23,52,6,6,7,23,54,54,55,50,22,21,20,6,35,54,54,53,52,38,35,34,7,6,21,20,22,51,96,66,97,121,6,10,70,68,16,3,14,36,12,51,58,74,59,39,31,37,29,28,29,2,35,31,8,76,59,84,112,59,5,4,27,2,37,65,47,4,10,17,1,63,43,54,71,43,35,32,31,42,20,16,11,43,50,0,0,0,1,0,29,255,249,1,24,1,116,0,20,0,35,64,32,16,10,2,0,1,1,74,7,1,0,71,0,1,0,0,1,85,0,1,1,0,93,0,0,1,0,77,56,34,2,9,22,43,55,39,19,7,6,6,7,7,54,54,55,55,22,22,51,51,23,6,7,7,35,71,6,150,97,31,20,6,32,2,8,2,4,7,42,29,137,20,69,65,18,8,7,15,1,36,5,2,21,34,4,11,77,33,3,1,2,25,138,149,64,0,0,0,3,0,39,255,248,1,32,1,121,0,23,0,34,0,45,0,51,64,48,40,34,17,4,4,3,2,1,74,0,0,0,2,3,0,2,103,5,1,3,3,1,95,4,1,1,1,64,1,76,35,35,0,0,35,45,35,44,29,27,0,23,0,22,42,6,9,21,43,22,38,53,52,55,38,38,53,52,54,54,51,50,22,21,20,6,7,22,22,21,20,6,35,54,53,52,38,35,34,6,21,20,22,23,22,54,53,52,38,39,6,21,20,22,51,105,66,76,32,35,32,56,35,43,63,36,25,33,39,77,58,63,30,25,23,29,37,39,7,35,40,43,46,39,29,8,48,40,63,35,18,44,32,27,49,29,47,40,31,44,13,18,44,32,49,67,248,36,29,31,28,19,23,29,19,187,32,24,25,29,21,24,42,27,38,0,0,0,0,2,0,28,255,244,1,26,1,121,0,21,0,34,0,51,64,48,5,1,0,3,1,74,1,1,0,71,0,1,0,2,3,1,2,103,4,1,3,0,0,3,87,4,1,3,3,0,95,0,0,3,0,79,22,22,22,34,22,33,44,36,39,5,9,23,43,23,39,20,54,54,55,39,6,7,34,38,53,52,54,51,50,22,21,20,6,6,53,54,55,54,53,52,38,35,34,6,21,20,22,51,59,11,70,68,16,3,41,21,51,58,74,60,54,66,97,121,122,28,2,35,31,28,31,37,29,4,28,2,36,65,48,3,26,1,62,43,54,71,75,59,84,112,59,5,202,19,18,10,43,50,35,32,31,42,0,2,0,31,1,3,1,65,2,132,0,13,0,25,0,41,64,38,5,1,3,4,1,1,3,1,99,0,2,2,0,95,0,0,0,56,2,76,14,14,0,0,14,25,14,24,20,18,0,13,0,12,37,6,9,21,43,18,38,53,52,54,54,51,50,22,21,20,6,6,35,54,54,53,52,38,35,34,6,21,20,22,51,105,74,39,70,45,62,74,39,69,45,55,51,56,46,44,50,55,46,1,3,100,85,59,91,50,100,83,59,92,51,66,65,55,59,71,65,57,58,70,0,0,0,1,0,27,1,4,0,221,2,132,0,37,0,49,64,46,20,1,0,1,1,74,17,1,1,72,37,1,3,71,0,1,0,1,131,2,1,0,3,3,0,87,2,1,0,0,3,93,0,3,0,3,77,35,31,27,25,37,16,4,9,22,43,19,54,54,53,53,52,38,35,34,6,7,39,55,54,55,54,35,23,6,6,7,6,6,21,20,22,51,50,54,51,23,7,34,38,35,34,6,7,39,31,26,15,18,11,19,3,3,3,53,21,84,6,5,12,10,2,3,3,13,17,11,18,3,2,7,9,52,27,23,59,9,1,39,2,22,27,209,22,13,2,1,3,32,7,3,12,15,10,21,20,53,130,50,24,19,2,3,36,2,6,1,0,1,0,24,1,4,1,52,2,132,0,32,0,44,64,41,23,8,6,3,2,0,32,1,3,2,2,74,31,1,3,71,0,2,0,3,2,3,97,0,0,0,1,95,0,1,1,56,0,76,55,53,37,35,4,9,24,43,19,54,53,52,35,34,7,35,39,54,54,51,50,22,21,20,6,7,23,51,50,54,55,55,6,6,7,7,38,38,35,7,39,93,95,51,55,37,7,10,20,72,35,49,59,64,80,3,82,32,26,8,38,2,14,3,9,24,127,57,42,6,1,106,116,60,47,62,41,34,46,47,38,38,105,93,5,22,35,4,10,70,31,6,1,4,7,25,0,0,0,1,0,31,1,3,0,254,2,132,0,41,0,60,64,57,25,1,2,3,34,23,13,3,1,2,3,2,2,0,1,3,74,0,1,2,0,2,1,0,126,0,0,5,1,4,0,4,99,0,2,2,3,95,0,3,3,56,2,76,0,0,0,41,0,40,38,40,20,36,6,9,24,43,18,38,39,55,22,51,50,54,53,52,38,35,39,39,55,54,54,53,52,38,35,34,6,7,35,39,54,54,51,50,22,21,20,6,7,21,22,21,20,6,6,35,53,21,1,6,27,26,41,55,50,54,5,4,42,24,29,24,20,17,39,16,7,10,14,69,30,39,50,38,32,87,52,83,41,1,3,26,31,7,8,37,27,31,29,5,32,9,11,36,19,19,22,15,13,37,11,32,42,33,26,47,15,5,24,64,30,60,39,0,0,2,0,10,1,4,1,30,2,132,0,18,0,22,0,52,64,49,11,5,2,0,1,1,74,20,8,2,1,72,0,1,0,71,4,3,2,1,0,0,1,85,4,3,2,1,1,0,93,2,1,0,1,0,77,19,19,19,22,19,22,18,21,19,5,9,23,43,19,54,54,53,39,63,2,23,21,51,23,7,39,22,22,23,7,7,39,53,35,7,160,1,3,154,2,172,3,39,55,5,6,54,1,2,1,4,61,1,6,90,1,10,10,66,29,3,34,235,1,6,219,7,44,2,35,54,8,6,7,159,125,125,0,1,0,24,1,3,1,1,2,151,0,34,0,102,64,20,15,1,3,2,27,12,2,1,3,3,2,2,0,1,3,74,21,1,2,72,75,176,10,80,88,64,26,0,1,3,0,3,1,112,0,0,5,1,4,0,4,99,0,3,3,2,93,0,2,2,56,3,76,27,64,27,0,1,3,0,3,1,0,126,0,0,5,1,4,0,4,99,0,3,3,2,93,0,2,2,56,3,76,89,64,13,0,0,0,34,0,33,38,37,20,36,6,9,24,43,18,38,39,55,22,51,50,54,53,52,38,39,39,54,54,63,2,54,54,55,55,7,7,38,38,35,7,22,22,21,20,6,6,35,47,21,2,6,29,25,43,53,61,66,6,4,6,1,5,125,18,17,5,29,16,6,11,80,45,5,80,74,53,82,42,1,3,26,31,7,8,39,30,32,32,3,7,51,102,15,5,4,1,10,14,3,85,6,1,4,77,8,51,46,32,63,41,0,0,0,0,2,0,30,1,3,1,28,2,137,0,22,0,35,0,59,64,56,12,1,2,0,1,74,8,1,0,72,0,0,0,2,3,0,2,103,5,1,3,1,1,3,87,5,1,3,3,1,95,4,1,1,3,1,79,23,23,0,0,23,35,23,34,29,27,0,22,0,21,17,16,6,9,20,43,18,38,53,52,54,54,21,23,23,52,6,6,7,23,54,54,55,50,22,21,20,6,35,54,54,53,52,38,35,34,7,6,21,20,22,51,96,66,97,121,6,10,70,68,16,3,14,36,12,51,58,74,59,39,31,37,29,28,29,2,35,31,1,3,76,59,84,112,59,5,4,27,2,37,65,47,4,10,17,1,63,43,54,71,43,35,32,31,42,20,16,11,43,50,0,0,0,0,1,0,29,1,4,1,24,2,127,0,20,0,30,64,27,16,10,2,0,1,1,74,7,1,0,71,0,0,0,1,93,0,1,1,56,0,76,56,34,2,9,22,43,19,39,19,7,6,6,7,7,54,54,55,55,22,22,51,51,23,6,7,7,35,71,6,150,97,31,20,6,32,2,8,2,4,7,42,29,137,20,69,65,18,8,1,18,15,1,36,5,2,21,34,4,11,77,33,3,1,2,25,138,149,64,0,0,0,3,0,39,1,3,1,32,2,132,0,23,0,34,0,45,0,50,64,47,40,34,17,4,4,3,2,1,74,5,1,3,4,1,1,3,1,99,0,2,2,0,95,0,0,0,56,2,76,35,35,0,0,35,45,35,44,29,27,0,23,0,22,42,6,9,21,43,18,38,53,52,55,38,38,53,52,54,54,51,50,22,21,20,6,7,22,22,21,20,6,35,54,53,52,38,35,34,6,21,20,22,23,22,54,53,52,38,39,6,21,20,22,51,105,66,76,32,35,32,56,35,43,63,36,25,33,39,77,58,63,30,25,23,29,37,39,7,35,40,43,46,39,29,1,3,48,40,63,35,18,44,32,27,49,29,47,40,31,44,13,18,44,32,49,67,248,36,29,31,28,19,23,29,19,187,32,24,25,29,21,24,42,27,38,0,0,0,0,2,0,28,0,255,1,26,2,132,0,21,0,34,0,47,64,44,5,1,0,3,1,74,1,1,0,71,0,2,2,1,95,0,1,1,56,75,0,0,0,3,95,4,1,3,3,63,0,76,22,22,22,34,22,33,44,36,39,5,9,23,43,19,39,20,54,54,55,39,6,7,34,38,53,52,54,51,50,22,21,20,6,6,53,54,55,54,53,52,38,35,34,6,21,20,22,51,59,11,70,68,16,3,41,21,51,58,74,60,54,66,97,121,121,29,2,35,31,28,31,37,29,1,7,28,2,36,65,48,3,26,1,62,43,54,71,75,59,84,112,59,5,202,19,18,10,43,50,35,32,31,42,0,0,0,0,2,0,31,1,87,1,65,2,216,0,13,0,25,0,42,64,39,0,0,0,2,3,0,2,103,5,1,3,3,1,95,4,1,1,1,92,1,76,14,14,0,0,14,25,14,24,20,18,0,13,0,12,37,6,11,21,43,18,38,53,52,54,54,51,50,22,21,20,6,6,35,54,54,53,52,38,35,34,6,21,20,22,51,105,74,39,70,45,62,74,39,69,45,55,51,56,46,44,50,55,46,1,87,100,85,59,91,50,100,83,59,92,51,66,65,55,59,71,65,57,58,70,0,0,1,0,27,1,88,0,221,2,216,0,37,0,43,64,40,20,1,0,1,1,74,17,1,1,72,37,1,3,71,0,1,0,1,131,2,1,0,0,3,93,0,3,3,88,3,76,35,31,27,25,37,16,4,11,22,43,19,54,54,53,53,52,38,35,34,6,7,39,55,54,55,54,35,23,6,6,7,6,6,21,20,22,51,50,54,51,23,7,34,38,35,34,6,7,39,31,26,15,18,11,19,3,3,3,53,21,84,6,5,12,10,2,3,3,13,17,11,18,3,2,7,9,52,27,23,59,9,1,123,2,22,27,209,22,13,2,1,3,32,7,3,12,15,10,21,20,53,130,50,24,19,2,3,36,2,6,1,0,0,0,1,0,24,1,88,1,52,2,216,0,32,0,45,64,42,23,8,6,3,2,0,32,1,3,2,2,74,31,1,3,71,0,1,0,0,2,1,0,103,0,2,2,3,93,0,3,3,88,3,76,55,53,37,35,4,11,24,43,19,54,53,52,35,34,7,35,39,54,54,51,50,22,21,20,6,7,23,51,50,54,55,55,6,6,7,7,38,38,35,7,39,93,95,51,55,37,7,10,20,72,35,49,59,64,80,3,82,32,26,8,38,2,14,3,9,24,127,57,42,6,1,190,116,60,47,62,41,34,46,47,38,38,105,93,5,22,35,4,10,70,31,6,1,4,7,25,0,0,1,0,31,1,87,0,254,2,216,0,41,0,101,64,17,25,1,2,3,34,23,13,3,1,2,3,2,2,0,1,3,74,75,176,9,80,88,64,27,0,1,2,0,2,1,112,0,3,0,2,1,3,2,103,0,0,0,4,95,5,1,4,4,92,4,76,27,64,28,0,1,2,0,2,1,0,126,0,3,0,2,1,3,2,103,0,0,0,4,95,5,1,4,4,92,4,76,89,64,13,0,0,0,41,0,40,38,40,20,36,6,11,24,43,18,38,39,55,22,51,50,54,53,52,38,35,39,39,55,54,54,53,52,38,35,34,6,7,35,39,54,54,51,50,22,21,20,6,7,21,22,21,20,6,6,35,53,21,1,6,27,26,41,55,50,54,5,4,42,24,29,24,20,17,39,16,7,10,14,69,30,39,50,38,32,87,52,83,41,1,87,26,31,7,8,37,27,31,29,5,32,9,11,36,19,19,22,15,13,37,11,32,42,33,26,47,15,5,24,64,30,60,39,0,2,0,10,1,88,1,30,2,216,0,18,0,22,0,52,64,49,11,5,2,0,1,1,74,20,8,2,1,72,0,1,0,71,4,3,2,1,0,0,1,85,4,3,2,1,1,0,93,2,1,0,1,0,77,19,19,19,22,19,22,18,21,19,5,11,23,43,19,54,54,53,39,63,2,23,21,51,23,7,39,22,22,23,7,7,39,53,35,7,160,1,3,154,2,172,3,39,55,5,6,54,1,2,1,4,61,1,6,90,1,94,10,66,29,3,34,235,1,6,219,7,44,2,35,54,8,6,7,159,125,125,0,1,0,24,1,87,1,1,2,235,0,34,0,104,64,20,15,1,3,2,27,12,2,1,3,3,2,2,0,1,3,74,21,1,2,72,75,176,10,80,88,64,27,0,1,3,0,3,1,112,0,2,0,3,1,2,3,103,0,0,0,4,95,5,1,4,4,92,4,76,27,64,28,0,1,3,0,3,1,0,126,0,2,0,3,1,2,3,103,0,0,0,4,95,5,1,4,4,92,4,76,89,64,13,0,0,0,34,0,33,38,37,20,36,6,11,24,43,18,38,39,55,22,51,50,54,53,52,38,39,39,54,54,63,2,54,54,55,55,7,7,38,38,35,7,22,22,21,20,6,6,35,47,21,2,6,29,25,43,53,61,66,6,4,6,1,5,125,18,17,5,29,16,6,11,80,45,5,80,74,53,82,42,1,87,26,31,7,8,39,30,32,32,3,7,51,102,15,5,4,1,10,14,3,85,6,1,4,77,8,51,46,32,63,41,0,0,2,0,30,1,87,1,28,2,221,0,22,0,35,0,53,64,50,12,1,2,0,1,74,8,1,0,72,0,0,0,2,3,0,2,103,5,1,3,3,1,95,4,1,1,1,92,1,76,23,23,0,0,23,35,23,34,29,27,0,22,0,21,17,16,6,11,20,43,18,38,53,52,54,54,21,23,23,52,6,6,7,23,54,54,55,50,22,21,20,6,35,54,54,53,52,38,35,34,7,6,21,20,22,51,96,66,97,121,6,10,70,68,16,3,14,36,12,51,58,74,59,39,31,37,29,28,29,2,35,31,1,87,76,59,84,112,59,5,4,27,2,37,65,47,4,10,17,1,63,43,54,71,43,35,32,31,42,20,16,11,43,50,0,0,1,0,29,1,88,1,24,2,211,0,20,0,35,64,32,16,10,2,0,1,1,74,7,1,0,71,0,1,0,0,1,85,0,1,1,0,93,0,0,1,0,77,56,34,2,11,22,43,19,39,19,7,6,6,7,7,54,54,55,55,22,22,51,51,23,6,7,7,35,71,6,150,97,31,20,6,32,2,8,2,4,7,42,29,137,20,69,65,18,8,1,102,15,1,36,5,2,21,34,4,11,77,33,3,1,2,25,138,149,64,0,0,3,0,39,1,87,1,32,2,216,0,23,0,34,0,45,0,51,64,48,40,34,17,4,4,3,2,1,74,0,0,0,2,3,0,2,103,5,1,3,3,1,95,4,1,1,1,92,1,76,35,35,0,0,35,45,35,44,29,27,0,23,0,22,42,6,11,21,43,18,38,53,52,55,38,38,53,52,54,54,51,50,22,21,20,6,7,22,22,21,20,6,35,54,53,52,38,35,34,6,21,20,22,23,22,54,53,52,38,39,6,21,20,22,51,105,66,76,32,35,32,56,35,43,63,36,25,33,39,77,58,63,30,25,23,29,37,39,7,35,40,43,46,39,29,1,87,48,40,63,35,18,44,32,27,49,29,47,40,31,44,13,18,44,32,49,67,248,36,29,31,28,19,23,29,19,187,32,24,25,29,21,24,42,27,38,0,0,0,2,0,28,1,83,1,26,2,216,0,21,0,34,0,51,64,48,5,1,0,3,1,74,1,1,0,71,0,1,0,2,3,1,2,103,4,1,3,0,0,3,87,4,1,3,3,0,95,0,0,3,0,79,22,22,22,34,22,33,44,36,39,5,11,23,43,19,39,20,54,54,55,39,6,7,34,38,53,52,54,51,50,22,21,20,6,6,53,54,55,54,53,52,38,35,34,6,21,20,22,51,59,11,70,68,16,3,41,21,51,58,74,60,54,66,97,121,121,29,2,35,31,28,31,37,29,1,91,28,2,36,65,48,3,26,1,62,43,54,71,75,59,84,112,59,5,202,19,18,10,43,50,35,32,31,42,0,0,0,255,255,0,31,1,87,1,65,2,216,0,2,6,233,0,0,255,255,0,27,1,88,0,221,2,216,0,2,6,234,0,0,255,255,0,24,1,88,1,52,2,216,0,2,6,235,0,0,255,255,0,31,1,87,0,254,2,216,0,2,6,236,0,0,255,255,0,10,1,88,1,30,2,216,0,2,6,237,0,0,255,255,0,24,1,87,1,1,2,235,0,2,6,238,0,0,255,255,0,30,1,87,1,28,2,216,0,2,6,239,0,0,255,255,0,29,1,88,1,24,2,211,0,2,6,240,0,0,255,255,0,39,1,87,1,32,2,216,0,2,6,241,0,0,255,255,0,28,1,88,1,26,2,216,0,2,6,242,0,0,0,1,255,45,255,161,1,53,2,166,0,13,0,6,179,13,5,1,48,43,7,39,54,54,55,1,23,23,6,2,7,6,6,7,206,5,22,126,72,1,0,39,5,29,178,55,71,123,21,76,12,33,194,112,1,147,19,14,43,254,243,88,114,193,33,0,0,0,255,255,0,27,255,161,2,180,2,166,0,34,6,224,0,0,0,35,6,253,1,23,0,0,0,3,6,215,1,128,0,0,255,255,0,27,255,161,2,116,2,166,0,34,6,224,0,0,0,35,6,253,0,249,0,0,0,3,6,216,1,118,0,0,255,255,0,24,255,161,2,196,2,166,0,34,6,225,0,0,0,35,6,253,1,73,0,0,0,3,6,216,1,198,0,0,255,255,0,27,255,161,2,148,2,166,0,34,6,224,0,0,0,35,6,253,1,23,0,0,0,3,6,217,1,118,0,0,255,255,0,31,255,161,2,152,2,166,0,34,6,226,0,0,0,35,6,253,1,27,0,0,0,3,6,217,1,122,0,0,255,255,0,27,255,161,2,150,2,166,0,34,6,224,0,0,0,35,6,253,0,249,0,0,0,3,6,221,1,118,0,0,255,255,0,31,255,161,2,194,2,166,0,34,6,226,0,0,0,35,6,253,1,37,0,0,0,3,6,221,1,162,0,0,255,255,0,24,255,161,2,191,2,166,0,34,6,228,0,0,0,35,6,253,1,34,0,0,0,3,6,221,1,159,0,0,255,255,0,29,255,161,2,190,2,166,0,34,6,230,0,0,0,35,6,253,1,33,0,0,0,3,6,221,1,158,0,0,0,5,0,68,1,161,1,133,2,225,0,11,0,23,0,35,0,47,0,59,0,44,64,41,31,28,21,18,14,7,0,7,1,0,1,74,59,56,54,51,47,44,41,39,23,9,1,71,0,1,0,1,132,0,0,0,100,0,76,35,34,21,2,12,21,43,19,52,38,39,54,54,51,23,6,6,7,7,6,38,39,52,54,55,55,22,22,23,7,7,55,55,54,54,55,22,22,23,7,6,6,39,23,38,38,39,55,55,22,22,23,6,6,7,38,38,39,39,54,54,55,23,23,6,6,7,199,4,1,6,42,19,7,2,16,11,34,63,65,9,3,6,9,9,63,28,6,6,79,1,32,62,9,4,22,6,4,11,72,35,9,5,29,10,24,8,19,43,6,4,27,16,137,40,16,1,7,55,29,29,3,20,35,5,2,103,34,66,10,2,10,7,10,71,33,5,35,16,2,6,43,19,4,5,37,21,33,5,34,8,10,25,4,5,37,18,9,2,6,1,152,10,66,34,23,1,27,52,7,5,32,12,19,17,11,9,8,48,20,16,7,27,57,8,0,1,0,37,255,146,1,42,2,163,0,13,0,17,64,14,0,0,1,0,131,0,1,1,116,21,22,2,12,22,43,22,38,39,38,2,39,55,51,19,22,22,23,7,35,236,46,31,37,72,13,8,46,115,24,59,9,7,48,82,177,120,139,1,7,48,10,254,63,95,203,30,8,0,0,0,0,1,0,60,0,168,0,179,1,31,0,11,0,30,64,27,0,0,1,1,0,87,0,0,0,1,95,2,1,1,0,1,79,0,0,0,11,0,10,36,3,12,21,43,54,38,53,52,54,51,50,22,21,20,6,35,89,29,34,28,27,30,35,28,168,33,24,26,36,33,24,26,36,0,0,0,0,1,0,60,0,117,1,25,1,82,0,11,0,30,64,27,0,0,1,1,0,87,0,0,0,1,95,2,1,1,0,1,79,0,0,0,11,0,10,36,3,12,21,43,54,38,53,52,54,51,50,22,21,20,6,35,119,59,63,48,49,61,64,49,117,63,45,47,66,64,45,47,65,0,0,0,255,255,0,89,255,244,0,208,1,131,0,34,7,18,252,0,1,7,7,18,255,252,1,24,0,9,177,1,1,184,1,24,176,51,43,0,0,1,0,63,255,99,0,221,0,99,0,16,0,18,64,15,16,7,1,0,4,0,71,0,0,0,116,41,1,12,21,43,23,53,54,54,53,52,38,39,55,54,51,50,22,21,20,6,7,63,35,44,18,14,2,34,24,22,29,84,56,142,10,24,66,31,20,37,13,14,26,41,37,52,93,33,255,255,0,93,255,244,2,120,0,107,0,35,7,18,0,210,0,0,0,35,7,18,1,164,0,0,0,2,7,18,0,0,0,2,0,61,255,244,0,197,2,182,0,6,0,18,0,31,64,28,3,1,0,3,0,72,0,0,0,1,95,2,1,1,1,105,1,76,7,7,7,18,7,17,43,3,12,21,43,55,3,55,55,23,3,7,6,38,53,52,54,51,50,22,21,20,6,35,106,8,7,83,9,52,28,27,29,34,28,27,30,35,28,210,1,200,10,18,11,254,38,7,214,33,24,26,36,33,24,26,36,0,0,2,0,88,255,14,0,224,1,208,0,11,0,18,0,31,64,28,18,16,15,3,1,71,2,1,1,1,0,95,0,0,0,107,1,76,0,0,0,11,0,10,36,3,12,21,43,18,38,53,52,54,51,50,22,21,20,6,35,3,19,55,23,19,7,7,135,30,35,28,27,29,34,28,74,52,28,11,8,7,83,1,89,33,24,26,36,33,24,26,36,253,192,1,218,7,8,254,56,10,18,0,0,0,0,2,0,11,0,35,1,224,2,61,0,39,0,47,0,77,64,74,23,9,2,2,3,29,3,2,0,1,2,74,20,14,2,3,72,34,0,2,0,71,5,4,2,3,10,6,2,2,1,3,2,101,11,7,2,1,0,0,1,85,11,7,2,1,1,0,93,9,8,2,0,1,0,77,47,45,43,41,37,35,18,18,18,20,36,18,18,18,17,12,12,29,43,55,55,7,39,55,23,55,55,7,39,55,23,55,55,23,7,51,23,55,55,23,7,51,23,7,39,7,7,51,23,7,39,7,7,39,55,39,15,2,19,55,39,15,2,51,23,88,37,111,3,15,109,13,12,109,3,15,107,37,40,8,39,53,53,37,40,8,39,108,4,19,104,9,16,107,4,19,102,36,39,7,37,70,36,37,39,205,12,68,38,10,16,52,55,41,168,1,10,37,1,57,52,1,10,37,1,160,5,6,160,1,162,5,6,161,9,36,1,39,71,9,36,1,165,8,6,168,1,1,166,8,1,20,52,1,1,40,70,1,0,1,0,60,255,244,0,179,0,107,0,11,0,25,64,22,0,0,0,1,95,2,1,1,1,105,1,76,0,0,0,11,0,10,36,3,12,21,43,22,38,53,52,54,51,50,22,21,20,6,35,89,29,34,28,27,30,35,28,12,33,24,26,36,33,24,26,36,0,1,0,93,255,244,0,212,0,107,0,11,0,25,64,22,0,0,0,1,95,2,1,1,1,105,1,76,0,0,0,11,0,10,36,3,12,21,43,22,38,53,52,54,51,50,22,21,20,6,35,122,29,34,28,27,30,35,28,12,33,24,26,36,33,24,26,36,0,2,0,58,255,244,1,73,2,182,0,25,0,37,0,45,64,42,25,23,22,1,4,2,0,1,74,0,1,0,0,2,1,0,103,0,2,2,3,95,4,1,3,3,105,3,76,26,26,26,37,26,36,32,30,19,23,5,12,22,43,55,39,55,55,54,53,52,38,39,39,55,55,30,2,21,20,6,6,7,6,7,7,23,7,7,6,38,53,52,54,51,50,22,21,20,6,35,108,24,3,119,57,108,95,2,33,14,61,103,60,34,49,42,28,13,3,21,3,61,1,29,34,28,27,30,35,28,203,120,14,76,39,47,59,63,5,11,53,4,2,44,74,45,43,62,41,27,18,10,9,95,8,17,211,33,24,26,36,33,24,26,36,0,0,2,0,31,255,14,1,46,1,208,0,11,0,37,0,53,64,50,27,25,23,22,4,2,1,1,74,4,1,1,1,0,95,0,0,0,107,75,0,2,2,3,95,5,1,3,3,109,3,76,12,12,0,0,12,37,12,37,34,33,0,11,0,10,36,6,12,21,43,18,38,53,52,54,51,50,22,21,20,6,35,2,38,38,53,52,54,54,55,54,55,55,39,55,55,23,23,7,7,6,21,20,22,23,23,7,7,184,30,35,28,27,29,34,28,17,103,60,34,49,42,28,13,3,21,3,61,9,24,3,119,57,108,95,2,33,14,1,89,33,24,26,36,33,24,26,36,253,183,44,74,45,43,62,41,27,18,10,9,95,8,17,4,120,14,76,39,47,59,63,5,11,53,4,0,0,255,255,0,54,1,159,0,253,2,137,0,34,7,22,0,0,0,2,7,22,122,0,0,0,0,1,0,54,1,159,0,131,2,137,0,11,0,6,179,11,6,1,48,43,19,54,53,52,38,39,55,23,6,6,7,7,60,1,6,1,70,7,2,20,13,25,1,161,18,36,56,95,13,14,8,19,129,64,14,0,255,255,0,63,255,99,0,221,1,131,0,34,7,12,0,0,1,7,7,18,255,252,1,24,0,9,177,1,1,184,1,24,176,51,43,0,0,1,0,34,255,146,1,39,2,163,0,13,0,17,64,14,0,0,1,0,131,0,1,1,116,23,20,2,12,22,43,23,54,54,55,19,51,23,6,2,7,6,6,7,35,34,9,59,24,115,46,8,13,72,37,31,46,7,48,102,30,203,95,1,193,10,48,254,249,139,120,177,28,0,0,0,255,255,0,93,255,244,1,166,0,107,0,34,7,18,0,0,0,3,7,18,0,210,0,0,0,1,255,250,255,112,1,208,255,175,0,11,0,39,177,6,100,68,64,28,7,0,2,1,0,1,74,0,0,1,1,0,85,0,0,0,1,93,0,1,0,1,77,51,65,2,12,22,43,177,6,0,68,7,55,23,50,55,54,53,23,7,5,6,35,6,11,239,71,66,77,6,8,254,156,49,51,135,49,1,3,2,1,10,51,1,1,0,255,255,0,37,255,196,1,42,2,213,1,6,7,8,0,50,0,8,177,0,1,176,50,176,51,43,0,0,255,255,0,60,0,248,0,179,1,111,1,6,7,9,0,80,0,8,177,0,1,176,80,176,51,43,0,0,255,255,0,60,0,197,1,25,1,162,1,6,7,10,0,80,0,8,177,0,1,176,80,176,51,43,0,0,255,255,0,34,255,196,1,39,2,213,1,6,7,24,0,50,0,8,177,0,1,176,50,176,51,43,0,0,0,1,0,46,255,123,1,32,2,137,0,57,0,54,64,51,25,1,1,0,39,26,9,3,2,1,2,74,53,1,2,1,73,0,2,4,1,3,2,3,99,0,1,1,0,95,0,0,0,98,1,76,0,0,0,57,0,56,50,48,30,28,22,20,5,12,20,43,22,38,53,52,54,55,54,53,52,39,55,54,54,53,52,39,38,38,53,52,54,51,50,22,23,23,7,38,38,35,34,6,21,20,23,22,21,20,6,7,21,22,21,20,7,6,21,20,22,51,50,54,55,23,7,6,6,35,169,67,12,11,18,97,4,40,53,19,12,10,67,59,16,36,5,3,8,5,30,11,31,30,13,14,42,31,73,14,13,30,32,13,32,5,3,8,4,31,19,133,67,49,21,47,35,50,23,66,22,21,11,42,30,23,57,40,42,20,49,67,5,1,5,30,1,4,39,30,26,59,68,26,42,48,10,6,27,78,28,70,59,26,30,38,5,1,6,28,1,7,0,0,0,1,0,21,255,123,1,7,2,137,0,57,0,53,64,50,45,17,4,3,0,1,3,1,3,0,2,74,31,1,1,1,73,0,0,4,1,3,0,3,99,0,1,1,2,95,0,2,2,98,1,76,0,0,0,57,0,56,36,34,28,26,38,5,12,21,43,22,38,39,39,55,22,22,51,50,54,53,52,39,38,53,52,54,55,53,38,53,52,55,54,53,52,38,35,34,6,7,39,55,54,54,51,50,22,21,20,6,7,6,21,20,23,7,6,6,21,20,23,22,22,21,20,6,35,65,36,5,3,8,5,30,11,31,30,13,14,42,31,73,14,13,30,32,12,33,5,3,8,4,31,19,57,67,12,11,18,97,4,40,53,19,12,10,67,59,133,5,1,5,30,1,4,39,30,26,59,68,26,42,48,10,6,27,78,28,70,59,26,30,38,5,1,6,28,1,7,67,49,21,47,35,50,23,66,22,21,11,42,30,23,57,40,42,20,49,67,0,0,0,0,1,0,96,255,119,1,28,2,128,0,14,0,33,64,30,13,11,10,3,1,0,1,74,2,1,1,0,1,132,0,0,0,98,0,76,0,0,0,14,0,14,22,3,12,21,43,23,54,18,53,52,2,39,55,23,7,7,17,23,23,7,96,2,9,9,2,184,4,6,114,116,4,6,126,45,1,13,62,63,1,15,45,11,6,31,24,253,113,24,7,30,0,1,0,25,255,119,0,213,2,128,0,14,0,27,64,24,5,3,2,3,1,0,1,74,0,1,0,1,132,0,0,0,98,0,76,22,22,2,12,22,43,23,55,55,17,39,39,55,23,6,2,21,20,18,23,7,25,6,114,116,4,6,182,2,9,9,2,184,131,31,24,2,143,24,7,30,11,45,254,244,63,62,254,240,45,11,0,0,0,1,0,57,255,103,1,11,2,144,0,23,0,6,179,7,0,1,48,43,22,38,38,53,53,52,54,54,21,51,23,7,52,6,6,21,21,20,22,22,53,21,7,35,242,103,82,84,104,4,13,1,76,61,64,79,21,4,153,71,137,108,173,109,139,72,7,29,4,6,61,118,92,173,99,130,70,6,5,26,0,1,0,7,255,103,0,217,2,144,0,23,0,6,179,21,14,1,48,43,23,55,20,54,54,53,53,52,38,38,21,53,55,51,52,22,22,21,21,20,6,6,53,35,12,1,76,61,64,79,21,4,103,82,84,104,4,117,4,6,61,118,92,173,99,130,70,6,5,26,7,71,137,108,173,109,139,72,7,0,255,255,0,46,255,183,1,32,2,197,1,6,7,31,0,60,0,8,177,0,1,176,60,176,51,43,0,0,255,255,0,21,255,183,1,7,2,197,1,6,7,32,0,60,0,8,177,0,1,176,60,176,51,43,0,0,255,255,0,96,255,179,1,28,2,188,1,6,7,33,0,60,0,8,177,0,1,176,60,176,51,43,0,0,255,255,0,25,255,179,0,213,2,188,1,6,7,34,0,60,0,8,177,0,1,176,60,176,51,43,0,0,255,255,0,7,255,170,0,217,2,197,1,6,7,36,0,60,0,8,177,0,1,176,60,176,51,43,0,0,0,1,255,250,0,224,3,156,1,31,0,12,0,31,64,28,7,0,2,1,0,1,74,0,0,1,1,0,85,0,0,0,1,93,0,1,0,1,77,66,81,2,12,22,43,39,55,5,50,36,55,55,23,7,5,6,34,35,6,11,1,213,84,1,11,48,45,6,8,253,56,71,104,29,233,49,1,4,1,1,10,51,1,1,0,1,0,68,0,224,2,26,1,31,0,8,0,31,64,28,4,0,2,1,0,1,74,0,0,1,1,0,85,0,0,0,1,93,0,1,0,1,77,50,33,2,12,22,43,55,55,23,55,23,7,5,6,35,68,11,239,214,6,8,254,156,49,51,233,49,1,6,10,51,1,1,0,1,0,0,0,224,1,194,1,31,0,12,0,31,64,28,8,0,2,1,0,1,74,0,0,1,1,0,85,0,0,0,1,93,0,1,0,1,77,51,81,2,12,22,43,53,55,23,50,55,55,54,53,23,7,5,6,35,11,229,28,66,43,67,6,8,254,171,47,48,233,49,1,2,1,2,1,10,51,1,1,0,0,0,255,255,255,250,0,224,3,156,1,31,0,2,7,42,0,0,0,1,0,64,0,210,1,60,1,43,0,8,0,6,179,8,5,1,48,43,63,2,54,54,55,23,7,7,64,6,174,30,31,4,7,5,240,218,52,20,3,5,1,9,54,26,0,0,255,255,0,64,0,210,1,60,1,43,0,2,7,46,0,0,255,255,0,64,0,210,1,60,1,43,0,2,7,46,0,0,255,255,255,250,1,28,3,156,1,91,1,6,7,42,0,60,0,8,177,0,1,176,60,176,51,43,0,0,255,255,0,68,1,28,2,26,1,91,1,6,7,43,0,60,0,8,177,0,1,176,60,176,51,43,0,0,255,255,0,64,1,14,1,60,1,103,1,6,7,46,0,60,0,8,177,0,1,176,60,176,51,43,0,0,255,255,0,24,0,46,1,129,1,144,0,35,7,54,0,166,0,0,0,2,7,54,0,0,255,255,0,42,0,46,1,147,1,144,0,35,7,55,0,166,0,0,0,2,7,55,0,0,0,1,0,24,0,46,0,219,1,144,0,12,0,6,179,12,6,1,48,43,54,38,39,53,54,54,55,23,23,7,23,7,7,149,109,16,16,109,47,22,1,107,107,1,22,95,102,15,15,15,107,51,15,10,149,155,10,15,0,0,0,1,0,42,0,46,0,237,1,144,0,12,0,6,179,12,5,1,48,43,55,39,55,39,55,55,22,22,23,21,6,6,7,43,1,107,107,1,22,47,109,16,16,108,48,61,10,149,155,10,15,49,102,15,15,15,107,51,0,0,0,2,0,31,255,129,1,76,0,99,0,16,0,33,0,24,64,21,33,24,18,17,16,7,1,0,8,0,71,1,1,0,0,116,47,41,2,12,22,43,23,53,54,54,53,52,38,39,55,54,51,50,22,21,20,6,7,55,53,54,54,53,52,38,39,55,54,51,50,22,21,20,6,7,31,31,41,22,18,2,34,24,23,31,76,52,137,31,41,22,18,2,34,24,23,31,76,52,112,10,19,55,25,19,33,10,14,26,39,32,49,79,27,15,10,19,55,25,19,33,10,14,26,39,32,49,79,27,255,255,0,34,1,158,1,54,2,139,0,35,7,59,0,155,0,0,0,2,7,59,0,0,255,255,0,21,1,158,1,41,2,139,0,35,7,60,0,155,0,0,0,2,7,60,0,0,0,1,0,34,1,158,0,155,2,139,0,16,0,23,64,20,14,7,5,3,0,72,1,1,0,0,116,0,0,0,16,0,15,2,12,20,43,18,38,53,52,54,55,23,23,6,6,21,20,22,23,23,6,35,68,34,50,45,21,2,23,28,29,24,1,32,31,1,158,49,34,35,81,38,11,10,22,53,23,22,36,8,14,38,0,1,0,21,1,158,0,142,2,139,0,16,0,18,64,15,16,8,2,0,71,0,0,0,98,0,76,41,1,12,21,43,19,39,54,54,53,52,38,39,39,54,51,50,22,21,20,6,7,26,2,23,28,29,24,1,32,31,24,34,50,45,1,169,10,22,53,23,22,36,8,14,38,49,34,35,81,38,0,0,255,255,0,63,255,99,0,221,0,99,0,2,7,12,0,0,255,255,0,24,0,126,1,129,1,224,0,39,7,54,0,166,0,80,1,6,7,54,0,80,0,16,177,0,1,176,80,176,51,43,177,1,1,176,80,176,51,43,0,0,255,255,0,42,0,126,1,147,1,224,0,39,7,55,0,166,0,80,1,6,7,55,0,80,0,16,177,0,1,176,80,176,51,43,177,1,1,176,80,176,51,43,0,0,255,255,0,24,0,126,0,219,1,224,1,6,7,54,0,80,0,8,177,0,1,176,80,176,51,43,0,0,255,255,0,42,0,126,0,237,1,224,1,6,7,55,0,80,0,8,177,0,1,176,80,176,51,43,0,0,0,2,0,56,255,244,0,178,1,252,0,6,0,18,0,76,181,3,1,0,3,0,72,75,176,8,80,88,64,12,0,0,0,1,95,2,1,1,1,41,1,76,27,75,176,10,80,88,64,12,0,0,0,1,95,2,1,1,1,39,1,76,27,64,12,0,0,0,1,95,2,1,1,1,41,1,76,89,89,64,10,7,7,7,18,7,17,43,3,7,21,43,55,3,55,55,23,3,7,6,38,53,52,54,51,50,22,21,20,6,35,100,10,7,72,9,41,26,26,29,34,28,27,30,35,28,170,1,57,10,15,11,254,183,6,174,33,24,26,36,33,24,26,36,255,255,0,69,255,254,0,191,2,6,1,15,7,66,0,247,1,250,192,0,0,9,177,0,2,184,1,250,176,51,43,0,0,2,0,36,255,244,1,20,1,250,0,22,0,34,0,97,64,10,22,20,18,10,1,5,1,0,1,74,75,176,8,80,88,64,17,0,0,0,38,75,0,1,1,2,96,3,1,2,2,41,2,76,27,75,176,10,80,88,64,17,0,0,0,38,75,0,1,1,2,96,3,1,2,2,39,2,76,27,64,17,0,0,0,38,75,0,1,1,2,96,3,1,2,2,41,2,76,89,89,64,11,23,23,23,34,23,33,46,28,4,7,22,43,55,39,55,55,54,54,53,52,38,39,39,55,55,22,22,21,20,6,7,7,23,7,7,22,38,53,52,54,51,50,22,21,20,6,35,83,19,2,102,18,16,74,90,2,33,6,90,111,61,77,2,14,3,55,3,32,35,27,26,31,35,27,153,82,11,63,11,26,18,35,35,8,8,52,4,2,72,56,37,62,40,5,63,7,13,161,32,25,27,35,31,26,27,35,0,255,255,0,15,255,244,0,255,1,250,1,15,7,68,1,35,1,238,192,0,0,9,177,0,2,184,1,238,176,51,43,0,255,255,0,54,1,29,0,253,2,7,0,39,7,22,0,0,255,126,1,7,7,22,0,122,255,126,0,18,177,0,1,184,255,126,176,51,43,177,1,1,184,255,126,176,51,43,0,0,255,255,0,34,1,28,1,54,2,9,0,39,7,59,0,155,255,126,1,7,7,59,0,0,255,126,0,18,177,0,1,184,255,126,176,51,43,177,1,1,184,255,126,176,51,43,0,0,255,255,0,21,1,28,1,41,2,9,0,39,7,60,0,155,255,126,1,7,7,60,0,0,255,126,0,18,177,0,1,184,255,126,176,51,43,177,1,1,184,255,126,176,51,43,0,0,255,255,0,34,1,28,0,155,2,9,1,7,7,59,0,0,255,126,0,9,177,0,1,184,255,126,176,51,43,0,0,0,255,255,0,21,1,28,0,142,2,9,1,7,7,60,0,0,255,126,0,9,177,0,1,184,255,126,176,51,43,0,0,0,255,255,0,54,1,29,0,131,2,7,1,7,7,22,0,0,255,126,0,9,177,0,1,184,255,126,176,51,43,0,0,0,255,255,0,60,1,8,0,179,1,127,1,6,7,9,0,96,0,8,177,0,1,176,96,176,51,43,0,0,255,255,0,63,255,99,0,221,1,131,0,34,7,12,0,0,1,7,7,18,255,252,1,24,0,9,177,1,1,184,1,24,176,51,43,0,0,2,0,41,255,102,1,228,2,146,0,46,0,53,0,60,64,57,30,1,3,1,49,41,2,4,2,2,74,23,1,1,72,12,11,2,0,71,0,2,3,4,3,2,4,126,0,1,5,1,3,2,1,3,103,0,4,4,0,95,0,0,0,105,0,76,22,34,20,24,47,39,6,12,26,43,37,6,6,7,7,14,2,35,35,7,7,39,55,38,38,53,52,54,54,63,2,23,7,51,50,22,22,23,23,14,2,7,7,52,54,53,52,39,3,22,51,50,54,55,36,22,23,19,6,6,21,1,228,3,15,3,6,6,45,76,44,12,13,26,5,14,95,108,63,114,73,14,26,6,14,5,30,65,45,6,4,1,8,10,2,50,2,91,39,16,9,53,63,14,254,207,63,57,37,73,84,163,12,84,37,8,2,15,14,142,3,7,141,12,127,100,74,118,73,7,149,4,9,142,8,10,1,6,5,37,60,34,3,3,22,14,63,6,254,104,2,57,61,19,110,19,1,147,4,102,87,0,0,2,0,36,255,102,1,131,2,146,0,43,0,50,0,57,64,54,47,46,37,36,32,31,27,7,2,1,11,1,0,2,2,74,1,1,2,1,73,21,1,1,72,10,9,2,0,71,0,1,1,107,75,0,2,2,0,95,0,0,0,105,0,76,40,38,23,22,36,3,12,21,43,37,23,14,2,35,34,39,7,7,39,55,38,38,53,52,54,54,63,2,23,7,50,22,22,23,23,14,2,7,7,53,52,38,39,3,22,51,50,54,54,55,38,22,23,19,6,6,21,1,115,11,7,47,61,22,14,7,13,26,5,13,73,84,52,92,57,18,26,6,18,28,51,32,4,3,1,9,10,1,41,33,28,33,14,7,25,50,34,4,249,44,40,32,56,60,86,31,5,32,30,1,140,3,7,140,16,114,86,66,110,70,7,192,4,9,185,8,9,2,7,5,37,61,35,3,31,31,43,6,254,161,2,15,15,3,88,92,18,1,88,5,86,76,0,3,0,41,255,102,1,228,2,146,0,54,0,62,0,69,0,83,64,80,40,36,29,3,4,1,66,57,50,3,2,4,65,62,2,3,2,19,15,2,0,3,4,74,51,1,3,1,73,35,34,28,3,1,72,18,17,11,3,0,71,0,2,4,3,4,2,3,126,0,1,0,4,2,1,4,103,0,3,3,0,95,0,0,0,105,0,76,60,58,56,55,45,44,32,30,44,5,12,21,43,37,6,6,7,7,14,2,15,2,39,55,35,34,39,7,7,39,55,38,38,53,52,54,63,2,23,7,54,51,51,55,55,23,7,22,22,23,23,14,2,7,7,52,54,53,52,39,3,54,54,55,6,23,19,38,35,34,7,3,38,22,23,19,6,6,21,1,228,3,15,3,6,4,35,60,36,13,26,5,13,5,37,29,14,26,5,15,70,79,105,89,15,26,6,14,32,28,11,14,26,6,14,34,61,8,4,1,8,10,2,50,2,44,38,42,52,13,178,40,38,22,15,18,16,37,97,35,33,33,48,53,163,12,84,37,8,2,12,13,3,143,3,7,138,7,149,3,7,153,24,118,85,96,140,25,160,4,9,147,5,147,4,9,144,3,12,2,6,5,37,60,34,3,3,22,14,45,15,254,112,6,57,54,116,2,1,153,2,3,254,122,140,92,28,1,105,19,93,69,0,2,0,47,0,173,1,175,2,45,0,35,0,47,0,74,64,71,16,12,2,2,0,24,20,6,2,4,3,2,32,28,25,1,4,1,3,3,74,19,17,9,7,4,0,72,35,27,2,1,71,0,0,0,2,3,0,2,103,4,1,3,1,1,3,87,4,1,3,3,1,95,0,1,3,1,79,36,36,36,47,36,46,41,46,45,5,12,23,43,55,39,55,38,53,52,55,39,55,55,22,22,23,54,51,50,23,55,23,23,7,22,21,20,7,23,7,7,39,6,35,34,39,6,6,7,54,54,53,52,38,35,34,6,21,20,22,51,73,23,65,25,27,70,2,39,6,36,25,37,44,44,37,68,13,27,70,28,23,71,3,40,66,38,48,47,38,25,36,6,193,58,58,41,41,57,58,40,176,39,62,36,46,47,38,69,12,26,6,38,25,24,24,75,3,40,69,37,49,42,36,66,11,30,66,27,27,26,36,5,88,57,41,41,58,58,41,40,58,0,0,3,0,53,255,102,1,144,2,146,0,54,0,61,0,68,0,76,64,73,37,1,4,2,67,57,49,42,41,40,21,16,15,9,1,4,11,1,0,1,3,74,48,1,4,1,73,31,30,2,2,72,5,1,0,71,3,1,2,0,4,1,2,4,103,6,5,2,1,1,0,95,0,0,0,105,0,76,62,62,62,68,62,68,59,58,20,23,28,22,7,12,24,43,36,6,15,2,39,55,34,38,38,39,39,62,2,53,55,20,22,22,23,55,39,38,38,53,52,54,63,2,23,7,30,2,23,23,6,6,7,7,39,52,54,53,52,38,39,7,23,30,2,21,36,22,23,55,6,6,21,18,54,53,52,38,39,7,1,144,99,82,13,26,5,13,34,58,34,4,5,1,5,5,45,14,35,35,16,14,64,69,98,76,14,26,6,14,31,53,31,4,4,2,14,3,39,6,2,30,36,16,3,49,59,42,254,251,41,37,14,40,52,128,51,41,38,15,82,83,7,143,3,7,138,12,13,2,9,5,35,63,32,4,50,52,23,2,175,7,31,60,47,59,83,5,148,4,9,142,1,8,9,1,7,11,77,44,4,4,3,19,14,34,31,4,166,1,23,34,52,34,218,39,20,152,2,38,29,254,168,41,33,26,38,19,160,0,0,3,0,18,255,175,1,230,2,220,0,49,0,65,0,75,0,101,64,98,38,21,2,3,4,18,1,9,2,50,1,8,9,6,1,0,8,73,69,2,12,11,5,74,34,33,30,3,5,72,0,5,4,5,131,6,1,4,7,1,3,2,4,3,101,10,1,8,1,1,0,11,8,0,103,13,1,11,0,12,11,12,97,0,9,9,2,95,0,2,2,107,9,76,68,66,72,70,66,75,68,74,62,60,55,53,36,18,26,18,18,18,37,35,20,14,12,29,43,37,14,2,7,34,39,39,6,35,34,38,53,52,54,54,51,50,23,53,7,39,55,23,53,52,35,34,6,7,55,54,54,55,23,6,7,55,23,7,7,6,21,20,22,51,50,54,54,55,3,46,2,35,34,6,21,20,22,22,51,50,54,54,55,6,54,55,23,15,2,39,55,23,1,230,3,22,36,20,74,11,6,97,19,81,99,63,106,63,29,35,107,8,7,108,35,6,15,2,3,41,88,13,6,7,8,73,12,3,84,9,19,18,13,25,15,2,159,3,22,40,24,62,70,32,55,34,20,44,32,4,40,96,15,6,5,152,154,6,8,163,110,5,31,34,6,66,2,65,108,88,65,112,66,4,68,1,9,37,1,39,50,3,1,36,5,19,3,12,12,123,3,12,35,1,196,200,20,21,10,10,2,1,18,2,10,9,83,73,46,75,44,21,23,4,176,5,1,10,46,1,1,8,45,1,0,1,0,12,255,247,2,22,1,251,0,64,0,86,64,83,31,1,7,5,47,21,2,3,4,56,13,2,1,2,3,74,0,6,7,4,7,6,4,126,0,5,0,7,6,5,7,103,8,1,4,9,1,3,2,4,3,101,10,1,2,11,1,1,12,2,1,101,0,12,12,0,95,0,0,0,105,0,76,62,60,58,57,55,53,49,48,34,36,24,34,18,20,18,18,39,13,12,29,43,37,6,6,7,7,14,2,35,34,38,39,35,39,55,51,38,53,52,55,35,39,55,51,54,54,51,50,22,22,23,23,14,2,7,7,52,54,53,52,35,34,6,7,51,55,23,7,7,6,21,20,23,51,55,23,7,35,22,22,51,50,54,55,2,22,3,15,3,6,6,45,76,44,96,125,18,80,5,5,75,1,4,78,5,5,87,26,147,101,30,65,45,6,4,1,8,10,2,50,2,112,64,84,14,2,192,5,6,198,1,4,4,176,5,6,171,17,85,61,53,63,14,163,12,84,37,8,2,15,14,95,84,7,29,9,18,29,23,7,29,85,101,8,10,1,6,5,37,60,34,3,3,22,14,70,69,62,4,9,30,1,8,18,30,23,4,9,30,62,68,57,61,0,1,255,203,255,97,1,155,2,86,0,54,0,80,64,77,43,1,6,4,13,1,0,2,2,74,0,4,5,6,5,4,6,126,0,0,2,1,2,0,1,126,0,3,0,5,4,3,5,103,0,6,7,1,2,0,6,2,103,0,1,8,8,1,87,0,1,1,8,95,9,1,8,1,8,79,0,0,0,54,0,53,51,36,34,21,39,22,34,21,10,12,28,43,6,38,53,52,54,55,51,22,22,51,50,54,55,19,52,38,38,39,39,63,3,54,54,51,50,22,21,20,6,7,35,38,38,35,34,6,6,7,7,50,54,55,23,7,34,38,39,7,7,14,2,35,4,49,12,6,11,11,46,26,23,30,4,32,7,24,34,4,7,70,3,7,6,84,58,36,61,12,6,13,13,53,29,26,24,7,4,6,49,70,11,3,10,10,69,49,18,12,4,47,69,37,159,20,14,15,49,6,26,37,37,38,1,63,17,13,3,1,6,34,10,32,65,62,79,21,15,16,51,7,27,40,35,45,49,69,2,1,3,53,2,1,197,131,40,63,35,0,0,0,0,1,0,56,255,246,1,182,2,1,0,72,0,100,64,97,14,1,2,3,44,43,2,6,4,50,1,1,7,53,6,2,0,1,63,1,11,10,5,74,22,21,2,3,72,72,1,11,71,0,4,2,6,2,4,6,126,0,3,5,1,2,4,3,2,103,0,6,0,7,1,6,7,101,8,1,1,9,1,0,10,1,0,101,0,10,10,11,93,0,11,11,99,11,76,70,64,60,58,55,54,18,68,54,36,21,67,35,18,20,12,12,29,43,55,62,2,53,35,39,55,51,19,52,38,35,7,39,55,22,22,51,51,50,55,23,6,6,7,7,55,52,38,38,35,34,7,6,6,21,21,7,22,51,50,54,55,23,7,34,38,35,34,7,7,51,23,7,35,21,20,22,51,55,54,21,23,7,6,38,35,39,39,34,6,7,63,32,27,7,66,7,6,67,1,11,16,33,2,7,12,69,40,50,68,119,5,2,14,4,49,1,12,43,52,20,16,12,8,3,22,58,14,66,11,6,14,5,53,22,45,40,3,94,5,5,95,13,18,34,22,2,9,2,13,7,50,48,25,65,10,33,6,17,34,39,7,30,1,2,23,14,1,8,37,1,2,11,7,11,79,46,3,38,24,20,7,2,3,34,27,31,79,1,8,2,8,51,3,5,62,7,30,39,28,20,1,2,1,8,38,1,1,1,1,8,2,0,0,2,0,41,255,102,1,243,2,146,0,64,0,71,0,73,64,70,31,1,2,1,68,36,35,3,5,2,64,1,4,5,67,44,2,3,4,15,1,0,3,5,74,24,1,1,72,14,13,2,0,71,0,1,0,2,5,1,2,103,0,5,0,4,3,5,4,103,0,3,3,0,95,0,0,0,105,0,76,82,38,35,30,47,40,6,12,26,43,36,6,21,20,23,7,14,2,35,34,39,7,7,39,55,38,38,53,52,54,63,2,23,7,51,50,22,22,23,23,14,2,7,7,52,54,53,52,38,35,35,3,22,51,50,54,54,55,53,52,38,35,35,39,55,50,22,51,50,54,55,23,4,22,23,19,6,6,21,1,227,11,5,5,7,51,84,48,14,7,13,26,5,14,89,101,128,109,14,26,6,14,20,31,71,51,7,4,1,9,9,2,49,2,54,61,6,39,17,18,28,46,27,3,17,26,53,2,8,4,67,35,23,45,6,4,254,140,57,52,37,71,75,212,50,61,45,23,8,3,16,15,1,143,3,7,142,14,126,98,111,145,15,150,4,9,142,8,10,1,6,5,37,59,33,4,4,23,15,35,31,254,104,3,12,12,2,88,25,16,4,44,2,3,1,22,43,107,21,1,140,10,97,83,0,0,1,0,39,255,247,1,200,1,251,0,65,0,104,64,101,53,1,8,10,50,1,9,8,64,38,2,6,7,30,7,2,1,0,18,17,2,2,1,19,1,3,2,6,74,0,9,8,7,8,9,7,126,0,10,0,8,9,10,8,103,11,1,7,13,12,2,6,0,7,6,101,5,1,0,4,1,1,2,0,1,101,0,2,2,3,95,0,3,3,105,3,76,0,0,0,65,0,65,63,62,58,56,52,51,36,34,20,18,20,39,36,18,36,14,12,29,43,1,6,6,7,7,51,55,23,7,7,6,21,20,22,51,50,54,55,55,7,7,6,6,35,34,38,53,52,55,35,39,55,51,62,2,55,35,39,55,51,55,54,53,52,38,35,34,6,6,23,7,7,39,55,54,54,51,50,22,21,20,7,55,23,7,1,96,17,47,23,35,23,182,5,6,254,24,56,51,49,57,3,43,1,5,35,91,42,80,80,19,56,5,5,87,19,47,43,7,203,5,5,209,51,39,63,58,33,31,10,1,6,36,8,4,33,85,31,76,87,24,60,5,6,1,26,13,27,12,19,4,9,30,1,22,29,39,49,45,46,4,98,9,16,17,61,58,37,28,7,29,17,27,22,4,7,29,1,31,37,32,36,12,31,33,4,2,102,7,12,14,60,54,41,32,1,9,30,0,1,0,38,255,245,2,1,1,249,0,76,0,153,75,176,10,80,88,64,16,70,28,2,1,5,0,1,0,2,2,74,62,43,2,7,72,27,64,16,70,28,2,1,5,0,1,3,2,2,74,62,43,2,7,72,89,75,176,10,80,88,64,35,10,1,7,9,1,6,5,7,6,103,11,8,2,5,12,4,2,1,2,5,1,101,13,1,2,2,0,95,3,1,0,0,105,0,76,27,64,39,10,1,7,9,1,6,5,7,6,103,11,8,2,5,12,4,2,1,2,5,1,101,13,1,2,2,3,93,0,3,3,99,75,0,0,0,105,0,76,89,64,22,76,75,72,71,69,68,61,57,54,53,23,66,35,18,21,68,35,18,35,14,12,29,43,37,7,6,6,7,34,39,39,35,7,6,22,51,50,54,55,23,7,34,38,35,7,55,54,54,53,53,35,39,55,51,53,52,38,35,7,39,55,50,22,51,50,54,55,7,6,6,7,7,51,55,54,53,52,39,39,55,22,22,51,50,54,55,23,7,6,6,7,7,55,23,7,35,23,22,22,23,2,1,5,10,49,16,44,48,135,21,4,1,15,21,12,20,3,2,7,11,62,32,99,8,38,22,67,5,5,68,12,18,27,3,6,11,58,27,22,62,10,3,31,22,1,4,36,122,24,49,2,6,10,64,19,26,47,8,4,6,22,39,37,108,116,5,6,107,110,29,45,28,29,31,1,7,1,66,186,148,32,22,2,1,4,40,2,1,40,4,22,34,142,7,29,140,25,17,1,4,38,2,6,1,41,5,19,22,141,121,23,16,21,3,4,38,1,4,2,1,6,36,6,29,38,107,2,9,30,141,36,30,1,0,0,0,0,1,0,38,255,244,1,215,2,86,0,62,0,116,64,113,34,1,7,6,36,1,5,7,43,24,2,4,5,48,19,2,2,3,61,1,12,2,54,1,13,12,14,1,1,13,12,1,0,1,8,74,0,12,2,13,2,12,13,126,0,1,13,0,13,1,0,126,0,6,0,7,5,6,7,103,8,1,5,9,1,4,3,5,4,101,10,1,3,11,1,2,12,3,2,101,0,13,13,0,95,0,0,0,105,0,76,60,58,56,55,50,49,47,46,45,44,18,38,35,18,17,18,22,36,35,14,12,29,43,36,21,20,6,35,34,38,39,38,38,35,34,7,39,39,54,53,53,35,39,55,51,53,35,39,55,51,62,2,51,50,22,23,23,7,7,38,35,34,7,7,55,23,15,2,55,23,7,7,21,6,6,7,55,50,23,22,51,50,55,23,1,215,44,32,23,51,45,49,56,27,44,40,7,15,104,74,5,5,74,74,5,5,74,2,50,87,56,30,58,15,5,23,19,61,42,87,4,1,177,5,6,178,2,165,5,6,166,1,33,30,55,32,60,58,22,68,7,18,110,28,40,54,10,12,12,11,30,4,34,69,94,16,7,29,79,7,29,68,103,56,8,7,11,63,3,33,124,43,3,9,30,1,78,3,9,30,1,12,39,67,24,11,12,10,75,2,0,0,0,0,1,0,34,0,0,1,186,1,249,0,46,0,62,64,59,40,38,37,36,35,33,32,13,12,10,9,11,3,1,42,41,8,7,5,4,6,0,3,2,74,26,1,2,72,0,3,1,0,1,3,0,126,0,2,0,1,3,2,1,103,0,0,0,99,0,76,46,45,66,45,18,4,12,23,43,37,6,6,35,55,7,39,39,55,55,7,39,39,55,55,52,38,35,7,39,55,50,22,51,50,54,55,7,14,2,7,7,55,23,23,7,7,55,23,23,7,7,54,54,55,51,1,186,40,177,112,2,64,8,9,81,1,65,8,9,83,1,14,18,27,3,6,5,50,42,22,65,10,4,27,22,4,3,3,105,9,9,125,3,110,9,9,129,1,69,97,19,66,212,96,116,163,34,4,28,43,72,35,4,28,44,100,25,17,1,4,38,2,6,1,42,3,13,20,31,37,58,6,29,67,71,61,6,29,68,148,11,91,71,0,0,0,1,0,25,255,248,2,125,2,85,0,23,0,36,64,33,21,20,19,3,0,72,18,14,13,10,9,8,7,6,3,2,10,0,71,1,1,0,0,116,0,0,0,23,0,22,2,12,20,43,0,22,21,7,52,38,39,3,7,39,19,6,6,21,7,52,54,54,55,53,55,23,7,51,1,237,144,89,101,98,3,32,7,1,97,100,86,68,127,88,33,9,1,3,1,249,244,239,30,213,228,11,254,154,6,5,1,103,10,216,196,30,146,221,130,13,91,4,6,86,0,5,0,33,255,228,2,127,1,248,0,74,0,78,0,83,0,87,0,91,0,136,64,133,42,1,10,8,77,1,7,10,71,35,2,6,7,30,1,2,0,5,90,1,2,0,5,74,64,1,8,72,23,5,4,3,3,71,11,1,8,0,10,7,8,10,103,15,12,9,3,7,18,22,17,13,4,6,5,7,6,102,23,19,16,21,14,5,5,20,4,1,3,0,2,5,0,101,0,2,2,3,95,0,3,3,99,3,76,84,84,79,79,0,0,89,88,84,87,84,87,86,85,79,83,79,83,82,81,76,75,0,74,0,74,73,72,70,69,62,59,56,54,52,51,71,18,17,18,23,51,35,22,18,24,12,29,43,37,23,7,35,7,7,38,38,39,39,7,7,20,22,51,55,23,7,38,38,35,34,6,7,55,54,54,55,55,35,39,63,2,35,39,63,2,52,38,39,39,55,22,22,51,50,54,55,22,23,55,53,52,35,35,39,55,22,22,51,50,54,55,7,6,6,7,7,55,23,7,35,7,37,51,39,35,23,22,23,51,39,7,39,35,7,5,35,23,51,2,121,6,3,107,5,39,30,74,17,15,160,1,12,14,40,3,8,9,53,29,22,53,8,5,25,24,1,3,95,5,5,96,3,99,5,5,100,3,29,41,4,7,8,45,23,22,34,5,57,55,154,27,30,2,7,9,50,26,22,55,8,4,29,25,1,2,99,6,3,103,3,254,173,32,27,5,159,30,42,56,1,154,73,60,1,1,33,28,23,5,205,9,29,184,11,44,106,24,21,1,94,19,14,1,3,40,1,2,5,1,41,3,23,23,82,7,28,1,101,7,28,1,75,25,19,5,5,34,1,3,2,1,84,77,1,84,33,4,39,1,2,5,1,41,4,23,23,72,1,9,29,100,135,36,71,43,57,100,101,100,101,35,31,255,255,0,63,255,244,4,211,2,129,0,34,0,163,0,0,0,35,1,183,2,39,0,0,0,3,1,170,3,113,0,0,0,4,0,45,255,250,1,249,1,245,0,60,0,67,0,74,0,80,0,180,64,25,63,1,9,10,60,40,2,0,9,35,6,2,2,1,80,79,2,3,2,21,1,5,4,5,74,75,176,14,80,88,64,52,0,3,2,4,2,3,112,0,11,18,14,2,10,9,11,10,103,13,12,2,9,15,8,2,0,1,9,0,101,16,7,2,1,17,6,2,2,3,1,2,101,0,4,4,5,93,0,5,5,99,5,76,27,64,53,0,3,2,4,2,3,4,126,0,11,18,14,2,10,9,11,10,103,13,12,2,9,15,8,2,0,1,9,0,101,16,7,2,1,17,6,2,2,3,1,2,101,0,4,4,5,93,0,5,5,99,5,76,89,64,34,61,61,77,76,72,71,70,69,61,67,61,66,65,64,59,58,56,49,47,45,42,41,17,18,22,84,36,34,18,19,16,19,12,29,43,1,35,21,20,7,55,23,7,35,6,6,35,35,7,20,22,22,51,50,54,51,23,7,34,38,35,34,6,7,55,54,54,53,55,35,39,55,51,53,35,39,55,51,53,52,38,35,7,39,55,50,22,51,50,54,51,50,22,23,55,23,36,6,7,7,55,38,35,22,39,7,7,55,54,53,6,55,7,6,21,23,1,247,53,9,53,6,2,75,26,88,49,69,1,5,14,17,13,26,4,2,8,9,48,25,33,92,1,6,35,23,1,70,5,5,70,70,5,5,70,12,17,28,3,6,5,49,40,27,68,14,72,87,15,56,6,254,216,6,1,2,154,30,101,146,2,169,3,171,3,38,22,159,1,83,1,112,9,25,26,1,9,30,42,52,60,35,31,10,2,4,40,2,4,2,41,6,25,33,170,7,29,62,7,29,14,25,17,1,4,38,2,3,50,45,1,9,56,3,9,39,2,49,100,14,1,62,2,18,20,117,42,1,13,26,11,0,2,0,36,255,250,1,183,1,245,0,48,0,59,0,78,64,75,59,51,50,3,8,6,26,3,2,1,0,13,1,3,2,3,74,10,1,8,6,0,6,8,0,126,0,7,9,1,6,8,7,6,103,5,1,0,4,1,1,2,0,1,101,0,2,2,3,93,0,3,3,99,3,76,0,0,57,55,0,48,0,47,114,35,18,21,84,35,18,17,11,12,28,43,55,7,55,23,7,35,30,2,51,50,54,51,23,7,34,38,35,34,6,7,55,54,54,53,35,39,55,51,19,52,38,35,7,39,55,50,22,51,50,54,51,50,22,21,20,6,6,35,38,7,23,54,53,52,38,35,34,6,7,180,1,110,5,6,109,1,5,15,15,13,26,4,2,8,9,48,25,33,92,1,6,34,24,67,5,5,67,1,12,17,28,3,6,5,49,40,27,68,14,90,91,54,87,49,66,1,83,93,70,76,14,6,1,186,52,3,9,30,26,24,8,2,4,40,2,4,2,41,6,25,31,7,29,1,28,25,17,1,4,38,2,3,76,66,44,80,49,129,75,11,15,101,56,53,3,9,0,0,0,2,255,236,255,227,1,96,2,64,0,7,0,36,0,73,64,70,6,2,2,1,0,34,9,2,2,5,2,74,27,22,20,19,18,16,6,3,71,0,3,2,3,132,0,0,6,1,1,5,0,1,101,0,5,2,2,5,85,0,5,5,2,93,4,1,2,5,2,77,0,0,36,35,32,31,26,24,11,10,0,7,0,7,19,7,15,21,43,3,38,39,55,33,23,23,7,7,23,7,35,22,21,20,6,7,22,23,21,7,38,39,55,54,51,50,23,54,53,52,39,35,38,39,55,33,1,11,8,5,1,88,5,18,4,14,18,4,87,13,66,68,65,73,43,123,74,18,16,20,27,42,56,4,214,11,8,5,1,88,2,13,18,26,7,5,38,8,74,38,8,29,31,47,94,52,77,52,11,41,125,144,33,2,7,59,49,17,12,18,26,7,0,1,0,38,255,244,1,215,2,86,0,58,0,97,64,94,27,1,3,2,37,29,18,3,4,3,16,1,1,4,52,1,6,1,45,1,7,6,9,1,0,7,7,1,8,0,7,74,0,6,1,7,1,6,7,126,0,0,7,8,7,0,8,126,0,2,0,3,4,2,3,103,0,4,5,1,1,6,4,1,103,0,7,7,8,95,9,1,8,8,105,8,76,0,0,0,58,0,57,34,20,36,34,38,39,24,36,10,12,28,43,4,38,39,38,38,35,34,7,39,39,54,53,53,38,38,39,39,55,55,53,52,54,54,51,50,22,23,23,7,7,38,35,34,7,7,50,54,55,23,7,38,38,35,7,6,7,55,50,23,22,51,50,55,23,22,21,20,6,35,1,116,51,45,49,56,27,44,40,7,15,104,1,24,38,4,7,60,49,88,58,30,58,15,5,23,19,61,42,87,4,3,58,89,14,3,10,14,85,57,2,5,59,55,32,60,58,22,68,7,18,13,44,32,12,10,12,12,11,30,4,34,69,94,48,23,16,2,6,34,11,17,71,107,59,8,7,11,63,3,33,124,78,2,1,3,53,1,2,79,81,49,11,12,10,75,2,30,28,40,54,0,0,2,0,17,255,252,1,195,1,247,0,6,0,44,0,131,64,16,5,1,2,1,0,44,41,2,3,8,21,1,4,2,3,74,75,176,16,80,88,64,37,7,1,2,3,4,3,2,112,0,0,9,1,1,8,0,1,101,0,8,6,1,3,2,8,3,103,0,4,4,5,93,0,5,5,99,5,76,27,64,38,7,1,2,3,4,3,2,4,126,0,0,9,1,1,8,0,1,101,0,8,6,1,3,2,8,3,103,0,4,4,5,93,0,5,5,99,5,76,89,64,24,0,0,43,42,39,38,35,33,27,23,20,18,14,12,9,8,0,6,0,6,34,10,12,21,43,19,39,55,51,55,23,7,22,23,7,46,2,35,35,6,21,20,22,51,50,55,23,7,39,39,34,7,55,62,2,53,53,35,34,6,6,7,7,54,55,55,33,23,29,5,8,217,194,5,5,1,7,46,7,14,31,41,38,6,22,25,24,20,3,7,28,98,25,94,7,40,32,10,44,40,32,13,6,47,8,2,8,1,143,8,1,193,8,41,5,9,43,138,62,3,43,31,9,138,100,29,24,2,3,42,1,2,4,40,3,13,34,41,204,9,30,41,3,74,49,8,8,0,0,0,0,1,0,85,255,252,2,11,1,251,0,63,0,82,64,79,45,44,42,41,40,39,37,36,14,13,11,10,9,8,6,5,16,1,4,23,1,2,1,2,74,59,58,55,54,4,5,72,30,1,2,71,6,1,4,0,1,0,4,1,126,0,5,3,1,0,4,5,0,103,0,1,1,2,93,0,2,2,99,2,76,63,62,57,56,51,50,47,46,84,47,18,7,12,23,43,0,38,38,39,6,7,55,23,23,7,7,55,23,23,7,6,21,20,22,51,50,54,51,23,7,34,38,35,34,6,7,55,62,2,53,53,7,39,39,55,53,7,39,39,55,53,14,2,7,7,54,54,55,55,23,33,55,23,22,22,23,7,1,213,21,41,58,4,5,116,8,4,129,2,119,8,4,131,1,22,25,18,23,3,3,7,14,76,36,36,70,13,7,40,33,9,114,8,4,126,114,8,4,126,63,44,21,7,47,2,9,1,8,71,0,255,73,8,1,8,2,46,1,151,39,10,2,37,109,40,7,30,42,70,41,7,30,43,25,46,29,24,2,3,42,3,3,1,40,3,14,33,41,14,37,5,29,41,70,37,5,29,41,171,2,10,37,51,3,13,89,43,7,8,8,7,44,86,12,3,0,6,0,29,255,243,3,40,1,250,0,89,0,96,0,103,0,108,0,113,0,117,0,146,64,143,82,1,7,8,46,1,6,7,88,22,2,5,6,106,1,0,5,17,3,2,1,0,5,74,59,37,2,8,72,116,112,12,7,4,1,71,14,11,2,8,13,10,2,7,6,8,7,103,15,12,9,3,6,20,17,24,16,4,5,0,6,5,101,25,21,19,18,4,5,0,1,1,0,85,25,21,19,18,4,5,0,0,1,93,23,22,3,2,4,1,0,1,77,104,104,0,0,115,114,111,110,104,108,104,108,103,102,99,98,96,95,93,92,0,89,0,89,87,86,80,76,73,71,67,66,57,53,51,50,45,44,67,19,18,17,18,21,20,18,17,26,12,29,43,1,7,55,23,7,35,7,7,38,39,15,2,38,38,39,35,39,55,55,39,35,39,55,51,39,38,38,39,52,39,55,50,22,51,50,54,55,23,7,6,6,21,20,23,55,55,48,39,38,38,39,39,55,50,22,51,50,54,55,23,7,6,6,21,20,23,55,54,53,52,38,35,35,39,55,22,22,51,50,54,51,7,6,6,7,7,51,23,7,6,55,55,35,22,23,51,36,23,55,54,55,55,35,23,39,39,35,7,23,55,35,23,51,39,35,23,51,2,192,40,126,6,3,143,65,71,2,50,97,60,72,4,27,22,136,5,5,125,32,103,5,5,91,24,8,33,29,2,6,11,56,27,37,75,11,3,4,42,26,22,174,14,13,7,33,31,2,6,11,59,28,32,78,12,3,3,42,27,21,176,28,23,29,38,2,6,11,71,32,30,51,8,6,23,19,8,31,83,6,3,182,14,11,153,18,11,87,254,132,12,85,7,12,19,152,236,7,24,5,36,197,22,63,24,7,250,62,24,6,1,49,101,1,9,29,163,17,17,163,1,162,17,14,94,71,7,28,1,102,7,28,74,23,22,1,1,2,38,2,7,1,6,36,3,12,16,13,80,1,37,39,22,18,2,3,38,2,7,1,6,36,3,12,16,10,82,1,84,9,14,12,4,38,1,4,2,41,2,14,23,77,9,29,71,41,30,64,37,37,39,1,17,34,50,101,23,75,98,94,58,83,82,82,0,0,0,0,1,0,18,255,246,2,0,1,253,0,82,0,101,64,98,42,29,21,3,4,5,59,13,2,2,3,37,1,1,2,66,6,2,0,1,75,1,12,11,5,74,50,44,2,5,72,82,1,12,71,6,1,5,0,4,3,5,4,103,7,1,3,8,1,2,1,3,2,102,9,1,1,10,1,0,11,1,0,101,0,11,11,12,93,0,12,12,99,12,76,80,76,74,71,68,67,65,64,61,60,58,57,49,46,51,20,18,19,18,20,13,12,26,43,55,62,2,53,7,39,55,51,38,39,39,7,39,55,51,39,46,2,39,39,55,22,22,51,50,54,51,23,7,6,6,21,20,23,35,23,55,54,53,52,39,39,55,22,22,51,50,54,55,23,7,14,2,7,7,55,23,7,35,7,6,7,55,23,7,35,7,20,22,51,55,55,23,7,34,38,35,34,6,7,163,35,26,5,180,5,5,177,9,12,24,132,5,5,112,24,20,25,39,33,2,7,10,55,32,33,82,5,5,3,40,23,12,1,80,93,13,53,1,5,10,65,23,26,46,8,5,6,27,29,19,22,42,115,6,3,141,35,8,2,183,6,3,187,1,13,19,19,27,2,9,12,65,33,25,65,10,33,6,21,35,53,1,7,29,32,21,43,1,7,29,47,39,37,22,1,9,36,1,2,7,10,34,4,10,10,10,26,157,159,22,15,15,5,7,37,1,5,2,1,7,37,4,15,25,33,68,2,9,30,57,17,22,4,9,30,58,28,20,1,1,8,38,2,8,2,0,0,0,255,255,0,60,0,168,0,179,1,31,0,2,7,9,0,0,255,255,0,34,255,146,1,39,2,163,0,2,7,24,0,0,0,1,0,18,0,30,1,232,1,244,0,19,0,47,64,44,15,3,2,0,1,1,74,8,7,6,3,1,72,18,0,2,0,71,2,1,1,0,0,1,85,2,1,1,1,0,93,3,1,0,1,0,77,18,54,18,17,4,12,24,43,55,55,7,39,55,23,55,55,23,6,6,21,50,54,55,23,7,7,23,7,221,1,198,6,11,193,1,51,10,1,5,50,133,21,6,8,202,1,49,36,199,1,9,49,1,201,8,6,20,133,50,5,1,10,51,1,194,11,0,0,1,0,18,0,234,1,232,1,41,0,9,0,31,64,28,6,0,2,1,0,1,74,0,0,1,1,0,85,0,0,0,1,93,0,1,0,1,77,34,65,2,15,22,43,55,55,23,50,54,55,23,15,2,18,11,239,50,142,22,6,8,227,229,243,49,1,5,1,10,51,1,1,0,0,0,0,1,0,68,0,80,1,181,1,193,0,23,0,6,179,23,11,1,48,43,55,39,54,54,55,39,55,55,23,54,54,55,23,23,7,22,22,23,7,7,39,6,6,7,102,27,13,77,48,145,2,43,140,46,79,14,11,31,142,36,94,15,3,42,139,49,78,13,83,42,13,75,48,144,11,26,141,47,86,15,3,42,143,36,86,13,12,30,138,49,80,13,0,3,0,18,0,29,1,232,1,241,0,11,0,21,0,33,0,66,64,63,18,12,2,3,2,1,74,0,0,6,1,1,2,0,1,103,0,2,0,3,4,2,3,101,0,4,5,5,4,87,0,4,4,5,95,7,1,5,4,5,79,22,22,0,0,22,33,22,32,28,26,21,19,17,13,0,11,0,10,36,8,12,21,43,18,38,53,52,54,51,50,22,21,20,6,35,7,55,23,50,54,55,23,15,2,22,38,53,52,54,51,50,22,21,20,6,35,218,29,34,28,27,30,35,28,227,11,239,50,142,22,6,8,227,229,194,29,34,28,27,30,35,28,1,122,33,24,26,36,33,24,26,36,135,49,1,5,1,10,51,1,1,205,33,24,26,36,33,24,26,36,0,0,2,0,18,0,157,1,232,1,121,0,9,0,19,0,46,64,43,6,0,2,1,0,16,10,2,3,2,2,74,0,0,0,1,2,0,1,101,0,2,3,3,2,85,0,2,2,3,93,0,3,2,3,77,34,66,34,65,4,12,24,43,19,55,23,50,54,55,23,15,3,55,23,50,54,55,23,15,2,18,11,239,50,142,22,6,8,227,229,6,11,239,50,142,22,6,8,227,229,1,67,49,1,5,1,10,51,1,1,148,49,1,5,1,10,51,1,1,0,0,0,1,0,18,0,24,1,232,1,250,0,30,0,134,64,24,13,1,3,4,18,8,2,2,3,24,1,1,2,25,3,2,0,1,0,1,9,0,5,74,75,176,10,80,88,64,41,0,4,3,3,4,110,0,9,0,0,9,111,5,1,3,6,1,2,1,3,2,102,7,1,1,0,0,1,87,7,1,1,1,0,93,8,1,0,1,0,77,27,64,39,0,4,3,4,131,0,9,0,9,132,5,1,3,6,1,2,1,3,2,102,7,1,1,0,0,1,87,7,1,1,1,0,93,8,1,0,1,0,77,89,64,14,30,29,35,33,18,50,17,18,17,18,17,10,15,29,43,55,55,7,39,55,23,55,7,39,55,23,55,51,23,7,54,54,55,23,15,2,50,54,55,23,7,7,35,7,35,164,33,173,6,11,183,26,214,6,11,224,36,26,8,34,64,110,19,6,8,206,27,51,158,26,6,8,227,21,35,26,32,126,1,9,49,1,101,1,9,49,1,135,10,125,1,4,1,10,51,1,101,4,2,10,51,1,134,0,1,0,51,0,70,1,219,1,208,0,22,0,6,179,22,10,1,48,43,55,39,54,54,55,55,53,47,2,55,22,22,23,22,22,23,23,7,7,6,6,7,60,7,19,124,51,154,168,181,1,30,18,119,51,62,115,21,8,2,203,57,125,19,75,50,7,45,21,60,6,70,79,11,40,8,55,22,27,48,9,11,47,86,24,50,7,0,0,1,0,31,0,70,1,199,1,208,0,22,0,6,179,22,11,1,48,43,36,38,39,38,38,39,39,55,55,54,54,55,23,23,6,6,7,7,21,31,2,7,1,151,119,51,62,115,21,8,2,203,57,125,19,9,7,19,124,51,154,168,181,1,30,78,55,22,27,48,9,11,47,86,24,50,7,5,50,7,45,21,60,6,70,79,11,40,0,2,0,18,255,181,1,232,1,208,0,23,0,34,0,44,64,41,30,24,2,1,0,1,74,29,23,19,18,10,9,5,1,8,0,72,0,0,1,1,0,85,0,0,0,1,93,0,1,0,1,77,34,31,28,25,2,15,20,43,55,39,54,54,55,55,53,47,2,55,23,22,23,23,22,22,23,23,7,7,6,6,7,7,55,23,50,54,55,23,7,5,6,35,60,7,19,124,51,154,168,181,1,30,22,73,51,42,62,115,21,8,2,203,57,125,19,51,11,239,53,138,23,6,8,254,156,49,51,75,50,7,45,21,60,6,70,79,11,40,10,35,22,18,27,49,8,11,47,86,24,50,7,136,49,1,4,2,10,51,1,1,0,0,0,2,0,18,255,181,1,232,1,208,0,21,0,32,0,44,64,41,28,22,2,1,0,1,74,27,21,20,16,12,10,6,5,8,0,72,0,0,1,1,0,85,0,0,0,1,93,0,1,0,1,77,32,29,26,23,2,15,20,43,37,38,47,3,55,55,54,54,55,23,23,6,6,7,7,21,31,2,7,5,55,23,50,54,55,23,7,5,6,35,1,144,52,69,42,198,8,2,203,70,112,19,9,7,19,124,51,154,168,181,1,30,254,105,11,239,53,138,23,6,8,254,156,49,51,81,26,30,18,84,11,47,86,29,45,7,5,50,7,45,21,60,6,70,79,11,40,136,49,1,4,2,10,51,1,1,0,2,0,18,255,181,1,232,1,247,0,19,0,31,0,61,64,58,15,3,2,0,1,18,0,2,4,0,27,20,2,5,4,3,74,8,7,6,3,1,72,2,1,1,3,1,0,4,1,0,101,0,4,5,5,4,85,0,4,4,5,93,0,5,4,5,77,51,68,18,54,18,17,6,12,26,43,55,55,7,39,55,23,55,55,23,6,6,21,50,54,55,23,7,7,23,7,7,55,23,50,55,54,53,23,7,5,6,35,221,1,198,6,11,193,1,51,10,1,5,50,133,21,6,8,202,1,49,212,11,239,71,66,77,6,8,254,156,49,51,59,189,1,9,49,1,191,8,6,19,124,50,5,1,10,51,1,184,11,119,49,1,3,2,1,10,51,1,1,0,0,0,0,2,0,45,0,122,1,208,1,159,0,29,0,59,0,77,64,74,15,1,1,0,44,29,2,4,2,45,1,5,4,3,74,14,1,0,72,59,1,6,71,0,0,0,3,2,0,3,103,0,1,0,2,4,1,2,103,0,5,7,6,5,87,0,4,0,7,6,4,7,103,0,5,5,6,95,0,6,5,6,79,36,24,36,24,36,24,36,19,8,15,28,43,19,53,55,55,50,22,23,22,22,51,50,54,54,55,51,23,21,7,7,34,38,39,38,38,35,34,6,6,7,35,7,53,55,55,50,22,23,22,22,51,50,54,54,55,51,23,21,7,7,34,38,39,38,38,35,34,6,6,7,35,45,76,16,18,72,37,32,62,15,10,28,22,3,6,22,76,16,18,72,37,32,62,15,11,28,21,3,6,22,76,16,18,72,37,32,62,15,10,28,22,3,6,22,76,16,18,72,37,32,62,15,11,28,21,3,6,1,49,5,89,4,15,8,8,12,24,27,4,21,5,89,4,15,8,8,12,24,27,4,141,5,89,4,15,8,8,12,24,27,4,21,5,89,4,15,8,8,12,24,27,4,0,0,0,1,0,43,0,202,1,210,1,77,0,29,0,56,177,6,100,68,64,45,15,1,1,0,1,74,14,1,0,72,29,1,2,71,0,1,3,2,1,87,0,0,0,3,2,0,3,103,0,1,1,2,95,0,2,1,2,79,36,24,36,19,4,12,24,43,177,6,0,68,55,53,55,55,50,22,23,22,22,51,50,54,54,55,51,23,21,7,7,34,38,39,38,38,35,34,6,6,7,35,43,76,16,25,96,8,33,63,15,11,28,21,3,6,22,76,16,25,96,8,33,63,15,11,28,21,3,6,223,5,89,4,21,2,8,12,24,27,4,21,5,89,4,21,2,8,12,24,27,4,0,0,0,1,0,18,0,30,1,202,1,41,0,17,0,36,64,33,10,4,2,0,1,1,74,16,0,2,0,71,0,1,0,0,1,85,0,1,1,0,93,0,0,1,0,77,66,33,2,12,22,43,37,55,7,7,39,55,23,50,54,55,23,6,6,7,20,22,21,7,1,137,1,141,229,6,11,239,50,117,17,6,1,6,1,1,49,36,200,1,1,9,49,1,5,1,10,11,70,29,51,74,11,11,0,0,0,3,0,17,0,117,1,232,1,144,0,24,0,36,0,47,0,74,64,71,44,27,21,9,4,5,4,1,74,1,1,0,6,1,4,5,0,4,103,10,7,9,3,5,2,2,5,87,10,7,9,3,5,5,2,95,8,3,2,2,5,2,79,37,37,25,25,0,0,37,47,37,46,43,41,25,36,25,35,31,29,0,24,0,23,37,35,37,11,15,23,43,54,38,53,52,54,54,51,50,22,23,54,51,50,22,21,20,6,6,35,34,38,39,6,6,35,54,54,55,38,38,35,34,6,21,20,22,51,4,54,53,52,38,35,34,7,22,22,51,74,57,36,60,33,40,55,22,45,73,50,57,36,60,33,41,53,23,17,58,43,50,43,11,26,46,34,27,41,46,41,1,13,41,46,41,57,30,27,45,34,117,79,54,43,68,39,46,41,87,79,54,43,69,38,46,43,36,53,60,34,24,53,56,45,35,39,48,4,45,35,38,49,56,55,56,0,3,0,30,255,155,2,127,2,196,0,25,0,34,0,43,0,70,64,67,25,21,2,2,1,41,40,29,28,4,3,2,12,8,2,0,3,3,74,24,22,2,1,72,11,9,2,0,71,0,1,0,2,3,1,2,103,4,1,3,0,0,3,87,4,1,3,3,0,95,0,0,3,0,79,35,35,35,43,35,42,42,43,37,5,15,23,43,0,22,21,20,6,6,35,34,39,7,39,39,55,38,38,53,52,54,54,51,50,23,55,23,23,7,0,22,23,19,38,35,34,6,21,0,54,53,52,38,39,1,22,51,2,55,72,75,141,95,82,60,63,27,2,62,61,65,75,141,95,69,57,43,29,3,42,254,108,46,44,252,46,57,112,127,1,95,126,53,50,255,0,55,68,2,59,145,101,103,152,82,30,119,6,10,119,40,142,96,103,152,82,23,82,7,12,79,254,144,116,35,1,224,20,145,128,254,235,148,128,82,121,33,254,30,30,0,0,1,255,238,255,98,1,161,2,87,0,35,0,57,64,54,0,3,4,0,4,3,0,126,0,0,1,4,0,1,124,0,2,0,4,3,2,4,103,0,1,5,5,1,87,0,1,1,5,95,6,1,5,1,5,79,0,0,0,35,0,34,34,21,38,34,21,7,15,25,43,22,38,53,52,54,55,51,22,22,51,50,54,55,19,62,2,51,50,22,21,20,6,7,35,38,38,35,34,6,7,3,14,2,35,31,49,12,6,11,11,46,26,23,32,2,32,2,41,67,37,32,55,12,6,13,11,48,26,22,31,1,31,2,46,70,37,158,20,14,15,49,6,26,37,37,38,1,251,35,62,37,21,15,15,52,7,27,40,31,28,253,255,41,65,36,0,0,255,255,0,42,255,250,2,247,2,137,0,2,4,84,0,0,255,255,0,11,0,0,1,253,2,137,0,2,4,64,0,0,255,255,0,56,255,244,2,149,2,134,0,2,4,76,0,0,255,255,0,18,255,253,1,239,2,137,0,2,4,78,0,0,0,1,0,4,255,244,1,248,2,230,0,19,0,35,64,32,19,13,2,0,71,0,2,1,2,131,0,1,0,0,1,85,0,1,1,0,95,0,0,1,0,79,24,34,19,3,15,23,43,54,2,39,38,7,39,63,2,23,30,2,23,51,19,55,51,3,7,202,104,21,18,52,3,5,83,41,8,4,48,50,8,6,187,15,45,222,63,35,1,23,52,48,2,4,33,4,2,8,33,160,145,21,2,129,13,253,34,20,0,2,0,43,255,244,1,209,2,229,0,24,0,38,0,53,64,50,17,15,2,0,72,0,0,0,2,3,0,2,103,5,1,3,1,1,3,87,5,1,3,3,1,95,4,1,1,3,1,79,25,25,0,0,25,38,25,37,33,31,0,24,0,23,38,6,15,21,43,22,38,38,53,52,54,54,51,50,22,22,23,55,38,38,39,55,55,22,22,21,20,6,6,35,54,54,53,52,39,38,38,35,34,6,21,20,22,51,178,90,45,58,100,60,14,35,26,4,2,38,146,105,15,10,171,216,57,102,63,79,61,16,14,58,47,59,66,80,68,12,62,99,57,68,114,65,12,12,2,2,92,134,49,33,4,73,255,171,69,117,68,49,90,79,76,70,17,30,84,80,85,113,255,255,0,75,255,16,2,25,1,207,0,2,4,229,0,0,0,5,0,35,255,161,2,147,2,166,0,13,0,27,0,39,0,53,0,65,0,85,64,82,7,1,2,0,1,74,9,1,3,8,1,1,4,3,1,103,0,4,0,6,7,4,6,103,0,2,2,0,95,0,0,0,98,75,11,1,7,7,5,95,10,1,5,5,105,5,76,54,54,40,40,28,28,14,14,54,65,54,64,60,58,40,53,40,52,47,45,28,39,28,38,34,32,14,27,14,26,21,19,12,12,20,43,23,39,54,54,55,1,23,23,6,2,7,6,6,7,2,38,53,52,54,54,51,50,22,21,20,6,6,35,54,54,53,52,38,35,34,6,21,20,22,51,0,38,53,52,54,54,51,50,22,21,20,6,6,35,54,54,53,52,38,35,34,6,21,20,22,51,77,5,22,126,72,1,0,39,5,29,178,55,71,123,21,7,73,38,69,44,65,69,36,68,46,49,54,56,48,40,47,61,41,1,7,73,38,69,44,65,69,36,68,46,49,54,56,48,40,47,61,41,76,12,33,194,112,1,147,19,14,43,254,243,88,114,193,33,1,165,87,69,47,76,44,88,61,46,80,48,64,39,48,46,60,48,39,53,53,254,110,87,69,47,76,44,88,61,46,80,48,64,39,48,46,60,48,39,53,53,0,0,7,0,35,255,161,3,224,2,166,0,13,0,27,0,39,0,53,0,67,0,79,0,91,0,107,64,104,7,1,2,0,1,74,13,1,3,12,1,1,4,3,1,103,6,1,4,10,1,8,9,4,8,103,0,2,2,0,95,0,0,0,98,75,17,11,16,3,9,9,5,95,15,7,14,3,5,5,105,5,76,80,80,68,68,54,54,40,40,28,28,14,14,80,91,80,90,86,84,68,79,68,78,74,72,54,67,54,66,61,59,40,53,40,52,47,45,28,39,28,38,34,32,14,27,14,26,21,19,18,12,20,43,23,39,54,54,55,1,23,23,6,2,7,6,6,7,2,38,53,52,54,54,51,50,22,21,20,6,6,35,54,54,53,52,38,35,34,6,21,20,22,51,0,38,53,52,54,54,51,50,22,21,20,6,6,35,32,38,53,52,54,54,51,50,22,21,20,6,6,35,36,54,53,52,38,35,34,6,21,20,22,51,32,54,53,52,38,35,34,6,21,20,22,51,77,5,22,126,72,1,0,39,5,29,178,55,71,123,21,7,73,38,69,44,65,69,36,68,46,49,54,56,48,40,47,61,41,1,7,73,38,69,44,65,69,36,68,46,1,15,73,38,69,44,65,69,36,68,46,254,228,54,56,48,40,47,61,41,1,112,54,56,48,40,47,61,41,76,12,33,194,112,1,147,19,14,43,254,243,88,114,193,33,1,165,87,69,47,76,44,88,61,46,80,48,64,39,48,46,60,48,39,53,53,254,110,87,69,47,76,44,88,61,46,80,48,87,69,47,76,44,88,61,46,80,48,64,39,48,46,60,48,39,53,53,39,48,46,60,48,39,53,53,0,0,0,1,0,54,0,6,1,220,1,191,0,16,0,36,64,33,12,9,5,2,4,0,2,1,74,8,7,6,3,0,71,1,1,0,2,0,132,0,2,2,58,2,76,20,22,19,3,9,23,43,0,22,23,7,35,39,19,7,39,19,7,35,39,54,54,55,51,1,31,127,62,19,12,153,5,11,56,7,152,12,19,58,122,18,17,1,171,133,58,41,143,254,187,7,6,1,69,142,41,58,133,20,0,0,0,1,0,96,0,53,1,176,1,135,0,18,0,40,64,37,18,13,2,0,1,1,74,10,8,7,6,5,4,6,0,71,0,1,0,0,1,85,0,1,1,0,93,0,0,1,0,77,50,27,2,9,22,43,0,6,21,20,23,7,39,39,7,39,39,55,39,39,55,50,54,55,23,1,175,3,1,42,8,9,225,13,36,235,207,9,16,82,180,27,12,1,106,120,66,61,30,16,8,210,234,2,44,226,7,8,43,7,1,12,0,0,0,1,0,44,0,15,1,229,1,181,0,16,0,44,64,41,11,3,2,3,0,1,1,74,16,15,14,3,1,72,8,7,6,3,0,71,0,1,0,0,1,85,0,1,1,0,93,0,0,1,0,77,18,25,2,9,22,43,0,22,23,21,6,6,7,39,53,55,5,39,55,5,39,53,55,1,76,133,20,20,133,58,41,143,254,187,7,6,1,69,142,41,1,123,122,18,17,18,127,62,19,12,153,5,11,56,7,152,12,19,0,0,0,1,0,91,0,59,1,173,1,139,0,18,0,40,64,37,9,2,2,0,1,1,74,18,17,16,15,14,12,6,1,72,0,1,0,0,1,85,0,1,1,0,93,0,0,1,0,77,18,83,2,9,22,43,0,22,23,7,38,38,35,34,7,39,55,55,39,55,55,23,55,55,23,1,165,7,1,12,17,120,66,61,30,16,8,210,234,2,44,226,7,8,43,1,22,180,27,12,1,3,1,42,8,9,225,13,36,235,207,9,16,0,0,1,0,53,0,5,1,219,1,190,0,16,0,35,64,32,14,10,7,3,0,1,1,74,13,12,11,3,1,72,2,1,1,0,1,131,0,0,0,59,0,76,22,20,19,3,9,23,43,37,6,6,7,35,38,38,39,55,51,23,3,55,23,3,55,51,1,219,58,122,18,17,18,127,62,19,12,153,5,11,56,7,152,12,216,58,133,20,20,133,58,41,143,1,69,7,6,254,187,142,0,1,0,97,0,61,1,177,1,143,0,18,0,47,64,44,6,1,2,0,1,1,74,17,15,14,13,12,11,6,1,72,2,1,1,0,0,1,85,2,1,1,1,0,93,0,0,1,0,77,0,0,0,18,0,18,50,3,9,21,43,37,23,7,34,6,7,39,54,54,53,52,39,55,23,23,55,23,23,7,1,149,9,16,82,180,27,12,1,3,1,42,8,9,225,13,36,235,120,8,43,7,1,12,17,120,66,61,30,16,8,210,234,2,44,226,0,1,0,45,0,16,1,230,1,182,0,16,0,44,64,41,16,8,7,3,0,1,1,74,13,12,11,3,1,72,4,3,2,3,0,71,0,1,0,0,1,85,0,1,1,0,93,0,0,1,0,77,29,16,2,9,22,43,37,37,23,21,7,38,38,39,53,54,54,55,23,21,7,37,23,1,224,254,187,142,41,58,133,20,20,133,58,41,143,1,69,7,192,7,152,12,19,58,122,18,17,18,127,62,19,12,153,5,11,0,0,0,0,1,0,101,0,58,1,183,1,138,0,18,0,39,64,36,16,9,2,1,0,1,74,6,5,4,3,2,5,1,71,0,0,1,1,0,85,0,0,0,1,93,0,1,0,1,77,18,90,2,9,22,43,37,7,7,39,7,7,39,52,38,39,55,22,22,51,50,55,23,7,7,1,183,2,44,226,7,8,43,7,1,12,17,120,66,61,30,16,8,210,107,13,36,235,207,9,16,83,179,27,12,1,3,1,42,8,9,0,1,0,45,0,15,2,181,1,182,0,27,0,51,64,48,17,16,3,2,4,0,1,1,74,27,26,25,22,21,20,6,1,72,13,12,11,8,7,6,6,0,71,0,1,0,0,1,85,0,1,1,0,93,0,0,1,0,77,29,25,2,9,22,43,0,22,23,21,6,6,7,39,53,55,33,23,21,7,38,38,39,53,54,54,55,23,21,7,33,39,53,55,2,28,133,20,20,133,58,41,141,254,87,140,41,58,133,20,20,133,58,41,141,1,169,140,41,1,123,122,18,17,18,127,62,19,12,151,150,12,19,58,122,18,17,18,127,62,19,12,151,150,12,19,0,0,0,0,1,0,55,255,158,1,222,2,39,0,27,0,55,64,52,25,22,15,12,4,2,3,26,11,8,1,4,0,1,2,74,0,3,2,3,131,4,1,2,1,2,131,6,5,2,1,0,1,131,0,0,0,116,0,0,0,27,0,27,20,20,19,20,20,7,9,25,43,37,23,6,6,7,35,38,38,39,55,51,23,17,7,35,39,54,54,55,51,22,22,23,7,35,39,17,55,1,202,19,58,122,18,17,18,127,62,19,12,150,149,12,19,58,122,18,17,18,127,62,19,12,151,150,155,41,58,134,20,20,134,58,41,141,1,168,139,41,58,133,20,20,133,58,41,141,254,86,141,0,0,0,0,1,0,13,0,20,1,175,1,182,0,3,0,6,179,3,1,1,48,43,55,55,23,7,13,209,209,209,229,209,209,209,0,2,0,13,255,248,1,231,1,210,0,3,0,7,0,8,181,7,5,3,1,2,48,43,55,55,23,7,55,39,7,23,13,237,237,237,181,181,181,181,229,237,237,237,237,181,181,181,0,2,0,60,255,162,1,191,2,139,0,13,0,23,0,36,64,33,23,21,18,16,10,3,2,7,1,0,1,74,0,0,1,1,0,85,0,0,0,1,93,0,1,0,1,77,22,21,2,15,22,43,23,47,2,63,2,31,3,15,2,63,2,39,39,35,7,7,23,23,226,85,80,1,77,87,47,11,85,78,2,76,87,47,26,60,67,69,70,6,60,67,69,70,87,185,164,21,177,189,2,7,185,162,26,174,189,2,69,143,162,146,156,143,163,145,156,0,0,0,0,1,0,64,0,81,1,104,1,121,0,3,0,24,64,21,0,0,1,1,0,85,0,0,0,1,93,0,1,0,1,77,17,16,2,9,22,43,19,33,17,33,64,1,40,254,216,1,121,254,216,0,0,2,0,64,0,61,1,144,1,141,0,3,0,7,0,41,64,38,0,0,0,2,3,0,2,101,4,1,3,1,1,3,85,4,1,3,3,1,93,0,1,3,1,77,4,4,4,7,4,7,18,17,16,5,9,23,43,19,33,17,33,37,17,33,17,64,1,80,254,176,1,40,255,0,1,141,254,176,40,1,0,255,0,0,0,1,0,0,0,0,1,196,1,196,0,3,0,19,64,16,0,0,0,58,75,0,1,1,59,1,76,17,16,2,9,22,43,17,33,17,33,1,196,254,60,1,196,254,60,0,0,0,0,1,0,64,0,104,1,92,1,132,0,2,0,10,183,0,0,0,116,17,1,9,21,43,19,19,33,206,142,254,228,1,132,254,228,0,0,1,0,94,0,84,1,122,1,112,0,2,0,6,179,2,0,1,48,43,19,5,5,94,1,28,254,228,1,112,142,142,0,1,0,64,0,74,1,92,1,102,0,2,0,15,64,12,2,1,0,71,0,0,0,116,16,1,9,21,43,19,33,3,64,1,28,142,1,102,254,228,0,1,0,34,0,84,1,62,1,112,0,2,0,6,179,2,1,1,48,43,55,37,17,34,1,28,226,142,254,228,0,0,0,2,0,64,0,84,1,156,1,177,0,2,0,5,0,35,64,32,4,1,1,72,2,1,1,0,0,1,85,2,1,1,1,0,93,0,0,1,0,77,3,3,3,5,3,5,17,3,9,21,43,19,19,33,37,39,7,238,174,254,164,1,28,110,110,1,177,254,163,40,219,219,0,2,0,94,0,52,1,187,1,144,0,2,0,5,0,8,181,5,4,2,0,2,48,43,19,5,5,37,39,21,94,1,93,254,163,1,3,219,1,144,174,174,174,110,220,0,0,0,0,2,0,64,0,29,1,156,1,122,0,2,0,5,0,29,64,26,5,2,2,1,71,0,0,1,1,0,85,0,0,0,1,93,0,1,0,1,77,18,16,2,9,22,43,19,33,3,19,35,23,64,1,92,174,110,220,110,1,122,254,163,1,53,219,0,0,0,0,2,0,34,0,52,1,127,1,144,0,2,0,5,0,8,181,5,3,2,1,2,48,43,55,37,17,3,7,23,34,1,93,40,219,219,226,174,254,164,1,28,110,110,0,1,255,244,255,244,1,208,1,208,0,15,0,30,64,27,0,0,1,1,0,87,0,0,0,1,95,2,1,1,0,1,79,0,0,0,15,0,14,38,3,15,21,43,22,38,38,53,52,54,54,51,50,22,22,21,20,6,6,35,162,110,64,64,110,64,64,110,64,64,110,64,12,64,110,64,64,110,64,64,110,64,64,110,64,0,0,0,0,2,0,33,255,47,3,31,2,101,0,58,0,72,0,90,64,87,33,1,3,5,36,32,2,8,3,62,20,2,9,8,3,74,11,1,9,8,4,8,9,4,126,0,0,0,5,3,0,5,103,0,6,10,1,7,6,7,100,0,8,8,3,95,0,3,3,101,75,0,4,4,1,95,2,1,1,1,105,1,76,59,59,0,0,59,72,59,71,66,64,0,58,0,58,22,37,41,21,24,38,38,12,12,27,43,4,38,38,53,52,54,54,51,50,22,22,21,20,6,6,35,34,53,52,54,55,39,6,6,7,34,38,53,52,54,54,51,23,55,55,23,23,14,2,7,23,50,54,53,52,38,38,35,34,6,6,21,20,22,22,23,21,7,2,54,54,55,38,38,35,34,6,6,21,20,22,51,1,49,180,92,106,195,126,98,155,86,75,145,102,36,36,7,6,48,91,48,39,41,69,107,53,100,9,5,31,8,5,30,37,12,4,106,111,73,133,89,98,151,82,76,158,119,26,103,65,80,37,17,57,27,31,60,37,17,12,203,109,176,106,110,196,119,82,141,86,83,145,88,29,12,166,30,2,91,114,34,74,62,82,156,98,16,25,1,15,12,16,115,171,83,4,122,104,87,125,65,96,160,95,100,163,102,7,7,36,1,22,79,139,86,11,22,65,108,60,42,62,0,0,2,0,55,255,228,2,189,2,137,0,70,0,80,0,89,64,86,23,1,2,1,25,1,4,2,54,45,2,3,4,74,73,65,36,1,5,7,3,67,66,2,0,7,5,74,0,4,5,1,3,7,4,3,103,0,2,2,1,95,0,1,1,98,75,9,1,7,7,0,95,0,0,0,105,75,8,1,6,6,105,6,76,71,71,0,0,71,80,71,79,0,70,0,69,39,23,43,40,44,35,10,12,26,43,4,39,6,6,35,34,38,53,52,54,54,21,53,38,53,52,54,54,51,50,22,22,23,23,7,7,38,38,35,34,6,21,20,22,22,23,23,54,53,52,38,35,34,6,7,39,62,2,55,55,54,54,55,23,7,6,6,35,35,7,22,22,21,20,7,23,21,6,6,35,36,54,55,39,6,6,21,20,22,51,2,74,118,42,106,51,98,116,59,73,82,52,91,56,32,54,31,4,2,48,10,36,42,28,40,48,27,63,61,160,18,38,40,17,35,5,14,2,13,24,14,206,38,37,2,10,13,7,25,38,100,3,20,22,40,140,7,46,9,254,255,75,28,225,39,47,91,76,28,106,42,48,93,79,51,74,44,3,7,86,71,45,72,42,10,11,2,15,74,1,33,21,41,35,34,58,69,52,138,36,50,60,58,7,2,43,1,8,8,1,12,3,5,3,24,31,13,7,6,18,51,29,64,62,118,16,5,26,79,26,25,201,18,67,38,59,70,0,0,0,1,0,42,255,151,1,251,2,129,0,49,0,53,64,50,24,23,14,3,0,2,1,74,0,0,2,1,2,0,1,126,0,1,6,1,5,1,5,99,4,1,2,2,3,93,0,3,3,98,2,76,0,0,0,49,0,48,33,124,38,34,21,7,12,25,43,22,38,53,52,54,55,51,20,22,51,50,54,54,53,17,38,38,35,34,6,21,20,22,23,21,38,38,53,52,54,54,51,50,23,23,50,54,51,7,7,38,6,7,6,2,21,20,6,6,35,169,78,23,15,15,52,44,42,43,16,1,7,19,49,49,32,37,105,138,52,96,63,34,50,45,36,75,14,6,2,45,33,2,6,5,28,79,76,105,48,46,20,51,18,66,70,37,81,74,1,188,10,4,80,67,71,97,50,15,9,117,107,54,90,52,2,2,3,42,4,2,19,28,38,254,252,97,90,110,59,0,0,0,0,2,0,35,255,151,1,221,2,137,0,53,0,70,0,57,64,54,70,61,29,3,1,4,2,1,2,1,2,74,0,4,5,1,5,4,1,126,0,1,2,5,1,2,124,0,2,0,0,2,0,99,0,5,5,3,95,0,3,3,98,5,76,34,21,47,34,21,37,6,12,26,43,36,6,7,14,2,35,34,38,53,52,54,55,51,22,22,51,50,54,53,52,38,39,46,2,53,52,54,55,62,2,51,50,22,21,20,6,7,35,38,38,35,34,6,21,20,22,23,30,2,21,6,53,52,38,39,38,38,39,6,6,21,20,22,23,22,22,23,1,221,66,51,2,45,75,44,50,67,10,5,15,10,64,44,32,45,59,60,48,59,41,62,54,2,41,66,38,39,60,13,6,14,14,58,30,24,32,62,62,48,58,41,58,59,64,62,70,10,34,29,60,63,61,70,11,158,97,26,31,65,44,46,34,22,55,8,53,65,42,30,38,62,41,35,50,69,41,44,87,32,37,62,37,30,19,18,53,7,34,44,35,27,39,62,43,34,49,64,39,97,62,35,62,50,47,70,41,20,45,30,37,65,49,46,71,42,0,0,0,3,0,42,255,244,2,139,2,86,0,15,0,31,0,67,0,114,177,6,100,68,64,103,41,1,6,4,62,1,9,7,2,74,0,5,6,8,6,5,8,126,0,8,7,6,8,7,124,0,0,0,2,4,0,2,103,0,4,0,6,5,4,6,103,0,7,12,1,9,3,7,9,103,11,1,3,1,1,3,87,11,1,3,3,1,95,10,1,1,3,1,79,32,32,16,16,0,0,32,67,32,66,59,58,56,54,50,48,46,45,39,37,16,31,16,30,24,22,0,15,0,14,38,13,12,21,43,177,6,0,68,4,38,38,53,52,54,54,51,50,22,22,21,20,6,6,35,62,2,53,52,38,38,35,34,6,6,21,20,22,22,51,38,38,53,52,54,54,51,50,22,23,23,6,6,7,7,55,52,35,34,6,21,20,22,51,50,54,55,55,6,6,7,7,14,2,35,1,7,140,81,81,140,83,83,140,82,82,140,83,71,121,71,71,121,71,71,121,70,70,121,71,80,77,43,79,51,29,59,8,2,2,9,2,33,1,64,45,51,49,49,34,37,8,32,2,10,1,4,4,28,48,28,12,82,140,83,83,140,82,82,140,83,83,140,82,40,71,122,72,72,122,71,71,122,72,72,122,71,103,88,68,50,80,46,10,2,4,7,51,32,2,24,44,61,58,64,73,36,39,2,8,55,24,7,2,9,8,0,0,0,0,4,0,30,1,47,1,182,2,199,0,15,0,31,0,74,0,85,0,182,177,6,100,68,183,85,83,67,3,4,8,1,74,75,176,12,80,88,64,55,0,4,8,5,8,4,112,0,0,0,2,9,0,2,103,0,9,12,1,8,4,9,8,103,10,7,2,5,15,11,2,6,3,5,6,103,14,1,3,1,1,3,87,14,1,3,3,1,95,13,1,1,3,1,79,27,64,56,0,4,8,5,8,4,5,126,0,0,0,2,9,0,2,103,0,9,12,1,8,4,9,8,103,10,7,2,5,15,11,2,6,3,5,6,103,14,1,3,1,1,3,87,14,1,3,3,1,95,13,1,1,3,1,79,89,64,40,32,32,16,16,0,0,78,77,32,74,32,73,70,69,62,58,56,54,49,48,45,42,40,39,35,34,16,31,16,30,24,22,0,15,0,14,38,16,12,21,43,177,6,0,68,18,38,38,53,52,54,54,51,50,22,22,21,20,6,6,35,62,2,53,52,38,38,35,34,6,6,21,20,22,22,51,54,39,39,35,6,21,20,22,51,23,7,39,35,34,6,35,55,54,54,53,53,52,38,35,35,39,55,23,51,55,50,22,21,20,6,7,23,22,51,23,20,6,35,38,53,52,35,34,6,21,6,21,34,23,178,93,55,55,93,56,56,93,55,55,93,56,46,77,46,46,77,46,46,77,46,46,77,46,43,17,29,25,1,7,17,2,2,32,12,15,26,4,2,17,8,5,7,11,2,3,43,11,31,38,43,26,22,29,21,20,3,16,23,30,52,4,2,2,1,30,1,47,55,93,56,56,93,55,55,93,56,56,93,55,35,46,77,46,46,77,46,46,77,46,46,77,46,69,32,55,14,19,19,9,4,17,1,2,21,1,14,23,111,11,7,4,17,1,2,29,26,24,29,10,43,32,4,12,5,122,30,38,3,5,46,23,3,0,2,0,2,1,138,2,40,2,130,0,41,0,115,0,91,64,88,66,1,0,1,111,99,77,63,43,21,9,7,3,0,57,1,4,3,3,74,16,1,1,72,115,105,2,4,71,9,8,7,3,1,10,2,2,0,3,1,0,103,13,11,5,3,3,4,4,3,87,13,11,5,3,3,3,4,96,12,6,2,4,3,4,80,107,106,104,101,98,97,90,89,85,84,41,78,34,40,84,36,25,55,20,14,15,29,43,19,54,54,53,53,14,2,7,7,54,54,55,55,23,51,55,23,22,22,23,7,46,2,39,6,21,20,22,51,50,54,51,23,7,34,38,35,34,6,35,36,39,35,6,6,7,20,51,51,23,7,39,34,6,7,55,54,54,55,54,54,55,52,38,39,39,55,50,22,51,50,54,51,22,22,23,51,54,54,55,50,22,55,50,54,51,23,7,6,6,21,22,22,23,22,22,51,55,23,7,39,34,6,7,55,54,53,38,38,39,35,6,7,7,47,27,13,23,18,9,3,32,1,3,1,4,39,125,40,4,1,3,1,32,4,8,17,22,4,10,11,9,11,2,1,3,8,41,19,20,39,7,1,32,20,4,1,6,1,12,14,2,4,46,13,23,4,3,12,10,2,3,11,2,12,18,3,4,6,30,14,13,24,4,16,31,5,4,5,29,20,5,30,11,13,24,4,2,3,17,12,1,5,3,2,8,10,11,2,4,40,14,35,8,3,23,1,7,1,3,32,32,26,1,166,2,14,23,148,1,5,19,23,3,7,45,28,4,4,4,4,28,42,7,3,25,20,5,1,66,93,14,12,1,1,26,2,2,121,47,19,87,24,12,2,23,1,2,1,25,1,11,14,28,95,26,10,6,2,3,21,2,2,53,88,12,12,82,58,1,1,2,2,22,1,9,10,22,78,38,20,14,1,2,24,1,2,1,25,1,17,26,82,18,76,93,3,0,2,0,25,1,141,1,21,2,137,0,11,0,23,0,56,177,6,100,68,64,45,0,0,0,2,3,0,2,103,5,1,3,1,1,3,87,5,1,3,3,1,95,4,1,1,3,1,79,12,12,0,0,12,23,12,22,18,16,0,11,0,10,36,6,12,21,43,177,6,0,68,18,38,53,52,54,51,50,22,21,20,6,35,54,54,53,52,38,35,34,6,21,20,22,51,99,74,74,52,53,73,73,53,35,49,49,35,34,50,50,34,1,141,74,52,53,73,73,53,52,74,42,50,34,35,49,49,35,34,50,0,0,1,0,152,254,243,0,225,3,39,0,11,0,6,179,11,5,1,48,43,19,52,16,55,19,55,23,6,2,21,19,7,152,1,1,60,11,1,5,1,59,254,249,59,1,64,160,2,8,11,6,56,254,162,104,253,219,11,0,0,0,2,0,152,254,243,0,225,3,39,0,7,0,13,0,8,181,13,10,7,2,2,48,43,19,19,55,23,6,6,7,7,3,17,55,23,19,7,153,1,60,11,1,4,1,62,5,64,3,1,59,1,114,1,170,11,6,42,242,141,9,253,138,1,173,12,3,254,79,11,0,0,0,4,0,32,255,163,1,207,2,86,0,4,0,9,0,14,0,19,0,65,64,62,8,7,2,2,0,13,6,2,1,2,14,1,3,1,3,74,2,1,0,3,0,72,19,18,15,3,3,71,0,0,2,0,131,0,2,1,2,131,4,1,1,3,1,131,0,3,3,116,5,5,17,16,12,11,5,9,5,9,19,5,12,21,43,19,55,23,7,7,23,55,55,23,7,37,55,23,7,7,19,19,55,19,7,213,62,11,15,53,71,2,164,8,9,254,90,9,163,3,161,163,15,53,5,62,2,77,9,8,186,3,68,53,13,9,62,1,62,5,53,15,254,109,1,137,3,254,117,9,0,0,0,2,255,255,255,244,1,76,2,232,0,29,0,38,0,52,64,49,32,29,23,12,10,9,7,7,2,3,1,74,0,1,4,1,3,2,1,3,103,0,2,0,0,2,87,0,2,2,0,95,0,0,2,0,79,30,30,30,38,30,37,40,44,34,5,15,23,43,37,6,6,35,34,38,53,53,6,7,39,54,55,53,52,54,54,51,50,22,21,20,6,7,21,20,22,51,50,55,2,21,21,54,54,53,52,38,35,1,76,42,66,12,61,64,41,32,15,30,58,44,74,44,34,43,87,81,33,31,38,58,160,59,61,22,20,61,33,40,60,56,182,35,24,29,23,52,131,74,130,78,53,43,61,154,81,203,46,47,33,2,92,197,92,66,120,48,27,28,0,7,0,32,255,163,1,207,2,86,0,4,0,9,0,14,0,18,0,23,0,28,0,33,0,98,64,95,8,7,2,2,0,13,6,2,1,2,22,21,18,17,16,15,14,7,4,1,27,20,2,3,4,28,1,5,3,5,74,2,1,0,3,0,72,33,32,2,5,71,0,0,2,0,131,0,2,1,2,131,6,1,1,4,1,131,0,4,3,4,131,7,1,3,5,3,131,0,5,5,116,19,19,5,5,31,30,26,25,19,23,19,23,12,11,5,9,5,9,19,8,12,21,43,19,55,23,7,7,23,55,55,23,7,37,55,23,7,7,23,55,21,7,23,55,55,23,7,37,55,23,7,7,23,55,55,23,7,213,62,11,15,53,71,2,164,8,9,254,90,9,163,3,161,178,55,55,71,2,164,8,9,254,90,9,163,3,161,163,15,53,5,62,2,77,9,8,159,3,67,53,13,9,62,1,62,5,53,15,11,4,150,4,69,53,13,9,62,1,62,5,53,15,186,175,3,177,9,0,2,0,40,255,244,3,9,2,139,0,28,0,45,0,77,64,74,43,31,2,6,5,15,1,3,1,2,74,0,3,1,2,1,3,2,126,0,0,0,5,6,0,5,103,8,1,6,0,1,3,6,1,101,0,2,4,4,2,87,0,2,2,4,95,7,1,4,2,4,79,29,29,0,0,29,45,29,45,38,36,0,28,0,27,18,39,35,38,9,15,24,43,4,38,38,53,52,54,54,51,50,22,22,21,21,33,34,21,21,20,23,22,22,51,50,54,55,51,6,6,35,19,50,53,53,52,39,38,38,35,34,6,7,6,21,21,20,51,1,53,169,100,100,169,100,100,169,99,253,171,5,9,43,117,66,70,123,44,54,51,154,87,229,5,10,44,115,64,65,116,44,10,5,12,89,152,90,90,153,89,89,153,90,8,4,181,10,11,46,51,58,51,60,69,1,85,5,182,12,10,44,49,51,45,10,13,178,5,0,0,0,255,255,0,51,255,228,3,156,1,249,0,34,2,123,0,0,1,7,3,18,2,102,255,114,0,9,177,1,2,184,255,114,176,51,43,0,0,1,0,56,0,57,1,194,1,225,0,22,0,28,177,6,100,68,64,17,16,14,9,6,5,5,0,71,0,0,0,116,21,20,1,12,20,43,177,6,0,68,0,22,23,22,22,23,7,47,2,35,7,6,6,7,39,39,54,54,63,2,23,1,34,48,27,22,55,8,40,11,79,70,6,60,21,45,7,50,5,7,50,24,86,47,11,1,196,115,62,51,119,18,30,1,181,168,154,51,124,19,7,9,19,125,57,203,2,8,0,0,0,1,255,243,255,242,2,138,2,137,0,15,0,30,64,27,0,0,1,1,0,87,0,0,0,1,95,2,1,1,0,1,79,0,0,0,15,0,14,38,3,15,21,43,22,38,38,53,52,54,54,51,50,22,22,21,20,6,6,35,228,152,89,89,152,90,90,153,89,89,153,90,14,89,152,90,90,153,89,89,153,90,90,152,89,0,0,0,0,1,0,0,0,0,2,125,2,125,0,3,0,24,64,21,0,0,1,1,0,85,0,0,0,1,93,0,1,0,1,77,17,16,2,15,22,43,17,33,17,33,2,125,253,131,2,125,253,131,0,0,255,255,0,54,1,159,0,131,2,137,0,2,7,22,0,0,255,255,0,54,1,159,1,15,2,137,0,35,7,22,0,140,0,0,0,2,7,22,0,0,255,255,0,33,255,117,3,31,2,171,1,6,7,162,0,70,0,8,177,0,2,176,70,176,51,43,0,0,0,2,0,28,255,243,3,13,2,174,0,62,0,74,1,110,64,15,61,1,5,7,74,50,48,43,37,3,6,3,4,2,74,75,176,8,80,88,64,48,0,2,1,2,131,0,5,7,6,7,5,6,126,0,6,4,7,6,4,124,0,4,3,7,4,3,124,0,7,7,1,95,0,1,1,38,75,0,3,3,0,95,0,0,0,39,0,76,27,75,176,10,80,88,64,48,0,2,1,2,131,0,5,7,6,7,5,6,126,0,6,4,7,6,4,124,0,4,3,7,4,3,124,0,7,7,1,95,0,1,1,38,75,0,3,3,0,95,0,0,0,41,0,76,27,75,176,11,80,88,64,48,0,2,1,2,131,0,5,7,6,7,5,6,126,0,6,4,7,6,4,124,0,4,3,7,4,3,124,0,7,7,1,95,0,1,1,38,75,0,3,3,0,95,0,0,0,39,0,76,27,75,176,14,80,88,64,48,0,2,1,2,131,0,5,7,6,7,5,6,126,0,6,4,7,6,4,124,0,4,3,7,4,3,124,0,7,7,1,95,0,1,1,38,75,0,3,3,0,95,0,0,0,41,0,76,27,75,176,15,80,88,64,48,0,2,1,2,131,0,5,7,6,7,5,6,126,0,6,4,7,6,4,124,0,4,3,7,4,3,124,0,7,7,1,95,0,1,1,38,75,0,3,3,0,95,0,0,0,39,0,76,27,64,48,0,2,1,2,131,0,5,7,6,7,5,6,126,0,6,4,7,6,4,124,0,4,3,7,4,3,124,0,7,7,1,95,0,1,1,38,75,0,3,3,0,95,0,0,0,41,0,76,89,89,89,89,89,64,11,43,18,24,19,43,27,37,39,8,7,28,43,1,21,7,7,39,14,2,35,34,38,53,52,54,54,51,50,22,21,20,6,6,7,23,54,54,55,55,51,22,22,21,20,6,7,6,6,7,22,22,51,50,54,55,39,34,6,6,7,35,39,53,55,55,50,23,22,51,50,54,54,55,51,4,54,54,53,52,38,35,34,6,6,21,21,3,13,91,18,86,21,100,135,71,107,124,63,103,55,42,46,7,8,1,4,110,119,11,7,20,4,20,34,17,63,199,206,17,101,75,91,124,20,60,9,35,30,4,6,26,94,16,21,82,84,23,7,33,31,4,8,253,172,69,27,23,20,32,56,34,1,94,6,100,7,12,74,120,68,132,112,73,127,75,41,36,13,23,13,2,2,75,149,80,6,11,65,18,11,46,18,72,140,115,65,74,109,98,8,28,30,5,22,5,100,6,14,14,28,31,5,99,53,43,27,21,23,46,82,50,30,0,0,255,255,0,54,1,159,0,131,2,137,0,2,7,22,0,0,0,1,0,45,255,84,0,122,0,62,0,11,0,6,179,11,4,1,48,43,23,54,54,55,55,23,6,21,20,22,23,7,45,2,20,13,25,11,1,6,1,70,164,19,129,64,14,2,18,36,56,95,13,14,0,0,0,2,254,184,2,34,255,185,2,127,0,11,0,23,0,50,177,6,100,68,64,39,2,1,0,1,1,0,87,2,1,0,0,1,95,5,3,4,3,1,0,1,79,12,12,0,0,12,23,12,22,18,16,0,11,0,10,36,6,12,21,43,177,6,0,68,0,38,53,52,54,51,50,22,21,20,6,35,50,38,53,52,54,51,50,22,21,20,6,35,254,206,22,29,21,19,22,29,21,147,22,29,21,19,22,29,21,2,34,26,17,21,29,25,18,21,29,26,17,21,29,25,18,21,29,0,0,0,0,3,254,184,2,43,255,185,3,43,0,10,0,22,0,34,0,43,64,40,10,8,5,3,4,0,72,5,3,4,3,1,1,0,95,2,1,0,0,56,1,76,23,23,11,11,23,34,23,33,29,27,11,22,11,21,47,6,9,21,43,2,38,39,39,55,55,22,22,23,7,7,6,38,53,52,54,51,50,22,21,20,6,35,50,38,53,52,54,51,50,22,21,20,6,35,166,123,17,4,16,9,18,122,59,6,8,206,22,29,21,19,22,29,21,147,22,29,21,19,22,29,21,2,186,43,6,10,48,6,10,68,31,24,5,118,26,17,21,29,25,18,21,29,26,17,21,29,25,18,21,29,0,3,254,184,2,43,255,185,3,43,0,10,0,22,0,34,0,43,64,40,10,6,4,1,4,0,72,5,3,4,3,1,1,0,95,2,1,0,0,56,1,76,23,23,11,11,23,34,23,33,29,27,11,22,11,21,47,6,9,21,43,1,39,54,54,55,23,23,7,6,6,7,6,38,53,52,54,51,50,22,21,20,6,35,50,38,53,52,54,51,50,22,21,20,6,35,254,205,6,59,122,18,9,16,4,17,123,66,7,22,29,21,19,22,29,21,147,22,29,21,19,22,29,21,2,166,24,31,68,10,6,48,10,6,43,25,118,26,17,21,29,25,18,21,29,26,17,21,29,25,18,21,29,0,0,0,0,3,254,168,2,43,255,202,3,16,0,14,0,26,0,38,0,50,64,47,10,8,6,4,2,5,0,72,0,0,1,0,131,6,4,5,3,2,2,1,95,3,1,1,1,56,2,76,27,27,15,15,27,38,27,37,33,31,15,26,15,25,37,29,7,9,22,43,2,38,39,55,55,22,23,54,55,23,23,6,6,7,35,6,38,53,52,54,51,50,22,21,20,6,35,50,38,53,52,54,51,50,22,21,20,6,35,218,85,41,14,9,67,55,52,70,9,14,41,85,12,14,100,22,29,21,19,22,29,21,147,22,29,21,19,22,29,21,2,149,69,31,22,1,39,26,24,41,1,22,31,69,11,95,26,17,21,29,25,18,21,29,26,17,21,29,25,18,21,29,0,0,0,3,254,164,2,23,255,207,2,221,0,9,0,21,0,33,0,99,64,11,6,0,2,1,0,1,74,5,1,0,72,75,176,23,80,88,64,23,0,0,0,1,2,0,1,101,7,5,6,3,3,3,2,95,4,1,2,2,56,3,76,27,64,29,0,0,0,1,2,0,1,101,4,1,2,3,3,2,87,4,1,2,2,3,95,7,5,6,3,3,2,3,79,89,64,20,22,22,10,10,22,33,22,32,28,26,10,21,10,20,37,35,49,8,9,23,43,1,55,23,50,54,55,23,15,2,22,38,53,52,54,51,50,22,21,20,6,35,50,38,53,52,54,51,50,22,21,20,6,35,254,164,10,154,31,85,13,6,7,142,144,36,22,29,21,19,22,29,21,147,22,29,21,19,22,29,21,2,171,45,1,5,1,10,47,1,1,139,26,17,21,29,25,18,21,29,26,17,21,29,25,18,21,29,0,1,255,3,2,70,255,111,2,180,0,11,0,38,177,6,100,68,64,27,0,0,1,1,0,87,0,0,0,1,95,2,1,1,0,1,79,0,0,0,11,0,10,36,3,12,21,43,177,6,0,68,2,38,53,52,54,51,50,22,21,20,6,35,227,26,34,25,23,26,34,25,2,70,30,21,24,35,30,21,24,35,0,0,255,255,254,163,1,253,255,206,2,187,0,46,7,191,244,216,60,96,1,6,7,205,255,66,0,17,177,0,1,184,255,216,176,51,43,177,1,1,176,66,176,51,43,0,0,1,254,185,2,9,255,127,2,202,0,10,0,6,179,10,5,1,48,43,2,38,39,39,55,55,22,22,23,7,7,211,100,15,1,38,10,13,92,45,20,9,2,56,81,11,11,41,2,16,107,49,19,2,0,0,0,1,254,243,2,9,255,185,2,203,0,10,0,6,179,10,4,1,48,43,3,39,54,54,55,23,23,7,6,6,7,249,20,45,92,13,10,38,1,15,100,53,2,11,19,49,108,16,2,41,11,11,81,48,0,0,0,2,254,174,2,22,255,228,2,193,0,10,0,21,0,8,181,18,13,7,2,2,48,43,2,6,7,39,39,54,54,55,23,23,7,22,6,7,39,39,54,54,55,23,23,7,171,93,49,9,16,41,86,13,9,33,2,115,93,49,9,16,41,86,13,9,33,2,2,133,70,41,2,18,43,94,14,3,38,9,10,70,41,2,18,43,94,14,3,38,9,0,0,1,255,21,1,219,255,98,2,197,0,11,0,6,179,11,6,1,48,43,3,54,53,52,38,39,55,23,6,6,7,7,229,1,6,1,70,7,2,20,13,25,1,221,18,36,56,95,13,14,8,19,129,64,14,0,0,1,254,168,2,15,255,202,2,191,0,15,0,27,177,6,100,68,64,16,15,13,10,8,1,5,0,71,0,0,0,116,20,1,12,21,43,177,6,0,68,1,39,54,54,55,51,22,22,23,7,7,38,39,39,6,7,254,182,14,41,85,12,14,12,85,41,14,9,38,63,21,78,44,2,16,22,42,97,14,14,96,43,22,1,34,47,16,58,39,0,0,0,1,254,161,2,14,255,209,2,198,0,14,0,27,177,6,100,68,64,16,10,8,6,4,2,5,0,72,0,0,0,116,29,1,12,21,43,177,6,0,68,2,38,39,55,55,22,23,54,55,23,23,6,6,7,35,219,89,43,16,8,60,68,83,45,8,16,43,89,13,14,2,29,101,44,23,1,52,49,62,39,1,23,44,101,15,0,0,0,1,254,193,2,26,255,177,2,150,0,15,0,45,177,6,100,68,64,34,12,10,3,2,4,0,72,0,0,1,1,0,87,0,0,0,1,95,2,1,1,0,1,79,0,0,0,15,0,14,38,3,12,21,43,177,6,0,68,2,38,39,55,51,22,22,51,50,54,55,51,23,6,6,35,247,60,12,16,8,12,52,32,32,52,12,8,16,12,60,48,2,26,66,48,10,32,34,34,32,10,48,66,0,0,2,254,232,2,32,255,137,2,196,0,11,0,23,0,56,177,6,100,68,64,45,0,0,0,2,3,0,2,103,5,1,3,1,1,3,87,5,1,3,3,1,95,4,1,1,3,1,79,12,12,0,0,12,23,12,22,18,16,0,11,0,10,36,6,12,21,43,177,6,0,68,2,38,53,52,54,51,50,22,21,20,6,35,54,54,53,52,38,35,34,6,21,20,22,51,239,41,47,37,35,42,48,37,28,23,28,23,21,23,29,22,2,32,43,37,37,47,41,35,38,50,38,20,19,22,26,20,19,20,28,0,0,1,254,149,2,35,255,222,2,176,0,27,0,51,177,6,100,68,64,40,14,13,2,0,72,27,1,2,71,0,1,3,2,1,87,0,0,0,3,2,0,3,103,0,1,1,2,95,0,2,1,2,79,35,24,35,19,4,12,24,43,177,6,0,68,1,53,55,55,50,23,22,22,51,50,54,54,55,51,23,21,7,7,34,39,38,38,35,34,6,6,7,35,254,149,76,16,18,60,9,49,10,10,28,22,3,6,22,76,16,18,60,9,49,10,11,28,21,3,6,2,56,5,89,4,18,2,13,24,27,4,21,5,89,4,18,2,13,24,27,4,0,0,0,255,255,254,149,1,241,255,222,2,233,0,38,7,201,0,206,1,6,7,186,1,106,0,17,177,0,1,184,255,206,176,51,43,177,1,2,176,106,176,51,43,0,0,0,255,255,254,149,1,241,255,222,3,4,0,38,7,201,0,206,1,134,7,227,180,184,63,233,252,167,3,89,63,233,0,18,177,0,1,184,255,206,176,51,43,177,1,1,184,255,184,176,51,43,0,0,255,255,254,156,1,244,255,216,2,228,0,46,7,201,249,230,61,137,1,6,7,205,0,107,0,17,177,0,1,184,255,230,176,51,43,177,1,1,176,107,176,51,43,0,0,1,254,164,2,62,255,207,2,121,0,9,0,43,177,6,100,68,64,32,6,0,2,1,0,1,74,5,1,0,72,0,0,1,1,0,85,0,0,0,1,93,0,1,0,1,77,35,49,2,12,22,43,177,6,0,68,1,55,23,50,54,55,23,15,2,254,164,10,154,31,85,13,6,7,142,144,2,71,45,1,5,1,10,47,1,1,0,255,255,254,164,2,2,255,207,2,235,0,38,7,205,0,196,1,6,7,226,47,162,0,18,177,0,1,184,255,196,176,51,43,177,1,1,184,255,162,176,51,43,0,0,255,255,254,164,2,2,255,207,2,235,0,38,7,205,0,196,1,6,7,227,216,162,0,18,177,0,1,184,255,196,176,51,43,177,1,1,184,255,162,176,51,43,0,0,0,1,254,223,2,47,255,125,2,239,0,23,0,39,177,6,100,68,64,28,23,22,21,11,4,0,71,0,1,0,0,1,87,0,1,1,0,95,0,0,1,0,79,24,37,2,12,22,43,177,6,0,68,3,54,54,53,52,38,35,34,6,6,7,39,62,2,55,50,22,21,20,6,7,23,7,238,29,23,19,16,13,26,16,2,11,3,22,34,17,38,44,32,27,21,37,2,102,21,28,14,11,13,8,10,1,17,3,20,23,6,31,28,17,44,20,35,17,0,0,0,2,254,178,2,22,255,232,2,193,0,10,0,21,0,8,181,21,16,10,5,2,48,43,2,38,39,39,55,55,22,22,23,7,7,54,38,39,39,55,55,22,22,23,7,7,226,93,13,2,33,9,13,86,41,16,9,79,93,13,2,33,9,13,86,41,16,9,2,63,70,10,9,38,3,14,95,42,18,2,41,70,10,9,38,3,14,95,42,18,2,0,0,1,254,214,2,26,255,198,2,150,0,15,0,45,177,6,100,68,64,34,11,10,4,2,4,1,71,0,0,1,1,0,87,0,0,0,1,95,2,1,1,0,1,79,0,0,0,15,0,14,38,3,12,21,43,177,6,0,68,2,6,7,35,39,54,54,51,50,22,23,7,35,38,38,35,210,52,12,8,16,12,60,48,48,60,12,16,8,12,52,32,2,92,34,32,10,48,66,66,48,10,32,34,0,255,255,255,114,1,158,255,235,2,139,0,3,7,59,255,80,0,0,0,0,0,1,255,41,1,192,255,190,2,134,0,16,0,44,177,6,100,68,64,33,6,1,0,1,1,74,0,1,0,1,131,0,0,2,2,0,87,0,0,0,2,95,0,2,0,2,79,20,40,16,3,12,23,43,177,6,0,68,3,50,54,53,52,38,39,55,54,54,51,50,22,21,20,6,39,215,32,38,18,14,2,14,31,13,23,28,83,66,1,231,28,23,17,38,13,14,12,14,41,33,57,67,4,0,0,1,254,254,255,64,255,117,255,183,0,11,0,38,177,6,100,68,64,27,0,0,1,1,0,87,0,0,0,1,95,2,1,1,0,1,79,0,0,0,11,0,10,36,3,12,21,43,177,6,0,68,6,38,53,52,54,51,50,22,21,20,6,35,229,29,34,28,27,30,35,28,192,33,24,26,36,33,24,26,36,0,0,0,255,255,254,184,254,244,255,185,255,81,1,7,7,186,0,0,252,210,0,9,177,0,2,184,252,210,176,51,43,0,0,0,0,1,254,220,254,219,255,110,255,189,0,16,0,26,177,6,100,68,64,15,16,7,1,0,4,0,71,0,0,0,116,41,1,12,21,43,177,6,0,68,1,53,54,54,53,52,38,39,55,54,51,50,22,21,20,6,7,254,220,31,41,22,18,2,34,24,23,31,76,52,254,234,10,19,55,25,19,33,10,14,26,39,32,49,79,27,0,0,0,1,254,213,255,23,255,145,0,23,0,25,0,57,177,6,100,68,64,46,17,14,2,0,2,1,74,0,2,0,2,131,0,0,1,0,131,0,1,3,3,1,87,0,1,1,3,96,4,1,3,1,3,80,0,0,0,25,0,24,22,34,20,5,12,23,43,177,6,0,68,4,38,53,52,55,51,22,22,51,50,54,53,52,38,39,55,51,7,30,2,21,20,6,6,35,255,0,43,25,9,1,29,25,20,28,46,39,33,43,25,7,49,29,36,56,28,233,20,16,16,40,27,30,21,17,16,37,22,108,73,5,33,34,17,25,43,26,0,0,0,1,254,206,255,15,255,161,0,42,0,21,0,51,177,6,100,68,64,40,18,17,2,1,0,1,74,0,0,1,0,131,0,1,2,2,1,87,0,1,1,2,95,3,1,2,1,2,79,0,0,0,21,0,21,38,22,4,12,22,43,177,6,0,68,6,38,53,52,54,54,55,51,14,2,21,20,22,51,50,54,55,23,6,6,7,244,62,20,56,61,42,49,48,19,31,27,17,44,16,13,21,56,23,241,50,41,25,42,64,61,51,57,39,20,26,31,13,10,19,20,36,7,0,0,1,254,193,255,59,255,177,255,183,0,15,0,45,177,6,100,68,64,34,12,10,3,2,4,0,72,0,0,1,1,0,87,0,0,0,1,95,2,1,1,0,1,79,0,0,0,15,0,14,38,3,12,21,43,177,6,0,68,6,38,39,55,51,22,22,51,50,54,55,51,23,6,6,35,247,60,12,16,8,12,52,32,32,52,12,8,16,12,60,48,197,66,48,10,32,34,34,32,10,48,66,0,0,0,1,254,164,255,93,255,207,255,152,0,9,0,43,177,6,100,68,64,32,6,0,2,1,0,1,74,5,1,0,72,0,0,1,1,0,85,0,0,0,1,93,0,1,0,1,77,35,49,2,12,22,43,177,6,0,68,5,55,23,50,54,55,23,15,2,254,164,10,154,31,85,13,6,7,142,144,154,45,1,5,1,10,47,1,1,0,0,0,1,254,117,0,215,255,184,1,14,0,9,0,42,177,6,100,68,64,31,6,1,1,0,1,74,5,1,0,72,0,0,1,1,0,85,0,0,0,1,93,0,1,0,1,77,35,49,2,12,22,43,177,6,0,68,37,55,23,50,54,55,23,15,2,254,117,7,166,37,87,13,13,5,168,141,224,42,1,4,1,14,39,1,1,0,0,0,0,2,254,184,2,203,255,185,3,40,0,11,0,23,0,42,64,39,2,1,0,1,1,0,87,2,1,0,0,1,95,5,3,4,3,1,0,1,79,12,12,0,0,12,23,12,22,18,16,0,11,0,10,36,6,9,21,43,0,38,53,52,54,51,50,22,21,20,6,35,50,38,53,52,54,51,50,22,21,20,6,35,254,206,22,29,21,19,22,29,21,147,22,29,21,19,22,29,21,2,203,26,17,21,29,25,18,21,29,26,17,21,29,25,18,21,29,0,0,0,0,3,254,184,2,170,255,185,3,170,0,10,0,22,0,34,0,49,64,46,10,6,4,1,4,0,72,2,1,0,1,1,0,87,2,1,0,0,1,95,5,3,4,3,1,0,1,79,23,23,11,11,23,34,23,33,29,27,11,22,11,21,47,6,9,21,43,1,39,54,54,55,23,23,7,6,6,7,6,38,53,52,54,51,50,22,21,20,6,35,50,38,53,52,54,51,50,22,21,20,6,35,254,205,6,59,122,18,9,16,4,17,123,66,7,22,29,21,19,22,29,21,147,22,29,21,19,22,29,21,3,37,24,31,68,10,6,48,10,6,43,25,118,26,17,21,29,25,18,21,29,26,17,21,29,25,18,21,29,0,0,3,254,164,2,193,255,207,3,135,0,9,0,21,0,33,0,63,64,60,6,0,2,1,0,1,74,5,1,0,72,0,0,0,1,2,0,1,101,4,1,2,3,3,2,87,4,1,2,2,3,95,7,5,6,3,3,2,3,79,22,22,10,10,22,33,22,32,28,26,10,21,10,20,37,35,49,8,9,23,43,1,55,23,50,54,55,23,15,2,22,38,53,52,54,51,50,22,21,20,6,35,50,38,53,52,54,51,50,22,21,20,6,35,254,164,10,154,31,85,13,6,7,142,144,36,22,29,21,19,22,29,21,147,22,29,21,19,22,29,21,3,85,45,1,5,1,10,47,1,1,139,26,17,21,29,25,18,21,29,26,17,21,29,25,18,21,29,0,1,255,3,2,197,255,111,3,51,0,11,0,30,64,27,0,0,1,1,0,87,0,0,0,1,95,2,1,1,0,1,79,0,0,0,11,0,10,36,3,9,21,43,2,38,53,52,54,51,50,22,21,20,6,35,227,26,34,25,23,26,34,25,2,197,30,21,24,35,30,21,24,35,0,0,255,255,254,164,2,183,255,207,3,117,0,47,7,191,255,245,0,146,60,96,1,7,7,205,0,0,0,252,0,16,177,0,1,176,146,176,51,43,177,1,1,176,252,176,51,43,0,0,0,1,254,163,2,191,255,131,3,73,0,10,0,6,179,10,5,1,48,43,2,38,39,39,55,55,22,22,23,7,7,205,123,17,4,16,9,18,122,59,6,8,2,216,43,6,10,48,6,10,68,31,24,5,0,0,0,1,254,239,2,191,255,207,3,73,0,10,0,6,179,10,4,1,48,43,1,39,54,54,55,23,23,7,6,6,7,254,245,6,59,122,18,9,16,4,17,123,66,2,196,24,31,68,10,6,48,10,6,43,25,0,0,2,254,193,2,173,0,5,3,69,0,10,0,21,0,8,181,21,15,10,4,2,48,43,1,39,54,54,55,23,23,7,6,6,7,23,39,54,54,55,23,23,7,6,6,7,254,202,9,45,94,14,9,22,3,14,97,53,133,10,54,85,14,9,22,3,14,98,52,2,187,21,33,73,11,4,43,9,7,51,29,5,21,41,66,11,5,42,9,7,51,29,0,1,254,168,2,200,255,202,3,78,0,14,0,19,64,16,14,12,10,8,1,5,0,71,0,0,0,116,20,1,9,21,43,1,39,54,54,55,51,22,22,23,7,7,38,39,6,7,254,182,14,41,85,12,14,12,85,41,14,9,67,55,52,70,2,201,22,31,69,11,11,69,31,22,1,39,26,24,41,0,0,1,254,168,2,192,255,202,3,70,0,14,0,19,64,16,10,8,6,4,2,5,0,72,0,0,0,116,29,1,9,21,43,2,38,39,55,55,22,23,54,55,23,23,6,6,7,35,218,85,41,14,9,67,55,52,70,9,14,41,85,12,14,2,203,69,31,22,1,39,26,24,41,1,22,31,69,11,0,0,0,1,254,193,2,198,255,177,3,50,0,15,0,37,64,34,12,10,3,2,4,0,72,0,0,1,1,0,87,0,0,0,1,95,2,1,1,0,1,79,0,0,0,15,0,14,38,3,9,21,43,2,38,39,55,51,22,22,51,50,54,55,51,23,6,6,35,247,60,12,16,8,12,52,32,32,52,12,8,16,12,60,48,2,198,56,42,10,24,26,26,24,10,42,56,0,0,2,254,232,2,162,255,137,3,70,0,11,0,22,0,48,64,45,0,0,0,2,3,0,2,103,5,1,3,1,1,3,87,5,1,3,3,1,95,4,1,1,3,1,79,12,12,0,0,12,22,12,21,17,15,0,11,0,10,36,6,9,21,43,2,38,53,52,54,51,50,22,21,20,6,35,54,53,52,38,35,34,6,21,20,22,51,240,40,46,38,38,39,46,39,51,27,24,21,23,32,19,2,162,44,36,37,47,44,32,36,52,38,39,22,26,21,18,24,24,0,1,254,149,2,187,255,222,3,52,0,27,0,48,64,45,14,1,1,0,1,74,13,1,0,72,27,1,2,71,0,1,3,2,1,87,0,0,0,3,2,0,3,103,0,1,1,2,95,0,2,1,2,79,35,24,35,19,4,9,24,43,1,53,55,55,50,23,22,22,51,50,54,54,55,51,23,21,7,7,34,39,38,38,35,34,6,6,7,35,254,149,76,16,18,60,9,49,10,10,28,22,3,6,22,76,16,18,60,9,49,10,11,28,21,3,6,2,208,5,79,4,18,2,13,20,22,3,21,5,79,4,18,2,13,20,22,3,0,0,255,255,254,149,2,175,255,222,3,167,0,39,7,201,0,0,0,140,1,7,7,186,0,1,1,40,0,17,177,0,1,176,140,176,51,43,177,1,2,184,1,40,176,51,43,0,0,0,255,255,254,149,2,175,255,222,3,194,0,39,7,201,0,0,0,140,1,134,7,227,180,118,63,233,252,167,3,89,63,233,0,16,177,0,1,176,140,176,51,43,177,1,1,176,118,176,51,43,0,0,255,255,254,149,2,155,255,222,3,141,0,38,7,201,0,120,1,7,7,205,0,0,1,20,0,17,177,0,1,176,120,176,51,43,177,1,1,184,1,20,176,51,43,0,0,1,254,164,2,207,255,207,3,10,0,9,0,35,64,32,6,0,2,1,0,1,74,5,1,0,72,0,0,1,1,0,85,0,0,0,1,93,0,1,0,1,77,35,49,2,9,22,43,1,55,23,50,54,55,23,15,2,254,164,10,154,31,85,13,6,7,142,144,2,216,45,1,5,1,10,47,1,1,0,255,255,254,164,2,202,255,207,3,179,0,39,7,205,0,0,0,140,1,6,7,226,47,106,0,16,177,0,1,176,140,176,51,43,177,1,1,176,106,176,51,43,0,0,255,255,254,164,2,202,255,207,3,179,0,39,7,205,0,0,0,140,1,6,7,227,216,106,0,16,177,0,1,176,140,176,51,43,177,1,1,176,106,176,51,43,0,0,0,2,254,203,2,173,0,15,3,69,0,10,0,21,0,8,181,21,16,10,5,2,48,43,2,38,39,39,55,55,22,22,23,7,7,38,38,39,39,55,55,22,22,23,7,7,54,98,14,3,22,9,14,94,45,9,8,192,98,14,3,22,9,14,85,54,10,7,2,211,51,7,9,43,4,11,73,33,21,5,20,51,7,9,42,5,11,66,41,21,4,0,0,1,254,117,0,215,255,184,1,14,0,9,0,34,64,31,6,1,1,0,1,74,5,1,0,72,0,0,1,1,0,85,0,0,0,1,93,0,1,0,1,77,35,49,2,9,22,43,37,55,23,50,54,55,23,15,2,254,117,7,166,37,87,13,13,5,168,141,224,42,1,4,1,14,39,1,1,0,0,0,0,2,254,211,2,34,255,192,2,127,0,11,0,23,0,42,64,39,2,1,0,1,1,0,87,2,1,0,0,1,95,5,3,4,3,1,0,1,79,12,12,0,0,12,23,12,22,18,16,0,11,0,10,36,6,15,21,43,0,38,53,52,54,51,50,22,21,20,6,35,50,38,53,52,54,51,50,22,21,20,6,35,254,233,22,29,21,19,22,29,21,127,22,29,21,19,22,29,21,2,34,26,17,21,29,25,18,21,29,26,17,21,29,25,18,21,29,0,0,0,255,255,0,21,1,158,0,142,2,139,0,2,7,60,0,0,255,255,0,34,1,158,0,155,2,139,0,2,7,59,0,0,255,255,0,50,2,62,1,93,2,121,0,3,7,205,1,142,0,0,0,0,255,255,0,71,2,9,1,13,2,202,0,3,7,193,1,142,0,0,0,0,255,255,0,54,1,159,0,131,2,137,0,2,7,22,0,0,0,1,0,118,1,191,0,213,2,126,0,12,0,42,177,6,100,68,64,31,0,3,0,0,1,3,0,103,0,1,2,2,1,87,0,1,1,2,95,0,2,1,2,79,20,17,19,16,4,12,24,43,177,6,0,68,19,34,21,20,22,51,21,34,38,53,52,54,51,213,55,31,24,44,51,54,41,2,82,45,26,31,45,48,40,44,59,0,0,1,0,118,1,190,0,213,2,126,0,13,0,42,177,6,100,68,64,31,0,2,0,1,0,2,1,103,0,0,3,3,0,87,0,0,0,3,95,0,3,0,3,79,20,17,20,16,4,12,24,43,177,6,0,68,19,50,54,53,52,38,35,53,50,22,21,20,6,35,118,27,28,30,25,44,51,55,40,1,235,23,22,25,31,46,48,41,44,59,0,0,255,255,0,129,2,9,1,71,2,203,0,3,7,194,1,142,0,0,0,0,0,1,0,105,255,26,0,172,255,200,0,3,0,32,177,6,100,68,64,21,0,0,1,1,0,85,0,0,0,1,93,0,1,0,1,77,17,16,2,12,22,43,177,6,0,68,23,51,21,35,105,67,67,56,174,0,0,1,0,105,1,207,0,172,2,125,0,3,0,32,177,6,100,68,64,21,0,0,1,1,0,85,0,0,0,1,93,0,1,0,1,77,17,16,2,12,22,43,177,6,0,68,19,51,21,35,105,67,67,2,125,174,255,255,0,129,2,9,1,71,2,203,0,3,7,194,1,142,0,0,0,0,255,255,0,79,2,26,1,63,2,150,0,3,7,199,1,142,0,0,0,0,255,255,0,47,2,14,1,95,2,198,0,3,7,198,1,142,0,0,0,0,255,255,0,99,255,23,1,31,0,23,0,3,7,216,1,142,0,0,0,0,255,255,0,54,2,15,1,88,2,191,0,3,7,197,1,142,0,0,0,0,255,255,0,70,2,34,1,71,2,127,0,3,7,186,1,142,0,0,0,0,255,255,0,145,2,70,0,253,2,180,0,3,7,191,1,142,0,0,0,0,255,255,0,71,2,9,1,13,2,202,0,3,7,193,1,142,0,0,0,0,255,255,0,24,2,22,1,78,2,193,0,3,7,195,1,106,0,0,0,0,255,255,0,50,2,62,1,93,2,121,0,3,7,205,1,142,0,0,0,0,255,255,0,92,255,15,1,47,0,42,0,3,7,217,1,142,0,0,0,0,255,255,0,118,2,32,1,23,2,196,0,3,7,200,1,142,0,0,0,0,0,1,0,45,2,39,1,98,2,180,0,27,0,51,177,6,100,68,64,40,14,13,2,0,72,27,1,2,71,0,1,3,2,1,87,0,0,0,3,2,0,3,103,0,1,1,2,95,0,2,1,2,79,35,24,35,19,4,12,24,43,177,6,0,68,19,53,55,55,50,23,22,22,51,50,54,54,55,51,23,21,7,7,34,39,38,38,35,34,6,6,7,35,45,76,16,18,50,9,40,9,10,28,22,3,6,22,76,16,18,50,9,40,9,11,28,21,3,6,2,60,5,89,4,18,3,12,24,27,4,21,5,89,4,18,3,12,24,27,4,255,255,0,163,1,219,0,240,2,197,0,3,7,196,1,142,0,0,0,0,255,255,254,169,2,39,255,212,2,180,0,3,8,38,254,124,0,0,0,0,255,255,255,106,1,250,255,222,2,196,0,3,8,17,254,213,0,0,0,0,255,255,254,175,1,247,255,201,2,187,0,3,8,16,254,114,0,0,0,0,0,1,255,43,255,24,255,122,255,224,0,6,0,45,177,6,100,68,64,34,5,1,2,1,0,1,74,0,0,1,1,0,85,0,0,0,1,95,2,1,1,0,1,79,0,0,0,6,0,6,19,3,12,21,43,177,6,0,68,6,39,63,2,23,7,166,47,20,8,37,14,7,231,15,179,4,1,189,11,0,0,1,0,173,1,246,1,34,2,200,0,7,0,6,179,7,3,1,48,43,19,54,55,55,23,23,7,7,173,30,22,9,53,3,76,9,1,255,100,99,2,21,10,177,2,0,0,0,0,3,0,61,1,247,1,87,2,187,0,7,0,19,0,31,0,69,177,6,100,68,64,58,5,3,2,3,1,72,5,1,0,2,0,132,3,1,1,2,2,1,87,3,1,1,1,2,95,7,4,6,3,2,1,2,79,20,20,8,8,0,0,20,31,20,30,26,24,8,19,8,18,14,12,0,7,0,7,8,10,20,43,177,6,0,68,19,54,53,55,23,23,7,7,38,38,53,52,54,51,50,22,21,20,6,35,50,38,53,52,54,51,50,22,21,20,6,35,172,5,8,52,5,33,8,120,20,26,19,18,19,26,19,182,19,26,19,17,20,26,19,1,249,80,110,4,8,8,176,4,61,23,15,18,27,22,16,18,27,23,15,18,27,23,15,18,27,0,1,0,149,1,250,1,9,2,196,0,15,0,24,177,6,100,68,64,13,15,6,2,0,71,0,0,0,116,40,1,10,21,43,177,6,0,68,19,39,54,53,52,39,39,54,54,51,50,22,21,20,6,7,151,2,51,48,1,12,38,11,22,31,49,46,2,5,10,42,40,40,16,13,11,19,40,27,32,71,32,0,0,0,0,1,0,145,1,253,1,16,2,196,0,17,0,16,64,13,17,8,2,0,71,0,0,0,116,42,1,9,21,43,19,39,54,54,53,52,38,39,39,54,54,51,50,22,22,21,20,7,148,1,28,30,30,29,1,14,38,16,11,28,20,103,2,8,10,20,41,18,19,29,7,13,14,17,21,37,22,58,61,0,255,255,0,21,1,250,0,137,2,196,0,3,8,17,255,128,0,0,0,0,0,1,0,137,1,250,0,253,2,196,0,15,0,25,177,6,100,68,64,14,15,13,8,3,0,71,0,0,0,116,36,1,10,21,43,177,6,0,68,18,38,53,52,54,51,50,22,23,7,6,21,20,23,7,7,186,49,31,22,11,38,12,1,48,51,2,19,2,26,71,32,27,40,19,11,13,16,40,40,42,10,11,0,0,0,1,0,139,1,254,1,4,2,196,0,17,0,17,64,14,17,15,8,3,0,71,0,0,0,116,36,1,9,21,43,18,53,52,54,54,51,50,22,23,7,6,6,21,20,22,23,7,7,139,18,27,11,16,36,13,2,27,27,28,26,12,9,2,56,64,21,35,20,16,13,13,6,29,20,20,44,17,19,1,0,2,0,109,1,244,1,79,2,202,0,10,0,26,0,33,177,6,100,68,64,22,3,1,0,72,26,17,14,12,9,1,6,0,71,0,0,0,116,21,20,1,10,20,43,177,6,0,68,1,39,55,55,23,22,23,22,22,23,7,39,39,54,39,38,39,39,54,54,55,54,22,21,20,6,7,1,43,63,4,59,9,2,2,2,13,8,27,191,3,47,2,3,46,1,10,36,10,22,32,43,41,1,249,181,10,18,3,13,26,19,102,42,7,7,10,42,38,38,13,12,11,20,1,1,39,27,30,67,32,0,0,0,2,0,85,1,242,1,63,2,202,0,10,0,26,0,31,177,6,100,68,64,20,3,1,0,72,26,24,19,9,1,5,0,71,0,0,0,116,47,1,10,21,43,177,6,0,68,1,39,55,55,23,22,23,22,22,23,7,38,38,53,52,54,51,50,22,23,7,6,21,20,23,7,7,1,27,63,4,59,9,2,2,2,13,8,27,158,49,31,22,11,38,12,1,48,51,2,19,1,249,181,10,18,3,13,26,19,102,42,7,28,71,32,27,40,19,11,13,16,40,40,42,10,11,0,2,0,98,1,246,1,83,2,202,0,10,0,28,0,23,64,20,3,1,0,72,28,26,19,9,1,5,0,71,0,0,0,116,47,1,9,21,43,1,39,55,55,23,22,23,22,22,23,7,38,53,52,54,54,51,50,22,23,7,6,6,21,20,22,23,7,7,1,47,63,4,59,9,2,2,2,13,8,27,214,18,27,11,16,36,13,2,26,28,28,26,12,9,1,249,181,10,18,3,13,26,19,102,42,7,58,55,21,35,20,16,13,13,6,27,18,18,40,18,19,1,0,0,0,2,0,122,1,244,1,113,2,201,0,7,0,23,0,33,177,6,100,68,64,22,3,1,0,72,23,14,11,9,7,5,6,0,71,0,0,0,116,18,17,1,10,20,43,177,6,0,68,1,54,55,55,23,23,7,7,39,39,54,39,38,39,39,54,54,55,54,22,21,20,6,7,0,255,21,23,9,58,3,76,9,154,3,47,2,3,46,1,10,36,10,22,32,43,41,2,0,77,122,2,22,10,176,2,6,10,42,38,38,13,12,11,20,1,1,39,27,30,67,32,0,0,0,0,2,0,105,1,244,1,109,2,201,0,7,0,23,0,25,64,22,3,1,0,72,23,14,11,9,7,5,6,0,71,0,0,0,116,18,17,1,9,20,43,19,54,55,55,23,23,7,7,39,39,54,39,38,39,39,54,54,55,54,22,21,20,6,7,251,21,23,9,58,3,76,9,167,3,47,2,3,46,1,10,36,10,22,32,43,41,2,0,77,122,2,22,10,176,2,6,10,42,38,38,13,12,11,20,1,1,39,27,30,67,32,0,2,0,98,1,241,1,99,2,195,0,7,0,23,0,31,177,6,100,68,64,20,3,1,0,72,23,21,16,7,5,5,0,71,0,0,0,116,44,1,10,21,43,177,6,0,68,19,54,55,55,23,23,7,7,38,38,53,52,54,51,50,22,23,7,6,21,20,23,7,7,241,21,23,9,58,3,76,9,123,49,31,22,11,38,12,1,48,51,2,19,1,250,77,122,2,22,10,176,2,33,71,32,27,40,19,11,13,16,40,40,42,10,11,0,0,0,2,0,100,1,241,1,104,2,195,0,7,0,25,0,23,64,20,3,1,0,72,25,23,16,7,5,5,0,71,0,0,0,116,44,1,9,21,43,19,54,55,55,23,23,7,7,38,53,52,54,54,51,50,22,23,7,6,6,21,20,22,23,7,7,246,21,23,9,58,3,76,9,175,18,27,11,16,36,13,2,26,28,28,26,12,9,1,250,77,122,2,22,10,176,2,66,55,21,35,20,16,13,13,6,27,18,18,40,18,19,1,0,2,0,83,1,234,1,96,3,10,0,27,0,44,0,42,177,6,100,68,64,31,14,13,2,0,72,44,35,27,3,2,71,0,0,1,0,131,0,1,2,1,131,0,2,2,116,47,28,39,3,10,23,43,177,6,0,68,19,39,55,55,54,22,23,22,51,50,54,54,55,51,23,21,7,7,6,38,39,38,35,34,6,6,7,35,23,39,54,53,52,38,39,39,54,54,51,50,22,21,20,6,7,84,1,64,14,13,44,4,40,9,9,24,19,3,6,20,63,15,12,43,5,40,10,8,24,19,3,6,73,1,40,18,19,1,10,32,9,17,25,40,36,2,148,5,83,4,1,14,1,12,23,25,4,18,5,83,4,1,14,1,12,23,25,4,142,7,34,30,16,22,7,9,9,15,31,21,26,55,26,0,0,0,0,2,0,83,1,239,1,96,3,10,0,27,0,43,0,36,64,33,14,13,2,0,72,43,35,27,3,2,71,0,0,1,0,131,0,1,2,1,131,0,2,2,56,2,76,47,28,39,3,9,23,43,19,39,55,55,54,22,23,22,51,50,54,54,55,51,23,21,7,7,6,38,39,38,35,34,6,6,7,35,23,39,54,53,52,38,39,39,54,54,51,50,22,21,20,7,84,1,64,14,13,44,4,40,9,9,24,19,3,6,20,63,15,12,43,5,40,10,8,24,19,3,6,67,1,39,20,20,1,11,38,15,15,34,87,2,148,5,83,4,1,14,1,12,23,25,4,18,5,83,4,1,14,1,12,23,25,4,137,8,26,29,14,22,4,12,11,15,39,22,45,45,0,2,0,82,1,241,1,95,3,19,0,27,0,44,0,43,177,6,100,68,64,32,14,13,2,0,72,44,42,36,27,4,2,71,0,0,1,0,131,0,1,2,1,131,0,2,2,116,42,28,39,3,10,23,43,177,6,0,68,19,39,55,55,54,22,23,22,51,50,54,54,55,51,23,21,7,7,6,38,39,38,35,34,6,6,7,35,22,38,53,52,54,51,50,22,23,7,6,6,21,20,23,7,7,83,1,64,14,13,44,4,40,9,9,24,19,3,6,20,63,15,12,43,5,40,10,8,24,19,3,6,108,40,25,17,9,32,10,1,19,18,40,1,18,2,157,5,83,4,1,14,1,12,23,25,4,18,5,83,4,1,14,1,12,23,25,4,128,55,26,21,31,15,9,9,7,22,16,30,34,7,10,0,0,0,2,0,82,1,247,1,95,3,19,0,27,0,43,0,37,64,34,14,13,2,0,72,43,41,35,27,4,2,71,0,0,1,0,131,0,1,2,1,131,0,2,2,56,2,76,41,28,39,3,9,23,43,19,39,55,55,54,22,23,22,51,50,54,54,55,51,23,21,7,7,6,38,39,38,35,34,6,6,7,35,22,53,52,54,51,50,22,23,7,6,6,21,20,23,7,7,83,1,64,14,13,44,4,40,9,9,24,19,3,6,20,63,15,12,43,5,40,10,8,24,19,3,6,60,34,15,14,39,11,1,20,20,38,13,9,2,157,5,83,4,1,14,1,12,23,25,4,18,5,83,4,1,14,1,12,23,25,4,102,45,22,39,16,10,12,4,22,14,30,25,18,1,0,0,0,0,3,0,57,1,249,1,90,2,186,0,10,0,22,0,34,0,59,177,6,100,68,64,48,5,3,2,0,72,9,1,1,71,2,1,0,1,1,0,87,2,1,0,0,1,95,5,3,4,3,1,0,1,79,23,23,11,11,23,34,23,33,29,27,11,22,11,21,47,6,10,21,43,177,6,0,68,19,38,38,39,55,55,23,22,22,23,7,54,38,53,52,54,51,50,22,21,20,6,35,6,38,53,52,54,51,50,22,21,20,6,35,234,37,50,7,3,45,9,5,42,27,28,40,19,26,19,17,20,26,19,224,20,26,19,18,19,26,19,1,250,63,81,11,10,27,1,16,108,56,12,58,23,15,18,27,23,15,18,27,4,23,15,18,27,22,16,18,27,0,0,0,0,3,0,58,1,249,1,91,2,185,0,7,0,19,0,31,0,59,177,6,100,68,64,48,5,3,2,0,72,7,1,1,71,2,1,0,1,1,0,87,2,1,0,0,1,95,5,3,4,3,1,0,1,79,20,20,8,8,20,31,20,30,26,24,8,19,8,18,44,6,10,21,43,177,6,0,68,19,54,55,55,23,23,7,7,38,38,53,52,54,51,50,22,21,20,6,35,50,38,53,52,54,51,50,22,21,20,6,35,140,35,36,8,47,2,91,9,90,20,26,19,18,19,26,19,189,19,26,19,17,20,26,19,2,5,80,99,1,25,10,156,1,59,23,15,18,27,22,16,18,27,23,15,18,27,23,15,18,27,0,0,3,0,63,2,15,1,103,3,0,0,27,0,39,0,51,0,118,177,6,100,68,64,11,27,1,2,1,1,74,14,13,2,0,72,75,176,12,80,88,64,32,0,0,1,2,0,110,0,1,2,1,131,4,1,2,3,3,2,87,4,1,2,2,3,96,7,5,6,3,3,2,3,80,27,64,31,0,0,1,0,131,0,1,2,1,131,4,1,2,3,3,2,87,4,1,2,2,3,96,7,5,6,3,3,2,3,80,89,64,20,40,40,28,28,40,51,40,50,46,44,28,39,28,38,41,44,39,8,10,23,43,177,6,0,68,19,53,55,55,54,22,23,22,51,50,54,54,55,51,23,21,7,7,6,38,39,38,35,34,6,6,7,35,22,38,53,52,54,51,50,22,21,20,6,35,50,38,53,52,54,51,50,22,21,20,6,35,63,70,16,12,46,8,44,11,10,26,21,3,6,23,70,16,12,46,8,40,16,10,27,20,3,6,47,20,26,19,18,19,26,19,125,19,26,19,17,20,26,19,2,127,5,92,4,1,14,2,14,25,28,4,20,5,91,5,1,14,2,14,25,28,4,92,23,15,18,27,22,16,18,27,23,15,18,27,23,15,18,27,0,0,0,1,0,105,1,243,0,236,2,194,0,7,0,6,179,7,3,1,48,43,19,39,55,55,23,22,23,7,196,91,2,51,9,33,36,31,1,244,170,10,26,1,105,89,12,0,0,0,255,255,0,173,1,246,1,34,2,200,0,2,8,15,0,0,0,1,0,45,2,39,1,88,2,180,0,27,0,51,177,6,100,68,64,40,15,14,2,0,72,27,1,2,71,0,1,3,2,1,87,0,0,0,3,2,0,3,103,0,1,1,2,95,0,2,1,2,79,34,24,36,19,4,10,24,43,177,6,0,68,19,53,55,55,50,22,23,22,22,51,50,54,54,55,51,23,21,7,7,34,39,38,35,34,6,6,7,35,45,73,16,13,46,6,4,42,10,10,27,21,3,6,22,73,16,16,50,41,14,10,27,21,3,6,2,60,5,89,4,15,2,2,14,24,27,4,21,5,89,4,18,15,24,27,4,255,255,0,45,2,39,1,98,2,180,0,2,8,9,0,0,0,2,0,103,1,244,1,83,2,202,0,10,0,26,0,25,64,22,3,1,0,72,26,17,14,12,9,1,6,0,71,0,0,0,116,21,20,1,9,20,43,1,39,55,55,23,22,23,22,22,23,7,39,39,54,39,38,39,39,54,54,55,54,22,21,20,6,7,1,47,63,4,59,9,2,2,2,13,8,27,201,3,47,2,3,46,1,10,36,10,22,32,43,41,1,249,181,10,18,3,13,26,19,102,42,7,7,10,42,38,38,13,12,11,20,1,1,39,27,30,67,32,0,0,0,1,254,178,2,30,255,205,2,143,0,13,0,39,64,36,10,9,8,4,3,2,6,0,72,0,0,1,1,0,87,0,0,0,1,95,2,1,1,0,1,79,0,0,0,13,0,12,37,3,9,21,43,2,38,39,55,23,22,51,50,55,55,23,6,6,35,253,71,10,54,12,3,72,73,3,12,54,10,75,58,2,30,49,46,18,5,76,76,5,18,44,51,0,0,0,0,1,254,161,2,16,255,206,2,136,0,15,0,39,64,36,12,11,10,4,3,2,6,0,72,0,0,1,1,0,87,0,0,0,1,95,2,1,1,0,1,79,0,0,0,15,0,14,38,3,9,21,43,0,38,39,55,23,22,22,51,50,54,55,55,23,6,6,35,254,249,81,7,58,11,1,43,37,38,43,2,11,57,7,82,62,2,16,51,44,25,5,39,42,42,39,5,25,43,52,0,2,254,193,2,46,255,177,3,28,0,6,0,22,0,41,64,38,19,17,10,9,5,4,2,1,8,0,72,0,0,1,1,0,87,0,0,0,1,95,2,1,1,0,1,79,7,7,7,22,7,21,45,3,12,21,43,3,39,55,23,23,21,7,6,38,39,55,51,22,22,51,50,54,55,51,23,6,6,35,219,20,82,10,36,99,37,60,12,16,8,12,52,32,32,52,12,8,16,12,60,48,2,144,17,123,1,33,11,96,97,66,48,10,32,34,34,32,10,48,66,0,0,0,0,2,254,193,2,46,255,177,3,28,0,6,0,22,0,42,64,39,19,17,10,9,6,4,3,1,0,9,0,72,0,0,1,1,0,87,0,0,0,1,95,2,1,1,0,1,79,7,7,7,22,7,21,45,3,12,21,43,1,53,55,55,23,7,7,6,38,39,55,51,22,22,51,50,54,55,51,23,6,6,35,254,226,36,10,82,20,9,60,60,12,16,8,12,52,32,32,52,12,8,16,12,60,48,2,239,11,33,1,123,17,1,97,66,48,10,32,34,34,32,10,48,66,0,0,2,254,193,2,46,255,177,3,52,0,23,0,39,0,53,64,50,36,34,27,26,23,22,21,11,8,2,0,1,74,0,1,0,0,2,1,0,103,0,2,3,3,2,87,0,2,2,3,95,4,1,3,2,3,79,24,24,24,39,24,38,46,24,37,5,12,23,43,3,54,54,53,52,38,35,34,6,6,7,39,62,2,55,50,22,21,20,6,7,23,7,6,38,39,55,51,22,22,51,50,54,55,51,23,6,6,35,235,26,21,18,14,12,23,15,2,10,3,20,30,16,35,40,29,25,19,33,36,64,13,16,8,12,50,34,33,51,12,8,16,14,63,43,2,184,19,25,13,10,12,8,8,1,15,3,18,21,5,28,25,15,41,18,32,15,88,61,53,10,31,35,35,31,10,53,61,0,0,0,0,2,254,168,2,46,255,197,3,15,0,25,0,41,0,62,64,59,13,1,1,0,37,36,30,28,25,5,5,2,2,74,12,1,0,72,0,0,0,3,2,0,3,103,6,1,5,0,4,5,4,99,0,2,2,1,95,0,1,1,100,2,76,26,26,26,41,26,40,43,34,24,34,19,7,12,25,43,1,53,55,55,50,23,22,51,50,54,54,55,51,23,21,7,7,34,39,38,35,34,6,6,7,35,22,54,55,51,23,6,6,35,34,38,39,55,51,22,22,51,254,168,66,14,12,54,48,12,9,24,18,3,6,19,66,14,12,54,48,12,9,24,19,2,6,158,51,13,8,16,12,60,48,48,60,12,16,8,13,51,32,2,186,4,68,3,15,14,17,19,3,18,4,68,3,15,14,17,19,3,64,24,22,10,40,54,54,40,10,22,24,0,0,2,254,168,2,16,255,246,3,8,0,6,0,21,0,27,64,24,4,2,2,0,72,21,19,17,15,8,6,6,0,71,0,0,0,98,0,76,27,1,12,21,43,3,55,55,23,23,15,2,39,54,54,55,51,22,22,23,7,7,38,39,6,7,123,59,11,41,2,80,9,231,14,41,85,12,14,12,85,41,14,9,67,55,52,70,2,132,131,1,26,11,108,1,101,22,31,69,11,11,69,31,22,1,39,26,24,41,0,2,254,168,2,16,255,203,3,1,0,6,0,21,0,27,64,24,3,1,2,0,72,21,19,17,15,13,5,6,0,71,0,0,0,98,0,76,25,1,12,21,43,3,39,55,55,23,23,7,6,54,55,51,22,22,23,7,7,38,39,6,7,39,39,86,80,2,41,11,59,24,226,85,12,14,12,85,41,14,9,67,55,52,70,9,14,2,112,108,11,26,1,131,14,41,69,11,11,69,31,22,1,39,26,24,41,1,22,0,0,0,0,2,254,168,2,16,255,233,3,21,0,23,0,38,0,40,64,37,11,1,2,0,1,74,38,36,34,32,30,23,22,21,8,2,71,0,1,0,0,2,1,0,103,0,2,2,98,2,76,26,24,37,3,12,23,43,3,54,54,53,52,38,35,34,6,6,7,39,62,2,55,50,22,21,20,6,7,23,7,6,54,55,51,22,22,23,7,7,38,39,6,7,39,39,120,26,21,18,14,12,23,15,2,10,3,20,30,16,35,40,29,25,19,33,212,85,12,14,12,85,41,14,9,67,55,52,70,9,14,2,153,19,25,13,10,12,8,8,1,15,3,18,21,5,28,25,15,41,18,32,15,33,69,11,11,69,31,22,1,39,26,24,41,1,22,0,0,0,0,2,254,168,2,16,255,202,3,11,0,25,0,40,0,57,64,54,13,1,1,0,25,1,4,2,2,74,12,1,0,72,40,38,36,34,32,5,4,71,0,0,0,3,2,0,3,103,0,2,2,1,95,0,1,1,100,75,0,4,4,98,4,76,23,34,24,34,19,5,12,25,43,1,53,55,55,50,23,22,51,50,54,54,55,51,23,21,7,7,34,39,38,35,34,6,6,7,35,22,54,55,51,22,22,23,7,7,38,39,6,7,39,39,254,170,66,14,12,54,48,12,9,24,18,3,6,19,66,14,12,54,48,12,9,24,19,2,6,20,85,12,14,12,85,41,14,9,67,55,52,70,9,14,2,182,4,68,3,15,14,17,19,3,18,4,68,3,15,14,17,19,3,94,69,11,11,69,31,22,1,39,26,24,41,1,22,0,255,255,0,40,255,244,2,80,3,40,0,34,0,71,0,0,0,3,7,221,2,53,0,0,255,255,0,40,255,244,2,80,3,52,0,34,0,71,0,0,0,3,7,233,2,53,0,0,0,3,0,100,255,197,2,171,2,12,0,15,0,36,0,62,1,109,64,15,54,1,5,4,38,17,2,8,2,37,1,3,8,3,74,75,176,10,80,88,64,68,0,11,6,4,6,11,112,10,1,4,5,6,4,110,0,5,9,6,5,110,0,2,9,8,9,2,8,126,0,0,0,6,11,0,6,101,12,1,9,0,8,3,9,8,103,13,15,7,3,3,1,1,3,85,13,15,7,3,3,3,1,94,14,1,1,3,1,78,27,75,176,14,80,88,64,69,0,11,6,4,6,11,112,10,1,4,5,6,4,110,0,5,9,6,5,9,124,0,2,9,8,9,2,8,126,0,0,0,6,11,0,6,101,12,1,9,0,8,3,9,8,103,13,15,7,3,3,1,1,3,85,13,15,7,3,3,3,1,94,14,1,1,3,1,78,27,75,176,21,80,88,64,70,0,11,6,4,6,11,112,10,1,4,5,6,4,5,124,0,5,9,6,5,9,124,0,2,9,8,9,2,8,126,0,0,0,6,11,0,6,101,12,1,9,0,8,3,9,8,103,13,15,7,3,3,1,1,3,85,13,15,7,3,3,3,1,94,14,1,1,3,1,78,27,64,71,0,11,6,4,6,11,4,126,10,1,4,5,6,4,5,124,0,5,9,6,5,9,124,0,2,9,8,9,2,8,126,0,0,0,6,11,0,6,101,12,1,9,0,8,3,9,8,103,13,15,7,3,3,1,1,3,85,13,15,7,3,3,3,1,94,14,1,1,3,1,78,89,89,89,64,38,16,16,0,0,62,61,57,55,53,52,50,48,47,45,41,39,16,36,16,36,35,34,32,30,28,27,24,23,21,19,0,15,0,13,53,16,9,21,43,22,38,53,17,52,54,51,33,50,22,21,17,20,6,35,33,55,53,52,54,51,50,21,21,51,53,52,38,35,7,6,35,34,53,53,35,17,37,53,6,35,34,38,53,53,52,51,51,53,35,34,53,53,35,7,21,51,50,21,21,20,22,51,141,41,41,39,1,167,39,41,41,39,254,89,85,11,13,43,74,44,34,48,6,3,6,74,1,165,12,14,22,19,10,58,58,10,21,89,26,10,44,34,59,41,39,1,167,39,41,41,39,254,89,39,41,152,180,7,5,56,136,178,32,41,28,4,9,116,254,168,31,25,4,27,30,90,10,36,10,28,56,18,10,132,32,41,0,0,255,255,0,51,255,14,1,230,2,127,0,34,1,66,0,0,0,3,7,186,1,198,0,0,255,255,0,51,255,14,1,230,2,180,0,34,1,66,0,0,0,2,8,9,66,0,0,0,255,255,0,41,255,247,1,243,2,172,0,34,2,75,0,0,1,7,7,186,1,246,0,45,0,8,177,1,2,176,45,176,51,43,0,0,255,255,0,41,255,247,1,243,2,221,0,34,2,75,0,0,1,7,7,201,1,245,0,45,0,8,177,1,1,176,45,176,51,43,0,0,255,255,0,54,1,159,0,131,2,137,0,2,7,22,0,0,0,1,0,0,0,2,0,196,73,144,156,14,95,15,60,245,0,7,3,232,0,0,0,0,214,19,149,124,0,0,0,0,214,19,151,92,254,117,254,219,4,235,3,194,0,0,0,7,0,2,0,1,0,0,0,0,0,1,0,0,3,248,254,167,0,0,5,27,254,117,255,42,4,235,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,60,2,129,255,239,0,198,0,0,0,198,0,0,2,72,255,241,2,72,255,241,2,72,255,241,2,72,255,241,2,72,255,241,2,72,255,241,2,72,255,241,2,72,255,241,2,72,255,241,2,72,255,241,2,72,255,241,2,72,255,241,2,72,255,241,2,72,255,241,2,72,255,241,2,72,255,241,2,72,255,241,2,72,255,241,2,72,255,241,2,72,255,241,2,72,255,241,2,72,255,241,2,72,255,241,2,72,255,241,2,72,255,241,2,72,255,241,3,42,255,246,3,42,255,246,2,85,0,58,2,114,0,40,2,114,0,40,2,114,0,40,2,114,0,40,2,114,0,40,2,114,0,40,2,114,0,40,2,191,0,58,4,247,0,58,2,201,0,9,2,191,0,58,2,201,0,9,2,191,0,58,2,191,0,58,4,139,0,58,2,79,0,58,2,79,0,58,2,79,0,58,2,79,0,58,2,79,0,58,2,79,0,58,2,79,0,58,2,79,0,58,2,79,0,58,2,79,0,58,2,79,0,58,2,79,0,58,2,79,0,58,2,79,0,58,2,79,0,58,2,79,0,58,2,79,0,58,2,79,0,58,2,79,0,58,2,79,0,58,2,79,0,58,2,79,0,58,2,79,0,58,2,0,0,58,2,155,0,40,2,155,0,40,2,155,0,40,2,155,0,40,2,155,0,40,2,155,0,40,2,155,0,40,2,242,0,58,2,238,0,42,2,242,0,58,2,242,0,58,2,242,0,58,1,105,0,56,2,176,0,56,1,105,0,56,1,105,0,56,1,105,0,36,1,105,0,36,1,105,255,244,1,105,0,52,1,105,0,52,1,105,0,56,1,105,0,56,1,105,0,19,1,105,0,56,1,105,0,56,1,105,0,31,1,105,0,56,1,105,0,26,1,71,0,23,1,71,0,23,2,116,0,57,2,116,0,57,1,251,0,68,3,66,0,68,1,251,0,68,1,251,0,68,1,251,0,68,2,21,0,68,1,251,0,68,2,245,0,68,1,251,0,68,2,39,0,61,3,79,0,46,3,79,0,46,2,207,0,54,4,22,0,54,2,207,0,54,2,207,0,54,2,207,0,54,2,207,0,54,2,207,0,54,2,207,0,54,3,201,0,54,2,207,0,54,2,207,0,54,2,180,0,40,2,180,0,40,2,180,0,40,2,180,0,40,2,180,0,40,2,180,0,40,2,180,0,40,2,180,0,40,2,180,0,40,2,180,0,40,2,180,0,40,2,180,0,40,2,180,0,40,2,180,0,40,2,180,0,40,2,180,0,40,2,180,0,40,2,191,0,40,2,191,0,40,2,191,0,40,2,191,0,40,2,191,0,40,2,191,0,40,2,180,0,40,2,180,0,40,2,180,0,40,2,180,0,40,2,180,0,40,2,180,0,40,2,180,0,40,2,180,0,40,2,180,0,40,2,180,0,40,2,180,0,40,2,180,0,40,3,195,0,41,2,39,0,63,2,31,0,56,2,185,0,40,2,99,0,57,2,99,0,57,2,99,0,57,2,99,0,57,2,99,0,57,2,99,0,57,2,99,0,57,2,99,0,57,2,18,0,57,2,18,0,57,2,18,0,57,0,177,0,50,2,18,0,57,2,18,0,57,2,18,0,57,2,18,0,57,2,18,0,57,2,18,0,57,2,18,0,57,2,18,0,57,2,236,0,58,2,160,0,21,2,34,0,9,2,34,0,9,2,34,0,9,2,34,0,9,2,34,0,9,2,34,0,9,2,34,0,9,2,169,0,35,2,169,0,35,2,169,0,35,2,169,0,35,2,169,0,35,2,169,0,35,2,169,0,35,2,169,0,35,2,169,0,35,2,169,0,35,2,169,0,35,2,169,0,35,2,169,0,35,2,169,0,35,2,179,0,35,2,179,0,35,2,179,0,35,2,179,0,35,2,179,0,35,2,179,0,35,2,169,0,35,2,169,0,35,2,169,0,35,2,169,0,35,2,169,0,35,2,169,0,35,2,169,0,35,2,169,0,35,2,98,255,247,3,164,255,249,3,164,255,249,3,164,255,249,3,164,255,249,3,164,255,249,2,144,0,12,2,26,255,237,2,26,255,237,2,26,255,237,2,26,255,237,2,26,255,237,2,26,255,237,2,26,255,237,2,26,255,237,2,26,255,237,2,26,255,237,2,56,0,34,2,56,0,34,2,56,0,34,2,56,0,34,2,56,0,34,2,176,0,56,4,36,0,57,2,159,255,236,2,209,255,236,1,112,255,236,2,29,255,236,3,86,255,236,2,143,255,236,2,198,255,236,1,210,0,41,1,210,0,41,1,210,0,41,1,210,0,41,1,210,0,41,1,210,0,41,1,210,0,41,1,210,0,41,1,210,0,41,1,210,0,41,1,210,0,41,1,210,0,41,1,210,0,41,1,210,0,41,1,210,0,41,1,210,0,41,1,210,0,41,1,210,0,41,1,210,0,41,1,210,0,41,1,210,0,41,1,210,0,41,1,210,0,41,1,210,0,41,1,210,0,41,1,210,0,41,2,141,0,30,2,141,0,30,1,252,0,23,1,168,0,36,1,168,0,36,1,168,0,36,1,168,0,36,1,168,0,36,1,168,0,36,1,168,0,36,2,25,0,36,1,252,0,43,2,59,0,36,2,25,0,36,2,25,0,36,2,25,0,36,3,229,0,36,1,192,0,36,1,192,0,36,1,192,0,36,1,192,0,36,1,192,0,36,1,192,0,36,1,192,0,36,1,192,0,36,1,192,0,36,1,192,0,36,1,192,0,36,1,192,0,36,1,192,0,36,1,192,0,36,1,192,0,36,1,192,0,36,1,192,0,36,1,192,0,36,1,192,0,36,1,192,0,36,1,192,0,36,1,192,0,36,1,192,0,36,1,192,0,42,1,74,0,41,1,245,0,51,1,245,0,51,1,245,0,51,1,245,0,51,1,245,0,51,1,245,0,51,1,245,0,51,2,22,0,25,2,24,0,8,2,22,0,25,2,22,255,246,2,22,0,25,1,26,0,42,1,26,0,42,1,26,0,38,1,26,0,18,1,26,255,244,1,26,255,254,1,26,255,225,1,26,0,18,1,26,0,8,1,26,0,42,1,26,0,42,1,26,0,6,1,26,0,42,1,26,0,17,2,20,0,42,1,26,0,7,1,26,0,38,1,26,255,238,0,250,0,15,0,250,0,15,0,250,255,236,1,241,0,25,1,241,0,25,2,0,0,39,0,244,0,25,0,244,0,25,1,48,0,25,0,244,0,25,1,76,0,25,0,244,0,25,1,238,0,25,0,244,255,236,1,14,0,16,3,64,0,39,3,64,0,39,2,36,0,41,2,50,0,41,2,50,0,41,2,50,0,41,2,36,0,41,2,36,0,41,2,21,0,39,3,30,0,41,2,36,0,41,2,50,0,41,1,242,0,36,1,242,0,36,1,242,0,36,1,242,0,36,1,242,0,36,1,242,0,36,1,242,0,36,1,242,0,36,1,242,0,36,1,242,0,36,1,242,0,36,1,242,0,36,1,242,0,36,1,242,0,36,1,242,0,36,1,242,0,36,1,242,0,36,2,6,0,36,2,6,0,36,2,6,0,36,2,6,0,36,2,6,0,36,2,6,0,36,1,242,0,36,1,242,0,36,1,242,0,36,1,242,0,36,1,242,0,36,1,242,0,36,1,242,0,36,1,242,0,36,1,242,0,36,1,242,0,36,1,242,0,36,1,242,0,36,3,3,0,36,2,16,0,40,1,254,0,21,2,4,0,36,1,127,0,45,1,127,0,45,1,127,0,45,1,127,0,45,1,127,0,45,1,127,0,45,1,127,0,45,1,127,0,10,1,146,0,49,1,146,0,49,1,146,0,49,0,173,0,50,1,146,0,49,1,146,0,49,1,146,0,49,1,146,0,49,1,146,0,49,1,146,0,49,1,146,0,49,1,146,0,49,2,79,0,41,1,74,0,21,1,82,0,21,1,84,0,21,1,74,0,21,1,74,0,21,1,74,0,21,1,74,0,21,1,74,0,21,2,29,0,28,2,29,0,28,2,29,0,28,2,29,0,28,2,29,0,28,2,29,0,28,2,29,0,28,2,29,0,28,2,29,0,28,2,29,0,28,2,29,0,28,2,29,0,28,2,29,0,28,2,29,0,28,2,39,0,28,2,39,0,28,2,39,0,28,2,39,0,28,2,39,0,28,2,39,0,28,2,29,0,28,2,29,0,28,2,29,0,28,2,29,0,28,2,29,0,28,2,29,0,28,2,29,0,28,2,29,0,28,1,189,255,246,2,193,255,252,2,193,255,252,2,193,255,252,2,193,255,252,2,193,255,252,1,219,0,8,1,190,255,247,1,190,255,247,1,190,255,247,1,190,255,247,1,190,255,247,1,190,255,247,1,190,255,247,1,190,255,247,1,190,255,247,1,190,255,247,1,204,0,36,1,204,0,36,1,204,0,36,1,204,0,36,1,204,0,36,1,26,0,41,1,44,0,41,2,20,0,38,1,74,0,41,2,21,255,236,2,84,255,236,1,63,255,236,1,186,255,236,2,203,255,236,2,13,255,236,2,54,255,236,1,64,0,41,3,190,0,36,2,244,0,36,2,56,0,41,2,75,0,41,2,62,0,41,2,220,0,49,3,222,0,9,1,254,0,0,1,254,0,0,1,254,0,0,1,254,0,0,1,254,0,0,1,254,0,0,1,254,0,0,1,254,0,0,1,254,0,0,1,254,0,0,1,254,0,0,1,254,0,0,1,254,0,0,1,254,0,0,1,254,0,0,1,254,0,0,1,254,0,0,1,254,0,0,1,254,0,0,1,254,0,0,1,254,0,0,3,150,0,53,1,254,0,0,1,254,0,0,1,254,0,0,1,254,0,0,1,254,0,0,2,187,0,4,2,187,0,4,2,6,0,54,2,21,0,41,2,21,0,41,2,21,0,41,2,21,0,41,2,21,0,41,2,21,0,41,2,21,0,41,2,84,0,55,2,93,0,18,2,84,0,55,2,93,0,18,2,84,0,55,2,84,0,55,4,62,0,55,1,252,0,54,1,252,0,54,1,252,0,54,1,252,0,54,1,252,0,54,1,252,0,54,1,252,0,54,1,252,0,54,1,252,0,54,1,252,0,54,1,252,0,54,1,252,0,54,1,252,0,54,1,252,0,54,1,252,0,54,1,252,0,54,1,252,0,54,1,252,0,54,1,252,0,54,1,252,0,54,1,252,0,54,1,252,0,54,1,252,0,54,2,51,0,29,1,190,0,54,2,253,0,54,3,120,0,54,2,54,0,41,2,54,0,41,2,54,0,41,2,54,0,41,2,54,0,41,2,54,0,41,2,54,0,41,2,127,0,54,2,127,0,41,2,127,0,54,2,127,0,54,2,127,0,54,1,63,0,53,1,63,0,53,1,63,0,53,2,99,0,53,1,63,0,45,1,63,0,10,1,63,0,23,1,63,255,250,1,63,0,43,1,63,0,33,1,63,0,53,1,63,0,53,1,63,0,35,1,63,0,53,1,63,0,42,2,76,0,53,1,63,0,12,1,63,0,53,1,63,0,9,1,36,0,27,1,36,0,27,1,36,0,8,2,31,0,54,2,31,0,54,2,31,0,54,1,186,0,61,1,186,0,61,1,216,0,61,1,186,0,61,1,234,0,61,1,186,0,61,2,222,0,61,1,186,0,61,1,198,0,68,2,203,0,45,2,203,0,45,2,102,0,51,2,102,0,51,2,102,0,51,2,102,0,51,2,102,0,51,2,102,0,51,2,116,0,52,3,138,0,51,2,102,0,51,2,102,0,51,2,73,0,41,2,73,0,41,2,73,0,41,2,73,0,41,2,73,0,41,2,73,0,41,2,73,0,41,2,73,0,41,2,73,0,41,2,73,0,41,2,73,0,41,2,73,0,41,2,73,0,41,2,73,0,41,2,73,0,41,2,73,0,41,2,73,0,41,2,85,0,41,2,85,0,41,2,85,0,41,2,85,0,41,2,85,0,41,2,85,0,41,2,73,0,41,2,73,0,41,2,73,0,41,2,73,0,41,2,73,0,41,2,73,0,41,2,73,0,41,2,73,0,41,2,73,0,41,2,73,0,41,2,73,0,41,2,73,0,41,3,39,0,42,1,223,0,58,1,217,0,53,2,78,0,41,2,17,0,54,2,17,0,54,2,17,0,54,2,17,0,54,2,17,0,54,2,17,0,54,2,17,0,54,2,17,0,54,1,203,0,53,1,203,0,53,1,203,0,53,1,203,0,53,1,203,0,53,1,203,0,53,1,203,0,53,1,203,0,53,1,203,0,53,1,203,0,53,1,203,0,53,2,134,0,54,1,218,0,17,1,218,0,17,1,218,0,17,1,218,0,17,1,218,0,17,1,218,0,17,1,218,0,17,1,218,0,17,2,63,0,36,2,63,0,36,2,63,0,36,2,63,0,36,2,63,0,36,2,63,0,36,2,63,0,36,2,63,0,36,2,63,0,36,2,63,0,36,2,63,0,36,2,63,0,36,2,63,0,36,2,63,0,36,2,66,0,36,2,66,0,36,2,66,0,36,2,66,0,36,2,66,0,36,2,66,0,36,2,63,0,36,2,63,0,36,2,63,0,36,2,63,0,36,2,63,0,36,2,63,0,36,2,63,0,36,2,63,0,36,2,13,0,4,3,25,0,5,3,25,0,5,3,25,0,5,3,25,0,5,3,25,0,5,2,54,0,20,1,219,255,253,1,219,255,253,1,219,255,253,1,219,255,253,1,219,255,253,1,219,255,253,1,219,255,253,1,219,255,253,1,219,255,253,1,219,255,253,1,234,0,36,1,234,0,36,1,234,0,36,1,234,0,36,1,234,0,36,1,65,0,30,1,82,0,28,1,107,0,17,0,186,0,16,0,181,0,18,1,125,0,29,1,22,0,33,1,225,0,5,1,73,0,12,1,54,255,255,1,65,0,30,1,89,0,15,1,36,0,28,1,106,0,28,1,54,0,28,0,233,0,29,1,87,0,38,1,107,0,17,0,202,0,30,0,186,0,16,1,88,0,18,0,181,0,18,2,41,0,29,1,125,0,29,1,82,0,28,1,103,0,28,1,92,0,28,1,18,0,32,1,22,0,33,0,230,0,17,1,110,0,22,1,55,0,2,1,225,0,5,1,73,0,12,1,54,255,255,1,55,0,26,2,72,255,241,2,84,0,58,2,85,0,58,1,237,0,58,1,237,0,58,1,226,0,58,2,127,0,10,2,79,0,58,2,79,0,58,2,79,0,58,3,145,0,10,2,16,0,74,2,241,0,58,2,241,0,58,2,241,0,58,2,126,0,57,2,126,0,57,2,139,0,13,3,79,0,46,2,242,0,58,2,180,0,40,2,198,0,56,2,39,0,63,2,114,0,40,2,34,0,9,2,66,0,19,2,66,0,19,2,192,0,33,2,144,0,12,2,86,0,11,2,199,0,51,4,41,0,69,4,11,0,52,2,196,0,52,2,38,0,56,2,103,0,9,3,75,0,56,3,84,0,13,3,189,0,58,2,18,0,57,2,105,0,40,2,105,0,73,1,105,0,56,1,105,0,52,1,71,0,23,2,156,0,9,3,232,0,58,2,101,0,8,2,127,0,9,2,169,0,54,3,59,0,10,2,180,0,40,2,89,255,247,2,14,0,61,2,92,0,58,3,190,0,31,2,36,0,74,2,139,0,46,2,172,0,57,2,184,0,9,2,225,0,47,3,117,0,58,2,195,0,48,2,138,0,51,2,26,255,237,2,26,255,237,2,180,0,27,2,100,0,23,2,107,0,11,2,105,0,56,1,105,0,56,3,145,0,10,2,97,0,23,2,72,255,241,2,72,255,241,3,42,255,246,2,79,0,58,2,160,0,21,3,145,0,10,2,16,0,74,2,241,0,58,2,241,0,58,2,180,0,40,2,180,0,40,2,66,0,19,2,66,0,19,2,66,0,19,2,86,0,11,1,255,0,47,3,75,0,56,2,185,0,40,3,164,255,249,2,0,0,58,2,36,0,74,2,114,0,40,1,205,0,39,2,13,0,59,1,219,0,42,1,161,0,44,1,161,0,44,1,123,0,44,1,235,255,253,1,200,0,39,1,200,0,39,1,200,0,39,2,240,0,22,1,173,0,62,2,74,0,44,2,74,0,44,2,74,0,44,2,7,0,44,2,7,0,44,1,241,0,5,2,158,0,38,2,70,0,44,1,250,0,40,2,56,0,44,2,14,0,36,1,177,0,40,1,188,0,20,1,197,255,251,1,197,255,251,2,96,0,36,1,235,0,20,1,223,0,13,2,44,0,47,3,50,0,46,3,54,0,46,2,42,0,47,1,181,0,44,1,235,0,19,2,155,0,45,2,133,0,5,2,220,0,44,1,146,0,49,1,202,0,41,1,202,0,65,1,26,0,42,1,26,0,8,0,250,0,15,2,24,0,8,2,221,0,46,1,227,0,7,2,21,0,14,2,28,0,21,2,145,0,1,1,254,0,39,1,189,255,252,1,173,0,54,1,227,0,44,2,249,0,23,1,173,0,62,2,11,0,44,2,48,0,44,2,86,0,19,2,73,0,44,2,191,0,44,2,56,0,44,1,178,0,40,1,198,255,252,1,198,255,252,1,236,0,20,1,225,0,13,1,254,0,10,2,22,0,25,1,11,0,35,2,240,0,22,1,223,0,13,1,205,0,39,1,205,0,39,2,141,0,30,1,200,0,39,1,192,0,42,2,240,0,22,1,173,0,62,2,74,0,44,2,74,0,44,1,250,0,40,1,254,0,39,1,197,255,251,1,197,255,251,1,197,255,251,1,223,0,13,1,162,0,44,2,155,0,45,2,4,0,36,2,193,255,252,1,129,0,45,1,164,0,44,1,173,0,62,1,177,0,40,1,242,0,39,1,254,0,0,2,6,0,54,2,6,0,54,1,177,0,54,1,177,0,54,1,168,0,54,2,32,0,6,1,252,0,54,1,252,0,54,1,252,0,54,3,13,0,18,1,203,0,68,2,127,0,54,2,127,0,54,2,127,0,54,2,39,0,54,2,39,0,54,2,48,0,20,2,203,0,45,2,127,0,54,2,73,0,41,2,96,0,53,1,223,0,58,2,21,0,41,1,218,0,17,1,219,255,253,1,219,255,253,2,98,0,36,2,54,0,20,2,9,0,19,2,100,0,51,3,130,0,62,3,113,0,51,2,95,0,50,1,227,0,53,2,26,0,17,2,227,0,53,2,220,0,20,3,44,0,54,1,203,0,53,2,16,0,41,2,16,0,68,1,63,0,53,1,63,0,33,1,36,0,27,2,70,0,17,3,75,0,54,2,18,0,16,2,45,0,17,2,76,0,51,2,200,0,18,2,73,0,41,2,9,0,4,1,204,0,58,2,11,0,54,3,37,0,29,1,216,0,68,2,48,0,48,2,78,0,54,2,91,0,17,2,119,0,48,2,240,0,54,2,97,0,48,2,33,0,42,1,219,255,253,1,219,255,253,2,65,0,24,2,11,0,17,2,29,0,19,2,127,0,54,1,63,0,53,3,13,0,18,2,7,0,17,1,254,0,0,1,254,0,0,2,187,0,4,1,252,0,54,2,51,0,29,3,13,0,18,1,203,0,68,2,127,0,54,2,127,0,54,2,73,0,41,2,73,0,41,1,219,255,253,1,219,255,253,1,219,255,253,2,9,0,19,1,184,0,48,2,227,0,53,2,78,0,41,3,25,0,5,1,190,0,54,1,216,0,68,2,21,0,41,2,72,255,241,2,85,0,58,1,237,0,58,2,32,0,11,2,79,0,58,2,56,0,34,2,242,0,58,2,180,0,40,1,105,0,56,2,116,0,57,2,72,255,241,3,79,0,46,2,207,0,54,2,84,0,41,2,180,0,40,2,198,0,56,2,39,0,63,2,44,0,18,2,34,0,9,2,23,255,227,2,192,0,33,2,144,0,12,2,204,0,15,3,33,0,42,2,132,0,45,2,179,0,12,3,86,0,12,1,205,0,12,2,223,255,252,2,183,0,4,3,91,0,41,1,105,0,52,2,23,255,227,2,129,0,57,2,132,0,45,2,132,0,45,2,221,0,45,2,216,0,45,2,229,0,45,2,226,0,45,2,191,0,45,2,192,0,45,2,132,0,45,2,132,0,45,2,72,255,241,2,72,255,241,2,72,255,241,2,132,0,45,2,132,0,45,2,221,0,45,2,216,0,45,2,229,0,45,2,226,0,45,2,191,0,45,2,192,0,45,2,181,0,12,2,187,0,12,3,44,0,12,3,39,0,12,3,52,0,12,3,49,0,12,2,197,0,12,2,179,0,12,3,88,0,12,3,94,0,12,3,207,0,12,3,202,0,12,3,215,0,12,3,212,0,12,3,177,0,12,3,178,0,12,3,104,0,12,3,86,0,12,2,242,0,58,3,88,0,12,3,94,0,12,3,207,0,12,3,202,0,12,3,215,0,12,3,212,0,12,3,177,0,12,3,178,0,12,1,207,0,12,1,213,0,12,2,70,0,12,2,65,0,12,2,78,0,12,2,75,0,12,2,40,0,12,2,41,0,12,1,223,0,12,1,205,0,12,1,105,0,56,1,105,0,31,2,225,255,252,2,231,255,252,3,88,255,252,3,83,255,252,3,96,255,252,3,93,255,252,2,241,255,252,2,223,255,252,2,147,0,12,2,191,0,4,3,43,0,4,3,53,0,4,3,19,0,4,2,201,0,4,2,183,0,4,2,23,255,227,2,23,255,227,3,93,0,41,3,99,0,41,3,212,0,41,3,207,0,41,3,220,0,41,3,217,0,41,3,182,0,41,3,184,0,41,3,109,0,41,3,91,0,41,3,33,0,42,3,93,0,41,3,99,0,41,3,212,0,41,3,207,0,41,3,220,0,41,3,217,0,41,3,182,0,41,3,183,0,41,3,144,0,45,3,159,0,45,3,144,0,45,3,233,0,45,3,228,0,45,3,241,0,45,3,238,0,45,3,203,0,45,3,204,0,45,3,254,0,58,4,100,0,12,4,106,0,12,4,219,0,12,4,214,0,12,4,227,0,12,4,224,0,12,4,189,0,12,4,190,0,12,4,45,0,42,4,105,0,41,4,111,0,41,4,224,0,41,4,219,0,41,4,232,0,41,4,229,0,41,4,194,0,41,4,195,0,41,2,28,0,48,2,3,0,78,1,217,0,18,1,242,0,32,1,165,0,50,1,65,0,45,2,3,0,7,1,203,0,57,1,12,0,75,2,9,0,9,1,204,255,252,2,35,0,75,1,153,0,0,1,118,0,17,1,236,0,41,2,58,0,4,1,244,0,56,1,106,0,43,2,19,0,37,1,162,0,2,1,201,0,11,2,78,0,35,1,250,0,24,2,92,0,12,2,145,0,49,1,12,0,75,1,12,0,11,1,12,255,248,1,201,0,11,1,201,0,11,1,201,0,11,1,236,0,41,2,145,0,49,2,28,0,48,1,165,0,50,2,3,0,7,2,12,0,9,1,203,0,57,2,78,0,35,2,58,0,4,2,9,0,9,2,28,0,48,2,28,0,48,2,28,0,48,2,28,0,48,2,28,0,48,2,28,0,48,2,28,0,48,2,28,0,48,2,28,0,48,2,28,0,48,2,28,0,48,2,28,0,48,2,28,0,48,2,27,0,48,2,27,0,48,2,27,0,48,2,27,0,48,2,27,0,48,2,27,0,48,2,27,0,48,2,27,0,48,2,27,0,48,2,27,0,48,2,27,0,48,2,27,0,48,1,165,0,50,1,165,0,50,1,165,0,50,1,165,0,50,1,165,0,50,1,165,0,50,1,165,0,50,1,165,0,50,2,3,0,7,2,3,0,7,2,3,0,7,2,3,0,7,2,3,0,7,2,3,0,7,2,3,0,7,2,3,0,7,2,3,0,7,2,3,0,7,2,3,0,7,2,4,0,7,2,4,0,7,2,4,0,7,2,4,0,7,2,4,0,7,2,4,0,7,2,4,0,7,2,4,0,7,2,4,0,7,2,4,0,7,2,4,0,7,2,4,0,7,1,12,0,75,1,12,0,68,1,12,0,13,1,12,255,245,1,12,0,26,1,12,0,2,1,12,255,243,1,12,255,242,1,12,0,33,1,12,0,75,1,10,255,222,1,12,0,10,1,12,255,236,1,12,255,244,1,12,255,245,1,12,255,223,1,236,0,41,1,236,0,41,1,236,0,41,1,236,0,41,1,236,0,41,1,236,0,41,1,236,0,41,1,236,0,41,1,244,0,56,1,244,0,56,1,201,0,11,1,201,0,11,1,201,0,11,1,201,0,11,1,201,0,11,1,201,0,11,1,201,0,11,1,201,0,11,1,201,0,11,1,201,0,11,1,201,0,11,1,201,0,11,1,201,0,11,1,201,0,11,1,201,0,11,1,201,0,11,2,145,0,49,2,145,0,49,2,145,0,49,2,145,0,49,2,145,0,49,2,145,0,49,2,145,0,49,2,145,0,49,2,145,0,49,2,145,0,49,2,145,0,49,2,145,0,49,2,145,0,49,2,145,0,49,2,145,0,49,2,145,0,49,2,145,0,49,2,145,0,49,2,145,0,49,2,145,0,49,2,145,0,49,2,145,0,49,2,145,0,49,0,249,0,75,3,89,0,18,3,58,255,252,1,254,0,0,2,6,0,54,1,177,0,54,1,225,0,20,1,252,0,54,1,234,0,36,2,127,0,54,2,73,0,41,1,63,0,53,2,31,0,54,1,254,0,0,2,203,0,45,2,102,0,51,2,3,0,44,2,73,0,41,2,96,0,53,1,223,0,58,1,230,0,26,1,230,0,26,1,218,0,17,1,215,255,246,2,98,0,36,2,54,0,20,2,106,0,23,2,161,0,44,1,63,0,53,1,63,0,41,1,63,0,24,1,215,255,246,1,215,255,246,1,215,255,246,2,73,0,41,2,161,0,44,1,254,0,0,1,252,0,54,2,127,0,54,1,63,0,53,2,35,0,54,1,254,0,0,1,254,0,0,1,254,0,0,1,254,0,0,1,254,0,0,1,254,0,0,1,254,0,0,1,254,0,0,1,254,0,0,1,254,0,0,1,254,0,0,1,254,0,0,1,254,0,0,1,254,0,0,1,254,0,0,1,254,0,0,1,254,0,0,1,254,0,0,1,254,0,0,1,254,0,0,1,254,0,0,1,254,0,0,1,254,0,0,1,254,0,0,1,254,0,0,1,252,0,54,1,252,0,54,1,252,0,54,1,252,0,54,1,252,0,54,1,252,0,54,1,252,0,54,1,252,0,54,2,127,0,54,2,127,0,54,2,127,0,54,2,127,0,54,2,127,0,54,2,127,0,54,2,127,0,54,2,127,0,54,2,127,0,54,2,127,0,54,2,127,0,54,2,127,0,54,2,127,0,54,2,127,0,54,2,127,0,54,2,127,0,54,2,127,0,54,2,127,0,54,2,127,0,54,2,127,0,54,2,127,0,54,2,127,0,54,2,127,0,54,1,63,0,53,1,63,0,53,1,63,0,43,1,63,0,19,1,63,0,53,1,63,0,32,1,63,0,17,1,63,0,16,1,63,0,53,1,63,0,53,1,63,0,12,1,63,0,40,1,63,0,10,1,63,0,20,1,63,0,21,1,63,255,255,2,73,0,41,2,73,0,41,2,73,0,41,2,73,0,41,2,73,0,41,2,73,0,41,2,73,0,41,2,73,0,41,1,223,0,58,1,223,0,58,1,215,255,246,1,215,255,246,1,215,255,246,1,215,255,246,1,215,255,246,1,215,255,246,1,215,255,246,1,215,255,246,1,215,255,246,1,215,255,246,1,215,255,246,1,215,255,246,1,215,255,246,1,215,255,246,1,215,255,246,1,215,255,246,2,161,0,44,2,161,0,44,2,161,0,44,2,161,0,44,2,161,0,44,2,161,0,44,2,161,0,44,2,161,0,44,2,161,0,44,2,161,0,44,2,161,0,44,2,161,0,44,2,161,0,44,2,161,0,44,2,161,0,44,2,161,0,44,2,161,0,44,2,161,0,44,2,161,0,44,2,161,0,44,2,161,0,44,2,161,0,44,2,161,0,44,3,135,255,241,3,195,0,45,3,195,0,45,4,28,0,45,4,23,0,45,4,36,0,45,4,33,0,45,3,254,0,45,3,255,0,45,4,49,0,58,4,151,0,12,4,157,0,12,5,14,0,12,5,9,0,12,5,22,0,12,5,19,0,12,4,240,0,12,4,241,0,12,4,96,0,42,4,156,0,41,4,162,0,41,5,19,0,41,5,14,0,41,5,27,0,41,5,24,0,41,4,245,0,41,4,246,0,41,3,61,0,0,3,61,0,0,3,61,0,0,3,61,0,0,3,61,0,0,3,61,0,0,3,61,0,0,3,61,0,0,3,61,0,0,3,61,0,0,3,61,0,0,3,61,0,0,3,190,0,54,3,190,0,54,3,190,0,54,3,190,0,54,3,190,0,54,3,190,0,54,3,190,0,54,3,190,0,54,3,190,0,54,3,190,0,54,3,190,0,54,3,190,0,54,3,224,0,44,3,224,0,44,3,224,0,44,3,224,0,44,3,224,0,44,3,224,0,44,3,224,0,44,3,224,0,44,3,224,0,44,3,224,0,44,3,224,0,44,3,224,0,44,1,62,0,105,1,162,255,248,1,165,0,29,1,94,0,29,1,145,0,8,1,148,0,29,1,136,0,16,1,254,0,30,1,204,0,21,0,248,0,29,1,186,0,29,1,162,255,248,2,61,0,23,1,237,0,27,1,160,0,27,1,205,0,21,1,234,0,29,1,132,0,32,1,140,0,13,1,126,0,4,1,131,255,243,1,246,0,17,1,203,0,6,1,252,0,9,2,20,0,25,1,106,0,24,1,94,0,41,1,65,0,7,1,82,0,16,1,33,0,26,0,225,0,24,1,93,0,2,1,60,0,31,0,183,0,41,1,99,0,3,1,62,255,255,1,114,0,42,1,24,255,254,1,2,0,2,1,80,0,22,1,132,0,1,1,83,0,28,0,247,0,22,1,100,0,19,1,31,0,0,1,49,0,2,1,140,0,19,1,92,0,10,1,153,0,3,1,185,0,26,2,21,0,38,1,86,0,35,1,219,0,27,1,160,0,23,1,197,0,13,1,174,0,16,1,206,0,50,1,164,0,38,1,229,0,56,1,199,0,35,2,21,0,38,1,98,0,36,1,220,0,26,1,168,0,43,1,189,0,2,1,164,0,31,1,199,0,40,1,164,0,38,1,229,0,56,1,199,0,36,1,96,0,31,0,249,0,27,1,73,0,24,1,37,0,31,1,55,0,10,1,34,0,24,1,56,0,30,1,33,0,29,1,71,0,39,1,56,0,28,1,194,0,23,1,194,0,57,1,194,0,20,1,194,0,51,1,194,0,3,1,194,0,39,1,194,0,39,1,194,0,45,1,194,0,46,1,194,0,35,1,194,0,22,1,194,0,58,1,194,0,21,1,194,0,29,1,194,0,4,1,194,0,21,1,194,0,39,1,194,0,45,1,194,0,46,1,194,0,35,1,96,0,31,0,249,0,27,1,73,0,24,1,96,0,31,0,249,0,27,1,73,0,24,1,37,0,31,1,55,0,10,1,34,0,24,1,56,0,30,1,33,0,29,1,71,0,39,1,56,0,28,1,37,0,31,1,55,0,10,1,34,0,24,1,56,0,30,1,33,0,29,1,71,0,39,1,56,0,28,1,96,0,31,0,249,0,27,1,73,0,24,1,37,0,31,1,55,0,10,1,34,0,24,1,56,0,30,1,33,0,29,1,71,0,39,1,56,0,28,1,96,0,31,0,249,0,27,1,73,0,24,1,37,0,31,1,55,0,10,1,34,0,24,1,56,0,30,1,33,0,29,1,71,0,39,1,56,0,28,1,96,0,31,0,249,0,27,1,73,0,24,1,37,0,31,1,55,0,10,1,34,0,24,1,56,0,30,1,33,0,29,1,71,0,39,1,56,0,28,1,96,0,31,0,249,0,27,1,73,0,24,1,37,0,31,1,55,0,10,1,34,0,24,1,56,0,30,1,33,0,29,1,71,0,39,1,56,0,28,0,125,255,45,2,201,0,27,2,155,0,27,2,235,0,24,2,173,0,27,2,177,0,31,2,189,0,27,2,233,0,31,2,230,0,24,2,229,0,29,1,200,0,68,1,73,0,37,0,238,0,60,1,84,0,60,0,238,0,89,1,38,0,63,2,146,0,93,1,29,0,61,1,29,0,88,1,242,0,11,0,238,0,60,1,49,0,93,1,104,0,58,1,104,0,31,1,42,0,54,0,176,0,54,0,238,0,63,1,73,0,34,1,192,0,93,1,202,255,250,1,73,0,37,0,238,0,60,1,84,0,60,1,73,0,34,1,53,0,46,1,53,0,21,1,53,0,96,1,53,0,25,1,19,0,57,1,18,0,7,1,53,0,46,1,53,0,21,1,53,0,96,1,53,0,25,1,53,0,7,3,150,255,250,2,96,0,68,1,194,0,0,3,150,255,250,1,124,0,64,1,124,0,64,1,124,0,64,3,150,255,250,1,202,0,68,1,68,0,64,1,171,0,24,1,171,0,42,1,5,0,24,1,5,0,42,1,141,0,31,1,75,0,34,1,75,0,21,0,176,0,34,0,176,0,21,0,238,0,63,1,171,0,24,1,171,0,42,1,5,0,24,1,5,0,42,0,247,0,56,0,247,0,69,1,35,0,36,1,35,0,15,1,42,0,54,1,75,0,34,1,75,0,21,0,176,0,34,0,176,0,21,0,176,0,54,0,238,0,60,0,238,0,63,1,194,0,0,0,80,0,0,0,238,0,0,0,198,0,0,0,130,0,0,0,0,0,0,2,21,0,41,1,168,0,36,2,21,0,41,1,219,0,47,1,203,0,53,1,239,0,18,2,76,0,12,1,126,255,203,1,192,0,56,2,54,0,41,1,242,0,39,2,5,0,38,2,13,0,38,1,188,0,34,2,156,0,25,2,150,0,33,5,3,0,63,2,5,0,45,1,203,0,36,1,71,255,236,2,13,0,38,1,214,0,17,2,87,0,85,3,70,0,29,2,20,0,18,0,238,0,60,1,73,0,34,1,250,0,18,1,250,0,18,1,250,0,68,1,250,0,18,1,250,0,18,1,250,0,18,1,250,0,51,1,250,0,31,1,250,0,18,1,250,0,18,1,250,0,18,1,250,0,45,1,250,0,43,1,250,0,18,1,250,0,17,2,154,0,30,1,144,255,238,3,33,0,42,2,32,0,11,2,198,0,56,2,44,0,18,1,250,0,4,1,252,0,43,2,35,0,75,2,159,0,35,3,236,0,35,2,19,0,54,2,19,0,96,2,19,0,44,2,19,0,91,2,19,0,53,2,19,0,97,2,19,0,45,2,19,0,101,2,226,0,45,2,21,0,55,1,188,0,13,1,244,0,13,1,250,0,60,1,168,0,64,1,208,0,64,1,196,0,0,1,156,0,64,1,156,0,94,1,156,0,64,1,156,0,34,1,220,0,64,1,221,0,94,1,220,0,64,1,221,0,34,1,196,255,244,3,64,0,33,2,188,0,55,2,49,0,42,2,0,0,35,2,181,0,42,1,212,0,30,2,51,0,2,1,46,0,25,1,116,0,152,1,116,0,152,1,235,0,32,1,95,255,255,1,235,0,32,3,29,0,40,3,184,0,51,1,250,0,56,2,125,255,243,2,125,0,0,0,176,0,54,1,60,0,54,3,64,0,33,2,167,0,28,0,176,0,54,0,176,0,45,0,0,254,184,0,0,254,184,0,0,254,184,0,0,254,168,0,0,254,164,0,0,255,3,0,0,254,163,0,0,254,185,0,0,254,243,0,0,254,174,0,0,255,21,0,0,254,168,0,0,254,161,0,0,254,193,0,0,254,232,0,0,254,149,0,0,254,149,0,0,254,149,0,0,254,156,0,0,254,164,0,0,254,164,0,0,254,164,0,0,254,223,0,0,254,178,0,0,254,214,0,0,255,114,0,0,255,41,0,0,254,254,0,0,254,184,0,0,254,220,0,0,254,213,0,0,254,206,0,0,254,193,0,0,254,164,0,0,254,117,0,0,254,184,0,0,254,184,0,0,254,164,0,0,255,3,0,0,254,164,0,0,254,163,0,0,254,239,0,0,254,193,0,0,254,168,0,0,254,168,0,0,254,193,0,0,254,232,0,0,254,149,0,0,254,149,0,0,254,149,0,0,254,149,0,0,254,164,0,0,254,164,0,0,254,164,0,0,254,203,0,0,254,117,0,0,254,211,0,176,0,21,0,176,0,34,1,142,0,50,2,88,0,71,0,176,0,54,1,76,0,118,1,76,0,118,1,142,0,129,1,21,0,105,1,21,0,105,1,142,0,129,1,142,0,79,1,142,0,47,1,142,0,99,1,142,0,54,1,142,0,70,1,142,0,145,1,142,0,71,1,106,0,24,1,142,0,50,1,142,0,92,1,142,0,118,1,142,0,45,2,88,0,163,0,0,254,169,0,0,255,106,0,0,254,175,0,0,255,43,1,142,0,173,1,142,0,61,1,142,0,149,1,142,0,145,0,171,0,21,1,142,0,137,1,142,0,139,1,202,0,109,1,202,0,85,1,202,0,98,1,202,0,122,1,202,0,105,1,202,0,98,1,202,0,100,1,202,0,83,1,202,0,83,1,202,0,82,1,202,0,82,1,142,0,57,1,142,0,58,1,202,0,63,1,142,0,105,1,142,0,173,1,132,0,45,1,142,0,45,1,202,0,103,0,0,254,178,0,0,254,161,0,0,254,193,0,0,254,193,0,0,254,193,0,0,254,168,0,0,254,168,0,0,254,168,0,0,254,168,0,0,254,168,2,155,0,40,2,155,0,40,3,15,0,100,1,245,0,51,1,245,0,51,2,54,0,41,2,54,0,41,0,176,0,54,0,0,0,0,0,0,0,0,0,0,0,72,0,0,0,72,0,0,0,72,0,0,1,36,0,0,1,60,0,0,1,84,0,0,1,120,0,0,1,164,0,0,1,200,0,0,1,236,0,0,2,16,0,0,2,40,0,0,2,64,0,0,2,100,0,0,2,132,0,0,2,168,0,0,2,204,0,0,2,240,0,0,3,20,0,0,3,44,0,0,3,68,0,0,3,92,0,0,3,128,0,0,3,164,0,0,3,188,0,0,3,212,0,0,3,236,0,0,4,36,0,0,4,60,0,0,5,236,0,0,6,4,0,0,7,72,0,0,7,248,0,0,8,16,0,0,8,40,0,0,8,64,0,0,8,108,0,0,8,144,0,0,8,168,0,0,9,116,0,0,9,148,0,0,10,140,0,0,10,164,0,0,11,156,0,0,11,180,0,0,11,204,0,0,11,236,0,0,12,220,0,0,12,244,0,0,13,24,0,0,13,48,0,0,13,80,0,0,13,104,0,0,13,140,0,0,13,172,0,0,13,208,0,0,13,244,0,0,14,24,0,0,14,48,0,0,14,72,0,0,14,96,0,0,14,120,0,0,14,144,0,0,14,180,0,0,14,216,0,0,14,240,0,0,15,36,0,0,15,88,0,0,15,112,0,0,15,136,0,0,16,132,0,0,17,104,0,0,17,140,0,0,17,164,0,0,17,200,0,0,17,224,0,0,17,248,0,0,18,16,0,0,19,72,0,0,20,208,0,0,20,232,0,0,21,0,0,0,21,24,0,0,21,184,0,0,21,208,0,0,21,232,0,0,22,12,0,0,22,36,0,0,22,60,0,0,22,96,0,0,22,120,0,0,22,144,0,0,22,168,0,0,22,192,0,0,22,228,0,0,23,8,0,0,23,44,0,0,23,68,0,0,23,92,0,0,23,128,0,0,24,0,0,0,24,36,0,0,25,144,0,0,25,168,0,0,26,136,0,0,26,160,0,0,26,196,0,0,27,204,0,0,27,228,0,0,28,8,0,0,28,32,0,0,28,56,0,0,28,80,0,0,29,88,0,0,30,132,0,0,30,156,0,0,31,132,0,0,31,156,0,0,31,180,0,0,31,204,0,0,31,228,0,0,31,252,0,0,32,20,0,0,33,16,0,0,33,40,0,0,33,64,0,0,33,88,0,0,33,232,0,0,34,0,0,0,34,36,0,0,34,60,0,0,34,84,0,0,34,120,0,0,34,152,0,0,34,188,0,0,34,224,0,0,35,4,0,0,35,40,0,0,35,64,0,0,35,100,0,0,35,152,0,0,35,176,0,0,35,200,0,0,35,236,0,0,36,244,0,0,37,12,0,0,37,36,0,0,37,60,0,0,37,96,0,0,37,120,0,0,37,156,0,0,37,192,0,0,37,216,0,0,38,12,0,0,38,64,0,0,38,88,0,0,39,48,0,0,39,84,0,0,39,108,0,0,39,168,0,0,39,220,0,0,40,16,0,0,41,156,0,0,42,124,0,0,43,132,0,0,44,132,0,0,45,200,0,0,45,224,0,0,45,248,0,0,46,16,0,0,46,52,0,0,46,76,0,0,46,112,0,0,46,136,0,0,47,104,0,0,47,128,0,0,47,172,0,0,47,224,0,0,47,248,0,0,48,36,0,0,48,60,0,0,48,84,0,0,48,108,0,0,48,132,0,0,48,156,0,0,48,188,0,0,50,56,0,0,50,236,0,0,51,152,0,0,51,188,0,0,51,212,0,0,51,236,0,0,52,4,0,0,52,28,0,0,52,52,0,0,53,12,0,0,53,36,0,0,53,72,0,0,53,96,0,0,53,120,0,0,53,156,0,0,53,180,0,0,53,216,0,0,53,252,0,0,54,32,0,0,54,68,0,0,54,92,0,0,54,116,0,0,54,152,0,0,55,184,0,0,55,208,0,0,55,232,0,0,56,0,0,0,56,36,0,0,56,72,0,0,56,108,0,0,56,144,0,0,56,168,0,0,56,212,0,0,57,252,0,0,58,20,0,0,58,56,0,0,58,116,0,0,59,36,0,0,60,56,0,0,60,80,0,0,60,104,0,0,60,128,0,0,60,152,0,0,61,200,0,0,62,216,0,0,62,240,0,0,63,8,0,0,63,32,0,0,63,56,0,0,63,80,0,0,63,104,0,0,63,140,0,0,63,164,0,0,63,188,0,0,64,88,0,0,64,112,0,0,64,136,0,0,64,160,0,0,64,184,0,0,64,236,0,0,65,4,0,0,65,180,0,0,66,92,0,0,66,216,0,0,67,168,0,0,68,136,0,0,69,76,0,0,70,28,0,0,71,60,0,0,71,84,0,0,71,108,0,0,71,144,0,0,71,176,0,0,71,212,0,0,71,248,0,0,72,28,0,0,72,52,0,0,72,76,0,0,72,112,0,0,72,144,0,0,72,180,0,0,72,216,0,0,72,252,0,0,73,20,0,0,73,44,0,0,73,68,0,0,73,92,0,0,73,116,0,0,73,140,0,0,73,164,0,0,75,32,0,0,75,56,0,0,75,112,0,0,75,136,0,0,76,240,0,0,77,8,0,0,77,212,0,0,78,120,0,0,78,144,0,0,78,168,0,0,78,192,0,0,78,224,0,0,79,4,0,0,79,28,0,0,80,16,0,0,80,228,0,0,82,0,0,0,83,20,0,0,83,44,0,0,83,68,0,0,83,100,0,0,84,20,0,0,84,44,0,0,84,68,0,0,84,92,0,0,84,124,0,0,84,148,0,0,84,184,0,0,84,216,0,0,84,252,0,0,85,32,0,0,85,68,0,0,85,92,0,0,85,116,0,0,85,140,0,0,85,164,0,0,85,188,0,0,85,212,0,0,85,236,0,0,86,4,0,0,86,56,0,0,86,108,0,0,87,108,0,0,87,132,0,0,88,52,0,0,89,28,0,0,90,76,0,0,90,100,0,0,90,124,0,0,90,160,0,0,90,196,0,0,90,220,0,0,90,244,0,0,91,220,0,0,93,4,0,0,93,28,0,0,93,64,0,0,93,88,0,0,93,112,0,0,93,252,0,0,94,20,0,0,94,44,0,0,94,68,0,0,94,104,0,0,94,128,0,0,94,164,0,0,94,188,0,0,95,128,0,0,95,160,0,0,95,184,0,0,95,208,0,0,95,232,0,0,96,8,0,0,96,36,0,0,96,68,0,0,96,92,0,0,96,252,0,0,97,92,0,0,97,116,0,0,98,140,0,0,98,164,0,0,99,188,0,0,100,68,0,0,100,104,0,0,101,20,0,0,101,44,0,0,101,80,0,0,101,104,0,0,101,128,0,0,101,152,0,0,102,72,0,0,103,168,0,0,103,192,0,0,104,196,0,0,104,220,0,0,104,244,0,0,105,12,0,0,105,36,0,0,105,60,0,0,106,32,0,0,106,56,0,0,106,80,0,0,106,104,0,0,106,240,0,0,107,8,0,0,107,32,0,0,107,56,0,0,107,80,0,0,107,116,0,0,107,148,0,0,107,184,0,0,107,220,0,0,108,0,0,0,108,24,0,0,108,48,0,0,108,72,0,0,108,128,0,0,108,152,0,0,108,176,0,0,108,200,0,0,109,156,0,0,109,180,0,0,109,204,0,0,109,228,0,0,109,252,0,0,110,20,0,0,110,44,0,0,110,68,0,0,110,92,0,0,110,144,0,0,110,196,0,0,110,220,0,0,111,180,0,0,111,204,0,0,111,228,0,0,112,32,0,0,112,84,0,0,112,140,0,0,113,180,0,0,114,184,0,0,115,164,0,0,116,140,0,0,117,116,0,0,117,140,0,0,117,164,0,0,117,188,0,0,117,212,0,0,117,236,0,0,118,4,0,0,118,28,0,0,118,236,0,0,119,4,0,0,119,56,0,0,119,108,0,0,119,132,0,0,119,188,0,0,119,212,0,0,119,236,0,0,120,4,0,0,120,28,0,0,120,52,0,0,120,84,0,0,121,232,0,0,122,136,0,0,123,100,0,0,124,48,0,0,124,72,0,0,124,96,0,0,124,132,0,0,124,156,0,0,124,180,0,0,125,128,0,0,125,152,0,0,125,176,0,0,125,200,0,0,125,224,0,0,125,248,0,0,126,16,0,0,126,40,0,0,126,64,0,0,126,88,0,0,126,112,0,0,126,136,0,0,126,160,0,0,126,184,0,0,127,176,0,0,127,200,0,0,127,224,0,0,127,248,0,0,128,16,0,0,128,40,0,0,128,64,0,0,128,88,0,0,128,112,0,0,128,164,0,0,129,172,0,0,129,196,0,0,129,220,0,0,130,24,0,0,130,188,0,0,131,184,0,0,131,208,0,0,131,232,0,0,132,0,0,0,132,24,0,0,133,60,0,0,134,4,0,0,134,28,0,0,134,52,0,0,134,76,0,0,134,100,0,0,134,124,0,0,134,148,0,0,134,172,0,0,134,196,0,0,134,220,0,0,135,116,0,0,135,140,0,0,135,164,0,0,135,188,0,0,135,212,0,0,136,108,0,0,137,84,0,0,137,124,0,0,138,100,0,0,139,116,0,0,140,92,0,0,140,212,0,0,141,112,0,0,142,104,0,0,143,48,0,0,144,16,0,0,144,244,0,0,146,240,0,0,148,56,0,0,149,68,0,0,150,120,0,0,151,156,0,0,153,16,0,0,154,104,0,0,155,68,0,0,155,104,0,0,155,140,0,0,155,176,0,0,155,220,0,0,156,0,0,0,156,36,0,0,156,72,0,0,156,108,0,0,156,144,0,0,156,180,0,0,156,224,0,0,157,4,0,0,157,40,0,0,157,76,0,0,157,112,0,0,157,148,0,0,157,172,0,0,157,208,0,0,157,244,0,0,158,24,0,0,158,48,0,0,158,84,0,0,158,124,0,0,158,160,0,0,158,216,0,0,158,252,0,0,160,88,0,0,160,124,0,0,161,176,0,0,162,140,0,0,162,176,0,0,162,212,0,0,162,236,0,0,163,24,0,0,163,60,0,0,163,96,0,0,165,24,0,0,167,52,0,0,167,88,0,0,169,116,0,0,169,140,0,0,169,164,0,0,169,208,0,0,170,212,0,0,170,248,0,0,171,28,0,0,171,64,0,0,171,108,0,0,171,144,0,0,171,168,0,0,171,212,0,0,171,248,0,0,172,28,0,0,172,64,0,0,172,100,0,0,172,136,0,0,172,172,0,0,172,196,0,0,172,232,0,0,173,12,0,0,173,48,0,0,173,84,0,0,173,136,0,0,173,188,0,0,173,224,0,0,174,4,0,0,175,52,0,0,176,44,0,0,176,68,0,0,176,92,0,0,177,104,0,0,177,140,0,0,177,176,0,0,177,212,0,0,177,236,0,0,178,16,0,0,178,52,0,0,179,104,0,0,180,232,0,0,181,0,0,0,181,36,0,0,181,60,0,0,181,228,0,0,182,140,0,0,182,176,0,0,182,236,0,0,183,16,0,0,183,52,0,0,183,88,0,0,183,124,0,0,183,160,0,0,183,196,0,0,183,232,0,0,184,0,0,0,184,36,0,0,184,72,0,0,184,108,0,0,184,132,0,0,184,168,0,0,184,204,0,0,184,236,0,0,185,104,0,0,185,228,0,0,186,8,0,0,187,132,0,0,187,156,0,0,188,240,0,0,189,164,0,0,189,200,0,0,190,168,0,0,190,192,0,0,190,228,0,0,190,252,0,0,191,20,0,0,191,44,0,0,192,4,0,0,193,48,0,0,193,72,0,0,194,36,0,0,194,72,0,0,194,108,0,0,194,132,0,0,194,168,0,0,194,192,0,0,195,180,0,0,195,204,0,0,195,228,0,0,196,8,0,0,196,180,0,0,196,216,0,0,196,252,0,0,197,32,0,0,197,68,0,0,197,104,0,0,197,148,0,0,197,184,0,0,197,220,0,0,198,0,0,0,198,36,0,0,198,72,0,0,198,108,0,0,198,160,0,0,198,184,0,0,198,220,0,0,199,0,0,0,200,0,0,0,200,36,0,0,200,60,0,0,200,96,0,0,200,132,0,0,200,168,0,0,200,204,0,0,200,240,0,0,201,20,0,0,201,72,0,0,201,124,0,0,201,148,0,0,202,140,0,0,202,176,0,0,202,212,0,0,203,16,0,0,203,68,0,0,203,120,0,0,204,228,0,0,205,180,0,0,206,164,0,0,207,152,0,0,208,244,0,0,209,24,0,0,209,60,0,0,209,84,0,0,209,120,0,0,209,144,0,0,209,180,0,0,209,204,0,0,210,204,0,0,210,240,0,0,211,36,0,0,211,72,0,0,211,124,0,0,211,148,0,0,211,184,0,0,211,208,0,0,211,244,0,0,212,12,0,0,212,56,0,0,213,172,0,0,214,112,0,0,215,104,0,0,215,140,0,0,215,164,0,0,215,188,0,0,215,224,0,0,215,248,0,0,216,16,0,0,216,252,0,0,217,32,0,0,217,68,0,0,217,104,0,0,217,140,0,0,217,176,0,0,217,212,0,0,217,248,0,0,218,28,0,0,218,64,0,0,218,100,0,0,218,124,0,0,218,160,0,0,218,196,0,0,219,212,0,0,219,248,0,0,220,16,0,0,220,52,0,0,220,88,0,0,220,120,0,0,220,156,0,0,220,192,0,0,220,228,0,0,221,24,0,0,222,68,0,0,222,104,0,0,222,136,0,0,222,196,0,0,223,120,0,0,224,144,0,0,224,180,0,0,224,216,0,0,224,252,0,0,225,32,0,0,226,96,0,0,227,92,0,0,227,128,0,0,227,164,0,0,227,200,0,0,227,236,0,0,228,4,0,0,228,40,0,0,228,76,0,0,228,112,0,0,228,148,0,0,229,44,0,0,229,80,0,0,229,116,0,0,229,152,0,0,229,176,0,0,230,180,0,0,231,112,0,0,232,148,0,0,233,48,0,0,233,176,0,0,234,204,0,0,235,232,0,0,236,248,0,0,238,64,0,0,239,44,0,0,240,12,0,0,240,212,0,0,241,124,0,0,242,100,0,0,243,20,0,0,243,232,0,0,245,28,0,0,246,24,0,0,246,212,0,0,247,108,0,0,248,108,0,0,248,236,0,0,250,60,0,0,251,52,0,0,251,176,0,0,252,156,0,0,253,104,0,0,254,80,0,0,255,28,0,0,255,188,0,1,0,140,0,1,1,36,0,1,2,16,0,1,3,48,0,1,3,248,0,1,4,128,0,1,4,144,0,1,5,204,0,1,5,220,0,1,5,236,0,1,6,4,0,1,6,220,0,1,7,204,0,1,7,220,0,1,7,244,0,1,8,24,0,1,10,16,0,1,10,232,0,1,12,36,0,1,12,72,0,1,12,108,0,1,13,236,0,1,14,4,0,1,14,216,0,1,14,232,0,1,14,248,0,1,15,8,0,1,15,24,0,1,15,40,0,1,15,56,0,1,15,72,0,1,16,28,0,1,16,64,0,1,16,80,0,1,16,96,0,1,17,88,0,1,18,72,0,1,19,128,0,1,20,192,0,1,21,208,0,1,22,220,0,1,23,236,0,1,25,192,0,1,26,248,0,1,28,196,0,1,28,212,0,1,29,156,0,1,30,104,0,1,30,120,0,1,30,144,0,1,30,160,0,1,31,172,0,1,33,28,0,1,34,40,0,1,35,36,0,1,36,80,0,1,38,88,0,1,39,8,0,1,39,236,0,1,40,208,0,1,41,208,0,1,43,204,0,1,44,184,0,1,46,148,0,1,48,80,0,1,49,212,0,1,51,112,0,1,52,184,0,1,54,12,0,1,54,204,0,1,54,220,0,1,55,0,0,1,56,40,0,1,57,92,0,1,58,128,0,1,59,128,0,1,59,144,0,1,59,180,0,1,61,20,0,1,61,56,0,1,61,80,0,1,61,96,0,1,61,132,0,1,61,148,0,1,61,172,0,1,61,196,0,1,61,220,0,1,61,244,0,1,62,12,0,1,62,28,0,1,62,52,0,1,62,76,0,1,62,112,0,1,62,136,0,1,63,76,0,1,63,112,0,1,63,128,0,1,63,144,0,1,63,160,0,1,63,176,0,1,63,200,0,1,63,216,0,1,64,148,0,1,65,136,0,1,66,108,0,1,66,132,0,1,67,52,0,1,68,28,0,1,68,44,0,1,68,68,0,1,68,92,0,1,69,216,0,1,70,180,0,1,71,196,0,1,71,220,0,1,71,244,0,1,73,88,0,1,73,112,0,1,74,40,0,1,75,36,0,1,76,72,0,1,76,88,0,1,77,52,0,1,77,68,0,1,77,84,0,1,78,8,0,1,78,24,0,1,78,48,0,1,79,56,0,1,79,72,0,1,80,64,0,1,81,56,0,1,82,116,0,1,83,196,0,1,84,200,0,1,85,148,0,1,86,120,0,1,86,144,0,1,87,140,0,1,89,16,0,1,89,32,0,1,89,244,0,1,90,188,0,1,90,212,0,1,90,236,0,1,90,252,0,1,91,12,0,1,92,60,0,1,93,112,0,1,94,128,0,1,95,160,0,1,97,0,0,1,97,16,0,1,97,168,0,1,98,208,0,1,100,4,0,1,101,148,0,1,102,128,0,1,103,160,0,1,105,56,0,1,107,36,0,1,108,80,0,1,109,200,0,1,110,188,0,1,111,108,0,1,112,76,0,1,112,112,0,1,113,152,0,1,114,164,0,1,115,188,0,1,115,204,0,1,116,96,0,1,116,120,0,1,117,136,0,1,117,160,0,1,117,184,0,1,117,200,0,1,117,224,0,1,117,240,0,1,118,8,0,1,118,32,0,1,118,56,0,1,118,80,0,1,118,104,0,1,119,20,0,1,119,44,0,1,119,68,0,1,119,92,0,1,119,116,0,1,120,160,0,1,120,192,0,1,120,208,0,1,120,224,0,1,121,172,0,1,122,184,0,1,122,200,0,1,122,224,0,1,123,152,0,1,123,168,0,1,126,48,0,1,126,64,0,1,126,80,0,1,126,116,0,1,128,28,0,1,129,0,0,1,129,16,0,1,129,52,0,1,129,88,0,1,131,132,0,1,132,144,0,1,133,192,0,1,133,228,0,1,134,8,0,1,135,188,0,1,135,224,0,1,136,168,0,1,136,184,0,1,136,200,0,1,136,216,0,1,136,232,0,1,136,248,0,1,137,8,0,1,137,24,0,1,137,40,0,1,137,76,0,1,137,92,0,1,137,108,0,1,138,92,0,1,139,80,0,1,140,128,0,1,141,192,0,1,142,200,0,1,143,212,0,1,144,172,0,1,146,72,0,1,147,128,0,1,149,12,0,1,149,28,0,1,149,228,0,1,150,172,0,1,150,188,0,1,150,224,0,1,150,240,0,1,152,0,0,1,154,176,0,1,156,12,0,1,157,8,0,1,158,52,0,1,159,204,0,1,160,160,0,1,161,72,0,1,163,120,0,1,165,192,0,1,168,240,0,1,170,16,0,1,172,196,0,1,174,168,0,1,176,104,0,1,177,252,0,1,180,176,0,1,181,168,0,1,182,104,0,1,182,120,0,1,182,156,0,1,183,224,0,1,185,12,0,1,186,40,0,1,186,56,0,1,186,72,0,1,186,108,0,1,187,212,0,1,187,248,0,1,188,28,0,1,188,44,0,1,188,80,0,1,188,96,0,1,188,132,0,1,188,168,0,1,188,204,0,1,188,240,0,1,189,20,0,1,189,36,0,1,189,72,0,1,189,108,0,1,189,144,0,1,189,180,0,1,191,156,0,1,191,192,0,1,191,208,0,1,191,224,0,1,191,240,0,1,192,0,0,1,192,24,0,1,192,40,0,1,192,56,0,1,192,236,0,1,193,80,0,1,193,96,0,1,193,112,0,1,193,128,0,1,194,84,0,1,194,100,0,1,194,116,0,1,195,36,0,1,195,52,0,1,195,68,0,1,196,128,0,1,196,144,0,1,197,200,0,1,197,216,0,1,198,120,0,1,198,136,0,1,199,68,0,1,200,164,0,1,200,180,0,1,201,224,0,1,202,176,0,1,202,212,0,1,202,248,0,1,203,28,0,1,203,64,0,1,203,100,0,1,203,140,0,1,203,176,0,1,203,212,0,1,203,248,0,1,205,140,0,1,205,176,0,1,205,212,0,1,205,248,0,1,206,28,0,1,206,64,0,1,206,100,0,1,206,136,0,1,206,172,0,1,206,208,0,1,206,244,0,1,207,12,0,1,207,48,0,1,207,72,0,1,207,116,0,1,207,160,0,1,207,204,0,1,207,248,0,1,208,36,0,1,208,80,0,1,208,124,0,1,208,168,0,1,208,204,0,1,208,240,0,1,209,20,0,1,209,56,0,1,209,92,0,1,209,128,0,1,209,164,0,1,209,200,0,1,209,236,0,1,210,16,0,1,210,52,0,1,210,88,0,1,210,124,0,1,210,160,0,1,210,196,0,1,210,232,0,1,211,12,0,1,211,48,0,1,211,72,0,1,211,116,0,1,211,160,0,1,211,204,0,1,211,248,0,1,212,36,0,1,212,80,0,1,212,124,0,1,212,168,0,1,212,204,0,1,212,240,0,1,213,20,0,1,213,56,0,1,213,92,0,1,213,128,0,1,213,164,0,1,213,200,0,1,213,236,0,1,214,16,0,1,214,52,0,1,214,76,0,1,214,112,0,1,214,148,0,1,214,184,0,1,214,220,0,1,215,0,0,1,215,36,0,1,215,72,0,1,215,108,0,1,215,144,0,1,215,184,0,1,215,220,0,1,216,0,0,1,216,36,0,1,216,72,0,1,216,112,0,1,216,148,0,1,216,172,0,1,216,208,0,1,216,244,0,1,217,24,0,1,217,60,0,1,217,96,0,1,217,132,0,1,217,168,0,1,217,204,0,1,217,240,0,1,218,20,0,1,218,44,0,1,218,88,0,1,218,132,0,1,218,176,0,1,218,220,0,1,219,8,0,1,219,52,0,1,219,96,0,1,219,140,0,1,219,164,0,1,219,208,0,1,219,252,0,1,220,40,0,1,220,84,0,1,220,128,0,1,220,172,0,1,220,216,0,1,221,4,0,1,221,28,0,1,221,72,0,1,221,116,0,1,221,160,0,1,221,204,0,1,221,248,0,1,222,36,0,1,222,80,0,1,222,124,0,1,222,148,0,1,222,192,0,1,222,236,0,1,223,24,0,1,223,68,0,1,223,112,0,1,223,156,0,1,223,200,0,1,223,244,0,1,224,196,0,1,225,176,0,1,226,76,0,1,227,44,0,1,227,244,0,1,228,200,0,1,229,124,0,1,230,140,0,1,230,252,0,1,231,180,0,1,232,88,0,1,233,40,0,1,233,184,0,1,234,148,0,1,235,28,0,1,235,220,0,1,236,128,0,1,237,12,0,1,237,172,0,1,238,76,0,1,238,248,0,1,239,176,0,1,240,128,0,1,241,96,0,1,242,40,0,1,242,64,0,1,242,100,0,1,242,124,0,1,242,148,0,1,242,172,0,1,242,196,0,1,242,220,0,1,242,244,0,1,243,12,0,1,243,36,0,1,243,60,0,1,244,36,0,1,244,52,0,1,244,68,0,1,244,84,0,1,244,100,0,1,244,124,0,1,244,148,0,1,244,172,0,1,244,196,0,1,244,220,0,1,244,244,0,1,245,12,0,1,245,36,0,1,245,60,0,1,245,84,0,1,245,120,0,1,245,144,0,1,245,168,0,1,245,192,0,1,245,224,0,1,246,0,0,1,246,32,0,1,246,64,0,1,246,96,0,1,246,128,0,1,246,160,0,1,246,192,0,1,246,224,0,1,247,0,0,1,247,44,0,1,247,68,0,1,247,92,0,1,247,116,0,1,247,140,0,1,247,164,0,1,247,188,0,1,247,212,0,1,247,236,0,1,248,4,0,1,248,28,0,1,248,52,0,1,248,76,0,1,248,100,0,1,248,124,0,1,248,148,0,1,248,172,0,1,248,196,0,1,248,220,0,1,249,0,0,1,249,24,0,1,249,56,0,1,249,88,0,1,249,120,0,1,249,152,0,1,249,184,0,1,249,216,0,1,249,248,0,1,250,24,0,1,250,56,0,1,250,88,0,1,250,132,0,1,250,156,0,1,250,180,0,1,250,204,0,1,250,228,0,1,250,252,0,1,251,20,0,1,251,44,0,1,251,68,0,1,251,92,0,1,251,116,0,1,251,152,0,1,251,176,0,1,251,200,0,1,251,224,0,1,251,248,0,1,252,16,0,1,252,40,0,1,252,64,0,1,252,88,0,1,252,112,0,1,252,136,0,1,252,160,0,1,252,184,0,1,252,208,0,1,252,232,0,1,253,0,0,1,253,24,0,1,253,48,0,1,253,72,0,1,253,96,0,1,253,120,0,1,253,144,0,1,253,168,0,1,253,192,0,1,253,216,0,1,253,240,0,1,254,20,0,1,254,44,0,1,254,68,0,1,254,92,0,1,254,116,0,1,254,140,0,1,254,164,0,1,254,188,0,1,254,212,0,1,254,236,0,1,255,4,0,1,255,28,0,1,255,52,0,1,255,76,0,1,255,100,0,1,255,124,0,1,255,160,0,1,255,184,0,1,255,216,0,1,255,248,0,2,0,24,0,2,0,56,0,2,0,88,0,2,0,120,0,2,0,152,0,2,0,184,0,2,0,216,0,2,0,248,0,2,1,36,0,2,1,156,0,2,2,152,0,2,3,152,0,2,3,168,0,2,3,184,0,2,5,104,0,2,5,204,0,2,5,220,0,2,5,236,0,2,5,252,0,2,6,240,0,2,7,0,0,2,7,16,0,2,7,196,0,2,7,212,0,2,7,228,0,2,9,20,0,2,9,36,0,2,10,12,0,2,10,28,0,2,10,44,0,2,10,200,0,2,10,216,0,2,11,144,0,2,12,216,0,2,12,232,0,2,13,252,0,2,14,192,0,2,14,224,0,2,15,4,0,2,15,36,0,2,15,68,0,2,15,104,0,2,15,136,0,2,15,168,0,2,15,204,0,2,15,236,0,2,16,12,0,2,16,44,0,2,16,204,0,2,18,144,0,2,18,176,0,2,18,208,0,2,18,240,0,2,19,16,0,2,19,48,0,2,19,80,0,2,19,112,0,2,19,144,0,2,19,176,0,2,19,208,0,2,19,240,0,2,20,20,0,2,20,56,0,2,20,80,0,2,20,120,0,2,20,160,0,2,20,200,0,2,20,240,0,2,21,24,0,2,21,64,0,2,21,104,0,2,21,144,0,2,21,184,0,2,21,224,0,2,22,8,0,2,22,40,0,2,22,72,0,2,22,104,0,2,22,136,0,2,22,168,0,2,22,200,0,2,22,232,0,2,23,8,0,2,23,40,0,2,23,72,0,2,23,104,0,2,23,136,0,2,23,168,0,2,23,200,0,2,23,232,0,2,24,8,0,2,24,40,0,2,24,72,0,2,24,104,0,2,24,128,0,2,24,168,0,2,24,208,0,2,24,248,0,2,25,32,0,2,25,72,0,2,25,112,0,2,25,152,0,2,25,192,0,2,25,232,0,2,26,16,0,2,26,56,0,2,26,88,0,2,26,120,0,2,26,152,0,2,26,184,0,2,26,216,0,2,26,248,0,2,27,24,0,2,27,56,0,2,27,88,0,2,27,120,0,2,27,152,0,2,27,188,0,2,27,224,0,2,28,0,0,2,28,32,0,2,28,64,0,2,28,96,0,2,28,128,0,2,28,160,0,2,28,192,0,2,28,224,0,2,29,0,0,2,29,32,0,2,29,64,0,2,29,96,0,2,29,128,0,2,29,160,0,2,29,192,0,2,29,224,0,2,30,0,0,2,30,32,0,2,30,64,0,2,30,96,0,2,30,128,0,2,30,160,0,2,30,192,0,2,30,224,0,2,31,4,0,2,31,40,0,2,31,72,0,2,31,104,0,2,31,136,0,2,31,172,0,2,31,208,0,2,31,240,0,2,32,16,0,2,32,48,0,2,32,80,0,2,32,112,0,2,32,144,0,2,32,180,0,2,32,216,0,2,32,252,0,2,33,20,0,2,33,64,0,2,33,108,0,2,33,152,0,2,33,196,0,2,33,236,0,2,34,20,0,2,34,60,0,2,34,100,0,2,34,140,0,2,34,180,0,2,34,224,0,2,34,248,0,2,35,36,0,2,35,80,0,2,35,124,0,2,35,168,0,2,35,212,0,2,36,0,0,2,36,44,0,2,36,88,0,2,36,112,0,2,36,156,0,2,36,200,0,2,36,244,0,2,37,32,0,2,37,76,0,2,37,120,0,2,37,164,0,2,37,208,0,2,37,232,0,2,38,20,0,2,38,64,0,2,38,108,0,2,38,152,0,2,38,196,0,2,38,240,0,2,39,28,0,2,39,72,0,2,39,96,0,2,39,136,0,2,39,176,0,2,39,216,0,2,40,0,0,2,40,40,0,2,40,80,0,2,40,120,0,2,40,160,0,2,40,200,0,2,40,240,0,2,41,24,0,2,41,48,0,2,41,88,0,2,41,128,0,2,41,168,0,2,41,208,0,2,41,248,0,2,42,32,0,2,42,72,0,2,42,112,0,2,42,152,0,2,42,192,0,2,42,232,0,2,43,0,0,2,43,44,0,2,43,88,0,2,43,132,0,2,43,176,0,2,43,216,0,2,44,0,0,2,44,40,0,2,44,80,0,2,44,120,0,2,44,160,0,2,44,204,0,2,44,224,0,2,45,196,0,2,46,196,0,2,47,180,0,2,48,24,0,2,49,12,0,2,49,160,0,2,50,188,0,2,51,120,0,2,52,8,0,2,53,20,0,2,53,204,0,2,54,232,0,2,55,204,0,2,56,188,0,2,57,56,0,2,58,24,0,2,58,232,0,2,59,132,0,2,60,44,0,2,60,232,0,2,61,252,0,2,63,44,0,2,64,60,0,2,65,48,0,2,66,0,0,2,67,16,0,2,67,156,0,2,68,116,0,2,69,60,0,2,69,248,0,2,70,148,0,2,71,68,0,2,71,168,0,2,72,108,0,2,73,8,0,2,74,96,0,2,74,232,0,2,75,188,0,2,76,64,0,2,76,244,0,2,77,132,0,2,78,20,0,2,78,172,0,2,79,72,0,2,79,252,0,2,80,176,0,2,81,152,0,2,82,112,0,2,83,48,0,2,83,184,0,2,84,92,0,2,85,8,0,2,85,208,0,2,86,96,0,2,87,12,0,2,87,188,0,2,88,60,0,2,89,12,0,2,89,196,0,2,90,76,0,2,90,252,0,2,91,168,0,2,92,112,0,2,93,0,0,2,93,176,0,2,94,100,0,2,94,228,0,2,95,180,0,2,96,96,0,2,96,112,0,2,96,128,0,2,96,144,0,2,96,160,0,2,96,176,0,2,96,192,0,2,96,208,0,2,96,224,0,2,96,240,0,2,97,0,0,2,97,136,0,2,98,112,0,2,99,28,0,2,99,228,0,2,100,116,0,2,101,36,0,2,101,216,0,2,102,80,0,2,103,28,0,2,103,200,0,2,104,76,0,2,105,52,0,2,105,224,0,2,106,168,0,2,107,56,0,2,107,228,0,2,108,152,0,2,109,16,0,2,109,220,0,2,110,132,0,2,110,148,0,2,110,164,0,2,110,180,0,2,111,48,0,2,111,208,0,2,112,100,0,2,113,32,0,2,113,156,0,2,114,156,0,2,115,64,0,2,115,172,0,2,116,104,0,2,117,0,0,2,117,16,0,2,117,32,0,2,117,48,0,2,117,64,0,2,117,80,0,2,117,96,0,2,117,112,0,2,117,236,0,2,118,140,0,2,119,32,0,2,119,216,0,2,120,92,0,2,121,52,0,2,121,216,0,2,122,72,0,2,123,4,0,2,123,160,0,2,124,28,0,2,124,192,0,2,125,84,0,2,126,12,0,2,126,144,0,2,127,104,0,2,128,20,0,2,128,128,0,2,129,60,0,2,129,216,0,2,130,84,0,2,130,244,0,2,131,136,0,2,132,104,0,2,132,236,0,2,133,196,0,2,134,104,0,2,134,216,0,2,135,148,0,2,136,52,0,2,136,68,0,2,136,84,0,2,136,100,0,2,136,116,0,2,136,132,0,2,136,148,0,2,136,164,0,2,136,180,0,2,136,196,0,2,136,212,0,2,137,24,0,2,137,56,0,2,137,88,0,2,137,120,0,2,137,152,0,2,137,184,0,2,137,216,0,2,137,248,0,2,138,24,0,2,138,56,0,2,139,44,0,2,139,120,0,2,139,196,0,2,140,16,0,2,140,52,0,2,140,128,0,2,140,160,0,2,141,4,0,2,141,108,0,2,142,84,0,2,142,152,0,2,142,220,0,2,143,128,0,2,144,48,0,2,144,72,0,2,144,128,0,2,144,164,0,2,144,240,0,2,145,8,0,2,145,96,0,2,145,124,0,2,145,152,0,2,145,180,0,2,145,208,0,2,146,172,0,2,147,136,0,2,147,228,0,2,148,60,0,2,148,140,0,2,148,220,0,2,148,248,0,2,149,20,0,2,149,48,0,2,149,76,0,2,149,104,0,2,149,188,0,2,150,4,0,2,150,88,0,2,150,104,0,2,150,152,0,2,150,168,0,2,150,184,0,2,150,212,0,2,150,240,0,2,151,12,0,2,151,36,0,2,151,60,0,2,151,120,0,2,151,180,0,2,152,52,0,2,152,76,0,2,152,100,0,2,152,184,0,2,153,8,0,2,153,24,0,2,153,68,0,2,153,112,0,2,153,140,0,2,153,168,0,2,154,56,0,2,154,88,0,2,155,40,0,2,155,72,0,2,155,120,0,2,155,168,0,2,155,216,0,2,155,248,0,2,156,24,0,2,156,56,0,2,156,84,0,2,156,120,0,2,156,120,0,2,156,120,0,2,156,120,0,2,156,120,0,2,156,120,0,2,156,120,0,2,157,92,0,2,158,52,0,2,159,96,0,2,160,60,0,2,161,92,0,2,162,160,0,2,163,176,0,2,164,164,0,2,165,216,0,2,166,244,0,2,168,28,0,2,169,152,0,2,170,196,0,2,171,152,0,2,172,16,0,2,173,172,0,2,173,204,0,2,175,108,0,2,176,104,0,2,177,40,0,2,178,56,0,2,179,72,0,2,180,92,0,2,182,76,0,2,183,164,0,2,183,180,0,2,183,196,0,2,184,60,0,2,184,136,0,2,184,228,0,2,185,144,0,2,186,8,0,2,186,244,0,2,187,76,0,2,187,164,0,2,188,72,0,2,188,228,0,2,189,144,0,2,190,144,0,2,191,40,0,2,191,144,0,2,192,104,0,2,193,64,0,2,193,232,0,2,193,248,0,2,194,8,0,2,194,24,0,2,194,40,0,2,194,148,0,2,195,64,0,2,195,80,0,2,196,108,0,2,197,228,0,2,198,76,0,2,198,188,0,2,199,44,0,2,199,156,0,2,200,0,0,2,200,116,0,2,200,228,0,2,201,80,0,2,201,228,0,2,202,124,0,2,202,156,0,2,202,204,0,2,203,68,0,2,203,120,0,2,203,204,0,2,203,252,0,2,204,32,0,2,204,64,0,2,204,104,0,2,204,136,0,2,204,208,0,2,205,0,0,2,205,68,0,2,205,112,0,2,205,200,0,2,206,244,0,2,208,56,0,2,209,0,0,2,210,4,0,2,211,60,0,2,212,224,0,2,214,136,0,2,215,12,0,2,215,72,0,2,215,144,0,2,216,40,0,2,216,208,0,2,217,180,0,2,218,136,0,2,218,172,0,2,219,28,0,2,219,116,0,2,219,168,0,2,219,184,0,2,219,208,0,2,219,236,0,2,222,52,0,2,222,68,0,2,222,124,0,2,222,252,0,2,223,148,0,2,224,48,0,2,224,220,0,2,225,168,0,2,225,252,0,2,226,40,0,2,226,96,0,2,226,152,0,2,226,244,0,2,227,44,0,2,227,136,0,2,227,224,0,2,228,72,0,2,228,204,0,2,229,92,0,2,229,136,0,2,229,188,0,2,229,232,0,2,230,64,0,2,230,108,0,2,230,152,0,2,231,16,0,2,231,108,0,2,231,212,0,2,231,232,0,2,232,80,0,2,232,164,0,2,232,196,0,2,233,28,0,2,233,168,0,2,234,36,0,2,234,140,0,2,234,228,0,2,235,60,0,2,235,180,0,2,236,84,0,2,236,252,0,2,237,72,0,2,237,120,0,2,237,176,0,2,237,232,0,2,238,68,0,2,238,148,0,2,238,228,0,2,239,68,0,2,239,188,0,2,240,72,0,2,240,120,0,2,240,172,0,2,240,216,0,2,241,40,0,2,241,84,0,2,241,128,0,2,241,220,0,2,242,44,0,2,242,164,0,2,242,180,0,2,242,196,0,2,242,216,0,2,242,236,0,2,242,252,0,2,243,84,0,2,243,176,0,2,243,196,0,2,243,252,0,2,244,52,0,2,244,72,0,2,244,92,0,2,244,112,0,2,244,132,0,2,244,152,0,2,244,172,0,2,244,192,0,2,244,212,0,2,244,232,0,2,244,252,0,2,245,16,0,2,245,36,0,2,245,176,0,2,245,196,0,2,245,216,0,2,245,236,0,2,246,0,0,2,246,80,0,2,246,128,0,2,247,40,0,2,247,124,0,2,247,204,0,2,247,224,0,2,248,52,0,2,248,132,0,2,249,8,0,2,249,132,0,2,250,0,0,2,250,124,0,2,250,236,0,2,251,96,0,2,251,208,0,2,252,136,0,2,253,52,0,2,253,236,0,2,254,156,0,2,255,72,0,2,255,232,0,3,0,248,0,3,1,40,0,3,1,56,0,3,1,196,0,3,1,212,0,3,2,80,0,3,2,176,0,3,3,20,0,3,3,144,0,3,4,12,0,3,4,192,0,3,5,128,0,3,5,236,0,3,6,92,0,3,7,4,0,3,7,192,0,3,7,216,0,3,7,240,0,3,10,4,0,3,10,28,0,3,10,52,0,3,10,88,0,3,10,124,0,3,10,140,0,3,10,140,0,1,0,0,8,60,0,118,0,7,0,165,0,5,0,2,0,52,0,70,0,139,0,0,0,163,13,109,0,4,0,1,0,0,0,34,1,158,0,1,0,0,0,0,0,0,0,91,0,0,0,1,0,0,0,0,0,1,0,8,0,91,0,1,0,0,0,0,0,2,0,7,0,99,0,1,0,0,0,0,0,3,0,27,0,106,0,1,0,0,0,0,0,4,0,16,0,133,0,1,0,0,0,0,0,5,0,33,0,149,0,1,0,0,0,0,0,6,0,16,0,182,0,1,0,0,0,0,0,8,0,18,0,198,0,1,0,0,0,0,0,9,0,20,0,216,0,1,0,0,0,0,0,11,0,32,0,236,0,1,0,0,0,0,0,12,0,32,1,12,0,1,0,0,0,0,0,13,0,144,1,44,0,1,0,0,0,0,0,14,0,26,1,188,0,1,0,0,0,0,1,0,0,14,1,214,0,1,0,0,0,0,1,1,0,29,1,228,0,1,0,0,0,0,1,2,0,12,2,1,0,1,0,0,0,0,1,3,0,28,2,13,0,3,0,1,4,9,0,0,0,182,2,41,0,3,0,1,4,9,0,1,0,16,2,223,0,3,0,1,4,9,0,2,0,14,2,239,0,3,0,1,4,9,0,3,0,54,2,253,0,3,0,1,4,9,0,4,0,32,3,51,0,3,0,1,4,9,0,5,0,66,3,83,0,3,0,1,4,9,0,6,0,32,3,149,0,3,0,1,4,9,0,8,0,36,3,181,0,3,0,1,4,9,0,9,0,40,3,217,0,3,0,1,4,9,0,11,0,64,4,1,0,3,0,1,4,9,0,12,0,64,4,65,0,3,0,1,4,9,0,13,1,32,4,129,0,3,0,1,4,9,0,14,0,52,5,161,0,3,0,1,4,9,1,0,0,28,5,213,0,3,0,1,4,9,1,1,0,58,5,241,0,3,0,1,4,9,1,2,0,24,6,43,0,3,0,1,4,9,1,3,0,56,6,67,67,111,112,121,114,105,103,104,116,32,50,48,49,49,32,84,104,101,32,65,108,101,103,114,101,121,97,32,80,114,111,106,101,99,116,32,65,117,116,104,111,114,115,32,40,104,116,116,112,115,58,47,47,103,105,116,104,117,98,46,99,111,109,47,104,117,101,114,116,97,116,105,112,111,103,114,97,102,105,99,97,47,65,108,101,103,114,101,121,97,41,65,108,101,103,114,101,121,97,82,101,103,117,108,97,114,50,46,48,48,51,59,72,84,32,32,59,65,108,101,103,114,101,121,97,45,82,101,103,117,108,97,114,65,108,101,103,114,101,121,97,32,82,101,103,117,108,97,114,86,101,114,115,105,111,110,32,50,46,48,48,51,59,32,116,116,102,97,117,116,111,104,105,110,116,32,40,118,49,46,54,41,65,108,101,103,114,101,121,97,45,82,101,103,117,108,97,114,72,117,101,114,116,97,32,84,105,112,111,103,114,97,102,105,99,97,74,117,97,110,32,80,97,98,108,111,32,100,101,108,32,80,101,114,97,108,104,116,116,112,58,47,47,119,119,119,46,104,117,101,114,116,97,116,105,112,111,103,114,97,102,105,99,97,46,99,111,109,104,116,116,112,58,47,47,119,119,119,46,104,117,101,114,116,97,116,105,112,111,103,114,97,102,105,99,97,46,99,111,109,84,104,105,115,32,70,111,110,116,32,83,111,102,116,119,97,114,101,32,105,115,32,108,105,99,101,110,115,101,100,32,117,110,100,101,114,32,116,104,101,32,83,73,76,32,79,112,101,110,32,70,111,110,116,32,76,105,99,101,110,115,101,44,32,86,101,114,115,105,111,110,32,49,46,49,46,32,84,104,105,115,32,108,105,99,101,110,115,101,32,105,115,32,97,118,97,105,108,97,98,108,101,32,119,105,116,104,32,97,32,70,65,81,32,97,116,58,32,104,116,116,112,58,47,47,115,99,114,105,112,116,115,46,115,105,108,46,111,114,103,47,79,70,76,104,116,116,112,58,47,47,115,99,114,105,112,116,115,46,115,105,108,46,111,114,103,47,79,70,76,82,111,109,97,110,32,110,117,109,101,114,97,108,115,65,114,114,111,119,115,44,32,116,114,105,97,110,103,108,101,115,32,97,110,100,32,99,105,114,99,108,101,115,70,111,117,110,100,114,121,32,105,99,111,110,68,121,110,97,109,105,99,32,97,114,114,111,119,115,32,97,110,100,32,116,114,105,97,110,103,108,101,115,0,67,0,111,0,112,0,121,0,114,0,105,0,103,0,104,0,116,0,32,0,50,0,48,0,49,0,49,0,32,0,84,0,104,0,101,0,32,0,65,0,108,0,101,0,103,0,114,0,101,0,121,0,97,0,32,0,80,0,114,0,111,0,106,0,101,0,99,0,116,0,32,0,65,0,117,0,116,0,104,0,111,0,114,0,115,0,32,0,40,0,104,0,116,0,116,0,112,0,115,0,58,0,47,0,47,0,103,0,105,0,116,0,104,0,117,0,98,0,46,0,99,0,111,0,109,0,47,0,104,0,117,0,101,0,114,0,116,0,97,0,116,0,105,0,112,0,111,0,103,0,114,0,97,0,102,0,105,0,99,0,97,0,47,0,65,0,108,0,101,0,103,0,114,0,101,0,121,0,97,0,41,0,65,0,108,0,101,0,103,0,114,0,101,0,121,0,97,0,82,0,101,0,103,0,117,0,108,0,97,0,114,0,50,0,46,0,48,0,48,0,51,0,59,0,72,0,84,0,32,0,32,0,59,0,65,0,108,0,101,0,103,0,114,0,101,0,121,0,97,0,45,0,82,0,101,0,103,0,117,0,108,0,97,0,114,0,65,0,108,0,101,0,103,0,114,0,101,0,121,0,97,0,32,0,82,0,101,0,103,0,117,0,108,0,97,0,114,0,86,0,101,0,114,0,115,0,105,0,111,0,110,0,32,0,50,0,46,0,48,0,48,0,51,0,59,0,32,0,116,0,116,0,102,0,97,0,117,0,116,0,111,0,104,0,105,0,110,0,116,0,32,0,40,0,118,0,49,0,46,0,54,0,41,0,65,0,108,0,101,0,103,0,114,0,101,0,121,0,97,0,45,0,82,0,101,0,103,0,117,0,108,0,97,0,114,0,72,0,117,0,101,0,114,0,116,0,97,0,32,0,84,0,105,0,112,0,111,0,103,0,114,0,97,0,102,0,105,0,99,0,97,0,74,0,117,0,97,0,110,0,32,0,80,0,97,0,98,0,108,0,111,0,32,0,100,0,101,0,108,0,32,0,80,0,101,0,114,0,97,0,108,0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,119,0,119,0,119,0,46,0,104,0,117,0,101,0,114,0,116,0,97,0,116,0,105,0,112,0,111,0,103,0,114,0,97,0,102,0,105,0,99,0,97,0,46,0,99,0,111,0,109,0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,119,0,119,0,119,0,46,0,104,0,117,0,101,0,114,0,116,0,97,0,116,0,105,0,112,0,111,0,103,0,114,0,97,0,102,0,105,0,99,0,97,0,46,0,99,0,111,0,109,0,84,0,104,0,105,0,115,0,32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,0,102,0,116,0,119,0,97,0,114,0,101,0,32,0,105,0,115,0,32,0,108,0,105,0,99,0,101,0,110,0,115,0,101,0,100,0,32,0,117,0,110,0,100,0,101,0,114,0,32,0,116,0,104,0,101,0,32,0,83,0,73,0,76,0,32,0,79,0,112,0,101,0,110,0,32,0,70,0,111,0,110,0,116,0,32,0,76,0,105,0,99,0,101,0,110,0,115,0,101,0,44,0,32,0,86,0,101,0,114,0,115,0,105,0,111,0,110,0,32,0,49,0,46,0,49,0,46,0,32,0,84,0,104,0,105,0,115,0,32,0,108,0,105,0,99,0,101,0,110,0,115,0,101,0,32,0,105,0,115,0,32,0,97,0,118,0,97,0,105,0,108,0,97,0,98,0,108,0,101,0,32,0,119,0,105,0,116,0,104,0,32,0,97,0,32,0,70,0,65,0,81,0,32,0,97,0,116,0,58,0,32,0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,115,0,99,0,114,0,105,0,112,0,116,0,115,0,46,0,115,0,105,0,108,0,46,0,111,0,114,0,103,0,47,0,79,0,70,0,76,0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,115,0,99,0,114,0,105,0,112,0,116,0,115,0,46,0,115,0,105,0,108,0,46,0,111,0,114,0,103,0,47,0,79,0,70,0,76,0,82,0,111,0,109,0,97,0,110,0,32,0,110,0,117,0,109,0,101,0,114,0,97,0,108,0,115,0,65,0,114,0,114,0,111,0,119,0,115,0,44,0,32,0,116,0,114,0,105,0,97,0,110,0,103,0,108,0,101,0,115,0,32,0,97,0,110,0,100,0,32,0,99,0,105,0,114,0,99,0,108,0,101,0,115,0,70,0,111,0,117,0,110,0,100,0,114,0,121,0,32,0,105,0,99,0,111,0,110,0,68,0,121,0,110,0,97,0,109,0,105,0,99,0,32,0,97,0,114,0,114,0,111,0,119,0,115,0,32,0,97,0,110,0,100,0,32,0,116,0,114,0,105,0,97,0,110,0,103,0,108,0,101,0,115,0,0,0,0,2,0,0,0,0,0,0,255,69,0,55,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,60,0,0,0,2,0,3,0,36,0,201,1,2,1,3,1,4,1,5,1,6,1,7,1,8,0,199,1,9,1,10,1,11,1,12,1,13,1,14,0,98,1,15,0,173,1,16,1,17,1,18,1,19,0,99,1,20,0,174,0,144,1,21,0,37,0,38,0,253,0,255,0,100,1,22,1,23,1,24,0,39,1,25,0,233,1,26,1,27,1,28,1,29,1,30,0,40,0,101,1,31,1,32,1,33,0,200,1,34,1,35,1,36,1,37,1,38,1,39,0,202,1,40,1,41,0,203,1,42,1,43,1,44,1,45,1,46,1,47,1,48,0,41,0,42,0,248,1,49,1,50,1,51,1,52,1,53,0,43,1,54,1,55,1,56,1,57,0,44,1,58,0,204,1,59,1,60,0,205,1,61,0,206,1,62,0,250,1,63,0,207,1,64,1,65,1,66,1,67,1,68,0,45,1,69,0,46,1,70,0,47,1,71,1,72,1,73,1,74,1,75,1,76,1,77,1,78,0,226,0,48,1,79,0,49,1,80,1,81,1,82,1,83,1,84,1,85,1,86,1,87,1,88,0,102,0,50,0,208,1,89,1,90,0,209,1,91,1,92,1,93,1,94,1,95,1,96,0,103,1,97,1,98,1,99,0,211,1,100,1,101,1,102,1,103,1,104,1,105,1,106,1,107,1,108,1,109,1,110,1,111,1,112,0,145,1,113,0,175,1,114,1,115,1,116,0,176,0,51,0,237,0,52,0,53,1,117,1,118,1,119,1,120,1,121,1,122,1,123,0,54,1,124,1,125,1,126,0,228,1,127,0,251,1,128,1,129,1,130,1,131,1,132,1,133,1,134,0,55,1,135,1,136,1,137,1,138,1,139,1,140,0,56,0,212,1,141,1,142,0,213,1,143,0,104,1,144,1,145,1,146,1,147,1,148,0,214,1,149,1,150,1,151,1,152,1,153,1,154,1,155,1,156,1,157,1,158,1,159,1,160,1,161,1,162,1,163,0,57,0,58,1,164,1,165,1,166,1,167,0,59,0,60,0,235,1,168,0,187,1,169,1,170,1,171,1,172,1,173,1,174,0,61,1,175,0,230,1,176,1,177,1,178,1,179,1,180,1,181,1,182,1,183,1,184,1,185,1,186,0,68,0,105,1,187,1,188,1,189,1,190,1,191,1,192,1,193,0,107,1,194,1,195,1,196,1,197,1,198,1,199,0,108,1,200,0,106,1,201,1,202,1,203,1,204,0,110,1,205,0,109,0,160,1,206,0,69,0,70,0,254,1,0,0,111,1,207,1,208,1,209,0,71,0,234,1,210,1,1,1,211,1,212,1,213,0,72,0,112,1,214,1,215,1,216,0,114,1,217,1,218,1,219,1,220,1,221,1,222,0,115,1,223,1,224,0,113,1,225,1,226,1,227,1,228,1,229,1,230,1,231,1,232,0,73,0,74,0,249,1,233,1,234,1,235,1,236,1,237,0,75,1,238,1,239,1,240,1,241,0,76,0,215,0,116,1,242,1,243,0,118,1,244,0,119,1,245,1,246,1,247,0,117,1,248,1,249,1,250,1,251,1,252,1,253,0,77,1,254,1,255,0,78,2,0,2,1,0,79,2,2,2,3,2,4,2,5,2,6,2,7,2,8,0,227,0,80,2,9,0,81,2,10,2,11,2,12,2,13,2,14,2,15,2,16,2,17,0,120,0,82,0,121,2,18,2,19,0,123,2,20,2,21,2,22,2,23,2,24,2,25,0,124,2,26,2,27,2,28,0,122,2,29,2,30,2,31,2,32,2,33,2,34,2,35,2,36,2,37,2,38,2,39,2,40,2,41,0,161,2,42,0,125,2,43,2,44,2,45,0,177,0,83,0,238,0,84,0,85,2,46,2,47,2,48,2,49,2,50,2,51,2,52,0,86,2,53,2,54,2,55,0,229,2,56,0,252,2,57,2,58,2,59,2,60,2,61,0,137,0,87,2,62,2,63,2,64,2,65,2,66,2,67,2,68,0,88,0,126,2,69,2,70,0,128,2,71,0,129,2,72,2,73,2,74,2,75,2,76,0,127,2,77,2,78,2,79,2,80,2,81,2,82,2,83,2,84,2,85,2,86,2,87,2,88,2,89,2,90,2,91,0,89,0,90,2,92,2,93,2,94,2,95,0,91,0,92,0,236,2,96,0,186,2,97,2,98,2,99,2,100,2,101,2,102,0,93,2,103,0,231,2,104,2,105,2,106,2,107,2,108,2,109,2,110,2,111,2,112,2,113,2,114,2,115,2,116,2,117,2,118,2,119,2,120,0,192,0,193,2,121,2,122,2,123,2,124,2,125,2,126,2,127,2,128,2,129,2,130,2,131,2,132,2,133,2,134,2,135,2,136,2,137,2,138,2,139,2,140,2,141,2,142,2,143,2,144,2,145,2,146,2,147,2,148,2,149,2,150,2,151,2,152,2,153,2,154,2,155,2,156,2,157,2,158,2,159,2,160,2,161,2,162,2,163,2,164,2,165,2,166,2,167,2,168,2,169,2,170,2,171,2,172,2,173,2,174,2,175,2,176,2,177,2,178,2,179,2,180,2,181,2,182,2,183,2,184,2,185,2,186,2,187,2,188,2,189,2,190,2,191,2,192,2,193,2,194,2,195,2,196,2,197,2,198,2,199,2,200,2,201,2,202,2,203,2,204,2,205,2,206,2,207,2,208,2,209,2,210,2,211,2,212,2,213,2,214,2,215,2,216,2,217,2,218,2,219,2,220,2,221,2,222,2,223,2,224,2,225,2,226,2,227,2,228,2,229,2,230,2,231,2,232,2,233,2,234,2,235,2,236,2,237,2,238,2,239,2,240,2,241,2,242,2,243,2,244,2,245,2,246,2,247,2,248,2,249,2,250,2,251,2,252,2,253,2,254,2,255,3,0,3,1,3,2,3,3,3,4,3,5,3,6,3,7,3,8,3,9,3,10,3,11,3,12,3,13,3,14,3,15,3,16,3,17,3,18,3,19,3,20,3,21,3,22,3,23,3,24,3,25,3,26,3,27,3,28,3,29,3,30,3,31,3,32,3,33,3,34,3,35,3,36,3,37,3,38,3,39,3,40,3,41,3,42,3,43,3,44,3,45,3,46,3,47,3,48,3,49,3,50,3,51,3,52,3,53,3,54,3,55,3,56,3,57,3,58,3,59,3,60,3,61,3,62,3,63,3,64,3,65,3,66,3,67,3,68,3,69,3,70,3,71,3,72,3,73,3,74,3,75,3,76,3,77,3,78,3,79,3,80,3,81,3,82,3,83,3,84,3,85,3,86,3,87,3,88,3,89,3,90,3,91,3,92,3,93,3,94,3,95,3,96,3,97,3,98,3,99,3,100,3,101,3,102,3,103,3,104,3,105,3,106,3,107,3,108,3,109,3,110,3,111,3,112,0,157,0,158,3,113,3,114,3,115,3,116,3,117,3,118,3,119,3,120,3,121,3,122,3,123,3,124,3,125,3,126,3,127,3,128,3,129,3,130,3,131,3,132,3,133,3,134,3,135,3,136,3,137,3,138,3,139,3,140,3,141,3,142,3,143,3,144,3,145,3,146,3,147,3,148,3,149,3,150,3,151,3,152,3,153,3,154,3,155,3,156,3,157,3,158,3,159,3,160,3,161,3,162,3,163,3,164,3,165,3,166,3,167,3,168,3,169,3,170,3,171,3,172,3,173,3,174,3,175,3,176,3,177,3,178,3,179,3,180,3,181,3,182,3,183,3,184,3,185,3,186,3,187,3,188,3,189,3,190,3,191,3,192,3,193,3,194,3,195,3,196,3,197,3,198,3,199,3,200,3,201,3,202,3,203,3,204,3,205,3,206,3,207,3,208,3,209,3,210,3,211,3,212,3,213,3,214,3,215,3,216,3,217,3,218,3,219,3,220,3,221,3,222,3,223,3,224,3,225,3,226,3,227,3,228,3,229,3,230,3,231,3,232,3,233,3,234,3,235,3,236,3,237,3,238,3,239,3,240,3,241,3,242,3,243,3,244,3,245,3,246,3,247,3,248,3,249,3,250,3,251,3,252,3,253,3,254,3,255,4,0,4,1,4,2,4,3,4,4,4,5,4,6,4,7,4,8,4,9,4,10,4,11,4,12,4,13,4,14,4,15,4,16,4,17,4,18,4,19,4,20,4,21,4,22,4,23,4,24,4,25,4,26,4,27,4,28,4,29,4,30,4,31,4,32,4,33,4,34,4,35,4,36,4,37,4,38,4,39,4,40,4,41,4,42,4,43,4,44,4,45,4,46,4,47,4,48,4,49,4,50,4,51,4,52,4,53,4,54,4,55,4,56,4,57,4,58,4,59,4,60,4,61,4,62,4,63,4,64,4,65,4,66,4,67,4,68,4,69,4,70,4,71,4,72,4,73,4,74,4,75,4,76,4,77,4,78,4,79,4,80,4,81,4,82,4,83,4,84,4,85,4,86,4,87,4,88,4,89,4,90,4,91,4,92,4,93,4,94,4,95,4,96,4,97,4,98,4,99,4,100,4,101,4,102,4,103,4,104,4,105,4,106,4,107,4,108,4,109,4,110,4,111,4,112,4,113,4,114,4,115,4,116,4,117,4,118,4,119,4,120,4,121,4,122,4,123,4,124,4,125,4,126,4,127,4,128,4,129,4,130,4,131,4,132,4,133,4,134,4,135,4,136,4,137,4,138,4,139,4,140,4,141,4,142,4,143,4,144,4,145,4,146,4,147,4,148,4,149,4,150,4,151,4,152,4,153,4,154,4,155,4,156,4,157,4,158,4,159,4,160,4,161,4,162,4,163,4,164,4,165,4,166,4,167,4,168,4,169,4,170,4,171,4,172,4,173,4,174,4,175,4,176,4,177,4,178,4,179,4,180,4,181,4,182,4,183,4,184,4,185,4,186,4,187,4,188,4,189,4,190,4,191,4,192,4,193,4,194,4,195,4,196,4,197,4,198,4,199,4,200,4,201,4,202,4,203,4,204,4,205,4,206,4,207,4,208,4,209,4,210,4,211,4,212,4,213,4,214,4,215,4,216,4,217,4,218,4,219,4,220,4,221,4,222,4,223,4,224,4,225,4,226,4,227,4,228,4,229,4,230,4,231,4,232,4,233,4,234,4,235,4,236,4,237,4,238,4,239,4,240,4,241,4,242,4,243,4,244,4,245,4,246,4,247,4,248,4,249,4,250,4,251,4,252,4,253,4,254,4,255,5,0,5,1,5,2,5,3,5,4,5,5,5,6,5,7,5,8,5,9,5,10,5,11,5,12,5,13,5,14,5,15,5,16,5,17,5,18,5,19,5,20,5,21,5,22,5,23,5,24,5,25,5,26,5,27,5,28,5,29,5,30,5,31,5,32,5,33,5,34,5,35,5,36,5,37,5,38,5,39,5,40,5,41,5,42,5,43,5,44,5,45,5,46,5,47,5,48,5,49,5,50,5,51,5,52,5,53,5,54,5,55,5,56,5,57,5,58,5,59,5,60,5,61,5,62,5,63,5,64,5,65,5,66,5,67,5,68,5,69,5,70,5,71,5,72,5,73,5,74,5,75,5,76,5,77,5,78,5,79,5,80,5,81,5,82,5,83,5,84,5,85,5,86,5,87,5,88,5,89,5,90,5,91,5,92,5,93,0,155,5,94,5,95,5,96,5,97,5,98,5,99,5,100,5,101,5,102,5,103,5,104,5,105,5,106,5,107,5,108,5,109,5,110,5,111,5,112,5,113,5,114,5,115,5,116,5,117,5,118,5,119,5,120,5,121,5,122,5,123,5,124,5,125,5,126,5,127,5,128,5,129,5,130,5,131,5,132,5,133,5,134,5,135,5,136,5,137,5,138,5,139,5,140,5,141,5,142,5,143,5,144,5,145,5,146,5,147,5,148,5,149,5,150,5,151,5,152,5,153,5,154,5,155,5,156,5,157,5,158,5,159,5,160,5,161,5,162,5,163,5,164,5,165,5,166,5,167,5,168,5,169,5,170,5,171,5,172,5,173,5,174,5,175,5,176,5,177,5,178,5,179,5,180,5,181,5,182,5,183,5,184,5,185,5,186,5,187,5,188,5,189,5,190,5,191,5,192,5,193,5,194,5,195,5,196,5,197,5,198,5,199,5,200,5,201,5,202,5,203,5,204,5,205,5,206,5,207,5,208,5,209,5,210,5,211,5,212,5,213,5,214,5,215,5,216,5,217,5,218,5,219,5,220,5,221,5,222,5,223,5,224,5,225,5,226,5,227,5,228,5,229,5,230,5,231,5,232,5,233,5,234,5,235,5,236,5,237,5,238,5,239,5,240,5,241,5,242,5,243,5,244,5,245,5,246,5,247,5,248,5,249,5,250,5,251,5,252,5,253,5,254,5,255,6,0,6,1,6,2,6,3,6,4,6,5,6,6,6,7,6,8,6,9,6,10,6,11,6,12,6,13,6,14,6,15,6,16,6,17,6,18,6,19,6,20,6,21,6,22,6,23,6,24,6,25,6,26,6,27,6,28,6,29,6,30,6,31,6,32,6,33,6,34,6,35,6,36,6,37,6,38,6,39,6,40,6,41,6,42,6,43,6,44,6,45,6,46,6,47,6,48,6,49,6,50,6,51,6,52,6,53,6,54,6,55,6,56,6,57,6,58,6,59,6,60,6,61,6,62,6,63,6,64,6,65,6,66,6,67,6,68,6,69,6,70,6,71,6,72,6,73,6,74,6,75,6,76,6,77,6,78,6,79,6,80,6,81,6,82,6,83,6,84,6,85,6,86,6,87,6,88,6,89,6,90,6,91,6,92,6,93,6,94,6,95,6,96,6,97,6,98,6,99,6,100,6,101,6,102,6,103,6,104,6,105,6,106,6,107,6,108,6,109,6,110,6,111,6,112,6,113,6,114,6,115,6,116,6,117,6,118,6,119,6,120,6,121,6,122,6,123,6,124,6,125,6,126,6,127,6,128,6,129,6,130,6,131,6,132,6,133,6,134,6,135,6,136,6,137,6,138,6,139,6,140,6,141,6,142,6,143,6,144,6,145,6,146,6,147,6,148,6,149,6,150,6,151,6,152,6,153,6,154,6,155,6,156,6,157,6,158,6,159,6,160,6,161,6,162,6,163,6,164,6,165,6,166,6,167,6,168,6,169,6,170,6,171,6,172,6,173,6,174,6,175,6,176,6,177,6,178,6,179,6,180,6,181,6,182,6,183,6,184,6,185,6,186,6,187,6,188,6,189,6,190,6,191,6,192,6,193,6,194,6,195,6,196,6,197,6,198,6,199,6,200,6,201,6,202,6,203,6,204,6,205,6,206,6,207,6,208,6,209,6,210,6,211,6,212,6,213,6,214,6,215,6,216,6,217,6,218,6,219,6,220,6,221,6,222,6,223,6,224,6,225,6,226,6,227,6,228,6,229,6,230,6,231,6,232,6,233,6,234,6,235,6,236,6,237,6,238,6,239,6,240,6,241,6,242,6,243,6,244,6,245,6,246,6,247,6,248,6,249,6,250,6,251,6,252,6,253,6,254,6,255,7,0,7,1,7,2,0,19,0,20,0,21,0,22,0,23,0,24,0,25,0,26,0,27,0,28,7,3,7,4,7,5,7,6,7,7,7,8,7,9,7,10,7,11,7,12,7,13,7,14,7,15,7,16,7,17,7,18,7,19,7,20,7,21,7,22,7,23,7,24,7,25,7,26,7,27,7,28,7,29,7,30,7,31,7,32,7,33,7,34,7,35,7,36,7,37,7,38,7,39,7,40,7,41,7,42,7,43,7,44,7,45,7,46,7,47,7,48,7,49,7,50,7,51,7,52,7,53,7,54,7,55,7,56,7,57,7,58,7,59,7,60,7,61,7,62,7,63,7,64,7,65,7,66,7,67,7,68,7,69,7,70,7,71,7,72,7,73,7,74,7,75,7,76,7,77,7,78,7,79,7,80,7,81,7,82,7,83,7,84,7,85,7,86,7,87,7,88,7,89,7,90,7,91,7,92,7,93,7,94,7,95,7,96,7,97,7,98,7,99,7,100,7,101,7,102,0,188,0,244,7,103,7,104,0,245,0,246,7,105,7,106,7,107,7,108,0,13,0,63,0,195,0,135,0,29,0,15,0,171,0,4,0,163,0,6,7,109,0,17,0,34,0,162,0,5,0,10,0,30,0,18,7,110,0,66,7,111,7,112,7,113,7,114,0,94,0,96,0,62,0,64,0,11,0,12,7,115,7,116,7,117,7,118,7,119,0,179,0,178,7,120,7,121,0,16,7,122,7,123,7,124,7,125,7,126,0,169,0,170,0,190,0,191,0,197,0,180,0,181,0,182,0,183,0,196,7,127,7,128,7,129,7,130,7,131,7,132,7,133,7,134,7,135,7,136,7,137,7,138,7,139,7,140,7,141,7,142,7,143,7,144,7,145,7,146,7,147,7,148,7,149,0,132,7,150,0,189,0,7,7,151,7,152,0,166,0,247,7,153,7,154,7,155,7,156,7,157,7,158,7,159,7,160,7,161,7,162,7,163,0,133,7,164,7,165,7,166,0,150,7,167,7,168,0,14,0,239,0,240,0,184,0,32,0,143,0,33,0,31,0,149,0,148,0,147,0,167,0,97,0,164,0,146,7,169,0,156,7,170,7,171,0,154,0,153,0,165,0,152,7,172,0,8,0,198,7,173,7,174,7,175,7,176,7,177,7,178,7,179,7,180,7,181,7,182,7,183,7,184,0,185,7,185,7,186,7,187,7,188,7,189,7,190,7,191,7,192,7,193,7,194,7,195,7,196,0,35,0,9,0,136,0,134,0,139,0,138,0,140,0,131,0,95,0,232,0,130,7,197,0,194,7,198,7,199,0,65,7,200,7,201,7,202,7,203,7,204,7,205,7,206,7,207,7,208,7,209,7,210,7,211,7,212,7,213,7,214,7,215,7,216,7,217,7,218,7,219,7,220,7,221,7,222,7,223,7,224,7,225,7,226,7,227,7,228,7,229,7,230,7,231,7,232,7,233,7,234,7,235,7,236,7,237,7,238,7,239,7,240,7,241,7,242,7,243,7,244,7,245,7,246,7,247,7,248,7,249,7,250,7,251,7,252,7,253,7,254,7,255,8,0,8,1,8,2,8,3,8,4,8,5,8,6,8,7,8,8,8,9,8,10,8,11,8,12,8,13,8,14,8,15,8,16,8,17,8,18,0,141,0,219,0,225,0,222,0,216,0,142,0,220,0,67,0,223,0,218,0,224,0,221,0,217,8,19,8,20,8,21,8,22,8,23,8,24,8,25,8,26,8,27,8,28,8,29,8,30,8,31,8,32,8,33,8,34,8,35,8,36,8,37,8,38,8,39,8,40,8,41,8,42,8,43,8,44,8,45,8,46,8,47,8,48,8,49,8,50,8,51,8,52,8,53,8,54,8,55,8,56,8,57,8,58,8,59,8,60,8,61,8,62,8,63,8,64,8,65,8,66,8,67,8,68,6,65,98,114,101,118,101,7,117,110,105,49,69,65,69,7,117,110,105,49,69,66,54,7,117,110,105,49,69,66,48,7,117,110,105,49,69,66,50,7,117,110,105,49,69,66,52,7,117,110,105,48,49,67,68,7,117,110,105,49,69,65,52,7,117,110,105,49,69,65,67,7,117,110,105,49,69,65,54,7,117,110,105,49,69,65,56,7,117,110,105,49,69,65,65,7,117,110,105,48,50,48,48,7,117,110,105,49,69,65,48,7,117,110,105,49,69,65,50,7,117,110,105,48,50,48,50,7,65,109,97,99,114,111,110,7,65,111,103,111,110,101,107,10,65,114,105,110,103,97,99,117,116,101,7,65,69,97,99,117,116,101,7,117,110,105,49,69,48,56,11,67,99,105,114,99,117,109,102,108,101,120,10,67,100,111,116,97,99,99,101,110,116,7,117,110,105,48,49,67,52,6,68,99,97,114,111,110,6,68,99,114,111,97,116,7,117,110,105,49,69,48,67,7,117,110,105,49,69,48,69,7,117,110,105,48,49,67,53,6,69,98,114,101,118,101,6,69,99,97,114,111,110,7,117,110,105,49,69,49,67,7,117,110,105,49,69,66,69,7,117,110,105,49,69,67,54,7,117,110,105,49,69,67,48,7,117,110,105,49,69,67,50,7,117,110,105,49,69,67,52,7,117,110,105,48,50,48,52,10,69,100,111,116,97,99,99,101,110,116,7,117,110,105,49,69,66,56,7,117,110,105,49,69,66,65,7,117,110,105,48,50,48,54,7,69,109,97,99,114,111,110,7,117,110,105,49,69,49,54,7,117,110,105,49,69,49,52,7,69,111,103,111,110,101,107,7,117,110,105,49,69,66,67,6,71,99,97,114,111,110,11,71,99,105,114,99,117,109,102,108,101,120,12,71,99,111,109,109,97,97,99,99,101,110,116,10,71,100,111,116,97,99,99,101,110,116,7,117,110,105,49,69,50,48,4,72,98,97,114,7,117,110,105,49,69,50,65,11,72,99,105,114,99,117,109,102,108,101,120,7,117,110,105,49,69,50,52,2,73,74,6,73,98,114,101,118,101,7,117,110,105,48,49,67,70,7,117,110,105,48,50,48,56,7,117,110,105,49,69,50,69,7,117,110,105,49,69,67,65,7,117,110,105,49,69,67,56,7,117,110,105,48,50,48,65,7,73,109,97,99,114,111,110,7,73,111,103,111,110,101,107,6,73,116,105,108,100,101,11,74,99,105,114,99,117,109,102,108,101,120,12,75,99,111,109,109,97,97,99,99,101,110,116,7,117,110,105,48,49,67,55,6,76,97,99,117,116,101,6,76,99,97,114,111,110,12,76,99,111,109,109,97,97,99,99,101,110,116,4,76,100,111,116,7,117,110,105,49,69,51,54,7,117,110,105,48,49,67,56,7,117,110,105,49,69,51,65,7,117,110,105,49,69,52,50,7,117,110,105,48,49,67,65,6,78,97,99,117,116,101,6,78,99,97,114,111,110,12,78,99,111,109,109,97,97,99,99,101,110,116,7,117,110,105,49,69,52,52,7,117,110,105,49,69,52,54,3,69,110,103,7,117,110,105,48,49,67,66,7,117,110,105,49,69,52,56,6,79,98,114,101,118,101,7,117,110,105,48,49,68,49,7,117,110,105,49,69,68,48,7,117,110,105,49,69,68,56,7,117,110,105,49,69,68,50,7,117,110,105,49,69,68,52,7,117,110,105,49,69,68,54,7,117,110,105,48,50,48,67,7,117,110,105,48,50,50,65,7,117,110,105,48,50,51,48,7,117,110,105,49,69,67,67,7,117,110,105,49,69,67,69,5,79,104,111,114,110,7,117,110,105,49,69,68,65,7,117,110,105,49,69,69,50,7,117,110,105,49,69,68,67,7,117,110,105,49,69,68,69,7,117,110,105,49,69,69,48,13,79,104,117,110,103,97,114,117,109,108,97,117,116,7,117,110,105,48,50,48,69,7,79,109,97,99,114,111,110,7,117,110,105,49,69,53,50,7,117,110,105,49,69,53,48,7,117,110,105,48,49,69,65,11,79,115,108,97,115,104,97,99,117,116,101,7,117,110,105,49,69,52,67,7,117,110,105,49,69,52,69,7,117,110,105,48,50,50,67,6,82,97,99,117,116,101,6,82,99,97,114,111,110,12,82,99,111,109,109,97,97,99,99,101,110,116,7,117,110,105,48,50,49,48,7,117,110,105,49,69,53,65,7,117,110,105,48,50,49,50,7,117,110,105,49,69,53,69,6,83,97,99,117,116,101,7,117,110,105,49,69,54,52,7,117,110,105,65,55,56,66,7,117,110,105,49,69,54,54,11,83,99,105,114,99,117,109,102,108,101,120,12,83,99,111,109,109,97,97,99,99,101,110,116,7,117,110,105,49,69,54,48,7,117,110,105,49,69,54,50,7,117,110,105,49,69,54,56,7,117,110,105,49,69,57,69,7,117,110,105,48,49,56,70,4,84,98,97,114,6,84,99,97,114,111,110,7,117,110,105,48,49,54,50,7,117,110,105,48,50,49,65,7,117,110,105,49,69,54,67,7,117,110,105,49,69,54,69,6,85,98,114,101,118,101,7,117,110,105,48,49,68,51,7,117,110,105,48,50,49,52,7,117,110,105,48,49,68,55,7,117,110,105,48,49,68,57,7,117,110,105,48,49,68,66,7,117,110,105,48,49,68,53,7,117,110,105,49,69,69,52,7,117,110,105,49,69,69,54,5,85,104,111,114,110,7,117,110,105,49,69,69,56,7,117,110,105,49,69,70,48,7,117,110,105,49,69,69,65,7,117,110,105,49,69,69,67,7,117,110,105,49,69,69,69,13,85,104,117,110,103,97,114,117,109,108,97,117,116,7,117,110,105,48,50,49,54,7,85,109,97,99,114,111,110,7,117,110,105,49,69,55,65,7,85,111,103,111,110,101,107,5,85,114,105,110,103,6,85,116,105,108,100,101,7,117,110,105,49,69,55,56,6,87,97,99,117,116,101,11,87,99,105,114,99,117,109,102,108,101,120,9,87,100,105,101,114,101,115,105,115,6,87,103,114,97,118,101,11,89,99,105,114,99,117,109,102,108,101,120,7,117,110,105,49,69,56,69,7,117,110,105,49,69,70,52,6,89,103,114,97,118,101,7,117,110,105,49,69,70,54,7,117,110,105,48,50,51,50,7,117,110,105,49,69,70,56,6,90,97,99,117,116,101,10,90,100,111,116,97,99,99,101,110,116,7,117,110,105,49,69,57,50,16,73,97,99,117,116,101,95,74,46,108,111,99,108,78,76,68,11,117,110,105,49,69,57,69,46,97,108,116,6,67,46,115,115,48,49,6,68,46,115,115,48,49,6,73,46,115,115,48,49,6,76,46,115,115,48,49,6,77,46,115,115,48,49,6,86,46,115,115,48,49,6,88,46,115,115,48,49,6,97,98,114,101,118,101,7,117,110,105,49,69,65,70,7,117,110,105,49,69,66,55,7,117,110,105,49,69,66,49,7,117,110,105,49,69,66,51,7,117,110,105,49,69,66,53,7,117,110,105,48,49,67,69,7,117,110,105,49,69,65,53,7,117,110,105,49,69,65,68,7,117,110,105,49,69,65,55,7,117,110,105,49,69,65,57,7,117,110,105,49,69,65,66,7,117,110,105,48,50,48,49,7,117,110,105,49,69,65,49,7,117,110,105,49,69,65,51,7,117,110,105,48,50,48,51,7,97,109,97,99,114,111,110,7,97,111,103,111,110,101,107,10,97,114,105,110,103,97,99,117,116,101,7,97,101,97,99,117,116,101,7,117,110,105,49,69,48,57,11,99,99,105,114,99,117,109,102,108,101,120,10,99,100,111,116,97,99,99,101,110,116,6,100,99,97,114,111,110,7,117,110,105,49,69,48,68,7,117,110,105,49,69,48,70,7,117,110,105,48,49,67,54,6,101,98,114,101,118,101,6,101,99,97,114,111,110,7,117,110,105,49,69,49,68,7,117,110,105,49,69,66,70,7,117,110,105,49,69,67,55,7,117,110,105,49,69,67,49,7,117,110,105,49,69,67,51,7,117,110,105,49,69,67,53,7,117,110,105,48,50,48,53,10,101,100,111,116,97,99,99,101,110,116,7,117,110,105,49,69,66,57,7,117,110,105,49,69,66,66,7,117,110,105,48,50,48,55,7,101,109,97,99,114,111,110,7,117,110,105,49,69,49,55,7,117,110,105,49,69,49,53,7,101,111,103,111,110,101,107,7,117,110,105,49,69,66,68,7,117,110,105,48,50,53,57,6,103,99,97,114,111,110,11,103,99,105,114,99,117,109,102,108,101,120,12,103,99,111,109,109,97,97,99,99,101,110,116,10,103,100,111,116,97,99,99,101,110,116,7,117,110,105,49,69,50,49,4,104,98,97,114,7,117,110,105,49,69,50,66,11,104,99,105,114,99,117,109,102,108,101,120,7,117,110,105,49,69,50,53,6,105,98,114,101,118,101,7,117,110,105,48,49,68,48,7,117,110,105,48,50,48,57,7,117,110,105,49,69,50,70,9,105,46,108,111,99,108,84,82,75,7,117,110,105,49,69,67,66,7,117,110,105,49,69,67,57,7,117,110,105,48,50,48,66,2,105,106,7,105,109,97,99,114,111,110,7,105,111,103,111,110,101,107,6,105,116,105,108,100,101,7,117,110,105,48,50,51,55,11,106,99,105,114,99,117,109,102,108,101,120,12,107,99,111,109,109,97,97,99,99,101,110,116,12,107,103,114,101,101,110,108,97,110,100,105,99,6,108,97,99,117,116,101,6,108,99,97,114,111,110,12,108,99,111,109,109,97,97,99,99,101,110,116,4,108,100,111,116,7,117,110,105,49,69,51,55,7,117,110,105,48,49,67,57,7,117,110,105,49,69,51,66,7,117,110,105,49,69,52,51,6,110,97,99,117,116,101,6,110,99,97,114,111,110,12,110,99,111,109,109,97,97,99,99,101,110,116,7,117,110,105,49,69,52,53,7,117,110,105,49,69,52,55,3,101,110,103,7,117,110,105,48,49,67,67,7,117,110,105,49,69,52,57,6,111,98,114,101,118,101,7,117,110,105,48,49,68,50,7,117,110,105,49,69,68,49,7,117,110,105,49,69,68,57,7,117,110,105,49,69,68,51,7,117,110,105,49,69,68,53,7,117,110,105,49,69,68,55,7,117,110,105,48,50,48,68,7,117,110,105,48,50,50,66,7,117,110,105,48,50,51,49,7,117,110,105,49,69,67,68,7,117,110,105,49,69,67,70,5,111,104,111,114,110,7,117,110,105,49,69,68,66,7,117,110,105,49,69,69,51,7,117,110,105,49,69,68,68,7,117,110,105,49,69,68,70,7,117,110,105,49,69,69,49,13,111,104,117,110,103,97,114,117,109,108,97,117,116,7,117,110,105,48,50,48,70,7,111,109,97,99,114,111,110,7,117,110,105,49,69,53,51,7,117,110,105,49,69,53,49,7,117,110,105,48,49,69,66,11,111,115,108,97,115,104,97,99,117,116,101,7,117,110,105,49,69,52,68,7,117,110,105,49,69,52,70,7,117,110,105,48,50,50,68,6,114,97,99,117,116,101,6,114,99,97,114,111,110,12,114,99,111,109,109,97,97,99,99,101,110,116,7,117,110,105,48,50,49,49,7,117,110,105,49,69,53,66,7,117,110,105,48,50,49,51,7,117,110,105,49,69,53,70,6,115,97,99,117,116,101,7,117,110,105,49,69,54,53,7,117,110,105,65,55,56,67,7,117,110,105,49,69,54,55,11,115,99,105,114,99,117,109,102,108,101,120,12,115,99,111,109,109,97,97,99,99,101,110,116,7,117,110,105,49,69,54,49,7,117,110,105,49,69,54,51,7,117,110,105,49,69,54,57,4,116,98,97,114,6,116,99,97,114,111,110,7,117,110,105,48,49,54,51,7,117,110,105,48,50,49,66,7,117,110,105,49,69,57,55,7,117,110,105,49,69,54,68,7,117,110,105,49,69,54,70,6,117,98,114,101,118,101,7,117,110,105,48,49,68,52,7,117,110,105,48,50,49,53,7,117,110,105,48,49,68,56,7,117,110,105,48,49,68,65,7,117,110,105,48,49,68,67,7,117,110,105,48,49,68,54,7,117,110,105,49,69,69,53,7,117,110,105,49,69,69,55,5,117,104,111,114,110,7,117,110,105,49,69,69,57,7,117,110,105,49,69,70,49,7,117,110,105,49,69,69,66,7,117,110,105,49,69,69,68,7,117,110,105,49,69,69,70,13,117,104,117,110,103,97,114,117,109,108,97,117,116,7,117,110,105,48,50,49,55,7,117,109,97,99,114,111,110,7,117,110,105,49,69,55,66,7,117,111,103,111,110,101,107,5,117,114,105,110,103,6,117,116,105,108,100,101,7,117,110,105,49,69,55,57,6,119,97,99,117,116,101,11,119,99,105,114,99,117,109,102,108,101,120,9,119,100,105,101,114,101,115,105,115,6,119,103,114,97,118,101,11,121,99,105,114,99,117,109,102,108,101,120,7,117,110,105,49,69,56,70,7,117,110,105,49,69,70,53,6,121,103,114,97,118,101,7,117,110,105,49,69,70,55,7,117,110,105,48,50,51,51,7,117,110,105,49,69,70,57,6,122,97,99,117,116,101,10,122,100,111,116,97,99,99,101,110,116,7,117,110,105,49,69,57,51,11,100,111,116,108,101,115,115,105,46,99,121,3,102,46,102,16,105,97,99,117,116,101,95,106,46,108,111,99,108,78,76,68,3,102,46,108,6,99,46,115,115,48,49,6,100,46,115,115,48,49,6,105,46,115,115,48,49,6,108,46,115,115,48,49,6,109,46,115,115,48,49,6,118,46,115,115,48,49,6,120,46,115,115,48,49,3,102,46,116,3,99,95,104,3,99,95,116,3,102,95,106,3,115,95,116,8,84,95,104,46,108,105,103,97,4,97,46,115,99,9,97,97,99,117,116,101,46,115,99,9,97,98,114,101,118,101,46,115,99,10,117,110,105,49,69,65,70,46,115,99,10,117,110,105,49,69,66,55,46,115,99,10,117,110,105,49,69,66,49,46,115,99,10,117,110,105,49,69,66,51,46,115,99,10,117,110,105,49,69,66,53,46,115,99,10,117,110,105,48,49,67,69,46,115,99,14,97,99,105,114,99,117,109,102,108,101,120,46,115,99,10,117,110,105,49,69,65,53,46,115,99,10,117,110,105,49,69,65,68,46,115,99,10,117,110,105,49,69,65,55,46,115,99,10,117,110,105,49,69,65,57,46,115,99,10,117,110,105,49,69,65,66,46,115,99,10,117,110,105,48,50,48,49,46,115,99,12,97,100,105,101,114,101,115,105,115,46,115,99,10,117,110,105,49,69,65,49,46,115,99,9,97,103,114,97,118,101,46,115,99,10,117,110,105,49,69,65,51,46,115,99,10,117,110,105,48,50,48,51,46,115,99,17,103,101,114,109,97,110,100,98,108,115,46,97,108,116,46,115,99,10,97,109,97,99,114,111,110,46,115,99,10,97,111,103,111,110,101,107,46,115,99,8,97,114,105,110,103,46,115,99,13,97,114,105,110,103,97,99,117,116,101,46,115,99,9,97,116,105,108,100,101,46,115,99,5,97,101,46,115,99,10,97,101,97,99,117,116,101,46,115,99,4,98,46,115,99,4,99,46,115,99,9,99,97,99,117,116,101,46,115,99,9,99,99,97,114,111,110,46,115,99,11,99,99,101,100,105,108,108,97,46,115,99,10,117,110,105,49,69,48,57,46,115,99,14,99,99,105,114,99,117,109,102,108,101,120,46,115,99,13,99,100,111,116,97,99,99,101,110,116,46,115,99,4,100,46,115,99,6,101,116,104,46,115,99,9,100,99,97,114,111,110,46,115,99,9,100,99,114,111,97,116,46,115,99,10,117,110,105,49,69,48,68,46,115,99,10,117,110,105,49,69,48,70,46,115,99,10,117,110,105,48,49,67,54,46,115,99,4,101,46,115,99,9,101,97,99,117,116,101,46,115,99,9,101,98,114,101,118,101,46,115,99,9,101,99,97,114,111,110,46,115,99,10,117,110,105,49,69,49,68,46,115,99,14,101,99,105,114,99,117,109,102,108,101,120,46,115,99,10,117,110,105,49,69,66,70,46,115,99,10,117,110,105,49,69,67,55,46,115,99,10,117,110,105,49,69,67,49,46,115,99,10,117,110,105,49,69,67,51,46,115,99,10,117,110,105,49,69,67,53,46,115,99,10,117,110,105,48,50,48,53,46,115,99,12,101,100,105,101,114,101,115,105,115,46,115,99,13,101,100,111,116,97,99,99,101,110,116,46,115,99,10,117,110,105,49,69,66,57,46,115,99,9,101,103,114,97,118,101,46,115,99,10,117,110,105,49,69,66,66,46,115,99,10,117,110,105,48,50,48,55,46,115,99,10,101,109,97,99,114,111,110,46,115,99,10,117,110,105,49,69,49,55,46,115,99,10,117,110,105,49,69,49,53,46,115,99,10,101,111,103,111,110,101,107,46,115,99,10,117,110,105,49,69,66,68,46,115,99,10,117,110,105,48,50,53,57,46,115,99,4,102,46,115,99,5,102,105,46,115,99,5,102,108,46,115,99,4,103,46,115,99,9,103,98,114,101,118,101,46,115,99,9,103,99,97,114,111,110,46,115,99,14,103,99,105,114,99,117,109,102,108,101,120,46,115,99,15,103,99,111,109,109,97,97,99,99,101,110,116,46,115,99,13,103,100,111,116,97,99,99,101,110,116,46,115,99,10,117,110,105,49,69,50,49,46,115,99,4,104,46,115,99,7,104,98,97,114,46,115,99,10,117,110,105,49,69,50,66,46,115,99,14,104,99,105,114,99,117,109,102,108,101,120,46,115,99,10,117,110,105,49,69,50,53,46,115,99,4,105,46,115,99,11,100,111,116,108,101,115,115,105,46,115,99,9,105,97,99,117,116,101,46,115,99,19,105,97,99,117,116,101,95,106,46,108,111,99,108,78,76,68,46,115,99,9,105,98,114,101,118,101,46,115,99,10,117,110,105,48,49,68,48,46,115,99,14,105,99,105,114,99,117,109,102,108,101,120,46,115,99,10,117,110,105,48,50,48,57,46,115,99,12,105,100,105,101,114,101,115,105,115,46,115,99,10,117,110,105,49,69,50,70,46,115,99,12,105,46,115,99,46,108,111,99,108,84,82,75,10,117,110,105,49,69,67,66,46,115,99,9,105,103,114,97,118,101,46,115,99,10,117,110,105,49,69,67,57,46,115,99,10,117,110,105,48,50,48,66,46,115,99,5,105,106,46,115,99,10,105,109,97,99,114,111,110,46,115,99,10,105,111,103,111,110,101,107,46,115,99,9,105,116,105,108,100,101,46,115,99,4,106,46,115,99,10,117,110,105,48,50,51,55,46,115,99,14,106,99,105,114,99,117,109,102,108,101,120,46,115,99,4,107,46,115,99,15,107,99,111,109,109,97,97,99,99,101,110,116,46,115,99,15,107,103,114,101,101,110,108,97,110,100,105,99,46,115,99,4,108,46,115,99,9,108,97,99,117,116,101,46,115,99,9,108,99,97,114,111,110,46,115,99,15,108,99,111,109,109,97,97,99,99,101,110,116,46,115,99,7,108,100,111,116,46,115,99,10,117,110,105,49,69,51,55,46,115,99,10,117,110,105,48,49,67,57,46,115,99,10,117,110,105,49,69,51,66,46,115,99,9,108,115,108,97,115,104,46,115,99,4,109,46,115,99,10,117,110,105,49,69,52,51,46,115,99,4,110,46,115,99,9,110,97,99,117,116,101,46,115,99,9,110,99,97,114,111,110,46,115,99,15,110,99,111,109,109,97,97,99,99,101,110,116,46,115,99,10,117,110,105,49,69,52,53,46,115,99,10,117,110,105,49,69,52,55,46,115,99,6,101,110,103,46,115,99,10,117,110,105,48,49,67,67,46,115,99,10,117,110,105,49,69,52,57,46,115,99,9,110,116,105,108,100,101,46,115,99,4,111,46,115,99,9,111,97,99,117,116,101,46,115,99,9,111,98,114,101,118,101,46,115,99,10,117,110,105,48,49,68,50,46,115,99,14,111,99,105,114,99,117,109,102,108,101,120,46,115,99,10,117,110,105,49,69,68,49,46,115,99,10,117,110,105,49,69,68,57,46,115,99,10,117,110,105,49,69,68,51,46,115,99,10,117,110,105,49,69,68,53,46,115,99,10,117,110,105,49,69,68,55,46,115,99,10,117,110,105,48,50,48,68,46,115,99,12,111,100,105,101,114,101,115,105,115,46,115,99,10,117,110,105,48,50,50,66,46,115,99,10,117,110,105,48,50,51,49,46,115,99,10,117,110,105,49,69,67,68,46,115,99,9,111,103,114,97,118,101,46,115,99,10,117,110,105,49,69,67,70,46,115,99,8,111,104,111,114,110,46,115,99,10,117,110,105,49,69,68,66,46,115,99,10,117,110,105,49,69,69,51,46,115,99,10,117,110,105,49,69,68,68,46,115,99,10,117,110,105,49,69,68,70,46,115,99,10,117,110,105,49,69,69,49,46,115,99,16,111,104,117,110,103,97,114,117,109,108,97,117,116,46,115,99,10,117,110,105,48,50,48,70,46,115,99,10,111,109,97,99,114,111,110,46,115,99,10,117,110,105,49,69,53,51,46,115,99,10,117,110,105,49,69,53,49,46,115,99,10,117,110,105,48,49,69,66,46,115,99,9,111,115,108,97,115,104,46,115,99,14,111,115,108,97,115,104,97,99,117,116,101,46,115,99,9,111,116,105,108,100,101,46,115,99,10,117,110,105,49,69,52,68,46,115,99,10,117,110,105,49,69,52,70,46,115,99,10,117,110,105,48,50,50,68,46,115,99,5,111,101,46,115,99,4,112,46,115,99,8,116,104,111,114,110,46,115,99,4,113,46,115,99,4,114,46,115,99,9,114,97,99,117,116,101,46,115,99,9,114,99,97,114,111,110,46,115,99,15,114,99,111,109,109,97,97,99,99,101,110,116,46,115,99,10,117,110,105,48,50,49,49,46,115,99,10,117,110,105,49,69,53,66,46,115,99,10,117,110,105,48,50,49,51,46,115,99,10,117,110,105,49,69,53,70,46,115,99,4,115,46,115,99,9,115,97,99,117,116,101,46,115,99,10,117,110,105,49,69,54,53,46,115,99,9,115,99,97,114,111,110,46,115,99,10,117,110,105,49,69,54,55,46,115,99,11,115,99,101,100,105,108,108,97,46,115,99,14,115,99,105,114,99,117,109,102,108,101,120,46,115,99,15,115,99,111,109,109,97,97,99,99,101,110,116,46,115,99,10,117,110,105,49,69,54,49,46,115,99,10,117,110,105,49,69,54,51,46,115,99,10,117,110,105,49,69,54,57,46,115,99,13,103,101,114,109,97,110,100,98,108,115,46,115,99,4,116,46,115,99,7,116,98,97,114,46,115,99,9,116,99,97,114,111,110,46,115,99,10,117,110,105,48,49,54,51,46,115,99,10,117,110,105,48,50,49,66,46,115,99,10,117,110,105,49,69,57,55,46,115,99,10,117,110,105,49,69,54,68,46,115,99,10,117,110,105,49,69,54,70,46,115,99,4,117,46,115,99,9,117,97,99,117,116,101,46,115,99,9,117,98,114,101,118,101,46,115,99,10,117,110,105,48,49,68,52,46,115,99,14,117,99,105,114,99,117,109,102,108,101,120,46,115,99,10,117,110,105,48,50,49,53,46,115,99,12,117,100,105,101,114,101,115,105,115,46,115,99,10,117,110,105,48,49,68,56,46,115,99,10,117,110,105,48,49,68,65,46,115,99,10,117,110,105,48,49,68,67,46,115,99,10,117,110,105,48,49,68,54,46,115,99,10,117,110,105,49,69,69,53,46,115,99,9,117,103,114,97,118,101,46,115,99,10,117,110,105,49,69,69,55,46,115,99,8,117,104,111,114,110,46,115,99,10,117,110,105,49,69,69,57,46,115,99,10,117,110,105,49,69,70,49,46,115,99,10,117,110,105,49,69,69,66,46,115,99,10,117,110,105,49,69,69,68,46,115,99,10,117,110,105,49,69,69,70,46,115,99,16,117,104,117,110,103,97,114,117,109,108,97,117,116,46,115,99,10,117,110,105,48,50,49,55,46,115,99,10,117,109,97,99,114,111,110,46,115,99,10,117,110,105,49,69,55,66,46,115,99,10,117,111,103,111,110,101,107,46,115,99,8,117,114,105,110,103,46,115,99,9,117,116,105,108,100,101,46,115,99,10,117,110,105,49,69,55,57,46,115,99,4,118,46,115,99,4,119,46,115,99,9,119,97,99,117,116,101,46,115,99,14,119,99,105,114,99,117,109,102,108,101,120,46,115,99,12,119,100,105,101,114,101,115,105,115,46,115,99,9,119,103,114,97,118,101,46,115,99,4,120,46,115,99,4,121,46,115,99,9,121,97,99,117,116,101,46,115,99,14,121,99,105,114,99,117,109,102,108,101,120,46,115,99,12,121,100,105,101,114,101,115,105,115,46,115,99,10,117,110,105,49,69,56,70,46,115,99,10,117,110,105,49,69,70,53,46,115,99,9,121,103,114,97,118,101,46,115,99,10,117,110,105,49,69,70,55,46,115,99,10,117,110,105,48,50,51,51,46,115,99,10,117,110,105,49,69,70,57,46,115,99,4,122,46,115,99,9,122,97,99,117,116,101,46,115,99,9,122,99,97,114,111,110,46,115,99,13,122,100,111,116,97,99,99,101,110,116,46,115,99,10,117,110,105,49,69,57,51,46,115,99,7,117,110,105,48,50,66,48,7,117,110,105,48,50,66,50,7,117,110,105,48,50,69,49,7,117,110,105,50,48,55,70,7,117,110,105,48,50,69,50,7,117,110,105,48,50,66,55,7,117,110,105,48,50,69,51,7,117,110,105,48,50,66,56,6,97,46,115,117,112,115,6,98,46,115,117,112,115,6,99,46,115,117,112,115,6,100,46,115,117,112,115,6,101,46,115,117,112,115,6,102,46,115,117,112,115,6,103,46,115,117,112,115,6,104,46,115,117,112,115,6,105,46,115,117,112,115,6,106,46,115,117,112,115,6,107,46,115,117,112,115,6,108,46,115,117,112,115,6,109,46,115,117,112,115,6,110,46,115,117,112,115,6,111,46,115,117,112,115,6,112,46,115,117,112,115,6,113,46,115,117,112,115,6,114,46,115,117,112,115,6,115,46,115,117,112,115,6,116,46,115,117,112,115,6,117,46,115,117,112,115,6,118,46,115,117,112,115,6,119,46,115,117,112,115,6,120,46,115,117,112,115,6,121,46,115,117,112,115,6,122,46,115,117,112,115,7,117,110,105,48,52,49,48,7,117,110,105,48,52,49,49,7,117,110,105,48,52,49,50,7,117,110,105,48,52,49,51,7,117,110,105,48,52,48,51,7,117,110,105,48,52,57,48,7,117,110,105,48,52,49,52,7,117,110,105,48,52,49,53,7,117,110,105,48,52,48,48,7,117,110,105,48,52,48,49,7,117,110,105,48,52,49,54,7,117,110,105,48,52,49,55,7,117,110,105,48,52,49,56,7,117,110,105,48,52,49,57,7,117,110,105,48,52,48,68,7,117,110,105,48,52,49,65,7,117,110,105,48,52,48,67,7,117,110,105,48,52,49,66,7,117,110,105,48,52,49,67,7,117,110,105,48,52,49,68,7,117,110,105,48,52,49,69,7,117,110,105,48,52,49,70,7,117,110,105,48,52,50,48,7,117,110,105,48,52,50,49,7,117,110,105,48,52,50,50,7,117,110,105,48,52,50,51,7,117,110,105,48,52,48,69,7,117,110,105,48,52,50,52,7,117,110,105,48,52,50,53,7,117,110,105,48,52,50,55,7,117,110,105,48,52,50,54,7,117,110,105,48,52,50,56,7,117,110,105,48,52,50,57,7,117,110,105,48,52,48,70,7,117,110,105,48,52,50,67,7,117,110,105,48,52,50,65,7,117,110,105,48,52,50,66,7,117,110,105,48,52,48,57,7,117,110,105,48,52,48,65,7,117,110,105,48,52,48,53,7,117,110,105,48,52,48,52,7,117,110,105,48,52,50,68,7,117,110,105,48,52,48,54,7,117,110,105,48,52,48,55,7,117,110,105,48,52,48,56,7,117,110,105,48,52,48,66,7,117,110,105,48,52,50,69,7,117,110,105,48,52,50,70,7,117,110,105,48,52,48,50,7,117,110,105,48,52,54,50,7,117,110,105,48,52,54,65,7,117,110,105,48,52,55,50,7,117,110,105,48,52,55,52,7,117,110,105,48,52,57,50,7,117,110,105,48,52,57,52,7,117,110,105,48,52,57,54,7,117,110,105,48,52,57,56,7,117,110,105,48,52,57,65,7,117,110,105,48,52,57,67,7,117,110,105,48,52,65,48,7,117,110,105,48,52,65,50,7,117,110,105,48,52,65,52,7,117,110,105,48,53,50,52,7,117,110,105,48,52,65,65,7,117,110,105,48,52,65,69,7,117,110,105,48,52,66,48,7,117,110,105,48,52,66,50,7,117,110,105,48,52,66,54,7,117,110,105,48,52,66,56,7,117,110,105,48,52,66,65,7,117,110,105,48,52,67,48,7,117,110,105,48,52,67,49,7,117,110,105,48,52,67,66,7,117,110,105,48,52,68,48,7,117,110,105,48,52,68,50,7,117,110,105,48,52,68,52,7,117,110,105,48,52,68,54,7,117,110,105,48,52,68,56,7,117,110,105,48,52,68,67,7,117,110,105,48,52,68,69,7,117,110,105,48,52,69,50,7,117,110,105,48,52,69,52,7,117,110,105,48,52,69,54,7,117,110,105,48,52,69,56,7,117,110,105,48,52,69,69,7,117,110,105,48,52,70,48,7,117,110,105,48,52,70,50,7,117,110,105,48,52,70,52,7,117,110,105,48,52,70,54,7,117,110,105,48,52,70,56,7,117,110,105,48,53,49,65,7,117,110,105,48,53,49,67,15,117,110,105,48,52,57,50,46,108,111,99,108,66,83,72,15,117,110,105,48,52,57,56,46,108,111,99,108,66,83,72,15,117,110,105,48,52,65,65,46,108,111,99,108,67,72,85,7,117,110,105,48,52,51,48,7,117,110,105,48,52,51,49,7,117,110,105,48,52,51,50,7,117,110,105,48,52,51,51,7,117,110,105,48,52,53,51,7,117,110,105,48,52,57,49,7,117,110,105,48,52,51,52,7,117,110,105,48,52,51,53,7,117,110,105,48,52,53,48,7,117,110,105,48,52,53,49,7,117,110,105,48,52,51,54,7,117,110,105,48,52,51,55,7,117,110,105,48,52,51,56,7,117,110,105,48,52,51,57,7,117,110,105,48,52,53,68,7,117,110,105,48,52,51,65,7,117,110,105,48,52,53,67,7,117,110,105,48,52,51,66,7,117,110,105,48,52,51,67,7,117,110,105,48,52,51,68,7,117,110,105,48,52,51,69,7,117,110,105,48,52,51,70,7,117,110,105,48,52,52,48,7,117,110,105,48,52,52,49,7,117,110,105,48,52,52,50,7,117,110,105,48,52,52,51,7,117,110,105,48,52,53,69,7,117,110,105,48,52,52,52,7,117,110,105,48,52,52,53,7,117,110,105,48,52,52,55,7,117,110,105,48,52,52,54,7,117,110,105,48,52,52,56,7,117,110,105,48,52,52,57,7,117,110,105,48,52,53,70,7,117,110,105,48,52,52,67,7,117,110,105,48,52,52,65,7,117,110,105,48,52,52,66,7,117,110,105,48,52,53,57,7,117,110,105,48,52,53,65,7,117,110,105,48,52,53,53,7,117,110,105,48,52,53,52,7,117,110,105,48,52,52,68,7,117,110,105,48,52,53,54,7,117,110,105,48,52,53,55,7,117,110,105,48,52,53,56,7,117,110,105,48,52,53,66,7,117,110,105,48,52,52,69,7,117,110,105,48,52,52,70,7,117,110,105,48,52,53,50,7,117,110,105,48,52,54,51,7,117,110,105,48,52,54,66,7,117,110,105,48,52,55,51,7,117,110,105,48,52,55,53,7,117,110,105,48,52,57,51,7,117,110,105,48,52,57,53,7,117,110,105,48,52,57,55,7,117,110,105,48,52,57,57,7,117,110,105,48,52,57,66,7,117,110,105,48,52,57,68,7,117,110,105,48,52,65,49,7,117,110,105,48,52,65,51,7,117,110,105,48,52,65,53,7,117,110,105,48,53,50,53,7,117,110,105,48,52,65,66,7,117,110,105,48,52,65,70,7,117,110,105,48,52,66,49,7,117,110,105,48,52,66,51,7,117,110,105,48,52,66,55,7,117,110,105,48,52,66,57,7,117,110,105,48,52,66,66,7,117,110,105,48,52,67,70,7,117,110,105,48,52,67,50,7,117,110,105,48,52,67,67,7,117,110,105,48,52,68,49,7,117,110,105,48,52,68,51,7,117,110,105,48,52,68,53,7,117,110,105,48,52,68,55,7,117,110,105,48,52,68,57,7,117,110,105,48,52,68,68,7,117,110,105,48,52,68,70,7,117,110,105,48,52,69,51,7,117,110,105,48,52,69,53,7,117,110,105,48,52,69,55,7,117,110,105,48,52,69,57,7,117,110,105,48,52,69,70,7,117,110,105,48,52,70,49,7,117,110,105,48,52,70,51,7,117,110,105,48,52,70,53,7,117,110,105,48,52,70,55,7,117,110,105,48,52,70,57,7,117,110,105,48,53,49,66,7,117,110,105,48,53,49,68,12,117,110,105,48,52,52,67,46,99,111,110,100,15,117,110,105,48,52,57,51,46,108,111,99,108,66,83,72,15,117,110,105,48,52,57,57,46,108,111,99,108,66,83,72,15,117,110,105,48,52,65,66,46,108,111,99,108,67,72,85,15,117,110,105,48,52,51,49,46,108,111,99,108,83,82,66,10,117,110,105,48,52,51,48,46,115,99,10,117,110,105,48,52,51,49,46,115,99,10,117,110,105,48,52,51,50,46,115,99,10,117,110,105,48,52,51,51,46,115,99,10,117,110,105,48,52,53,51,46,115,99,10,117,110,105,48,52,57,49,46,115,99,10,117,110,105,48,52,51,52,46,115,99,10,117,110,105,48,52,51,53,46,115,99,10,117,110,105,48,52,53,48,46,115,99,10,117,110,105,48,52,53,49,46,115,99,10,117,110,105,48,52,51,54,46,115,99,10,117,110,105,48,52,51,55,46,115,99,10,117,110,105,48,52,51,56,46,115,99,10,117,110,105,48,52,51,57,46,115,99,10,117,110,105,48,52,53,68,46,115,99,10,117,110,105,48,52,51,65,46,115,99,10,117,110,105,48,52,53,67,46,115,99,10,117,110,105,48,52,51,66,46,115,99,10,117,110,105,48,52,51,67,46,115,99,10,117,110,105,48,52,51,68,46,115,99,10,117,110,105,48,52,51,69,46,115,99,10,117,110,105,48,52,51,70,46,115,99,10,117,110,105,48,52,52,48,46,115,99,10,117,110,105,48,52,52,49,46,115,99,10,117,110,105,48,52,52,50,46,115,99,10,117,110,105,48,52,52,51,46,115,99,10,117,110,105,48,52,53,69,46,115,99,10,117,110,105,48,52,52,52,46,115,99,10,117,110,105,48,52,52,53,46,115,99,10,117,110,105,48,52,52,55,46,115,99,10,117,110,105,48,52,52,54,46,115,99,10,117,110,105,48,52,52,56,46,115,99,10,117,110,105,48,52,52,57,46,115,99,10,117,110,105,48,52,53,70,46,115,99,10,117,110,105,48,52,52,67,46,115,99,10,117,110,105,48,52,52,65,46,115,99,10,117,110,105,48,52,52,66,46,115,99,10,117,110,105,48,52,53,57,46,115,99,10,117,110,105,48,52,53,65,46,115,99,10,117,110,105,48,52,53,53,46,115,99,10,117,110,105,48,52,53,52,46,115,99,10,117,110,105,48,52,52,68,46,115,99,10,117,110,105,48,52,53,54,46,115,99,10,117,110,105,48,52,53,55,46,115,99,10,117,110,105,48,52,53,56,46,115,99,10,117,110,105,48,52,53,66,46,115,99,10,117,110,105,48,52,52,69,46,115,99,10,117,110,105,48,52,52,70,46,115,99,10,117,110,105,48,52,53,50,46,115,99,10,117,110,105,48,52,54,51,46,115,99,10,117,110,105,48,52,54,66,46,115,99,10,117,110,105,48,52,55,51,46,115,99,10,117,110,105,48,52,55,53,46,115,99,10,117,110,105,48,52,57,51,46,115,99,10,117,110,105,48,52,57,53,46,115,99,10,117,110,105,48,52,57,55,46,115,99,10,117,110,105,48,52,57,57,46,115,99,10,117,110,105,48,52,57,66,46,115,99,10,117,110,105,48,52,57,68,46,115,99,10,117,110,105,48,52,65,49,46,115,99,10,117,110,105,48,52,65,51,46,115,99,10,117,110,105,48,52,65,53,46,115,99,10,117,110,105,48,53,50,53,46,115,99,10,117,110,105,48,52,65,66,46,115,99,10,117,110,105,48,52,65,70,46,115,99,10,117,110,105,48,52,66,49,46,115,99,10,117,110,105,48,52,66,51,46,115,99,10,117,110,105,48,52,66,55,46,115,99,10,117,110,105,48,52,66,57,46,115,99,10,117,110,105,48,52,66,66,46,115,99,10,117,110,105,48,52,67,70,46,115,99,10,117,110,105,48,52,67,50,46,115,99,10,117,110,105,48,52,67,67,46,115,99,10,117,110,105,48,52,68,49,46,115,99,10,117,110,105,48,52,68,51,46,115,99,10,117,110,105,48,52,68,53,46,115,99,10,117,110,105,48,52,68,55,46,115,99,10,117,110,105,48,52,68,57,46,115,99,10,117,110,105,48,52,68,68,46,115,99,10,117,110,105,48,52,68,70,46,115,99,10,117,110,105,48,52,69,51,46,115,99,10,117,110,105,48,52,69,53,46,115,99,10,117,110,105,48,52,69,55,46,115,99,10,117,110,105,48,52,69,57,46,115,99,10,117,110,105,48,52,69,70,46,115,99,10,117,110,105,48,52,70,49,46,115,99,10,117,110,105,48,52,70,51,46,115,99,10,117,110,105,48,52,70,53,46,115,99,10,117,110,105,48,52,70,55,46,115,99,10,117,110,105,48,52,70,57,46,115,99,10,117,110,105,48,53,49,66,46,115,99,10,117,110,105,48,53,49,68,46,115,99,18,117,110,105,48,52,57,51,46,108,111,99,108,66,83,72,46,115,99,18,117,110,105,48,52,57,57,46,108,111,99,108,66,83,72,46,115,99,18,117,110,105,48,52,65,66,46,108,111,99,108,67,72,85,46,115,99,5,65,108,112,104,97,4,66,101,116,97,5,71,97,109,109,97,7,117,110,105,48,51,57,52,7,69,112,115,105,108,111,110,4,90,101,116,97,3,69,116,97,5,84,104,101,116,97,4,73,111,116,97,5,75,97,112,112,97,6,76,97,109,98,100,97,2,77,117,2,78,117,2,88,105,7,79,109,105,99,114,111,110,2,80,105,3,82,104,111,5,83,105,103,109,97,3,84,97,117,7,85,112,115,105,108,111,110,3,80,104,105,3,67,104,105,3,80,115,105,7,117,110,105,48,51,65,57,10,65,108,112,104,97,116,111,110,111,115,12,69,112,115,105,108,111,110,116,111,110,111,115,8,69,116,97,116,111,110,111,115,9,73,111,116,97,116,111,110,111,115,12,79,109,105,99,114,111,110,116,111,110,111,115,12,85,112,115,105,108,111,110,116,111,110,111,115,10,79,109,101,103,97,116,111,110,111,115,12,73,111,116,97,100,105,101,114,101,115,105,115,15,85,112,115,105,108,111,110,100,105,101,114,101,115,105,115,7,117,110,105,48,51,67,70,7,117,110,105,49,70,48,56,7,117,110,105,49,70,48,57,7,117,110,105,49,70,48,65,7,117,110,105,49,70,48,66,7,117,110,105,49,70,48,67,7,117,110,105,49,70,48,68,7,117,110,105,49,70,48,69,7,117,110,105,49,70,48,70,7,117,110,105,49,70,66,65,7,117,110,105,49,70,66,66,7,117,110,105,49,70,66,56,7,117,110,105,49,70,66,57,7,117,110,105,49,70,66,67,7,117,110,105,49,70,56,56,7,117,110,105,49,70,56,57,7,117,110,105,49,70,56,65,7,117,110,105,49,70,56,66,7,117,110,105,49,70,56,67,7,117,110,105,49,70,56,68,7,117,110,105,49,70,56,69,7,117,110,105,49,70,56,70,7,117,110,105,49,70,49,56,7,117,110,105,49,70,49,57,7,117,110,105,49,70,49,65,7,117,110,105,49,70,49,66,7,117,110,105,49,70,49,67,7,117,110,105,49,70,49,68,7,117,110,105,49,70,67,56,7,117,110,105,49,70,67,57,7,117,110,105,49,70,50,56,7,117,110,105,49,70,50,57,7,117,110,105,49,70,50,65,7,117,110,105,49,70,50,66,7,117,110,105,49,70,50,67,7,117,110,105,49,70,50,68,7,117,110,105,49,70,50,69,7,117,110,105,49,70,50,70,7,117,110,105,49,70,67,65,7,117,110,105,49,70,67,66,7,117,110,105,49,70,67,67,7,117,110,105,49,70,57,56,7,117,110,105,49,70,57,57,7,117,110,105,49,70,57,65,7,117,110,105,49,70,57,66,7,117,110,105,49,70,57,67,7,117,110,105,49,70,57,68,7,117,110,105,49,70,57,69,7,117,110,105,49,70,57,70,7,117,110,105,49,70,51,56,7,117,110,105,49,70,51,57,7,117,110,105,49,70,51,65,7,117,110,105,49,70,51,66,7,117,110,105,49,70,51,67,7,117,110,105,49,70,51,68,7,117,110,105,49,70,51,69,7,117,110,105,49,70,51,70,7,117,110,105,49,70,68,65,7,117,110,105,49,70,68,66,7,117,110,105,49,70,68,56,7,117,110,105,49,70,68,57,7,117,110,105,49,70,52,56,7,117,110,105,49,70,52,57,7,117,110,105,49,70,52,65,7,117,110,105,49,70,52,66,7,117,110,105,49,70,52,67,7,117,110,105,49,70,52,68,7,117,110,105,49,70,70,56,7,117,110,105,49,70,70,57,7,117,110,105,49,70,69,67,7,117,110,105,49,70,53,57,7,117,110,105,49,70,53,66,7,117,110,105,49,70,53,68,7,117,110,105,49,70,53,70,7,117,110,105,49,70,69,65,7,117,110,105,49,70,69,66,7,117,110,105,49,70,69,56,7,117,110,105,49,70,69,57,7,117,110,105,49,70,54,56,7,117,110,105,49,70,54,57,7,117,110,105,49,70,54,65,7,117,110,105,49,70,54,66,7,117,110,105,49,70,54,67,7,117,110,105,49,70,54,68,7,117,110,105,49,70,54,69,7,117,110,105,49,70,54,70,7,117,110,105,49,70,70,65,7,117,110,105,49,70,70,66,7,117,110,105,49,70,70,67,7,117,110,105,49,70,65,56,7,117,110,105,49,70,65,57,7,117,110,105,49,70,65,65,7,117,110,105,49,70,65,66,7,117,110,105,49,70,65,67,7,117,110,105,49,70,65,68,7,117,110,105,49,70,65,69,7,117,110,105,49,70,65,70,12,117,110,105,49,70,66,67,46,115,115,48,53,12,117,110,105,49,70,56,56,46,115,115,48,53,12,117,110,105,49,70,56,57,46,115,115,48,53,12,117,110,105,49,70,56,65,46,115,115,48,53,12,117,110,105,49,70,56,66,46,115,115,48,53,12,117,110,105,49,70,56,67,46,115,115,48,53,12,117,110,105,49,70,56,68,46,115,115,48,53,12,117,110,105,49,70,56,69,46,115,115,48,53,12,117,110,105,49,70,56,70,46,115,115,48,53,12,117,110,105,49,70,67,67,46,115,115,48,53,12,117,110,105,49,70,57,56,46,115,115,48,53,12,117,110,105,49,70,57,57,46,115,115,48,53,12,117,110,105,49,70,57,65,46,115,115,48,53,12,117,110,105,49,70,57,66,46,115,115,48,53,12,117,110,105,49,70,57,67,46,115,115,48,53,12,117,110,105,49,70,57,68,46,115,115,48,53,12,117,110,105,49,70,57,69,46,115,115,48,53,12,117,110,105,49,70,57,70,46,115,115,48,53,12,117,110,105,49,70,70,67,46,115,115,48,53,12,117,110,105,49,70,65,56,46,115,115,48,53,12,117,110,105,49,70,65,57,46,115,115,48,53,12,117,110,105,49,70,65,65,46,115,115,48,53,12,117,110,105,49,70,65,66,46,115,115,48,53,12,117,110,105,49,70,65,67,46,115,115,48,53,12,117,110,105,49,70,65,68,46,115,115,48,53,12,117,110,105,49,70,65,69,46,115,115,48,53,12,117,110,105,49,70,65,70,46,115,115,48,53,5,97,108,112,104,97,4,98,101,116,97,5,103,97,109,109,97,5,100,101,108,116,97,7,101,112,115,105,108,111,110,4,122,101,116,97,3,101,116,97,5,116,104,101,116,97,4,105,111,116,97,5,107,97,112,112,97,6,108,97,109,98,100,97,7,117,110,105,48,51,66,67,2,110,117,2,120,105,7,111,109,105,99,114,111,110,3,114,104,111,7,117,110,105,48,51,67,50,5,115,105,103,109,97,3,116,97,117,7,117,112,115,105,108,111,110,3,112,104,105,3,99,104,105,3,112,115,105,5,111,109,101,103,97,9,105,111,116,97,116,111,110,111,115,12,105,111,116,97,100,105,101,114,101,115,105,115,17,105,111,116,97,100,105,101,114,101,115,105,115,116,111,110,111,115,12,117,112,115,105,108,111,110,116,111,110,111,115,15,117,112,115,105,108,111,110,100,105,101,114,101,115,105,115,20,117,112,115,105,108,111,110,100,105,101,114,101,115,105,115,116,111,110,111,115,12,111,109,105,99,114,111,110,116,111,110,111,115,10,111,109,101,103,97,116,111,110,111,115,10,97,108,112,104,97,116,111,110,111,115,12,101,112,115,105,108,111,110,116,111,110,111,115,8,101,116,97,116,111,110,111,115,7,117,110,105,48,51,68,55,7,117,110,105,48,51,68,49,7,117,110,105,48,51,68,53,7,117,110,105,48,51,68,54,7,117,110,105,48,51,70,48,7,117,110,105,49,70,48,48,7,117,110,105,49,70,48,49,7,117,110,105,49,70,48,50,7,117,110,105,49,70,48,51,7,117,110,105,49,70,48,52,7,117,110,105,49,70,48,53,7,117,110,105,49,70,48,54,7,117,110,105,49,70,48,55,7,117,110,105,49,70,55,48,7,117,110,105,49,70,55,49,7,117,110,105,49,70,66,54,7,117,110,105,49,70,66,48,7,117,110,105,49,70,66,49,7,117,110,105,49,70,66,51,7,117,110,105,49,70,66,50,7,117,110,105,49,70,66,52,7,117,110,105,49,70,56,48,7,117,110,105,49,70,56,49,7,117,110,105,49,70,56,50,7,117,110,105,49,70,56,51,7,117,110,105,49,70,56,52,7,117,110,105,49,70,56,53,7,117,110,105,49,70,56,54,7,117,110,105,49,70,56,55,7,117,110,105,49,70,66,55,7,117,110,105,49,70,49,48,7,117,110,105,49,70,49,49,7,117,110,105,49,70,49,50,7,117,110,105,49,70,49,51,7,117,110,105,49,70,49,52,7,117,110,105,49,70,49,53,7,117,110,105,49,70,55,50,7,117,110,105,49,70,55,51,7,117,110,105,49,70,50,48,7,117,110,105,49,70,50,49,7,117,110,105,49,70,50,50,7,117,110,105,49,70,50,51,7,117,110,105,49,70,50,52,7,117,110,105,49,70,50,53,7,117,110,105,49,70,50,54,7,117,110,105,49,70,50,55,7,117,110,105,49,70,55,52,7,117,110,105,49,70,55,53,7,117,110,105,49,70,67,54,7,117,110,105,49,70,67,51,7,117,110,105,49,70,67,50,7,117,110,105,49,70,67,52,7,117,110,105,49,70,57,48,7,117,110,105,49,70,57,49,7,117,110,105,49,70,57,50,7,117,110,105,49,70,57,51,7,117,110,105,49,70,57,52,7,117,110,105,49,70,57,53,7,117,110,105,49,70,57,54,7,117,110,105,49,70,57,55,7,117,110,105,49,70,67,55,7,117,110,105,49,70,51,48,7,117,110,105,49,70,51,49,7,117,110,105,49,70,51,50,7,117,110,105,49,70,51,51,7,117,110,105,49,70,51,52,7,117,110,105,49,70,51,53,7,117,110,105,49,70,51,54,7,117,110,105,49,70,51,55,7,117,110,105,49,70,55,54,7,117,110,105,49,70,55,55,7,117,110,105,49,70,68,54,7,117,110,105,49,70,68,48,7,117,110,105,49,70,68,49,7,117,110,105,49,70,68,50,7,117,110,105,49,70,68,51,7,117,110,105,49,70,68,55,7,117,110,105,49,70,52,48,7,117,110,105,49,70,52,49,7,117,110,105,49,70,52,50,7,117,110,105,49,70,52,51,7,117,110,105,49,70,52,52,7,117,110,105,49,70,52,53,7,117,110,105,49,70,55,56,7,117,110,105,49,70,55,57,7,117,110,105,49,70,69,52,7,117,110,105,49,70,69,53,7,117,110,105,49,70,53,48,7,117,110,105,49,70,53,49,7,117,110,105,49,70,53,50,7,117,110,105,49,70,53,51,7,117,110,105,49,70,53,52,7,117,110,105,49,70,53,53,7,117,110,105,49,70,53,54,7,117,110,105,49,70,53,55,7,117,110,105,49,70,55,65,7,117,110,105,49,70,55,66,7,117,110,105,49,70,69,54,7,117,110,105,49,70,69,48,7,117,110,105,49,70,69,49,7,117,110,105,49,70,69,50,7,117,110,105,49,70,69,51,7,117,110,105,49,70,69,55,7,117,110,105,49,70,54,48,7,117,110,105,49,70,54,49,7,117,110,105,49,70,54,50,7,117,110,105,49,70,54,51,7,117,110,105,49,70,54,52,7,117,110,105,49,70,54,53,7,117,110,105,49,70,54,54,7,117,110,105,49,70,54,55,7,117,110,105,49,70,55,67,7,117,110,105,49,70,55,68,7,117,110,105,49,70,70,54,7,117,110,105,49,70,70,51,7,117,110,105,49,70,70,50,7,117,110,105,49,70,70,52,7,117,110,105,49,70,65,48,7,117,110,105,49,70,65,49,7,117,110,105,49,70,65,50,7,117,110,105,49,70,65,51,7,117,110,105,49,70,65,52,7,117,110,105,49,70,65,53,7,117,110,105,49,70,65,54,7,117,110,105,49,70,65,55,7,117,110,105,49,70,70,55,7,117,110,105,49,70,66,69,11,103,97,109,109,97,95,103,97,109,109,97,13,108,97,109,98,100,97,95,108,97,109,98,100,97,8,97,108,112,104,97,46,115,99,7,98,101,116,97,46,115,99,8,103,97,109,109,97,46,115,99,8,100,101,108,116,97,46,115,99,10,101,112,115,105,108,111,110,46,115,99,7,122,101,116,97,46,115,99,6,101,116,97,46,115,99,8,116,104,101,116,97,46,115,99,7,105,111,116,97,46,115,99,8,107,97,112,112,97,46,115,99,9,108,97,109,98,100,97,46,115,99,10,117,110,105,48,51,66,67,46,115,99,5,110,117,46,115,99,5,120,105,46,115,99,10,111,109,105,99,114,111,110,46,115,99,5,112,105,46,115,99,6,114,104,111,46,115,99,10,117,110,105,48,51,67,50,46,115,99,8,115,105,103,109,97,46,115,99,6,116,97,117,46,115,99,10,117,112,115,105,108,111,110,46,115,99,6,112,104,105,46,115,99,6,99,104,105,46,115,99,6,112,115,105,46,115,99,8,111,109,101,103,97,46,115,99,12,105,111,116,97,116,111,110,111,115,46,115,99,15,105,111,116,97,100,105,101,114,101,115,105,115,46,115,99,20,105,111,116,97,100,105,101,114,101,115,105,115,116,111,110,111,115,46,115,99,15,117,112,115,105,108,111,110,116,111,110,111,115,46,115,99,18,117,112,115,105,108,111,110,100,105,101,114,101,115,105,115,46,115,99,23,117,112,115,105,108,111,110,100,105,101,114,101,115,105,115,116,111,110,111,115,46,115,99,15,111,109,105,99,114,111,110,116,111,110,111,115,46,115,99,13,111,109,101,103,97,116,111,110,111,115,46,115,99,13,97,108,112,104,97,116,111,110,111,115,46,115,99,15,101,112,115,105,108,111,110,116,111,110,111,115,46,115,99,11,101,116,97,116,111,110,111,115,46,115,99,10,117,110,105,49,70,66,69,46,115,99,10,117,110,105,48,51,68,55,46,115,99,10,117,110,105,49,70,48,48,46,115,99,10,117,110,105,49,70,48,49,46,115,99,10,117,110,105,49,70,48,50,46,115,99,10,117,110,105,49,70,48,51,46,115,99,10,117,110,105,49,70,48,52,46,115,99,10,117,110,105,49,70,48,53,46,115,99,10,117,110,105,49,70,48,54,46,115,99,10,117,110,105,49,70,48,55,46,115,99,10,117,110,105,49,70,55,48,46,115,99,10,117,110,105,49,70,55,49,46,115,99,10,117,110,105,49,70,66,54,46,115,99,10,117,110,105,49,70,66,48,46,115,99,10,117,110,105,49,70,66,49,46,115,99,10,117,110,105,49,70,66,51,46,115,99,10,117,110,105,49,70,66,50,46,115,99,10,117,110,105,49,70,66,52,46,115,99,10,117,110,105,49,70,56,48,46,115,99,10,117,110,105,49,70,56,49,46,115,99,10,117,110,105,49,70,56,50,46,115,99,10,117,110,105,49,70,56,51,46,115,99,10,117,110,105,49,70,56,52,46,115,99,10,117,110,105,49,70,56,53,46,115,99,10,117,110,105,49,70,56,54,46,115,99,10,117,110,105,49,70,56,55,46,115,99,10,117,110,105,49,70,66,55,46,115,99,10,117,110,105,49,70,49,48,46,115,99,10,117,110,105,49,70,49,49,46,115,99,10,117,110,105,49,70,49,50,46,115,99,10,117,110,105,49,70,49,51,46,115,99,10,117,110,105,49,70,49,52,46,115,99,10,117,110,105,49,70,49,53,46,115,99,10,117,110,105,49,70,55,50,46,115,99,10,117,110,105,49,70,55,51,46,115,99,10,117,110,105,49,70,50,48,46,115,99,10,117,110,105,49,70,50,49,46,115,99,10,117,110,105,49,70,50,50,46,115,99,10,117,110,105,49,70,50,51,46,115,99,10,117,110,105,49,70,50,52,46,115,99,10,117,110,105,49,70,50,53,46,115,99,10,117,110,105,49,70,50,54,46,115,99,10,117,110,105,49,70,50,55,46,115,99,10,117,110,105,49,70,55,52,46,115,99,10,117,110,105,49,70,55,53,46,115,99,10,117,110,105,49,70,67,54,46,115,99,10,117,110,105,49,70,67,51,46,115,99,10,117,110,105,49,70,67,50,46,115,99,10,117,110,105,49,70,67,52,46,115,99,10,117,110,105,49,70,57,48,46,115,99,10,117,110,105,49,70,57,49,46,115,99,10,117,110,105,49,70,57,50,46,115,99,10,117,110,105,49,70,57,51,46,115,99,10,117,110,105,49,70,57,52,46,115,99,10,117,110,105,49,70,57,53,46,115,99,10,117,110,105,49,70,57,54,46,115,99,10,117,110,105,49,70,57,55,46,115,99,10,117,110,105,49,70,67,55,46,115,99,10,117,110,105,49,70,51,48,46,115,99,10,117,110,105,49,70,51,49,46,115,99,10,117,110,105,49,70,51,50,46,115,99,10,117,110,105,49,70,51,51,46,115,99,10,117,110,105,49,70,51,52,46,115,99,10,117,110,105,49,70,51,53,46,115,99,10,117,110,105,49,70,51,54,46,115,99,10,117,110,105,49,70,51,55,46,115,99,10,117,110,105,49,70,55,54,46,115,99,10,117,110,105,49,70,55,55,46,115,99,10,117,110,105,49,70,68,54,46,115,99,10,117,110,105,49,70,68,48,46,115,99,10,117,110,105,49,70,68,49,46,115,99,10,117,110,105,49,70,68,50,46,115,99,10,117,110,105,49,70,68,51,46,115,99,10,117,110,105,49,70,68,55,46,115,99,10,117,110,105,49,70,52,48,46,115,99,10,117,110,105,49,70,52,49,46,115,99,10,117,110,105,49,70,52,50,46,115,99,10,117,110,105,49,70,52,51,46,115,99,10,117,110,105,49,70,52,52,46,115,99,10,117,110,105,49,70,52,53,46,115,99,10,117,110,105,49,70,55,56,46,115,99,10,117,110,105,49,70,55,57,46,115,99,10,117,110,105,49,70,69,52,46,115,99,10,117,110,105,49,70,69,53,46,115,99,10,117,110,105,49,70,53,48,46,115,99,10,117,110,105,49,70,53,49,46,115,99,10,117,110,105,49,70,53,50,46,115,99,10,117,110,105,49,70,53,51,46,115,99,10,117,110,105,49,70,53,52,46,115,99,10,117,110,105,49,70,53,53,46,115,99,10,117,110,105,49,70,53,54,46,115,99,10,117,110,105,49,70,53,55,46,115,99,10,117,110,105,49,70,55,65,46,115,99,10,117,110,105,49,70,55,66,46,115,99,10,117,110,105,49,70,69,54,46,115,99,10,117,110,105,49,70,69,48,46,115,99,10,117,110,105,49,70,69,49,46,115,99,10,117,110,105,49,70,69,50,46,115,99,10,117,110,105,49,70,69,51,46,115,99,10,117,110,105,49,70,69,55,46,115,99,10,117,110,105,49,70,54,48,46,115,99,10,117,110,105,49,70,54,49,46,115,99,10,117,110,105,49,70,54,50,46,115,99,10,117,110,105,49,70,54,51,46,115,99,10,117,110,105,49,70,54,52,46,115,99,10,117,110,105,49,70,54,53,46,115,99,10,117,110,105,49,70,54,54,46,115,99,10,117,110,105,49,70,54,55,46,115,99,10,117,110,105,49,70,55,67,46,115,99,10,117,110,105,49,70,55,68,46,115,99,10,117,110,105,49,70,70,54,46,115,99,10,117,110,105,49,70,70,51,46,115,99,10,117,110,105,49,70,70,50,46,115,99,10,117,110,105,49,70,70,52,46,115,99,10,117,110,105,49,70,65,48,46,115,99,10,117,110,105,49,70,65,49,46,115,99,10,117,110,105,49,70,65,50,46,115,99,10,117,110,105,49,70,65,51,46,115,99,10,117,110,105,49,70,65,52,46,115,99,10,117,110,105,49,70,65,53,46,115,99,10,117,110,105,49,70,65,54,46,115,99,10,117,110,105,49,70,65,55,46,115,99,10,117,110,105,49,70,70,55,46,115,99,15,117,110,105,49,70,66,67,46,115,99,46,115,115,48,53,15,117,110,105,49,70,56,56,46,115,99,46,115,115,48,53,15,117,110,105,49,70,56,57,46,115,99,46,115,115,48,53,15,117,110,105,49,70,56,65,46,115,99,46,115,115,48,53,15,117,110,105,49,70,56,66,46,115,99,46,115,115,48,53,15,117,110,105,49,70,56,67,46,115,99,46,115,115,48,53,15,117,110,105,49,70,56,68,46,115,99,46,115,115,48,53,15,117,110,105,49,70,56,69,46,115,99,46,115,115,48,53,15,117,110,105,49,70,56,70,46,115,99,46,115,115,48,53,15,117,110,105,49,70,67,67,46,115,99,46,115,115,48,53,15,117,110,105,49,70,57,56,46,115,99,46,115,115,48,53,15,117,110,105,49,70,57,57,46,115,99,46,115,115,48,53,15,117,110,105,49,70,57,65,46,115,99,46,115,115,48,53,15,117,110,105,49,70,57,66,46,115,99,46,115,115,48,53,15,117,110,105,49,70,57,67,46,115,99,46,115,115,48,53,15,117,110,105,49,70,57,68,46,115,99,46,115,115,48,53,15,117,110,105,49,70,57,69,46,115,99,46,115,115,48,53,15,117,110,105,49,70,57,70,46,115,99,46,115,115,48,53,15,117,110,105,49,70,70,67,46,115,99,46,115,115,48,53,15,117,110,105,49,70,65,56,46,115,99,46,115,115,48,53,15,117,110,105,49,70,65,57,46,115,99,46,115,115,48,53,15,117,110,105,49,70,65,65,46,115,99,46,115,115,48,53,15,117,110,105,49,70,65,66,46,115,99,46,115,115,48,53,15,117,110,105,49,70,65,67,46,115,99,46,115,115,48,53,15,117,110,105,49,70,65,68,46,115,99,46,115,115,48,53,15,117,110,105,49,70,65,69,46,115,99,46,115,115,48,53,15,117,110,105,49,70,65,70,46,115,99,46,115,115,48,53,15,117,110,105,49,70,66,51,46,115,99,46,115,115,48,53,15,117,110,105,49,70,66,50,46,115,99,46,115,115,48,53,15,117,110,105,49,70,66,52,46,115,99,46,115,115,48,53,15,117,110,105,49,70,56,48,46,115,99,46,115,115,48,53,15,117,110,105,49,70,56,49,46,115,99,46,115,115,48,53,15,117,110,105,49,70,56,50,46,115,99,46,115,115,48,53,15,117,110,105,49,70,56,51,46,115,99,46,115,115,48,53,15,117,110,105,49,70,56,52,46,115,99,46,115,115,48,53,15,117,110,105,49,70,56,53,46,115,99,46,115,115,48,53,15,117,110,105,49,70,56,54,46,115,99,46,115,115,48,53,15,117,110,105,49,70,56,55,46,115,99,46,115,115,48,53,15,117,110,105,49,70,66,55,46,115,99,46,115,115,48,53,15,117,110,105,49,70,67,51,46,115,99,46,115,115,48,53,15,117,110,105,49,70,67,50,46,115,99,46,115,115,48,53,15,117,110,105,49,70,67,52,46,115,99,46,115,115,48,53,15,117,110,105,49,70,57,48,46,115,99,46,115,115,48,53,15,117,110,105,49,70,57,49,46,115,99,46,115,115,48,53,15,117,110,105,49,70,57,50,46,115,99,46,115,115,48,53,15,117,110,105,49,70,57,51,46,115,99,46,115,115,48,53,15,117,110,105,49,70,57,52,46,115,99,46,115,115,48,53,15,117,110,105,49,70,57,53,46,115,99,46,115,115,48,53,15,117,110,105,49,70,57,54,46,115,99,46,115,115,48,53,15,117,110,105,49,70,57,55,46,115,99,46,115,115,48,53,15,117,110,105,49,70,67,55,46,115,99,46,115,115,48,53,15,117,110,105,49,70,70,51,46,115,99,46,115,115,48,53,15,117,110,105,49,70,70,50,46,115,99,46,115,115,48,53,15,117,110,105,49,70,70,52,46,115,99,46,115,115,48,53,15,117,110,105,49,70,65,48,46,115,99,46,115,115,48,53,15,117,110,105,49,70,65,49,46,115,99,46,115,115,48,53,15,117,110,105,49,70,65,50,46,115,99,46,115,115,48,53,15,117,110,105,49,70,65,51,46,115,99,46,115,115,48,53,15,117,110,105,49,70,65,52,46,115,99,46,115,115,48,53,15,117,110,105,49,70,65,53,46,115,99,46,115,115,48,53,15,117,110,105,49,70,65,54,46,115,99,46,115,115,48,53,15,117,110,105,49,70,65,55,46,115,99,46,115,115,48,53,15,117,110,105,49,70,70,55,46,115,99,46,115,115,48,53,7,117,110,105,48,51,55,65,10,65,108,112,104,97,46,115,117,112,115,9,66,101,116,97,46,115,117,112,115,10,71,97,109,109,97,46,115,117,112,115,12,117,110,105,48,51,57,52,46,115,117,112,115,12,69,112,115,105,108,111,110,46,115,117,112,115,9,90,101,116,97,46,115,117,112,115,8,69,116,97,46,115,117,112,115,10,84,104,101,116,97,46,115,117,112,115,9,73,111,116,97,46,115,117,112,115,10,75,97,112,112,97,46,115,117,112,115,11,76,97,109,98,100,97,46,115,117,112,115,7,77,117,46,115,117,112,115,7,78,117,46,115,117,112,115,7,88,105,46,115,117,112,115,12,79,109,105,99,114,111,110,46,115,117,112,115,7,80,105,46,115,117,112,115,8,82,104,111,46,115,117,112,115,10,83,105,103,109,97,46,115,117,112,115,8,84,97,117,46,115,117,112,115,12,85,112,115,105,108,111,110,46,115,117,112,115,8,80,104,105,46,115,117,112,115,8,67,104,105,46,115,117,112,115,8,80,115,105,46,115,117,112,115,12,117,110,105,48,51,65,57,46,115,117,112,115,10,97,108,112,104,97,46,115,117,112,115,9,98,101,116,97,46,115,117,112,115,10,103,97,109,109,97,46,115,117,112,115,10,100,101,108,116,97,46,115,117,112,115,12,101,112,115,105,108,111,110,46,115,117,112,115,9,122,101,116,97,46,115,117,112,115,8,101,116,97,46,115,117,112,115,10,116,104,101,116,97,46,115,117,112,115,9,105,111,116,97,46,115,117,112,115,10,107,97,112,112,97,46,115,117,112,115,11,108,97,109,98,100,97,46,115,117,112,115,12,117,110,105,48,51,66,67,46,115,117,112,115,7,110,117,46,115,117,112,115,7,120,105,46,115,117,112,115,12,111,109,105,99,114,111,110,46,115,117,112,115,7,112,105,46,115,117,112,115,8,114,104,111,46,115,117,112,115,12,117,110,105,48,51,67,50,46,115,117,112,115,10,115,105,103,109,97,46,115,117,112,115,8,116,97,117,46,115,117,112,115,12,117,112,115,105,108,111,110,46,115,117,112,115,8,112,104,105,46,115,117,112,115,8,99,104,105,46,115,117,112,115,8,112,115,105,46,115,117,112,115,10,111,109,101,103,97,46,115,117,112,115,7,122,101,114,111,46,108,102,6,111,110,101,46,108,102,6,116,119,111,46,108,102,8,116,104,114,101,101,46,108,102,7,102,111,117,114,46,108,102,7,102,105,118,101,46,108,102,6,115,105,120,46,108,102,8,115,101,118,101,110,46,108,102,8,101,105,103,104,116,46,108,102,7,110,105,110,101,46,108,102,9,122,101,114,111,46,115,105,110,102,8,111,110,101,46,115,105,110,102,8,116,119,111,46,115,105,110,102,10,116,104,114,101,101,46,115,105,110,102,9,102,111,117,114,46,115,105,110,102,9,102,105,118,101,46,115,105,110,102,8,115,105,120,46,115,105,110,102,10,115,101,118,101,110,46,115,105,110,102,10,101,105,103,104,116,46,115,105,110,102,9,110,105,110,101,46,115,105,110,102,7,122,101,114,111,46,116,102,6,111,110,101,46,116,102,6,116,119,111,46,116,102,8,116,104,114,101,101,46,116,102,7,102,111,117,114,46,116,102,7,102,105,118,101,46,116,102,6,115,105,120,46,116,102,8,115,101,118,101,110,46,116,102,8,101,105,103,104,116,46,116,102,7,110,105,110,101,46,116,102,9,122,101,114,111,46,116,111,115,102,8,111,110,101,46,116,111,115,102,8,116,119,111,46,116,111,115,102,10,116,104,114,101,101,46,116,111,115,102,9,102,111,117,114,46,116,111,115,102,9,102,105,118,101,46,116,111,115,102,8,115,105,120,46,116,111,115,102,10,115,101,118,101,110,46,116,111,115,102,10,101,105,103,104,116,46,116,111,115,102,9,110,105,110,101,46,116,111,115,102,9,122,101,114,111,46,115,117,98,115,8,111,110,101,46,115,117,98,115,8,116,119,111,46,115,117,98,115,7,117,110,105,50,48,56,48,7,117,110,105,50,48,56,49,7,117,110,105,50,48,56,50,7,117,110,105,50,48,56,51,7,117,110,105,50,48,56,52,7,117,110,105,50,48,56,53,7,117,110,105,50,48,56,54,7,117,110,105,50,48,56,55,7,117,110,105,50,48,56,56,7,117,110,105,50,48,56,57,10,116,104,114,101,101,46,115,117,98,115,9,102,111,117,114,46,115,117,98,115,9,102,105,118,101,46,115,117,98,115,8,115,105,120,46,115,117,98,115,10,115,101,118,101,110,46,115,117,98,115,10,101,105,103,104,116,46,115,117,98,115,9,110,105,110,101,46,115,117,98,115,9,122,101,114,111,46,100,110,111,109,8,111,110,101,46,100,110,111,109,8,116,119,111,46,100,110,111,109,10,116,104,114,101,101,46,100,110,111,109,9,102,111,117,114,46,100,110,111,109,9,102,105,118,101,46,100,110,111,109,8,115,105,120,46,100,110,111,109,10,115,101,118,101,110,46,100,110,111,109,10,101,105,103,104,116,46,100,110,111,109,9,110,105,110,101,46,100,110,111,109,9,122,101,114,111,46,110,117,109,114,8,111,110,101,46,110,117,109,114,8,116,119,111,46,110,117,109,114,10,116,104,114,101,101,46,110,117,109,114,9,102,111,117,114,46,110,117,109,114,9,102,105,118,101,46,110,117,109,114,8,115,105,120,46,110,117,109,114,10,115,101,118,101,110,46,110,117,109,114,10,101,105,103,104,116,46,110,117,109,114,9,110,105,110,101,46,110,117,109,114,7,117,110,105,50,48,55,48,7,117,110,105,48,48,66,57,7,117,110,105,48,48,66,50,7,117,110,105,48,48,66,51,7,117,110,105,50,48,55,52,7,117,110,105,50,48,55,53,7,117,110,105,50,48,55,54,7,117,110,105,50,48,55,55,7,117,110,105,50,48,55,56,7,117,110,105,50,48,55,57,9,122,101,114,111,46,115,117,112,115,8,111,110,101,46,115,117,112,115,8,116,119,111,46,115,117,112,115,10,116,104,114,101,101,46,115,117,112,115,9,102,111,117,114,46,115,117,112,115,9,102,105,118,101,46,115,117,112,115,8,115,105,120,46,115,117,112,115,10,115,101,118,101,110,46,115,117,112,115,10,101,105,103,104,116,46,115,117,112,115,9,110,105,110,101,46,115,117,112,115,7,117,110,105,50,49,53,51,7,117,110,105,50,49,53,52,9,111,110,101,101,105,103,104,116,104,12,116,104,114,101,101,101,105,103,104,116,104,115,11,102,105,118,101,101,105,103,104,116,104,115,12,115,101,118,101,110,101,105,103,104,116,104,115,14,111,110,101,100,111,116,101,110,108,101,97,100,101,114,14,116,119,111,100,111,116,101,110,108,101,97,100,101,114,14,98,97,99,107,115,108,97,115,104,46,99,97,115,101,19,112,101,114,105,111,100,99,101,110,116,101,114,101,100,46,99,97,115,101,11,98,117,108,108,101,116,46,99,97,115,101,10,115,108,97,115,104,46,99,97,115,101,14,98,114,97,99,101,108,101,102,116,46,99,97,115,101,15,98,114,97,99,101,114,105,103,104,116,46,99,97,115,101,16,98,114,97,99,107,101,116,108,101,102,116,46,99,97,115,101,17,98,114,97,99,107,101,116,114,105,103,104,116,46,99,97,115,101,15,112,97,114,101,110,114,105,103,104,116,46,99,97,115,101,10,102,105,103,117,114,101,100,97,115,104,7,117,110,105,50,48,49,53,7,117,110,105,50,48,49,48,7,117,110,105,48,48,65,68,11,101,109,100,97,115,104,46,99,97,115,101,11,101,110,100,97,115,104,46,99,97,115,101,11,104,121,112,104,101,110,46,99,97,115,101,18,103,117,105,108,108,101,109,111,116,108,101,102,116,46,99,97,115,101,19,103,117,105,108,108,101,109,111,116,114,105,103,104,116,46,99,97,115,101,18,103,117,105,108,115,105,110,103,108,108,101,102,116,46,99,97,115,101,19,103,117,105,108,115,105,110,103,108,114,105,103,104,116,46,99,97,115,101,9,101,120,99,108,97,109,46,115,99,13,101,120,99,108,97,109,100,111,119,110,46,115,99,11,113,117,101,115,116,105,111,110,46,115,99,15,113,117,101,115,116,105,111,110,100,111,119,110,46,115,99,11,113,117,111,116,101,100,98,108,46,115,99,15,113,117,111,116,101,100,98,108,108,101,102,116,46,115,99,16,113,117,111,116,101,100,98,108,114,105,103,104,116,46,115,99,12,113,117,111,116,101,108,101,102,116,46,115,99,13,113,117,111,116,101,114,105,103,104,116,46,115,99,14,113,117,111,116,101,115,105,110,103,108,101,46,115,99,9,97,110,111,116,101,108,101,105,97,7,117,110,105,48,51,55,69,7,117,110,105,50,48,48,55,7,117,110,105,50,48,48,65,7,117,110,105,50,48,48,56,7,117,110,105,48,48,65,48,7,117,110,105,50,48,48,57,7,117,110,105,50,48,48,66,7,117,110,105,50,48,66,53,13,99,111,108,111,110,109,111,110,101,116,97,114,121,4,100,111,110,103,4,69,117,114,111,7,117,110,105,50,48,66,50,7,117,110,105,50,48,66,52,7,117,110,105,50,48,65,68,4,108,105,114,97,7,117,110,105,50,48,66,65,7,117,110,105,50,48,66,67,7,117,110,105,50,48,65,54,6,112,101,115,101,116,97,7,117,110,105,50,48,66,49,7,117,110,105,50,48,66,68,7,117,110,105,50,48,66,57,7,117,110,105,50,48,66,56,7,117,110,105,50,48,65,69,7,117,110,105,50,48,65,57,7,117,110,105,50,50,49,57,7,117,110,105,50,50,49,53,8,101,109,112,116,121,115,101,116,7,117,110,105,50,49,50,54,7,117,110,105,50,50,48,54,7,117,110,105,48,48,66,53,7,97,114,114,111,119,117,112,7,117,110,105,50,49,57,55,10,97,114,114,111,119,114,105,103,104,116,7,117,110,105,50,49,57,56,9,97,114,114,111,119,100,111,119,110,7,117,110,105,50,49,57,57,9,97,114,114,111,119,108,101,102,116,7,117,110,105,50,49,57,54,9,97,114,114,111,119,98,111,116,104,9,97,114,114,111,119,117,112,100,110,7,117,110,105,50,53,67,54,7,117,110,105,50,53,67,55,9,102,105,108,108,101,100,98,111,120,7,117,110,105,50,53,65,49,7,117,110,105,50,53,70,67,7,116,114,105,97,103,117,112,7,117,110,105,50,53,66,54,7,116,114,105,97,103,100,110,7,117,110,105,50,53,67,48,7,117,110,105,50,53,66,51,7,117,110,105,50,53,66,55,7,117,110,105,50,53,66,68,7,117,110,105,50,53,67,49,7,117,110,105,50,54,65,66,7,117,110,105,50,49,49,51,9,101,115,116,105,109,97,116,101,100,7,117,110,105,50,49,49,54,7,117,110,105,50,66,50,52,7,117,110,105,50,66,49,66,6,109,105,110,117,116,101,6,115,101,99,111,110,100,7,97,116,46,99,97,115,101,12,97,109,112,101,114,115,97,110,100,46,115,99,7,117,110,105,48,51,55,52,7,117,110,105,48,51,55,53,7,117,110,105,48,51,48,56,11,117,110,105,48,51,48,56,48,51,48,48,11,117,110,105,48,51,48,56,48,51,48,49,11,117,110,105,48,51,48,56,48,51,48,67,11,117,110,105,48,51,48,56,48,51,48,52,7,117,110,105,48,51,48,55,11,117,110,105,48,51,48,55,48,51,48,52,9,103,114,97,118,101,99,111,109,98,9,97,99,117,116,101,99,111,109,98,7,117,110,105,48,51,48,66,13,99,97,114,111,110,99,111,109,98,46,97,108,116,7,117,110,105,48,51,48,50,7,117,110,105,48,51,48,67,7,117,110,105,48,51,48,54,7,117,110,105,48,51,48,65,9,116,105,108,100,101,99,111,109,98,11,117,110,105,48,51,48,51,48,51,48,56,19,116,105,108,100,101,99,111,109,98,95,97,99,117,116,101,99,111,109,98,11,117,110,105,48,51,48,51,48,51,48,52,7,117,110,105,48,51,48,52,11,117,110,105,48,51,48,52,48,51,48,48,11,117,110,105,48,51,48,52,48,51,48,49,13,104,111,111,107,97,98,111,118,101,99,111,109,98,7,117,110,105,48,51,48,70,7,117,110,105,48,51,49,49,7,117,110,105,48,51,49,50,7,117,110,105,48,51,49,66,12,100,111,116,98,101,108,111,119,99,111,109,98,7,117,110,105,48,51,50,52,7,117,110,105,48,51,50,54,7,117,110,105,48,51,50,55,7,117,110,105,48,51,50,56,7,117,110,105,48,51,50,69,7,117,110,105,48,51,51,49,7,117,110,105,48,51,51,53,12,117,110,105,48,51,48,56,46,99,97,115,101,16,117,110,105,48,51,48,56,48,51,48,49,46,99,97,115,101,16,117,110,105,48,51,48,56,48,51,48,52,46,99,97,115,101,12,117,110,105,48,51,48,55,46,99,97,115,101,16,117,110,105,48,51,48,55,48,51,48,52,46,99,97,115,101,14,103,114,97,118,101,99,111,109,98,46,99,97,115,101,14,97,99,117,116,101,99,111,109,98,46,99,97,115,101,12,117,110,105,48,51,48,66,46,99,97,115,101,12,117,110,105,48,51,48,50,46,99,97,115,101,12,117,110,105,48,51,48,67,46,99,97,115,101,12,117,110,105,48,51,48,54,46,99,97,115,101,12,117,110,105,48,51,48,65,46,99,97,115,101,14,116,105,108,100,101,99,111,109,98,46,99,97,115,101,16,117,110,105,48,51,48,51,48,51,48,56,46,99,97,115,101,24,116,105,108,100,101,99,111,109,98,95,97,99,117,116,101,99,111,109,98,46,99,97,115,101,16,117,110,105,48,51,48,51,48,51,48,52,46,99,97,115,101,12,117,110,105,48,51,48,52,46,99,97,115,101,16,117,110,105,48,51,48,52,48,51,48,48,46,99,97,115,101,16,117,110,105,48,51,48,52,48,51,48,49,46,99,97,115,101,12,117,110,105,48,51,48,70,46,99,97,115,101,12,117,110,105,48,51,51,53,46,99,97,115,101,9,117,110,105,48,51,48,56,46,105,7,117,110,105,48,50,66,67,7,117,110,105,48,50,66,66,7,117,110,105,48,50,67,57,7,117,110,105,48,50,67,66,7,117,110,105,48,50,66,57,7,117,110,105,48,50,66,70,7,117,110,105,48,50,66,69,7,117,110,105,48,50,67,65,7,117,110,105,48,50,67,67,7,117,110,105,48,50,67,56,9,99,97,114,111,110,46,97,108,116,7,117,110,105,48,51,52,50,7,117,110,105,48,51,52,51,7,117,110,105,48,51,52,52,7,117,110,105,48,51,52,53,5,116,111,110,111,115,13,100,105,101,114,101,115,105,115,116,111,110,111,115,7,117,110,105,49,70,66,70,12,117,110,105,49,70,66,70,46,99,97,115,101,7,117,110,105,49,70,66,68,7,117,110,105,49,70,70,69,12,117,110,105,49,70,70,69,46,99,97,115,101,7,117,110,105,49,70,67,68,7,117,110,105,49,70,68,68,12,117,110,105,49,70,68,68,46,99,97,115,101,7,117,110,105,49,70,67,69,12,117,110,105,49,70,67,69,46,99,97,115,101,7,117,110,105,49,70,68,69,12,117,110,105,49,70,68,69,46,99,97,115,101,7,117,110,105,49,70,67,70,12,117,110,105,49,70,67,70,46,99,97,115,101,7,117,110,105,49,70,68,70,12,117,110,105,49,70,68,70,46,99,97,115,101,7,117,110,105,49,70,69,68,7,117,110,105,49,70,69,69,7,117,110,105,49,70,67,49,7,117,110,105,49,70,69,70,7,117,110,105,49,70,70,68,7,117,110,105,49,70,67,48,12,117,110,105,49,70,67,48,46,99,97,115,101,12,117,110,105,49,70,67,68,46,99,97,115,101,11,98,114,101,118,101,99,111,109,98,99,121,16,98,114,101,118,101,99,111,109,98,99,121,46,99,97,115,101,11,117,110,105,48,51,48,54,48,51,48,49,11,117,110,105,48,51,48,54,48,51,48,48,11,117,110,105,48,51,48,54,48,51,48,57,11,117,110,105,48,51,48,54,48,51,48,51,11,117,110,105,48,51,48,50,48,51,48,49,11,117,110,105,48,51,48,50,48,51,48,48,11,117,110,105,48,51,48,50,48,51,48,57,11,117,110,105,48,51,48,50,48,51,48,51,9,71,100,105,101,114,101,115,105,115,6,71,116,105,108,100,101,11,102,111,117,110,100,114,121,105,99,111,110,9,103,100,105,101,114,101,115,105,115,6,103,116,105,108,100,101,12,103,100,105,101,114,101,115,105,115,46,115,99,9,103,116,105,108,100,101,46,115,99,5,112,114,105,109,101,7,117,110,105,48,48,48,48,0,0,1,0,1,255,255,0,15,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,85,0,85,0,52,0,52,1,251,255,248,1,251,255,247,0,85,0,85,0,52,0,52,1,249,255,249,255,237,1,249,255,247,255,237,0,81,0,81,0,51,0,51,2,137,255,246,1,201,255,250,255,19,2,137,255,244,1,208,255,248,255,19,0,67,0,67,0,65,0,65,2,137,255,253,2,227,1,205,255,244,255,19,2,137,255,244,2,227,1,205,255,244,255,19,0,70,0,70,0,43,0,43,3,50,2,133,1,92,0,202,3,50,2,135,1,87,0,199,0,81,0,81,0,51,0,51,2,137,255,253,2,230,1,206,255,252,255,22,2,137,255,244,2,230,1,208,255,244,255,14,0,81,0,81,0,51,0,51,1,10,255,129,2,215,1,200,255,252,255,20,1,10,255,128,2,215,1,208,255,244,255,20,0,81,0,81,0,51,0,51,2,137,1,88,2,230,2,41,255,252,255,19,2,216,1,87,2,230,2,41,255,244,255,19,0,24,0,24,0,73,0,73,176,0,44,32,176,0,85,88,69,89,32,32,75,184,0,18,81,75,176,6,83,90,88,176,52,27,176,40,89,96,102,32,138,85,88,176,2,37,97,185,8,0,8,0,99,99,35,98,27,33,33,176,0,89,176,0,67,35,68,178,0,1,0,67,96,66,45,176,1,44,176,32,96,102,45,176,2,44,32,100,32,176,192,80,176,4,38,90,178,40,1,11,67,69,99,69,176,6,69,88,33,176,3,37,89,82,91,88,33,35,33,27,138,88,32,176,80,80,88,33,176,64,89,27,32,176,56,80,88,33,176,56,89,89,32,177,1,11,67,69,99,69,97,100,176,40,80,88,33,177,1,11,67,69,99,69,32,176,48,80,88,33,176,48,89,27,32,176,192,80,88,32,102,32,138,138,97,32,176,10,80,88,96,27,32,176,32,80,88,33,176,10,96,27,32,176,54,80,88,33,176,54,96,27,96,89,89,89,27,176,2,37,176,10,67,99,176,0,82,88,176,0,75,176,10,80,88,33,176,10,67,27,75,176,30,80,88,33,176,30,75,97,184,16,0,99,176,10,67,99,184,5,0,98,89,89,100,97,89,176,1,43,89,89,35,176,0,80,88,101,89,89,45,176,3,44,32,69,32,176,4,37,97,100,32,176,5,67,80,88,176,5,35,66,176,6,35,66,27,33,33,89,176,1,96,45,176,4,44,35,33,35,33,32,100,177,5,98,66,32,176,6,35,66,176,6,69,88,27,177,1,11,67,69,99,177,1,11,67,176,9,96,69,99,176,3,42,33,32,176,6,67,32,138,32,138,176,1,43,177,48,5,37,176,4,38,81,88,96,80,27,97,82,89,88,35,89,33,89,32,176,64,83,88,176,1,43,27,33,176,64,89,35,176,0,80,88,101,89,45,176,5,44,176,7,67,43,178,0,2,0,67,96,66,45,176,6,44,176,7,35,66,35,32,176,0,35,66,97,176,2,98,102,176,1,99,176,1,96,176,5,42,45,176,7,44,32,32,69,32,176,12,67,99,184,4,0,98,32,176,0,80,88,176,64,96,89,102,176,1,99,96,68,176,1,96,45,176,8,44,178,7,12,0,67,69,66,42,33,178,0,1,0,67,96,66,45,176,9,44,176,0,67,35,68,178,0,1,0,67,96,66,45,176,10,44,32,32,69,32,176,1,43,35,176,0,67,176,4,37,96,32,69,138,35,97,32,100,32,176,32,80,88,33,176,0,27,176,48,80,88,176,32,27,176,64,89,89,35,176,0,80,88,101,89,176,3,37,35,97,68,68,176,1,96,45,176,11,44,32,32,69,32,176,1,43,35,176,0,67,176,4,37,96,32,69,138,35,97,32,100,176,36,80,88,176,0,27,176,64,89,35,176,0,80,88,101,89,176,3,37,35,97,68,68,176,1,96,45,176,12,44,32,176,0,35,66,178,11,10,3,69,88,33,27,35,33,89,42,33,45,176,13,44,177,2,2,69,176,100,97,68,45,176,14,44,176,1,96,32,32,176,13,67,74,176,0,80,88,32,176,13,35,66,89,176,14,67,74,176,0,82,88,32,176,14,35,66,89,45,176,15,44,32,176,16,98,102,176,1,99,32,184,4,0,99,138,35,97,176,15,67,96,32,138,96,32,176,15,35,66,35,45,176,16,44,75,84,88,177,4,100,68,89,36,176,13,101,35,120,45,176,17,44,75,81,88,75,83,88,177,4,100,68,89,27,33,89,36,176,19,101,35,120,45,176,18,44,177,0,16,67,85,88,177,16,16,67,176,1,97,66,176,15,43,89,176,0,67,176,2,37,66,177,13,2,37,66,177,14,2,37,66,176,1,22,35,32,176,3,37,80,88,177,1,0,67,96,176,4,37,66,138,138,32,138,35,97,176,14,42,33,35,176,1,97,32,138,35,97,176,14,42,33,27,177,1,0,67,96,176,2,37,66,176,2,37,97,176,14,42,33,89,176,13,67,71,176,14,67,71,96,176,2,98,32,176,0,80,88,176,64,96,89,102,176,1,99,32,176,12,67,99,184,4,0,98,32,176,0,80,88,176,64,96,89,102,176,1,99,96,177,0,0,19,35,68,176,1,67,176,0,62,178,1,1,1,67,96,66,45,176,19,44,0,177,0,2,69,84,88,176,16,35,66,32,69,176,12,35,66,176,11,35,176,9,96,66,32,96,176,1,97,181,18,18,1,0,15,0,66,66,138,96,177,18,6,43,176,137,43,27,34,89,45,176,20,44,177,0,19,43,45,176,21,44,177,1,19,43,45,176,22,44,177,2,19,43,45,176,23,44,177,3,19,43,45,176,24,44,177,4,19,43,45,176,25,44,177,5,19,43,45,176,26,44,177,6,19,43,45,176,27,44,177,7,19,43,45,176,28,44,177,8,19,43,45,176,29,44,177,9,19,43,45,176,41,44,35,32,176,16,98,102,176,1,99,176,6,96,75,84,88,35,32,46,176,1,93,27,33,33,89,45,176,42,44,35,32,176,16,98,102,176,1,99,176,22,96,75,84,88,35,32,46,176,1,113,27,33,33,89,45,176,43,44,35,32,176,16,98,102,176,1,99,176,38,96,75,84,88,35,32,46,176,1,114,27,33,33,89,45,176,30,44,0,176,13,43,177,0,2,69,84,88,176,16,35,66,32,69,176,12,35,66,176,11,35,176,9,96,66,32,96,176,1,97,181,18,18,1,0,15,0,66,66,138,96,177,18,6,43,176,137,43,27,34,89,45,176,31,44,177,0,30,43,45,176,32,44,177,1,30,43,45,176,33,44,177,2,30,43,45,176,34,44,177,3,30,43,45,176,35,44,177,4,30,43,45,176,36,44,177,5,30,43,45,176,37,44,177,6,30,43,45,176,38,44,177,7,30,43,45,176,39,44,177,8,30,43,45,176,40,44,177,9,30,43,45,176,44,44,32,60,176,1,96,45,176,45,44,32,96,176,18,96,32,67,35,176,1,96,67,176,2,37,97,176,1,96,176,44,42,33,45,176,46,44,176,45,43,176,45,42,45,176,47,44,32,32,71,32,32,176,12,67,99,184,4,0,98,32,176,0,80,88,176,64,96,89,102,176,1,99,96,35,97,56,35,32,138,85,88,32,71,32,32,176,12,67,99,184,4,0,98,32,176,0,80,88,176,64,96,89,102,176,1,99,96,35,97,56,27,33,89,45,176,48,44,0,177,0,2,69,84,88,177,12,15,69,66,176,1,22,176,47,42,177,5,1,21,69,88,48,89,27,34,89,45,176,49,44,0,176,13,43,177,0,2,69,84,88,177,12,15,69,66,176,1,22,176,47,42,177,5,1,21,69,88,48,89,27,34,89,45,176,50,44,32,53,176,1,96,45,176,51,44,0,177,12,15,69,66,176,1,69,99,184,4,0,98,32,176,0,80,88,176,64,96,89,102,176,1,99,176,1,43,176,12,67,99,184,4,0,98,32,176,0,80,88,176,64,96,89,102,176,1,99,176,1,43,176,0,22,180,0,0,0,0,0,68,62,35,56,177,50,1,21,42,33,45,176,52,44,32,60,32,71,32,176,12,67,99,184,4,0,98,32,176,0,80,88,176,64,96,89,102,176,1,99,96,176,0,67,97,56,45,176,53,44,46,23,60,45,176,54,44,32,60,32,71,32,176,12,67,99,184,4,0,98,32,176,0,80,88,176,64,96,89,102,176,1,99,96,176,0,67,97,176,1,67,99,56,45,176,55,44,177,2,0,22,37,32,46,32,71,176,0,35,66,176,2,37,73,138,138,71,35,71,35,97,32,88,98,27,33,89,176,1,35,66,178,54,1,1,21,20,42,45,176,56,44,176,0,22,176,17,35,66,176,4,37,176,4,37,71,35,71,35,97,177,10,0,66,176,9,67,43,101,138,46,35,32,32,60,138,56,45,176,57,44,176,0,22,176,17,35,66,176,4,37,176,4,37,32,46,71,35,71,35,97,32,176,4,35,66,177,10,0,66,176,9,67,43,32,176,96,80,88,32,176,64,81,88,179,2,32,3,32,27,179,2,38,3,26,89,66,66,35,32,176,8,67,32,138,35,71,35,71,35,97,35,70,96,176,4,67,176,2,98,32,176,0,80,88,176,64,96,89,102,176,1,99,96,32,176,1,43,32,138,138,97,32,176,2,67,96,100,35,176,3,67,97,100,80,88,176,2,67,97,27,176,3,67,96,89,176,3,37,176,2,98,32,176,0,80,88,176,64,96,89,102,176,1,99,97,35,32,32,176,4,38,35,70,97,56,27,35,176,8,67,70,176,2,37,176,8,67,71,35,71,35,97,96,32,176,4,67,176,2,98,32,176,0,80,88,176,64,96,89,102,176,1,99,96,35,32,176,1,43,35,176,4,67,96,176,1,43,176,5,37,97,176,5,37,176,2,98,32,176,0,80,88,176,64,96,89,102,176,1,99,176,4,38,97,32,176,4,37,96,100,35,176,3,37,96,100,80,88,33,27,35,33,89,35,32,32,176,4,38,35,70,97,56,89,45,176,58,44,176,0,22,176,17,35,66,32,32,32,176,5,38,32,46,71,35,71,35,97,35,60,56,45,176,59,44,176,0,22,176,17,35,66,32,176,8,35,66,32,32,32,70,35,71,176,1,43,35,97,56,45,176,60,44,176,0,22,176,17,35,66,176,3,37,176,2,37,71,35,71,35,97,176,0,84,88,46,32,60,35,33,27,176,2,37,176,2,37,71,35,71,35,97,32,176,5,37,176,4,37,71,35,71,35,97,176,6,37,176,5,37,73,176,2,37,97,185,8,0,8,0,99,99,35,32,88,98,27,33,89,99,184,4,0,98,32,176,0,80,88,176,64,96,89,102,176,1,99,96,35,46,35,32,32,60,138,56,35,33,89,45,176,61,44,176,0,22,176,17,35,66,32,176,8,67,32,46,71,35,71,35,97,32,96,176,32,96,102,176,2,98,32,176,0,80,88,176,64,96,89,102,176,1,99,35,32,32,60,138,56,45,176,62,44,35,32,46,70,176,2,37,70,176,17,67,88,80,27,82,89,88,32,60,89,46,177,46,1,20,43,45,176,63,44,35,32,46,70,176,2,37,70,176,17,67,88,82,27,80,89,88,32,60,89,46,177,46,1,20,43,45,176,64,44,35,32,46,70,176,2,37,70,176,17,67,88,80,27,82,89,88,32,60,89,35,32,46,70,176,2,37,70,176,17,67,88,82,27,80,89,88,32,60,89,46,177,46,1,20,43,45,176,65,44,176,56,43,35,32,46,70,176,2,37,70,176,17,67,88,80,27,82,89,88,32,60,89,46,177,46,1,20,43,45,176,66,44,176,57,43,138,32,32,60,176,4,35,66,138,56,35,32,46,70,176,2,37,70,176,17,67,88,80,27,82,89,88,32,60,89,46,177,46,1,20,43,176,4,67,46,176,46,43,45,176,67,44,176,0,22,176,4,37,176,4,38,32,32,32,70,35,71,97,176,10,35,66,46,71,35,71,35,97,176,9,67,43,35,32,60,32,46,35,56,177,46,1,20,43,45,176,68,44,177,8,4,37,66,176,0,22,176,4,37,176,4,37,32,46,71,35,71,35,97,32,176,4,35,66,177,10,0,66,176,9,67,43,32,176,96,80,88,32,176,64,81,88,179,2,32,3,32,27,179,2,38,3,26,89,66,66,35,32,71,176,4,67,176,2,98,32,176,0,80,88,176,64,96,89,102,176,1,99,96,32,176,1,43,32,138,138,97,32,176,2,67,96,100,35,176,3,67,97,100,80,88,176,2,67,97,27,176,3,67,96,89,176,3,37,176,2,98,32,176,0,80,88,176,64,96,89,102,176,1,99,97,176,2,37,70,97,56,35,32,60,35,56,27,33,32,32,70,35,71,176,1,43,35,97,56,33,89,177,46,1,20,43,45,176,69,44,177,0,56,43,46,177,46,1,20,43,45,176,70,44,177,0,57,43,33,35,32,32,60,176,4,35,66,35,56,177,46,1,20,43,176,4,67,46,176,46,43,45,176,71,44,176,0,21,32,71,176,0,35,66,178,0,1,1,21,20,19,46,176,52,42,45,176,72,44,176,0,21,32,71,176,0,35,66,178,0,1,1,21,20,19,46,176,52,42,45,176,73,44,177,0,1,20,19,176,53,42,45,176,74,44,176,55,42,45,176,75,44,176,0,22,69,35,32,46,32,70,138,35,97,56,177,46,1,20,43,45,176,76,44,176,8,35,66,176,75,43,45,176,77,44,178,0,0,68,43,45,176,78,44,178,0,1,68,43,45,176,79,44,178,1,0,68,43,45,176,80,44,178,1,1,68,43,45,176,81,44,178,0,0,69,43,45,176,82,44,178,0,1,69,43,45,176,83,44,178,1,0,69,43,45,176,84,44,178,1,1,69,43,45,176,85,44,179,0,0,0,65,43,45,176,86,44,179,0,1,0,65,43,45,176,87,44,179,1,0,0,65,43,45,176,88,44,179,1,1,0,65,43,45,176,89,44,179,0,0,1,65,43,45,176,90,44,179,0,1,1,65,43,45,176,91,44,179,1,0,1,65,43,45,176,92,44,179,1,1,1,65,43,45,176,93,44,178,0,0,67,43,45,176,94,44,178,0,1,67,43,45,176,95,44,178,1,0,67,43,45,176,96,44,178,1,1,67,43,45,176,97,44,178,0,0,70,43,45,176,98,44,178,0,1,70,43,45,176,99,44,178,1,0,70,43,45,176,100,44,178,1,1,70,43,45,176,101,44,179,0,0,0,66,43,45,176,102,44,179,0,1,0,66,43,45,176,103,44,179,1,0,0,66,43,45,176,104,44,179,1,1,0,66,43,45,176,105,44,179,0,0,1,66,43,45,176,106,44,179,0,1,1,66,43,45,176,107,44,179,1,0,1,66,43,45,176,108,44,179,1,1,1,66,43,45,176,109,44,177,0,58,43,46,177,46,1,20,43,45,176,110,44,177,0,58,43,176,62,43,45,176,111,44,177,0,58,43,176,63,43,45,176,112,44,176,0,22,177,0,58,43,176,64,43,45,176,113,44,177,1,58,43,176,62,43,45,176,114,44,177,1,58,43,176,63,43,45,176,115,44,176,0,22,177,1,58,43,176,64,43,45,176,116,44,177,0,59,43,46,177,46,1,20,43,45,176,117,44,177,0,59,43,176,62,43,45,176,118,44,177,0,59,43,176,63,43,45,176,119,44,177,0,59,43,176,64,43,45,176,120,44,177,1,59,43,176,62,43,45,176,121,44,177,1,59,43,176,63,43,45,176,122,44,177,1,59,43,176,64,43,45,176,123,44,177,0,60,43,46,177,46,1,20,43,45,176,124,44,177,0,60,43,176,62,43,45,176,125,44,177,0,60,43,176,63,43,45,176,126,44,177,0,60,43,176,64,43,45,176,127,44,177,1,60,43,176,62,43,45,176,128,44,177,1,60,43,176,63,43,45,176,129,44,177,1,60,43,176,64,43,45,176,130,44,177,0,61,43,46,177,46,1,20,43,45,176,131,44,177,0,61,43,176,62,43,45,176,132,44,177,0,61,43,176,63,43,45,176,133,44,177,0,61,43,176,64,43,45,176,134,44,177,1,61,43,176,62,43,45,176,135,44,177,1,61,43,176,63,43,45,176,136,44,177,1,61,43,176,64,43,45,176,137,44,179,9,4,2,3,69,88,33,27,35,33,89,66,43,176,8,101,176,3,36,80,120,177,5,1,21,69,88,48,89,45,0,0,0,0,75,184,0,32,82,88,177,1,1,142,89,176,1,185,8,0,8,0,99,112,177,0,7,66,64,11,0,139,123,107,91,79,63,49,0,9,0,42,177,0,7,66,64,20,144,2,128,8,112,8,96,8,84,6,68,8,54,7,44,5,36,4,9,8,42,177,0,7,66,64,20,146,0,136,6,120,6,104,6,90,4,76,6,61,5,49,3,40,2,9,8,42,177,0,16,66,65,11,36,64,32,64,28,64,24,64,21,64,17,64,13,192,11,64,9,64,0,9,0,9,42,177,0,25,66,65,11,0,64,0,64,0,64,0,64,0,64,0,64,0,64,0,64,0,64,0,9,0,9,42,177,3,0,68,177,36,1,136,81,88,176,64,136,88,177,3,100,68,177,38,1,136,81,88,186,8,128,0,1,4,64,136,99,84,88,177,3,0,68,89,89,89,89,64,20,146,0,130,6,114,6,98,6,86,4,70,6,56,5,46,3,38,2,9,12,42,184,1,255,133,176,4,141,177,2,0,68,179,5,100,6,0,68,68,0,0,0,0,1,0,0,0,0};size_t font_len = 318140;
\ No newline at end of file
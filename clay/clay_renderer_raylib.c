@@ -103,14 +103,18 @@ static inline Clay_Dimensions Raylib_MeasureText(Clay_StringSlice text, Clay_Tex
 
     float scaleFactor = config->fontSize/(float)fontToUse.baseSize;
 
-    for (int i = 0; i < text.length; ++i)
+    for (int i = 0; i < text.length;)
     {
         if (text.chars[i] == '\n') {
             maxTextWidth = fmax(maxTextWidth, lineTextWidth);
             lineTextWidth = 0;
+            i++;
             continue;
         }
-        int index = text.chars[i] - 32;
+        // NOTE: object names can contain arbitrary UTF-8, so don't assume every byte is a glyph
+        int codepointSize = 0;
+        int index = GetGlyphIndex(fontToUse, GetCodepointNext(&text.chars[i], &codepointSize));
+        i += codepointSize;
         if (fontToUse.glyphs[index].advanceX != 0) lineTextWidth += fontToUse.glyphs[index].advanceX;
         else lineTextWidth += (fontToUse.recs[index].width + fontToUse.glyphs[index].offsetX);
 
@@ -132,20 +136,98 @@ void Clay_Raylib_Initialize(int width, int height, const char *title, unsigned i
 //    EnableEventWaiting();
 }
 
-// A MALLOC'd buffer, that we keep modifying inorder to save from so many Malloc and Free Calls.
-// Call Clay_Raylib_Close() to free
-static char *temp_render_buffer = NULL;
-static int temp_render_buffer_len = 0;
-
-// Call after closing the window to clean up the render buffer
 void Clay_Raylib_Close()
 {
-    if(temp_render_buffer) free(temp_render_buffer);
-    temp_render_buffer_len = 0;
-
     CloseWindow();
 }
 
+// NOTE: Glyphs are not drawn right away but collected here, so that all the text of the UI ends up in a single draw call
+// per font instead of one for every switch between text and rectangles. Deferring them is only fine as long as nothing
+// drawn in the meantime overlaps them, so the batch gets flushed before anything that lands on its bounds
+typedef struct {
+    Rectangle source, dest;
+    Color tint;
+} Raylib_GlyphQuad;
+
+#define RAYLIB_GLYPH_BATCH_CAPACITY 4096
+static Raylib_GlyphQuad glyphBatch[RAYLIB_GLYPH_BATCH_CAPACITY];
+static int glyphBatchCount = 0;
+static Texture2D glyphBatchTexture;
+// Union of the dest rects in the batch
+static Rectangle glyphBatchBounds;
+
+static void Raylib_FlushGlyphs(void) {
+    // Consecutive quads with the same texture get merged into one draw call by raylib
+    for (int i = 0; i < glyphBatchCount; i++) {
+        DrawTexturePro(glyphBatchTexture, glyphBatch[i].source, glyphBatch[i].dest, (Vector2) { 0, 0 }, 0, glyphBatch[i].tint);
+    }
+    glyphBatchCount = 0;
+}
+
+static void Raylib_PushGlyph(Texture2D texture, Rectangle source, Rectangle dest, Color tint) {
+    if (glyphBatchCount > 0 && (glyphBatchCount == RAYLIB_GLYPH_BATCH_CAPACITY || texture.id != glyphBatchTexture.id)) {
+        Raylib_FlushGlyphs();
+    }
+    if (glyphBatchCount == 0) {
+        glyphBatchBounds = dest;
+    } else {
+        float right = fmaxf(glyphBatchBounds.x + glyphBatchBounds.width, dest.x + dest.width);
+        float bottom = fmaxf(glyphBatchBounds.y + glyphBatchBounds.height, dest.y + dest.height);
+        glyphBatchBounds.x = fminf(glyphBatchBounds.x, dest.x);
+        glyphBatchBounds.y = fminf(glyphBatchBounds.y, dest.y);
+        glyphBatchBounds.width = right - glyphBatchBounds.x;
+        glyphBatchBounds.height = bottom - glyphBatchBounds.y;
+    }
+    glyphBatchTexture = texture;
+    glyphBatch[glyphBatchCount++] = (Raylib_GlyphQuad) { source, dest, tint };
+}
+
+// Call before drawing anything within `box`, so that it ends up on top of the text that came before it
+static void Raylib_FlushGlyphsUnder(Clay_BoundingBox box) {
+    if (glyphBatchCount > 0 && CheckCollisionRecs(glyphBatchBounds, (Rectangle) { box.x, box.y, box.width, box.height })) {
+        Raylib_FlushGlyphs();
+    }
+}
+
+// Same as DrawTextEx(), but straight from the slice, as Clay strings are not NUL-terminated
+static void Raylib_DrawTextSlice(Font font, Clay_StringSlice text, Vector2 position, float fontSize, float spacing, Color tint) {
+    if (font.texture.id == 0) font = GetFontDefault();
+
+    float scaleFactor = fontSize/font.baseSize;
+    float padding = font.glyphPadding;
+    float textOffsetX = 0;
+    float textOffsetY = 0;
+
+    for (int i = 0; i < text.length;) {
+        int codepointSize = 0;
+        int codepoint = GetCodepointNext(&text.chars[i], &codepointSize);
+        int index = GetGlyphIndex(font, codepoint);
+        i += codepointSize;
+
+        if (codepoint == '\n') {
+            textOffsetY += fontSize;
+            textOffsetX = 0;
+            continue;
+        }
+
+        Rectangle rec = font.recs[index];
+        GlyphInfo glyph = font.glyphs[index];
+        if (codepoint != ' ' && codepoint != '\t') {
+            Rectangle source = { rec.x - padding, rec.y - padding, rec.width + 2*padding, rec.height + 2*padding };
+            Rectangle dest = {
+                position.x + textOffsetX + (glyph.offsetX - padding)*scaleFactor,
+                position.y + textOffsetY + (glyph.offsetY - padding)*scaleFactor,
+                source.width*scaleFactor,
+                source.height*scaleFactor,
+            };
+            Raylib_PushGlyph(font.texture, source, dest, tint);
+        }
+
+        if (glyph.advanceX == 0) textOffsetX += rec.width*scaleFactor + spacing;
+        else textOffsetX += glyph.advanceX*scaleFactor + spacing;
+    }
+}
+
 
 void Clay_Raylib_Render(Clay_RenderCommandArray renderCommands, Font* fonts)
 {
@@ -153,29 +235,18 @@ void Clay_Raylib_Render(Clay_RenderCommandArray renderCommands, Font* fonts)
     {
         Clay_RenderCommand *renderCommand = Clay_RenderCommandArray_Get(&renderCommands, j);
         Clay_BoundingBox boundingBox = renderCommand->boundingBox;
+        if (j > 0 && renderCommand->zIndex != Clay_RenderCommandArray_Get(&renderCommands, j - 1)->zIndex) {
+            Raylib_FlushGlyphs();
+        }
         switch (renderCommand->commandType)
         {
             case CLAY_RENDER_COMMAND_TYPE_TEXT: {
                 Clay_TextRenderData *textData = &renderCommand->renderData.text;
-                Font fontToUse = fonts[textData->fontId];
-
-                int strlen = textData->stringContents.length + 1;
-
-                if(strlen > temp_render_buffer_len) {
-                    // Grow the temp buffer if we need a larger string
-                    if(temp_render_buffer) free(temp_render_buffer);
-                    temp_render_buffer = malloc(strlen);
-                    temp_render_buffer_len = strlen;
-                }
-
-                // Raylib uses standard C strings so isn't compatible with cheap slices, we need to clone the string to append null terminator
-                memcpy(temp_render_buffer, textData->stringContents.chars, textData->stringContents.length);
-                temp_render_buffer[textData->stringContents.length] = '\0';
-                DrawTextEx(fontToUse, temp_render_buffer, (Vector2){boundingBox.x, boundingBox.y}, (float)textData->fontSize, (float)textData->letterSpacing, CLAY_COLOR_TO_RAYLIB_COLOR(textData->textColor));
-
+                Raylib_DrawTextSlice(fonts[textData->fontId], textData->stringContents, (Vector2){boundingBox.x, boundingBox.y}, (float)textData->fontSize, (float)textData->letterSpacing, CLAY_COLOR_TO_RAYLIB_COLOR(textData->textColor));
                 break;
             }
             case CLAY_RENDER_COMMAND_TYPE_IMAGE: {
+                Raylib_FlushGlyphsUnder(boundingBox);
                 Texture2D imageTexture = *(Texture2D *)renderCommand->renderData.image.imageData;
                 Clay_Color tintColor = renderCommand->renderData.image.backgroundColor;
                 if (tintColor.r == 0 && tintColor.g == 0 && tintColor.b == 0 && tintColor.a == 0) {
@@ -190,14 +261,17 @@ void Clay_Raylib_Render(Clay_RenderCommandArray renderCommands, Font* fonts)
                 break;
             }
             case CLAY_RENDER_COMMAND_TYPE_SCISSOR_START: {
+                Raylib_FlushGlyphs();
                 BeginScissorMode((int)roundf(boundingBox.x), (int)roundf(boundingBox.y), (int)roundf(boundingBox.width), (int)roundf(boundingBox.height));
                 break;
             }
             case CLAY_RENDER_COMMAND_TYPE_SCISSOR_END: {
+                Raylib_FlushGlyphs();
                 EndScissorMode();
                 break;
             }
             case CLAY_RENDER_COMMAND_TYPE_RECTANGLE: {
+                Raylib_FlushGlyphsUnder(boundingBox);
                 Clay_RectangleRenderData *config = &renderCommand->renderData.rectangle;
                 if (config->cornerRadius.topLeft > 0) {
                     float radius = (config->cornerRadius.topLeft * 2) / (float)((boundingBox.width > boundingBox.height) ? boundingBox.height : boundingBox.width);
@@ -208,6 +282,7 @@ void Clay_Raylib_Render(Clay_RenderCommandArray renderCommands, Font* fonts)
                 break;
             }
             case CLAY_RENDER_COMMAND_TYPE_BORDER: {
+                Raylib_FlushGlyphsUnder(boundingBox);
                 Clay_BorderRenderData *config = &renderCommand->renderData.border;
                 // Left border
                 if (config->width.left > 0) {
@@ -245,6 +320,7 @@ void Clay_Raylib_Render(Clay_RenderCommandArray renderCommands, Font* fonts)
                 if (!customElement) continue;
                 switch (customElement->type) {
                     case CUSTOM_LAYOUT_ELEMENT_TYPE_3D_MODEL: {
+                        Raylib_FlushGlyphs();
                         Clay_BoundingBox rootBox = renderCommands.internalArray[0].boundingBox;
                         float scaleValue = CLAY__MIN(CLAY__MIN(1, 768 / rootBox.height) * CLAY__MAX(1, rootBox.width / 1024), 1.5f);
                         Ray positionRay = GetScreenToWorldPointWithZDistance((Vector2) { renderCommand->boundingBox.x + renderCommand->boundingBox.width / 2, renderCommand->boundingBox.y + (renderCommand->boundingBox.height / 2) + 20 }, Raylib_camera, (int)roundf(rootBox.width), (int)roundf(rootBox.height), 140);
@@ -270,4 +346,5 @@ void Clay_Raylib_Render(Clay_RenderCommandArray renderCommands, Font* fonts)
             }
         }
     }
+    Raylib_FlushGlyphs();
 }
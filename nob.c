@@ -8,16 +8,18 @@ typedef enum {
     TARGET_LINUX_HOTRELOAD,
     TARGET_WINDOWS,
     TARGET_WEB,
+    TARGET_BENCH,
     COUNT_TARGETS,
 } Target;
 
 const char *target_as_cstr(Target target) {
-    static_assert(COUNT_TARGETS == 4, "Please update after adding a new target");
+    static_assert(COUNT_TARGETS == 5, "Please update after adding a new target");
     switch (target) {
         case TARGET_LINUX: return "linux";
         case TARGET_LINUX_HOTRELOAD: return "linux-hotreload";
         case TARGET_WINDOWS: return "windows";
         case TARGET_WEB: return "web";
+        case TARGET_BENCH: return "bench";
         default: UNREACHABLE("invalid target");
     }
 }
@@ -43,16 +45,20 @@ void usage(FILE *stream, const char *program_name) {
     fprintf(stream, "  OPTIONS:\n");
     fprintf(stream, "    -h, --help - Print this help message\n");
     fprintf(stream, "    -r - Run app after building\n");
+    fprintf(stream, "    -a - Count allocations and show them in the profiler overlay (always on for `bench`)\n");
     fprintf(stream, "    -t <target> - Build for a specific target. Possible targets include:\n");
     list_targets(stream);
     fprintf(stream, "    -t list - Print the above list of targets and exit\n");
     fprintf(stream, "    If this option is not provided, the default target is `%s`\n", target_as_cstr(default_target));
 }
 
+bool track_allocations = false;
+
 void common_cflags(Cmd *cmd) {
     cmd_append(cmd, "-std=gnu11");
     cmd_append(cmd, "-Wall", "-Wextra", "-g");
     cmd_append(cmd, "-I.", "-I./raylib/", "-I./clay/", "-I./tinyfiledialogs/", "-I./build/");
+    if (track_allocations) cmd_append(cmd, "-DTRACK_ALLOCATIONS");
 }
 
 bool build_bundle(void) {
@@ -99,7 +105,7 @@ int main(int argc, char **argv) {
                 nob_log(ERROR, "-t flag requires an argument");
             }
             const char *target_name = shift(argv, argc);
-            static_assert(COUNT_TARGETS == 4, "Please update the -t flag when adding a new target");
+            static_assert(COUNT_TARGETS == 5, "Please update the -t flag when adding a new target");
             if (strcmp(target_name, "linux") == 0) {
                 target = TARGET_LINUX;
             } else if (strcmp(target_name, "linux-hotreload") == 0 || strcmp(target_name, "lh") == 0) {
@@ -108,6 +114,8 @@ int main(int argc, char **argv) {
                 target = TARGET_WINDOWS;
             } else if (strcmp(target_name, "web") == 0) {
                 target = TARGET_WEB;
+            } else if (strcmp(target_name, "bench") == 0) {
+                target = TARGET_BENCH;
             } else if (strcmp(target_name, "list") == 0) {
                 list_targets(stdout);
                 return 0;
@@ -118,6 +126,8 @@ int main(int argc, char **argv) {
             }
         } else if (strcmp(arg, "-r") == 0) {
             run = true;
+        } else if (strcmp(arg, "-a") == 0) {
+            track_allocations = true;
         } else {
             usage(stderr, program_name);
             nob_log(ERROR, "unknown flag %s", arg);
@@ -130,7 +140,7 @@ int main(int argc, char **argv) {
     if (!build_bundle()) return false;
 
     Cmd cmd = {0};
-    static_assert(COUNT_TARGETS == 4, "Please update this `switch` statement when adding a new target");
+    static_assert(COUNT_TARGETS == 5, "Please update this `switch` statement when adding a new target");
     switch (target) {
         case TARGET_LINUX:
 #ifdef _WIN32
@@ -141,7 +151,7 @@ int main(int argc, char **argv) {
             common_cflags(&cmd);
             cmd_append(&cmd, "-o", "./build/main");
             cmd_append(&cmd, "./src/main.c", "./src/app.c", "./tinyfiledialogs/tinyfiledialogs.c");
-            cmd_append(&cmd, "./raylib/libraylib.a", "-lm");
+            cmd_append(&cmd, "./raylib/libraylib.a", "-lm", "-lpthread");
             break;
         case TARGET_LINUX_HOTRELOAD:
 #ifdef _WIN32
@@ -161,7 +171,7 @@ int main(int argc, char **argv) {
             cmd_append(&cmd, "-shared", "-fPIC");
             cmd_append(&cmd, "-o", "./build/libapp.so");
             cmd_append(&cmd, "./src/app.c", "./tinyfiledialogs/tinyfiledialogs.c");
-            cmd_append(&cmd, "-L./raylib/", "-l:libraylib.so.550", "-lm");
+            cmd_append(&cmd, "-L./raylib/", "-l:libraylib.so.550", "-lm", "-lpthread");
             cmd_append(&cmd, "-DHOTRELOAD");
 #endif // _WIN32
             break;
@@ -171,7 +181,7 @@ int main(int argc, char **argv) {
             cmd_append(&cmd, "-o", "./build/main.exe");
             cmd_append(&cmd, "./src/main.c", "./src/app.c", "./tinyfiledialogs/tinyfiledialogs.c");
             cmd_append(&cmd, "-L./raylib/", "-lraylib.win", "-lm");
-            cmd_append(&cmd, "-lwinmm", "-lgdi32", "-lcomdlg32", "-lole32");
+            cmd_append(&cmd, "-lwinmm", "-lgdi32", "-lcomdlg32", "-lole32", "-lpthread");
             break;
         case TARGET_WEB:
             cmd_append(&cmd, "emcc");
@@ -185,12 +195,26 @@ int main(int argc, char **argv) {
             cmd_append(&cmd, "-s", "ALLOW_MEMORY_GROWTH=1");
             cmd_append(&cmd, "-DPLATFORM_WEB", "--shell-file", "./src/shell.html");
             break;
+        case TARGET_BENCH:
+#ifdef _WIN32
+            nob_log(ERROR, "Cannot compile for `%s` on Windows", target_as_cstr(target));
+            return 1;
+#else
+            track_allocations = true;
+            cmd_append(&cmd, "cc");
+            common_cflags(&cmd);
+            cmd_append(&cmd, "-O2");
+            cmd_append(&cmd, "-o", "./build/bench");
+            cmd_append(&cmd, "./src/bench.c", "./tinyfiledialogs/tinyfiledialogs.c");
+            cmd_append(&cmd, "./raylib/libraylib.a", "-lm", "-lpthread");
+#endif // _WIN32
+            break;
         default:
             UNREACHABLE("invalid target");
     }
     if (!cmd_run_sync_and_reset(&cmd)) return 1;
 
-    static_assert(COUNT_TARGETS == 4, "Please update this `switch` statement when adding a new target");
+    static_assert(COUNT_TARGETS == 5, "Please update this `switch` statement when adding a new target");
     if (run) {
         switch (target) {
             case TARGET_LINUX_HOTRELOAD:
@@ -209,6 +233,9 @@ int main(int argc, char **argv) {
             case TARGET_WEB:
                 cmd_append(&cmd, "emrun", "./build/index.html");
                 break;
+            case TARGET_BENCH:
+                cmd_append(&cmd, "./build/bench");
+                break;
             default:
                 UNREACHABLE("invalid target");
         }
@@ -1,15 +1,33 @@
 #include "app.h"
 
 #include <math.h>
+#include <stdatomic.h>
 #include <string.h>
+#include <time.h>
 #include <unistd.h>
+#ifndef PLATFORM_WEB
+#include <pthread.h>
+#endif // PLATFORM_WEB
 
 #ifdef HOTRELOAD
     #define NOB_IMPLEMENTATION
 #endif // HOTRELOAD
+#ifdef TRACK_ALLOCATIONS
+    #define NOB_REALLOC tracked_realloc
+    #define NOB_FREE tracked_free
+#endif // TRACK_ALLOCATIONS
 #define NOB_STRIP_PREFIX
 #include "nob.h"
 
+#ifdef TRACK_ALLOCATIONS
+// Also catch the direct calls of the app, Clay and its renderer. <stdlib.h> has been included by now,
+// so these don't mess up the declarations of the real functions
+#define malloc(size) tracked_malloc(size)
+#define calloc(count, size) tracked_calloc(count, size)
+#define realloc(ptr, size) tracked_realloc(ptr, size)
+#define free(ptr) tracked_free(ptr)
+#endif // TRACK_ALLOCATIONS
+
 #define CLAY_IMPLEMENTATION
 #include "clay.h"
 #include "clay_renderer_raylib.c"
@@ -18,6 +36,8 @@
 
 #include "bundle.c"
 
+#include "kernels.c"
+
 Clay_String clay_string_from_cstr(const char *cstr) {
     return (Clay_String) { .chars = cstr, .length = strlen(cstr), .isStaticallyAllocated = false };
 }
@@ -34,6 +54,7 @@ Clay_String clay_string_from_cstr(const char *cstr) {
 #define ScissorModeRec(rec) ScissorMode((rec).x, (rec).y, (rec).width, (rec).height)
 #define TextureMode(texture) BEGIN_END(BeginTextureMode(texture), EndTextureMode())
 #define ShaderMode(shader) BEGIN_END(BeginShaderMode(shader), EndShaderMode())
+#define BlendMode(mode) BEGIN_END(BeginBlendMode(mode), EndBlendMode())
 
 // Same (including specific implementation) as LoadRenderTexture from raylib,
 // but the ability to specify pixel format.
@@ -80,30 +101,713 @@ RenderTexture2D load_render_texture_with_pixel_format(int width, int height, Pix
 #define OBJECT_RESIZE_HITBOX_SIZE 30
 #define HOVERED_OBJECT_OUTLINE_THICKNESS 5
 
+// Images whose sides are both at most ATLAS_MAX_IMAGE_SIZE get packed into shared atlas pages instead of
+// getting a texture of their own, so that a board full of icons doesn't flush the batch on every object
+#define ATLAS_PAGE_SIZE 2048
+#define ATLAS_MAX_IMAGE_SIZE 256
+#define ATLAS_PADDING 1
+
+// Skyline bottom-left packer (see "A Thousand Ways to Pack the Bin" by Jukka Jylänki)
+typedef struct {
+    int x, y, width;
+} Skyline_Node;
+
+typedef struct {
+    Skyline_Node *items;
+    size_t count, capacity;
+    // Side of the square being packed
+    int size;
+} Skyline;
+
+void skyline_reset(Skyline *skyline, int size) {
+    skyline->count = 0;
+    skyline->size = size;
+    da_append(skyline, ((Skyline_Node) { 0, 0, size }));
+}
+
+// Returns the y at which a `width`x`height` rect fits if placed at the x of node `i`, or -1 if it doesn't
+int skyline_fit(const Skyline *skyline, size_t i, int width, int height) {
+    int x = skyline->items[i].x;
+    if (x + width > skyline->size) return -1;
+
+    int y = skyline->items[i].y;
+    int width_left = width;
+    while (width_left > 0) {
+        assert(i < skyline->count && "the skyline always spans the whole page");
+        if (skyline->items[i].y > y) y = skyline->items[i].y;
+        if (y + height > skyline->size) return -1;
+        width_left -= skyline->items[i].width;
+        i++;
+    }
+    return y;
+}
+
+bool skyline_alloc(Skyline *skyline, int width, int height, int *out_x, int *out_y) {
+    int best_index = -1;
+    int best_x = 0, best_y = 0;
+    int best_bottom = INT_MAX, best_width = INT_MAX;
+    for (size_t i = 0; i < skyline->count; i++) {
+        int y = skyline_fit(skyline, i, width, height);
+        if (y < 0) continue;
+        if (y + height < best_bottom || (y + height == best_bottom && skyline->items[i].width < best_width)) {
+            best_index = i;
+            best_x = skyline->items[i].x;
+            best_y = y;
+            best_bottom = y + height;
+            best_width = skyline->items[i].width;
+        }
+    }
+    if (best_index < 0) return false;
+
+    Skyline_Node node = { best_x, best_y + height, width };
+    da_append(skyline, node);
+    memmove(skyline->items + best_index + 1, skyline->items + best_index, (skyline->count - best_index - 1) * sizeof(node));
+    skyline->items[best_index] = node;
+
+    // Shrink or drop the nodes that are now covered by the new one
+    for (size_t i = best_index + 1; i < skyline->count; i++) {
+        Skyline_Node *prev = &skyline->items[i - 1];
+        Skyline_Node *curr = &skyline->items[i];
+        if (curr->x >= prev->x + prev->width) break;
+
+        int shrink = prev->x + prev->width - curr->x;
+        curr->x += shrink;
+        curr->width -= shrink;
+        if (curr->width > 0) break;
+
+        memmove(curr, curr + 1, (skyline->count - i - 1) * sizeof(*curr));
+        skyline->count--;
+        i--;
+    }
+
+    // Merge neighbours at the same height
+    for (size_t i = 0; i + 1 < skyline->count; i++) {
+        if (skyline->items[i].y == skyline->items[i + 1].y) {
+            skyline->items[i].width += skyline->items[i + 1].width;
+            memmove(skyline->items + i + 1, skyline->items + i + 2, (skyline->count - i - 2) * sizeof(Skyline_Node));
+            skyline->count--;
+            i--;
+        }
+    }
+
+    *out_x = best_x;
+    *out_y = best_y;
+    return true;
+}
+
+typedef struct {
+    // CPU-side copy of the page. Needed to move images around when the page gets repacked
+    Image image;
+    Texture texture;
+    Skyline skyline;
+    // Area (including padding) of the slots that were ever allocated since the last repack and of the ones still alive
+    size_t used_area, live_area;
+} Atlas_Page;
+
+typedef struct {
+    Atlas_Page *items;
+    size_t count, capacity;
+} Atlas_Pages;
+
+typedef struct {
+    size_t page;
+    Rectangle rec;
+    bool alive;
+} Atlas_Slot;
+
+typedef struct {
+    Atlas_Slot *items;
+    size_t count, capacity;
+} Atlas_Slots;
+
+typedef struct {
+    Atlas_Pages pages;
+    // Objects refer to their images by slot index, which stays valid across repacks
+    Atlas_Slots slots;
+} Atlas;
+
+bool atlas_image_fits(Image image) {
+    return image.width <= ATLAS_MAX_IMAGE_SIZE && image.height <= ATLAS_MAX_IMAGE_SIZE;
+}
+
+size_t atlas_padded_area(Rectangle rec) {
+    return (size_t)(rec.width + ATLAS_PADDING) * (size_t)(rec.height + ATLAS_PADDING);
+}
+
+// Both images must be PIXELFORMAT_UNCOMPRESSED_R8G8B8A8
+void atlas_blit(Image *dst, int dst_x, int dst_y, Image src, int src_x, int src_y, int width, int height) {
+    for (int row = 0; row < height; row++) {
+        unsigned char *dst_row = (unsigned char*)dst->data + ((size_t)(dst_y + row) * dst->width + dst_x) * 4;
+        unsigned char *src_row = (unsigned char*)src.data + ((size_t)(src_y + row) * src.width + src_x) * 4;
+        memcpy(dst_row, src_row, (size_t)width * 4);
+    }
+}
+
+// Packs all the live slots of the page again from scratch, reclaiming the space of the removed ones.
+// Leaves the page untouched and returns false if the slots don't fit anymore (which the skyline packer can't rule out)
+bool atlas_repack_page(Atlas *atlas, size_t page_index) {
+    Atlas_Page *page = &atlas->pages.items[page_index];
+
+    typedef struct {
+        size_t slot;
+        Rectangle new_rec;
+    } Move;
+    struct {
+        Move *items;
+        size_t count, capacity;
+    } moves = {0};
+    for (size_t i = 0; i < atlas->slots.count; i++) {
+        Atlas_Slot *slot = &atlas->slots.items[i];
+        if (slot->alive && slot->page == page_index) da_append(&moves, ((Move) { .slot = i }));
+    }
+
+    // Tallest first packs noticeably tighter with a skyline
+    for (size_t i = 1; i < moves.count; i++) {
+        Move move = moves.items[i];
+        float height = atlas->slots.items[move.slot].rec.height;
+        size_t j = i;
+        for (; j > 0 && atlas->slots.items[moves.items[j - 1].slot].rec.height < height; j--) {
+            moves.items[j] = moves.items[j - 1];
+        }
+        moves.items[j] = move;
+    }
+
+    Skyline skyline = {0};
+    skyline_reset(&skyline, ATLAS_PAGE_SIZE);
+    bool ok = true;
+    da_foreach(Move, move, &moves) {
+        Rectangle rec = atlas->slots.items[move->slot].rec;
+        int x, y;
+        if (!skyline_alloc(&skyline, rec.width + ATLAS_PADDING, rec.height + ATLAS_PADDING, &x, &y)) {
+            ok = false;
+            break;
+        }
+        move->new_rec = (Rectangle) { x, y, rec.width, rec.height };
+    }
+
+    if (ok) {
+        Image image = GenImageColor(ATLAS_PAGE_SIZE, ATLAS_PAGE_SIZE, BLANK);
+        da_foreach(Move, move, &moves) {
+            Atlas_Slot *slot = &atlas->slots.items[move->slot];
+            atlas_blit(&image, move->new_rec.x, move->new_rec.y, page->image, slot->rec.x, slot->rec.y, slot->rec.width, slot->rec.height);
+            slot->rec = move->new_rec;
+        }
+        UnloadImage(page->image);
+        page->image = image;
+        UpdateTexture(page->texture, page->image.data);
+
+        da_free(page->skyline);
+        page->skyline = skyline;
+        page->used_area = page->live_area;
+        nob_log(INFO, "Repacked atlas page %zu (%zu images)", page_index, moves.count);
+    } else {
+        da_free(skyline);
+    }
+
+    da_free(moves);
+    return ok;
+}
+
+size_t atlas_add_page(Atlas *atlas) {
+    Atlas_Page page = {0};
+    page.image = GenImageColor(ATLAS_PAGE_SIZE, ATLAS_PAGE_SIZE, BLANK);
+    page.texture = LoadTextureFromImage(page.image);
+    skyline_reset(&page.skyline, ATLAS_PAGE_SIZE);
+    da_append(&atlas->pages, page);
+    nob_log(INFO, "Created atlas page %zu", atlas->pages.count - 1);
+    return atlas->pages.count - 1;
+}
+
+// Same as ImageFormat(image, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8), but with a SIMD path for the most common format that
+// images load in. raylib converts through normalized floats one pixel at a time
+void image_to_rgba8(Image *image) {
+    if (image->format == PIXELFORMAT_UNCOMPRESSED_R8G8B8 && image->mipmaps == 1) {
+        size_t pixels = (size_t)image->width * image->height;
+        unsigned char *rgba = RL_MALLOC(pixels * 4);
+        kernels.rgb8_to_rgba8(image->data, rgba, pixels);
+        RL_FREE(image->data);
+        image->data = rgba;
+        image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+    } else {
+        ImageFormat(image, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+    }
+}
+
+// `image` must satisfy atlas_image_fits() and gets converted to PIXELFORMAT_UNCOMPRESSED_R8G8B8A8. Returns the slot index
+size_t atlas_add(Atlas *atlas, Image *image) {
+    image_to_rgba8(image);
+    int width = image->width + ATLAS_PADDING;
+    int height = image->height + ATLAS_PADDING;
+    size_t area = (size_t)width * height;
+
+    size_t page_index = 0;
+    int x, y;
+    bool found = false;
+    for (; page_index < atlas->pages.count; page_index++) {
+        if (skyline_alloc(&atlas->pages.items[page_index].skyline, width, height, &x, &y)) {
+            found = true;
+            break;
+        }
+    }
+
+    // No page has room at the top of its skyline, so reclaim space freed by removed images before growing the atlas.
+    // Only the most fragmented page gets repacked so a single add never touches more than one page
+    if (!found) {
+        size_t most_dead_area = 0;
+        for (size_t i = 0; i < atlas->pages.count; i++) {
+            Atlas_Page *page = &atlas->pages.items[i];
+            size_t dead_area = page->used_area - page->live_area;
+            if (dead_area >= area && dead_area > most_dead_area) {
+                most_dead_area = dead_area;
+                page_index = i;
+            }
+        }
+        if (most_dead_area > 0 && atlas_repack_page(atlas, page_index)) {
+            found = skyline_alloc(&atlas->pages.items[page_index].skyline, width, height, &x, &y);
+        }
+    }
+
+    if (!found) {
+        page_index = atlas_add_page(atlas);
+        found = skyline_alloc(&atlas->pages.items[page_index].skyline, width, height, &x, &y);
+        assert(found && "ATLAS_MAX_IMAGE_SIZE must be smaller than ATLAS_PAGE_SIZE");
+    }
+
+    Atlas_Page *page = &atlas->pages.items[page_index];
+    Rectangle rec = { x, y, image->width, image->height };
+    atlas_blit(&page->image, x, y, *image, 0, 0, image->width, image->height);
+    UpdateTextureRec(page->texture, rec, image->data);
+    page->used_area += area;
+    page->live_area += area;
+
+    Atlas_Slot slot = { .page = page_index, .rec = rec, .alive = true };
+    for (size_t i = 0; i < atlas->slots.count; i++) {
+        if (!atlas->slots.items[i].alive) {
+            atlas->slots.items[i] = slot;
+            return i;
+        }
+    }
+    da_append(&atlas->slots, slot);
+    return atlas->slots.count - 1;
+}
+
+void atlas_remove(Atlas *atlas, size_t slot_index) {
+    Atlas_Slot *slot = &atlas->slots.items[slot_index];
+    assert(slot->alive);
+    slot->alive = false;
+
+    Atlas_Page *page = &atlas->pages.items[slot->page];
+    page->live_area -= atlas_padded_area(slot->rec);
+    // An empty page can be reused right away without moving anything around
+    if (page->live_area == 0) {
+        skyline_reset(&page->skyline, ATLAS_PAGE_SIZE);
+        page->used_area = 0;
+    }
+}
+
+// Glyphs of text objects are rasterized (as signed distance fields) the first time a codepoint shows up,
+// into pages that get evicted least-recently-used first once there are GLYPH_CACHE_MAX_PAGES of them.
+// Pages that were used in the current frame are never evicted, so a frame that needs more glyphs than that
+// (e.g. a text with thousands of different CJK characters) gets more pages instead. glyph_cache_trim() unloads
+// those again once the frames stop using them
+#define GLYPH_CACHE_PAGE_SIZE 1024
+#define GLYPH_CACHE_MAX_PAGES 4
+#define GLYPH_CACHE_PADDING 1
+#define GLYPH_CACHE_SDF_SIZE 64
+
+typedef struct {
+    int codepoint;
+    bool occupied;
+    // Whitespace and glyphs without an outline have no rec on any page
+    bool has_image;
+    size_t page;
+    Rectangle rec;
+    float offset_x, offset_y, advance_x;
+} Cached_Glyph;
+
+typedef struct {
+    Texture texture;
+    Skyline skyline;
+    size_t last_used_frame;
+} Glyph_Page;
+
+typedef struct {
+    Glyph_Page *items;
+    size_t count, capacity;
+} Glyph_Pages;
+
+typedef struct {
+    // Open addressing hash table keyed by codepoint. Capacity is always a power of two
+    Cached_Glyph *glyphs;
+    size_t glyphs_count, glyphs_capacity;
+    Glyph_Pages pages;
+    size_t frame;
+    // Bumped whenever a page gets evicted, which invalidates the recs that text layouts copied out of the cache
+    size_t generation;
+} Glyph_Cache;
+
+Cached_Glyph *glyph_cache_find_slot(Cached_Glyph *glyphs, size_t capacity, int codepoint) {
+    size_t i = ((uint32_t)codepoint * 2654435761u) & (capacity - 1);
+    while (glyphs[i].occupied && glyphs[i].codepoint != codepoint) {
+        i = (i + 1) & (capacity - 1);
+    }
+    return &glyphs[i];
+}
+
+void glyph_cache_rehash(Glyph_Cache *cache, size_t new_capacity, bool drop_evicted_page, size_t evicted_page) {
+    Cached_Glyph *glyphs = calloc(new_capacity, sizeof(*glyphs));
+    size_t count = 0;
+    for (size_t i = 0; i < cache->glyphs_capacity; i++) {
+        Cached_Glyph glyph = cache->glyphs[i];
+        if (!glyph.occupied) continue;
+        if (drop_evicted_page && glyph.has_image && glyph.page == evicted_page) continue;
+        *glyph_cache_find_slot(glyphs, new_capacity, glyph.codepoint) = glyph;
+        count++;
+    }
+    free(cache->glyphs);
+    cache->glyphs = glyphs;
+    cache->glyphs_capacity = new_capacity;
+    cache->glyphs_count = count;
+}
+
+void glyph_cache_evict_page(Glyph_Cache *cache, size_t page_index) {
+    Glyph_Page *page = &cache->pages.items[page_index];
+    nob_log(INFO, "Evicting glyph page %zu", page_index);
+
+    // Clear it so that stale texels don't bleed into the padding of new glyphs
+    void *zeros = calloc((size_t)GLYPH_CACHE_PAGE_SIZE * GLYPH_CACHE_PAGE_SIZE, 2);
+    UpdateTexture(page->texture, zeros);
+    free(zeros);
+    skyline_reset(&page->skyline, GLYPH_CACHE_PAGE_SIZE);
+
+    glyph_cache_rehash(cache, cache->glyphs_capacity, true, page_index);
+    cache->generation++;
+}
+
+// Called at the start of a frame, with cache->frame still being the last one
+void glyph_cache_trim(Glyph_Cache *cache) {
+    while (cache->pages.count > GLYPH_CACHE_MAX_PAGES) {
+        size_t page_index = 0;
+        for (size_t i = 1; i < cache->pages.count; i++) {
+            if (cache->pages.items[i].last_used_frame < cache->pages.items[page_index].last_used_frame) page_index = i;
+        }
+        if (cache->pages.items[page_index].last_used_frame == cache->frame) break;
+
+        Glyph_Page *page = &cache->pages.items[page_index];
+        nob_log(INFO, "Unloading glyph page %zu", page_index);
+        UnloadTexture(page->texture);
+        da_free(page->skyline);
+        glyph_cache_rehash(cache, cache->glyphs_capacity, true, page_index);
+
+        // The last page takes the place of the unloaded one
+        size_t last_page = cache->pages.count - 1;
+        for (size_t i = 0; i < cache->glyphs_capacity; i++) {
+            Cached_Glyph *glyph = &cache->glyphs[i];
+            if (glyph->occupied && glyph->has_image && glyph->page == last_page) glyph->page = page_index;
+        }
+        da_remove_unordered(&cache->pages, page_index);
+        cache->generation++;
+    }
+}
+
+// Returns the page where the rect went
+size_t glyph_cache_alloc(Glyph_Cache *cache, int width, int height, int *x, int *y) {
+    for (size_t i = 0; i < cache->pages.count; i++) {
+        if (skyline_alloc(&cache->pages.items[i].skyline, width, height, x, y)) return i;
+    }
+
+    size_t page_index = 0;
+    for (size_t i = 1; i < cache->pages.count; i++) {
+        if (cache->pages.items[i].last_used_frame < cache->pages.items[page_index].last_used_frame) page_index = i;
+    }
+    // Evicting a page that's in use would have the texts of this frame evict each other's glyphs forever
+    bool lru_in_use = cache->pages.count > 0 && cache->pages.items[page_index].last_used_frame == cache->frame;
+    if (cache->pages.count < GLYPH_CACHE_MAX_PAGES || lru_in_use) {
+        Image image = {
+            .data = calloc((size_t)GLYPH_CACHE_PAGE_SIZE * GLYPH_CACHE_PAGE_SIZE, 2),
+            .width = GLYPH_CACHE_PAGE_SIZE,
+            .height = GLYPH_CACHE_PAGE_SIZE,
+            .mipmaps = 1,
+            .format = PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA,
+        };
+        Glyph_Page page = {0};
+        page.texture = LoadTextureFromImage(image);
+        // The distance field only works if it gets interpolated
+        SetTextureFilter(page.texture, TEXTURE_FILTER_BILINEAR);
+        free(image.data);
+        skyline_reset(&page.skyline, GLYPH_CACHE_PAGE_SIZE);
+        da_append(&cache->pages, page);
+        page_index = cache->pages.count - 1;
+    } else {
+        glyph_cache_evict_page(cache, page_index);
+    }
+    cache->pages.items[page_index].last_used_frame = cache->frame;
+
+    bool ok = skyline_alloc(&cache->pages.items[page_index].skyline, width, height, x, y);
+    assert(ok && "a glyph must fit on an empty page");
+    return page_index;
+}
+
+const Cached_Glyph *glyph_cache_get(Glyph_Cache *cache, int codepoint) {
+    if (cache->glyphs_capacity == 0) glyph_cache_rehash(cache, 256, false, 0);
+
+    Cached_Glyph *slot = glyph_cache_find_slot(cache->glyphs, cache->glyphs_capacity, codepoint);
+    if (slot->occupied) {
+        // Whatever gets laid out in this frame is about to be drawn in it
+        if (slot->has_image) cache->pages.items[slot->page].last_used_frame = cache->frame;
+        return slot;
+    }
+
+    GlyphInfo *info = LoadFontData(font_data, font_len, GLYPH_CACHE_SDF_SIZE, &codepoint, 1, FONT_SDF);
+    Cached_Glyph glyph = {
+        .codepoint = codepoint,
+        .occupied = true,
+    };
+    if (info != NULL) {
+        glyph.offset_x = info->offsetX;
+        glyph.offset_y = info->offsetY;
+        glyph.advance_x = info->advanceX;
+
+        Image sdf = info->image;
+        if (codepoint != ' ' && sdf.data != NULL && sdf.width > 0 && sdf.height > 0) {
+            int x, y;
+            glyph.page = glyph_cache_alloc(cache, sdf.width + GLYPH_CACHE_PADDING, sdf.height + GLYPH_CACHE_PADDING, &x, &y);
+            glyph.rec = (Rectangle) { x, y, sdf.width, sdf.height };
+            glyph.has_image = true;
+
+            // The SDF shader reads the distance out of the alpha channel
+            unsigned char *pixels = malloc((size_t)sdf.width * sdf.height * 2);
+            for (int i = 0; i < sdf.width * sdf.height; i++) {
+                pixels[2*i + 0] = 255;
+                pixels[2*i + 1] = ((unsigned char*)sdf.data)[i];
+            }
+            UpdateTextureRec(cache->pages.items[glyph.page].texture, glyph.rec, pixels);
+            free(pixels);
+        }
+        UnloadFontData(info, 1);
+    }
+
+    // The allocation above may have evicted a page and rehashed the table
+    if (cache->glyphs_count + 1 > cache->glyphs_capacity * 7 / 10) {
+        glyph_cache_rehash(cache, cache->glyphs_capacity * 2, false, 0);
+    }
+    slot = glyph_cache_find_slot(cache->glyphs, cache->glyphs_capacity, codepoint);
+    *slot = glyph;
+    cache->glyphs_count++;
+    return slot;
+}
+
+// Stamped strokes are a dab of the brush every `spacing` times its size along the way, instead of lines
+typedef struct {
+    // Size of the dab in pixels
+    float size;
+    // 1 is a disc with a sharp edge, 0 fades out all the way from the center
+    float hardness;
+    // Distance between dabs, as a fraction of the size
+    float spacing;
+    // Of the whole stroke, however many of its dabs overlap
+    float opacity;
+    // How much smaller than `size` a dab can randomly be, as a fraction of it
+    float size_jitter;
+} Brush;
+
+#define BRUSH_MAX_SIZE 500
+#define BRUSH_TEXTURE_SIZE 256
+// Seconds it takes a fully smoothed stroke to catch up with the pointer, give or take
+#define STROKE_SMOOTHING_MAX_LAG 0.1
+
 typedef struct {
     Vector2 *items;
     size_t count, capacity;
     Color color;
     float weight;
+    // Drawn with `brush` instead of lines. Only ever painted into layers
+    bool stamped;
+    Brush brush;
 } Stroke;
 
+typedef struct {
+    Vector2 center;
+    float size;
+} Dab;
+
+typedef struct {
+    Dab *items;
+    size_t count, capacity;
+} Dabs;
+
+// Where the dabs of a stroke left off, so that points added later only produce their own dabs
+typedef struct {
+    // First point that wasn't walked to yet
+    size_t next_point;
+    // From the last walked point
+    float distance_to_next_dab;
+    size_t dabs;
+} Dab_Walker;
+
 typedef enum {
     OBJ_TEXTURE,
     OBJ_RECT,
     OBJ_STROKE,
     OBJ_TEXT,
+    OBJ_LAYER,
     COUNT_OBJS,
 } Object_Type;
 
+typedef struct {
+    size_t page;
+    // Relative to the position of the text
+    Rectangle source, dest;
+} Glyph_Quad;
+
+typedef struct {
+    Glyph_Quad *items;
+    size_t count, capacity;
+} Glyph_Quads;
+
+// Measuring and laying out text walks every glyph, so text objects keep the result around
+// until their text or size changes
+typedef struct {
+    bool valid;
+    float size;
+    // Glyph_Cache.generation at the time the layout was made
+    size_t glyph_cache_generation;
+    Vector2 measured_size;
+    Glyph_Quads quads;
+} Text_Layout;
+
+// Strokes can be painted into a raster layer instead of becoming objects of their own, so that an hour of sketching
+// costs as much to redraw as a handful of images. Layers are split into tiles that only get allocated once painted on
+#define LAYER_TILE_SIZE 256
+
+typedef struct {
+    // In tiles, relative to the origin of the layer
+    int x, y;
+    // Premultiplied alpha
+    RenderTexture texture;
+} Layer_Tile;
+
+typedef struct {
+    Layer_Tile *items;
+    size_t count, capacity;
+} Layer_Tiles;
+
+typedef enum {
+    FILTER_BRIGHTNESS_CONTRAST,
+    FILTER_LEVELS,
+    FILTER_CURVES,
+    FILTER_HUE_SATURATION,
+    FILTER_BLUR,
+    COUNT_FILTERS,
+} Filter_Type;
+
+// The control points of a curve sit at evenly spaced inputs, only their outputs can be changed
+#define CURVE_POINTS 5
+#define CURVE_LUT_SIZE 256
+// Every filter shader takes its parameters as a `uniform float params[FILTER_MAX_PARAMS]`
+#define FILTER_MAX_PARAMS 5
+// Blurs up to this radius are two gaussian passes, bigger ones go through a dual Kawase pyramid whose cost barely
+// depends on the radius
+#define BLUR_SEPARABLE_MAX_RADIUS 16
+#define BLUR_MAX_LEVELS 6
+#define BLUR_MAX_RADIUS 200
+
+typedef struct {
+    Filter_Type type;
+    union {
+        struct {
+            // Both in [-1, 1], 0 leaves the image as it is
+            float brightness, contrast;
+        } as_brightness_contrast;
+        struct {
+            float in_black, in_white, gamma, out_black, out_white;
+        } as_levels;
+        struct {
+            float outputs[CURVE_POINTS];
+            // CURVE_LUT_SIZE x 1, rebuilt whenever the outputs change
+            Texture lut;
+        } as_curves;
+        struct {
+            // Hue is a rotation in turns, saturation and value are factors
+            float hue, saturation, value;
+        } as_hue_saturation;
+        struct {
+            // In pixels, about 3 standard deviations of the gaussian
+            float radius;
+        } as_blur;
+    };
+} Filter;
+
+typedef struct {
+    Filter *items;
+    size_t count, capacity;
+} Filters;
+
+const char *filter_as_cstr(Filter_Type type) {
+    static_assert(COUNT_FILTERS == 5, "Please update after adding a new filter");
+    switch (type) {
+        case FILTER_BRIGHTNESS_CONTRAST: return "Brightness/Contrast";
+        case FILTER_LEVELS: return "Levels";
+        case FILTER_CURVES: return "Curves";
+        case FILTER_HUE_SATURATION: return "Hue/Saturation";
+        case FILTER_BLUR: return "Blur";
+        default: UNREACHABLE("invalid filter");
+    }
+}
+
+// A filter that doesn't change anything yet
+Filter filter_default(Filter_Type type) {
+    Filter filter = { .type = type };
+    static_assert(COUNT_FILTERS == 5, "Exhaustive handling of filters in filter_default");
+    switch (type) {
+        case FILTER_BRIGHTNESS_CONTRAST: break;
+        case FILTER_LEVELS:
+            filter.as_levels.in_white = 1;
+            filter.as_levels.gamma = 1;
+            filter.as_levels.out_white = 1;
+            break;
+        case FILTER_CURVES:
+            for (size_t i = 0; i < CURVE_POINTS; i++) filter.as_curves.outputs[i] = (float)i / (CURVE_POINTS - 1);
+            break;
+        case FILTER_HUE_SATURATION:
+            filter.as_hue_saturation.saturation = 1;
+            filter.as_hue_saturation.value = 1;
+            break;
+        case FILTER_BLUR: break;
+        case COUNT_FILTERS:
+        default: UNREACHABLE("invalid filter");
+    }
+    return filter;
+}
+
+void filter_unload(Filter *filter) {
+    if (filter->type == FILTER_CURVES && filter->as_curves.lut.id != 0) UnloadTexture(filter->as_curves.lut);
+}
+
 #define OBJ_NAME_MAX 128
+// Every row of the object list is exactly as tall as a button, so that the visible ones can be found without a layout pass
+#define OBJECT_LIST_ROW_HEIGHT 30
 typedef struct {
     Object_Type type;
+    // Unique for the lifetime of the app, unlike the index which changes whenever objects get reordered or removed
+    uint32_t id;
     char name[OBJ_NAME_MAX];
     size_t name_len;
     union {
         struct {
             Rectangle rec;
+            // Only valid if the image didn't go into the atlas
             Texture texture;
+            bool in_atlas;
+            size_t atlas_slot;
+            // Applied in order on the GPU, without touching the original image. The result is kept in `filtered` until
+            // any of them changes
+            Filters filters;
+            RenderTexture filtered;
+            bool filtered_dirty;
+            // File the image was loaded from, if any. Resampled images go back to it for their full resolution
+            char *source_path;
+            bool resampled;
         } as_texture;
         struct {
             Rectangle rec;
@@ -115,31 +819,23 @@ typedef struct {
             float size;
             Color color;
             Vector2 pos;
+            Text_Layout layout;
         } as_text;
+        struct {
+            // World position of the top left corner of tile (0, 0)
+            Vector2 origin;
+            Layer_Tiles tiles;
+        } as_layer;
     };
 } Object;
 
-void object_unload(Object *object) {
-    static_assert(COUNT_OBJS == 4, "Exhaustive handling of object types in object_unload");
-    switch (object->type) {
-        case OBJ_TEXTURE:
-            UnloadTexture(object->as_texture.texture);
-            break;
-        case OBJ_RECT: break;
-        case OBJ_STROKE:
-            da_free(object->as_stroke);
-            break;
-        case OBJ_TEXT:
-            da_free(object->as_text.text);
-            break;
-        case COUNT_OBJS:
-        default: UNREACHABLE("invalid object type: you have a memory corruption somewhere. good luck");
-    }
-}
-
 void object_set_name(Object *object, String_View name) {
     size_t count = name.count;
-    if (count > OBJ_NAME_MAX) count = OBJ_NAME_MAX;
+    if (count > OBJ_NAME_MAX) {
+        count = OBJ_NAME_MAX;
+        // Don't cut a UTF-8 sequence in half
+        while (count > 0 && (name.data[count] & 0xC0) == 0x80) count--;
+    }
     memcpy(object->name, name.data, count);
     object->name_len = count;
 }
@@ -149,15 +845,343 @@ typedef struct {
     size_t count, capacity;
 } Objects;
 
+// Runs of rectangles and stroke segments are drawn as instanced quads. A rectangle is just a horizontal segment
+// as thick as the rectangle is tall, so both fit the same instance layout and can share a run
+typedef struct {
+    Vector2 a, b;
+    float weight;
+    Color color;
+} Shape_Instance;
+
+typedef struct {
+    Shape_Instance *items;
+    size_t count, capacity;
+} Shape_Instances;
+
+// Shorter runs go through the regular raylib batch, since flushing it costs more than we'd save
+#define SHAPE_BATCH_MIN_INSTANCES 64
+
+typedef struct {
+    bool loaded;
+    Shader shader;
+    int mvp_loc;
+    int ends_loc, weight_loc, color_loc;
+    unsigned int vao, quad_vbo, instance_vbo;
+    size_t instance_vbo_capacity;
+    Shape_Instances instances;
+} Shape_Batch;
+
+typedef struct {
+    bool loaded;
+    // Where there's no instancing, dabs go through the raylib batch with `fallback_shader` instead
+    bool instanced;
+    Shader shader, fallback_shader;
+    int mvp_loc, color_loc;
+    unsigned int vao, quad_vbo, instance_vbo;
+    size_t instance_vbo_capacity;
+    // Alpha of a dab, for brushes of `texture_hardness`
+    Texture texture;
+    float texture_hardness;
+    // Dabs of the stroke being rendered
+    Dabs dabs;
+    // A single stroke of a layer tile, before it gets composited with its opacity
+    RenderTexture scratch;
+} Brush_Renderer;
+
 typedef enum {
     TOOL_MOVE = 0,
     TOOL_RECT,
     TOOL_DRAW,
     TOOL_TEXT,
     TOOL_CHANGE_CANVAS,
+    TOOL_FILL,
+    TOOL_WAND,
     COUNT_TOOLS,
 } Tool;
 
+// Pixels [start, end) of a row
+typedef struct {
+    int start, end;
+} Selection_Run;
+
+typedef struct {
+    Selection_Run *items;
+    size_t count, capacity;
+} Selection_Runs;
+
+// Outline segment between two pixel corners
+typedef struct {
+    int x0, y0, x1, y1;
+} Selection_Edge;
+
+typedef struct {
+    Selection_Edge *items;
+    size_t count, capacity;
+} Selection_Edges;
+
+typedef enum {
+    SELECTION_REPLACE,
+    SELECTION_ADD,
+    SELECTION_SUBTRACT,
+    SELECTION_INTERSECT,
+    COUNT_SELECTION_OPS,
+} Selection_Op;
+
+// Pixels of the canvas picked with the magic wand, as sorted runs of selected pixels per row. The usual blobby
+// selection is a handful of runs per row, so it costs kilobytes where a byte per pixel would cost the whole image
+typedef struct {
+    int width, height;
+    // World position of pixel (0, 0), i.e. where the canvas was when the selection was started
+    Vector2 origin;
+    // The runs of row y are runs.items[row_starts[y]..row_starts[y + 1]]. They never touch or overlap each other
+    size_t *row_starts;
+    Selection_Runs runs;
+    // Rebuilt whenever the runs change, so that the outline doesn't have to be traced again every frame
+    Selection_Edges edges;
+} Selection;
+
+typedef enum {
+    PHASE_CLAY_LAYOUT,
+    PHASE_CLAY_RENDER,
+    PHASE_UPDATE_MAIN_AREA,
+    PHASE_DRAW_SCENE,
+    PHASE_COLOR_PICKER,
+    COUNT_PHASES,
+} Phase;
+
+const char *phase_as_cstr(Phase phase) {
+    static_assert(COUNT_PHASES == 5, "Please update after adding a new phase");
+    switch (phase) {
+        case PHASE_CLAY_LAYOUT: return "Clay layout";
+        case PHASE_CLAY_RENDER: return "Clay render";
+        case PHASE_UPDATE_MAIN_AREA: return "update_main_area()";
+        case PHASE_DRAW_SCENE: return "draw_scene()";
+        case PHASE_COLOR_PICKER: return "Color picker";
+        default: UNREACHABLE("invalid phase");
+    }
+}
+
+typedef struct {
+    size_t draw_calls;
+    size_t vertices;
+    size_t texture_binds;
+} Draw_Stats;
+
+typedef struct {
+    // Calls to malloc(), calloc() and realloc()
+    size_t allocations;
+    // Requested, not actually handed out by the allocator
+    size_t bytes;
+    size_t frees;
+} Alloc_Stats;
+
+#define PROFILER_HISTORY 240
+#define PROFILER_GPU_QUERIES 4
+// 1 ms each, the last one also counting everything slower
+#define PROFILER_HISTOGRAM_BINS 50
+
+typedef struct {
+    bool loaded;
+    // Except for FILTER_BLUR, which has its own Blur_Shaders
+    Shader shaders[COUNT_FILTERS];
+    int params_locs[COUNT_FILTERS];
+    int lut_loc;
+} Filter_Shaders;
+
+typedef struct {
+    bool loaded;
+    Shader gaussian, kawase_down, kawase_up;
+    int gaussian_bounds_loc, gaussian_direction_loc, gaussian_sigma_loc, gaussian_taps_loc, gaussian_alpha_loc;
+    int down_halfpixel_loc, down_offset_loc;
+    int up_halfpixel_loc, up_offset_loc, up_unpremultiply_loc;
+} Blur_Shaders;
+
+typedef struct {
+    // Intermediate result of the gaussian passes
+    RenderTexture scratch;
+    // levels[0] is full size, every next one half the size of the previous one
+    RenderTexture levels[BLUR_MAX_LEVELS + 1];
+} Blur_Targets;
+
+typedef struct {
+    bool visible;
+    bool gpu_queries_loaded;
+
+    double frame_start;
+    double phase_start[COUNT_PHASES];
+    // Accumulated over the current frame, since a phase may run more than once per frame
+    double phase_time[COUNT_PHASES];
+    // Exponential moving averages in milliseconds, so that the overlay is readable
+    float phase_ms[COUNT_PHASES];
+    float cpu_ms, gpu_ms;
+
+    // Stats of the last complete frame, which includes the final batch flush in EndDrawing()
+    Draw_Stats draw_stats;
+
+    // Allocations and temp arena usage, accumulated over the current frame and copied over to the last_* fields
+    // at the end of it. Allocations are only counted in builds with `./nob -a`
+    Alloc_Stats frame_start_allocs, phase_start_allocs[COUNT_PHASES];
+    size_t frame_start_temp, phase_start_temp[COUNT_PHASES];
+    Alloc_Stats phase_allocs[COUNT_PHASES];
+    size_t phase_temp[COUNT_PHASES];
+    Alloc_Stats last_frame_allocs, last_phase_allocs[COUNT_PHASES];
+    size_t last_frame_temp_peak, last_phase_temp[COUNT_PHASES];
+
+    float frame_ms[PROFILER_HISTORY];
+    size_t frame_ms_count, frame_ms_next;
+
+    unsigned int gpu_queries[PROFILER_GPU_QUERIES];
+    size_t gpu_frame;
+} Profiler;
+
+// The GL functions that the profiler's counting hooks stand in for. They live in the App rather than in globals of the
+// code, since the hooks have to be taken out before a hot reload unmaps them and put back in by the new code
+typedef struct {
+    bool installed;
+    void (*draw_arrays)(unsigned int mode, int first, int count);
+    void (*draw_arrays_instanced)(unsigned int mode, int first, int count, int instances);
+    void (*draw_elements)(unsigned int mode, int count, unsigned int type, const void *indices);
+    void (*bind_texture)(unsigned int target, unsigned int texture);
+} Gl_Hooks;
+
+// All the input the app reacts to goes through an Input_Frame captured at the start of every frame, so that a session
+// can be recorded and replayed deterministically later (e.g. to attach a reproducible workload to a performance bug)
+#define INPUT_KEY_COUNT 512
+#define INPUT_MOUSE_BUTTON_COUNT 7
+#define INPUT_MAX_CHARS 16
+#define INPUT_REPLAY_FRAME_TIME (1.0f / 60.0f)
+
+typedef struct {
+    char **items;
+    size_t count, capacity;
+} Dropped_Files;
+
+typedef struct {
+    int screen_width, screen_height;
+    Vector2 mouse;
+    Vector2 wheel;
+    bool buttons[INPUT_MOUSE_BUTTON_COUNT];
+    bool keys[INPUT_KEY_COUNT];
+    bool keys_repeated[INPUT_KEY_COUNT];
+    int chars[INPUT_MAX_CHARS];
+    size_t chars_count;
+    Dropped_Files dropped_files;
+    float frame_time;
+} Input_Frame;
+
+typedef enum {
+    INPUT_LIVE = 0,
+    INPUT_RECORDING,
+    INPUT_REPLAYING,
+} Input_Mode;
+
+typedef struct {
+    float *items;
+    size_t count, capacity;
+} Frame_Times;
+
+// Pointer motion as the window system reports it, which can be many times per frame
+typedef struct {
+    Vector2 pos;
+    double time;
+} Pointer_Sample;
+
+typedef struct {
+    Pointer_Sample *items;
+    size_t count, capacity;
+} Pointer_Samples;
+
+typedef void (*Cursor_Pos_Callback)(void *window, double x, double y);
+
+typedef struct {
+    Input_Mode mode;
+    Input_Frame curr, prev;
+    size_t chars_read;
+    // Frames since the recording or replay started
+    size_t frame;
+
+    String_Builder recording;
+    // Diff the first recorded frame against nothing, so that the recording starts with the full input state
+    bool record_full_state;
+
+    const char *replay_path;
+    String_Builder replay;
+    String_View replay_rest;
+    size_t replay_end_frame;
+    bool replay_finished;
+    double frame_start;
+    Frame_Times replay_cpu_ms;
+
+    // Motion that came in since the last frame, oldest first. The samples of the current frame are the ones that were
+    // queued before it started
+    Pointer_Samples pointer_queue;
+    Pointer_Samples pointer_samples;
+    // raylib's own callback, which still needs to see every motion event
+    Cursor_Pos_Callback chained_cursor_pos_callback;
+} Input;
+
+// Native file dialogs block until the user is done with them, so they run on a thread of their own and the frame loop
+// picks up the result once it's there. Only one can be open at a time, as tinyfiledialogs returns paths in static buffers.
+// Message boxes block just the same, so they go through here too
+typedef enum {
+    FILE_DIALOG_OPEN_IMAGE,
+    FILE_DIALOG_ADD_IMAGE,
+    FILE_DIALOG_EXPORT_IMAGE,
+    // Tells the user that the image couldn't be exported to `path`. Its result never has a path
+    FILE_DIALOG_EXPORT_ERROR,
+    COUNT_FILE_DIALOGS,
+} File_Dialog_Kind;
+
+typedef struct {
+    File_Dialog_Kind kind;
+    // NULL if the dialog got cancelled. Must be freed by whoever takes the result
+    char *path;
+} File_Dialog_Result;
+
+typedef struct {
+    // Owned by the frame loop
+    bool open;
+    // Set by the dialog thread once result is filled in
+    atomic_bool done;
+    File_Dialog_Result result;
+} File_Dialog;
+
+// On frames without any input the UI is not laid out again, and the last rendered one is composited from a texture
+typedef struct {
+    bool valid;
+    RenderTexture texture;
+    // Bounding boxes of the custom elements as of the last layout
+    Rectangle main_area, color_picker, hue_picker;
+    Clay_Vector2 scroll;
+} Ui_Cache;
+
+// Flight recorder of timed zones that can be dumped as Chrome trace-event JSON (open it in https://ui.perfetto.dev)
+#define TRACE_CAPACITY (1 << 16)
+
+// Threads in the trace, main thread first
+#define TRACE_THREAD_MAIN 1
+#define TRACE_THREAD_FILE_DIALOG 2
+
+typedef struct {
+    // Position in the sequence of all events plus one, once the event is complete. 0 while it's being written. Lets
+    // the dump tell finished events from ones that another thread is in the middle of writing or has yet to overwrite
+    atomic_size_t sequence;
+    // Must have static lifetime
+    const char *name;
+    double start, duration;
+    int thread;
+} Trace_Event;
+
+typedef struct {
+    atomic_bool recording;
+    Trace_Event *events;
+    // Total number of events ever added. The ring buffer keeps the last TRACE_CAPACITY of them. It doesn't go back to 0
+    // for a new recording, so that events left over from the last one can't pass for new ones
+    atomic_size_t next;
+    // `next` at the time recording started
+    size_t first;
+} Trace;
+
 struct App {
     size_t size;
 
@@ -186,13 +1210,305 @@ struct App {
     float stroke_weight;
 
     Object *current_text_object;
+
+    // Everything from here on was added later. New fields go at the end, as app_post_reload only zero-fills the part of
+    // the struct that a hot reload appended and would read whatever got shifted as garbage. The same goes for growing
+    // any of the structs embedded here
+    Atlas atlas;
+    Shape_Batch shape_batch;
+    Shader sdf_shader;
+    // Text objects are drawn out of signed distance fields, so that they stay sharp at any size and zoom level
+    Glyph_Cache glyph_cache;
+    Profiler profiler;
+    Trace trace;
+    Input input;
+    // Order the object list by memory usage instead of by depth
+    bool sort_objects_by_size;
+    uint32_t next_object_id;
+    Ui_Cache ui_cache;
+    // Forces the UI to be laid out again on the next frame. Set it when something that the sidebar shows changes
+    // without any input
+    bool ui_dirty;
+    File_Dialog file_dialog;
+
+    Filter_Shaders filter_shaders;
+    // Ping-pong partner of the `filtered` texture of an image while its filters get applied
+    RenderTexture filter_scratch;
+    // Object whose filters are shown in the sidebar, 0 if none
+    uint32_t filters_object_id;
+    Blur_Shaders blur_shaders;
+    Blur_Targets blur_targets;
+    float export_blur_radius;
+    // Used by the Shrink button of images that are a lot bigger than they are displayed
+    Resize_Filter resample_filter;
+    // Export resampled images from their original files instead, at full quality
+    bool export_originals;
+
+    // Biggest difference of any channel from the clicked color that still gets filled or selected
+    float color_tolerance;
+    // Clicks of the tools that render the canvas, which can't happen in the middle of drawing the frame
+    bool canvas_click_pending;
+    Vector2 canvas_click;
+    Selection selection;
+    // How the next magic wand selection gets combined with the current one
+    Selection_Op selection_op;
+    Shader marching_ants_shader;
+    int marching_ants_offset_loc;
+
+    // Finished strokes go into the paint layer instead of becoming objects
+    bool paint_into_layer;
+    // Object that strokes get painted into, 0 if there is none yet
+    uint32_t paint_layer_id;
+    // Released in this frame but not painted yet, as that can't happen in the middle of drawing the frame
+    Stroke pending_layer_stroke;
+    // New strokes are stamped with `brush`, which implies painting them into the layer
+    bool brush_stamped;
+    Brush brush;
+    Brush_Renderer brush_renderer;
+    // The stroke being drawn, rendered in screen space with the camera of the time. Every frame only adds the part of
+    // it that's new since the last one
+    RenderTexture stroke_overlay;
+    Camera2D stroke_overlay_camera;
+    float stroke_overlay_opacity;
+    // Points of the current stroke in the overlay so far, 0 if it needs to be cleared first
+    size_t stroke_overlay_points;
+    Dab_Walker stroke_overlay_walker;
+    // 0 to 1, how far the stroke lags behind the pointer to even out the shaking of the hand
+    float stroke_smoothing;
+    // Of the pointer sample that the last point of the current stroke came from
+    double stroke_last_time;
+    Gl_Hooks gl_hooks;
 };
 
 App *g;
 
+// Puts `image` in the atlas if it fits, in a texture of its own otherwise. Takes ownership of `image`
+void object_set_image(Object *object, Image image) {
+    assert(object->type == OBJ_TEXTURE);
+    if (image.data != NULL && atlas_image_fits(image)) {
+        object->as_texture.in_atlas = true;
+        object->as_texture.atlas_slot = atlas_add(&g->atlas, &image);
+    } else {
+        object->as_texture.in_atlas = false;
+        object->as_texture.texture = LoadTextureFromImage(image);
+    }
+    UnloadImage(image);
+}
+
+void object_release_image(Object *object) {
+    assert(object->type == OBJ_TEXTURE);
+    if (object->as_texture.in_atlas) {
+        atlas_remove(&g->atlas, object->as_texture.atlas_slot);
+    } else {
+        UnloadTexture(object->as_texture.texture);
+    }
+}
+
+// Resolution of the image itself, as opposed to the size it's drawn at
+Vector2 object_image_size(const Object *object) {
+    assert(object->type == OBJ_TEXTURE);
+    if (object->as_texture.in_atlas) {
+        Rectangle rec = g->atlas.slots.items[object->as_texture.atlas_slot].rec;
+        return (Vector2) { rec.width, rec.height };
+    }
+    return (Vector2) { object->as_texture.texture.width, object->as_texture.texture.height };
+}
+
+void object_unload(Object *object) {
+    static_assert(COUNT_OBJS == 5, "Exhaustive handling of object types in object_unload");
+    switch (object->type) {
+        case OBJ_TEXTURE:
+            object_release_image(object);
+            da_foreach(Filter, filter, &object->as_texture.filters) filter_unload(filter);
+            da_free(object->as_texture.filters);
+            if (object->as_texture.filtered.id != 0) UnloadRenderTexture(object->as_texture.filtered);
+            free(object->as_texture.source_path);
+            break;
+        case OBJ_RECT: break;
+        case OBJ_STROKE:
+            da_free(object->as_stroke);
+            break;
+        case OBJ_TEXT:
+            da_free(object->as_text.text);
+            da_free(object->as_text.layout.quads);
+            break;
+        case OBJ_LAYER:
+            da_foreach(Layer_Tile, tile, &object->as_layer.tiles) UnloadRenderTexture(tile->texture);
+            da_free(object->as_layer.tiles);
+            break;
+        case COUNT_OBJS:
+        default: UNREACHABLE("invalid object type: you have a memory corruption somewhere. good luck");
+    }
+}
+
+void add_object(Object object) {
+    object.id = ++g->next_object_id;
+    da_append(&g->objects, object);
+}
+
+typedef struct {
+    // Allocated vs actually used bytes of the CPU-side buffers, including the slot in the object list
+    size_t cpu, cpu_used;
+    size_t gpu;
+} Object_Memory;
+
+// Images in the atlas are charged for their share of the page (padding included), both for the texture
+// and for the CPU copy the atlas keeps around to repack pages
+Object_Memory object_memory_usage(const Object *object) {
+    Object_Memory memory = { .cpu = sizeof(*object), .cpu_used = sizeof(*object) };
+    static_assert(COUNT_OBJS == 5, "Exhaustive handling of object types in object_memory_usage");
+    switch (object->type) {
+        case OBJ_TEXTURE:
+            if (object->as_texture.in_atlas) {
+                Atlas_Slot slot = g->atlas.slots.items[object->as_texture.atlas_slot];
+                size_t bytes = atlas_padded_area(slot.rec) * 4;
+                memory.cpu += bytes;
+                memory.cpu_used += bytes;
+                memory.gpu += bytes;
+            } else {
+                Texture texture = object->as_texture.texture;
+                memory.gpu += GetPixelDataSize(texture.width, texture.height, texture.format);
+            }
+            memory.cpu += object->as_texture.filters.capacity * sizeof(Filter);
+            memory.cpu_used += object->as_texture.filters.count * sizeof(Filter);
+            da_foreach(Filter, filter, &object->as_texture.filters) {
+                if (filter->type == FILTER_CURVES) memory.gpu += CURVE_LUT_SIZE;
+            }
+            if (object->as_texture.filtered.id != 0) {
+                Texture filtered = object->as_texture.filtered.texture;
+                memory.gpu += GetPixelDataSize(filtered.width, filtered.height, filtered.format);
+            }
+            if (object->as_texture.source_path != NULL) {
+                size_t bytes = strlen(object->as_texture.source_path) + 1;
+                memory.cpu += bytes;
+                memory.cpu_used += bytes;
+            }
+            break;
+        case OBJ_RECT: break;
+        case OBJ_STROKE:
+            memory.cpu += object->as_stroke.capacity * sizeof(*object->as_stroke.items);
+            memory.cpu_used += object->as_stroke.count * sizeof(*object->as_stroke.items);
+            break;
+        case OBJ_TEXT:
+            memory.cpu += object->as_text.text.capacity;
+            memory.cpu_used += object->as_text.text.count;
+            memory.cpu += object->as_text.layout.quads.capacity * sizeof(Glyph_Quad);
+            memory.cpu_used += object->as_text.layout.quads.count * sizeof(Glyph_Quad);
+            break;
+        case OBJ_LAYER:
+            memory.cpu += object->as_layer.tiles.capacity * sizeof(Layer_Tile);
+            memory.cpu_used += object->as_layer.tiles.count * sizeof(Layer_Tile);
+            memory.gpu += object->as_layer.tiles.count * GetPixelDataSize(LAYER_TILE_SIZE, LAYER_TILE_SIZE, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+            break;
+        case COUNT_OBJS:
+        default: UNREACHABLE("invalid object type: you have a memory corruption somewhere. good luck");
+    }
+    return memory;
+}
+
+// Row of the object list when it's sorted by memory usage
+typedef struct {
+    size_t index;
+    size_t bytes;
+} Object_Size;
+
+// Biggest first, and topmost first among ones of the same size
+int compare_object_sizes(const void *a, const void *b) {
+    const Object_Size *x = a;
+    const Object_Size *y = b;
+    if (x->bytes != y->bytes) return x->bytes < y->bytes ? 1 : -1;
+    return (x->index < y->index) - (x->index > y->index);
+}
+
+const char *temp_human_readable_size(size_t bytes) {
+    if (bytes < 1024) return temp_sprintf("%zu B", bytes);
+    if (bytes < 1024*1024) return temp_sprintf("%.1f KiB", bytes / 1024.0);
+    if (bytes < 1024*1024*1024) return temp_sprintf("%.1f MiB", bytes / (1024.0*1024.0));
+    return temp_sprintf("%.2f GiB", bytes / (1024.0*1024.0*1024.0));
+}
+
+// Same metrics as DrawTextEx()/MeasureTextEx(), but done once per edit instead of every time the text is drawn or measured
+Text_Layout *text_object_get_layout(Object *object) {
+    assert(object->type == OBJ_TEXT);
+    Text_Layout *layout = &object->as_text.layout;
+    Glyph_Cache *cache = &g->glyph_cache;
+    if (layout->valid && layout->size == object->as_text.size && layout->glyph_cache_generation == cache->generation) return layout;
+
+    const float spacing = 1.0f;
+    String_Builder text = object->as_text.text;
+    float size = object->as_text.size;
+    float scale = size / GLYPH_CACHE_SDF_SIZE;
+
+    // Rasterizing a glyph may evict a page that an earlier glyph of this very text lives on (one that was only used by
+    // other frames up to now), in which case we go again. The pages it touches are marked as used in this frame, so the
+    // second attempt can't evict any of them. Should it happen anyway, the layout stays invalid and gets redone next frame
+    bool stable = false;
+    for (int attempt = 0; attempt < 2 && !stable; attempt++) {
+        size_t generation = cache->generation;
+        layout->quads.count = 0;
+        float x = 0, y = 0;
+        float max_width = 0;
+        size_t line_glyphs = 0;
+        for (size_t i = 0; i < text.count;) {
+            int codepoint_size = 0;
+            int codepoint = GetCodepointNext(text.items + i, &codepoint_size);
+            i += codepoint_size;
+
+            if (codepoint == '\n') {
+                if (line_glyphs > 0 && x - spacing > max_width) max_width = x - spacing;
+                x = 0;
+                y += size;
+                line_glyphs = 0;
+                continue;
+            }
+
+            const Cached_Glyph *glyph = glyph_cache_get(cache, codepoint);
+            if (glyph->has_image) {
+                Glyph_Quad quad = {
+                    .page = glyph->page,
+                    .source = glyph->rec,
+                    .dest = {
+                        x + glyph->offset_x * scale,
+                        y + glyph->offset_y * scale,
+                        glyph->rec.width * scale,
+                        glyph->rec.height * scale,
+                    },
+                };
+                da_append(&layout->quads, quad);
+            }
+
+            x += (glyph->advance_x != 0 ? glyph->advance_x : glyph->rec.width) * scale + spacing;
+            line_glyphs++;
+        }
+        if (line_glyphs > 0 && x - spacing > max_width) max_width = x - spacing;
+
+        layout->measured_size = (Vector2) { max_width, y + size };
+        stable = generation == cache->generation;
+    }
+
+    layout->size = size;
+    layout->glyph_cache_generation = cache->generation;
+    layout->valid = stable;
+    return layout;
+}
+
+void text_object_invalidate_layout(Object *object) {
+    assert(object->type == OBJ_TEXT);
+    object->as_text.layout.valid = false;
+}
+
+
+Rectangle layer_tile_rect(const Object *layer, const Layer_Tile *tile) {
+    assert(layer->type == OBJ_LAYER);
+    Vector2 origin = layer->as_layer.origin;
+    return (Rectangle) {
+        origin.x + tile->x * LAYER_TILE_SIZE, origin.y + tile->y * LAYER_TILE_SIZE,
+        LAYER_TILE_SIZE, LAYER_TILE_SIZE,
+    };
+}
 
-Rectangle object_get_bounding_box(const Object *object) {
-    static_assert(COUNT_OBJS == 4, "Exhaustive handling of object types in object_get_bounding_box");
+Rectangle object_get_bounding_box(Object *object) {
+    static_assert(COUNT_OBJS == 5, "Exhaustive handling of object types in object_get_bounding_box");
     switch (object->type) {
         case OBJ_RECT: return object->as_rect.rec;
         case OBJ_TEXTURE: return object->as_texture.rec;
@@ -208,22 +1524,31 @@ Rectangle object_get_bounding_box(const Object *object) {
             return (Rectangle) { min.x, min.y, max.x - min.x, max.y - min.y };
         } break;
         case OBJ_TEXT: {
-            Vector2 size = MeasureTextEx(g->font,
-                                         temp_sprintf(SV_Fmt, SV_Arg(sb_to_sv(object->as_text.text))),
-                                         object->as_text.size,
-                                         1.0f);
-
+            Vector2 size = text_object_get_layout(object)->measured_size;
             Vector2 pos = object->as_text.pos;
             Rectangle bounding_box = {pos.x, pos.y, size.x, size.y};
             return bounding_box;
         } break;
+        case OBJ_LAYER: {
+            Vector2 origin = object->as_layer.origin;
+            if (object->as_layer.tiles.count == 0) return (Rectangle) { origin.x, origin.y, 0, 0 };
+
+            Vector2 min = {INFINITY, INFINITY};
+            Vector2 max = {-INFINITY, -INFINITY};
+            da_foreach(Layer_Tile, tile, &object->as_layer.tiles) {
+                Rectangle rec = layer_tile_rect(object, tile);
+                min = Vector2Min(min, (Vector2) { rec.x, rec.y });
+                max = Vector2Max(max, (Vector2) { rec.x + rec.width, rec.y + rec.height });
+            }
+            return (Rectangle) { min.x, min.y, max.x - min.x, max.y - min.y };
+        } break;
         case COUNT_OBJS:
         default: UNREACHABLE("invalid object type: you have a memory corruption somewhere. good luck");
     }
 }
 
 void object_set_bounding_box(Object *object, Rectangle new) {
-    static_assert(COUNT_OBJS == 4, "Exhaustive handling of object types in object_set_bounding_box");
+    static_assert(COUNT_OBJS == 5, "Exhaustive handling of object types in object_set_bounding_box");
     switch (object->type) {
         case OBJ_RECT:    object->as_rect.rec = new; break;
         case OBJ_TEXTURE: object->as_texture.rec = new; break;
@@ -247,6 +1572,12 @@ void object_set_bounding_box(Object *object, Rectangle new) {
             object->as_text.pos.x = new.x;
             object->as_text.pos.y = new.y;
         } break;
+        // Only moves, since scaling the pixels would blur them
+        case OBJ_LAYER: {
+            Rectangle old = object_get_bounding_box(object);
+            object->as_layer.origin.x += new.x - old.x;
+            object->as_layer.origin.y += new.y - old.y;
+        } break;
         case COUNT_OBJS:
         default: UNREACHABLE("invalid object type: you have a memory corruption somewhere. good luck");
     }
@@ -340,258 +1671,2095 @@ EM_JS(void, save_file, (const unsigned char *data, size_t count), {
     "    return c.z * mix(K.xxx, clamp(p - K.xxx, 0.0, 1.0), c.y);\n" \
     "}\n"
 
-void app_init(void) {
-    g = malloc(sizeof(*g));
-    memset(g, 0, sizeof(*g));
-    g->size = sizeof(*g);
-
-    g->camera.zoom = 1;
-    g->camera.target = (Vector2) { (float)GetScreenWidth() / 2, (float)GetScreenHeight() / 2 };
+_Thread_local int trace_thread_id = TRACE_THREAD_MAIN;
+
+// Safe to call from any thread
+void trace_add(const char *name, double start, double end) {
+    Trace *trace = &g->trace;
+    if (!atomic_load_explicit(&trace->recording, memory_order_relaxed)) return;
+    size_t index = atomic_fetch_add_explicit(&trace->next, 1, memory_order_relaxed);
+    Trace_Event *event = &trace->events[index % TRACE_CAPACITY];
+    // Seqlock style: the slot reads as unfinished until all of it has been written
+    atomic_store_explicit(&event->sequence, 0, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+    event->name = name;
+    event->start = start;
+    event->duration = end - start;
+    event->thread = trace_thread_id;
+    atomic_store_explicit(&event->sequence, index + 1, memory_order_release);
+}
 
-    uint64_t total_memory_size = Clay_MinMemorySize();
-    Clay_Arena clay_arena = Clay_CreateArenaWithCapacityAndMemory(total_memory_size, malloc(total_memory_size));
+double trace_zone_begin(void) {
+    return atomic_load_explicit(&g->trace.recording, memory_order_relaxed) ? GetTime() : 0;
+}
 
-    // NOTE: I have no idea what the last 3 parameters of LoadFontFromMemory() mean,
-    // I just copied them from the source code of the regular LoadFont()
-    g->font = LoadFontFromMemory(".ttf", font_data, font_len, 32, NULL, 95);
-    g->clay = Clay_Initialize(clay_arena, (Clay_Dimensions) { GetScreenWidth(), GetScreenHeight() }, (Clay_ErrorHandler) { handle_clay_error, 0 });
-    Clay_SetMeasureTextFunction(Raylib_MeasureText, &g->font);
+void trace_zone_end(const char *name, double start) {
+    if (atomic_load_explicit(&g->trace.recording, memory_order_relaxed)) trace_add(name, start, GetTime());
+}
 
-    g->current_color = WHITE;
+// Usage: `TraceZone("name") { ... }`. Don't break out of it or return from it
+#define TraceZone(name) for (double _trace_start = trace_zone_begin(), _trace_once = 1; _trace_once; _trace_once = 0, trace_zone_end(name, _trace_start))
 
-    Image one_by_one_image = GenImageColor(1, 1, WHITE);
-    g->one_by_one_texture = LoadTextureFromImage(one_by_one_image);
-    UnloadImage(one_by_one_image);
+void trace_start(void) {
+    Trace *trace = &g->trace;
+    if (trace->events == NULL) trace->events = calloc(TRACE_CAPACITY, sizeof(Trace_Event));
+    trace->first = atomic_load(&trace->next);
+    atomic_store(&trace->recording, true);
+    nob_log(INFO, "Started recording a trace");
+}
 
-    g->hue_picker_shader = LoadShaderFromMemory(NULL,
-GLSL_BOILERPLATE
-GLSL_RGB_TO_HSV
-"in vec2 fragTexCoord;\n"
-"in vec4 fragColor;\n"
+bool trace_stop_and_dump(const char *path) {
+    Trace *trace = &g->trace;
+    atomic_store(&trace->recording, false);
+
+    // Other threads may still be adding events that they started before recording stopped, or even wrap around and
+    // overwrite the oldest ones. Whatever isn't complete and unchanged while it gets copied is left out
+    size_t total = atomic_load(&trace->next);
+    size_t count = total - trace->first < TRACE_CAPACITY ? total - trace->first : TRACE_CAPACITY;
+    size_t written = 0, skipped = 0;
+    String_Builder json = {0};
+    sb_append_cstr(&json, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+    for (size_t index = total - count; index < total; index++) {
+        Trace_Event *slot = &trace->events[index % TRACE_CAPACITY];
+        if (atomic_load_explicit(&slot->sequence, memory_order_acquire) != index + 1) {
+            skipped++;
+            continue;
+        }
+        const char *name = slot->name;
+        double start = slot->start, duration = slot->duration;
+        int thread = slot->thread;
+        atomic_thread_fence(memory_order_acquire);
+        if (atomic_load_explicit(&slot->sequence, memory_order_relaxed) != index + 1) {
+            skipped++;
+            continue;
+        }
 
-"void main() {\n"
-"    float hue = fragTexCoord.x;\n"
-"    vec3 rgb = hsv2rgb(vec3(hue, 1.0, 1.0));\n"
-"    finalColor = vec4(rgb, 1.0);\n"
-"}\n"
-"\n");
-    g->color_picker_shader = LoadShaderFromMemory(NULL,
-GLSL_BOILERPLATE
-GLSL_RGB_TO_HSV
-"in vec2 fragTexCoord;\n"
-"in vec4 fragColor;\n"
+        if (written > 0) sb_append_cstr(&json, ",\n");
+        sb_appendf(&json, "{\"name\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%d,\"ts\":%.3f,\"dur\":%.3f}",
+                   name, thread, start * 1e6, duration * 1e6);
+        written++;
+    }
+    sb_append_cstr(&json, "\n]}\n");
 
-"uniform float hue;\n"
+    bool ok = write_entire_file(path, json.items, json.count);
+    if (ok) nob_log(INFO, "Saved trace with %zu events to %s (%zu still being written were left out)", written, path, skipped);
+    da_free(json);
+    return ok;
+}
 
-"void main() {\n"
-"    vec3 rgb = hsv2rgb(vec3(hue, fragTexCoord.x, 1.0-fragTexCoord.y));\n"
-"    finalColor = vec4(rgb, 1.0);\n"
-"}\n"
-"\n");
+#if defined(__linux__) && !defined(PLATFORM_WEB)
+// raylib links GLFW in but doesn't ship its header
+extern Cursor_Pos_Callback glfwSetCursorPosCallback(void *window, Cursor_Pos_Callback callback) __attribute__((weak));
+extern double glfwGetTime(void) __attribute__((weak));
 
-    g->canvas_bounds = (Rectangle) {0, 0, 1920, 1080};
-    g->hovered_object = -1;
+static void queueing_cursor_pos_callback(void *window, double x, double y) {
+    Input *input = &g->input;
+    if (input->mode != INPUT_REPLAYING) {
+        da_append(&input->pointer_queue, ((Pointer_Sample) { { x, y }, glfwGetTime() }));
+    }
+    if (input->chained_cursor_pos_callback != NULL) input->chained_cursor_pos_callback(window, x, y);
 }
 
-App *app_pre_reload(void) {
-    return g;
+// Has to be done again after a hot reload, as the callback moves with the code
+void input_install_pointer_hook(Input *input) {
+    if (&glfwSetCursorPosCallback == NULL || &glfwGetTime == NULL) return;
+    Cursor_Pos_Callback previous = glfwSetCursorPosCallback(GetWindowHandle(), queueing_cursor_pos_callback);
+    // After a hot reload that's the hook of the old code, and raylib's is already known
+    if (input->chained_cursor_pos_callback == NULL) input->chained_cursor_pos_callback = previous;
+}
+#else
+// Without the hook every frame has no motion samples, and the mouse position of the frame is all there is
+void input_install_pointer_hook(Input *input) {
+    UNUSED(input);
+}
+#endif // defined(__linux__) && !defined(PLATFORM_WEB)
+
+void input_poll_live(Input_Frame *frame) {
+    frame->screen_width = GetScreenWidth();
+    frame->screen_height = GetScreenHeight();
+    frame->mouse = GetMousePosition();
+    frame->wheel = GetMouseWheelMoveV();
+    for (int button = 0; button < INPUT_MOUSE_BUTTON_COUNT; button++) {
+        frame->buttons[button] = IsMouseButtonDown(button);
+    }
+    for (int key = 0; key < INPUT_KEY_COUNT; key++) {
+        frame->keys[key] = IsKeyDown(key);
+        frame->keys_repeated[key] = IsKeyPressedRepeat(key);
+    }
+    int codepoint;
+    // Checking for room first, as a char taken off raylib's queue with nowhere to go would be lost
+    while (frame->chars_count < INPUT_MAX_CHARS && (codepoint = GetCharPressed()) > 0) {
+        frame->chars[frame->chars_count++] = codepoint;
+    }
+    if (IsFileDropped()) {
+        FilePathList files = LoadDroppedFiles();
+        for (size_t i = 0; i < files.count; i++) {
+            da_append(&frame->dropped_files, strdup(files.paths[i]));
+        }
+        UnloadDroppedFiles(files);
+    }
+    frame->frame_time = GetFrameTime();
 }
 
-void app_post_reload(App *new_g) {
-    g = new_g;
-
-    if (g->size < sizeof(*g)) {
-        nob_log(INFO, "Migrating struct App (%zu bytes -> %zu bytes)", g->size, sizeof(*g));
-        g = realloc(g, sizeof(*g));
-        memset((char*)g + g->size, 0, sizeof(*g) - g->size);
-        g->size = sizeof(*g);
+void input_record_frame(Input *input, const Input_Frame *before, const Input_Frame *after) {
+    String_Builder events = {0};
+    if (after->screen_width != before->screen_width || after->screen_height != before->screen_height) {
+        sb_appendf(&events, "size %d %d\n", after->screen_width, after->screen_height);
+    }
+    if (after->mouse.x != before->mouse.x || after->mouse.y != before->mouse.y) {
+        sb_appendf(&events, "mouse %.9g %.9g\n", after->mouse.x, after->mouse.y);
+    }
+    if (after->wheel.x != 0 || after->wheel.y != 0) {
+        sb_appendf(&events, "wheel %.9g %.9g\n", after->wheel.x, after->wheel.y);
+    }
+    da_foreach(Pointer_Sample, sample, &input->pointer_samples) {
+        sb_appendf(&events, "motion %.9g %.9g %.6f\n", sample->pos.x, sample->pos.y, sample->time);
+    }
+    for (int button = 0; button < INPUT_MOUSE_BUTTON_COUNT; button++) {
+        if (after->buttons[button] != before->buttons[button]) {
+            sb_appendf(&events, "%s %d\n", after->buttons[button] ? "button_down" : "button_up", button);
+        }
+    }
+    for (int key = 0; key < INPUT_KEY_COUNT; key++) {
+        if (after->keys[key] != before->keys[key]) {
+            sb_appendf(&events, "%s %d\n", after->keys[key] ? "key_down" : "key_up", key);
+        }
+        if (after->keys_repeated[key]) sb_appendf(&events, "key_repeat %d\n", key);
+    }
+    for (size_t i = 0; i < after->chars_count; i++) {
+        sb_appendf(&events, "char %d\n", after->chars[i]);
+    }
+    da_foreach(char *, path, &after->dropped_files) {
+        sb_appendf(&events, "drop %s\n", *path);
     }
 
-    // The addresses of the functions may shift after hot-reloading so
-    // we must set them again
-    // Clay also uses internally a Clay__currentContext global variable, whose address
-    // (and value) also shifts after the reload. Hence keeping track of it ourselves
-    Clay_SetCurrentContext(g->clay);
-    Clay_SetMeasureTextFunction(Raylib_MeasureText, &g->font);
-    g->clay->errorHandler = (Clay_ErrorHandler) { handle_clay_error, 0 };
+    if (events.count > 0) {
+        sb_appendf(&input->recording, "frame %zu\n", input->frame);
+        sb_append_buf(&input->recording, events.items, events.count);
+    }
+    da_free(events);
 }
 
-typedef struct {
-    bool pressed : 1;
-    bool hovered : 1;
-} Button_State;
+void input_replay_frame(Input *input, Input_Frame *frame) {
+    while (input->replay_rest.count > 0) {
+        String_View rest = input->replay_rest;
+        String_View line = sv_chop_by_delim(&rest, '\n');
+        String_View event = sv_chop_by_delim(&line, ' ');
+        // Only the path of a dropped file may contain spaces, and it's the whole rest of the line
+        String_View arg0 = line;
+        String_View arg1 = sv_from_parts(NULL, 0);
+        String_View arg2 = sv_from_parts(NULL, 0);
+        if (!sv_eq(event, sv_from_cstr("drop"))) {
+            arg0 = sv_chop_by_delim(&line, ' ');
+            arg1 = sv_chop_by_delim(&line, ' ');
+            arg2 = sv_chop_by_delim(&line, ' ');
+        }
+        const char *a0 = temp_sv_to_cstr(arg0);
+        const char *a1 = temp_sv_to_cstr(arg1);
+        const char *a2 = temp_sv_to_cstr(arg2);
+
+        if (sv_eq(event, sv_from_cstr("frame"))) {
+            if (strtoull(a0, NULL, 10) > input->frame) break;
+        } else if (sv_eq(event, sv_from_cstr("end"))) {
+            input->replay_end_frame = strtoull(a0, NULL, 10);
+        } else if (sv_eq(event, sv_from_cstr("size"))) {
+            frame->screen_width = atoi(a0);
+            frame->screen_height = atoi(a1);
+            SetWindowSize(frame->screen_width, frame->screen_height);
+        } else if (sv_eq(event, sv_from_cstr("mouse"))) {
+            frame->mouse = (Vector2) { strtof(a0, NULL), strtof(a1, NULL) };
+        } else if (sv_eq(event, sv_from_cstr("motion"))) {
+            Pointer_Sample sample = { { strtof(a0, NULL), strtof(a1, NULL) }, strtod(a2, NULL) };
+            da_append(&input->pointer_samples, sample);
+        } else if (sv_eq(event, sv_from_cstr("wheel"))) {
+            frame->wheel = (Vector2) { strtof(a0, NULL), strtof(a1, NULL) };
+        } else if (sv_eq(event, sv_from_cstr("button_down")) || sv_eq(event, sv_from_cstr("button_up"))) {
+            int button = atoi(a0);
+            if (button >= 0 && button < INPUT_MOUSE_BUTTON_COUNT) frame->buttons[button] = sv_eq(event, sv_from_cstr("button_down"));
+        } else if (sv_eq(event, sv_from_cstr("key_down")) || sv_eq(event, sv_from_cstr("key_up"))) {
+            int key = atoi(a0);
+            if (key >= 0 && key < INPUT_KEY_COUNT) frame->keys[key] = sv_eq(event, sv_from_cstr("key_down"));
+        } else if (sv_eq(event, sv_from_cstr("key_repeat"))) {
+            int key = atoi(a0);
+            if (key >= 0 && key < INPUT_KEY_COUNT) frame->keys_repeated[key] = true;
+        } else if (sv_eq(event, sv_from_cstr("char"))) {
+            if (frame->chars_count < INPUT_MAX_CHARS) frame->chars[frame->chars_count++] = atoi(a0);
+        } else if (sv_eq(event, sv_from_cstr("drop"))) {
+            da_append(&frame->dropped_files, strdup(a0));
+        } else if (event.count > 0) {
+            nob_log(WARNING, "Unknown event in recording %s: "SV_Fmt, input->replay_path, SV_Arg(event));
+        }
+        input->replay_rest = rest;
+    }
+    frame->frame_time = INPUT_REPLAY_FRAME_TIME;
+}
 
-Button_State button(Clay_ElementId id, Clay_String text) {
-    Button_State state;
-    CLAY({
-        .id = id,
-        .layout.padding = { .left = 5, .right = 5 },
-        .backgroundColor = (state.hovered = Clay_Hovered()) ? (Clay_Color) { 150, 150, 150, 255 } : (Clay_Color){ 100, 100, 100, 255 },
-        .cornerRadius = CLAY_CORNER_RADIUS(5),
-    }) {
-        state.pressed = state.hovered && IsMouseButtonPressed(MOUSE_BUTTON_LEFT);
-        uint16_t font_size = 30;
-        Clay_TextElementConfig *config = CLAY_TEXT_CONFIG({
-            .fontSize = font_size,
-            .textColor = {255, 255, 255, 255},
-        });
-        CLAY_TEXT(text, config);
+// GLFW only calls the hook from glfwPollEvents(), once a frame, so all samples of a frame come with about the time of
+// that. Spreads them evenly over the frame instead, ending with the last one, which is as close as it gets to when the
+// pointer actually was there. Otherwise smoothing sees no time pass between them and pulls them all onto one point
+void pointer_samples_spread(Pointer_Samples *samples, double frame_time) {
+    if (samples->count == 0) return;
+    double end = da_last(samples).time;
+    for (size_t i = 0; i < samples->count; i++) {
+        samples->items[i].time = end - frame_time * (samples->count - 1 - i) / samples->count;
     }
-    return state;
 }
 
-Button_State tool_button(Clay_ElementId id, Clay_String text, Tool tool) {
-    Button_State state;
-    CLAY({
-        .id = id,
-        .layout.padding = { .left = 5, .right = 5 },
-        .backgroundColor = (state.hovered = Clay_Hovered()) || g->tool == tool ? (Clay_Color) { 150, 150, 150, 255 } : (Clay_Color){ 100, 100, 100, 255 },
-        .cornerRadius = CLAY_CORNER_RADIUS(5),
-    }) {
-        state.pressed = state.hovered && IsMouseButtonPressed(MOUSE_BUTTON_LEFT);
-        uint16_t font_size = 30;
-        Clay_TextElementConfig *config = CLAY_TEXT_CONFIG({
-            .fontSize = font_size,
-            .textColor = {255, 255, 255, 255},
-        });
-        CLAY_TEXT(text, config);
+void input_begin_frame(Input *input) {
+    da_foreach(char *, path, &input->prev.dropped_files) free(*path);
+    da_free(input->prev.dropped_files);
+    input->prev = input->curr;
+
+    // Persistent state carries over, per-frame events don't
+    Input_Frame *curr = &input->curr;
+    curr->wheel = Vector2Zero();
+    memset(curr->keys_repeated, 0, sizeof(curr->keys_repeated));
+    curr->chars_count = 0;
+    curr->dropped_files = (Dropped_Files) {0};
+    input->chars_read = 0;
+    input->pointer_samples.count = 0;
+
+    if (input->mode == INPUT_REPLAYING) {
+        input->frame_start = GetTime();
+        input_replay_frame(input, curr);
+        // Whatever the user does with the real mouse and keyboard gets thrown away
+        int codepoint;
+        while ((codepoint = GetCharPressed()) > 0) {}
+        if (IsFileDropped()) UnloadDroppedFiles(LoadDroppedFiles());
+        input->pointer_queue.count = 0;
+    } else {
+        input_poll_live(curr);
+        // The queue becomes the samples of this frame and keeps filling the buffer of the last one
+        Pointer_Samples samples = input->pointer_samples;
+        input->pointer_samples = input->pointer_queue;
+        input->pointer_queue = samples;
+        pointer_samples_spread(&input->pointer_samples, curr->frame_time);
+    }
+
+    if (input->mode == INPUT_RECORDING) {
+        static const Input_Frame nothing = {0};
+        input_record_frame(input, input->record_full_state ? &nothing : &input->prev, curr);
+        input->record_full_state = false;
     }
-    if (state.pressed) g->tool = tool;
-    return state;
 }
 
-Rectangle get_current_rect(void) {
-    Vector2 start = g->rect_start;
-    Vector2 end = GetScreenToWorld2D(GetMousePosition(), g->camera);
+int compare_floats(const void *a, const void *b);
+
+void input_end_frame(Input *input) {
+    if (input->mode == INPUT_RECORDING || input->mode == INPUT_REPLAYING) input->frame++;
+    if (input->mode != INPUT_REPLAYING) return;
+
+    da_append(&input->replay_cpu_ms, (GetTime() - input->frame_start) * 1000.0f);
+    if (input->replay_rest.count > 0 || input->frame < input->replay_end_frame) return;
+
+    Frame_Times *times = &input->replay_cpu_ms;
+    String_Builder csv = {0};
+    sb_append_cstr(&csv, "frame,cpu_ms\n");
+    for (size_t i = 0; i < times->count; i++) sb_appendf(&csv, "%zu,%.4f\n", i, times->items[i]);
+    const char *csv_path = temp_sprintf("%s.timings.csv", input->replay_path);
+    if (!write_entire_file(csv_path, csv.items, csv.count)) nob_log(ERROR, "Could not save frame timings to %s", csv_path);
+    da_free(csv);
+
+    qsort(times->items, times->count, sizeof(float), compare_floats);
+    if (times->count > 0) {
+        double total = 0;
+        da_foreach(float, ms, times) total += *ms;
+        nob_log(INFO, "Replayed %zu frames of %s: mean %.3f ms, p50 %.3f ms, p99 %.3f ms, max %.3f ms (per frame timings in %s)",
+                times->count, input->replay_path, total / times->count,
+                times->items[times->count * 50 / 100], times->items[times->count * 99 / 100], times->items[times->count - 1],
+                csv_path);
+    }
 
-    Vector2 corner1 = Vector2Min(start, end);
-    Vector2 corner2 = Vector2Max(start, end);
-    Vector2 size = Vector2Subtract(corner2, corner1);
-    return (Rectangle) { corner1.x, corner1.y, size.x, size.y };
+    input->mode = INPUT_LIVE;
+    input->replay_finished = true;
 }
 
-void set_cursor(MouseCursor mouse_cursor) {
-    if (mouse_cursor != g->prev_mouse_cursor) {
-        SetMouseCursor(mouse_cursor);
-        g->prev_mouse_cursor = mouse_cursor;
+// Whether anything came in this frame that the UI could react to
+bool input_changed(const Input *input) {
+    const Input_Frame *curr = &input->curr;
+    const Input_Frame *prev = &input->prev;
+    if (curr->screen_width != prev->screen_width || curr->screen_height != prev->screen_height) return true;
+    if (curr->mouse.x != prev->mouse.x || curr->mouse.y != prev->mouse.y) return true;
+    if (curr->wheel.x != 0 || curr->wheel.y != 0) return true;
+    if (memcmp(curr->buttons, prev->buttons, sizeof(curr->buttons)) != 0) return true;
+    if (memcmp(curr->keys, prev->keys, sizeof(curr->keys)) != 0) return true;
+    for (int key = 0; key < INPUT_KEY_COUNT; key++) {
+        if (curr->keys_repeated[key]) return true;
     }
+    return curr->chars_count > 0 || curr->dropped_files.count > 0;
 }
 
-void update_main_area(void) {
-    g->camera.offset = (Vector2) { (float)GetScreenWidth() / 2, (float)GetScreenHeight() / 2 };
+void input_start_recording(Input *input) {
+    input->mode = INPUT_RECORDING;
+    input->frame = 0;
+    input->recording.count = 0;
+    sb_append_cstr(&input->recording, "simp-recording 1\n");
+    input->record_full_state = true;
+    nob_log(INFO, "Started recording input");
+}
 
-    float wheel = GetMouseWheelMove();
-#ifdef PLATFORM_WEB
-    wheel /= -240;
-#endif // PLATFORM_WEB
-    g->camera.zoom *= wheel / 20.0f + 1;
+bool input_stop_recording(Input *input, const char *path) {
+    input->mode = INPUT_LIVE;
+    sb_appendf(&input->recording, "end %zu\n", input->frame);
+    bool ok = write_entire_file(path, input->recording.items, input->recording.count);
+    if (ok) nob_log(INFO, "Saved %zu frames of input to %s", input->frame, path);
+    return ok;
+}
 
-    Vector2 mouse_delta = Vector2Scale(GetMouseDelta(), 1/g->camera.zoom);
-    if (IsMouseButtonDown(MOUSE_BUTTON_PAN)) {
-        g->camera.target = Vector2Subtract(g->camera.target, mouse_delta);
+bool input_start_replay(Input *input, const char *path) {
+    input->replay.count = 0;
+    if (!read_entire_file(path, &input->replay)) return false;
+    input->replay_rest = sb_to_sv(input->replay);
+    String_View header = sv_chop_by_delim(&input->replay_rest, '\n');
+    if (!sv_eq(header, sv_from_cstr("simp-recording 1"))) {
+        nob_log(ERROR, "%s is not a SIMP input recording", path);
+        return false;
     }
+    input->replay_path = path;
+    input->mode = INPUT_REPLAYING;
+    input->frame = 0;
+    input->replay_end_frame = 0;
+    input->replay_cpu_ms.count = 0;
+    // Start from a clean slate, as the recording did
+    memset(&input->curr, 0, sizeof(input->curr));
+    nob_log(INFO, "Replaying input from %s", path);
+    return true;
+}
 
-    float object_resize_hitbox_size = OBJECT_RESIZE_HITBOX_SIZE / g->camera.zoom;
-    bool is_move_down = IsMouseButtonDown(MOUSE_BUTTON_TOOL);
-    Vector2 mouse_pos = GetScreenToWorld2D(GetMousePosition(), g->camera);
-    int mouse_cursor = MOUSE_CURSOR_DEFAULT;
-    static_assert(COUNT_TOOLS == 5, "Exhaustive handling of tools in update_main_area");
-    switch (g->tool) {
-        case TOOL_MOVE: if (g->objects.count > 0) {
-            for (Object *object = g->objects.items + g->objects.count - 1; object >= g->objects.items; object--) {
-                Rectangle bounding_box = object_get_bounding_box(object);
-                Rectangle top_resize_hitbox = {
-                    bounding_box.x, bounding_box.y - object_resize_hitbox_size / 2.0f,
-                    bounding_box.width, object_resize_hitbox_size,
-                };
-                Rectangle bottom_resize_hitbox = {
-                    bounding_box.x, bounding_box.y + bounding_box.height - object_resize_hitbox_size / 2.0f,
-                    bounding_box.width, object_resize_hitbox_size,
-                };
-                Rectangle left_resize_hitbox = {
-                    bounding_box.x - object_resize_hitbox_size / 2.0f, bounding_box.y,
-                    object_resize_hitbox_size, bounding_box.height,
-                };
-                Rectangle right_resize_hitbox = {
-                    bounding_box.x + bounding_box.width - object_resize_hitbox_size / 2.0f, bounding_box.y,
-                    object_resize_hitbox_size, bounding_box.height,
-                };
+Vector2 input_mouse_position(void) { return g->input.curr.mouse; }
+int input_mouse_x(void) { return g->input.curr.mouse.x; }
+int input_mouse_y(void) { return g->input.curr.mouse.y; }
+Vector2 input_mouse_delta(void) { return Vector2Subtract(g->input.curr.mouse, g->input.prev.mouse); }
+Vector2 input_mouse_wheel_v(void) { return g->input.curr.wheel; }
+// Every position the mouse went through since the last frame, in screen coordinates
+const Pointer_Samples *input_pointer_samples(void) { return &g->input.pointer_samples; }
+// Same as GetMouseWheelMove(): whichever axis moved the most
+float input_mouse_wheel(void) {
+    Vector2 wheel = g->input.curr.wheel;
+    return fabsf(wheel.x) > fabsf(wheel.y) ? wheel.x : wheel.y;
+}
+bool input_is_mouse_button_down(int button) { return g->input.curr.buttons[button]; }
+bool input_is_mouse_button_pressed(int button) { return g->input.curr.buttons[button] && !g->input.prev.buttons[button]; }
+bool input_is_mouse_button_released(int button) { return !g->input.curr.buttons[button] && g->input.prev.buttons[button]; }
+bool input_is_key_down(int key) { return g->input.curr.keys[key]; }
+bool input_is_key_pressed(int key) { return g->input.curr.keys[key] && !g->input.prev.keys[key]; }
+bool input_is_key_pressed_repeat(int key) { return g->input.curr.keys_repeated[key]; }
+// Same as GetCharPressed(): returns 0 once all the characters typed this frame have been consumed
+int input_char_pressed(void) {
+    Input *input = &g->input;
+    return input->chars_read < input->curr.chars_count ? input->curr.chars[input->chars_read++] : 0;
+}
+const Dropped_Files *input_dropped_files(void) { return &g->input.curr.dropped_files; }
+int input_screen_width(void) { return g->input.curr.screen_width; }
+int input_screen_height(void) { return g->input.curr.screen_height; }
+float input_frame_time(void) { return g->input.curr.frame_time; }
 
-                if (CheckCollisionPointRec(mouse_pos, top_resize_hitbox) && CheckCollisionPointRec(mouse_pos, left_resize_hitbox)) {
-                    mouse_cursor = MOUSE_CURSOR_CROSSHAIR;
+#ifndef PLATFORM_WEB
+const char *image_filter_patterns[] = { "*.png", "*.jpg", "*.tga", "*.bmp", "*.psd", "*.gif", "*.hdr", "*.pic", "*.ppm" };
+const char *export_filter_patterns[] = {"*.png", "*.bmp", "*.tga", "*.jpg", "*.hdr"};
+
+// The dialog thread runs code of libapp.so, so it's joined rather than detached, and app_can_reload() holds hot reloads
+// off until file_dialog_poll() has joined it. Hence the handle can stay in the library instead of the App
+static pthread_t file_dialog_thread_handle;
+
+void *file_dialog_thread(void *arg) {
+    File_Dialog *dialog = arg;
+    trace_thread_id = TRACE_THREAD_FILE_DIALOG;
+    const char *path = NULL;
+    static_assert(COUNT_FILE_DIALOGS == 4, "Exhaustive handling of file dialogs in file_dialog_thread");
+    TraceZone("File dialog") switch (dialog->result.kind) {
+        case FILE_DIALOG_OPEN_IMAGE:
+        case FILE_DIALOG_ADD_IMAGE:
+            path = tinyfd_openFileDialog("Add Image", NULL, ARRAY_LEN(image_filter_patterns), image_filter_patterns, "Image", 0);
+            break;
+        case FILE_DIALOG_EXPORT_IMAGE:
+            path = tinyfd_saveFileDialog("Export Image", NULL, ARRAY_LEN(export_filter_patterns), export_filter_patterns, "Image file");
+            break;
+        case FILE_DIALOG_EXPORT_ERROR: {
+            // The temporary allocator belongs to the frame loop
+            char message[1024];
+            snprintf(message, sizeof(message), "Could not export image to %s", dialog->result.path);
+            free(dialog->result.path);
+            tinyfd_messageBox("Error exporting image", message, "ok", "error", 1);
+        } break;
+        case COUNT_FILE_DIALOGS:
+        default: UNREACHABLE("invalid file dialog");
+    }
+    dialog->result.path = path != NULL ? strdup(path) : NULL;
+    atomic_store_explicit(&dialog->done, true, memory_order_release);
+    return NULL;
+}
 
-                    if (is_move_down) {
-                        bounding_box.y += mouse_delta.y;
-                        bounding_box.height -= mouse_delta.y;
-                        bounding_box.x += mouse_delta.x;
-                        bounding_box.width -= mouse_delta.x;
-                    }
-                } else if (CheckCollisionPointRec(mouse_pos, top_resize_hitbox) && CheckCollisionPointRec(mouse_pos, right_resize_hitbox)) {
-                    mouse_cursor = MOUSE_CURSOR_CROSSHAIR;
+// `path` is handed over to the dialog thread, which frees it
+bool file_dialog_start(File_Dialog *dialog, File_Dialog_Kind kind, char *path) {
+    if (dialog->open) {
+        nob_log(WARNING, "A file dialog is already open");
+        free(path);
+        return false;
+    }
+    dialog->result = (File_Dialog_Result) { .kind = kind, .path = path };
+    atomic_store(&dialog->done, false);
 
-                    if (is_move_down) {
-                        bounding_box.y += mouse_delta.y;
-                        bounding_box.height -= mouse_delta.y;
-                        bounding_box.width += mouse_delta.x;
-                    }
-                } else if (CheckCollisionPointRec(mouse_pos, bottom_resize_hitbox) && CheckCollisionPointRec(mouse_pos, left_resize_hitbox)) {
-                    mouse_cursor = MOUSE_CURSOR_CROSSHAIR;
+    if (pthread_create(&file_dialog_thread_handle, NULL, file_dialog_thread, dialog) != 0) {
+        nob_log(ERROR, "Could not start a thread for the file dialog");
+        free(path);
+        return false;
+    }
+    dialog->open = true;
+    return true;
+}
 
-                    if (is_move_down) {
-                        bounding_box.height += mouse_delta.y;
-                        bounding_box.x += mouse_delta.x;
-                        bounding_box.width -= mouse_delta.x;
+bool file_dialog_open(File_Dialog *dialog, File_Dialog_Kind kind) {
+    return file_dialog_start(dialog, kind, NULL);
+}
+
+bool file_dialog_show_export_error(File_Dialog *dialog, const char *path) {
+    return file_dialog_start(dialog, FILE_DIALOG_EXPORT_ERROR, strdup(path));
+}
+
+// Returns true once the user is done with the dialog, along with what they chose
+bool file_dialog_poll(File_Dialog *dialog, File_Dialog_Result *result) {
+    if (!dialog->open || !atomic_load_explicit(&dialog->done, memory_order_acquire)) return false;
+    // Only the return of the thread function is left, so this doesn't block
+    pthread_join(file_dialog_thread_handle, NULL);
+    *result = dialog->result;
+    dialog->open = false;
+    return true;
+}
+#endif // PLATFORM_WEB
+
+// raylib doesn't report draw calls or expose timer queries, but on desktop it loads GL through glad, whose function
+// pointers we can wrap to count what actually reaches the driver. They are public symbols of both libraylib.a and
+// libraylib.so, so on Linux weak references find them either way and stay NULL if a raylib without glad ever shows up.
+// With libraylib.so they outlive libapp.so, which is why app_pre_reload() takes the hooks out and app_post_reload() puts
+// the ones of the new code in. The web build has no glad (GL calls go straight to WebGL), and PE/COFF has no weak undefined symbols to rely on, so
+// on web and Windows the hooks are compiled out and the overlay shows n/a
+#if defined(__linux__) && !defined(PLATFORM_WEB)
+#define GL_TIME_ELAPSED 0x88BF
+#define GL_QUERY_RESULT 0x8866
+#define GL_QUERY_RESULT_AVAILABLE 0x8867
+
+typedef void (*gl_draw_arrays_t)(unsigned int mode, int first, int count);
+typedef void (*gl_draw_arrays_instanced_t)(unsigned int mode, int first, int count, int instances);
+typedef void (*gl_draw_elements_t)(unsigned int mode, int count, unsigned int type, const void *indices);
+typedef void (*gl_bind_texture_t)(unsigned int target, unsigned int texture);
+typedef void (*gl_gen_queries_t)(int n, unsigned int *ids);
+typedef void (*gl_begin_query_t)(unsigned int target, unsigned int id);
+typedef void (*gl_end_query_t)(unsigned int target);
+typedef void (*gl_get_query_objectiv_t)(unsigned int id, unsigned int pname, int *params);
+typedef void (*gl_get_query_objectui64v_t)(unsigned int id, unsigned int pname, uint64_t *params);
+
+extern gl_draw_arrays_t glad_glDrawArrays __attribute__((weak));
+extern gl_draw_arrays_instanced_t glad_glDrawArraysInstanced __attribute__((weak));
+extern gl_draw_elements_t glad_glDrawElements __attribute__((weak));
+extern gl_bind_texture_t glad_glBindTexture __attribute__((weak));
+extern gl_gen_queries_t glad_glGenQueries __attribute__((weak));
+extern gl_begin_query_t glad_glBeginQuery __attribute__((weak));
+extern gl_end_query_t glad_glEndQuery __attribute__((weak));
+extern gl_get_query_objectiv_t glad_glGetQueryObjectiv __attribute__((weak));
+extern gl_get_query_objectui64v_t glad_glGetQueryObjectui64v __attribute__((weak));
+
+// Counted since the start of the current frame
+static Draw_Stats gl_draw_stats;
+
+static void counting_gl_draw_arrays(unsigned int mode, int first, int count) {
+    gl_draw_stats.draw_calls++;
+    gl_draw_stats.vertices += count;
+    g->gl_hooks.draw_arrays(mode, first, count);
+}
+
+static void counting_gl_draw_arrays_instanced(unsigned int mode, int first, int count, int instances) {
+    gl_draw_stats.draw_calls++;
+    gl_draw_stats.vertices += (size_t)count * instances;
+    g->gl_hooks.draw_arrays_instanced(mode, first, count, instances);
+}
+
+static void counting_gl_draw_elements(unsigned int mode, int count, unsigned int type, const void *indices) {
+    gl_draw_stats.draw_calls++;
+    gl_draw_stats.vertices += count;
+    g->gl_hooks.draw_elements(mode, count, type, indices);
+}
+
+static void counting_gl_bind_texture(unsigned int target, unsigned int texture) {
+    gl_draw_stats.texture_binds++;
+    g->gl_hooks.bind_texture(target, texture);
+}
+
+// Has to be done again after a hot reload, as the hooks move with the code. The real functions are only taken from
+// glad the first time, since after that glad points at the hooks
+void profiler_install_gl_hooks(Profiler *profiler) {
+    Gl_Hooks *hooks = &g->gl_hooks;
+    if (&glad_glDrawArrays != NULL && &glad_glDrawArraysInstanced != NULL
+        && &glad_glDrawElements != NULL && &glad_glBindTexture != NULL) {
+        if (!hooks->installed) {
+            hooks->draw_arrays = glad_glDrawArrays;
+            hooks->draw_arrays_instanced = glad_glDrawArraysInstanced;
+            hooks->draw_elements = glad_glDrawElements;
+            hooks->bind_texture = glad_glBindTexture;
+            hooks->installed = true;
+        }
+        glad_glDrawArrays = counting_gl_draw_arrays;
+        glad_glDrawArraysInstanced = counting_gl_draw_arrays_instanced;
+        glad_glDrawElements = counting_gl_draw_elements;
+        glad_glBindTexture = counting_gl_bind_texture;
+    }
+
+    if (!profiler->gpu_queries_loaded && &glad_glGenQueries != NULL && glad_glGenQueries != NULL) {
+        glad_glGenQueries(PROFILER_GPU_QUERIES, profiler->gpu_queries);
+        profiler->gpu_queries_loaded = true;
+    }
+}
+
+// Gives glad the real functions back, for when the code of the hooks is about to go away
+void profiler_remove_gl_hooks(void) {
+    Gl_Hooks *hooks = &g->gl_hooks;
+    if (!hooks->installed) return;
+    glad_glDrawArrays = hooks->draw_arrays;
+    glad_glDrawArraysInstanced = hooks->draw_arrays_instanced;
+    glad_glDrawElements = hooks->draw_elements;
+    glad_glBindTexture = hooks->bind_texture;
+    hooks->installed = false;
+}
+#else
+static Draw_Stats gl_draw_stats;
+
+void profiler_install_gl_hooks(Profiler *profiler) {
+    UNUSED(profiler);
+}
+
+void profiler_remove_gl_hooks(void) {}
+#endif // defined(__linux__) && !defined(PLATFORM_WEB)
+
+#ifdef TRACK_ALLOCATIONS
+struct {
+    atomic_size_t allocations, bytes, frees;
+} alloc_counters;
+
+// The parentheses keep the macros at the top of the file from expanding
+void *tracked_malloc(size_t size) {
+    atomic_fetch_add_explicit(&alloc_counters.allocations, 1, memory_order_relaxed);
+    atomic_fetch_add_explicit(&alloc_counters.bytes, size, memory_order_relaxed);
+    return (malloc)(size);
+}
+
+void *tracked_calloc(size_t count, size_t size) {
+    atomic_fetch_add_explicit(&alloc_counters.allocations, 1, memory_order_relaxed);
+    atomic_fetch_add_explicit(&alloc_counters.bytes, count * size, memory_order_relaxed);
+    return (calloc)(count, size);
+}
+
+void *tracked_realloc(void *ptr, size_t size) {
+    atomic_fetch_add_explicit(&alloc_counters.allocations, 1, memory_order_relaxed);
+    atomic_fetch_add_explicit(&alloc_counters.bytes, size, memory_order_relaxed);
+    return (realloc)(ptr, size);
+}
+
+void tracked_free(void *ptr) {
+    if (ptr != NULL) atomic_fetch_add_explicit(&alloc_counters.frees, 1, memory_order_relaxed);
+    (free)(ptr);
+}
+
+Alloc_Stats alloc_stats_now(void) {
+    return (Alloc_Stats) {
+        .allocations = atomic_load_explicit(&alloc_counters.allocations, memory_order_relaxed),
+        .bytes = atomic_load_explicit(&alloc_counters.bytes, memory_order_relaxed),
+        .frees = atomic_load_explicit(&alloc_counters.frees, memory_order_relaxed),
+    };
+}
+#else
+Alloc_Stats alloc_stats_now(void) {
+    return (Alloc_Stats) {0};
+}
+#endif // TRACK_ALLOCATIONS
+
+Alloc_Stats alloc_stats_since(Alloc_Stats start) {
+    Alloc_Stats now = alloc_stats_now();
+    return (Alloc_Stats) {
+        .allocations = now.allocations - start.allocations,
+        .bytes = now.bytes - start.bytes,
+        .frees = now.frees - start.frees,
+    };
+}
+
+void alloc_stats_add(Alloc_Stats *stats, Alloc_Stats other) {
+    stats->allocations += other.allocations;
+    stats->bytes += other.bytes;
+    stats->frees += other.frees;
+}
+
+void profiler_begin_frame(Profiler *profiler) {
+    profiler->frame_start = GetTime();
+    memset(profiler->phase_time, 0, sizeof(profiler->phase_time));
+    memset(profiler->phase_allocs, 0, sizeof(profiler->phase_allocs));
+    memset(profiler->phase_temp, 0, sizeof(profiler->phase_temp));
+    profiler->frame_start_allocs = alloc_stats_now();
+    profiler->frame_start_temp = temp_save();
+
+    profiler->draw_stats = gl_draw_stats;
+    memset(&gl_draw_stats, 0, sizeof(gl_draw_stats));
+
+    profiler->frame_ms[profiler->frame_ms_next] = GetFrameTime() * 1000.0f;
+    profiler->frame_ms_next = (profiler->frame_ms_next + 1) % PROFILER_HISTORY;
+    if (profiler->frame_ms_count < PROFILER_HISTORY) profiler->frame_ms_count++;
+}
+
+void profiler_begin_phase(Profiler *profiler, Phase phase) {
+    profiler->phase_start[phase] = GetTime();
+    profiler->phase_start_allocs[phase] = alloc_stats_now();
+    profiler->phase_start_temp[phase] = temp_save();
+}
+
+void profiler_end_phase(Profiler *profiler, Phase phase) {
+    double end = GetTime();
+    profiler->phase_time[phase] += end - profiler->phase_start[phase];
+    alloc_stats_add(&profiler->phase_allocs[phase], alloc_stats_since(profiler->phase_start_allocs[phase]));
+    profiler->phase_temp[phase] += temp_save() - profiler->phase_start_temp[phase];
+    trace_add(phase_as_cstr(phase), profiler->phase_start[phase], end);
+}
+
+#define Profile(phase) BEGIN_END(profiler_begin_phase(&g->profiler, phase), profiler_end_phase(&g->profiler, phase))
+
+float profiler_smooth(float average, double seconds) {
+    return average * 0.9f + (float)(seconds * 1000.0) * 0.1f;
+}
+
+// Must be called inside BeginDrawing()/EndDrawing(), before anything gets drawn
+void profiler_begin_gpu_frame(Profiler *profiler) {
+#if defined(__linux__) && !defined(PLATFORM_WEB)
+    if (!profiler->gpu_queries_loaded || !profiler->visible) return;
+    // Queries are read back PROFILER_GPU_QUERIES - 1 frames late so we never stall waiting for the GPU
+    if (profiler->gpu_frame >= PROFILER_GPU_QUERIES) {
+        unsigned int query = profiler->gpu_queries[profiler->gpu_frame % PROFILER_GPU_QUERIES];
+        int available = 0;
+        glad_glGetQueryObjectiv(query, GL_QUERY_RESULT_AVAILABLE, &available);
+        if (available) {
+            uint64_t nanoseconds = 0;
+            glad_glGetQueryObjectui64v(query, GL_QUERY_RESULT, &nanoseconds);
+            profiler->gpu_ms = profiler_smooth(profiler->gpu_ms, nanoseconds / 1e9);
+        }
+    }
+    rlDrawRenderBatchActive();
+    glad_glBeginQuery(GL_TIME_ELAPSED, profiler->gpu_queries[profiler->gpu_frame % PROFILER_GPU_QUERIES]);
+#else
+    UNUSED(profiler);
+#endif // defined(__linux__) && !defined(PLATFORM_WEB)
+}
+
+// Must be called right before EndDrawing()
+void profiler_end_gpu_frame(Profiler *profiler) {
+#if defined(__linux__) && !defined(PLATFORM_WEB)
+    if (!profiler->gpu_queries_loaded || !profiler->visible) return;
+    rlDrawRenderBatchActive();
+    glad_glEndQuery(GL_TIME_ELAPSED);
+    profiler->gpu_frame++;
+#else
+    UNUSED(profiler);
+#endif // defined(__linux__) && !defined(PLATFORM_WEB)
+}
+
+void profiler_end_frame(Profiler *profiler) {
+    for (Phase phase = 0; phase < COUNT_PHASES; phase++) {
+        profiler->phase_ms[phase] = profiler_smooth(profiler->phase_ms[phase], profiler->phase_time[phase]);
+    }
+    double end = GetTime();
+    profiler->cpu_ms = profiler_smooth(profiler->cpu_ms, end - profiler->frame_start);
+    trace_add("app_update()", profiler->frame_start, end);
+
+    profiler->last_frame_allocs = alloc_stats_since(profiler->frame_start_allocs);
+    // The temp arena only gets rewound at the very end of app_update(), so right now it's at its peak
+    profiler->last_frame_temp_peak = temp_save() - profiler->frame_start_temp;
+    memcpy(profiler->last_phase_allocs, profiler->phase_allocs, sizeof(profiler->phase_allocs));
+    memcpy(profiler->last_phase_temp, profiler->phase_temp, sizeof(profiler->phase_temp));
+}
+
+int compare_floats(const void *a, const void *b) {
+    float x = *(const float*)a;
+    float y = *(const float*)b;
+    return (x > y) - (x < y);
+}
+
+void profiler_draw_overlay(Profiler *profiler, Font font, Vector2 pos) {
+    const float font_size = 20;
+    const float line_height = 22;
+    const float width = 520;
+    const float histogram_height = 80;
+    size_t lines = COUNT_PHASES + 5;
+
+    float sorted[PROFILER_HISTORY];
+    memcpy(sorted, profiler->frame_ms, profiler->frame_ms_count * sizeof(float));
+    qsort(sorted, profiler->frame_ms_count, sizeof(float), compare_floats);
+    float p50 = 0, p99 = 0;
+    if (profiler->frame_ms_count > 0) {
+        p50 = sorted[profiler->frame_ms_count * 50 / 100];
+        p99 = sorted[profiler->frame_ms_count * 99 / 100];
+    }
+
+    Rectangle background = { pos.x, pos.y, width, lines * line_height + histogram_height + 20 };
+    DrawRectangleRec(background, (Color) { 0, 0, 0, 200 });
+
+    Vector2 cursor = { pos.x + 10, pos.y + 5 };
+    #define OVERLAY_LINE(...) do { \
+        DrawTextEx(font, temp_sprintf(__VA_ARGS__), cursor, font_size, 1.0f, WHITE); \
+        cursor.y += line_height; \
+    } while (0)
+
+    OVERLAY_LINE("Frame: p50 %.2f ms, p99 %.2f ms (%d FPS)", p50, p99, GetFPS());
+    if (profiler->gpu_queries_loaded) {
+        OVERLAY_LINE("CPU: %.2f ms, GPU: %.2f ms", profiler->cpu_ms, profiler->gpu_ms);
+    } else {
+        OVERLAY_LINE("CPU: %.2f ms, GPU: n/a", profiler->cpu_ms);
+    }
+#ifdef TRACK_ALLOCATIONS
+    Alloc_Stats allocs = profiler->last_frame_allocs;
+    OVERLAY_LINE("Allocs: %zu (%s), frees: %zu, temp: %s", allocs.allocations, temp_human_readable_size(allocs.bytes),
+                 allocs.frees, temp_human_readable_size(profiler->last_frame_temp_peak));
+    for (Phase phase = 0; phase < COUNT_PHASES; phase++) {
+        OVERLAY_LINE("  %s: %.3f ms, %zu allocs, %s temp", phase_as_cstr(phase), profiler->phase_ms[phase],
+                     profiler->last_phase_allocs[phase].allocations, temp_human_readable_size(profiler->last_phase_temp[phase]));
+    }
+#else
+    OVERLAY_LINE("Allocs: n/a (build with -a), temp: %s", temp_human_readable_size(profiler->last_frame_temp_peak));
+    for (Phase phase = 0; phase < COUNT_PHASES; phase++) {
+        OVERLAY_LINE("  %s: %.3f ms, %s temp", phase_as_cstr(phase), profiler->phase_ms[phase],
+                     temp_human_readable_size(profiler->last_phase_temp[phase]));
+    }
+#endif // TRACK_ALLOCATIONS
+    if (g->gl_hooks.installed) {
+        Draw_Stats stats = profiler->draw_stats;
+        OVERLAY_LINE("Draw calls: %zu, vertices: %zu", stats.draw_calls, stats.vertices);
+        OVERLAY_LINE("Texture binds: %zu", stats.texture_binds);
+    } else {
+        OVERLAY_LINE("Draw calls: n/a");
+        OVERLAY_LINE("Texture binds: n/a");
+    }
+    #undef OVERLAY_LINE
+
+    size_t counts[PROFILER_HISTOGRAM_BINS] = {0};
+    size_t max_count = 1;
+    for (size_t i = 0; i < profiler->frame_ms_count; i++) {
+        int bin = (int)profiler->frame_ms[i];
+        if (bin >= PROFILER_HISTOGRAM_BINS) bin = PROFILER_HISTOGRAM_BINS - 1;
+        counts[bin]++;
+        if (counts[bin] > max_count) max_count = counts[bin];
+    }
+    float bin_width = (width - 20) / PROFILER_HISTOGRAM_BINS;
+    float base_y = cursor.y + 10 + histogram_height;
+    for (int bin = 0; bin < PROFILER_HISTOGRAM_BINS; bin++) {
+        float height = histogram_height * counts[bin] / max_count;
+        Color color = bin < 17 ? GREEN : bin < 34 ? YELLOW : RED;
+        DrawRectangleRec((Rectangle) { cursor.x + bin * bin_width, base_y - height, bin_width - 1, height }, color);
+    }
+    DrawRectangleRec((Rectangle) { cursor.x, base_y, width - 20, 1 }, WHITE);
+}
+
+#ifdef PLATFORM_WEB
+#define GLSL_TEXTURE_BOILERPLATE \
+    GLSL_BOILERPLATE \
+    "#define texture texture2D\n"
+#define GLSL_SDF_BOILERPLATE \
+    "#extension GL_OES_standard_derivatives : enable\n" \
+    GLSL_TEXTURE_BOILERPLATE
+#else
+#define GLSL_TEXTURE_BOILERPLATE GLSL_BOILERPLATE
+#define GLSL_SDF_BOILERPLATE GLSL_BOILERPLATE
+#endif // PLATFORM_WEB
+
+void load_sdf_shader(void) {
+    // https://github.com/raysan5/raylib/blob/master/examples/text/resources/shaders/glsl330/sdf.fs
+    g->sdf_shader = LoadShaderFromMemory(NULL,
+GLSL_SDF_BOILERPLATE
+"in vec2 fragTexCoord;\n"
+"in vec4 fragColor;\n"
+"uniform sampler2D texture0;\n"
+
+"void main() {\n"
+"    float distance = texture(texture0, fragTexCoord).a - 0.5;\n"
+"    float distance_per_fragment = length(vec2(dFdx(distance), dFdy(distance)));\n"
+"    float alpha = smoothstep(-distance_per_fragment, distance_per_fragment, distance);\n"
+"    finalColor = vec4(fragColor.rgb, fragColor.a*alpha);\n"
+"}\n");
+}
+
+void load_marching_ants_shader(void) {
+    g->marching_ants_shader = LoadShaderFromMemory(NULL,
+GLSL_BOILERPLATE
+"uniform float offset;\n"
+
+"void main() {\n"
+"    float stripe = mod(floor((gl_FragCoord.x + gl_FragCoord.y)/4.0 + offset), 2.0);\n"
+"    finalColor = vec4(vec3(stripe), 1.0);\n"
+"}\n");
+    g->marching_ants_offset_loc = GetShaderLocation(g->marching_ants_shader, "offset");
+}
+
+#define GLSL_FILTER_BOILERPLATE \
+    GLSL_TEXTURE_BOILERPLATE \
+    GLSL_RGB_TO_HSV \
+    "in vec2 fragTexCoord;\n" \
+    "in vec4 fragColor;\n" \
+    "uniform sampler2D texture0;\n" \
+    "uniform float params[5];\n"
+static_assert(FILTER_MAX_PARAMS == 5, "Please update the size of params[] in GLSL_FILTER_BOILERPLATE");
+
+void load_filter_shaders(void) {
+    Filter_Shaders *shaders = &g->filter_shaders;
+    static_assert(COUNT_FILTERS == 5, "Exhaustive handling of filters in load_filter_shaders");
+    shaders->shaders[FILTER_BRIGHTNESS_CONTRAST] = LoadShaderFromMemory(NULL,
+GLSL_FILTER_BOILERPLATE
+"void main() {\n"
+"    vec4 color = texture(texture0, fragTexCoord);\n"
+"    vec3 rgb = (color.rgb - 0.5)*(1.0 + params[1]) + 0.5 + params[0];\n"
+"    finalColor = vec4(clamp(rgb, 0.0, 1.0), color.a);\n"
+"}\n");
+    shaders->shaders[FILTER_LEVELS] = LoadShaderFromMemory(NULL,
+GLSL_FILTER_BOILERPLATE
+"void main() {\n"
+"    vec4 color = texture(texture0, fragTexCoord);\n"
+"    vec3 rgb = clamp((color.rgb - params[0])/max(params[1] - params[0], 1.0/255.0), 0.0, 1.0);\n"
+"    rgb = pow(rgb, vec3(1.0/max(params[2], 0.01)));\n"
+"    finalColor = vec4(mix(vec3(params[3]), vec3(params[4]), rgb), color.a);\n"
+"}\n");
+    shaders->shaders[FILTER_CURVES] = LoadShaderFromMemory(NULL,
+GLSL_FILTER_BOILERPLATE
+"uniform sampler2D lut;\n"
+"float curve(float x) {\n"
+"    // Sample the centers of the first and last texels at 0 and 1\n"
+"    return texture(lut, vec2(x*(255.0/256.0) + 0.5/256.0, 0.5)).r;\n"
+"}\n"
+"void main() {\n"
+"    vec4 color = texture(texture0, fragTexCoord);\n"
+"    finalColor = vec4(curve(color.r), curve(color.g), curve(color.b), color.a);\n"
+"}\n");
+    static_assert(CURVE_LUT_SIZE == 256, "Please update the curves shader");
+    shaders->shaders[FILTER_HUE_SATURATION] = LoadShaderFromMemory(NULL,
+GLSL_FILTER_BOILERPLATE
+"void main() {\n"
+"    vec4 color = texture(texture0, fragTexCoord);\n"
+"    vec3 hsv = rgb2hsv(color.rgb);\n"
+"    hsv.x = fract(hsv.x + params[0]);\n"
+"    hsv.y = clamp(hsv.y*params[1], 0.0, 1.0);\n"
+"    hsv.z = clamp(hsv.z*params[2], 0.0, 1.0);\n"
+"    finalColor = vec4(hsv2rgb(hsv), color.a);\n"
+"}\n");
+
+    for (Filter_Type type = 0; type < COUNT_FILTERS; type++) {
+        if (type == FILTER_BLUR) continue;
+        shaders->params_locs[type] = GetShaderLocation(shaders->shaders[type], "params");
+    }
+    shaders->lut_loc = GetShaderLocation(shaders->shaders[FILTER_CURVES], "lut");
+    shaders->loaded = true;
+}
+
+// The blur works on premultiplied colors, so that transparent pixels don't bleed their color into their neighbours.
+// The first pass premultiplies and the last one undoes it
+void load_blur_shaders(void) {
+    Blur_Shaders *shaders = &g->blur_shaders;
+    shaders->gaussian = LoadShaderFromMemory(NULL,
+GLSL_TEXTURE_BOILERPLATE
+"in vec2 fragTexCoord;\n"
+"uniform sampler2D texture0;\n"
+"// The texels that may be sampled, so that blurring a slot of the atlas doesn't pull in its neighbours\n"
+"uniform vec4 bounds;\n"
+"// One texel along the axis of the pass\n"
+"uniform vec2 direction;\n"
+"uniform float sigma;\n"
+"uniform float taps;\n"
+"// x: premultiply the input, y: unpremultiply the output\n"
+"uniform vec2 alpha;\n"
+"vec4 tap(vec2 uv) {\n"
+"    vec4 color = texture(texture0, clamp(uv, bounds.xy, bounds.zw));\n"
+"    return alpha.x > 0.5 ? vec4(color.rgb*color.a, color.a) : color;\n"
+"}\n"
+"void main() {\n"
+"    vec4 sum = tap(fragTexCoord);\n"
+"    float total = 1.0;\n"
+"    for (int i = 1; i <= 16; i++) {\n"
+"        float x = float(i);\n"
+"        if (x > taps) break;\n"
+"        float weight = exp(-x*x/(2.0*sigma*sigma));\n"
+"        sum += (tap(fragTexCoord + direction*x) + tap(fragTexCoord - direction*x))*weight;\n"
+"        total += 2.0*weight;\n"
+"    }\n"
+"    sum /= total;\n"
+"    finalColor = alpha.y > 0.5 ? vec4(sum.rgb/max(sum.a, 1.0/255.0), sum.a) : sum;\n"
+"}\n");
+    static_assert(BLUR_SEPARABLE_MAX_RADIUS == 16, "Please update the loop of the gaussian shader");
+    // https://community.arm.com/cfs-file/__key/communityserver-blogs-components-weblogfiles/00-00-00-20-66/siggraph2015_2D00_mmg_2D00_marius_2D00_notes.pdf
+    shaders->kawase_down = LoadShaderFromMemory(NULL,
+GLSL_TEXTURE_BOILERPLATE
+"in vec2 fragTexCoord;\n"
+"uniform sampler2D texture0;\n"
+"uniform vec2 halfpixel;\n"
+"uniform float offset;\n"
+"void main() {\n"
+"    vec2 uv = fragTexCoord;\n"
+"    vec2 d = halfpixel*offset;\n"
+"    vec4 sum = texture(texture0, uv)*4.0;\n"
+"    sum += texture(texture0, uv - d);\n"
+"    sum += texture(texture0, uv + d);\n"
+"    sum += texture(texture0, uv + vec2(d.x, -d.y));\n"
+"    sum += texture(texture0, uv - vec2(d.x, -d.y));\n"
+"    finalColor = sum/8.0;\n"
+"}\n");
+    shaders->kawase_up = LoadShaderFromMemory(NULL,
+GLSL_TEXTURE_BOILERPLATE
+"in vec2 fragTexCoord;\n"
+"uniform sampler2D texture0;\n"
+"uniform vec2 halfpixel;\n"
+"uniform float offset;\n"
+"uniform float unpremultiply;\n"
+"void main() {\n"
+"    vec2 uv = fragTexCoord;\n"
+"    vec2 d = halfpixel*offset;\n"
+"    vec4 sum = texture(texture0, uv + vec2(-d.x*2.0, 0.0));\n"
+"    sum += texture(texture0, uv + vec2(-d.x, d.y))*2.0;\n"
+"    sum += texture(texture0, uv + vec2(0.0, d.y*2.0));\n"
+"    sum += texture(texture0, uv + vec2(d.x, d.y))*2.0;\n"
+"    sum += texture(texture0, uv + vec2(d.x*2.0, 0.0));\n"
+"    sum += texture(texture0, uv + vec2(d.x, -d.y))*2.0;\n"
+"    sum += texture(texture0, uv + vec2(0.0, -d.y*2.0));\n"
+"    sum += texture(texture0, uv + vec2(-d.x, -d.y))*2.0;\n"
+"    sum /= 12.0;\n"
+"    finalColor = unpremultiply > 0.5 ? vec4(sum.rgb/max(sum.a, 1.0/255.0), sum.a) : sum;\n"
+"}\n");
+
+    shaders->gaussian_bounds_loc = GetShaderLocation(shaders->gaussian, "bounds");
+    shaders->gaussian_direction_loc = GetShaderLocation(shaders->gaussian, "direction");
+    shaders->gaussian_sigma_loc = GetShaderLocation(shaders->gaussian, "sigma");
+    shaders->gaussian_taps_loc = GetShaderLocation(shaders->gaussian, "taps");
+    shaders->gaussian_alpha_loc = GetShaderLocation(shaders->gaussian, "alpha");
+    shaders->down_halfpixel_loc = GetShaderLocation(shaders->kawase_down, "halfpixel");
+    shaders->down_offset_loc = GetShaderLocation(shaders->kawase_down, "offset");
+    shaders->up_halfpixel_loc = GetShaderLocation(shaders->kawase_up, "halfpixel");
+    shaders->up_offset_loc = GetShaderLocation(shaders->kawase_up, "offset");
+    shaders->up_unpremultiply_loc = GetShaderLocation(shaders->kawase_up, "unpremultiply");
+    shaders->loaded = true;
+}
+
+// Monotone cubic interpolation (Fritsch-Carlson) of the control points, so that the curve never overshoots them
+void filter_update_curve_lut(Filter *filter) {
+    assert(filter->type == FILTER_CURVES);
+    const float *y = filter->as_curves.outputs;
+    const float h = 1.0f / (CURVE_POINTS - 1);
+
+    float slopes[CURVE_POINTS - 1];
+    for (size_t i = 0; i + 1 < CURVE_POINTS; i++) slopes[i] = (y[i + 1] - y[i]) / h;
+    float tangents[CURVE_POINTS];
+    tangents[0] = slopes[0];
+    tangents[CURVE_POINTS - 1] = slopes[CURVE_POINTS - 2];
+    for (size_t i = 1; i + 1 < CURVE_POINTS; i++) {
+        tangents[i] = slopes[i - 1] * slopes[i] <= 0 ? 0 : (slopes[i - 1] + slopes[i]) / 2;
+    }
+    for (size_t i = 0; i + 1 < CURVE_POINTS; i++) {
+        if (slopes[i] == 0) {
+            tangents[i] = tangents[i + 1] = 0;
+            continue;
+        }
+        float a = tangents[i] / slopes[i];
+        float b = tangents[i + 1] / slopes[i];
+        float length = sqrtf(a*a + b*b);
+        if (length > 3) {
+            tangents[i] = 3 * a / length * slopes[i];
+            tangents[i + 1] = 3 * b / length * slopes[i];
+        }
+    }
+
+    unsigned char lut[CURVE_LUT_SIZE];
+    for (size_t i = 0; i < CURVE_LUT_SIZE; i++) {
+        float x = (float)i / (CURVE_LUT_SIZE - 1);
+        size_t k = x * (CURVE_POINTS - 1);
+        if (k >= CURVE_POINTS - 1) k = CURVE_POINTS - 2;
+        float t = (x - k * h) / h;
+        float t2 = t*t, t3 = t2*t;
+        float value = (2*t3 - 3*t2 + 1) * y[k] + (t3 - 2*t2 + t) * h * tangents[k]
+                    + (-2*t3 + 3*t2) * y[k + 1] + (t3 - t2) * h * tangents[k + 1];
+        lut[i] = Clamp(value, 0, 1) * 255 + 0.5f;
+    }
+
+    Texture *texture = &filter->as_curves.lut;
+    if (texture->id == 0) {
+        Image image = { .data = lut, .width = CURVE_LUT_SIZE, .height = 1, .mipmaps = 1, .format = PIXELFORMAT_UNCOMPRESSED_GRAYSCALE };
+        *texture = LoadTextureFromImage(image);
+        SetTextureFilter(*texture, TEXTURE_FILTER_BILINEAR);
+        SetTextureWrap(*texture, TEXTURE_WRAP_CLAMP);
+    } else {
+        UpdateTexture(*texture, lut);
+    }
+}
+
+void filter_get_params(const Filter *filter, float params[FILTER_MAX_PARAMS]) {
+    static_assert(COUNT_FILTERS == 5, "Exhaustive handling of filters in filter_get_params");
+    switch (filter->type) {
+        case FILTER_BRIGHTNESS_CONTRAST:
+            params[0] = filter->as_brightness_contrast.brightness;
+            params[1] = filter->as_brightness_contrast.contrast;
+            break;
+        case FILTER_LEVELS:
+            params[0] = filter->as_levels.in_black;
+            params[1] = filter->as_levels.in_white;
+            params[2] = filter->as_levels.gamma;
+            params[3] = filter->as_levels.out_black;
+            params[4] = filter->as_levels.out_white;
+            break;
+        case FILTER_CURVES: break;
+        case FILTER_HUE_SATURATION:
+            params[0] = filter->as_hue_saturation.hue;
+            params[1] = filter->as_hue_saturation.saturation;
+            params[2] = filter->as_hue_saturation.value;
+            break;
+        // Not a single shader pass, see blur_texture()
+        case FILTER_BLUR: break;
+        case COUNT_FILTERS:
+        default: UNREACHABLE("invalid filter");
+    }
+}
+
+// (Re)creates `rtex` unless it already is `width` x `height`
+void ensure_render_texture(RenderTexture *rtex, int width, int height) {
+    if (rtex->id != 0 && rtex->texture.width == width && rtex->texture.height == height) return;
+    if (rtex->id != 0) UnloadRenderTexture(*rtex);
+    *rtex = LoadRenderTexture(width, height);
+}
+
+// Draws `input_rec` of `input` over the whole of `target` with one of the blur shaders, whose uniforms must already
+// be set
+void blur_pass(Shader shader, Texture input, Rectangle input_rec, RenderTexture target) {
+    Rectangle dest = { 0, 0, target.texture.width, target.texture.height };
+    TextureMode(target) {
+        rlSetBlendFactors(RL_ONE, RL_ZERO, RL_FUNC_ADD);
+        BlendMode(BLEND_CUSTOM) ShaderMode(shader) {
+            DrawTexturePro(input, input_rec, dest, Vector2Zero(), 0.0f, WHITE);
+        }
+    }
+}
+
+void blur_gaussian_pass(Texture input, Rectangle input_rec, RenderTexture target, Vector2 axis, float radius, bool premultiply, bool unpremultiply) {
+    Blur_Shaders *shaders = &g->blur_shaders;
+    // A negative height only flips the texture coordinates, the sampled texels are the same
+    float top = fminf(input_rec.y, input_rec.y + input_rec.height);
+    float bounds[4] = {
+        (input_rec.x + 0.5f) / input.width, (top + 0.5f) / input.height,
+        (input_rec.x + input_rec.width - 0.5f) / input.width, (top + fabsf(input_rec.height) - 0.5f) / input.height,
+    };
+    Vector2 direction = { axis.x / input.width, axis.y / input.height };
+    float sigma = radius / 3;
+    float taps = ceilf(radius);
+    Vector2 alpha = { premultiply, unpremultiply };
+    SetShaderValue(shaders->gaussian, shaders->gaussian_bounds_loc, bounds, SHADER_UNIFORM_VEC4);
+    SetShaderValue(shaders->gaussian, shaders->gaussian_direction_loc, &direction, SHADER_UNIFORM_VEC2);
+    SetShaderValue(shaders->gaussian, shaders->gaussian_sigma_loc, &sigma, SHADER_UNIFORM_FLOAT);
+    SetShaderValue(shaders->gaussian, shaders->gaussian_taps_loc, &taps, SHADER_UNIFORM_FLOAT);
+    SetShaderValue(shaders->gaussian, shaders->gaussian_alpha_loc, &alpha, SHADER_UNIFORM_VEC2);
+    blur_pass(shaders->gaussian, input, input_rec, target);
+}
+
+// Blurs `input_rec` of `input` into `target`, which must be just as big. Edge pixels are repeated outwards. Uses
+// render textures, so just like object_apply_filters() it must not be called in the middle of drawing something else
+void blur_texture(Texture input, Rectangle input_rec, RenderTexture target, float radius) {
+    Blur_Targets *targets = &g->blur_targets;
+    int width = target.texture.width;
+    int height = target.texture.height;
+
+    if (radius <= BLUR_SEPARABLE_MAX_RADIUS) {
+        ensure_render_texture(&targets->scratch, width, height);
+        blur_gaussian_pass(input, input_rec, targets->scratch, (Vector2) { 1, 0 }, radius, true, false);
+        // Render textures are upside down
+        Rectangle scratch_rec = { 0, 0, width, -height };
+        blur_gaussian_pass(targets->scratch.texture, scratch_rec, target, (Vector2) { 0, 1 }, radius, false, true);
+        return;
+    }
+
+    // Every level doubles the reach of the blur, so pick just enough of them for the offset to stay around 1-2 texels,
+    // above which the taps start to leave visible gaps
+    int levels = Clamp(ceilf(log2f(radius)) - 2, 1, BLUR_MAX_LEVELS);
+    float offset = radius / (1 << (levels + 1));
+    for (int level = 0; level <= levels; level++) {
+        RenderTexture *rtex = &targets->levels[level];
+        ensure_render_texture(rtex, fmaxf(width >> level, 1), fmaxf(height >> level, 1));
+        SetTextureFilter(rtex->texture, TEXTURE_FILTER_BILINEAR);
+        SetTextureWrap(rtex->texture, TEXTURE_WRAP_CLAMP);
+    }
+
+    // Copy the input into the first level, which takes care of premultiplying, atlas bounds and flipping
+    blur_gaussian_pass(input, input_rec, targets->levels[0], Vector2Zero(), 0, true, false);
+
+    Blur_Shaders *shaders = &g->blur_shaders;
+    SetShaderValue(shaders->kawase_down, shaders->down_offset_loc, &offset, SHADER_UNIFORM_FLOAT);
+    for (int level = 1; level <= levels; level++) {
+        Texture source = targets->levels[level - 1].texture;
+        Vector2 halfpixel = { 0.5f / source.width, 0.5f / source.height };
+        SetShaderValue(shaders->kawase_down, shaders->down_halfpixel_loc, &halfpixel, SHADER_UNIFORM_VEC2);
+        blur_pass(shaders->kawase_down, source, (Rectangle) { 0, 0, source.width, -source.height }, targets->levels[level]);
+    }
+
+    SetShaderValue(shaders->kawase_up, shaders->up_offset_loc, &offset, SHADER_UNIFORM_FLOAT);
+    for (int level = levels; level >= 1; level--) {
+        Texture source = targets->levels[level].texture;
+        Vector2 halfpixel = { 0.5f / source.width, 0.5f / source.height };
+        float unpremultiply = level == 1;
+        SetShaderValue(shaders->kawase_up, shaders->up_halfpixel_loc, &halfpixel, SHADER_UNIFORM_VEC2);
+        SetShaderValue(shaders->kawase_up, shaders->up_unpremultiply_loc, &unpremultiply, SHADER_UNIFORM_FLOAT);
+        RenderTexture dest = level == 1 ? target : targets->levels[level - 1];
+        blur_pass(shaders->kawase_up, source, (Rectangle) { 0, 0, source.width, -source.height }, dest);
+    }
+}
+
+// CPU version of the blur for when there is no GPU to do it on, e.g. in headless tools. Three box blurs in a row
+// come within a few percent of a gaussian, and each one costs the same no matter the radius thanks to running sums
+
+#define BLUR_BOX_PASSES 3
+
+// Radii of the box blurs that together approximate a gaussian with the given standard deviation
+// http://blog.ivank.net/fastest-gaussian-blur.html
+void blur_box_radii(float sigma, int radii[BLUR_BOX_PASSES]) {
+    const int n = BLUR_BOX_PASSES;
+    int lower = floorf(sqrtf(12*sigma*sigma/n + 1));
+    if (lower % 2 == 0) lower--;
+    int upper = lower + 2;
+    int lower_count = roundf((12*sigma*sigma - n*lower*lower - 4*n*lower - 3*n) / (-4*lower - 4));
+    for (int i = 0; i < n; i++) radii[i] = ((i < lower_count ? lower : upper) - 1) / 2;
+}
+
+void image_blur(Image *image, float radius) {
+    if (radius <= 0) return;
+    image_to_rgba8(image);
+    size_t width = image->width;
+    size_t height = image->height;
+    kernels.premultiply(image->data, width * height);
+
+    int radii[BLUR_BOX_PASSES];
+    blur_box_radii(radius / 3, radii);
+    for (int pass = 0; pass < BLUR_BOX_PASSES; pass++) {
+        if (radii[pass] > 0) kernel_box_blur(image->data, width, height, radii[pass]);
+    }
+
+    kernels.unpremultiply(image->data, width * height);
+}
+
+// ImageResize() with a choice of filter, and premultiplied so that transparent pixels don't darken the edges
+void image_resample(Image *image, int new_width, int new_height, Resize_Filter filter) {
+    image_to_rgba8(image);
+    unsigned char *resized = RL_MALLOC((size_t)new_width * new_height * 4);
+    kernel_resize_rgba8(image->data, image->width, image->height, resized, new_width, new_height, filter);
+    RL_FREE(image->data);
+    image->data = resized;
+    image->width = new_width;
+    image->height = new_height;
+}
+
+// Runs the filter stack of an image object if it changed since the last time. Uses render textures, so it must not
+// be called in the middle of drawing the scene
+void object_apply_filters(Object *object) {
+    if (object->type != OBJ_TEXTURE || !object->as_texture.filtered_dirty) return;
+    object->as_texture.filtered_dirty = false;
+
+    Filters *filters = &object->as_texture.filters;
+    RenderTexture *filtered = &object->as_texture.filtered;
+    if (filters->count == 0) {
+        if (filtered->id != 0) UnloadRenderTexture(*filtered);
+        *filtered = (RenderTexture) {0};
+        return;
+    }
+
+    Texture input;
+    Rectangle input_rec;
+    if (object->as_texture.in_atlas) {
+        Atlas_Slot slot = g->atlas.slots.items[object->as_texture.atlas_slot];
+        input = g->atlas.pages.items[slot.page].texture;
+        input_rec = slot.rec;
+    } else {
+        input = object->as_texture.texture;
+        input_rec = (Rectangle) { 0, 0, input.width, input.height };
+    }
+    int width = input_rec.width;
+    int height = input_rec.height;
+    ensure_render_texture(filtered, width, height);
+    RenderTexture *scratch = &g->filter_scratch;
+    if (filters->count > 1) ensure_render_texture(scratch, width, height);
+
+    Filter_Shaders *shaders = &g->filter_shaders;
+    for (size_t i = 0; i < filters->count; i++) {
+        Filter *filter = &filters->items[i];
+        if (filter->type == FILTER_CURVES) filter_update_curve_lut(filter);
+
+        // Alternate between the two, so that the last pass ends up in `filtered`
+        RenderTexture *target = (filters->count - 1 - i) % 2 == 0 ? filtered : scratch;
+        if (filter->type == FILTER_BLUR) {
+            blur_texture(input, input_rec, *target, filter->as_blur.radius);
+        } else {
+            Shader shader = shaders->shaders[filter->type];
+            float params[FILTER_MAX_PARAMS] = {0};
+            filter_get_params(filter, params);
+
+            TextureMode(*target) {
+                // Straight copy, so that transparent pixels keep their color and alpha
+                rlSetBlendFactors(RL_ONE, RL_ZERO, RL_FUNC_ADD);
+                BlendMode(BLEND_CUSTOM) ShaderMode(shader) {
+                    SetShaderValueV(shader, shaders->params_locs[filter->type], params, SHADER_UNIFORM_FLOAT, FILTER_MAX_PARAMS);
+                    if (filter->type == FILTER_CURVES) SetShaderValueTexture(shader, shaders->lut_loc, filter->as_curves.lut);
+                    DrawTexturePro(input, input_rec, (Rectangle) { 0, 0, width, height }, Vector2Zero(), 0.0f, WHITE);
+                }
+            }
+        }
+
+        // Render textures are upside down
+        input = target->texture;
+        input_rec = (Rectangle) { 0, 0, width, -height };
+    }
+}
+
+void apply_all_filters(void) {
+    da_foreach(Object, object, &g->objects) {
+        object_apply_filters(object);
+    }
+}
+
+#ifndef PLATFORM_WEB
+void shape_batch_alloc_instance_vbo(Shape_Batch *batch, size_t capacity) {
+    // Must be called with the batch's VAO bound
+    if (batch->instance_vbo != 0) rlUnloadVertexBuffer(batch->instance_vbo);
+    batch->instance_vbo = rlLoadVertexBuffer(NULL, capacity * sizeof(Shape_Instance), true);
+    batch->instance_vbo_capacity = capacity;
+
+    rlSetVertexAttribute(batch->ends_loc, 4, RL_FLOAT, false, sizeof(Shape_Instance), offsetof(Shape_Instance, a));
+    rlEnableVertexAttribute(batch->ends_loc);
+    rlSetVertexAttributeDivisor(batch->ends_loc, 1);
+    rlSetVertexAttribute(batch->weight_loc, 1, RL_FLOAT, false, sizeof(Shape_Instance), offsetof(Shape_Instance, weight));
+    rlEnableVertexAttribute(batch->weight_loc);
+    rlSetVertexAttributeDivisor(batch->weight_loc, 1);
+    rlSetVertexAttribute(batch->color_loc, 4, RL_UNSIGNED_BYTE, true, sizeof(Shape_Instance), offsetof(Shape_Instance, color));
+    rlEnableVertexAttribute(batch->color_loc);
+    rlSetVertexAttributeDivisor(batch->color_loc, 1);
+}
+#endif // PLATFORM_WEB
+
+void shape_batch_load(Shape_Batch *batch) {
+#ifndef PLATFORM_WEB
+    batch->shader = LoadShaderFromMemory(
+"#version 330\n"
+"in vec2 vertexPosition;\n"
+"in vec4 instanceEnds;\n"
+"in float instanceWeight;\n"
+"in vec4 instanceColor;\n"
+"uniform mat4 mvp;\n"
+"out vec4 fragColor;\n"
+
+"void main() {\n"
+"    vec2 a = instanceEnds.xy;\n"
+"    vec2 dir = instanceEnds.zw - a;\n"
+"    float len = length(dir);\n"
+"    vec2 normal = len > 0.0 ? vec2(-dir.y, dir.x) / len * instanceWeight / 2.0 : vec2(0.0);\n"
+"    vec2 pos = a + dir * vertexPosition.x + normal * vertexPosition.y;\n"
+"    fragColor = instanceColor;\n"
+"    gl_Position = mvp * vec4(pos, 0.0, 1.0);\n"
+"}\n",
+GLSL_BOILERPLATE
+"in vec4 fragColor;\n"
+
+"void main() {\n"
+"    finalColor = fragColor;\n"
+"}\n");
+    if (!IsShaderValid(batch->shader) || batch->shader.id == rlGetShaderIdDefault()) {
+        nob_log(WARNING, "Could not load the shape batch shader. Falling back to drawing shapes one by one");
+        return;
+    }
+
+    batch->mvp_loc = GetShaderLocation(batch->shader, "mvp");
+    int position_loc = rlGetLocationAttrib(batch->shader.id, "vertexPosition");
+    batch->ends_loc = rlGetLocationAttrib(batch->shader.id, "instanceEnds");
+    batch->weight_loc = rlGetLocationAttrib(batch->shader.id, "instanceWeight");
+    batch->color_loc = rlGetLocationAttrib(batch->shader.id, "instanceColor");
+
+    // x goes along the segment, y across it
+    float quad[] = {
+        0, -1,  1, -1,  1, 1,
+        0, -1,  1,  1,  0, 1,
+    };
+    batch->vao = rlLoadVertexArray();
+    rlEnableVertexArray(batch->vao);
+    batch->quad_vbo = rlLoadVertexBuffer(quad, sizeof(quad), false);
+    rlSetVertexAttribute(position_loc, 2, RL_FLOAT, false, 0, 0);
+    rlEnableVertexAttribute(position_loc);
+    shape_batch_alloc_instance_vbo(batch, 1024);
+    rlDisableVertexArray();
+
+    batch->loaded = true;
+#else
+    // WebGL 1 has no instancing without extensions, so the web build keeps drawing shapes one by one
+    UNUSED(batch);
+#endif // PLATFORM_WEB
+}
+
+void shape_batch_flush(Shape_Batch *batch) {
+    if (batch->instances.count == 0) return;
+
+    if (!batch->loaded || batch->instances.count < SHAPE_BATCH_MIN_INSTANCES) {
+        da_foreach(Shape_Instance, instance, &batch->instances) {
+            DrawLineEx(instance->a, instance->b, instance->weight, instance->color);
+        }
+        batch->instances.count = 0;
+        return;
+    }
+
+#ifndef PLATFORM_WEB
+    // Whatever raylib has batched so far lies below these shapes
+    rlDrawRenderBatchActive();
+
+    rlEnableVertexArray(batch->vao);
+    if (batch->instances.count > batch->instance_vbo_capacity) {
+        size_t capacity = batch->instance_vbo_capacity;
+        while (capacity < batch->instances.count) capacity *= 2;
+        shape_batch_alloc_instance_vbo(batch, capacity);
+    }
+    rlUpdateVertexBuffer(batch->instance_vbo, batch->instances.items, batch->instances.count * sizeof(Shape_Instance), 0);
+
+    rlEnableShader(batch->shader.id);
+    rlSetUniformMatrix(batch->mvp_loc, MatrixMultiply(rlGetMatrixModelview(), rlGetMatrixProjection()));
+    rlDrawVertexArrayInstanced(0, 6, batch->instances.count);
+    rlDisableShader();
+    rlDisableVertexArray();
+#endif // PLATFORM_WEB
+
+    batch->instances.count = 0;
+}
+
+void shape_batch_push_rect(Shape_Batch *batch, Rectangle rec, Color color) {
+    float mid_y = rec.y + rec.height / 2;
+    Shape_Instance instance = {
+        .a = { rec.x, mid_y },
+        .b = { rec.x + rec.width, mid_y },
+        .weight = rec.height,
+        .color = color,
+    };
+    da_append(&batch->instances, instance);
+}
+
+void shape_batch_push_stroke(Shape_Batch *batch, Stroke stroke) {
+    if (stroke.count < 2) return;
+    for (size_t i = 0; i < stroke.count - 1; i++) {
+        Shape_Instance instance = {
+            .a = stroke.items[i],
+            .b = stroke.items[i+1],
+            .weight = stroke.weight,
+            .color = stroke.color,
+        };
+        da_append(&batch->instances, instance);
+    }
+}
+
+// Random but the same every time the stroke gets rendered, in [0, 1]
+float brush_hash(size_t index) {
+    uint32_t x = index * 0x9E3779B9u;
+    x ^= x >> 16;
+    x *= 0x85EBCA6Bu;
+    x ^= x >> 13;
+    x *= 0xC2B2AE35u;
+    x ^= x >> 16;
+    return x / (float)UINT32_MAX;
+}
+
+void brush_add_dab(const Stroke *stroke, Dab_Walker *walker, Vector2 center, Dabs *dabs) {
+    float size = stroke->weight * (1 - stroke->brush.size_jitter * brush_hash(walker->dabs));
+    da_append(dabs, ((Dab) { center, size }));
+    walker->dabs++;
+}
+
+// Appends the dabs of the points of the stroke that the walker hasn't seen yet
+void brush_walk_dabs(const Stroke *stroke, Dab_Walker *walker, Dabs *dabs) {
+    float spacing = fmaxf(stroke->weight * stroke->brush.spacing, 1);
+    if (walker->next_point == 0 && stroke->count > 0) {
+        brush_add_dab(stroke, walker, stroke->items[0], dabs);
+        walker->distance_to_next_dab = spacing;
+        walker->next_point = 1;
+    }
+    for (; walker->next_point < stroke->count; walker->next_point++) {
+        Vector2 a = stroke->items[walker->next_point - 1];
+        Vector2 b = stroke->items[walker->next_point];
+        float length = Vector2Distance(a, b);
+        float distance = walker->distance_to_next_dab;
+        for (; distance <= length; distance += spacing) {
+            brush_add_dab(stroke, walker, Vector2Lerp(a, b, distance / length), dabs);
+        }
+        walker->distance_to_next_dab = distance - length;
+    }
+}
+
+void brush_renderer_alloc_instance_vbo(Brush_Renderer *renderer, size_t capacity) {
+    // Must be called with the renderer's VAO bound
+    if (renderer->instance_vbo != 0) rlUnloadVertexBuffer(renderer->instance_vbo);
+    renderer->instance_vbo = rlLoadVertexBuffer(NULL, capacity * sizeof(Dab), true);
+    renderer->instance_vbo_capacity = capacity;
+
+    int dab_loc = rlGetLocationAttrib(renderer->shader.id, "instanceDab");
+    rlSetVertexAttribute(dab_loc, 3, RL_FLOAT, false, sizeof(Dab), 0);
+    rlEnableVertexAttribute(dab_loc);
+    rlSetVertexAttributeDivisor(dab_loc, 1);
+}
+
+void brush_renderer_load(Brush_Renderer *renderer) {
+    // Dabs come out premultiplied, so that stacking them up with MAX blending gives the coverage of the whole stroke
+    renderer->fallback_shader = LoadShaderFromMemory(NULL,
+GLSL_TEXTURE_BOILERPLATE
+"in vec2 fragTexCoord;\n"
+"in vec4 fragColor;\n"
+"uniform sampler2D texture0;\n"
+
+"void main() {\n"
+"    float alpha = texture(texture0, fragTexCoord).a*fragColor.a;\n"
+"    finalColor = vec4(fragColor.rgb*alpha, alpha);\n"
+"}\n");
+    renderer->loaded = true;
+
+#ifndef PLATFORM_WEB
+    renderer->shader = LoadShaderFromMemory(
+"#version 330\n"
+"in vec2 vertexPosition;\n"
+"in vec3 instanceDab;\n"
+"uniform mat4 mvp;\n"
+"out vec2 fragTexCoord;\n"
+
+"void main() {\n"
+"    fragTexCoord = vertexPosition;\n"
+"    vec2 pos = instanceDab.xy + (vertexPosition - 0.5)*instanceDab.z;\n"
+"    gl_Position = mvp*vec4(pos, 0.0, 1.0);\n"
+"}\n",
+GLSL_BOILERPLATE
+"in vec2 fragTexCoord;\n"
+"uniform sampler2D texture0;\n"
+"uniform vec4 color;\n"
+
+"void main() {\n"
+"    float alpha = texture(texture0, fragTexCoord).a*color.a;\n"
+"    finalColor = vec4(color.rgb*alpha, alpha);\n"
+"}\n");
+    if (!IsShaderValid(renderer->shader) || renderer->shader.id == rlGetShaderIdDefault()) {
+        nob_log(WARNING, "Could not load the dab shader. Falling back to drawing dabs one by one");
+        return;
+    }
+
+    renderer->mvp_loc = GetShaderLocation(renderer->shader, "mvp");
+    renderer->color_loc = GetShaderLocation(renderer->shader, "color");
+    int position_loc = rlGetLocationAttrib(renderer->shader.id, "vertexPosition");
+
+    float quad[] = {
+        0, 0,  1, 0,  1, 1,
+        0, 0,  1, 1,  0, 1,
+    };
+    renderer->vao = rlLoadVertexArray();
+    rlEnableVertexArray(renderer->vao);
+    renderer->quad_vbo = rlLoadVertexBuffer(quad, sizeof(quad), false);
+    rlSetVertexAttribute(position_loc, 2, RL_FLOAT, false, 0, 0);
+    rlEnableVertexAttribute(position_loc);
+    brush_renderer_alloc_instance_vbo(renderer, 1024);
+    rlDisableVertexArray();
+
+    renderer->instanced = true;
+#endif // PLATFORM_WEB
+}
+
+// Alpha of a dab falls off from the edge of the hard core to the edge of the disc
+void brush_renderer_update_texture(Brush_Renderer *renderer, float hardness) {
+    if (renderer->texture.id != 0 && renderer->texture_hardness == hardness) return;
+    if (renderer->texture.id != 0) UnloadTexture(renderer->texture);
+
+    Image image = GenImageColor(BRUSH_TEXTURE_SIZE, BRUSH_TEXTURE_SIZE, BLANK);
+    Color *pixels = image.data;
+    // Even the hardest brush fades out over a texel, so that it doesn't alias
+    float core = fminf(hardness, 1 - 2.0f / BRUSH_TEXTURE_SIZE);
+    for (int y = 0; y < BRUSH_TEXTURE_SIZE; y++) {
+        for (int x = 0; x < BRUSH_TEXTURE_SIZE; x++) {
+            Vector2 offset = { x + 0.5f - BRUSH_TEXTURE_SIZE / 2, y + 0.5f - BRUSH_TEXTURE_SIZE / 2 };
+            float r = Vector2Length(offset) / (BRUSH_TEXTURE_SIZE / 2);
+            float t = Clamp((r - core) / (1 - core), 0, 1);
+            float alpha = 1 - t * t * (3 - 2 * t);
+            pixels[y * BRUSH_TEXTURE_SIZE + x] = (Color) { 255, 255, 255, alpha * 255 };
+        }
+    }
+    renderer->texture = LoadTextureFromImage(image);
+    UnloadImage(image);
+    // Small dabs would sparkle without mipmaps
+    GenTextureMipmaps(&renderer->texture);
+    SetTextureFilter(renderer->texture, TEXTURE_FILTER_TRILINEAR);
+    renderer->texture_hardness = hardness;
+}
+
+// Draws the dabs with the current camera, as premultiplied `color` times the alpha of the brush. All of them in one
+// instanced draw call where instancing is available
+void brush_draw_dabs(Brush_Renderer *renderer, const Dabs *dabs, Color color, float hardness) {
+    if (dabs->count == 0) return;
+    brush_renderer_update_texture(renderer, hardness);
+
+    if (!renderer->instanced) {
+        Rectangle source = { 0, 0, renderer->texture.width, renderer->texture.height };
+        ShaderMode(renderer->fallback_shader) {
+            da_foreach(Dab, dab, dabs) {
+                Rectangle dest = { dab->center.x - dab->size / 2, dab->center.y - dab->size / 2, dab->size, dab->size };
+                DrawTexturePro(renderer->texture, source, dest, Vector2Zero(), 0.0f, color);
+            }
+        }
+        return;
+    }
+
+#ifndef PLATFORM_WEB
+    rlDrawRenderBatchActive();
+
+    rlEnableVertexArray(renderer->vao);
+    if (dabs->count > renderer->instance_vbo_capacity) {
+        size_t capacity = renderer->instance_vbo_capacity;
+        while (capacity < dabs->count) capacity *= 2;
+        brush_renderer_alloc_instance_vbo(renderer, capacity);
+    }
+    rlUpdateVertexBuffer(renderer->instance_vbo, dabs->items, dabs->count * sizeof(Dab), 0);
+
+    rlEnableShader(renderer->shader.id);
+    rlSetUniformMatrix(renderer->mvp_loc, MatrixMultiply(rlGetMatrixModelview(), rlGetMatrixProjection()));
+    Vector4 normalized = ColorNormalize(color);
+    rlSetUniform(renderer->color_loc, &normalized, RL_SHADER_UNIFORM_VEC4, 1);
+    rlActiveTextureSlot(0);
+    rlEnableTexture(renderer->texture.id);
+    rlDrawVertexArrayInstanced(0, 6, dabs->count);
+    rlDisableTexture();
+    rlDisableShader();
+    rlDisableVertexArray();
+#endif // PLATFORM_WEB
+}
+
+// Clears `target` and renders the coverage of the dabs of `stroke` into it with `camera`. Overlapping dabs keep the
+// most opaque one instead of piling up, so that the opacity of the brush is the opacity of the stroke
+void brush_render_dabs(const Stroke *stroke, const Dabs *dabs, RenderTexture target, Camera2D camera) {
+    rlSetBlendFactors(RL_ONE, RL_ONE, RL_MAX);
+    TextureMode(target) {
+        ClearBackground(BLANK);
+        BlendMode(BLEND_CUSTOM) Mode2D(camera) {
+            brush_draw_dabs(&g->brush_renderer, dabs, stroke->color, stroke->brush.hardness);
+        }
+    }
+}
+
+// For BLEND_CUSTOM_SEPARATE. Draws straight alpha colors into a premultiplied target, so that translucent strokes don't
+// pick up the black of its empty pixels
+void set_premultiplying_blend_factors(void) {
+    rlSetBlendFactorsSeparate(RL_SRC_ALPHA, RL_ONE_MINUS_SRC_ALPHA, RL_ONE, RL_ONE_MINUS_SRC_ALPHA, RL_FUNC_ADD, RL_FUNC_ADD);
+}
+
+// Tint that scales a premultiplied texture by `opacity`
+Color premultiplied_opacity(float opacity) {
+    unsigned char value = Clamp(opacity, 0, 1) * 255;
+    return (Color) { value, value, value, value };
+}
+
+void app_init(void) {
+    g = malloc(sizeof(*g));
+    memset(g, 0, sizeof(*g));
+    g->size = sizeof(*g);
+
+    kernels_init();
+    g->resample_filter = RESIZE_LANCZOS3;
+    g->color_tolerance = 32;
+    g->brush = (Brush) {
+        .size = 40,
+        .hardness = 0.5f,
+        .spacing = 0.1f,
+        .opacity = 1,
+    };
+
+    g->camera.zoom = 1;
+    g->camera.target = (Vector2) { (float)GetScreenWidth() / 2, (float)GetScreenHeight() / 2 };
+
+    uint64_t total_memory_size = Clay_MinMemorySize();
+    Clay_Arena clay_arena = Clay_CreateArenaWithCapacityAndMemory(total_memory_size, malloc(total_memory_size));
+
+    // NOTE: I have no idea what the last 3 parameters of LoadFontFromMemory() mean,
+    // I just copied them from the source code of the regular LoadFont()
+    g->font = LoadFontFromMemory(".ttf", font_data, font_len, 32, NULL, 95);
+    g->clay = Clay_Initialize(clay_arena, (Clay_Dimensions) { GetScreenWidth(), GetScreenHeight() }, (Clay_ErrorHandler) { handle_clay_error, 0 });
+    Clay_SetMeasureTextFunction(Raylib_MeasureText, &g->font);
+
+    g->current_color = WHITE;
+
+    Image one_by_one_image = GenImageColor(1, 1, WHITE);
+    g->one_by_one_texture = LoadTextureFromImage(one_by_one_image);
+    UnloadImage(one_by_one_image);
+
+    g->hue_picker_shader = LoadShaderFromMemory(NULL,
+GLSL_BOILERPLATE
+GLSL_RGB_TO_HSV
+"in vec2 fragTexCoord;\n"
+"in vec4 fragColor;\n"
+
+"void main() {\n"
+"    float hue = fragTexCoord.x;\n"
+"    vec3 rgb = hsv2rgb(vec3(hue, 1.0, 1.0));\n"
+"    finalColor = vec4(rgb, 1.0);\n"
+"}\n"
+"\n");
+    g->color_picker_shader = LoadShaderFromMemory(NULL,
+GLSL_BOILERPLATE
+GLSL_RGB_TO_HSV
+"in vec2 fragTexCoord;\n"
+"in vec4 fragColor;\n"
+
+"uniform float hue;\n"
+
+"void main() {\n"
+"    vec3 rgb = hsv2rgb(vec3(hue, fragTexCoord.x, 1.0-fragTexCoord.y));\n"
+"    finalColor = vec4(rgb, 1.0);\n"
+"}\n"
+"\n");
+
+    load_sdf_shader();
+    load_marching_ants_shader();
+    load_filter_shaders();
+    load_blur_shaders();
+    shape_batch_load(&g->shape_batch);
+    brush_renderer_load(&g->brush_renderer);
+    profiler_install_gl_hooks(&g->profiler);
+    input_install_pointer_hook(&g->input);
+
+    g->canvas_bounds = (Rectangle) {0, 0, 1920, 1080};
+    g->hovered_object = -1;
+
+    // Replay a recording made with Ctrl+R, e.g. `SIMP_REPLAY=simp-recording-1234.txt ./build/main`.
+    // The app quits when it's over and leaves per frame timings next to the recording
+    const char *replay_path = getenv("SIMP_REPLAY");
+    if (replay_path != NULL && !input_start_replay(&g->input, replay_path)) {
+        nob_log(ERROR, "Could not replay input from %s", replay_path);
+    }
+}
+
+// Unloading libapp.so under a thread that still runs its code would crash, so the reload waits for those to finish
+bool app_can_reload(void) {
+#ifndef PLATFORM_WEB
+    if (g->file_dialog.open) return false;
+#endif // PLATFORM_WEB
+    return true;
+}
+
+App *app_pre_reload(void) {
+    // Nothing may point into the old code once it's unloaded
+    profiler_remove_gl_hooks();
+    return g;
+}
+
+void app_post_reload(App *new_g) {
+    g = new_g;
+
+    if (g->size < sizeof(*g)) {
+        nob_log(INFO, "Migrating struct App (%zu bytes -> %zu bytes)", g->size, sizeof(*g));
+        g = realloc(g, sizeof(*g));
+        memset((char*)g + g->size, 0, sizeof(*g) - g->size);
+        g->size = sizeof(*g);
+    }
+
+    // The addresses of the functions may shift after hot-reloading so
+    // we must set them again
+    // Clay also uses internally a Clay__currentContext global variable, whose address
+    // (and value) also shifts after the reload. Hence keeping track of it ourselves
+    Clay_SetCurrentContext(g->clay);
+    Clay_SetMeasureTextFunction(Raylib_MeasureText, &g->font);
+    g->clay->errorHandler = (Clay_ErrorHandler) { handle_clay_error, 0 };
+    // Globals of the old code, unlike the App, don't carry over
+    kernels_init();
+    input_install_pointer_hook(&g->input);
+    profiler_install_gl_hooks(&g->profiler);
+
+    // Resources of fields that were just added by the migration above
+    if (g->sdf_shader.id == 0) load_sdf_shader();
+    if (g->marching_ants_shader.id == 0) load_marching_ants_shader();
+    if (!g->shape_batch.loaded) shape_batch_load(&g->shape_batch);
+    if (!g->brush_renderer.loaded) brush_renderer_load(&g->brush_renderer);
+    if (!g->filter_shaders.loaded) load_filter_shaders();
+    if (!g->blur_shaders.loaded) load_blur_shaders();
+
+    // The new code may lay out the UI differently
+    g->ui_dirty = true;
+}
+
+typedef struct {
+    bool pressed : 1;
+    bool hovered : 1;
+} Button_State;
+
+Button_State button(Clay_ElementId id, Clay_String text) {
+    Button_State state;
+    CLAY({
+        .id = id,
+        .layout.padding = { .left = 5, .right = 5 },
+        .backgroundColor = (state.hovered = Clay_Hovered()) ? (Clay_Color) { 150, 150, 150, 255 } : (Clay_Color){ 100, 100, 100, 255 },
+        .cornerRadius = CLAY_CORNER_RADIUS(5),
+    }) {
+        state.pressed = state.hovered && input_is_mouse_button_pressed(MOUSE_BUTTON_LEFT);
+        uint16_t font_size = 30;
+        Clay_TextElementConfig *config = CLAY_TEXT_CONFIG({
+            .fontSize = font_size,
+            .textColor = {255, 255, 255, 255},
+        });
+        CLAY_TEXT(text, config);
+    }
+    return state;
+}
+
+Button_State tool_button(Clay_ElementId id, Clay_String text, Tool tool) {
+    Button_State state;
+    CLAY({
+        .id = id,
+        .layout.padding = { .left = 5, .right = 5 },
+        .backgroundColor = (state.hovered = Clay_Hovered()) || g->tool == tool ? (Clay_Color) { 150, 150, 150, 255 } : (Clay_Color){ 100, 100, 100, 255 },
+        .cornerRadius = CLAY_CORNER_RADIUS(5),
+    }) {
+        state.pressed = state.hovered && input_is_mouse_button_pressed(MOUSE_BUTTON_LEFT);
+        uint16_t font_size = 30;
+        Clay_TextElementConfig *config = CLAY_TEXT_CONFIG({
+            .fontSize = font_size,
+            .textColor = {255, 255, 255, 255},
+        });
+        CLAY_TEXT(text, config);
+    }
+    if (state.pressed) g->tool = tool;
+    return state;
+}
+
+// Returns true if the value changed
+bool slider(Clay_ElementId id, float *value, float min, float max) {
+    const float slider_width = 150;
+    const float knob_size = 16;
+    bool changed = false;
+    CLAY({
+        .id = id,
+        .layout.sizing = { CLAY_SIZING_FIXED(slider_width), CLAY_SIZING_FIXED(3) },
+        .layout.childAlignment.y = CLAY_ALIGN_Y_CENTER,
+        .backgroundColor = {255, 255, 255, 255},
+    }) {
+        bool hovered = Clay_Hovered();
+        float pos = Lerp(0, slider_width, Normalize(*value, min, max));
+        CLAY({ .layout.sizing.width = CLAY_SIZING_FIXED(fmaxf(pos - knob_size / 2, 0)) });
+        CLAY({
+            .layout.sizing = { CLAY_SIZING_FIXED(knob_size), CLAY_SIZING_FIXED(knob_size) },
+            .cornerRadius = CLAY_CORNER_RADIUS(knob_size),
+            .backgroundColor = {255, 255, 255, 255},
+        }) hovered |= Clay_Hovered();
+
+        if (hovered && input_is_mouse_button_down(MOUSE_BUTTON_LEFT)) {
+            Clay_BoundingBox bounding_box = Clay_GetElementData(id).boundingBox;
+            float new_value = Lerp(min, max, Clamp((input_mouse_x() - bounding_box.x) / slider_width, 0, 1));
+            changed = new_value != *value;
+            *value = new_value;
+        }
+    }
+    return changed;
+}
+
+// A row with the label, the slider and the value printed with `format`. Returns true if the value changed
+bool labeled_slider(Clay_ElementId id, const char *label, float *value, float min, float max, const char *format) {
+    Clay_TextElementConfig *text_config = CLAY_TEXT_CONFIG({
+        .fontSize = 20,
+        .textColor = {255, 255, 255, 255},
+    });
+    bool changed = false;
+    CLAY({
+        .layout.sizing = { CLAY_SIZING_GROW(), CLAY_SIZING_FIT() },
+        .layout.childAlignment.y = CLAY_ALIGN_Y_CENTER,
+        .layout.childGap = 10,
+        .layout.padding = { .left = 10 },
+    }) {
+        CLAY_TEXT(clay_string_from_cstr(label), text_config);
+        CLAY({ .layout.sizing = { CLAY_SIZING_GROW(), CLAY_SIZING_GROW() } });
+        changed = slider(id, value, min, max);
+        CLAY_TEXT(clay_string_from_cstr(temp_sprintf(format, *value)), text_config);
+    }
+    return changed;
+}
+
+bool filter_slider(size_t filter_index, size_t param, const char *label, float *value, float min, float max) {
+    assert(param < FILTER_MAX_PARAMS);
+    return labeled_slider(CLAY_IDI("FilterSlider", filter_index * FILTER_MAX_PARAMS + param), label, value, min, max, "%.2f");
+}
+
+void filters_panel(Object *object) {
+    assert(object->type == OBJ_TEXTURE);
+    Filters *filters = &object->as_texture.filters;
+    Clay_TextElementConfig *text_config = CLAY_TEXT_CONFIG({
+        .fontSize = 25,
+        .textColor = {255, 255, 255, 255},
+    });
+    Clay_ElementDeclaration row = {
+        .layout.sizing = { CLAY_SIZING_GROW(), CLAY_SIZING_FIT() },
+        .layout.childAlignment.y = CLAY_ALIGN_Y_CENTER,
+        .layout.childGap = 5,
+    };
+
+    bool changed = false;
+    CLAY({
+        .id = CLAY_ID("FiltersPanel"),
+        .layout.sizing = { CLAY_SIZING_GROW(), CLAY_SIZING_FIT() },
+        .layout.layoutDirection = CLAY_TOP_TO_BOTTOM,
+        .layout.childGap = 3,
+        .layout.padding = CLAY_PADDING_ALL(5),
+        .backgroundColor = {70, 70, 70, 255},
+        .cornerRadius = CLAY_CORNER_RADIUS(5),
+    }) {
+        CLAY(row) {
+            CLAY_TEXT(clay_string_from_cstr(temp_sprintf("Filters of %.*s", (int)object->name_len, object->name)), text_config);
+            CLAY({ .layout.sizing = { CLAY_SIZING_GROW(), CLAY_SIZING_GROW() } });
+            if (button(CLAY_ID("CloseFiltersButton"), CLAY_STRING("Close")).pressed) g->filters_object_id = 0;
+        }
+
+        static_assert(COUNT_FILTERS == 5, "Please add a button for the new filter");
+        static const char *add_labels[COUNT_FILTERS] = {
+            [FILTER_BRIGHTNESS_CONTRAST] = "+B/C",
+            [FILTER_LEVELS] = "+Levels",
+            [FILTER_CURVES] = "+Curves",
+            [FILTER_HUE_SATURATION] = "+H/S",
+            [FILTER_BLUR] = "+Blur",
+        };
+        CLAY(row) {
+            for (Filter_Type type = 0; type < COUNT_FILTERS; type++) {
+                if (button(CLAY_IDI("AddFilterButton", type), clay_string_from_cstr(add_labels[type])).pressed) {
+                    da_append(filters, filter_default(type));
+                    changed = true;
+                }
+            }
+        }
+
+        // Changing the stack in the middle of the loop would mess it up, so do it once it's over
+        int remove = -1, move_up = -1;
+        for (size_t i = 0; i < filters->count; i++) {
+            Filter *filter = &filters->items[i];
+            CLAY(row) {
+                CLAY_TEXT(clay_string_from_cstr(filter_as_cstr(filter->type)), text_config);
+                CLAY({ .layout.sizing = { CLAY_SIZING_GROW(), CLAY_SIZING_GROW() } });
+                if (i > 0 && button(CLAY_IDI("FilterUpButton", i), CLAY_STRING("^")).pressed) move_up = i;
+                if (button(CLAY_IDI("FilterRemoveButton", i), CLAY_STRING("x")).pressed) remove = i;
+            }
+
+            static_assert(COUNT_FILTERS == 5, "Exhaustive handling of filters in filters_panel");
+            switch (filter->type) {
+                case FILTER_BRIGHTNESS_CONTRAST:
+                    changed |= filter_slider(i, 0, "Brightness", &filter->as_brightness_contrast.brightness, -1, 1);
+                    changed |= filter_slider(i, 1, "Contrast", &filter->as_brightness_contrast.contrast, -1, 1);
+                    break;
+                case FILTER_LEVELS:
+                    changed |= filter_slider(i, 0, "Input black", &filter->as_levels.in_black, 0, 1);
+                    changed |= filter_slider(i, 1, "Input white", &filter->as_levels.in_white, 0, 1);
+                    changed |= filter_slider(i, 2, "Gamma", &filter->as_levels.gamma, 0.1f, 3);
+                    changed |= filter_slider(i, 3, "Output black", &filter->as_levels.out_black, 0, 1);
+                    changed |= filter_slider(i, 4, "Output white", &filter->as_levels.out_white, 0, 1);
+                    break;
+                case FILTER_CURVES:
+                    for (size_t point = 0; point < CURVE_POINTS; point++) {
+                        const char *label = temp_sprintf("%d%%", (int)(100 * point / (CURVE_POINTS - 1)));
+                        changed |= filter_slider(i, point, label, &filter->as_curves.outputs[point], 0, 1);
                     }
-                } else if (CheckCollisionPointRec(mouse_pos, bottom_resize_hitbox) && CheckCollisionPointRec(mouse_pos, right_resize_hitbox)) {
-                    mouse_cursor = MOUSE_CURSOR_CROSSHAIR;
+                    break;
+                case FILTER_HUE_SATURATION:
+                    changed |= filter_slider(i, 0, "Hue", &filter->as_hue_saturation.hue, -0.5f, 0.5f);
+                    changed |= filter_slider(i, 1, "Saturation", &filter->as_hue_saturation.saturation, 0, 2);
+                    changed |= filter_slider(i, 2, "Value", &filter->as_hue_saturation.value, 0, 2);
+                    break;
+                case FILTER_BLUR:
+                    changed |= filter_slider(i, 0, "Radius", &filter->as_blur.radius, 0, BLUR_MAX_RADIUS);
+                    break;
+                case COUNT_FILTERS:
+                default: UNREACHABLE("invalid filter");
+            }
+        }
+
+        if (move_up > 0) {
+            Filter tmp = filters->items[move_up];
+            filters->items[move_up] = filters->items[move_up - 1];
+            filters->items[move_up - 1] = tmp;
+            changed = true;
+        }
+        if (remove >= 0) {
+            filter_unload(&filters->items[remove]);
+            memmove(&filters->items[remove], &filters->items[remove + 1], (filters->count - remove - 1) * sizeof(Filter));
+            filters->count -= 1;
+            changed = true;
+        }
+    }
+
+    if (changed) object->as_texture.filtered_dirty = true;
+}
+
+typedef enum {
+    OBJECT_HIT_NONE = 0,
+    OBJECT_HIT_TOP_LEFT,
+    OBJECT_HIT_TOP_RIGHT,
+    OBJECT_HIT_BOTTOM_LEFT,
+    OBJECT_HIT_BOTTOM_RIGHT,
+    OBJECT_HIT_TOP,
+    OBJECT_HIT_BOTTOM,
+    OBJECT_HIT_LEFT,
+    OBJECT_HIT_RIGHT,
+    OBJECT_HIT_BODY,
+    COUNT_OBJECT_HITS,
+} Object_Hit;
+
+// Which part of an object (one of the resize handles along its edges or its body) is under `point`
+Object_Hit object_hit_test(Rectangle bounding_box, Vector2 point, float hitbox_size) {
+    Rectangle top_resize_hitbox = {
+        bounding_box.x, bounding_box.y - hitbox_size / 2.0f,
+        bounding_box.width, hitbox_size,
+    };
+    Rectangle bottom_resize_hitbox = {
+        bounding_box.x, bounding_box.y + bounding_box.height - hitbox_size / 2.0f,
+        bounding_box.width, hitbox_size,
+    };
+    Rectangle left_resize_hitbox = {
+        bounding_box.x - hitbox_size / 2.0f, bounding_box.y,
+        hitbox_size, bounding_box.height,
+    };
+    Rectangle right_resize_hitbox = {
+        bounding_box.x + bounding_box.width - hitbox_size / 2.0f, bounding_box.y,
+        hitbox_size, bounding_box.height,
+    };
+
+    bool top = CheckCollisionPointRec(point, top_resize_hitbox);
+    bool bottom = CheckCollisionPointRec(point, bottom_resize_hitbox);
+    bool left = CheckCollisionPointRec(point, left_resize_hitbox);
+    bool right = CheckCollisionPointRec(point, right_resize_hitbox);
+
+    if (top && left) return OBJECT_HIT_TOP_LEFT;
+    if (top && right) return OBJECT_HIT_TOP_RIGHT;
+    if (bottom && left) return OBJECT_HIT_BOTTOM_LEFT;
+    if (bottom && right) return OBJECT_HIT_BOTTOM_RIGHT;
+    if (top) return OBJECT_HIT_TOP;
+    if (bottom) return OBJECT_HIT_BOTTOM;
+    if (left) return OBJECT_HIT_LEFT;
+    if (right) return OBJECT_HIT_RIGHT;
+    if (CheckCollisionPointRec(point, bounding_box)) return OBJECT_HIT_BODY;
+    return OBJECT_HIT_NONE;
+}
+
+// Returns the index of the topmost object under `point` (or -1 if there is none), along with what part of it was hit
+// and its bounding box
+int hit_test_objects(Vector2 point, float hitbox_size, Object_Hit *hit, Rectangle *bounding_box) {
+    for (int i = (int)g->objects.count - 1; i >= 0; i--) {
+        *bounding_box = object_get_bounding_box(&g->objects.items[i]);
+        *hit = object_hit_test(*bounding_box, point, hitbox_size);
+        if (*hit != OBJECT_HIT_NONE) return i;
+    }
+    return -1;
+}
+
+Rectangle get_current_rect(void) {
+    Vector2 start = g->rect_start;
+    Vector2 end = GetScreenToWorld2D(input_mouse_position(), g->camera);
+
+    Vector2 corner1 = Vector2Min(start, end);
+    Vector2 corner2 = Vector2Max(start, end);
+    Vector2 size = Vector2Subtract(corner2, corner1);
+    return (Rectangle) { corner1.x, corner1.y, size.x, size.y };
+}
+
+void set_cursor(MouseCursor mouse_cursor) {
+    if (mouse_cursor != g->prev_mouse_cursor) {
+        SetMouseCursor(mouse_cursor);
+        g->prev_mouse_cursor = mouse_cursor;
+    }
+}
+
+// Appends the point of the stroke being drawn for the pointer being at `pos` on the screen at `time`. Smoothing pulls
+// it towards the previous point by an amount that depends on the time in between rather than the number of samples,
+// so the stroke comes out the same no matter how often the pointer gets sampled
+void stroke_add_point(Vector2 pos, double time) {
+    Stroke *stroke = &g->current_stroke;
+    Vector2 point = GetScreenToWorld2D(pos, g->camera);
+    if (stroke->count > 0 && g->stroke_smoothing > 0) {
+        double dt = fmax(time - g->stroke_last_time, 0);
+        float t = 1 - exp(-dt / (g->stroke_smoothing * STROKE_SMOOTHING_MAX_LAG));
+        point = Vector2Lerp(da_last(stroke), point, t);
+    }
+    da_append(stroke, point);
+    g->stroke_last_time = time;
+}
 
-                    if (is_move_down) {
-                        bounding_box.height += mouse_delta.y;
-                        bounding_box.width += mouse_delta.x;
-                    }
-                } else if (CheckCollisionPointRec(mouse_pos, top_resize_hitbox)) {
-                    mouse_cursor = MOUSE_CURSOR_RESIZE_NS;
+void update_main_area(void) {
+    g->camera.offset = (Vector2) { (float)input_screen_width() / 2, (float)input_screen_height() / 2 };
 
-                    if (is_move_down) {
-                        bounding_box.y += mouse_delta.y;
-                        bounding_box.height -= mouse_delta.y;
-                    }
-                } else if (CheckCollisionPointRec(mouse_pos, bottom_resize_hitbox)) {
-                    mouse_cursor = MOUSE_CURSOR_RESIZE_NS;
+    float wheel = input_mouse_wheel();
+#ifdef PLATFORM_WEB
+    wheel /= -240;
+#endif // PLATFORM_WEB
+    g->camera.zoom *= wheel / 20.0f + 1;
 
-                    if (is_move_down) {
-                        bounding_box.height += mouse_delta.y;
-                    }
-                } else if (CheckCollisionPointRec(mouse_pos, left_resize_hitbox)) {
-                    mouse_cursor = MOUSE_CURSOR_RESIZE_EW;
+    Vector2 mouse_delta = Vector2Scale(input_mouse_delta(), 1/g->camera.zoom);
+    if (input_is_mouse_button_down(MOUSE_BUTTON_PAN)) {
+        g->camera.target = Vector2Subtract(g->camera.target, mouse_delta);
+    }
 
-                    if (is_move_down) {
-                        bounding_box.x += mouse_delta.x;
-                        bounding_box.width -= mouse_delta.x;
-                    }
-                } else if (CheckCollisionPointRec(mouse_pos, right_resize_hitbox)) {
+    float object_resize_hitbox_size = OBJECT_RESIZE_HITBOX_SIZE / g->camera.zoom;
+    bool is_move_down = input_is_mouse_button_down(MOUSE_BUTTON_TOOL);
+    Vector2 mouse_pos = GetScreenToWorld2D(input_mouse_position(), g->camera);
+    int mouse_cursor = MOUSE_CURSOR_DEFAULT;
+    static_assert(COUNT_TOOLS == 7, "Exhaustive handling of tools in update_main_area");
+    switch (g->tool) {
+        case TOOL_MOVE: {
+            Object_Hit hit;
+            Rectangle bounding_box;
+            int index = hit_test_objects(mouse_pos, object_resize_hitbox_size, &hit, &bounding_box);
+            if (index < 0) break;
+
+            static_assert(COUNT_OBJECT_HITS == 10, "Exhaustive handling of object hits in update_main_area");
+            switch (hit) {
+                case OBJECT_HIT_TOP_LEFT:
+                    mouse_cursor = MOUSE_CURSOR_CROSSHAIR;
+                    bounding_box.y += mouse_delta.y;
+                    bounding_box.height -= mouse_delta.y;
+                    bounding_box.x += mouse_delta.x;
+                    bounding_box.width -= mouse_delta.x;
+                    break;
+                case OBJECT_HIT_TOP_RIGHT:
+                    mouse_cursor = MOUSE_CURSOR_CROSSHAIR;
+                    bounding_box.y += mouse_delta.y;
+                    bounding_box.height -= mouse_delta.y;
+                    bounding_box.width += mouse_delta.x;
+                    break;
+                case OBJECT_HIT_BOTTOM_LEFT:
+                    mouse_cursor = MOUSE_CURSOR_CROSSHAIR;
+                    bounding_box.height += mouse_delta.y;
+                    bounding_box.x += mouse_delta.x;
+                    bounding_box.width -= mouse_delta.x;
+                    break;
+                case OBJECT_HIT_BOTTOM_RIGHT:
+                    mouse_cursor = MOUSE_CURSOR_CROSSHAIR;
+                    bounding_box.height += mouse_delta.y;
+                    bounding_box.width += mouse_delta.x;
+                    break;
+                case OBJECT_HIT_TOP:
+                    mouse_cursor = MOUSE_CURSOR_RESIZE_NS;
+                    bounding_box.y += mouse_delta.y;
+                    bounding_box.height -= mouse_delta.y;
+                    break;
+                case OBJECT_HIT_BOTTOM:
+                    mouse_cursor = MOUSE_CURSOR_RESIZE_NS;
+                    bounding_box.height += mouse_delta.y;
+                    break;
+                case OBJECT_HIT_LEFT:
                     mouse_cursor = MOUSE_CURSOR_RESIZE_EW;
-
-                    if (is_move_down) {
-                        bounding_box.width += mouse_delta.x;
-                    }
-                } else if (CheckCollisionPointRec(mouse_pos, bounding_box)) {
+                    bounding_box.x += mouse_delta.x;
+                    bounding_box.width -= mouse_delta.x;
+                    break;
+                case OBJECT_HIT_RIGHT:
+                    mouse_cursor = MOUSE_CURSOR_RESIZE_EW;
+                    bounding_box.width += mouse_delta.x;
+                    break;
+                case OBJECT_HIT_BODY:
                     mouse_cursor = MOUSE_CURSOR_RESIZE_ALL;
-
-                    if (is_move_down) {
-                        bounding_box.x += mouse_delta.x;
-                        bounding_box.y += mouse_delta.y;
-                    }
-                } else continue;
-
-                object_set_bounding_box(object, bounding_box);
-                g->hovered_object = object - g->objects.items;
-
-                break;
+                    bounding_box.x += mouse_delta.x;
+                    bounding_box.y += mouse_delta.y;
+                    break;
+                case OBJECT_HIT_NONE:
+                case COUNT_OBJECT_HITS:
+                default: UNREACHABLE("invalid object hit");
             }
+
+            // Strokes rewrite every point when their bounding box is set, so don't do it just for hovering
+            if (is_move_down) object_set_bounding_box(&g->objects.items[index], bounding_box);
+            g->hovered_object = index;
         } break;
         case TOOL_TEXT:
-            if (IsMouseButtonPressed(MOUSE_BUTTON_TOOL)) {
+            if (input_is_mouse_button_pressed(MOUSE_BUTTON_TOOL)) {
                 Object object = {
                     .type = OBJ_TEXT,
                     .as_text = {
@@ -601,7 +3769,7 @@ void update_main_area(void) {
                         .pos = mouse_pos,
                     }
                 };
-                da_append(&g->objects, object);
+                add_object(object);
                 g->current_text_object = &g->objects.items[g->objects.count - 1];
             }
 
@@ -610,28 +3778,38 @@ void update_main_area(void) {
                 g->hovered_object = g->current_text_object - g->objects.items;
                 String_Builder *text = &g->current_text_object->as_text.text;
 
-                if (IsKeyPressed(KEY_ESCAPE)) g->tool = TOOL_MOVE;
+                if (input_is_key_pressed(KEY_ESCAPE)) g->tool = TOOL_MOVE;
 
-                if (IsKeyPressed(KEY_BACKSPACE) || IsKeyPressedRepeat(KEY_BACKSPACE)) {
-                    text->count--;
+                size_t old_count = text->count;
+                if ((input_is_key_pressed(KEY_BACKSPACE) || input_is_key_pressed_repeat(KEY_BACKSPACE)) && text->count > 0) {
+                    // Drop the whole last codepoint, not just its last byte
+                    do text->count--;
+                    while (text->count > 0 && (text->items[text->count] & 0xC0) == 0x80);
                 }
 
-                int key = GetCharPressed();
-                while (key > 0) {
-                    if (!iscntrl(key)) {
-                        da_append(text, key);
+                bool edited = text->count != old_count;
+                int codepoint = input_char_pressed();
+                while (codepoint > 0) {
+                    if (codepoint >= 0x20 && codepoint != 0x7F) {
+                        int utf8_size = 0;
+                        const char *utf8 = CodepointToUTF8(codepoint, &utf8_size);
+                        da_append_many(text, utf8, utf8_size);
+                        edited = true;
                     }
-                    key = GetCharPressed();
+                    codepoint = input_char_pressed();
+                }
+                if (edited) {
+                    text_object_invalidate_layout(g->current_text_object);
+                    object_set_name(g->current_text_object, sb_to_sv(*text));
                 }
-                object_set_name(g->current_text_object, sb_to_sv(*text));
             }
             break;
         case TOOL_RECT:
-            if (IsMouseButtonPressed(MOUSE_BUTTON_TOOL)) {
+            if (input_is_mouse_button_pressed(MOUSE_BUTTON_TOOL)) {
                 g->rect_start = mouse_pos;
             }
 
-            if (IsMouseButtonReleased(MOUSE_BUTTON_TOOL)) {
+            if (input_is_mouse_button_released(MOUSE_BUTTON_TOOL)) {
                 Object object = {
                     .type = OBJ_RECT,
                     .as_rect = {
@@ -640,173 +3818,1127 @@ void update_main_area(void) {
                     },
                 };
                 object_set_name(&object, sv_from_cstr(temp_sprintf("Rectangle (#%02hhx%02hhx%02hhx)", g->current_color.r, g->current_color.g, g->current_color.b)));
-                da_append(&g->objects, object);
+                add_object(object);
             }
             break;
         case TOOL_CHANGE_CANVAS:
-            if (IsMouseButtonPressed(MOUSE_BUTTON_TOOL)) {
+            if (input_is_mouse_button_pressed(MOUSE_BUTTON_TOOL)) {
                 g->rect_start = mouse_pos;
             }
 
-            if (IsMouseButtonReleased(MOUSE_BUTTON_TOOL)) {
-                g->canvas_bounds = get_current_rect();
-            }
-            break;
-        case TOOL_DRAW:
-            if (IsMouseButtonPressed(MOUSE_BUTTON_TOOL)) {
-                assert(g->current_stroke.items == NULL
-                    && g->current_stroke.count == 0
-                    && g->current_stroke.capacity == 0);
-                g->current_stroke.color = g->current_color;
-                g->current_stroke.weight = g->stroke_weight;
-            }
+            if (input_is_mouse_button_released(MOUSE_BUTTON_TOOL)) {
+                g->canvas_bounds = get_current_rect();
+            }
+            break;
+        case TOOL_FILL:
+        case TOOL_WAND:
+            if (input_is_mouse_button_pressed(MOUSE_BUTTON_TOOL)) {
+                g->canvas_click_pending = true;
+                g->canvas_click = mouse_pos;
+            }
+            break;
+        case TOOL_DRAW:
+            if (input_is_mouse_button_pressed(MOUSE_BUTTON_TOOL)) {
+                assert(g->current_stroke.items == NULL
+                    && g->current_stroke.count == 0
+                    && g->current_stroke.capacity == 0);
+                g->current_stroke.color = g->current_color;
+                g->current_stroke.weight = g->stroke_weight;
+                if (g->brush_stamped) {
+                    g->current_stroke.stamped = true;
+                    g->current_stroke.brush = g->brush;
+                    g->current_stroke.weight = g->brush.size;
+                }
+            }
+
+            if (input_is_mouse_button_down(MOUSE_BUTTON_TOOL)) {
+                // The stroke follows every sample of the pointer, not just where it ended up by the time of the frame,
+                // so that it stays smooth when the frame rate drops. Motion before the press isn't part of it
+                const Pointer_Samples *samples = input_pointer_samples();
+                if (input_is_mouse_button_pressed(MOUSE_BUTTON_TOOL)) {
+                    g->stroke_last_time = samples->count > 0 ? da_last(samples).time : 0;
+                }
+                if (input_is_mouse_button_pressed(MOUSE_BUTTON_TOOL) || samples->count == 0) {
+                    stroke_add_point(input_mouse_position(), g->stroke_last_time + input_frame_time());
+                } else {
+                    da_foreach(Pointer_Sample, sample, samples) stroke_add_point(sample->pos, sample->time);
+                }
+            }
+
+            if (input_is_mouse_button_released(MOUSE_BUTTON_TOOL)) {
+                if (g->paint_into_layer || g->current_stroke.stamped) {
+                    g->pending_layer_stroke = g->current_stroke;
+                } else {
+                    Object object = {
+                        .type = OBJ_STROKE,
+                        .as_stroke = g->current_stroke,
+                    };
+                    object_set_name(&object, sv_from_cstr("Stroke"));
+                    add_object(object);
+                }
+                memset(&g->current_stroke, 0, sizeof(g->current_stroke));
+            }
+            break;
+        default: UNREACHABLE("invalid tool: you have a memory corruption somewhere. good luck");
+    }
+    set_cursor(mouse_cursor);
+}
+
+void draw_stroke(Stroke stroke) {
+    if (stroke.count < 2) return;
+    for (size_t i = 0; i < stroke.count - 1; i++) {
+        Vector2 a = stroke.items[i];
+        Vector2 b = stroke.items[i+1];
+        DrawLineEx(a, b, stroke.weight, stroke.color);
+    }
+}
+
+// Adds the points of the stroke being drawn since the last frame to g->stroke_overlay, so that the cost of a frame
+// doesn't grow with the length of the stroke. Must not be called in the middle of drawing
+void stroke_overlay_update(void) {
+    const Stroke *stroke = &g->current_stroke;
+    if (stroke->count == 0) {
+        g->stroke_overlay_points = 0;
+        return;
+    }
+
+    // Starting over is the only option once the view changes under the stroke
+    bool moved = memcmp(&g->camera, &g->stroke_overlay_camera, sizeof(Camera2D)) != 0;
+    bool resized = g->stroke_overlay.texture.width != input_screen_width() || g->stroke_overlay.texture.height != input_screen_height();
+    if (g->stroke_overlay_points == 0 || moved || resized) {
+        ensure_render_texture(&g->stroke_overlay, input_screen_width(), input_screen_height());
+        TextureMode(g->stroke_overlay) ClearBackground(BLANK);
+        g->stroke_overlay_points = 0;
+        g->stroke_overlay_walker = (Dab_Walker) {0};
+        g->stroke_overlay_camera = g->camera;
+    }
+    if (stroke->count == g->stroke_overlay_points) return;
+
+    TextureMode(g->stroke_overlay) Mode2D(g->stroke_overlay_camera) {
+        if (stroke->stamped) {
+            // Stacking up with MAX blending doesn't care about the order, so rendering the new dabs on top of the old
+            // ones gives the same overlay as rendering them all at once
+            Brush_Renderer *renderer = &g->brush_renderer;
+            renderer->dabs.count = 0;
+            brush_walk_dabs(stroke, &g->stroke_overlay_walker, &renderer->dabs);
+            rlSetBlendFactors(RL_ONE, RL_ONE, RL_MAX);
+            BlendMode(BLEND_CUSTOM) brush_draw_dabs(renderer, &renderer->dabs, stroke->color, stroke->brush.hardness);
+        } else {
+            // The segments from the last point that's already in the overlay on
+            size_t first = g->stroke_overlay_points > 0 ? g->stroke_overlay_points - 1 : 0;
+            Stroke segments = *stroke;
+            segments.items += first;
+            segments.count -= first;
+            set_premultiplying_blend_factors();
+            BlendMode(BLEND_CUSTOM_SEPARATE) {
+                shape_batch_push_stroke(&g->shape_batch, segments);
+                shape_batch_flush(&g->shape_batch);
+            }
+        }
+    }
+    g->stroke_overlay_points = stroke->count;
+    g->stroke_overlay_opacity = stroke->stamped ? stroke->brush.opacity : 1;
+}
+
+// Composites g->stroke_overlay over whatever was drawn with the current camera. Also shows a stroke that was just
+// finished until it gets painted into its layer at the start of the next frame
+void draw_stroke_overlay(void) {
+    if (g->current_stroke.count == 0 && g->pending_layer_stroke.count == 0) return;
+
+    if (g->stroke_overlay_points > 0) {
+        Texture texture = g->stroke_overlay.texture;
+        Camera2D camera = g->stroke_overlay_camera;
+        // Where the overlay was rendered, in case the camera moved since
+        Vector2 top_left = GetScreenToWorld2D(Vector2Zero(), camera);
+        Rectangle source = { 0, 0, texture.width, -texture.height };
+        Rectangle dest = { top_left.x, top_left.y, texture.width / camera.zoom, texture.height / camera.zoom };
+        BlendMode(BLEND_ALPHA_PREMULTIPLY) {
+            DrawTexturePro(texture, source, dest, Vector2Zero(), 0.0f, premultiplied_opacity(g->stroke_overlay_opacity));
+        }
+    }
+
+    // Lines that were added in this frame, after the overlay got updated
+    Stroke segments = g->current_stroke;
+    size_t first = g->stroke_overlay_points > 0 ? g->stroke_overlay_points - 1 : 0;
+    if (!segments.stamped && segments.count > g->stroke_overlay_points) {
+        segments.items += first;
+        segments.count -= first;
+        draw_stroke(segments);
+    }
+}
+
+void draw_scene(void) {
+    Shape_Batch *batch = &g->shape_batch;
+    // Consecutive text objects share the SDF shader, and hence a single batch
+    bool in_sdf_shader = false;
+    da_foreach(Object, object, &g->objects) {
+        static_assert(COUNT_OBJS == 5, "Exhaustive handling of object types in draw_scene");
+        // Keep accumulating shapes until something else needs to be drawn on top of them
+        if (object->type != OBJ_RECT && object->type != OBJ_STROKE) shape_batch_flush(batch);
+        if (object->type != OBJ_TEXT && in_sdf_shader) {
+            EndShaderMode();
+            in_sdf_shader = false;
+        }
+        switch (object->type) {
+            case OBJ_TEXTURE: {
+                // Consecutive images from the same atlas page end up in the same batch
+                Texture texture;
+                Rectangle source;
+                if (object->as_texture.in_atlas) {
+                    Atlas_Slot slot = g->atlas.slots.items[object->as_texture.atlas_slot];
+                    texture = g->atlas.pages.items[slot.page].texture;
+                    source = slot.rec;
+                } else {
+                    texture = object->as_texture.texture;
+                    source = (Rectangle) { 0, 0, texture.width, texture.height };
+                }
+                if (object->as_texture.filtered.id != 0) {
+                    texture = object->as_texture.filtered.texture;
+                    // Render textures are upside down
+                    source = (Rectangle) { 0, 0, texture.width, -texture.height };
+                }
+                DrawTexturePro(texture, source, object->as_texture.rec, Vector2Zero(), 0.0f, WHITE);
+            } break;
+            case OBJ_RECT: {
+                shape_batch_push_rect(batch, object->as_rect.rec, object->as_rect.color);
+            } break;
+            case OBJ_STROKE: {
+                shape_batch_push_stroke(batch, object->as_stroke);
+            } break;
+            case OBJ_TEXT: {
+                if (!in_sdf_shader) {
+                    BeginShaderMode(g->sdf_shader);
+                    in_sdf_shader = true;
+                }
+                Vector2 pos = object->as_text.pos;
+                Glyph_Pages *pages = &g->glyph_cache.pages;
+                da_foreach(Glyph_Quad, quad, &text_object_get_layout(object)->quads) {
+                    Glyph_Page *page = &pages->items[quad->page];
+                    page->last_used_frame = g->glyph_cache.frame;
+                    Rectangle dest = { pos.x + quad->dest.x, pos.y + quad->dest.y, quad->dest.width, quad->dest.height };
+                    DrawTexturePro(page->texture, quad->source, dest, Vector2Zero(), 0.0f, object->as_text.color);
+                }
+            } break;
+            case OBJ_LAYER: {
+                // One quad per painted tile, no matter how many strokes went into it
+                BlendMode(BLEND_ALPHA_PREMULTIPLY) {
+                    da_foreach(Layer_Tile, tile, &object->as_layer.tiles) {
+                        // Render textures are upside down
+                        Rectangle source = { 0, 0, LAYER_TILE_SIZE, -LAYER_TILE_SIZE };
+                        DrawTexturePro(tile->texture.texture, source, layer_tile_rect(object, tile), Vector2Zero(), 0.0f, WHITE);
+                    }
+                }
+            } break;
+            case COUNT_OBJS:
+            default: UNREACHABLE("invalid object type: you have a memory corruption somewhere. good luck");
+        }
+    }
+    shape_batch_flush(batch);
+    if (in_sdf_shader) EndShaderMode();
+}
+
+// The layer strokes get painted into, added on top of everything if there is none
+Object *paint_layer(void) {
+    da_foreach(Object, object, &g->objects) {
+        if (object->id == g->paint_layer_id && object->type == OBJ_LAYER) return object;
+    }
+    Object object = {
+        .type = OBJ_LAYER,
+        .as_layer.origin = { g->canvas_bounds.x, g->canvas_bounds.y },
+    };
+    object_set_name(&object, sv_from_cstr("Paint layer"));
+    add_object(object);
+    g->paint_layer_id = da_last(&g->objects).id;
+    return &da_last(&g->objects);
+}
+
+Layer_Tile *layer_get_tile(Object *layer, int x, int y) {
+    assert(layer->type == OBJ_LAYER);
+    // A canvas of a sane size has a few dozen tiles, so a linear search is fine
+    da_foreach(Layer_Tile, tile, &layer->as_layer.tiles) {
+        if (tile->x == x && tile->y == y) return tile;
+    }
+    Layer_Tile tile = { x, y, LoadRenderTexture(LAYER_TILE_SIZE, LAYER_TILE_SIZE) };
+    TextureMode(tile.texture) ClearBackground(BLANK);
+    da_append(&layer->as_layer.tiles, tile);
+    return &da_last(&layer->as_layer.tiles);
+}
+
+// Whether the segment from a to b crosses `rec` or starts or ends inside it
+bool segment_intersects_rect(Vector2 a, Vector2 b, Rectangle rec) {
+    // Clips the parameter range of the segment against both slabs of the rectangle
+    float t0 = 0, t1 = 1;
+    float starts[2] = { a.x, a.y };
+    float deltas[2] = { b.x - a.x, b.y - a.y };
+    float mins[2] = { rec.x, rec.y };
+    float maxs[2] = { rec.x + rec.width, rec.y + rec.height };
+    for (int axis = 0; axis < 2; axis++) {
+        if (deltas[axis] == 0) {
+            if (starts[axis] < mins[axis] || starts[axis] > maxs[axis]) return false;
+            continue;
+        }
+        float near = (mins[axis] - starts[axis]) / deltas[axis];
+        float far = (maxs[axis] - starts[axis]) / deltas[axis];
+        if (near > far) {
+            float t = near;
+            near = far;
+            far = t;
+        }
+        if (near > t0) t0 = near;
+        if (far < t1) t1 = far;
+        if (t0 > t1) return false;
+    }
+    return true;
+}
+
+// A tile of a layer, and the part of a stroke that lands on it: segments of a line, dabs of a brush
+typedef struct {
+    int x, y;
+    Shape_Instances segments;
+    Dabs dabs;
+} Stroke_Tile;
+
+typedef struct {
+    Stroke_Tile *items;
+    size_t count, capacity;
+} Stroke_Tiles;
+
+Stroke_Tile *stroke_tile(Stroke_Tiles *tiles, int x, int y) {
+    // Consecutive segments and dabs mostly land on the same tile as the one before
+    for (size_t i = tiles->count; i > 0; i--) {
+        if (tiles->items[i - 1].x == x && tiles->items[i - 1].y == y) return &tiles->items[i - 1];
+    }
+    da_append(tiles, ((Stroke_Tile) { .x = x, .y = y }));
+    return &da_last(tiles);
+}
+
+// Sorts the segments of the stroke into the tiles of the layer they come within `margin` of. A long diagonal stroke
+// only touches the tiles along it, not every tile of its bounding box
+void stroke_split_into_tiles(const Object *layer, Stroke stroke, float margin, Stroke_Tiles *tiles) {
+    Vector2 origin = layer->as_layer.origin;
+    for (size_t i = 0; i + 1 < stroke.count; i++) {
+        Shape_Instance segment = {
+            .a = stroke.items[i],
+            .b = stroke.items[i + 1],
+            .weight = stroke.weight,
+            .color = stroke.color,
+        };
+        Vector2 min = Vector2Min(segment.a, segment.b);
+        Vector2 max = Vector2Max(segment.a, segment.b);
+        int first_x = floorf((min.x - margin - origin.x) / LAYER_TILE_SIZE);
+        int first_y = floorf((min.y - margin - origin.y) / LAYER_TILE_SIZE);
+        int last_x = floorf((max.x + margin - origin.x) / LAYER_TILE_SIZE);
+        int last_y = floorf((max.y + margin - origin.y) / LAYER_TILE_SIZE);
+        for (int y = first_y; y <= last_y; y++) {
+            for (int x = first_x; x <= last_x; x++) {
+                Rectangle near = {
+                    origin.x + x * LAYER_TILE_SIZE - margin, origin.y + y * LAYER_TILE_SIZE - margin,
+                    LAYER_TILE_SIZE + 2 * margin, LAYER_TILE_SIZE + 2 * margin,
+                };
+                if (!segment_intersects_rect(segment.a, segment.b, near)) continue;
+                da_append(&stroke_tile(tiles, x, y)->segments, segment);
+            }
+        }
+    }
+}
+
+// Sorts dabs into the tiles of the layer that their discs overlap, so that every tile renders only its own dabs
+// instead of all of them
+void dabs_split_into_tiles(const Object *layer, const Dabs *dabs, Stroke_Tiles *tiles) {
+    Vector2 origin = layer->as_layer.origin;
+    da_foreach(Dab, dab, dabs) {
+        // A pixel more for the edge of the texture to be sampled right
+        float radius = dab->size / 2 + 1;
+        int first_x = floorf((dab->center.x - radius - origin.x) / LAYER_TILE_SIZE);
+        int first_y = floorf((dab->center.y - radius - origin.y) / LAYER_TILE_SIZE);
+        int last_x = floorf((dab->center.x + radius - origin.x) / LAYER_TILE_SIZE);
+        int last_y = floorf((dab->center.y + radius - origin.y) / LAYER_TILE_SIZE);
+        for (int y = first_y; y <= last_y; y++) {
+            for (int x = first_x; x <= last_x; x++) {
+                Rectangle rec = { origin.x + x * LAYER_TILE_SIZE, origin.y + y * LAYER_TILE_SIZE, LAYER_TILE_SIZE, LAYER_TILE_SIZE };
+                if (!CheckCollisionCircleRec(dab->center, radius, rec)) continue;
+                da_append(&stroke_tile(tiles, x, y)->dabs, *dab);
+            }
+        }
+    }
+}
+
+// Rasterizes the stroke into every tile it touches, allocating the ones that don't exist yet. Must not be called in
+// the middle of drawing
+void layer_paint_stroke(Object *layer, Stroke stroke) {
+    assert(layer->type == OBJ_LAYER);
+    // A brush leaves a dab at a single point, a line needs two
+    if (stroke.count < (stroke.stamped ? 1 : 2)) return;
+
+    Stroke_Tiles tiles = {0};
+    if (stroke.stamped) {
+        Dabs *dabs = &g->brush_renderer.dabs;
+        dabs->count = 0;
+        Dab_Walker walker = {0};
+        brush_walk_dabs(&stroke, &walker, dabs);
+        dabs_split_into_tiles(layer, dabs, &tiles);
+    } else {
+        stroke_split_into_tiles(layer, stroke, stroke.weight / 2 + 1, &tiles);
+    }
+
+    TraceZone("Paint stroke") da_foreach(Stroke_Tile, part, &tiles) {
+        Layer_Tile *tile = layer_get_tile(layer, part->x, part->y);
+        Rectangle rec = layer_tile_rect(layer, tile);
+        Camera2D camera = { .zoom = 1.0f, .offset = { -rec.x, -rec.y } };
+        if (stroke.stamped) {
+            RenderTexture *scratch = &g->brush_renderer.scratch;
+            ensure_render_texture(scratch, LAYER_TILE_SIZE, LAYER_TILE_SIZE);
+            brush_render_dabs(&stroke, &part->dabs, *scratch, camera);
+            TextureMode(tile->texture) BlendMode(BLEND_ALPHA_PREMULTIPLY) {
+                Rectangle source = { 0, 0, LAYER_TILE_SIZE, -LAYER_TILE_SIZE };
+                Rectangle dest = { 0, 0, LAYER_TILE_SIZE, LAYER_TILE_SIZE };
+                DrawTexturePro(scratch->texture, source, dest, Vector2Zero(), 0.0f, premultiplied_opacity(stroke.brush.opacity));
+            }
+            continue;
+        }
+        set_premultiplying_blend_factors();
+        TextureMode(tile->texture) BlendMode(BLEND_CUSTOM_SEPARATE) Mode2D(camera) {
+            da_append_many(&g->shape_batch.instances, part->segments.items, part->segments.count);
+            shape_batch_flush(&g->shape_batch);
+        }
+    }
+
+    da_foreach(Stroke_Tile, part, &tiles) {
+        da_free(part->segments);
+        da_free(part->dabs);
+    }
+    da_free(tiles);
+}
+
+// The pixels the image object shows now. Loads the original again if it came from a file, so that resampling over and
+// over doesn't keep blurring it
+Image object_load_image(const Object *object) {
+    assert(object->type == OBJ_TEXTURE);
+    if (object->as_texture.source_path != NULL) {
+        Image image = LoadImage(object->as_texture.source_path);
+        if (image.data != NULL) return image;
+    }
+    if (object->as_texture.in_atlas) {
+        Atlas_Slot slot = g->atlas.slots.items[object->as_texture.atlas_slot];
+        return ImageFromImage(g->atlas.pages.items[slot.page].image, slot.rec);
+    }
+    return LoadImageFromTexture(object->as_texture.texture);
+}
+
+// On-canvas size of an image, which is also the resolution it gets exported at
+Vector2 object_displayed_size(const Object *object) {
+    Rectangle rec = object->as_texture.rec;
+    return (Vector2) { fmaxf(ceilf(fabsf(rec.width)), 1), fmaxf(ceilf(fabsf(rec.height)), 1) };
+}
+
+// Suggest resampling images with this many times more pixels than they are displayed with
+#define RESAMPLE_SUGGEST_FACTOR 4
+
+bool object_should_resample(const Object *object) {
+    if (object->type != OBJ_TEXTURE) return false;
+    Vector2 image = object_image_size(object);
+    Vector2 displayed = object_displayed_size(object);
+    return image.x * image.y >= RESAMPLE_SUGGEST_FACTOR * displayed.x * displayed.y;
+}
+
+// Replaces the image of an object with one of `width` x `height`. Drawing it at that size then needs no filtering
+// on the GPU, and the texture takes up a lot less memory
+void object_resample(Object *object, int width, int height, Resize_Filter filter) {
+    double trace_start = trace_zone_begin();
+    Image image = object_load_image(object);
+    if (image.data == NULL) return;
+    bool original = image.width == width && image.height == height;
+    if (!original) image_resample(&image, width, height, filter);
+    object_release_image(object);
+    object_set_image(object, image);
+    object->as_texture.resampled = !original;
+    object->as_texture.filtered_dirty = true;
+    trace_zone_end("object_resample()", trace_start);
+}
+
+// Undoes object_resample(), for when the image got enlarged again afterwards
+void object_restore_original(Object *object) {
+    assert(object->as_texture.source_path != NULL);
+    Image image = LoadImage(object->as_texture.source_path);
+    if (image.data == NULL) return;
+    object_release_image(object);
+    object_set_image(object, image);
+    object->as_texture.resampled = false;
+    object->as_texture.filtered_dirty = true;
+}
+
+// Takes ownership of `image`
+void add_image_object_from_image(Image image, String_View name) {
+    Object object = {
+        .type = OBJ_TEXTURE,
+        .as_texture = {
+            .rec = { 0, 0, image.width, image.height },
+        },
+    };
+    object_set_image(&object, image);
+    object_set_name(&object, name);
+    add_object(object);
+}
+
+void add_image_object(const char *path) {
+    double trace_start = trace_zone_begin();
+    String_View path_sv = sv_from_cstr(path);
+    assert(path_sv.count > 0);
+    int i;
+    for (i = path_sv.count - 1; i >= 0; i--) {
+        if (
+            path_sv.data[i] == '/'
+            #ifdef _WIN32
+            || path_sv.data[i] == '\\'
+            #endif
+        ) {
+            break;
+        }
+    }
+    i++;
+    path_sv = sv_from_parts(path_sv.data + i, path_sv.count - i);
+    add_image_object_from_image(LoadImage(path), path_sv);
+    Object *object = &da_last(&g->objects);
+    object->as_texture.source_path = malloc(strlen(path) + 1);
+    strcpy(object->as_texture.source_path, path);
+    trace_zone_end("add_image_object()", trace_start);
+}
+
+// Gives resampled images their original files back for the duration of an export. Returns copies of them as they
+// were, to put back with export_swap_out_originals()
+Objects export_swap_in_originals(void) {
+    Objects saved = {0};
+    da_foreach(Object, object, &g->objects) {
+        if (object->type != OBJ_TEXTURE || !object->as_texture.resampled || object->as_texture.source_path == NULL) continue;
+        Texture original = LoadTexture(object->as_texture.source_path);
+        if (original.id == 0) continue;
+        da_append(&saved, *object);
+        object->as_texture.in_atlas = false;
+        object->as_texture.texture = original;
+        object->as_texture.filtered = (RenderTexture) {0};
+        object->as_texture.filtered_dirty = true;
+    }
+    return saved;
+}
+
+void export_swap_out_originals(Objects saved) {
+    size_t next = 0;
+    da_foreach(Object, object, &g->objects) {
+        if (next >= saved.count) break;
+        if (object->id != saved.items[next].id) continue;
+        UnloadTexture(object->as_texture.texture);
+        if (object->as_texture.filtered.id != 0) UnloadRenderTexture(object->as_texture.filtered);
+        object->as_texture = saved.items[next].as_texture;
+        next++;
+    }
+    da_free(saved);
+}
+
+RenderTexture export_image_to_render_texture(void) {
+    Objects originals = {0};
+    if (g->export_originals) originals = export_swap_in_originals();
+    apply_all_filters();
+
+    Camera2D camera = {
+        .zoom = 1.0f,
+        .offset = {-g->canvas_bounds.x, -g->canvas_bounds.y},
+    };
+
+    int width = g->canvas_bounds.width;
+    int height = g->canvas_bounds.height;
+
+    RenderTexture rtex_flipped = load_render_texture_with_pixel_format(width, height, PIXELFORMAT_UNCOMPRESSED_R8G8B8);
+    TraceZone("Render export") TextureMode(rtex_flipped) Mode2D(camera) {
+        draw_scene();
+    }
+    RenderTexture rtex_nflipped = LoadRenderTexture(width, height);
+    if (g->export_blur_radius > 0) {
+        // Flips it on the way as well
+        blur_texture(rtex_flipped.texture, (Rectangle) { 0, 0, width, height }, rtex_nflipped, g->export_blur_radius);
+    } else {
+        // flip texture
+        TextureMode(rtex_nflipped) {
+            DrawTexture(rtex_flipped.texture, 0, 0, WHITE);
+        }
+    }
+    if (g->export_originals) export_swap_out_originals(originals);
+
+    UnloadRenderTexture(rtex_flipped);
+    return rtex_nflipped;
+}
+
+// What `area` of the scene looks like right now, as an RGBA8 image of its size with the bottom row first, which is how
+// render textures read back. Must not be called in the middle of drawing
+Image scene_snapshot_upside_down(Rectangle area) {
+    apply_all_filters();
+    Camera2D camera = {
+        .zoom = 1.0f,
+        .offset = {-area.x, -area.y},
+    };
+    RenderTexture rtex = LoadRenderTexture(area.width, area.height);
+    TextureMode(rtex) {
+        // Same as the background of exported images
+        ClearBackground(BLACK);
+        Mode2D(camera) draw_scene();
+    }
+    Image image = LoadImageFromTexture(rtex.texture);
+    UnloadRenderTexture(rtex);
+    return image;
+}
+
+// Same as scene_snapshot_upside_down(), but the right way up
+Image scene_snapshot(Rectangle area) {
+    Image image = scene_snapshot_upside_down(area);
+    kernel_flip_vertical(image.data, (size_t)image.width * 4, image.height);
+    return image;
+}
+
+// Rows of a flood fill are bitmasks of the pixels that can still be filled, 64 to a word. Noise splits rows into
+// runs of a pixel or two, and finding either end of one then takes a single word most of the time instead of a loop
+// over bytes. A 12 MP canvas also only needs 1.5 MB of them
+#define FILL_WORD_BITS 64
+
+// First index in [from, to) of a set bit, or `to` if there's none. Finds clear bits instead with `flip` all ones
+static inline size_t find_bit(const uint64_t *bits, size_t from, size_t to, uint64_t flip) {
+    if (from >= to) return to;
+    size_t i = from / FILL_WORD_BITS;
+    uint64_t word = (bits[i] ^ flip) & (~0ull << (from % FILL_WORD_BITS));
+    while (word == 0) {
+        if (++i * FILL_WORD_BITS >= to) return to;
+        word = bits[i] ^ flip;
+    }
+    size_t found = i * FILL_WORD_BITS + __builtin_ctzll(word);
+    return found < to ? found : to;
+}
+
+// One past the last index in [from, to) of a clear bit, or `from` if there's none
+static inline size_t find_clear_bit_before(const uint64_t *bits, size_t from, size_t to) {
+    if (from >= to) return from;
+    size_t i = (to - 1) / FILL_WORD_BITS;
+    size_t used = to - i * FILL_WORD_BITS;
+    uint64_t word = ~bits[i] & (used == FILL_WORD_BITS ? ~0ull : (1ull << used) - 1);
+    while (word == 0) {
+        if (i * FILL_WORD_BITS <= from) return from;
+        word = ~bits[--i];
+    }
+    size_t found = i * FILL_WORD_BITS + (FILL_WORD_BITS - __builtin_clzll(word));
+    return found > from ? found : from;
+}
+
+static inline void clear_bits(uint64_t *bits, size_t from, size_t to) {
+    for (size_t i = from / FILL_WORD_BITS; i * FILL_WORD_BITS < to; i++) {
+        uint64_t mask = ~0ull;
+        if (i == from / FILL_WORD_BITS) mask &= ~0ull << (from % FILL_WORD_BITS);
+        if ((i + 1) * FILL_WORD_BITS > to) mask &= ~0ull >> ((i + 1) * FILL_WORD_BITS - to);
+        bits[i] &= ~mask;
+    }
+}
+
+// Pixels [start, end) of row y
+typedef struct {
+    int y, start, end;
+} Fill_Span;
+
+typedef struct {
+    Fill_Span *items;
+    size_t count, capacity;
+} Fill_Spans;
+
+// A filled span, of which the pixels right next to it in row y + dy are still to be looked at
+typedef struct {
+    Fill_Span span;
+    int dy;
+} Fill_Seed;
+
+typedef struct {
+    Fill_Seed *items;
+    size_t count, capacity;
+} Fill_Seeds;
+
+typedef struct {
+    Image image;
+    uint8_t color[4];
+    uint8_t tolerance;
+    // One bit per pixel that is still to be filled, `row_words` words per row
+    uint64_t *fillable;
+    size_t row_words;
+    bool *row_matched;
+    // Byte mask of one row as match_color() writes it, zeros past the end of the row
+    uint8_t *matches;
+    Fill_Spans *spans;
+    Fill_Seeds seeds;
+    int min_x, max_x, min_y, max_y;
+} Flood_Fill;
+
+// Row `y` of `fillable`, comparing it against the color the first time it's needed
+uint64_t *flood_fill_row(Flood_Fill *fill, int y) {
+    size_t width = fill->image.width;
+    uint64_t *row = &fill->fillable[y * fill->row_words];
+    if (!fill->row_matched[y]) {
+        kernels.match_color((const uint8_t*)fill->image.data + y * width * 4, width, fill->color, fill->tolerance, fill->matches);
+        // The top bit of each of 8 bytes, gathered into the top byte by the multiplication. Bytes of a word are in
+        // little endian order, like on every platform this builds for
+        for (size_t i = 0; i < fill->row_words * sizeof(uint64_t); i++) {
+            uint64_t bytes;
+            memcpy(&bytes, &fill->matches[i * 8], sizeof(bytes));
+            ((uint8_t*)row)[i] = ((bytes & 0x8080808080808080ull) * 0x0002040810204081ull) >> 56;
+        }
+        fill->row_matched[y] = true;
+    }
+    return row;
+}
+
+// Fills the whole run of fillable pixels in row y around x and appends it to the spans. Whatever is next to it in
+// row y + dy has to be looked at. Row y - dy only has to be where the run sticks out past [from, to), which is the
+// span it was found from, since the rest of that is filled already
+void flood_fill_run(Flood_Fill *fill, uint64_t *row, int y, size_t x, int dy, size_t from, size_t to) {
+    size_t left = find_clear_bit_before(row, 0, x);
+    size_t right = find_bit(row, x, fill->image.width, ~0ull);
+    clear_bits(row, left, right);
+    Fill_Span span = { y, left, right };
+    da_append(fill->spans, span);
+    if ((int)left < fill->min_x) fill->min_x = left;
+    if ((int)right - 1 > fill->max_x) fill->max_x = right - 1;
+    if (y < fill->min_y) fill->min_y = y;
+    if (y > fill->max_y) fill->max_y = y;
+
+    da_append(&fill->seeds, ((Fill_Seed) { span, dy }));
+    if (left < from) da_append(&fill->seeds, ((Fill_Seed) { { y, left, from }, -dy }));
+    if (right > to) da_append(&fill->seeds, ((Fill_Seed) { { y, to, right }, -dy }));
+}
+
+// Scanline flood fill of the pixels around (x, y) that are within `tolerance` of its color. Appends them to `spans`
+// (disjoint, but in no particular order and not necessarily merged with their neighbours) and returns their bounding box.
+// Rows get compared against the color with SIMD only once the fill reaches them. Every run of fillable pixels gets
+// filled once, as soon as it's found, and the rows next to it are only looked at where they haven't been from the
+// other side already. So even noise with millions of tiny runs takes not much more than going over every row twice
+Rectangle flood_fill_spans(Image image, int x, int y, uint8_t tolerance, Fill_Spans *spans) {
+    assert(image.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+    assert(0 <= x && x < image.width && 0 <= y && y < image.height);
+    size_t row_words = (image.width + FILL_WORD_BITS - 1) / FILL_WORD_BITS;
+    Flood_Fill fill = {
+        .image = image,
+        .tolerance = tolerance,
+        .fillable = malloc(row_words * image.height * sizeof(uint64_t)),
+        .row_words = row_words,
+        .row_matched = calloc(image.height, sizeof(bool)),
+        .matches = calloc(row_words, FILL_WORD_BITS),
+        .spans = spans,
+        .min_x = x, .max_x = x, .min_y = y, .max_y = y,
+    };
+    memcpy(fill.color, (const uint8_t*)image.data + ((size_t)y * image.width + x) * 4, sizeof(fill.color));
+
+    uint64_t *row = flood_fill_row(&fill, y);
+    // Both ways from the first run, which sticks out past nothing
+    flood_fill_run(&fill, row, y, x, 1, 0, image.width);
+    da_append(&fill.seeds, ((Fill_Seed) { da_last(spans), -1 }));
+
+    // First in, first out, so that only about the edge of what's filled so far is waiting. Going depth first left
+    // millions of seeds on the stack in noise
+    size_t next_seed = 0;
+    while (next_seed < fill.seeds.count) {
+        Fill_Seed seed = fill.seeds.items[next_seed++];
+        // Reuse the space of the seeds that are done once they're most of the queue
+        if (next_seed >= 4096 && next_seed * 2 >= fill.seeds.count) {
+            memmove(fill.seeds.items, &fill.seeds.items[next_seed], (fill.seeds.count - next_seed) * sizeof(Fill_Seed));
+            fill.seeds.count -= next_seed;
+            next_seed = 0;
+        }
+        int ny = seed.span.y + seed.dy;
+        if (ny < 0 || ny >= image.height) continue;
+        row = flood_fill_row(&fill, ny);
+        size_t nx = find_bit(row, seed.span.start, seed.span.end, 0);
+        while (nx < (size_t)seed.span.end) {
+            flood_fill_run(&fill, row, ny, nx, seed.dy, seed.span.start, seed.span.end);
+            // The run is cleared now
+            nx = find_bit(row, nx, seed.span.end, 0);
+        }
+    }
+
+    da_free(fill.seeds);
+    free(fill.matches);
+    free(fill.row_matched);
+    free(fill.fillable);
+    return (Rectangle) { fill.min_x, fill.min_y, fill.max_x - fill.min_x + 1, fill.max_y - fill.min_y + 1 };
+}
 
-            if (IsMouseButtonDown(MOUSE_BUTTON_TOOL)) {
-                da_append(&g->current_stroke, mouse_pos);
-            }
+// Flood fill of the canvas around (x, y), in pixels from its top left corner, with g->color_tolerance. Fills the
+// snapshot as it reads back and turns only the spans the right way up, which is a lot less to flip than every pixel
+Rectangle flood_fill_canvas(int x, int y, Fill_Spans *spans) {
+    Image snapshot = scene_snapshot_upside_down(g->canvas_bounds);
+    int height = snapshot.height;
+    Rectangle bounds = flood_fill_spans(snapshot, x, height - 1 - y, g->color_tolerance, spans);
+    UnloadImage(snapshot);
+    da_foreach(Fill_Span, span, spans) span->y = height - 1 - span->y;
+    bounds.y = height - bounds.y - bounds.height;
+    return bounds;
+}
 
-            if (IsMouseButtonReleased(MOUSE_BUTTON_TOOL)) {
-                Object object = {
-                    .type = OBJ_STROKE,
-                    .as_stroke = g->current_stroke,
-                };
-                object_set_name(&object, sv_from_cstr("Stroke"));
-                da_append(&g->objects, object);
-                memset(&g->current_stroke, 0, sizeof(g->current_stroke));
-            }
-            break;
-        default: UNREACHABLE("invalid tool: you have a memory corruption somewhere. good luck");
+// Adds an image object of the current color, shaped like the region of the canvas around `point` that is about the
+// same color
+void bucket_fill(Vector2 point) {
+    int x = point.x - g->canvas_bounds.x;
+    int y = point.y - g->canvas_bounds.y;
+    if (x < 0 || y < 0 || x >= (int)g->canvas_bounds.width || y >= (int)g->canvas_bounds.height) return;
+
+    TraceZone("Bucket fill") {
+        Fill_Spans spans = {0};
+        Rectangle bounds = flood_fill_canvas(x, y, &spans);
+
+        Image fill = GenImageColor(bounds.width, bounds.height, BLANK);
+        Color *fill_pixels = fill.data;
+        da_foreach(Fill_Span, span, &spans) {
+            Color *row = &fill_pixels[(span->y - (int)bounds.y) * (int)bounds.width];
+            for (int column = span->start; column < span->end; column++) row[column - (int)bounds.x] = g->current_color;
+        }
+        da_free(spans);
+
+        Color c = g->current_color;
+        add_image_object_from_image(fill, sv_from_cstr(temp_sprintf("Fill (#%02hhx%02hhx%02hhx)", c.r, c.g, c.b)));
+        Object *object = &da_last(&g->objects);
+        object->as_texture.rec.x = g->canvas_bounds.x + bounds.x;
+        object->as_texture.rec.y = g->canvas_bounds.y + bounds.y;
     }
-    set_cursor(mouse_cursor);
 }
 
-void draw_stroke(Stroke stroke) {
-    if (stroke.count < 2) return;
-    for (size_t i = 0; i < stroke.count - 1; i++) {
-        Vector2 a = stroke.items[i];
-        Vector2 b = stroke.items[i+1];
-        DrawLineEx(a, b, stroke.weight, stroke.color);
+const char *selection_op_as_cstr(Selection_Op op) {
+    static_assert(COUNT_SELECTION_OPS == 4, "Please update after adding a new selection op");
+    switch (op) {
+        case SELECTION_REPLACE: return "Replace";
+        case SELECTION_ADD: return "Add";
+        case SELECTION_SUBTRACT: return "Subtract";
+        case SELECTION_INTERSECT: return "Intersect";
+        default: UNREACHABLE("invalid selection op");
     }
 }
 
-void draw_scene(void) {
-    da_foreach(Object, object, &g->objects) {
-        static_assert(COUNT_OBJS == 4, "Exhaustive handling of object types in draw_scene");
-        switch (object->type) {
-            case OBJ_TEXTURE: {
-                Texture texture = object->as_texture.texture;
-                Rectangle source = { 0, 0, texture.width, texture.height };
-                DrawTexturePro(texture, source, object->as_texture.rec, Vector2Zero(), 0.0f, WHITE);
-            } break;
-            case OBJ_RECT: {
-                DrawRectangleRec(object->as_rect.rec, object->as_rect.color);
-            } break;
-            case OBJ_STROKE: {
-                draw_stroke(object->as_stroke);
-            } break;
-            case OBJ_TEXT: {
-                sb_append_null(&object->as_text.text);
-                DrawTextEx(g->font,
-                           object->as_text.text.items,
-                           object->as_text.pos,
-                           object->as_text.size,
-                           1.0f,
-                           object->as_text.color);
-                object->as_text.text.count--;
-            } break;
-            case COUNT_OBJS:
-            default: UNREACHABLE("invalid object type: you have a memory corruption somewhere. good luck");
+// Bit (in_a << 1 | in_b) tells whether a pixel is in the result of combining a with b
+uint8_t selection_op_truth_table(Selection_Op op) {
+    static_assert(COUNT_SELECTION_OPS == 4, "Exhaustive handling of selection ops in selection_op_truth_table");
+    switch (op) {
+        case SELECTION_REPLACE: return 0xA;
+        case SELECTION_ADD: return 0xE;
+        case SELECTION_SUBTRACT: return 0x4;
+        case SELECTION_INTERSECT: return 0x8;
+        default: UNREACHABLE("invalid selection op");
+    }
+}
+// Pixels in exactly one of a and b, which is where the outline goes between two rows
+#define SELECTION_XOR_TRUTH_TABLE 0x6
+
+// Appends a run to the row that starts at `row_start` in `runs`, merging it with the last one if they touch
+void selection_runs_append(Selection_Runs *runs, size_t row_start, int start, int end) {
+    if (runs->count > row_start && da_last(runs).end >= start) {
+        if (end > da_last(runs).end) da_last(runs).end = end;
+        return;
+    }
+    da_append(runs, ((Selection_Run) { start, end }));
+}
+
+// Appends the runs of a row combined with another one to `out`, walking both at once from one run boundary to the next
+void selection_runs_combine(const Selection_Run *a, size_t a_count, const Selection_Run *b, size_t b_count, uint8_t truth_table, Selection_Runs *out) {
+    size_t row_start = out->count;
+    size_t i = 0, j = 0;
+    bool in_a = false, in_b = false, inside = false;
+    int start = 0;
+    while (i < a_count || j < b_count) {
+        int a_next = i < a_count ? (in_a ? a[i].end : a[i].start) : INT_MAX;
+        int b_next = j < b_count ? (in_b ? b[j].end : b[j].start) : INT_MAX;
+        int x = a_next < b_next ? a_next : b_next;
+        if (a_next == x) {
+            if (in_a) i++;
+            in_a = !in_a;
         }
+        if (b_next == x) {
+            if (in_b) j++;
+            in_b = !in_b;
+        }
+        bool now_inside = (truth_table >> (in_a << 1 | in_b)) & 1;
+        if (now_inside && !inside) start = x;
+        if (!now_inside && inside) selection_runs_append(out, row_start, start, x);
+        inside = now_inside;
     }
 }
 
-void add_image_object(const char *path) {
-    Texture texture = LoadTexture(path);
-    Object object = {
-        .as_texture = {
-            .rec = { 0, 0, texture.width, texture.height },
-            .texture = texture,
-        },
+const Selection_Run *selection_row(const Selection *selection, int y, size_t *count) {
+    assert(0 <= y && y < selection->height);
+    *count = selection->row_starts[y + 1] - selection->row_starts[y];
+    return &selection->runs.items[selection->row_starts[y]];
+}
+
+void selection_free(Selection *selection) {
+    free(selection->row_starts);
+    da_free(selection->runs);
+    da_free(selection->edges);
+    memset(selection, 0, sizeof(*selection));
+}
+
+Selection selection_empty(int width, int height, Vector2 origin) {
+    return (Selection) {
+        .width = width,
+        .height = height,
+        .origin = origin,
+        .row_starts = calloc(height + 1, sizeof(size_t)),
     };
-    String_View path_sv = sv_from_cstr(path);
-    assert(path_sv.count > 0);
-    int i;
-    for (i = path_sv.count - 1; i >= 0; i--) {
-        if (
-            path_sv.data[i] == '/'
-            #ifdef _WIN32
-            || path_sv.data[i] == '\\'
-            #endif
-        ) {
-            i++;
-            break;
+}
+
+// Traces the outline along the edges of the selected pixels. Horizontal edges are wherever the rows above and below
+// differ, vertical ones are at both ends of every run
+void selection_update_edges(Selection *selection) {
+    selection->edges.count = 0;
+    Selection_Runs boundary = {0};
+    const Selection_Run *prev = NULL;
+    size_t prev_count = 0;
+    for (int y = 0; y <= selection->height; y++) {
+        size_t count = 0;
+        const Selection_Run *row = y < selection->height ? selection_row(selection, y, &count) : NULL;
+
+        boundary.count = 0;
+        selection_runs_combine(prev, prev_count, row, count, SELECTION_XOR_TRUTH_TABLE, &boundary);
+        da_foreach(Selection_Run, run, &boundary) {
+            da_append(&selection->edges, ((Selection_Edge) { run->start, y, run->end, y }));
         }
+        for (size_t i = 0; i < count; i++) {
+            da_append(&selection->edges, ((Selection_Edge) { row[i].start, y, row[i].start, y + 1 }));
+            da_append(&selection->edges, ((Selection_Edge) { row[i].end, y, row[i].end, y + 1 }));
+        }
+
+        prev = row;
+        prev_count = count;
     }
-    path_sv = sv_from_parts(path_sv.data + i, path_sv.count - i);
-    object_set_name(&object, path_sv);
-    da_append(&g->objects, object);
+    da_free(boundary);
 }
 
-RenderTexture export_image_to_render_texture(void) {
-    Camera2D camera = {
-        .zoom = 1.0f,
-        .offset = {-g->canvas_bounds.x, -g->canvas_bounds.y},
-    };
+int compare_fill_spans(const void *a, const void *b) {
+    const Fill_Span *x = a;
+    const Fill_Span *y = b;
+    if (x->y != y->y) return x->y < y->y ? -1 : 1;
+    return x->start < y->start ? -1 : x->start > y->start;
+}
 
-    int width = g->canvas_bounds.width;
-    int height = g->canvas_bounds.height;
+// The pixels of a flood fill of a `width`x`height` image. Sorts `spans` on the way
+Selection selection_from_spans(Fill_Spans *spans, int width, int height, Vector2 origin) {
+    qsort(spans->items, spans->count, sizeof(Fill_Span), compare_fill_spans);
+    Selection selection = selection_empty(width, height, origin);
+    size_t i = 0;
+    for (int y = 0; y < height; y++) {
+        size_t row_start = selection.runs.count;
+        selection.row_starts[y] = row_start;
+        for (; i < spans->count && spans->items[i].y == y; i++) {
+            selection_runs_append(&selection.runs, row_start, spans->items[i].start, spans->items[i].end);
+        }
+    }
+    selection.row_starts[height] = selection.runs.count;
+    selection_update_edges(&selection);
+    return selection;
+}
 
-    RenderTexture rtex_flipped = load_render_texture_with_pixel_format(width, height, PIXELFORMAT_UNCOMPRESSED_R8G8B8);
-    TextureMode(rtex_flipped) Mode2D(camera) {
-        draw_scene();
+// Both selections must cover the same pixels
+Selection selection_combine(const Selection *a, const Selection *b, Selection_Op op) {
+    assert(a->width == b->width && a->height == b->height);
+    Selection result = selection_empty(a->width, a->height, a->origin);
+    uint8_t truth_table = selection_op_truth_table(op);
+    for (int y = 0; y < a->height; y++) {
+        result.row_starts[y] = result.runs.count;
+        size_t a_count, b_count;
+        const Selection_Run *a_row = selection_row(a, y, &a_count);
+        const Selection_Run *b_row = selection_row(b, y, &b_count);
+        selection_runs_combine(a_row, a_count, b_row, b_count, truth_table, &result.runs);
     }
-    RenderTexture rtex_nflipped = LoadRenderTexture(width, height);
-    // flip texture
-    TextureMode(rtex_nflipped) {
-        DrawTexture(rtex_flipped.texture, 0, 0, WHITE);
+    result.row_starts[a->height] = result.runs.count;
+    selection_update_edges(&result);
+    return result;
+}
+
+bool selection_is_empty(const Selection *selection) {
+    return selection->runs.count == 0;
+}
+
+size_t selection_pixel_count(const Selection *selection) {
+    size_t pixels = 0;
+    da_foreach(Selection_Run, run, &selection->runs) pixels += run->end - run->start;
+    return pixels;
+}
+
+size_t selection_memory_usage(const Selection *selection) {
+    size_t bytes = 0;
+    if (selection->row_starts != NULL) bytes += (selection->height + 1) * sizeof(size_t);
+    bytes += selection->runs.capacity * sizeof(Selection_Run);
+    bytes += selection->edges.capacity * sizeof(Selection_Edge);
+    return bytes;
+}
+
+// Bounding box of the selected pixels in the world
+Rectangle selection_bounds(const Selection *selection) {
+    int min_x = INT_MAX, max_x = INT_MIN, min_y = INT_MAX, max_y = INT_MIN;
+    for (int y = 0; y < selection->height; y++) {
+        size_t count;
+        const Selection_Run *row = selection_row(selection, y, &count);
+        if (count == 0) continue;
+        if (y < min_y) min_y = y;
+        max_y = y;
+        if (row[0].start < min_x) min_x = row[0].start;
+        if (row[count - 1].end > max_x) max_x = row[count - 1].end;
     }
+    if (min_y > max_y) return (Rectangle) { selection->origin.x, selection->origin.y, 0, 0 };
+    return (Rectangle) { selection->origin.x + min_x, selection->origin.y + min_y, max_x - min_x, max_y - min_y + 1 };
+}
 
-    UnloadRenderTexture(rtex_flipped);
-    return rtex_nflipped;
+// Selects the region of the canvas around `point` that is about the same color, combined with the current selection
+// according to g->selection_op
+void magic_wand(Vector2 point) {
+    int x = point.x - g->canvas_bounds.x;
+    int y = point.y - g->canvas_bounds.y;
+    if (x < 0 || y < 0 || x >= (int)g->canvas_bounds.width || y >= (int)g->canvas_bounds.height) return;
+
+    TraceZone("Magic wand") {
+        Fill_Spans spans = {0};
+        flood_fill_canvas(x, y, &spans);
+        Vector2 origin = { g->canvas_bounds.x, g->canvas_bounds.y };
+        Selection picked = selection_from_spans(&spans, g->canvas_bounds.width, g->canvas_bounds.height, origin);
+        da_free(spans);
+
+        // Once the canvas moves or changes size, the old selection is gone as far as combining goes
+        Selection *current = &g->selection;
+        if (current->width != picked.width || current->height != picked.height || !Vector2Equals(current->origin, picked.origin)) {
+            selection_free(current);
+            *current = selection_empty(picked.width, picked.height, picked.origin);
+        }
+        Selection combined = selection_combine(current, &picked, g->selection_op);
+        selection_free(current);
+        selection_free(&picked);
+        *current = combined;
+    }
 }
 
-void app_update(void) {
-    size_t temp_checkpoint = temp_save();
+// Adds an image object of what the canvas shows inside the selection, transparent everywhere else
+void copy_selection_to_object(void) {
+    Selection *selection = &g->selection;
+    Rectangle bounds = selection_bounds(selection);
+    if (bounds.width == 0) return;
+
+    Image image = scene_snapshot(bounds);
+    Color *pixels = image.data;
+    int left = bounds.x - selection->origin.x;
+    int top = bounds.y - selection->origin.y;
+    for (int row = 0; row < image.height; row++) {
+        size_t count;
+        const Selection_Run *runs = selection_row(selection, top + row, &count);
+        Color *pixel_row = &pixels[row * image.width];
+        // Clear the gaps before, between and after the runs
+        int x = 0;
+        for (size_t i = 0; i <= count; i++) {
+            int gap_end = i < count ? runs[i].start - left : image.width;
+            if (gap_end > x) memset(&pixel_row[x], 0, (gap_end - x) * sizeof(Color));
+            if (i < count) x = runs[i].end - left;
+        }
+    }
 
-    Clay_SetLayoutDimensions((Clay_Dimensions) { GetScreenWidth(), GetScreenHeight() });
-    Clay_SetPointerState((Clay_Vector2) { GetMouseX(), GetMouseY() }, IsMouseButtonDown(MOUSE_BUTTON_LEFT));
-    Vector2 wheel_v = GetMouseWheelMoveV();
-    Clay_UpdateScrollContainers(true, (Clay_Vector2) { wheel_v.x, wheel_v.y }, GetFrameTime());
+    add_image_object_from_image(image, sv_from_cstr("Selection"));
+    Object *object = &da_last(&g->objects);
+    object->as_texture.rec.x = bounds.x;
+    object->as_texture.rec.y = bounds.y;
+}
 
-    if (IsFileDropped()) {
-        FilePathList files = LoadDroppedFiles();
-        for (size_t i = 0; i < files.count; i++) {
-            const char *path = files.paths[i];
-            add_image_object(path);
+// Makes the pixels of an image object outside the selection transparent. A pixel of the image counts as selected if
+// its center is on a selected pixel of the canvas, wherever on the canvas and at whatever size the image is drawn.
+// The image doesn't match its file anymore afterwards, so it can't go back to that at full resolution either
+void object_mask_by_selection(Object *object, const Selection *selection) {
+    assert(object->type == OBJ_TEXTURE);
+    Image image = object_load_image(object);
+    if (image.data == NULL) return;
+    ImageFormat(&image, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+
+    Rectangle rec = object->as_texture.rec;
+    // Selection column of every image column, which is the same for every row
+    int *columns = malloc(image.width * sizeof(int));
+    for (int x = 0; x < image.width; x++) {
+        columns[x] = floorf(rec.x + (x + 0.5f) * rec.width / image.width - selection->origin.x);
+    }
+    bool *selected = malloc(selection->width * sizeof(bool));
+    Color *pixels = image.data;
+    for (int y = 0; y < image.height; y++) {
+        int row = floorf(rec.y + (y + 0.5f) * rec.height / image.height - selection->origin.y);
+        memset(selected, 0, selection->width * sizeof(bool));
+        if (0 <= row && row < selection->height) {
+            size_t count;
+            const Selection_Run *runs = selection_row(selection, row, &count);
+            for (size_t i = 0; i < count; i++) memset(&selected[runs[i].start], true, runs[i].end - runs[i].start);
+        }
+        Color *pixel_row = &pixels[(size_t)y * image.width];
+        for (int x = 0; x < image.width; x++) {
+            int column = columns[x];
+            if (column < 0 || column >= selection->width || !selected[column]) pixel_row[x] = BLANK;
         }
-        UnloadDroppedFiles(files);
     }
+    free(selected);
+    free(columns);
+
+    object_release_image(object);
+    object_set_image(object, image);
+    free(object->as_texture.source_path);
+    object->as_texture.source_path = NULL;
+    object->as_texture.filtered_dirty = true;
+}
 
-    if (IsKeyPressed(KEY_LEFT_CONTROL) && IsKeyPressed(KEY_D)) {
-        Clay_SetDebugModeEnabled(!Clay_IsDebugModeEnabled());
+// Black and white stripes along the outline that crawl over time. The stripes are in screen space, so they look the
+// same at any zoom level
+void draw_selection_outline(const Selection *selection) {
+    if (selection->edges.count == 0) return;
+    float offset = fmodf(GetTime() * 8, 2);
+    SetShaderValue(g->marching_ants_shader, g->marching_ants_offset_loc, &offset, SHADER_UNIFORM_FLOAT);
+    ShaderMode(g->marching_ants_shader) {
+        rlBegin(RL_LINES);
+        rlColor4ub(255, 255, 255, 255);
+        Vector2 origin = selection->origin;
+        da_foreach(Selection_Edge, edge, &selection->edges) {
+            rlVertex2f(origin.x + edge->x0, origin.y + edge->y0);
+            rlVertex2f(origin.x + edge->x1, origin.y + edge->y1);
+        }
+        rlEnd();
     }
+}
 
-    Rectangle main_area;
-    CustomLayoutElement get_bounding_box = {
-        .type = CUSTOM_LAYOUT_ELEMENT_TYPE_GET_BOUNDING_BOX,
-        .customData.boundingBoxPtr = &main_area,
-    };
-    Rectangle color_picker;
-    CustomLayoutElement get_color_picker = {
-        .type = CUSTOM_LAYOUT_ELEMENT_TYPE_GET_BOUNDING_BOX,
-        .customData.boundingBoxPtr = &color_picker,
-    };
-    Rectangle hue_picker;
-    CustomLayoutElement get_hue_picker = {
-        .type = CUSTOM_LAYOUT_ELEMENT_TYPE_GET_BOUNDING_BOX,
-        .customData.boundingBoxPtr = &hue_picker,
-    };
+#ifndef PLATFORM_WEB
+void handle_file_dialog_result(File_Dialog_Result result) {
+    if (result.path == NULL) return;
+    static_assert(COUNT_FILE_DIALOGS == 4, "Exhaustive handling of file dialogs in handle_file_dialog_result");
+    switch (result.kind) {
+        case FILE_DIALOG_OPEN_IMAGE:
+            da_foreach(Object, object, &g->objects) {
+                object_unload(object);
+            }
+            g->objects.count = 0;
+            g->current_text_object = NULL;
+            selection_free(&g->selection);
+            add_image_object(result.path);
+            if (g->objects.count > 0) g->canvas_bounds = g->objects.items[0].as_texture.rec;
+            break;
+        case FILE_DIALOG_ADD_IMAGE:
+            add_image_object(result.path);
+            break;
+        case FILE_DIALOG_EXPORT_IMAGE: TraceZone("Export image") {
+            RenderTexture rtex = export_image_to_render_texture();
+            Image img = LoadImageFromTexture(rtex.texture);
+            if (!ExportImage(img, result.path)) {
+                nob_log(ERROR, "Could not export image to %s", result.path);
+                // The export dialog just closed, so this one is free
+                file_dialog_show_export_error(&g->file_dialog, result.path);
+            }
+            UnloadImage(img);
+            UnloadRenderTexture(rtex);
+        } break;
+        case FILE_DIALOG_EXPORT_ERROR:
+            UNREACHABLE("message boxes have no path");
+        case COUNT_FILE_DIALOGS:
+        default: UNREACHABLE("invalid file dialog");
+    }
+}
+#endif // PLATFORM_WEB
 
+// Lays out the whole UI and handles its input. Only runs on frames where something it shows could have changed, the
+// other ones draw the UI of the last layout again
+Clay_RenderCommandArray layout_ui(CustomLayoutElement *get_bounding_box, CustomLayoutElement *get_color_picker, CustomLayoutElement *get_hue_picker) {
     Clay_BeginLayout();
     CLAY({
         .id = CLAY_ID("Root"),
@@ -828,33 +4960,13 @@ void app_update(void) {
             }) {
 #ifndef PLATFORM_WEB
                 if (button(CLAY_ID("OpenImageButton"), CLAY_STRING("Open Image")).pressed) {
-                    const char *filter_patterns[] = { "*.png", "*.jpg", "*.tga", "*.bmp", "*.psd", "*.gif", "*.hdr", "*.pic", "*.ppm" };
-                    const char *path = tinyfd_openFileDialog("Add Image", NULL, ARRAY_LEN(filter_patterns), filter_patterns, "Image", 0);
-                    if (path != NULL) {
-                        da_foreach(Object, object, &g->objects) {
-                            object_unload(object);
-                        }
-                        g->objects.count = 0;
-                        g->current_text_object = NULL;
-                        add_image_object(path);
-                        g->canvas_bounds = g->objects.items[0].as_texture.rec;
-                    }
+                    file_dialog_open(&g->file_dialog, FILE_DIALOG_OPEN_IMAGE);
                 }
                 if (button(CLAY_ID("ExportButton"), CLAY_STRING("Export Image")).pressed) {
-                    const char *filter_patterns[] = {"*.png", "*.bmp", "*.tga", "*.jpg", "*.hdr"};
-                    const char *path = tinyfd_saveFileDialog("Export Image", NULL, ARRAY_LEN(filter_patterns), filter_patterns, "Image file");
-                    if (path != NULL) {
-                        RenderTexture rtex = export_image_to_render_texture();
-                        Image img = LoadImageFromTexture(rtex.texture);
-                        if (!ExportImage(img, path)) {
-                            tinyfd_messageBox("Error exporting image", temp_sprintf("Could not export image to %s", path), "ok", "error", 1);
-                        }
-                        UnloadImage(img);
-                        UnloadRenderTexture(rtex);
-                    }
+                    file_dialog_open(&g->file_dialog, FILE_DIALOG_EXPORT_IMAGE);
                 }
 #else // defined(PLATFORM_WEB)
-                if (button(CLAY_ID("ExportButton"), CLAY_STRING("Export Image")).pressed) {
+                if (button(CLAY_ID("ExportButton"), CLAY_STRING("Export Image")).pressed) TraceZone("Export image") {
                     RenderTexture rtex = export_image_to_render_texture();
                     Image img = LoadImageFromTexture(rtex.texture);
                     int file_size;
@@ -870,11 +4982,83 @@ void app_update(void) {
                 }
 #endif // PLATFORM_WEB
             }
+            CLAY({
+                .id = CLAY_ID("ExportBlur"),
+                .layout.childAlignment.y = CLAY_ALIGN_Y_CENTER,
+                .layout.childGap = 10,
+            }) {
+                Clay_TextElementConfig *text_config = CLAY_TEXT_CONFIG({
+                    .fontSize = 20,
+                    .textColor = {255, 255, 255, 255},
+                });
+                CLAY_TEXT(CLAY_STRING("Export blur"), text_config);
+                slider(CLAY_ID("ExportBlurSlider"), &g->export_blur_radius, 0, BLUR_MAX_RADIUS);
+                CLAY_TEXT(clay_string_from_cstr(temp_sprintf("%.0f px", g->export_blur_radius)), text_config);
+            }
+            CLAY({
+                .id = CLAY_ID("ResampleOptions"),
+                .layout.childGap = 5,
+            }) {
+                const char *filter_label = temp_sprintf("Shrink with: %s", resize_filter_as_cstr(g->resample_filter));
+                if (button(CLAY_ID("ResampleFilterButton"), clay_string_from_cstr(filter_label)).pressed) {
+                    g->resample_filter = (g->resample_filter + 1) % COUNT_RESIZE_FILTERS;
+                }
+                Clay_String originals_label = g->export_originals ? CLAY_STRING("Export originals: on") : CLAY_STRING("Export originals: off");
+                if (button(CLAY_ID("ExportOriginalsButton"), originals_label).pressed) {
+                    g->export_originals = !g->export_originals;
+                }
+            }
 
             tool_button(CLAY_ID("ChangeCanvasButton"), CLAY_STRING("ChangeCanvas"), TOOL_CHANGE_CANVAS);
             tool_button(CLAY_ID("MoveButton"), CLAY_STRING("Move"), TOOL_MOVE);
             tool_button(CLAY_ID("RectangleButton"), CLAY_STRING("Rectangle"), TOOL_RECT);
             tool_button(CLAY_ID("TextButton"), CLAY_STRING("Text"), TOOL_TEXT);
+            CLAY({
+                .id = CLAY_ID("FillButtonContainer"),
+                .layout.childAlignment.y = CLAY_ALIGN_Y_CENTER,
+                .layout.childGap = 10,
+            }) {
+                tool_button(CLAY_ID("FillButton"), CLAY_STRING("Fill"), TOOL_FILL);
+                tool_button(CLAY_ID("WandButton"), CLAY_STRING("Wand"), TOOL_WAND);
+                if (g->tool == TOOL_FILL || g->tool == TOOL_WAND) {
+                    Clay_TextElementConfig *text_config = CLAY_TEXT_CONFIG({
+                        .fontSize = 20,
+                        .textColor = {255, 255, 255, 255},
+                    });
+                    CLAY_TEXT(CLAY_STRING("Tolerance"), text_config);
+                    slider(CLAY_ID("ToleranceSlider"), &g->color_tolerance, 0, 255);
+                    CLAY_TEXT(clay_string_from_cstr(temp_sprintf("%.0f", g->color_tolerance)), text_config);
+                }
+            }
+            if (g->tool == TOOL_WAND || !selection_is_empty(&g->selection)) {
+                CLAY({
+                    .id = CLAY_ID("SelectionOptions"),
+                    .layout.childAlignment.y = CLAY_ALIGN_Y_CENTER,
+                    .layout.childGap = 5,
+                }) {
+                    const char *op_label = temp_sprintf("Mode: %s", selection_op_as_cstr(g->selection_op));
+                    if (button(CLAY_ID("SelectionOpButton"), clay_string_from_cstr(op_label)).pressed) {
+                        g->selection_op = (g->selection_op + 1) % COUNT_SELECTION_OPS;
+                    }
+                    if (!selection_is_empty(&g->selection)) {
+                        if (button(CLAY_ID("SelectionCropButton"), CLAY_STRING("Crop")).pressed) {
+                            g->canvas_bounds = selection_bounds(&g->selection);
+                        }
+                        if (button(CLAY_ID("SelectionCopyButton"), CLAY_STRING("Copy")).pressed) {
+                            copy_selection_to_object();
+                        }
+                        if (button(CLAY_ID("DeselectButton"), CLAY_STRING("Deselect")).pressed) {
+                            selection_free(&g->selection);
+                        }
+                        const char *info = temp_sprintf("%zu px, %s", selection_pixel_count(&g->selection),
+                                temp_human_readable_size(selection_memory_usage(&g->selection)));
+                        CLAY_TEXT(clay_string_from_cstr(info), CLAY_TEXT_CONFIG({
+                            .fontSize = 20,
+                            .textColor = {255, 255, 255, 255},
+                        }));
+                    }
+                }
+            }
             CLAY({
                 .id = CLAY_ID("DrawButtonContainer"),
                 .layout.layoutDirection = CLAY_LEFT_TO_RIGHT,
@@ -901,8 +5085,8 @@ void app_update(void) {
                             .backgroundColor = {255, 255, 255, 255},
                         }) hovered |= Clay_Hovered();
 
-                        if (hovered && IsMouseButtonDown(MOUSE_BUTTON_LEFT)) {
-                            float mouse_x = GetMouseX();
+                        if (hovered && input_is_mouse_button_down(MOUSE_BUTTON_LEFT)) {
+                            float mouse_x = input_mouse_x();
                             Clay_BoundingBox bounding_box = Clay_GetElementData(CLAY_ID("StrokeWeightSlider")).boundingBox;
                             g->stroke_weight = Lerp(1, max_stroke_weight, (mouse_x - bounding_box.x) / slider_width);
                         }
@@ -911,15 +5095,43 @@ void app_update(void) {
                         .fontSize = 30,
                         .textColor = {255, 255, 255, 255},
                     }));
+                    // Stamped strokes always go into a layer
+                    if (!g->brush_stamped) {
+                        Clay_String raster_label = g->paint_into_layer ? CLAY_STRING("Raster: on") : CLAY_STRING("Raster: off");
+                        if (button(CLAY_ID("PaintIntoLayerButton"), raster_label).pressed) {
+                            g->paint_into_layer = !g->paint_into_layer;
+                        }
+                    }
+                    // The next stroke starts a layer of its own
+                    if ((g->paint_into_layer || g->brush_stamped) && button(CLAY_ID("NewLayerButton"), CLAY_STRING("New layer")).pressed) {
+                        g->paint_layer_id = 0;
+                    }
+                }
+            }
+            if (g->tool == TOOL_DRAW) {
+                CLAY({
+                    .id = CLAY_ID("BrushOptions"),
+                    .layout.sizing = { CLAY_SIZING_GROW(), CLAY_SIZING_FIT() },
+                    .layout.layoutDirection = CLAY_TOP_TO_BOTTOM,
+                    .layout.childGap = 3,
+                }) {
+                    Clay_String brush_label = g->brush_stamped ? CLAY_STRING("Brush: stamp") : CLAY_STRING("Brush: line");
+                    if (button(CLAY_ID("BrushStampedButton"), brush_label).pressed) {
+                        g->brush_stamped = !g->brush_stamped;
+                    }
+                    labeled_slider(CLAY_ID("StrokeSmoothingSlider"), "Smoothing", &g->stroke_smoothing, 0, 1, "%.2f");
+                    if (g->brush_stamped) {
+                        labeled_slider(CLAY_ID("BrushSizeSlider"), "Size", &g->brush.size, 1, BRUSH_MAX_SIZE, "%.0f px");
+                        labeled_slider(CLAY_ID("BrushHardnessSlider"), "Hardness", &g->brush.hardness, 0, 1, "%.2f");
+                        labeled_slider(CLAY_ID("BrushSpacingSlider"), "Spacing", &g->brush.spacing, 0.02f, 1, "%.2f");
+                        labeled_slider(CLAY_ID("BrushOpacitySlider"), "Opacity", &g->brush.opacity, 0, 1, "%.2f");
+                        labeled_slider(CLAY_ID("BrushJitterSlider"), "Size jitter", &g->brush.size_jitter, 0, 1, "%.2f");
+                    }
                 }
             }
 #ifndef PLATFORM_WEB
             if (button(CLAY_ID("AddImageButton"), CLAY_STRING("Add Image")).pressed) {
-                const char *filter_patterns[] = { "*.png", "*.jpg", "*.tga", "*.bmp", "*.psd", "*.gif", "*.hdr", "*.pic", "*.ppm" };
-                const char *path = tinyfd_openFileDialog("Add Image", NULL, ARRAY_LEN(filter_patterns), filter_patterns, "Image", 0);
-                if (path != NULL) {
-                    add_image_object(path);
-                }
+                file_dialog_open(&g->file_dialog, FILE_DIALOG_ADD_IMAGE);
             }
 #endif // PLATFORM_WEB
 
@@ -938,7 +5150,7 @@ void app_update(void) {
                     .backgroundColor = {g->current_color.r, g->current_color.g, g->current_color.b, g->current_color.a},
                     .cornerRadius = CLAY_CORNER_RADIUS(10),
                 }) {
-                    if (Clay_Hovered() && IsMouseButtonPressed(MOUSE_BUTTON_LEFT)) {
+                    if (Clay_Hovered() && input_is_mouse_button_pressed(MOUSE_BUTTON_LEFT)) {
                         g->color_picker_open = !g->color_picker_open;
                     }
                 }
@@ -947,15 +5159,22 @@ void app_update(void) {
                 CLAY({
                     .id = CLAY_ID("HuePicker"),
                     .layout.sizing = {CLAY_SIZING_FIXED(128), CLAY_SIZING_FIXED(30)},
-                    .custom = { &get_hue_picker },
+                    .custom = { get_hue_picker },
                 });
                 CLAY({
                     .id = CLAY_ID("ColorPicker"),
                     .layout.sizing = {CLAY_SIZING_FIXED(128), CLAY_SIZING_FIXED(128)},
-                    .custom = { &get_color_picker },
+                    .custom = { get_color_picker },
                 });
             }
 
+            da_foreach(Object, object, &g->objects) {
+                if (object->id == g->filters_object_id && object->type == OBJ_TEXTURE) {
+                    filters_panel(object);
+                    break;
+                }
+            }
+
             CLAY({ .layout.sizing = { CLAY_SIZING_GROW(), CLAY_SIZING_GROW() }});
 
             CLAY_TEXT(clay_string_from_cstr(temp_sprintf("Current Zoom Level: %f", g->camera.zoom)), CLAY_TEXT_CONFIG({
@@ -975,20 +5194,78 @@ void app_update(void) {
                     .textColor = {255, 255, 255, 255},
                 });
 
+                Object_Memory *memory = temp_alloc(g->objects.count * sizeof(*memory));
+                Object_Memory total = {0};
+                for (size_t i = 0; i < g->objects.count; i++) {
+                    memory[i] = object_memory_usage(&g->objects.items[i]);
+                    total.cpu += memory[i].cpu;
+                    total.cpu_used += memory[i].cpu_used;
+                    total.gpu += memory[i].gpu;
+                }
+
+                CLAY({
+                    .layout.sizing = { CLAY_SIZING_GROW(), CLAY_SIZING_FIT() },
+                    .layout.childGap = 3,
+                    .layout.layoutDirection = CLAY_LEFT_TO_RIGHT,
+                }) {
+                    const char *total_text = temp_sprintf("Total: CPU %s (%s used), GPU %s",
+                            temp_human_readable_size(total.cpu), temp_human_readable_size(total.cpu_used),
+                            temp_human_readable_size(total.gpu));
+                    CLAY_TEXT(clay_string_from_cstr(total_text), text_config);
+                    CLAY({ .layout.sizing = { CLAY_SIZING_GROW(), CLAY_SIZING_GROW() } });
+                    Clay_String sort_label = g->sort_objects_by_size ? CLAY_STRING("Sort by depth") : CLAY_STRING("Sort by size");
+                    if (button(CLAY_ID("SortObjectsButton"), sort_label).pressed) {
+                        g->sort_objects_by_size = !g->sort_objects_by_size;
+                    }
+                }
+
+                // Topmost object first, unless sorted by size
+                size_t *order = temp_alloc(g->objects.count * sizeof(*order));
+                for (size_t i = 0; i < g->objects.count; i++) order[i] = g->objects.count - 1 - i;
+                if (g->sort_objects_by_size) {
+                    Object_Size *sizes = temp_alloc(g->objects.count * sizeof(*sizes));
+                    for (size_t i = 0; i < g->objects.count; i++) {
+                        sizes[i] = (Object_Size) { i, memory[i].cpu + memory[i].gpu };
+                    }
+                    qsort(sizes, g->objects.count, sizeof(*sizes), compare_object_sizes);
+                    for (size_t i = 0; i < g->objects.count; i++) order[i] = sizes[i].index;
+                }
+
+                // Moving objects around in the middle of the loop would mess up the order, so do it once it's over
+                int swap_a = -1, swap_b = -1;
+                int remove = -1;
+
+                // Only the rows inside the viewport get laid out, with spacers standing in for the rest, so that huge
+                // scenes don't blow up the element count of Clay. The viewport is the one of the last frame, which is
+                // close enough, and before the list ever got laid out it's at most the whole screen
+                Clay_ElementId list_id = CLAY_ID("ObjectList");
+                Clay_ScrollContainerData scroll = Clay_GetScrollContainerData(list_id);
+                float scroll_y = scroll.found ? -scroll.scrollPosition->y : 0;
+                float viewport_height = scroll.found ? scroll.scrollContainerDimensions.height : input_screen_height();
+                size_t first_row = scroll_y / OBJECT_LIST_ROW_HEIGHT;
+                size_t last_row = ceilf((scroll_y + viewport_height) / OBJECT_LIST_ROW_HEIGHT) + 1;
+                if (first_row > g->objects.count) first_row = g->objects.count;
+                if (last_row > g->objects.count) last_row = g->objects.count;
                 CLAY({
-                    .id = CLAY_ID("ObjectList"),
+                    .id = list_id,
                     .layout.sizing = { CLAY_SIZING_GROW(), CLAY_SIZING_FIT() },
                     .layout.layoutDirection = CLAY_TOP_TO_BOTTOM,
                     .scroll.vertical = true,
                 }) {
                     g->hovered_object = -1;
-                    for (Object *object = g->objects.items + g->objects.count - 1; object >= g->objects.items; object--) {
+                    if (first_row > 0) {
+                        CLAY({ .layout.sizing = { CLAY_SIZING_GROW(), CLAY_SIZING_FIXED(first_row * OBJECT_LIST_ROW_HEIGHT) } });
+                    }
+                    for (size_t k = first_row; k < last_row; k++) {
+                        size_t i = order[k];
+                        Object *object = &g->objects.items[i];
                         CLAY({
-                            .layout.sizing = { CLAY_SIZING_GROW(), CLAY_SIZING_FIT() },
+                            .id = CLAY_IDI("ObjectRow", object->id),
+                            .layout.sizing = { CLAY_SIZING_GROW(), CLAY_SIZING_FIXED(OBJECT_LIST_ROW_HEIGHT) },
                             .layout.childGap = 3,
                             .layout.layoutDirection = CLAY_LEFT_TO_RIGHT,
                         }) {
-                            if (Clay_Hovered()) g->hovered_object = object - g->objects.items;
+                            if (Clay_Hovered()) g->hovered_object = i;
                             Clay_String name = {
                                 .chars = object->name,
                                 .length = object->name_len,
@@ -998,66 +5275,228 @@ void app_update(void) {
 
                             CLAY({ .layout.sizing = { CLAY_SIZING_GROW(), CLAY_SIZING_GROW() } });
 
-                            Button_State up_button = button((Clay_ElementId) {0}, CLAY_STRING("^"));
-                            if (object != g->objects.items + g->objects.count - 1 && up_button.pressed) {
-                                Object tmp = *object;
-                                *object = *(object + 1);
-                                *(object + 1) = tmp;
+                            const char *size_text = memory[i].gpu > 0
+                                ? temp_sprintf("%s + %s GPU", temp_human_readable_size(memory[i].cpu), temp_human_readable_size(memory[i].gpu))
+                                : temp_human_readable_size(memory[i].cpu);
+                            CLAY_TEXT(clay_string_from_cstr(size_text), text_config);
+
+                            // Reordering only makes sense when the list shows the actual order
+                            if (!g->sort_objects_by_size) {
+                                Button_State up_button = button(CLAY_IDI("ObjectUpButton", object->id), CLAY_STRING("^"));
+                                if (i != g->objects.count - 1 && up_button.pressed) {
+                                    swap_a = i;
+                                    swap_b = i + 1;
+                                }
+                                Button_State down_button = button(CLAY_IDI("ObjectDownButton", object->id), CLAY_STRING("v"));
+                                if (i != 0 && down_button.pressed) {
+                                    swap_a = i;
+                                    swap_b = i - 1;
+                                }
                             }
-                            Button_State down_button = button((Clay_ElementId) {0}, CLAY_STRING("v"));
-                            if (object != g->objects.items && down_button.pressed) {
-                                Object tmp = *object;
-                                *object = *(object - 1);
-                                *(object - 1) = tmp;
+                            if (object->type == OBJ_TEXTURE && button(CLAY_IDI("ObjectFiltersButton", object->id), CLAY_STRING("Filters")).pressed) {
+                                g->filters_object_id = g->filters_object_id == object->id ? 0 : object->id;
                             }
-                            if (button((Clay_ElementId) {0}, CLAY_STRING("Fit")).pressed) {
+                            if (object->type == OBJ_TEXTURE && !selection_is_empty(&g->selection)
+                                && button(CLAY_IDI("ObjectMaskButton", object->id), CLAY_STRING("Mask")).pressed) {
+                                object_mask_by_selection(object, &g->selection);
+                            }
+                            if (object_should_resample(object)) {
+                                if (button(CLAY_IDI("ObjectShrinkButton", object->id), CLAY_STRING("Shrink")).pressed) {
+                                    Vector2 size = object_displayed_size(object);
+                                    object_resample(object, size.x, size.y, g->resample_filter);
+                                }
+                            } else if (object->type == OBJ_TEXTURE && object->as_texture.resampled && object->as_texture.source_path != NULL) {
+                                Vector2 image = object_image_size(object);
+                                Vector2 displayed = object_displayed_size(object);
+                                if ((displayed.x > image.x || displayed.y > image.y) && button(CLAY_IDI("ObjectRestoreButton", object->id), CLAY_STRING("Full res")).pressed) {
+                                    object_restore_original(object);
+                                }
+                            }
+                            if (button(CLAY_IDI("ObjectFitButton", object->id), CLAY_STRING("Fit")).pressed) {
                                 g->canvas_bounds = object_get_bounding_box(object);
                             }
-                            if (button((Clay_ElementId) {0}, CLAY_STRING("Remove")).pressed) {
-                                size_t i = object - g->objects.items;
-                                g->current_text_object = NULL;
-                                object_unload(object);
-                                nob_log(INFO, "Removing object %zu (%.*s)", i, (int)object->name_len, object->name);
-                                memmove(object, object + 1, (g->objects.count - i - 1) * sizeof(*object));
-                                g->objects.count -= 1;
+                            if (button(CLAY_IDI("ObjectRemoveButton", object->id), CLAY_STRING("Remove")).pressed) {
+                                remove = i;
                             }
                         }
                     }
+                    if (last_row < g->objects.count) {
+                        CLAY({ .layout.sizing = { CLAY_SIZING_GROW(), CLAY_SIZING_FIXED((g->objects.count - last_row) * OBJECT_LIST_ROW_HEIGHT) } });
+                    }
+                }
+
+                if (swap_a >= 0) {
+                    Object tmp = g->objects.items[swap_a];
+                    g->objects.items[swap_a] = g->objects.items[swap_b];
+                    g->objects.items[swap_b] = tmp;
+                }
+                if (remove >= 0) {
+                    Object *object = &g->objects.items[remove];
+                    g->current_text_object = NULL;
+                    object_unload(object);
+                    nob_log(INFO, "Removing object %d (%.*s)", remove, (int)object->name_len, object->name);
+                    memmove(object, object + 1, (g->objects.count - remove - 1) * sizeof(*object));
+                    g->objects.count -= 1;
                 }
             }
         }
         CLAY({
             .id = CLAY_ID("MainArea"),
             .layout.sizing = { CLAY_SIZING_GROW(), CLAY_SIZING_GROW() },
-            .custom = { &get_bounding_box },
+            .custom = { get_bounding_box },
         });
     }
-    Clay_RenderCommandArray commands = Clay_EndLayout();
+    return Clay_EndLayout();
+}
+
+void app_update(void) {
+    size_t temp_checkpoint = temp_save();
+    glyph_cache_trim(&g->glyph_cache);
+    g->glyph_cache.frame++;
+    profiler_begin_frame(&g->profiler);
+    input_begin_frame(&g->input);
+
+    Clay_SetLayoutDimensions((Clay_Dimensions) { input_screen_width(), input_screen_height() });
+    Clay_SetPointerState((Clay_Vector2) { input_mouse_x(), input_mouse_y() }, input_is_mouse_button_down(MOUSE_BUTTON_LEFT));
+    Vector2 wheel_v = input_mouse_wheel_v();
+    Clay_UpdateScrollContainers(true, (Clay_Vector2) { wheel_v.x, wheel_v.y }, input_frame_time());
+
+    // Everything the sidebar shows only changes in response to input, except for the scrolling of the object list
+    // which keeps going for a while on its own
+    Ui_Cache *ui_cache = &g->ui_cache;
+    Clay_ScrollContainerData object_list_scroll = Clay_GetScrollContainerData(CLAY_ID("ObjectList"));
+    Clay_Vector2 scroll = object_list_scroll.found ? *object_list_scroll.scrollPosition : (Clay_Vector2) {0};
+    bool changed = input_changed(&g->input);
+    bool relayout = !ui_cache->valid || g->ui_dirty || changed
+        || scroll.x != ui_cache->scroll.x || scroll.y != ui_cache->scroll.y
+        || ui_cache->texture.texture.width != input_screen_width() || ui_cache->texture.texture.height != input_screen_height();
+    ui_cache->scroll = scroll;
+    // Whatever the input changed in this frame only shows up in the layout of the next one
+    g->ui_dirty = changed;
+
+    da_foreach(char *, path, input_dropped_files()) {
+        add_image_object(*path);
+    }
+
+#ifndef PLATFORM_WEB
+    File_Dialog_Result dialog_result;
+    if (file_dialog_poll(&g->file_dialog, &dialog_result)) {
+        handle_file_dialog_result(dialog_result);
+        free(dialog_result.path);
+        // Came in without any input, so the UI wouldn't notice otherwise
+        g->ui_dirty = true;
+    }
+#endif // PLATFORM_WEB
+
+    if (input_is_key_pressed(KEY_LEFT_CONTROL) && input_is_key_pressed(KEY_D)) {
+        Clay_SetDebugModeEnabled(!Clay_IsDebugModeEnabled());
+    }
+    if (input_is_key_down(KEY_LEFT_CONTROL) && input_is_key_pressed(KEY_P)) {
+        g->profiler.visible = !g->profiler.visible;
+    }
+    if (input_is_key_down(KEY_LEFT_CONTROL) && input_is_key_pressed(KEY_T)) {
+        if (atomic_load(&g->trace.recording)) {
+            const char *path = temp_sprintf("simp-trace-%lld.json", (long long)time(NULL));
+            if (!trace_stop_and_dump(path)) nob_log(ERROR, "Could not save trace to %s", path);
+        } else {
+            trace_start();
+        }
+    }
+    if (input_is_key_down(KEY_LEFT_CONTROL) && input_is_key_pressed(KEY_R) && g->input.mode != INPUT_REPLAYING) {
+        if (g->input.mode == INPUT_RECORDING) {
+            const char *path = temp_sprintf("simp-recording-%lld.txt", (long long)time(NULL));
+            if (!input_stop_recording(&g->input, path)) nob_log(ERROR, "Could not save input recording to %s", path);
+        } else {
+            input_start_recording(&g->input);
+        }
+    }
+
+    Rectangle main_area;
+    CustomLayoutElement get_bounding_box = {
+        .type = CUSTOM_LAYOUT_ELEMENT_TYPE_GET_BOUNDING_BOX,
+        .customData.boundingBoxPtr = &main_area,
+    };
+    Rectangle color_picker;
+    CustomLayoutElement get_color_picker = {
+        .type = CUSTOM_LAYOUT_ELEMENT_TYPE_GET_BOUNDING_BOX,
+        .customData.boundingBoxPtr = &color_picker,
+    };
+    Rectangle hue_picker;
+    CustomLayoutElement get_hue_picker = {
+        .type = CUSTOM_LAYOUT_ELEMENT_TYPE_GET_BOUNDING_BOX,
+        .customData.boundingBoxPtr = &hue_picker,
+    };
+
+    Clay_RenderCommandArray commands = {0};
+    if (relayout) {
+        profiler_begin_phase(&g->profiler, PHASE_CLAY_LAYOUT);
+        commands = layout_ui(&get_bounding_box, &get_color_picker, &get_hue_picker);
+        profiler_end_phase(&g->profiler, PHASE_CLAY_LAYOUT);
+    } else {
+        main_area = ui_cache->main_area;
+        color_picker = ui_cache->color_picker;
+        hue_picker = ui_cache->hue_picker;
+    }
+
+    if (g->pending_layer_stroke.count > 0) {
+        layer_paint_stroke(paint_layer(), g->pending_layer_stroke);
+        da_free(g->pending_layer_stroke);
+        memset(&g->pending_layer_stroke, 0, sizeof(g->pending_layer_stroke));
+    }
+    stroke_overlay_update();
+    if (g->canvas_click_pending) {
+        g->canvas_click_pending = false;
+        if (g->tool == TOOL_FILL) bucket_fill(g->canvas_click);
+        if (g->tool == TOOL_WAND) magic_wand(g->canvas_click);
+    }
+    // Before anything gets drawn, as filters render into textures of their own
+    apply_all_filters();
 
     Drawing() {
+        profiler_begin_gpu_frame(&g->profiler);
         ClearBackground(GetColor(0xFF00FFFF));
-        Clay_Raylib_Render(commands, &g->font);
+        Profile(PHASE_CLAY_RENDER) {
+            if (relayout) {
+                if (ui_cache->texture.texture.width != input_screen_width() || ui_cache->texture.texture.height != input_screen_height()) {
+                    if (ui_cache->texture.id != 0) UnloadRenderTexture(ui_cache->texture);
+                    ui_cache->texture = LoadRenderTexture(input_screen_width(), input_screen_height());
+                }
+                TextureMode(ui_cache->texture) {
+                    ClearBackground(BLACK);
+                    Clay_Raylib_Render(commands, &g->font);
+                }
+                ui_cache->main_area = main_area;
+                ui_cache->color_picker = color_picker;
+                ui_cache->hue_picker = hue_picker;
+                ui_cache->valid = true;
+            }
+            // Straight copy, as blending the antialiased edges of the text once more would darken them
+            rlSetBlendFactors(RL_ONE, RL_ZERO, RL_FUNC_ADD);
+            BlendMode(BLEND_CUSTOM) {
+                Texture texture = ui_cache->texture.texture;
+                DrawTextureRec(texture, (Rectangle) { 0, 0, texture.width, -texture.height }, Vector2Zero(), WHITE);
+            }
+        }
 
         ScissorModeRec(main_area) Mode2D(g->camera) {
-            if (CheckCollisionPointRec(GetMousePosition(), main_area)) {
-                update_main_area();
+            if (CheckCollisionPointRec(input_mouse_position(), main_area)) {
+                Profile(PHASE_UPDATE_MAIN_AREA) update_main_area();
             } else {
                 set_cursor(MOUSE_CURSOR_DEFAULT);
             }
 
-            draw_scene();
+            Profile(PHASE_DRAW_SCENE) draw_scene();
+            draw_selection_outline(&g->selection);
 
-            if (CheckCollisionPointRec(GetMousePosition(), main_area)) {
-                if (g->tool == TOOL_RECT && IsMouseButtonDown(MOUSE_BUTTON_TOOL)) {
+            if (CheckCollisionPointRec(input_mouse_position(), main_area)) {
+                if (g->tool == TOOL_RECT && input_is_mouse_button_down(MOUSE_BUTTON_TOOL)) {
                     DrawRectangleRec(get_current_rect(), g->current_color);
                 }
-                if (g->tool == TOOL_CHANGE_CANVAS && IsMouseButtonDown(MOUSE_BUTTON_TOOL)) {
+                if (g->tool == TOOL_CHANGE_CANVAS && input_is_mouse_button_down(MOUSE_BUTTON_TOOL)) {
                     DrawRectangleLinesEx(get_current_rect(), 5, WHITE);
                 }
-                if (g->tool == TOOL_DRAW && IsMouseButtonDown(MOUSE_BUTTON_TOOL)) {
-                    draw_stroke(g->current_stroke);
-                }
             }
+            draw_stroke_overlay();
 
             if (g->hovered_object < 0 || (size_t)g->hovered_object >= g->objects.count) g->hovered_object = -1;
             if (g->hovered_object != -1) {
@@ -1068,9 +5507,9 @@ void app_update(void) {
             DrawRectangleLinesEx(g->canvas_bounds, 5, WHITE);
         }
 
-        if (g->color_picker_open) {
-            Vector2 mouse = GetMousePosition();
-            if (CheckCollisionPointRec(mouse, hue_picker) && IsMouseButtonDown(MOUSE_BUTTON_LEFT)) {
+        if (g->color_picker_open) Profile(PHASE_COLOR_PICKER) {
+            Vector2 mouse = input_mouse_position();
+            if (CheckCollisionPointRec(mouse, hue_picker) && input_is_mouse_button_down(MOUSE_BUTTON_LEFT)) {
                 g->curr_hue = (mouse.x - hue_picker.x) / hue_picker.width;
             }
 
@@ -1090,7 +5529,7 @@ void app_update(void) {
             Vector2 actual_pos = Vector2Add(corner, g->color_picker_pos);
             float radius = 10;
 
-            if (CheckCollisionPointRec(mouse, color_picker) && IsMouseButtonDown(MOUSE_BUTTON_LEFT)) {
+            if (CheckCollisionPointRec(mouse, color_picker) && input_is_mouse_button_down(MOUSE_BUTTON_LEFT)) {
                 g->color_picker_pos = Vector2Subtract(mouse, corner);
             }
             ScissorModeRec(color_picker) {
@@ -1099,9 +5538,20 @@ void app_update(void) {
 
             g->current_color = ColorFromHSV(g->curr_hue * 360, g->color_picker_pos.x / color_picker.width, 1 - g->color_picker_pos.y / color_picker.height);
         }
+
+        profiler_end_frame(&g->profiler);
+        if (g->profiler.visible) {
+            profiler_draw_overlay(&g->profiler, g->font, (Vector2) { main_area.x + 10, main_area.y + 10 });
+        }
+        profiler_end_gpu_frame(&g->profiler);
     }
 
+    input_end_frame(&g->input);
     temp_rewind(temp_checkpoint);
 }
 
+bool app_should_close(void) {
+    return g->input.replay_finished;
+}
+
 // TODO: round the sizes of the objects to the nearest integer pixel (to better reflect how they'll look exported)
@@ -1,13 +1,26 @@
 #ifndef GAME_H_
 #define GAME_H_
 
+#include <stdbool.h>
+
 typedef struct App App;
 
+#ifdef TRACK_ALLOCATIONS
+#include <stddef.h>
+// Counting wrappers around the C allocator, enabled with `./nob -a`. They live in app.c
+void *tracked_malloc(size_t size);
+void *tracked_calloc(size_t count, size_t size);
+void *tracked_realloc(void *ptr, size_t size);
+void tracked_free(void *ptr);
+#endif // TRACK_ALLOCATIONS
+
 #define APP_FUNCS \
     X(app_init, void, void) \
+    X(app_can_reload, bool, void) \
     X(app_pre_reload, App*, void) \
     X(app_post_reload, void, App*) \
-    X(app_update, void, void)
+    X(app_update, void, void) \
+    X(app_should_close, bool, void)
 
 #ifdef HOTRELOAD
     #define X(name, ret, ...) typedef ret (*name##_t)(__VA_ARGS__);
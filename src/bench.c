@@ -0,0 +1,657 @@
+// Headless benchmarks of the hot paths of the app on synthetic scenes.
+// Prints one JSON object per line, e.g.
+//     {"bench":"hit_test","scene":"rects","objects":50000,"iterations":200,"mean_ms":0.412,"min_ms":0.398,"allocs":0.0,"alloc_bytes":0,"temp_peak":0}
+// where allocs and alloc_bytes are per iteration, and temp_peak is the most of the temp arena a single iteration used
+// Needs some GL context, but not a GPU. On a CI box without one:
+//     $ LIBGL_ALWAYS_SOFTWARE=1 xvfb-run ./build/bench
+#define NOB_IMPLEMENTATION
+#include "app.c"
+
+typedef struct {
+    const char *name;
+    size_t objects;
+} Scene;
+
+// Random but reproducible, so that runs can be compared against each other
+uint32_t bench_rng_state = 69;
+uint32_t bench_rand(void) {
+    bench_rng_state ^= bench_rng_state << 13;
+    bench_rng_state ^= bench_rng_state >> 17;
+    bench_rng_state ^= bench_rng_state << 5;
+    return bench_rng_state;
+}
+
+float bench_randf(float min, float max) {
+    return min + (max - min) * (bench_rand() / (float)UINT32_MAX);
+}
+
+Color bench_random_color(void) {
+    return (Color) { bench_rand() % 256, bench_rand() % 256, bench_rand() % 256, 255 };
+}
+
+void bench_clear_scene(void) {
+    da_foreach(Object, object, &g->objects) {
+        object_unload(object);
+    }
+    g->objects.count = 0;
+    g->current_text_object = NULL;
+    g->hovered_object = -1;
+}
+
+void bench_scene_strokes(size_t count, size_t points) {
+    for (size_t i = 0; i < count; i++) {
+        Object object = {
+            .type = OBJ_STROKE,
+            .as_stroke = { .color = bench_random_color(), .weight = bench_randf(1, 20) },
+        };
+        Vector2 pos = { bench_randf(0, g->canvas_bounds.width), bench_randf(0, g->canvas_bounds.height) };
+        for (size_t j = 0; j < points; j++) {
+            da_append(&object.as_stroke, pos);
+            pos = Vector2Add(pos, (Vector2) { bench_randf(-5, 5), bench_randf(-5, 5) });
+        }
+        object_set_name(&object, sv_from_cstr("Stroke"));
+        add_object(object);
+    }
+}
+
+// Same kind of strokes, but painted into a single raster layer
+void bench_scene_painted_strokes(size_t count, size_t points) {
+    bench_scene_strokes(count, points);
+    Objects strokes = g->objects;
+    g->objects = (Objects) {0};
+    Object *layer = paint_layer();
+    da_foreach(Object, object, &strokes) {
+        layer_paint_stroke(layer, object->as_stroke);
+        object_unload(object);
+    }
+    da_free(strokes);
+}
+
+void bench_scene_rects(size_t count) {
+    // Heatmap-style grid of cells
+    size_t columns = ceilf(sqrtf(count));
+    float cell = g->canvas_bounds.width / columns;
+    for (size_t i = 0; i < count; i++) {
+        Object object = {
+            .type = OBJ_RECT,
+            .as_rect = {
+                .rec = { (i % columns) * cell, (i / columns) * cell, cell, cell },
+                .color = bench_random_color(),
+            },
+        };
+        object_set_name(&object, sv_from_cstr("Rectangle"));
+        add_object(object);
+    }
+}
+
+void bench_scene_images(size_t count, int size) {
+    for (size_t i = 0; i < count; i++) {
+        Image image = GenImageChecked(size, size, size / 8, size / 8, bench_random_color(), bench_random_color());
+        add_image_object_from_image(image, sv_from_cstr("Image"));
+        Object *object = &da_last(&g->objects);
+        object->as_texture.rec.x = bench_randf(0, g->canvas_bounds.width - size);
+        object->as_texture.rec.y = bench_randf(0, g->canvas_bounds.height - size);
+    }
+}
+
+void bench_scene_texts(size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        Object object = {
+            .type = OBJ_TEXT,
+            .as_text = {
+                .size = bench_randf(10, 100),
+                .color = bench_random_color(),
+                .pos = { bench_randf(0, g->canvas_bounds.width), bench_randf(0, g->canvas_bounds.height) },
+            },
+        };
+        sb_appendf(&object.as_text.text, "Label #%zu", i);
+        object_set_name(&object, sb_to_sv(object.as_text.text));
+        add_object(object);
+    }
+}
+
+void bench_report(const char *bench, Scene scene, size_t iterations, double total, double min, Alloc_Stats allocs, size_t temp_peak) {
+    printf("{\"bench\":\"%s\",\"scene\":\"%s\",\"objects\":%zu,\"iterations\":%zu,\"mean_ms\":%.4f,\"min_ms\":%.4f,"
+           "\"allocs\":%.1f,\"alloc_bytes\":%.0f,\"temp_peak\":%zu}\n",
+           bench, scene.name, scene.objects, iterations, total / iterations * 1000, min * 1000,
+           (double)allocs.allocations / iterations, (double)allocs.bytes / iterations, temp_peak);
+    fflush(stdout);
+}
+
+#define BENCH_LOOP(bench, scene, iterations, ...) do {              \
+        double total = 0, min = INFINITY;                           \
+        size_t temp_peak = 0;                                       \
+        Alloc_Stats allocs_start = alloc_stats_now();               \
+        for (size_t iteration = 0; iteration < (iterations); iteration++) { \
+            size_t temp_checkpoint = temp_save();                   \
+            double start = GetTime();                               \
+            __VA_ARGS__;                                            \
+            double elapsed = GetTime() - start;                     \
+            total += elapsed;                                       \
+            if (elapsed < min) min = elapsed;                       \
+            if (temp_save() - temp_checkpoint > temp_peak) temp_peak = temp_save() - temp_checkpoint; \
+            temp_rewind(temp_checkpoint);                           \
+        }                                                           \
+        Alloc_Stats allocs = alloc_stats_since(allocs_start);       \
+        bench_report((bench), (scene), (iterations), total, min, allocs, temp_peak); \
+    } while (0)
+
+void bench_hit_test(Scene scene) {
+    // Same point sequence for every scene
+    bench_rng_state = 420;
+    BENCH_LOOP("hit_test", scene, 200, {
+        for (int i = 0; i < 100; i++) {
+            Vector2 point = { bench_randf(0, g->canvas_bounds.width), bench_randf(0, g->canvas_bounds.height) };
+            Object_Hit hit;
+            Rectangle bounding_box;
+            volatile int index = hit_test_objects(point, OBJECT_RESIZE_HITBOX_SIZE, &hit, &bounding_box);
+            UNUSED(index);
+        }
+    });
+}
+
+void bench_bounding_boxes(Scene scene) {
+    BENCH_LOOP("bounding_boxes", scene, 200, {
+        float sum = 0;
+        da_foreach(Object, object, &g->objects) {
+            Rectangle rec = object_get_bounding_box(object);
+            sum += rec.width;
+        }
+        volatile float sink = sum;
+        UNUSED(sink);
+    });
+}
+
+void bench_draw_scene(Scene scene, RenderTexture target) {
+    Camera2D camera = { .zoom = 1.0f, .offset = { -g->canvas_bounds.x, -g->canvas_bounds.y } };
+    // Submitting is asynchronous, so read a pixel back at the end of every frame to include the time the GPU
+    // (or llvmpipe) takes to actually render it
+    BENCH_LOOP("draw_scene", scene, 50, {
+        TextureMode(target) {
+            ClearBackground(BLACK);
+            Mode2D(camera) draw_scene();
+        }
+        void *pixels = rlReadTexturePixels(target.texture.id, 1, 1, target.texture.format);
+        RL_FREE(pixels);
+    });
+}
+
+void bench_export(Scene scene) {
+    BENCH_LOOP("export", scene, 5, {
+        RenderTexture rtex = export_image_to_render_texture();
+        Image img = LoadImageFromTexture(rtex.texture);
+        int file_size = 0;
+        unsigned char *data = ExportImageToMemory(img, ".png", &file_size);
+        RL_FREE(data);
+        UnloadImage(img);
+        UnloadRenderTexture(rtex);
+    });
+}
+
+// What the bucket fill and the magic wand go through before filling anything: rendering the canvas and reading it
+// back, and the flip scene_snapshot() adds on top
+void bench_snapshot(Scene scene) {
+    BENCH_LOOP("snapshot_upside_down", scene, 10, UnloadImage(scene_snapshot_upside_down(g->canvas_bounds)));
+    BENCH_LOOP("snapshot", scene, 10, UnloadImage(scene_snapshot(g->canvas_bounds)));
+    BENCH_LOOP("flood_fill_canvas", scene, 10, {
+        Fill_Spans spans = {0};
+        flood_fill_canvas(g->canvas_bounds.width / 2, g->canvas_bounds.height / 2, &spans);
+        da_free(spans);
+    });
+}
+
+// Frames of drawing `stroke` one point at a time. Should cost the same per frame no matter how long the stroke got
+void bench_stroke_preview(const char *bench, Scene scene, Stroke stroke) {
+    g->current_stroke = stroke;
+    g->current_stroke.count = 0;
+    g->stroke_overlay_points = 0;
+    BENCH_LOOP(bench, scene, stroke.count, {
+        g->current_stroke.count = iteration + 1;
+        stroke_overlay_update();
+        void *pixels = rlReadTexturePixels(g->stroke_overlay.texture.id, 1, 1, g->stroke_overlay.texture.format);
+        RL_FREE(pixels);
+    });
+    // The points belong to `stroke`
+    memset(&g->current_stroke, 0, sizeof(g->current_stroke));
+}
+
+// Long strokes of a big soft brush, painted into a layer and rendered as the live preview of the stroke being drawn
+void bench_brush(void) {
+    Scene scene = { .name = "brush_500px", .objects = 1 };
+    Stroke stroke = {
+        .color = RED,
+        .weight = BRUSH_MAX_SIZE,
+        .stamped = true,
+        .brush = { .size = BRUSH_MAX_SIZE, .hardness = 0, .spacing = 0.1f, .opacity = 0.5f },
+    };
+    bench_rng_state = 1337;
+    Vector2 pos = { g->canvas_bounds.width / 2, g->canvas_bounds.height / 2 };
+    for (size_t i = 0; i < 500; i++) {
+        da_append(&stroke, pos);
+        pos = Vector2Add(pos, (Vector2) { bench_randf(-20, 20), bench_randf(-20, 20) });
+    }
+
+    Object *layer = paint_layer();
+    BENCH_LOOP("brush_paint_stroke", scene, 5, {
+        layer_paint_stroke(layer, stroke);
+        void *pixels = rlReadTexturePixels(layer->as_layer.tiles.items[0].texture.texture.id, 1, 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+        RL_FREE(pixels);
+    });
+
+    bench_stroke_preview("brush_preview", scene, stroke);
+    stroke.stamped = false;
+    stroke.weight = 20;
+    bench_stroke_preview("line_preview", scene, stroke);
+
+    da_free(stroke);
+    bench_clear_scene();
+}
+
+// Both blur paths on one image, over radii on either side of BLUR_SEPARABLE_MAX_RADIUS
+void bench_blur(int size) {
+    Scene scene = { .name = temp_sprintf("image_%d", size), .objects = 1 };
+    Image image = GenImageChecked(size, size, size / 8, size / 8, RED, BLUE);
+    Texture texture = LoadTextureFromImage(image);
+    RenderTexture target = LoadRenderTexture(size, size);
+    float radii[] = { 4, 16, 64, 200 };
+    for (size_t i = 0; i < ARRAY_LEN(radii); i++) {
+        float radius = radii[i];
+        BENCH_LOOP(temp_sprintf("blur_gpu_r%.0f", radius), scene, 20, {
+            blur_texture(texture, (Rectangle) { 0, 0, size, size }, target, radius);
+            void *pixels = rlReadTexturePixels(target.texture.id, 1, 1, target.texture.format);
+            RL_FREE(pixels);
+        });
+        // Blurring the same image over and over costs the same every time
+        BENCH_LOOP(temp_sprintf("blur_cpu_r%.0f", radius), scene, 5, image_blur(&image, radius));
+    }
+    UnloadRenderTexture(target);
+    UnloadTexture(texture);
+    UnloadImage(image);
+}
+
+// Flood fills of synthetic images from their top left corner: one that's all the same color, one split into rooms by
+// walls with doors in them, and noise that's fillable in 70% of the pixels. The noise is the worst case there is,
+// with millions of runs of a pixel or two that all connect, since that's above the percolation threshold
+void bench_flood_fill(int width, int height) {
+    Scene scene = { .name = temp_sprintf("image_%dx%d", width, height), .objects = 1 };
+    Image image = GenImageColor(width, height, LIGHTGRAY);
+    Color *pixels = image.data;
+    const char *patterns[] = { "flat", "walls", "noise" };
+    bench_rng_state = 1337;
+    for (size_t pattern = 0; pattern < ARRAY_LEN(patterns); pattern++) {
+        // The top row stays open, so that the fill reaches everything it can
+        for (int y = 1; y < height; y++) {
+            for (int x = 0; x < width; x++) {
+                bool wall = false;
+                if (pattern == 1) wall = (x % 200 == 0 && y % 400 > 20) || (y % 150 == 0 && x % 300 > 30);
+                if (pattern == 2) wall = bench_rand() % 100 >= 70;
+                pixels[y * width + x] = wall ? BLACK : LIGHTGRAY;
+            }
+        }
+        BENCH_LOOP(temp_sprintf("flood_fill_%s", patterns[pattern]), scene, 5, {
+            Fill_Spans spans = {0};
+            flood_fill_spans(image, 0, 0, 32, &spans);
+            da_free(spans);
+        });
+    }
+    UnloadImage(image);
+}
+
+// Every CPU kernel at every level this CPU supports, so that the SIMD versions can be compared against the scalar ones
+void bench_kernels(int size) {
+    Scene scene = { .name = temp_sprintf("buffer_%d", size), .objects = 1 };
+    size_t pixels = (size_t)size * size;
+    uint8_t *rgba = malloc(pixels * 4);
+    uint8_t *rgb = malloc(pixels * 3);
+    float *floats = malloc(pixels * 4 * sizeof(float));
+    float *resized = malloc(pixels * 4 * sizeof(float));
+    for (size_t i = 0; i < pixels * 4; i++) rgba[i] = bench_rand();
+    for (size_t i = 0; i < pixels * 3; i++) rgb[i] = bench_rand();
+    for (size_t i = 0; i < pixels * 4; i++) floats[i] = bench_randf(0, 1);
+
+    const int radius = 8;
+    float weights[2*radius + 1];
+    kernel_gaussian_weights(radius / 3.0f, radius, weights);
+    const float sepia[20] = {
+        0.393f, 0.769f, 0.189f, 0, 0,
+        0.349f, 0.686f, 0.168f, 0, 0,
+        0.272f, 0.534f, 0.131f, 0, 0,
+        0,      0,      0,      1, 0,
+    };
+    static uint32_t bins[4][256];
+
+    // Just memcpy(), which is as vectorized as it gets already
+    BENCH_LOOP("flip_vertical", scene, 20, kernel_flip_vertical(rgba, size * 4, size));
+
+    Kernels best = kernels;
+    for (Kernel_Level level = 0; level <= best.level; level++) {
+        kernels = kernels_for_level(level);
+        const char *name = kernel_level_as_cstr(level);
+        BENCH_LOOP(temp_sprintf("rgba8_to_float_%s", name), scene, 20, kernels.rgba8_to_float(rgba, floats, pixels));
+        BENCH_LOOP(temp_sprintf("float_to_rgba8_%s", name), scene, 20, kernels.float_to_rgba8(floats, rgba, pixels));
+        BENCH_LOOP(temp_sprintf("rgb8_to_rgba8_%s", name), scene, 20, kernels.rgb8_to_rgba8(rgb, rgba, pixels));
+        BENCH_LOOP(temp_sprintf("premultiply_%s", name), scene, 20, kernels.premultiply(rgba, pixels));
+        BENCH_LOOP(temp_sprintf("unpremultiply_%s", name), scene, 20, kernels.unpremultiply(rgba, pixels));
+        BENCH_LOOP(temp_sprintf("convolve_r%d_%s", radius, name), scene, 5, kernel_convolve(floats, size, size, weights, radius));
+        BENCH_LOOP(temp_sprintf("resize_half_%s", name), scene, 5, kernel_resize(floats, size, size, resized, size / 2, size / 2, RESIZE_TENT));
+        BENCH_LOOP(temp_sprintf("resize_double_%s", name), scene, 5, kernel_resize(floats, size / 2, size / 2, resized, size, size, RESIZE_TENT));
+        for (Resize_Filter filter = 0; filter < COUNT_RESIZE_FILTERS; filter++) {
+            BENCH_LOOP(temp_sprintf("resize_rgba8_tenth_%s_%s", resize_filter_as_cstr(filter), name), scene, 5,
+                       kernel_resize_rgba8(rgba, size, size, (uint8_t*)resized, size / 10, size / 10, filter));
+        }
+        BENCH_LOOP(temp_sprintf("color_matrix_%s", name), scene, 20, kernels.color_matrix(rgba, pixels, sepia));
+        BENCH_LOOP(temp_sprintf("histogram_%s", name), scene, 20, kernels.histogram(rgba, pixels, bins));
+        BENCH_LOOP(temp_sprintf("match_color_%s", name), scene, 20, kernels.match_color(rgba, pixels, rgba, 32, rgb));
+    }
+    kernels = best;
+
+    free(rgba);
+    free(rgb);
+    free(floats);
+    free(resized);
+}
+
+double max_diff_u8(const uint8_t *a, const uint8_t *b, size_t count) {
+    int max = 0;
+    for (size_t i = 0; i < count; i++) max = fmax(max, abs(a[i] - b[i]));
+    return max;
+}
+
+double max_diff_f32(const float *a, const float *b, size_t count) {
+    double max = 0;
+    for (size_t i = 0; i < count; i++) max = fmax(max, fabs(a[i] - b[i]));
+    return max;
+}
+
+bool check_kernel(const char *kernel, Kernel_Level level, double diff, double tolerance) {
+    if (diff <= tolerance) return true;
+    nob_log(ERROR, "%s_%s is off from %s_scalar by %g (at most %g allowed)", kernel, kernel_level_as_cstr(level), kernel, diff, tolerance);
+    return false;
+}
+
+// Every level this CPU supports against the scalar one, on random buffers with an odd length so that the scalar tails
+// get some work too. Integer results must match exactly. Float ones may be off by rounding, and so may bytes that go
+// through floats, as the SIMD versions round half to even instead of half up
+bool check_kernels(void) {
+    const size_t pixels = 4099;
+    uint8_t *rgba = malloc(pixels * 4);
+    uint8_t *rgb = malloc(pixels * 3);
+    uint8_t *expected_u8 = malloc(pixels * 4);
+    uint8_t *actual_u8 = malloc(pixels * 4);
+    float *floats = malloc(pixels * 4 * sizeof(float));
+    float *expected_f32 = malloc(pixels * 4 * sizeof(float));
+    float *actual_f32 = malloc(pixels * 4 * sizeof(float));
+    uint32_t *expected_sums = malloc(pixels * 3 * sizeof(uint32_t));
+    uint32_t *actual_sums = malloc(pixels * 3 * sizeof(uint32_t));
+    bench_rng_state = 4242;
+    for (size_t i = 0; i < pixels * 4; i++) rgba[i] = bench_rand();
+    for (size_t i = 0; i < pixels * 3; i++) rgb[i] = bench_rand();
+    // Out of range too, for the clamping
+    for (size_t i = 0; i < pixels * 4; i++) floats[i] = bench_randf(-0.25f, 1.25f);
+    // Both ends of alpha are special cases of (un)premultiplying
+    for (size_t i = 0; i < pixels; i += 7) rgba[i*4 + 3] = 0;
+    for (size_t i = 3; i < pixels; i += 11) rgba[i*4 + 3] = 255;
+
+    const int radius = 8;
+    float weights[2*radius + 1];
+    kernel_gaussian_weights(radius / 3.0f, radius, weights);
+    const int taps = 4;
+    size_t resampled = pixels / 2;
+    int *starts = malloc(resampled * sizeof(*starts));
+    float *resample_weights = malloc(resampled * taps * sizeof(*resample_weights));
+    for (size_t x = 0; x < resampled; x++) {
+        starts[x] = x * 2 + taps <= pixels ? x * 2 : pixels - taps;
+        for (int k = 0; k < taps; k++) resample_weights[x * taps + k] = bench_randf(-0.25f, 1);
+    }
+    const float sepia[20] = {
+        0.393f, 0.769f, 0.189f, 0, 0,
+        0.349f, 0.686f, 0.168f, 0, 0,
+        0.272f, 0.534f, 0.131f, 0, 0.1f,
+        0,      0,      0,      1, 0,
+    };
+    uint8_t color[4] = { 128, 128, 128, 128 };
+
+    bool ok = true;
+    Kernels scalar = kernels_for_level(KERNEL_LEVEL_SCALAR);
+    for (Kernel_Level level = KERNEL_LEVEL_SCALAR + 1; level <= kernels_detect_level(); level++) {
+        Kernels k = kernels_for_level(level);
+
+        scalar.rgba8_to_float(rgba, expected_f32, pixels);
+        k.rgba8_to_float(rgba, actual_f32, pixels);
+        ok &= check_kernel("rgba8_to_float", level, max_diff_f32(expected_f32, actual_f32, pixels * 4), 0);
+
+        scalar.float_to_rgba8(floats, expected_u8, pixels);
+        k.float_to_rgba8(floats, actual_u8, pixels);
+        ok &= check_kernel("float_to_rgba8", level, max_diff_u8(expected_u8, actual_u8, pixels * 4), 1);
+
+        scalar.rgb8_to_rgba8(rgb, expected_u8, pixels);
+        k.rgb8_to_rgba8(rgb, actual_u8, pixels);
+        ok &= check_kernel("rgb8_to_rgba8", level, max_diff_u8(expected_u8, actual_u8, pixels * 4), 0);
+
+        memcpy(expected_u8, rgba, pixels * 4);
+        memcpy(actual_u8, rgba, pixels * 4);
+        scalar.premultiply(expected_u8, pixels);
+        k.premultiply(actual_u8, pixels);
+        ok &= check_kernel("premultiply", level, max_diff_u8(expected_u8, actual_u8, pixels * 4), 0);
+
+        memcpy(expected_u8, rgba, pixels * 4);
+        memcpy(actual_u8, rgba, pixels * 4);
+        scalar.unpremultiply(expected_u8, pixels);
+        k.unpremultiply(actual_u8, pixels);
+        ok &= check_kernel("unpremultiply", level, max_diff_u8(expected_u8, actual_u8, pixels * 4), 0);
+
+        scalar.convolve_row(floats, expected_f32, pixels, weights, radius);
+        k.convolve_row(floats, actual_f32, pixels, weights, radius);
+        ok &= check_kernel("convolve_row", level, max_diff_f32(expected_f32, actual_f32, pixels * 4), 1e-5);
+
+        memcpy(expected_f32, floats, pixels * 4 * sizeof(float));
+        memcpy(actual_f32, floats, pixels * 4 * sizeof(float));
+        scalar.accumulate_row(expected_f32, &floats[1], pixels * 4 - 1, 0.3f);
+        k.accumulate_row(actual_f32, &floats[1], pixels * 4 - 1, 0.3f);
+        ok &= check_kernel("accumulate_row", level, max_diff_f32(expected_f32, actual_f32, pixels * 4), 1e-5);
+
+        scalar.resample_row(floats, expected_f32, resampled, starts, resample_weights, taps);
+        k.resample_row(floats, actual_f32, resampled, starts, resample_weights, taps);
+        ok &= check_kernel("resample_row", level, max_diff_f32(expected_f32, actual_f32, resampled * 4), 1e-5);
+
+        memcpy(expected_u8, rgba, pixels * 4);
+        memcpy(actual_u8, rgba, pixels * 4);
+        scalar.color_matrix(expected_u8, pixels, sepia);
+        k.color_matrix(actual_u8, pixels, sepia);
+        ok &= check_kernel("color_matrix", level, max_diff_u8(expected_u8, actual_u8, pixels * 4), 1);
+
+        for (int tolerance = 0; tolerance <= 255; tolerance += 51) {
+            scalar.match_color(rgba, pixels, color, tolerance, expected_u8);
+            k.match_color(rgba, pixels, color, tolerance, actual_u8);
+            ok &= check_kernel("match_color", level, max_diff_u8(expected_u8, actual_u8, pixels), 0);
+        }
+
+        scalar.box_blur_row(rgba, expected_u8, pixels, radius);
+        k.box_blur_row(rgba, actual_u8, pixels, radius);
+        ok &= check_kernel("box_blur_row", level, max_diff_u8(expected_u8, actual_u8, pixels * 4), 0);
+
+        // Boxes full of the bytes of `rgba` that slide onto those of `rgb`
+        for (size_t i = 0; i < pixels * 3; i++) expected_sums[i] = actual_sums[i] = rgba[i] * (2*radius + 1);
+        scalar.box_blur_step(expected_sums, expected_u8, rgb, rgba, pixels * 3, radius);
+        k.box_blur_step(actual_sums, actual_u8, rgb, rgba, pixels * 3, radius);
+        ok &= check_kernel("box_blur_step", level, max_diff_u8(expected_u8, actual_u8, pixels * 3), 0);
+        ok &= check_kernel("box_blur_step", level, memcmp(expected_sums, actual_sums, pixels * 3 * sizeof(uint32_t)) != 0, 0);
+    }
+    if (ok) nob_log(INFO, "Every kernel level agrees with the scalar one");
+
+    free(rgba);
+    free(rgb);
+    free(expected_u8);
+    free(actual_u8);
+    free(floats);
+    free(expected_f32);
+    free(actual_f32);
+    free(expected_sums);
+    free(actual_sums);
+    free(starts);
+    free(resample_weights);
+    return ok;
+}
+
+// Smoothed stroke through `count` samples of the pointer moving right at `speed` px/s, sampled at 1 kHz. With
+// `frame_rate` > 0 they come in bursts once a frame, all with the time of the poll like the pointer hook gets them, and
+// `spread` decides whether they go through pointer_samples_spread() first. The pointer then keeps moving until the end
+// of the last frame, as spreading can't know that it stopped halfway through
+Stroke smoothed_stroke(size_t count, double speed, double frame_rate, bool spread) {
+    g->current_stroke = (Stroke) {0};
+    const double sample_rate = 1000;
+    if (frame_rate <= 0) {
+        for (size_t i = 0; i < count; i++) {
+            double time = i / sample_rate;
+            stroke_add_point((Vector2) { speed * time, 0 }, time);
+        }
+        return g->current_stroke;
+    }
+    Pointer_Samples frame = {0};
+    size_t i = 0;
+    for (size_t frames = 1; i < count; frames++) {
+        double poll = frames / frame_rate;
+        frame.count = 0;
+        for (; i / sample_rate < poll; i++) {
+            da_append(&frame, ((Pointer_Sample) { { speed * i / sample_rate, 0 }, poll }));
+        }
+        if (spread) pointer_samples_spread(&frame, 1 / frame_rate);
+        da_foreach(Pointer_Sample, sample, &frame) stroke_add_point(sample->pos, sample->time);
+    }
+    da_free(frame);
+    return g->current_stroke;
+}
+
+// Furthest apart that the points of two strokes through the same samples get, as far as both go
+float max_stroke_distance(Stroke a, Stroke b) {
+    float distance = 0;
+    for (size_t i = 0; i < a.count && i < b.count; i++) distance = fmaxf(distance, Vector2Distance(a.items[i], b.items[i]));
+    return distance;
+}
+
+// Smoothing has to come out about the same whether the samples have the times they were taken at or come in bursts
+// with the time of the poll, since the latter is all that the pointer hook gets. Needs nothing but the CPU
+bool check_stroke_smoothing(void) {
+    App *saved = g;
+    g = calloc(1, sizeof(*g));
+    g->camera.zoom = 1;
+    g->stroke_smoothing = 0.5f;
+
+    bool ok = true;
+    const double frame_rates[] = { 15, 60, 144 };
+    for (size_t i = 0; i < ARRAY_LEN(frame_rates); i++) {
+        Stroke exact = smoothed_stroke(500, 1000, 0, false);
+        Stroke bursts = smoothed_stroke(500, 1000, frame_rates[i], false);
+        Stroke spread = smoothed_stroke(500, 1000, frame_rates[i], true);
+        float off = max_stroke_distance(exact, spread);
+        // Under a pixel for every frame rate, where bunched up samples end up 3 px off at 144 fps and 40 px at 15
+        if (off > 1) {
+            nob_log(ERROR, "Smoothing at %.0f fps: spread samples end up %.2f px off, bunched up ones %.2f px",
+                    frame_rates[i], off, max_stroke_distance(exact, bursts));
+            ok = false;
+        }
+        da_free(exact);
+        da_free(bursts);
+        da_free(spread);
+    }
+    if (ok) nob_log(INFO, "Smoothing follows the pointer the same with samples in bursts");
+
+    free(g);
+    g = saved;
+    return ok;
+}
+
+void bench_scene(Scene scene, RenderTexture target) {
+    scene.objects = g->objects.count;
+    bench_bounding_boxes(scene);
+    bench_hit_test(scene);
+    bench_draw_scene(scene, target);
+    bench_export(scene);
+    bench_snapshot(scene);
+    bench_clear_scene();
+}
+
+void usage(FILE *stream, const char *program_name) {
+    fprintf(stream, "Usage: %s [OPTIONS]\n", program_name);
+    fprintf(stream, "  OPTIONS:\n");
+    fprintf(stream, "    -h, --help - Print this help message\n");
+    fprintf(stream, "    -s <scale> - Multiply the size of every synthetic scene by <scale> (default: 1)\n");
+    fprintf(stream, "    -k         - Only run the checks, which need no display: SIMD kernels against scalar ones, stroke smoothing\n");
+}
+
+int main(int argc, char **argv) {
+    const char *program_name = shift(argv, argc);
+    float scale = 1;
+    bool only_check = false;
+    while (argc > 0) {
+        const char *arg = shift(argv, argc);
+        if (strcmp(arg, "-h") == 0 || strcmp(arg, "--help") == 0) {
+            usage(stdout, program_name);
+            return 0;
+        } else if (strcmp(arg, "-s") == 0) {
+            if (argc == 0) {
+                usage(stderr, program_name);
+                nob_log(ERROR, "-s flag requires an argument");
+                return 1;
+            }
+            scale = atof(shift(argv, argc));
+        } else if (strcmp(arg, "-k") == 0) {
+            only_check = true;
+        } else {
+            usage(stderr, program_name);
+            nob_log(ERROR, "unknown flag %s", arg);
+            return 1;
+        }
+    }
+
+    // Timings of kernels that get the wrong result are worthless
+    if (!check_kernels()) return 1;
+    if (!check_stroke_smoothing()) return 1;
+    if (only_check) return 0;
+
+#ifdef __linux__
+    // raylib crashes instead of failing gracefully when GLFW can't find a display
+    if (getenv("DISPLAY") == NULL && getenv("WAYLAND_DISPLAY") == NULL) {
+        nob_log(ERROR, "No display to create a GL context on. On a headless machine, run the benchmarks under xvfb-run");
+        return 1;
+    }
+#endif // __linux__
+
+    SetTraceLogLevel(LOG_WARNING);
+    SetConfigFlags(FLAG_WINDOW_HIDDEN);
+    InitWindow(640, 480, "SIMP benchmarks");
+    if (!IsWindowReady()) {
+        nob_log(ERROR, "Could not create a GL context");
+        return 1;
+    }
+    app_init();
+
+    RenderTexture target = LoadRenderTexture(g->canvas_bounds.width, g->canvas_bounds.height);
+
+    bench_scene_strokes(1000 * scale, 100);
+    bench_scene((Scene) { .name = "strokes" }, target);
+
+    bench_scene_painted_strokes(1000 * scale, 100);
+    bench_scene((Scene) { .name = "painted_strokes" }, target);
+
+    bench_scene_rects(50000 * scale);
+    bench_scene((Scene) { .name = "rects" }, target);
+
+    bench_scene_images(2000 * scale, 64);
+    bench_scene((Scene) { .name = "small_images" }, target);
+
+    bench_scene_images(20 * scale, 1024);
+    bench_scene((Scene) { .name = "large_images" }, target);
+
+    bench_scene_texts(1000 * scale);
+    bench_scene((Scene) { .name = "texts" }, target);
+
+    bench_brush();
+    bench_blur(1024 * sqrtf(scale));
+    bench_flood_fill(4000 * sqrtf(scale), 3000 * sqrtf(scale));
+    bench_kernels(1024 * sqrtf(scale));
+
+    UnloadRenderTexture(target);
+    CloseWindow();
+    return 0;
+}
@@ -0,0 +1,917 @@
+// Kernels for the pixel work the app does on the CPU, on RGBA8 buffers (4 bytes per pixel) and float buffers
+// (4 floats per pixel, 0-1). Every kernel has a scalar version that works everywhere, plus SSE2 and AVX2 versions on
+// x86 that kernels_init() picks at runtime depending on what the CPU supports. Call them through `kernels`, e.g.
+//     kernels.premultiply(pixels, count);
+// Set SIMP_KERNELS=scalar|sse2|avx2 to force a level, e.g. to compare the results of two of them.
+#include <math.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+    #define KERNELS_X86
+    #include <immintrin.h>
+    #define TARGET_AVX2 __attribute__((target("avx2")))
+#endif // defined(__x86_64__) || defined(__i386__)
+
+typedef enum {
+    KERNEL_LEVEL_SCALAR,
+    KERNEL_LEVEL_SSE2,
+    KERNEL_LEVEL_AVX2,
+    COUNT_KERNEL_LEVELS,
+} Kernel_Level;
+
+const char *kernel_level_as_cstr(Kernel_Level level) {
+    static_assert(COUNT_KERNEL_LEVELS == 3, "Please update after adding a new kernel level");
+    switch (level) {
+        case KERNEL_LEVEL_SCALAR: return "scalar";
+        case KERNEL_LEVEL_SSE2: return "sse2";
+        case KERNEL_LEVEL_AVX2: return "avx2";
+        default: UNREACHABLE("invalid kernel level");
+    }
+}
+
+typedef struct {
+    Kernel_Level level;
+    // 0-255 -> 0-1 and back, rounding and clamping
+    void (*rgba8_to_float)(const uint8_t *src, float *dst, size_t pixels);
+    void (*float_to_rgba8)(const float *src, uint8_t *dst, size_t pixels);
+    // Alpha is set to 255
+    void (*rgb8_to_rgba8)(const uint8_t *src, uint8_t *dst, size_t pixels);
+    void (*premultiply)(uint8_t *pixels, size_t count);
+    void (*unpremultiply)(uint8_t *pixels, size_t count);
+    // dst[x] = sum of weights[k]*src[x + k - radius] for k in [0, 2*radius], with the edge pixels repeated outwards
+    void (*convolve_row)(const float *src, float *dst, size_t width, const float *weights, int radius);
+    // dst[i] += weight*src[i] over `count` floats, for everything that runs along columns
+    void (*accumulate_row)(float *dst, const float *src, size_t count, float weight);
+    // dst[x] = sum of weights[x*taps + k]*src[starts[x] + k] for k in [0, taps)
+    void (*resample_row)(const float *src, float *dst, size_t dst_width, const int *starts, const float *weights, int taps);
+    // Every channel becomes a linear combination of all 4 channels plus an offset, in 0-1 units.
+    // `matrix` is 4 rows of 5, one per output channel
+    void (*color_matrix)(uint8_t *pixels, size_t count, const float matrix[20]);
+    // Adds the pixels to the histogram of each channel
+    void (*histogram)(const uint8_t *pixels, size_t count, uint32_t bins[4][256]);
+    // mask[i] = 255 if no channel of pixel i is more than `tolerance` away from `color`, 0 otherwise
+    void (*match_color)(const uint8_t *pixels, size_t count, const uint8_t color[4], uint8_t tolerance, uint8_t *mask);
+    // Box blur of an RGBA8 row, with the edge pixels repeated outwards. Costs the same no matter the radius
+    void (*box_blur_row)(const uint8_t *src, uint8_t *dst, size_t width, int radius);
+    // A row of a box blur down the columns of an image, `sums` being the running sums of the boxes:
+    // dst[i] = sums[i]/(2*radius + 1), then sums[i] += add[i] - sub[i], over `count` bytes
+    void (*box_blur_step)(uint32_t *sums, uint8_t *dst, const uint8_t *add, const uint8_t *sub, size_t count, int radius);
+} Kernels;
+
+Kernels kernels;
+
+// Scalar
+
+void rgba8_to_float_scalar(const uint8_t *src, float *dst, size_t pixels) {
+    for (size_t i = 0; i < pixels * 4; i++) dst[i] = src[i] * (1.0f / 255);
+}
+
+static inline uint8_t float_to_u8(float x) {
+    x = x * 255 + 0.5f;
+    return x <= 0 ? 0 : x >= 255 ? 255 : (uint8_t)x;
+}
+
+void float_to_rgba8_scalar(const float *src, uint8_t *dst, size_t pixels) {
+    for (size_t i = 0; i < pixels * 4; i++) dst[i] = float_to_u8(src[i]);
+}
+
+void rgb8_to_rgba8_scalar(const uint8_t *src, uint8_t *dst, size_t pixels) {
+    for (size_t i = 0; i < pixels; i++) {
+        dst[i*4 + 0] = src[i*3 + 0];
+        dst[i*4 + 1] = src[i*3 + 1];
+        dst[i*4 + 2] = src[i*3 + 2];
+        dst[i*4 + 3] = 255;
+    }
+}
+
+// x/255 rounded to nearest, exact for every x in [0, 255*255]
+static inline uint32_t div255(uint32_t x) {
+    x += 128;
+    return (x + (x >> 8)) >> 8;
+}
+
+void premultiply_scalar(uint8_t *pixels, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        uint8_t *p = &pixels[i*4];
+        p[0] = div255(p[0] * p[3]);
+        p[1] = div255(p[1] * p[3]);
+        p[2] = div255(p[2] * p[3]);
+    }
+}
+
+void unpremultiply_scalar(uint8_t *pixels, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        uint8_t *p = &pixels[i*4];
+        if (p[3] == 0) continue;
+        float scale = 255.0f / p[3];
+        for (int c = 0; c < 3; c++) {
+            float x = p[c] * scale + 0.5f;
+            p[c] = x >= 255 ? 255 : (uint8_t)x;
+        }
+    }
+}
+
+static inline size_t clamp_index(ptrdiff_t index, size_t count) {
+    return index < 0 ? 0 : (size_t)index >= count ? count - 1 : (size_t)index;
+}
+
+static inline void convolve_pixel_scalar(const float *src, float *dst, size_t width, const float *weights, int radius, size_t x) {
+    float sum[4] = {0};
+    for (int k = 0; k <= 2*radius; k++) {
+        const float *p = &src[clamp_index((ptrdiff_t)x + k - radius, width) * 4];
+        for (int c = 0; c < 4; c++) sum[c] += weights[k] * p[c];
+    }
+    memcpy(&dst[x*4], sum, sizeof(sum));
+}
+
+void convolve_row_scalar(const float *src, float *dst, size_t width, const float *weights, int radius) {
+    for (size_t x = 0; x < width; x++) convolve_pixel_scalar(src, dst, width, weights, radius, x);
+}
+
+void accumulate_row_scalar(float *dst, const float *src, size_t count, float weight) {
+    for (size_t i = 0; i < count; i++) dst[i] += weight * src[i];
+}
+
+void resample_row_scalar(const float *src, float *dst, size_t dst_width, const int *starts, const float *weights, int taps) {
+    for (size_t x = 0; x < dst_width; x++) {
+        float sum[4] = {0};
+        const float *p = &src[starts[x] * 4];
+        const float *w = &weights[x * taps];
+        for (int k = 0; k < taps; k++) {
+            for (int c = 0; c < 4; c++) sum[c] += w[k] * p[k*4 + c];
+        }
+        memcpy(&dst[x*4], sum, sizeof(sum));
+    }
+}
+
+void color_matrix_scalar(uint8_t *pixels, size_t count, const float matrix[20]) {
+    for (size_t i = 0; i < count; i++) {
+        uint8_t *p = &pixels[i*4];
+        float in[4] = { p[0] / 255.0f, p[1] / 255.0f, p[2] / 255.0f, p[3] / 255.0f };
+        for (int c = 0; c < 4; c++) {
+            const float *row = &matrix[c*5];
+            p[c] = float_to_u8(row[0]*in[0] + row[1]*in[1] + row[2]*in[2] + row[3]*in[3] + row[4]);
+        }
+    }
+}
+
+// Scattered increments don't vectorize (not before the conflict detection of AVX-512), so every level uses this one
+void histogram_scalar(const uint8_t *pixels, size_t count, uint32_t bins[4][256]) {
+    for (size_t i = 0; i < count; i++) {
+        bins[0][pixels[i*4 + 0]]++;
+        bins[1][pixels[i*4 + 1]]++;
+        bins[2][pixels[i*4 + 2]]++;
+        bins[3][pixels[i*4 + 3]]++;
+    }
+}
+
+void match_color_scalar(const uint8_t *pixels, size_t count, const uint8_t color[4], uint8_t tolerance, uint8_t *mask) {
+    for (size_t i = 0; i < count; i++) {
+        const uint8_t *p = &pixels[i*4];
+        bool match = true;
+        for (int c = 0; c < 4; c++) match &= abs(p[c] - color[c]) <= tolerance;
+        mask[i] = match ? 255 : 0;
+    }
+}
+
+// 16.16 fixed point reciprocal of the size of a box
+static inline uint32_t box_blur_scale(int radius) {
+    return ((1u << 16) + radius) / (2*radius + 1);
+}
+
+// The rounding of the scale can push a box of 255s a hair above 255 once the radius is big enough
+static inline uint8_t box_blur_average(uint32_t sum, uint32_t scale) {
+    uint32_t x = (sum * scale + (1 << 15)) >> 16;
+    return x >= 255 ? 255 : x;
+}
+
+void box_blur_row_scalar(const uint8_t *src, uint8_t *dst, size_t width, int radius) {
+    const uint32_t scale = box_blur_scale(radius);
+    uint32_t sum[4];
+    for (int c = 0; c < 4; c++) sum[c] = src[c] * (radius + 1);
+    for (int k = 1; k <= radius; k++) {
+        for (int c = 0; c < 4; c++) sum[c] += src[clamp_index(k, width) * 4 + c];
+    }
+    for (size_t x = 0; x < width; x++) {
+        const uint8_t *add = &src[clamp_index((ptrdiff_t)x + radius + 1, width) * 4];
+        const uint8_t *sub = &src[clamp_index((ptrdiff_t)x - radius, width) * 4];
+        for (int c = 0; c < 4; c++) {
+            dst[x*4 + c] = box_blur_average(sum[c], scale);
+            sum[c] += add[c] - sub[c];
+        }
+    }
+}
+
+void box_blur_step_scalar(uint32_t *sums, uint8_t *dst, const uint8_t *add, const uint8_t *sub, size_t count, int radius) {
+    const uint32_t scale = box_blur_scale(radius);
+    for (size_t i = 0; i < count; i++) {
+        dst[i] = box_blur_average(sums[i], scale);
+        sums[i] += add[i] - sub[i];
+    }
+}
+
+#ifdef KERNELS_X86
+
+// SSE2. Every loop does as many whole vectors as it can and leaves the rest to the scalar version
+
+void rgba8_to_float_sse2(const uint8_t *src, float *dst, size_t pixels) {
+    const __m128 scale = _mm_set1_ps(1.0f / 255);
+    const __m128i zero = _mm_setzero_si128();
+    size_t i = 0;
+    for (; i + 4 <= pixels; i += 4) {
+        __m128i bytes = _mm_loadu_si128((const __m128i*)&src[i*4]);
+        __m128i lo = _mm_unpacklo_epi8(bytes, zero);
+        __m128i hi = _mm_unpackhi_epi8(bytes, zero);
+        _mm_storeu_ps(&dst[i*4 + 0], _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(lo, zero)), scale));
+        _mm_storeu_ps(&dst[i*4 + 4], _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(lo, zero)), scale));
+        _mm_storeu_ps(&dst[i*4 + 8], _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(hi, zero)), scale));
+        _mm_storeu_ps(&dst[i*4 + 12], _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(hi, zero)), scale));
+    }
+    rgba8_to_float_scalar(&src[i*4], &dst[i*4], pixels - i);
+}
+
+void float_to_rgba8_sse2(const float *src, uint8_t *dst, size_t pixels) {
+    const __m128 scale = _mm_set1_ps(255);
+    size_t i = 0;
+    for (; i + 4 <= pixels; i += 4) {
+        // The saturating packs do the clamping
+        __m128i a = _mm_cvtps_epi32(_mm_mul_ps(_mm_loadu_ps(&src[i*4 + 0]), scale));
+        __m128i b = _mm_cvtps_epi32(_mm_mul_ps(_mm_loadu_ps(&src[i*4 + 4]), scale));
+        __m128i c = _mm_cvtps_epi32(_mm_mul_ps(_mm_loadu_ps(&src[i*4 + 8]), scale));
+        __m128i d = _mm_cvtps_epi32(_mm_mul_ps(_mm_loadu_ps(&src[i*4 + 12]), scale));
+        __m128i bytes = _mm_packus_epi16(_mm_packs_epi32(a, b), _mm_packs_epi32(c, d));
+        _mm_storeu_si128((__m128i*)&dst[i*4], bytes);
+    }
+    float_to_rgba8_scalar(&src[i*4], &dst[i*4], pixels - i);
+}
+
+// Multiplies the color channels of 2 pixels widened to 16 bits by their alpha
+static inline __m128i premultiply_epi16_sse2(__m128i pixels) {
+    const __m128i alpha_mask = _mm_set_epi16(-1, 0, 0, 0, -1, 0, 0, 0);
+    const __m128i alpha_one = _mm_set_epi16(255, 0, 0, 0, 255, 0, 0, 0);
+    __m128i alpha = _mm_shufflehi_epi16(_mm_shufflelo_epi16(pixels, 0xFF), 0xFF);
+    // Alpha itself gets multiplied by 255/255
+    alpha = _mm_or_si128(_mm_andnot_si128(alpha_mask, alpha), alpha_one);
+    __m128i x = _mm_add_epi16(_mm_mullo_epi16(pixels, alpha), _mm_set1_epi16(128));
+    return _mm_srli_epi16(_mm_add_epi16(x, _mm_srli_epi16(x, 8)), 8);
+}
+
+void premultiply_sse2(uint8_t *pixels, size_t count) {
+    const __m128i zero = _mm_setzero_si128();
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m128i bytes = _mm_loadu_si128((const __m128i*)&pixels[i*4]);
+        __m128i lo = premultiply_epi16_sse2(_mm_unpacklo_epi8(bytes, zero));
+        __m128i hi = premultiply_epi16_sse2(_mm_unpackhi_epi8(bytes, zero));
+        _mm_storeu_si128((__m128i*)&pixels[i*4], _mm_packus_epi16(lo, hi));
+    }
+    premultiply_scalar(&pixels[i*4], count - i);
+}
+
+// One pixel as floats
+static inline __m128 unpremultiply_ps_sse2(__m128 pixel) {
+    const __m128 alpha_mask = _mm_castsi128_ps(_mm_set_epi32(-1, 0, 0, 0));
+    __m128 alpha = _mm_shuffle_ps(pixel, pixel, 0xFF);
+    __m128 scale = _mm_div_ps(_mm_set1_ps(255), _mm_max_ps(alpha, _mm_set1_ps(1)));
+    // Alpha itself and fully transparent pixels are left as they are, like unpremultiply_scalar() does
+    __m128 keep = _mm_or_ps(alpha_mask, _mm_cmpeq_ps(alpha, _mm_setzero_ps()));
+    scale = _mm_or_ps(_mm_andnot_ps(keep, scale), _mm_and_ps(keep, _mm_set1_ps(1)));
+    return _mm_mul_ps(pixel, scale);
+}
+
+void unpremultiply_sse2(uint8_t *pixels, size_t count) {
+    const __m128i zero = _mm_setzero_si128();
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m128i bytes = _mm_loadu_si128((const __m128i*)&pixels[i*4]);
+        __m128i lo = _mm_unpacklo_epi8(bytes, zero);
+        __m128i hi = _mm_unpackhi_epi8(bytes, zero);
+        __m128i a = _mm_cvttps_epi32(_mm_add_ps(unpremultiply_ps_sse2(_mm_cvtepi32_ps(_mm_unpacklo_epi16(lo, zero))), _mm_set1_ps(0.5f)));
+        __m128i b = _mm_cvttps_epi32(_mm_add_ps(unpremultiply_ps_sse2(_mm_cvtepi32_ps(_mm_unpackhi_epi16(lo, zero))), _mm_set1_ps(0.5f)));
+        __m128i c = _mm_cvttps_epi32(_mm_add_ps(unpremultiply_ps_sse2(_mm_cvtepi32_ps(_mm_unpacklo_epi16(hi, zero))), _mm_set1_ps(0.5f)));
+        __m128i d = _mm_cvttps_epi32(_mm_add_ps(unpremultiply_ps_sse2(_mm_cvtepi32_ps(_mm_unpackhi_epi16(hi, zero))), _mm_set1_ps(0.5f)));
+        _mm_storeu_si128((__m128i*)&pixels[i*4], _mm_packus_epi16(_mm_packs_epi32(a, b), _mm_packs_epi32(c, d)));
+    }
+    unpremultiply_scalar(&pixels[i*4], count - i);
+}
+
+void convolve_row_sse2(const float *src, float *dst, size_t width, const float *weights, int radius) {
+    size_t x = 0;
+    // Only the pixels whose taps are all inside of the row go through the vector loop
+    for (; x < width && x < (size_t)radius; x++) convolve_pixel_scalar(src, dst, width, weights, radius, x);
+    for (; x + radius < width; x++) {
+        const float *p = &src[(x - radius) * 4];
+        __m128 sum = _mm_setzero_ps();
+        for (int k = 0; k <= 2*radius; k++) {
+            sum = _mm_add_ps(sum, _mm_mul_ps(_mm_set1_ps(weights[k]), _mm_loadu_ps(&p[k*4])));
+        }
+        _mm_storeu_ps(&dst[x*4], sum);
+    }
+    for (; x < width; x++) convolve_pixel_scalar(src, dst, width, weights, radius, x);
+}
+
+void accumulate_row_sse2(float *dst, const float *src, size_t count, float weight) {
+    const __m128 w = _mm_set1_ps(weight);
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        _mm_storeu_ps(&dst[i], _mm_add_ps(_mm_loadu_ps(&dst[i]), _mm_mul_ps(w, _mm_loadu_ps(&src[i]))));
+    }
+    accumulate_row_scalar(&dst[i], &src[i], count - i, weight);
+}
+
+void resample_row_sse2(const float *src, float *dst, size_t dst_width, const int *starts, const float *weights, int taps) {
+    for (size_t x = 0; x < dst_width; x++) {
+        const float *p = &src[starts[x] * 4];
+        const float *w = &weights[x * taps];
+        __m128 sum = _mm_setzero_ps();
+        for (int k = 0; k < taps; k++) {
+            sum = _mm_add_ps(sum, _mm_mul_ps(_mm_set1_ps(w[k]), _mm_loadu_ps(&p[k*4])));
+        }
+        _mm_storeu_ps(&dst[x*4], sum);
+    }
+}
+
+void color_matrix_sse2(uint8_t *pixels, size_t count, const float matrix[20]) {
+    // Columns of the matrix, so that a pixel is 4 multiply-adds of a column by one of its channels broadcast
+    __m128 columns[5];
+    for (int k = 0; k < 5; k++) {
+        // The channels stay in 0-255, so the offset has to be scaled to match
+        float scale = k == 4 ? 255 : 1;
+        columns[k] = _mm_setr_ps(matrix[0*5 + k] * scale, matrix[1*5 + k] * scale, matrix[2*5 + k] * scale, matrix[3*5 + k] * scale);
+    }
+    const __m128i zero = _mm_setzero_si128();
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m128i bytes = _mm_loadu_si128((const __m128i*)&pixels[i*4]);
+        __m128i lo = _mm_unpacklo_epi8(bytes, zero);
+        __m128i hi = _mm_unpackhi_epi8(bytes, zero);
+        __m128i in[4] = {
+            _mm_unpacklo_epi16(lo, zero), _mm_unpackhi_epi16(lo, zero),
+            _mm_unpacklo_epi16(hi, zero), _mm_unpackhi_epi16(hi, zero),
+        };
+        __m128i out[4];
+        for (int j = 0; j < 4; j++) {
+            __m128 p = _mm_cvtepi32_ps(in[j]);
+            __m128 sum = columns[4];
+            sum = _mm_add_ps(sum, _mm_mul_ps(columns[0], _mm_shuffle_ps(p, p, 0x00)));
+            sum = _mm_add_ps(sum, _mm_mul_ps(columns[1], _mm_shuffle_ps(p, p, 0x55)));
+            sum = _mm_add_ps(sum, _mm_mul_ps(columns[2], _mm_shuffle_ps(p, p, 0xAA)));
+            sum = _mm_add_ps(sum, _mm_mul_ps(columns[3], _mm_shuffle_ps(p, p, 0xFF)));
+            out[j] = _mm_cvtps_epi32(sum);
+        }
+        _mm_storeu_si128((__m128i*)&pixels[i*4], _mm_packus_epi16(_mm_packs_epi32(out[0], out[1]), _mm_packs_epi32(out[2], out[3])));
+    }
+    color_matrix_scalar(&pixels[i*4], count - i, matrix);
+}
+
+void match_color_sse2(const uint8_t *pixels, size_t count, const uint8_t color[4], uint8_t tolerance, uint8_t *mask) {
+    uint32_t packed;
+    memcpy(&packed, color, sizeof(packed));
+    const __m128i c = _mm_set1_epi32(packed);
+    const __m128i t = _mm_set1_epi8(tolerance);
+    const __m128i zero = _mm_setzero_si128();
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        __m128i eq[4];
+        for (int j = 0; j < 4; j++) {
+            __m128i p = _mm_loadu_si128((const __m128i*)&pixels[(i + j*4) * 4]);
+            // |p - c| of unsigned bytes, then whatever is left above the tolerance
+            __m128i diff = _mm_or_si128(_mm_subs_epu8(p, c), _mm_subs_epu8(c, p));
+            eq[j] = _mm_cmpeq_epi32(_mm_subs_epu8(diff, t), zero);
+        }
+        __m128i bytes = _mm_packs_epi16(_mm_packs_epi32(eq[0], eq[1]), _mm_packs_epi32(eq[2], eq[3]));
+        _mm_storeu_si128((__m128i*)&mask[i], bytes);
+    }
+    match_color_scalar(&pixels[i*4], count - i, color, tolerance, &mask[i]);
+}
+
+// Low 32 bits of the products of 4 unsigned ints. _mm_mullo_epi32() is SSE4.1, SSE2 only multiplies the even lanes
+static inline __m128i mullo_epi32_sse2(__m128i x, __m128i y) {
+    __m128i even = _mm_mul_epu32(x, y);
+    __m128i odd = _mm_mul_epu32(_mm_srli_epi64(x, 32), _mm_srli_epi64(y, 32));
+    return _mm_unpacklo_epi32(_mm_shuffle_epi32(even, 0x08), _mm_shuffle_epi32(odd, 0x08));
+}
+
+// Same as box_blur_average() before the clamping, which the saturating packs take care of
+static inline __m128i box_blur_average_sse2(__m128i sums, __m128i scale) {
+    return _mm_srli_epi32(_mm_add_epi32(mullo_epi32_sse2(sums, scale), _mm_set1_epi32(1 << 15)), 16);
+}
+
+static inline __m128i load_pixel_epi32_sse2(const uint8_t *pixel) {
+    const __m128i zero = _mm_setzero_si128();
+    int32_t bits;
+    memcpy(&bits, pixel, sizeof(bits));
+    return _mm_unpacklo_epi16(_mm_unpacklo_epi8(_mm_cvtsi32_si128(bits), zero), zero);
+}
+
+// One pixel per vector, as every one depends on the sum of the one before
+void box_blur_row_sse2(const uint8_t *src, uint8_t *dst, size_t width, int radius) {
+    const __m128i scale = _mm_set1_epi32(box_blur_scale(radius));
+    __m128i sum = mullo_epi32_sse2(load_pixel_epi32_sse2(src), _mm_set1_epi32(radius + 1));
+    for (int k = 1; k <= radius; k++) sum = _mm_add_epi32(sum, load_pixel_epi32_sse2(&src[clamp_index(k, width) * 4]));
+    for (size_t x = 0; x < width; x++) {
+        __m128i average = box_blur_average_sse2(sum, scale);
+        average = _mm_packs_epi32(average, average);
+        int32_t bits = _mm_cvtsi128_si32(_mm_packus_epi16(average, average));
+        memcpy(&dst[x*4], &bits, sizeof(bits));
+        __m128i add = load_pixel_epi32_sse2(&src[clamp_index((ptrdiff_t)x + radius + 1, width) * 4]);
+        __m128i sub = load_pixel_epi32_sse2(&src[clamp_index((ptrdiff_t)x - radius, width) * 4]);
+        sum = _mm_add_epi32(sum, _mm_sub_epi32(add, sub));
+    }
+}
+
+void box_blur_step_sse2(uint32_t *sums, uint8_t *dst, const uint8_t *add, const uint8_t *sub, size_t count, int radius) {
+    const __m128i scale = _mm_set1_epi32(box_blur_scale(radius));
+    const __m128i zero = _mm_setzero_si128();
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        __m128i added = _mm_loadu_si128((const __m128i*)&add[i]);
+        __m128i subtracted = _mm_loadu_si128((const __m128i*)&sub[i]);
+        __m128i diff_lo = _mm_sub_epi16(_mm_unpacklo_epi8(added, zero), _mm_unpacklo_epi8(subtracted, zero));
+        __m128i diff_hi = _mm_sub_epi16(_mm_unpackhi_epi8(added, zero), _mm_unpackhi_epi8(subtracted, zero));
+        // Sign extended to 32 bits
+        __m128i diffs[4] = {
+            _mm_srai_epi32(_mm_unpacklo_epi16(diff_lo, diff_lo), 16),
+            _mm_srai_epi32(_mm_unpackhi_epi16(diff_lo, diff_lo), 16),
+            _mm_srai_epi32(_mm_unpacklo_epi16(diff_hi, diff_hi), 16),
+            _mm_srai_epi32(_mm_unpackhi_epi16(diff_hi, diff_hi), 16),
+        };
+        __m128i averages[4];
+        for (int j = 0; j < 4; j++) {
+            __m128i s = _mm_loadu_si128((const __m128i*)&sums[i + j*4]);
+            averages[j] = box_blur_average_sse2(s, scale);
+            _mm_storeu_si128((__m128i*)&sums[i + j*4], _mm_add_epi32(s, diffs[j]));
+        }
+        __m128i bytes = _mm_packus_epi16(_mm_packs_epi32(averages[0], averages[1]), _mm_packs_epi32(averages[2], averages[3]));
+        _mm_storeu_si128((__m128i*)&dst[i], bytes);
+    }
+    box_blur_step_scalar(&sums[i], &dst[i], &add[i], &sub[i], count - i, radius);
+}
+
+// AVX2. Same idea with twice the width. Most instructions work within each 128-bit lane, hence the permutes after the
+// packs
+
+TARGET_AVX2 void rgba8_to_float_avx2(const uint8_t *src, float *dst, size_t pixels) {
+    const __m256 scale = _mm256_set1_ps(1.0f / 255);
+    size_t i = 0;
+    for (; i + 2 <= pixels; i += 2) {
+        __m256i ints = _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i*)&src[i*4]));
+        _mm256_storeu_ps(&dst[i*4], _mm256_mul_ps(_mm256_cvtepi32_ps(ints), scale));
+    }
+    rgba8_to_float_scalar(&src[i*4], &dst[i*4], pixels - i);
+}
+
+TARGET_AVX2 void float_to_rgba8_avx2(const float *src, uint8_t *dst, size_t pixels) {
+    const __m256 scale = _mm256_set1_ps(255);
+    const __m256i order = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+    size_t i = 0;
+    for (; i + 8 <= pixels; i += 8) {
+        __m256i a = _mm256_cvtps_epi32(_mm256_mul_ps(_mm256_loadu_ps(&src[i*4 + 0]), scale));
+        __m256i b = _mm256_cvtps_epi32(_mm256_mul_ps(_mm256_loadu_ps(&src[i*4 + 8]), scale));
+        __m256i c = _mm256_cvtps_epi32(_mm256_mul_ps(_mm256_loadu_ps(&src[i*4 + 16]), scale));
+        __m256i d = _mm256_cvtps_epi32(_mm256_mul_ps(_mm256_loadu_ps(&src[i*4 + 24]), scale));
+        __m256i bytes = _mm256_packus_epi16(_mm256_packs_epi32(a, b), _mm256_packs_epi32(c, d));
+        _mm256_storeu_si256((__m256i*)&dst[i*4], _mm256_permutevar8x32_epi32(bytes, order));
+    }
+    float_to_rgba8_scalar(&src[i*4], &dst[i*4], pixels - i);
+}
+
+TARGET_AVX2 void rgb8_to_rgba8_avx2(const uint8_t *src, uint8_t *dst, size_t pixels) {
+    // 4 pixels per lane: 12 bytes of RGB spread out into 16 with a hole for alpha
+    const __m256i shuffle = _mm256_setr_epi8(
+        0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1,
+        0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1);
+    const __m256i alpha = _mm256_set1_epi32(0xFF000000);
+    size_t i = 0;
+    // Each lane loads 16 bytes but uses only 12, so stay far enough from the end not to read past it
+    for (; i + 10 <= pixels; i += 8) {
+        __m128i lo = _mm_loadu_si128((const __m128i*)&src[i*3]);
+        __m128i hi = _mm_loadu_si128((const __m128i*)&src[i*3 + 12]);
+        __m256i rgb = _mm256_inserti128_si256(_mm256_castsi128_si256(lo), hi, 1);
+        _mm256_storeu_si256((__m256i*)&dst[i*4], _mm256_or_si256(_mm256_shuffle_epi8(rgb, shuffle), alpha));
+    }
+    rgb8_to_rgba8_scalar(&src[i*3], &dst[i*4], pixels - i);
+}
+
+TARGET_AVX2 static inline __m256i premultiply_epi16_avx2(__m256i pixels) {
+    const __m256i alpha_mask = _mm256_set_epi16(-1, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0);
+    const __m256i alpha_one = _mm256_set_epi16(255, 0, 0, 0, 255, 0, 0, 0, 255, 0, 0, 0, 255, 0, 0, 0);
+    __m256i alpha = _mm256_shufflehi_epi16(_mm256_shufflelo_epi16(pixels, 0xFF), 0xFF);
+    alpha = _mm256_or_si256(_mm256_andnot_si256(alpha_mask, alpha), alpha_one);
+    __m256i x = _mm256_add_epi16(_mm256_mullo_epi16(pixels, alpha), _mm256_set1_epi16(128));
+    return _mm256_srli_epi16(_mm256_add_epi16(x, _mm256_srli_epi16(x, 8)), 8);
+}
+
+TARGET_AVX2 void premultiply_avx2(uint8_t *pixels, size_t count) {
+    const __m256i zero = _mm256_setzero_si256();
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256i bytes = _mm256_loadu_si256((const __m256i*)&pixels[i*4]);
+        __m256i lo = premultiply_epi16_avx2(_mm256_unpacklo_epi8(bytes, zero));
+        __m256i hi = premultiply_epi16_avx2(_mm256_unpackhi_epi8(bytes, zero));
+        _mm256_storeu_si256((__m256i*)&pixels[i*4], _mm256_packus_epi16(lo, hi));
+    }
+    premultiply_scalar(&pixels[i*4], count - i);
+}
+
+// Two pixels as floats, one per lane
+TARGET_AVX2 static inline __m256i unpremultiply_epi32_avx2(__m256i pixels) {
+    const __m256 alpha_mask = _mm256_castsi256_ps(_mm256_setr_epi32(0, 0, 0, -1, 0, 0, 0, -1));
+    __m256 p = _mm256_cvtepi32_ps(pixels);
+    __m256 alpha = _mm256_shuffle_ps(p, p, 0xFF);
+    __m256 scale = _mm256_div_ps(_mm256_set1_ps(255), _mm256_max_ps(alpha, _mm256_set1_ps(1)));
+    __m256 keep = _mm256_or_ps(alpha_mask, _mm256_cmp_ps(alpha, _mm256_setzero_ps(), _CMP_EQ_OQ));
+    scale = _mm256_blendv_ps(scale, _mm256_set1_ps(1), keep);
+    return _mm256_cvttps_epi32(_mm256_add_ps(_mm256_mul_ps(p, scale), _mm256_set1_ps(0.5f)));
+}
+
+TARGET_AVX2 void unpremultiply_avx2(uint8_t *pixels, size_t count) {
+    const __m256i order = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256i a = unpremultiply_epi32_avx2(_mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i*)&pixels[i*4 + 0])));
+        __m256i b = unpremultiply_epi32_avx2(_mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i*)&pixels[i*4 + 8])));
+        __m256i c = unpremultiply_epi32_avx2(_mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i*)&pixels[i*4 + 16])));
+        __m256i d = unpremultiply_epi32_avx2(_mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i*)&pixels[i*4 + 24])));
+        __m256i bytes = _mm256_packus_epi16(_mm256_packs_epi32(a, b), _mm256_packs_epi32(c, d));
+        _mm256_storeu_si256((__m256i*)&pixels[i*4], _mm256_permutevar8x32_epi32(bytes, order));
+    }
+    unpremultiply_scalar(&pixels[i*4], count - i);
+}
+
+TARGET_AVX2 void convolve_row_avx2(const float *src, float *dst, size_t width, const float *weights, int radius) {
+    size_t x = 0;
+    for (; x < width && x < (size_t)radius; x++) convolve_pixel_scalar(src, dst, width, weights, radius, x);
+    // Two neighbouring pixels at once, their taps are neighbours too
+    for (; x + 1 + radius < width; x += 2) {
+        const float *p = &src[(x - radius) * 4];
+        __m256 sum = _mm256_setzero_ps();
+        for (int k = 0; k <= 2*radius; k++) {
+            sum = _mm256_add_ps(sum, _mm256_mul_ps(_mm256_set1_ps(weights[k]), _mm256_loadu_ps(&p[k*4])));
+        }
+        _mm256_storeu_ps(&dst[x*4], sum);
+    }
+    for (; x < width; x++) convolve_pixel_scalar(src, dst, width, weights, radius, x);
+}
+
+TARGET_AVX2 void accumulate_row_avx2(float *dst, const float *src, size_t count, float weight) {
+    const __m256 w = _mm256_set1_ps(weight);
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        _mm256_storeu_ps(&dst[i], _mm256_add_ps(_mm256_loadu_ps(&dst[i]), _mm256_mul_ps(w, _mm256_loadu_ps(&src[i]))));
+    }
+    accumulate_row_scalar(&dst[i], &src[i], count - i, weight);
+}
+
+TARGET_AVX2 void color_matrix_avx2(uint8_t *pixels, size_t count, const float matrix[20]) {
+    __m256 columns[5];
+    for (int k = 0; k < 5; k++) {
+        float scale = k == 4 ? 255 : 1;
+        __m128 column = _mm_setr_ps(matrix[0*5 + k] * scale, matrix[1*5 + k] * scale, matrix[2*5 + k] * scale, matrix[3*5 + k] * scale);
+        columns[k] = _mm256_insertf128_ps(_mm256_castps128_ps256(column), column, 1);
+    }
+    const __m256i order = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256i out[4];
+        for (int j = 0; j < 4; j++) {
+            __m256 p = _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i*)&pixels[i*4 + j*8])));
+            __m256 sum = columns[4];
+            sum = _mm256_add_ps(sum, _mm256_mul_ps(columns[0], _mm256_shuffle_ps(p, p, 0x00)));
+            sum = _mm256_add_ps(sum, _mm256_mul_ps(columns[1], _mm256_shuffle_ps(p, p, 0x55)));
+            sum = _mm256_add_ps(sum, _mm256_mul_ps(columns[2], _mm256_shuffle_ps(p, p, 0xAA)));
+            sum = _mm256_add_ps(sum, _mm256_mul_ps(columns[3], _mm256_shuffle_ps(p, p, 0xFF)));
+            out[j] = _mm256_cvtps_epi32(sum);
+        }
+        __m256i bytes = _mm256_packus_epi16(_mm256_packs_epi32(out[0], out[1]), _mm256_packs_epi32(out[2], out[3]));
+        _mm256_storeu_si256((__m256i*)&pixels[i*4], _mm256_permutevar8x32_epi32(bytes, order));
+    }
+    color_matrix_scalar(&pixels[i*4], count - i, matrix);
+}
+
+TARGET_AVX2 void match_color_avx2(const uint8_t *pixels, size_t count, const uint8_t color[4], uint8_t tolerance, uint8_t *mask) {
+    uint32_t packed;
+    memcpy(&packed, color, sizeof(packed));
+    const __m256i c = _mm256_set1_epi32(packed);
+    const __m256i t = _mm256_set1_epi8(tolerance);
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i order = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+    size_t i = 0;
+    for (; i + 32 <= count; i += 32) {
+        __m256i eq[4];
+        for (int j = 0; j < 4; j++) {
+            __m256i p = _mm256_loadu_si256((const __m256i*)&pixels[(i + j*8) * 4]);
+            __m256i diff = _mm256_or_si256(_mm256_subs_epu8(p, c), _mm256_subs_epu8(c, p));
+            eq[j] = _mm256_cmpeq_epi32(_mm256_subs_epu8(diff, t), zero);
+        }
+        __m256i bytes = _mm256_packs_epi16(_mm256_packs_epi32(eq[0], eq[1]), _mm256_packs_epi32(eq[2], eq[3]));
+        _mm256_storeu_si256((__m256i*)&mask[i], _mm256_permutevar8x32_epi32(bytes, order));
+    }
+    match_color_scalar(&pixels[i*4], count - i, color, tolerance, &mask[i]);
+}
+
+
+// Running sums along a row don't get any wider, so box_blur_row stays the SSE2 one
+TARGET_AVX2 void box_blur_step_avx2(uint32_t *sums, uint8_t *dst, const uint8_t *add, const uint8_t *sub, size_t count, int radius) {
+    const __m256i scale = _mm256_set1_epi32(box_blur_scale(radius));
+    const __m256i half = _mm256_set1_epi32(1 << 15);
+    const __m256i order = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+    size_t i = 0;
+    for (; i + 32 <= count; i += 32) {
+        __m256i averages[4];
+        for (int j = 0; j < 4; j++) {
+            __m256i added = _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i*)&add[i + j*8]));
+            __m256i subtracted = _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i*)&sub[i + j*8]));
+            __m256i s = _mm256_loadu_si256((const __m256i*)&sums[i + j*8]);
+            averages[j] = _mm256_srli_epi32(_mm256_add_epi32(_mm256_mullo_epi32(s, scale), half), 16);
+            _mm256_storeu_si256((__m256i*)&sums[i + j*8], _mm256_add_epi32(s, _mm256_sub_epi32(added, subtracted)));
+        }
+        __m256i bytes = _mm256_packus_epi16(_mm256_packs_epi32(averages[0], averages[1]), _mm256_packs_epi32(averages[2], averages[3]));
+        _mm256_storeu_si256((__m256i*)&dst[i], _mm256_permutevar8x32_epi32(bytes, order));
+    }
+    box_blur_step_scalar(&sums[i], &dst[i], &add[i], &sub[i], count - i, radius);
+}
+
+#endif // KERNELS_X86
+
+// Kernels of a level, falling back to the level below for the ones that don't have a version of their own
+Kernels kernels_for_level(Kernel_Level level) {
+    Kernels k = {
+        .level = KERNEL_LEVEL_SCALAR,
+        .rgba8_to_float = rgba8_to_float_scalar,
+        .float_to_rgba8 = float_to_rgba8_scalar,
+        .rgb8_to_rgba8 = rgb8_to_rgba8_scalar,
+        .premultiply = premultiply_scalar,
+        .unpremultiply = unpremultiply_scalar,
+        .convolve_row = convolve_row_scalar,
+        .accumulate_row = accumulate_row_scalar,
+        .resample_row = resample_row_scalar,
+        .color_matrix = color_matrix_scalar,
+        .histogram = histogram_scalar,
+        .match_color = match_color_scalar,
+        .box_blur_row = box_blur_row_scalar,
+        .box_blur_step = box_blur_step_scalar,
+    };
+#ifdef KERNELS_X86
+    if (level >= KERNEL_LEVEL_SSE2) {
+        k.level = KERNEL_LEVEL_SSE2;
+        k.rgba8_to_float = rgba8_to_float_sse2;
+        k.float_to_rgba8 = float_to_rgba8_sse2;
+        k.premultiply = premultiply_sse2;
+        k.unpremultiply = unpremultiply_sse2;
+        k.convolve_row = convolve_row_sse2;
+        k.accumulate_row = accumulate_row_sse2;
+        k.resample_row = resample_row_sse2;
+        k.color_matrix = color_matrix_sse2;
+        k.match_color = match_color_sse2;
+        k.box_blur_row = box_blur_row_sse2;
+        k.box_blur_step = box_blur_step_sse2;
+    }
+    if (level >= KERNEL_LEVEL_AVX2) {
+        k.level = KERNEL_LEVEL_AVX2;
+        k.rgba8_to_float = rgba8_to_float_avx2;
+        k.float_to_rgba8 = float_to_rgba8_avx2;
+        k.rgb8_to_rgba8 = rgb8_to_rgba8_avx2;
+        k.premultiply = premultiply_avx2;
+        k.unpremultiply = unpremultiply_avx2;
+        k.convolve_row = convolve_row_avx2;
+        k.accumulate_row = accumulate_row_avx2;
+        k.color_matrix = color_matrix_avx2;
+        k.match_color = match_color_avx2;
+        k.box_blur_step = box_blur_step_avx2;
+    }
+#else
+    UNUSED(level);
+#endif // KERNELS_X86
+    return k;
+}
+
+// The best level this CPU supports
+Kernel_Level kernels_detect_level(void) {
+#ifdef KERNELS_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) return KERNEL_LEVEL_AVX2;
+    if (__builtin_cpu_supports("sse2")) return KERNEL_LEVEL_SSE2;
+#endif // KERNELS_X86
+    return KERNEL_LEVEL_SCALAR;
+}
+
+void kernels_init(void) {
+    Kernel_Level level = kernels_detect_level();
+    const char *forced = getenv("SIMP_KERNELS");
+    if (forced != NULL) {
+        for (Kernel_Level l = 0; l < COUNT_KERNEL_LEVELS; l++) {
+            if (strcmp(forced, kernel_level_as_cstr(l)) == 0 && l <= level) level = l;
+        }
+    }
+    kernels = kernels_for_level(level);
+    nob_log(INFO, "Using %s CPU kernels", kernel_level_as_cstr(kernels.level));
+}
+
+// Everything below is built out of the kernels above
+
+void kernel_flip_vertical(void *pixels, size_t row_size, size_t rows) {
+    uint8_t *bytes = pixels;
+    uint8_t *tmp = malloc(row_size);
+    for (size_t y = 0; y < rows / 2; y++) {
+        uint8_t *top = &bytes[y * row_size];
+        uint8_t *bottom = &bytes[(rows - 1 - y) * row_size];
+        memcpy(tmp, top, row_size);
+        memcpy(top, bottom, row_size);
+        memcpy(bottom, tmp, row_size);
+    }
+    free(tmp);
+}
+
+// `weights` gets 2*radius + 1 of them, summing up to 1
+void kernel_gaussian_weights(float sigma, int radius, float *weights) {
+    float total = 0;
+    for (int k = -radius; k <= radius; k++) {
+        float weight = sigma > 0 ? expf(-k*k / (2*sigma*sigma)) : k == 0;
+        weights[k + radius] = weight;
+        total += weight;
+    }
+    for (int k = 0; k <= 2*radius; k++) weights[k] /= total;
+}
+
+// Convolves a float image in place with `weights` along both axes. Edge pixels are repeated outwards
+void kernel_convolve(float *pixels, size_t width, size_t height, const float *weights, int radius) {
+    size_t row = width * 4;
+    float *tmp = malloc(width * height * 4 * sizeof(float));
+    for (size_t y = 0; y < height; y++) kernels.convolve_row(&pixels[y * row], &tmp[y * row], width, weights, radius);
+    for (size_t y = 0; y < height; y++) {
+        float *dst = &pixels[y * row];
+        memset(dst, 0, row * sizeof(float));
+        for (int k = 0; k <= 2*radius; k++) {
+            kernels.accumulate_row(dst, &tmp[clamp_index((ptrdiff_t)y + k - radius, height) * row], row, weights[k]);
+        }
+    }
+    free(tmp);
+}
+
+// Box blurs an RGBA8 image in place along both axes, with the edge pixels repeated outwards. The columns are done a row
+// at a time, with a running sum for each byte of the row
+void kernel_box_blur(uint8_t *pixels, size_t width, size_t height, int radius) {
+    size_t row = width * 4;
+    uint8_t *tmp = malloc(row * height);
+    uint32_t *sums = malloc(row * sizeof(*sums));
+    for (size_t y = 0; y < height; y++) kernels.box_blur_row(&pixels[y * row], &tmp[y * row], width, radius);
+    for (size_t i = 0; i < row; i++) sums[i] = tmp[i] * (radius + 1);
+    for (int k = 1; k <= radius; k++) {
+        const uint8_t *src = &tmp[clamp_index(k, height) * row];
+        for (size_t i = 0; i < row; i++) sums[i] += src[i];
+    }
+    for (size_t y = 0; y < height; y++) {
+        const uint8_t *add = &tmp[clamp_index((ptrdiff_t)y + radius + 1, height) * row];
+        const uint8_t *sub = &tmp[clamp_index((ptrdiff_t)y - radius, height) * row];
+        kernels.box_blur_step(sums, &pixels[y * row], add, sub, row, radius);
+    }
+    free(sums);
+    free(tmp);
+}
+
+typedef enum {
+    // Cheap and smooth, fine for small changes of size
+    RESIZE_TENT,
+    // The sharpest, but rings a little around hard edges
+    RESIZE_LANCZOS3,
+    // Average of everything under each output pixel. No ringing at all, best for shrinking by a lot
+    RESIZE_AREA,
+    COUNT_RESIZE_FILTERS,
+} Resize_Filter;
+
+const char *resize_filter_as_cstr(Resize_Filter filter) {
+    static_assert(COUNT_RESIZE_FILTERS == 3, "Please update after adding a new resize filter");
+    switch (filter) {
+        case RESIZE_TENT: return "Tent";
+        case RESIZE_LANCZOS3: return "Lanczos";
+        case RESIZE_AREA: return "Area";
+        default: UNREACHABLE("invalid resize filter");
+    }
+}
+
+// Weight of a source pixel that is `pixel` output pixels wide and `distance` output pixels away from the center of the
+// output pixel
+float resize_filter_weight(Resize_Filter filter, float distance, float pixel) {
+    static_assert(COUNT_RESIZE_FILTERS == 3, "Exhaustive handling of resize filters in resize_filter_weight");
+    switch (filter) {
+        case RESIZE_TENT:
+            return fmaxf(1 - fabsf(distance), 0);
+        case RESIZE_LANCZOS3: {
+            if (distance == 0) return 1;
+            if (fabsf(distance) >= 3) return 0;
+            float x = 3.14159265f * distance;
+            return 3 * sinf(x) * sinf(x / 3) / (x * x);
+        }
+        case RESIZE_AREA:
+            // How much of the source pixel the output pixel covers
+            return fmaxf(fminf(distance + pixel / 2, 0.5f) - fmaxf(distance - pixel / 2, -0.5f), 0);
+        default: UNREACHABLE("invalid resize filter");
+    }
+}
+
+// How far from the center of an output pixel the source pixels still have some weight, in output pixels
+float resize_filter_support(Resize_Filter filter) {
+    static_assert(COUNT_RESIZE_FILTERS == 3, "Exhaustive handling of resize filters in resize_filter_support");
+    switch (filter) {
+        case RESIZE_TENT: return 1;
+        case RESIZE_LANCZOS3: return 3;
+        case RESIZE_AREA: return 1;
+        default: UNREACHABLE("invalid resize filter");
+    }
+}
+
+typedef struct {
+    int taps;
+    int *starts;
+    float *weights;
+} Resample_Plan;
+
+// When shrinking, the filter is stretched over the source pixels under each output pixel, so that every one of them
+// contributes and nothing aliases
+Resample_Plan resample_plan(size_t src_size, size_t dst_size, Resize_Filter filter) {
+    float scale = (float)src_size / dst_size;
+    float stretch = scale > 1 ? scale : 1;
+    float support = resize_filter_support(filter) * stretch;
+    Resample_Plan plan = { .taps = (int)ceilf(support) * 2 + 1 };
+    if ((size_t)plan.taps > src_size) plan.taps = src_size;
+    plan.starts = malloc(dst_size * sizeof(int));
+    plan.weights = malloc(dst_size * plan.taps * sizeof(float));
+    for (size_t x = 0; x < dst_size; x++) {
+        float center = (x + 0.5f) * scale - 0.5f;
+        int start = (int)floorf(center - support) + 1;
+        if (start < 0) start = 0;
+        if (start + plan.taps > (int)src_size) start = src_size - plan.taps;
+        plan.starts[x] = start;
+        float *w = &plan.weights[x * plan.taps];
+        float total = 0;
+        for (int k = 0; k < plan.taps; k++) {
+            w[k] = resize_filter_weight(filter, (start + k - center) / stretch, 1 / stretch);
+            total += w[k];
+        }
+        for (int k = 0; k < plan.taps; k++) w[k] /= total;
+    }
+    return plan;
+}
+
+void resample_plan_free(Resample_Plan plan) {
+    free(plan.starts);
+    free(plan.weights);
+}
+
+// Sums up the rows of `tmp` (already resampled horizontally to `row` floats each) into output row `y`
+static inline void resample_column(const float *tmp, float *out, size_t row, Resample_Plan vertical, size_t y) {
+    memset(out, 0, row * sizeof(float));
+    const float *w = &vertical.weights[y * vertical.taps];
+    for (int k = 0; k < vertical.taps; k++) {
+        if (w[k] != 0) kernels.accumulate_row(out, &tmp[(vertical.starts[y] + k) * row], row, w[k]);
+    }
+}
+
+// Resizes a float image. Its colors should be premultiplied, for transparent pixels not to darken their neighbours
+void kernel_resize(const float *src, size_t src_width, size_t src_height, float *dst, size_t dst_width, size_t dst_height, Resize_Filter filter) {
+    Resample_Plan horizontal = resample_plan(src_width, dst_width, filter);
+    Resample_Plan vertical = resample_plan(src_height, dst_height, filter);
+    // Horizontally first, so that the vertical pass only runs over rows that are already narrow
+    float *tmp = malloc(dst_width * src_height * 4 * sizeof(float));
+    for (size_t y = 0; y < src_height; y++) {
+        kernels.resample_row(&src[y * src_width * 4], &tmp[y * dst_width * 4], dst_width, horizontal.starts, horizontal.weights, horizontal.taps);
+    }
+    for (size_t y = 0; y < dst_height; y++) resample_column(tmp, &dst[y * dst_width * 4], dst_width * 4, vertical, y);
+    free(tmp);
+    resample_plan_free(horizontal);
+    resample_plan_free(vertical);
+}
+
+// Same for straight alpha RGBA8 images. Only ever converts a row at a time, so shrinking a huge photo doesn't need a
+// float copy of all of it
+void kernel_resize_rgba8(const uint8_t *src, size_t src_width, size_t src_height, uint8_t *dst, size_t dst_width, size_t dst_height, Resize_Filter filter) {
+    Resample_Plan horizontal = resample_plan(src_width, dst_width, filter);
+    Resample_Plan vertical = resample_plan(src_height, dst_height, filter);
+    uint8_t *src_row = malloc(src_width * 4);
+    float *src_row_float = malloc(src_width * 4 * sizeof(float));
+    float *dst_row_float = malloc(dst_width * 4 * sizeof(float));
+    float *tmp = malloc(dst_width * src_height * 4 * sizeof(float));
+    for (size_t y = 0; y < src_height; y++) {
+        memcpy(src_row, &src[y * src_width * 4], src_width * 4);
+        kernels.premultiply(src_row, src_width);
+        kernels.rgba8_to_float(src_row, src_row_float, src_width);
+        kernels.resample_row(src_row_float, &tmp[y * dst_width * 4], dst_width, horizontal.starts, horizontal.weights, horizontal.taps);
+    }
+    for (size_t y = 0; y < dst_height; y++) {
+        uint8_t *out = &dst[y * dst_width * 4];
+        resample_column(tmp, dst_row_float, dst_width * 4, vertical, y);
+        kernels.float_to_rgba8(dst_row_float, out, dst_width);
+        kernels.unpremultiply(out, dst_width);
+    }
+    free(src_row);
+    free(src_row_float);
+    free(dst_row_float);
+    free(tmp);
+    resample_plan_free(horizontal);
+    resample_plan_free(vertical);
+}
@@ -1,11 +1,16 @@
+#include "app.h"
+
+// In the hot-reloadable build the app has its own copy of nob
+#if defined(TRACK_ALLOCATIONS) && !defined(HOTRELOAD)
+    #define NOB_REALLOC tracked_realloc
+    #define NOB_FREE tracked_free
+#endif // defined(TRACK_ALLOCATIONS) && !defined(HOTRELOAD)
 #define NOB_IMPLEMENTATION
 #define NOB_STRIP_PREFIX
 #include "nob.h"
 
 #include "raylib.h"
 
-#include "app.h"
-
 #define X(name, ...) name##_t name;
 APP_FUNCS
 #undef X
@@ -47,6 +52,8 @@ void reload_libapp(void) {
 }
 
 bool should_reload_libapp = false;
+// So that a reload waiting on the app gets logged only once
+bool reload_postponed = false;
 
 void set_libapp_to_be_reloaded(int unused_arg_for_sigaction) {
     UNUSED(unused_arg_for_sigaction);
@@ -67,11 +74,18 @@ int main(void) {
 
     app_init();
 
-    while (!WindowShouldClose()) {
+    while (!WindowShouldClose() && !app_should_close()) {
 #ifdef HOTRELOAD
-        if (should_reload_libapp || IsKeyPressed(KEY_F5)) {
-            reload_libapp();
-            should_reload_libapp = false;
+        if (IsKeyPressed(KEY_F5)) should_reload_libapp = true;
+        if (should_reload_libapp) {
+            if (app_can_reload()) {
+                reload_libapp();
+                should_reload_libapp = false;
+                reload_postponed = false;
+            } else if (!reload_postponed) {
+                nob_log(INFO, "Postponing the reload of libapp until the file dialog is closed");
+                reload_postponed = true;
+            }
         }
 #endif // HOTRELOAD
         app_update();